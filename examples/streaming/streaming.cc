@@ -13,6 +13,18 @@
  * limitations under the License.
  */
 
+/*
+ * This example streams the subregions of a partition through a small
+ * memory footprint with a rolling window. Pass -streaming:window K to
+ * let at most K points of each index launch be in flight at a time:
+ * points beyond the window are deferred in select_tasks_to_map, the
+ * completion of the last consumer of a point advances the window, and
+ * the instances of finished points are marked for collection first so
+ * the ingest of point i+1 can overlap compute on point i without ever
+ * holding more than a window's worth of data. For example:
+ *   ./streaming -ll:csize 64 -streaming:window 2
+ */
+
 #include <cstdio>
 #include <cassert>
 #include <cstdlib>
@@ -39,24 +51,29 @@ enum FieldIDs {
 
 class StreamingMapper: public DefaultMapper {
   private:
-    int current_point;
-    int points_executed;
-    int point_types;
+    // The lowest point whose final consumer (the sum task) has not
+    // completed yet; points at or beyond window_start+window_size are
+    // backpressured in select_tasks_to_map
+    int window_start;
+    // Number of points allowed in flight at a time, zero disables the
+    // rolling window
+    int window_size;
+    // Points whose sum task completed ahead of the window start
+    std::set<int> completed_points;
+    // Instances mapped for the sum task of each point so we can mark
+    // them for eager collection once the point is done
+    std::map<int,std::vector<Mapping::PhysicalInstance> > point_instances;
+    // An event to wake up the runtime's scheduler once the window moves
+    MapperEvent window_event;
     bool enable_point_wise_analysis = false;
-    struct InFlightTask {
-      // An event that we will trigger when the task completes.
-      MapperEvent event;
-    };
-    std::deque<InFlightTask> queue;
 
   public:
     StreamingMapper(Machine m,
         Runtime *rt, Processor p)
       : DefaultMapper(rt->get_mapper_runtime(), m, p)
     {
-      current_point = 0;
-      points_executed = 0;
-      point_types = 3; // type_of_task
+      window_start = 0;
+      window_size = 0;
 
       int argc = Legion::HighLevelRuntime::get_input_args().argc;
       char **argv = Legion::HighLevelRuntime::get_input_args().argv;
@@ -66,34 +83,126 @@ class StreamingMapper: public DefaultMapper {
           this->enable_point_wise_analysis = true;
           continue;
         }
+        if (strcmp(argv[i], "-streaming:window") == 0) {
+          this->window_size = atoi(argv[++i]);
+          continue;
+        }
       }
     }
   public:
+    static inline bool is_pointwise_task(TaskID tid)
+    {
+      return (tid == POINTWISE_ANALYSABLE_FILL_ID) ||
+             (tid == POINTWISE_ANALYSABLE_INC_ID) ||
+             (tid == POINTWISE_ANALYSABLE_SUM_ID);
+    }
+
+    // Use the non-reentrant serialized model so that the window state
+    // does not need its own lock
+    MapperSyncModel get_mapper_sync_model(void) const
+    {
+      return SERIALIZED_NON_REENTRANT_MAPPER_MODEL;
+    }
+
+    void slice_task(const MapperContext ctx,
+        const Task& task,
+        const SliceTaskInput& input,
+        SliceTaskOutput& output)
+    {
+      if ((this->window_size > 0) && is_pointwise_task(task.task_id))
+      {
+        // Make a singleton slice for every point so that each point can
+        // be scheduled (or deferred) independently by the window logic
+        unsigned index = 0;
+        output.slices.reserve(input.domain.get_volume());
+        for (Domain::DomainPointIterator itr(input.domain); itr; itr++, index++)
+        {
+          const Processor proc = local_cpus[index % local_cpus.size()];
+          output.slices.push_back(TaskSlice(
+                Domain(itr.p, itr.p), proc,
+                false/*recurse*/, false/*stealable*/));
+        }
+      }
+      else
+        DefaultMapper::slice_task(ctx, task, input, output);
+    }
+
     void select_tasks_to_map(const MapperContext ctx,
         const SelectMappingInput& input,
         SelectMappingOutput& output)
     {
-      if (!this->enable_point_wise_analysis)
+      if (this->window_size == 0)
+      {
         DefaultMapper::select_tasks_to_map(ctx, input, output);
-      else
+        return;
+      }
+      bool deferred = false;
+      for (std::list<const Task*>::const_iterator it =
+          input.ready_tasks.begin();
+          (it != input.ready_tasks.end()); it++)
       {
-        MapperEvent return_event = this->runtime->create_mapper_event(ctx);
-
-        for (std::list<const Task*>::const_iterator it =
-            input.ready_tasks.begin();
-            (it != input.ready_tasks.end()); it++)
+        const Task *task = *it;
+        // After slice_task each pointwise slice covers a single point,
+        // so the lower bound of its index domain names the point
+        if (is_pointwise_task(task->task_id) &&
+            (task->index_domain.get_dim() > 0))
         {
-          output.map_tasks.insert(*it);
-        }
-        // If we don't schedule any tasks for mapping, the runtime needs to know
-        // when to ask us again to schedule more things. Return the MapperEvent we
-        // selected earlier.
-        if (output.map_tasks.size() == 0)
-        {
-          printf("Did not get any task to select\n");
-          assert(return_event.exists());
-          output.deferral_event = return_event;
+          const int point = task->index_domain.lo()[0];
+          if (point >= (this->window_start + this->window_size))
+          {
+            // Beyond the rolling window, wait for it to advance
+            deferred = true;
+            continue;
+          }
         }
+        output.map_tasks.insert(task);
+      }
+      // If we don't schedule any tasks for mapping, the runtime needs to know
+      // when to ask us again to schedule more things. Return a MapperEvent
+      // that we will trigger once the window advances.
+      if (deferred && output.map_tasks.empty())
+      {
+        if (!this->window_event.exists())
+          this->window_event = this->runtime->create_mapper_event(ctx);
+        output.deferral_event = this->window_event;
+      }
+    }
+
+    void report_profiling(const MapperContext ctx,
+        const Task& task,
+        const TaskProfilingInfo& input)
+    {
+      // Only the sum task of each point asks for profiling feedback
+      assert(task.task_id == POINTWISE_ANALYSABLE_SUM_ID);
+      ProfilingMeasurements::OperationStatus *status =
+        input.profiling_responses.get_measurement<
+          ProfilingMeasurements::OperationStatus>();
+      assert(status->result ==
+          ProfilingMeasurements::OperationStatus::COMPLETED_SUCCESSFULLY);
+      delete status;
+      const int point = task.index_point[0];
+      // The data for this point is dead now, so tell the runtime that
+      // its instances are the first things to reclaim when the next
+      // point in the window needs the space
+      std::map<int,std::vector<Mapping::PhysicalInstance> >::iterator
+        finder = this->point_instances.find(point);
+      if (finder != this->point_instances.end())
+      {
+        for (std::vector<Mapping::PhysicalInstance>::const_iterator it =
+              finder->second.begin(); it != finder->second.end(); it++)
+          this->runtime->set_garbage_collection_priority(ctx, *it,
+              LEGION_GC_FIRST_PRIORITY);
+        this->point_instances.erase(finder);
+      }
+      // Advance the window past any points that have already finished
+      this->completed_points.insert(point);
+      while (this->completed_points.erase(this->window_start) > 0)
+        this->window_start++;
+      // Wake up the scheduler if it was waiting on the window
+      if (this->window_event.exists())
+      {
+        this->runtime->trigger_mapper_event(ctx, this->window_event);
+        this->window_event = MapperEvent();
       }
     }
 
@@ -102,11 +211,9 @@ class StreamingMapper: public DefaultMapper {
                   const MapTaskInput& input,
                   MapTaskOutput& output)
     {
-      if (this->enable_point_wise_analysis)
+      if (this->enable_point_wise_analysis || (this->window_size > 0))
       {
-        if (task.task_id == POINTWISE_ANALYSABLE_FILL_ID ||
-            task.task_id == POINTWISE_ANALYSABLE_INC_ID  ||
-            task.task_id == POINTWISE_ANALYSABLE_SUM_ID)
+        if (is_pointwise_task(task.task_id))
         {
 
           Processor::Kind target_kind = task.target_proc.kind();
@@ -177,7 +284,16 @@ class StreamingMapper: public DefaultMapper {
               output.abort_mapping = true;
               return;
             }
+            if ((this->window_size > 0) &&
+                (task.task_id == POINTWISE_ANALYSABLE_SUM_ID))
+              this->point_instances[task.index_point[0]].push_back(inst);
           }
+          // The sum task is the last consumer of each point, so ask for
+          // profiling feedback on it to know when the window can advance
+          if ((this->window_size > 0) &&
+              (task.task_id == POINTWISE_ANALYSABLE_SUM_ID))
+            output.task_prof_requests.add_measurement<
+              ProfilingMeasurements::OperationStatus>();
         }
         else
         {
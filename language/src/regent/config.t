@@ -121,6 +121,7 @@ local default_options = {
   ["debuginfo"] = false,
   ["layout-constraints"] = true,
   ["trace"] = true,
+  ["auto-trace"] = false, -- automatically trace qualifying loops (requires trace)
   ["validate"] = true,
   ["emergency-gc"] = false,
   ["jobs"] = "1",
@@ -49,10 +49,331 @@ end
 
 local optimize_traces = {}
 
+-- Automatic trace detection (enabled with -fauto-trace 1): a loop can
+-- be traced without an annotation if every iteration will issue the
+-- same sequence of runtime operations on the same region requirements.
+-- The analysis below is conservative: it rejects any loop whose body
+-- can create or delete region tree state, issue a data-dependent
+-- operation, or launch onto a region or partition named through a
+-- symbol that changes from iteration to iteration.
+
+-- Symbols whose values can differ between iterations of the candidate
+-- loop: the loop variable itself, anything declared inside the body,
+-- and any non-region variable assigned inside the body.
+local function collect_variant_symbols(node)
+  local variant = {}
+  ast.traverse_node_postorder(
+    function(node)
+      if node:is(ast.typed.stat.Var) then
+        variant[node.symbol] = true
+      elseif node:is(ast.typed.stat.VarUnpack) then
+        for _, symbol in ipairs(node.symbols) do
+          variant[symbol] = true
+        end
+      elseif node:is(ast.typed.stat.ForNum) or
+        node:is(ast.typed.stat.ForNumVectorized) or
+        node:is(ast.typed.stat.ForList) or
+        node:is(ast.typed.stat.ForListVectorized) or
+        node:is(ast.typed.stat.IndexLaunchNum) or
+        node:is(ast.typed.stat.IndexLaunchList)
+      then
+        variant[node.symbol] = true
+      elseif node:is(ast.typed.stat.Assignment) or
+        node:is(ast.typed.stat.Reduce)
+      then
+        -- find the root symbol being written; writes through a region
+        -- update data, not the handle, so they don't make it variant
+        local root = node.lhs
+        while root:is(ast.typed.expr.FieldAccess) or
+          root:is(ast.typed.expr.IndexAccess) or
+          root:is(ast.typed.expr.Deref)
+        do
+          root = root.value
+        end
+        if root:is(ast.typed.expr.ID) and
+          not std.is_region(std.as_read(root.expr_type))
+        then
+          variant[root.value] = true
+        end
+      end
+    end,
+    node)
+  return variant
+end
+
+-- An expression names the same value every iteration if it touches no
+-- variant symbols.
+local function is_invariant_expr(variant, node)
+  local invariant = true
+  ast.traverse_expr_postorder(
+    function(expr)
+      if expr:is(ast.typed.expr.ID) and variant[expr.value] then
+        invariant = false
+      end
+    end,
+    node)
+  return invariant
+end
+
+-- Does this subtree issue any runtime operations at all? Loops and
+-- branches that stay entirely on the CPU can vary freely.
+local function contains_operations(node)
+  local found = false
+  ast.traverse_node_postorder(
+    function(node)
+      if (node:is(ast.typed.expr.Call) and std.is_task(node.fn.value)) or
+        node:is(ast.typed.expr.Copy) or
+        node:is(ast.typed.expr.Fill) or
+        node:is(ast.typed.expr.Acquire) or
+        node:is(ast.typed.expr.Release) or
+        node:is(ast.typed.stat.IndexLaunchNum) or
+        node:is(ast.typed.stat.IndexLaunchList) or
+        node:is(ast.typed.stat.MustEpoch) or
+        node:is(ast.typed.stat.Fence)
+      then
+        found = true
+      end
+    end,
+    node)
+  return found
+end
+
+-- Expressions that create, import or delete region tree state, or that
+-- synchronize externally, are never safe to replay from a trace.
+local function is_untraceable_expr(expr)
+  return expr:is(ast.typed.expr.MethodCall) or
+    expr:is(ast.typed.expr.RawContext) or
+    expr:is(ast.typed.expr.RawFields) or
+    expr:is(ast.typed.expr.RawPhysical) or
+    expr:is(ast.typed.expr.RawRuntime) or
+    expr:is(ast.typed.expr.RawValue) or
+    expr:is(ast.typed.expr.Ispace) or
+    expr:is(ast.typed.expr.Region) or
+    expr:is(ast.typed.expr.Partition) or
+    expr:is(ast.typed.expr.PartitionEqual) or
+    expr:is(ast.typed.expr.PartitionByField) or
+    expr:is(ast.typed.expr.PartitionByRestriction) or
+    expr:is(ast.typed.expr.Image) or
+    expr:is(ast.typed.expr.ImageByTask) or
+    expr:is(ast.typed.expr.Preimage) or
+    expr:is(ast.typed.expr.CrossProduct) or
+    expr:is(ast.typed.expr.CrossProductArray) or
+    expr:is(ast.typed.expr.ListSlicePartition) or
+    expr:is(ast.typed.expr.ListDuplicatePartition) or
+    expr:is(ast.typed.expr.ListSliceCrossProduct) or
+    expr:is(ast.typed.expr.ListCrossProduct) or
+    expr:is(ast.typed.expr.ListCrossProductComplete) or
+    expr:is(ast.typed.expr.ListPhaseBarriers) or
+    expr:is(ast.typed.expr.ListInvert) or
+    expr:is(ast.typed.expr.PhaseBarrier) or
+    expr:is(ast.typed.expr.DynamicCollective) or
+    expr:is(ast.typed.expr.DynamicCollectiveGetResult) or
+    expr:is(ast.typed.expr.Advance) or
+    expr:is(ast.typed.expr.Adjust) or
+    expr:is(ast.typed.expr.Arrive) or
+    expr:is(ast.typed.expr.Await) or
+    expr:is(ast.typed.expr.Acquire) or
+    expr:is(ast.typed.expr.Release) or
+    expr:is(ast.typed.expr.AttachHDF5) or
+    expr:is(ast.typed.expr.DetachHDF5) or
+    expr:is(ast.typed.expr.AllocateScratchFields) or
+    expr:is(ast.typed.expr.WithScratchFields) or
+    expr:is(ast.typed.expr.ImportIspace) or
+    expr:is(ast.typed.expr.ImportRegion) or
+    expr:is(ast.typed.expr.ImportPartition) or
+    expr:is(ast.typed.expr.ImportCrossProduct)
+end
+
+-- Check every expression in a subtree: no untraceable constructs, and
+-- every operation launches onto loop-invariant regions.
+local function analyze_exprs(variant, node)
+  local ok = true
+  ast.traverse_expr_postorder(
+    function(expr)
+      if is_untraceable_expr(expr) then
+        ok = false
+      elseif expr:is(ast.typed.expr.Call) then
+        if std.is_task(expr.fn.value) then
+          -- a data-dependent predicate could skip the launch entirely
+          if expr.predicate then ok = false end
+          for _, arg in ipairs(expr.args) do
+            local arg_type = std.as_read(arg.expr_type)
+            if (std.is_region(arg_type) or std.is_partition(arg_type) or
+                std.is_cross_product(arg_type) or
+                std.is_list_of_regions(arg_type)) and
+              not is_invariant_expr(variant, arg)
+            then
+              ok = false
+            end
+          end
+        end
+      elseif expr:is(ast.typed.expr.Copy) then
+        if not (is_invariant_expr(variant, expr.src) and
+                is_invariant_expr(variant, expr.dst))
+        then
+          ok = false
+        end
+      elseif expr:is(ast.typed.expr.Fill) then
+        if not is_invariant_expr(variant, expr.dst) then
+          ok = false
+        end
+      end
+    end,
+    node)
+  return ok
+end
+
+local analyze_stat
+
+local function analyze_block(variant, block)
+  for _, stat in ipairs(block.stats) do
+    if not analyze_stat(variant, stat) then
+      return false
+    end
+  end
+  return true
+end
+
+function analyze_stat(variant, node)
+  -- an explicit trace requested on an inner statement will be inserted
+  -- on this same walk; traces must not nest
+  if node.annotations.trace:is(ast.annotation.Demand) then
+    return false
+  end
+
+  if node:is(ast.typed.stat.Var) then
+    return not node.value or analyze_exprs(variant, node.value)
+
+  elseif node:is(ast.typed.stat.VarUnpack) then
+    return analyze_exprs(variant, node.value)
+
+  elseif node:is(ast.typed.stat.Assignment) or
+    node:is(ast.typed.stat.Reduce)
+  then
+    return analyze_exprs(variant, node.lhs) and
+      analyze_exprs(variant, node.rhs)
+
+  elseif node:is(ast.typed.stat.Expr) then
+    return analyze_exprs(variant, node.expr)
+
+  elseif node:is(ast.typed.stat.Block) then
+    return analyze_block(variant, node.block)
+
+  elseif node:is(ast.typed.stat.If) then
+    if not analyze_exprs(variant, node.cond) then return false end
+    for _, elseif_block in ipairs(node.elseif_blocks) do
+      if not analyze_exprs(variant, elseif_block.cond) then return false end
+      if not analyze_block(variant, elseif_block.block) then return false end
+    end
+    if not (analyze_block(variant, node.then_block) and
+            analyze_block(variant, node.else_block))
+    then
+      return false
+    end
+    -- a branch whose condition varies between iterations is only safe
+    -- if no side issues operations
+    if is_invariant_expr(variant, node.cond) then
+      local conds_invariant = true
+      for _, elseif_block in ipairs(node.elseif_blocks) do
+        if not is_invariant_expr(variant, elseif_block.cond) then
+          conds_invariant = false
+        end
+      end
+      if conds_invariant then return true end
+    end
+    return not contains_operations(node)
+
+  elseif node:is(ast.typed.stat.While) or node:is(ast.typed.stat.Repeat) then
+    -- the trip count of a nested loop is not statically known, so it
+    -- may only appear inside a trace if it issues no operations
+    return analyze_block(variant, node.block) and
+      not contains_operations(node)
+
+  elseif node:is(ast.typed.stat.ForNum) or
+    node:is(ast.typed.stat.ForNumVectorized)
+  then
+    if not analyze_block(variant, node.block) then return false end
+    if not contains_operations(node.block) then return true end
+    for _, value in ipairs(node.values) do
+      if not (analyze_exprs(variant, value) and
+              is_invariant_expr(variant, value))
+      then
+        return false
+      end
+    end
+    return true
+
+  elseif node:is(ast.typed.stat.ForList) or
+    node:is(ast.typed.stat.ForListVectorized)
+  then
+    if not analyze_block(variant, node.block) then return false end
+    if not contains_operations(node.block) then return true end
+    return analyze_exprs(variant, node.value) and
+      is_invariant_expr(variant, node.value)
+
+  elseif node:is(ast.typed.stat.IndexLaunchNum) or
+    node:is(ast.typed.stat.IndexLaunchList)
+  then
+    -- the launch domain must be invariant; within the launch itself the
+    -- point symbol is fine (the projection is part of the operation)
+    if node:is(ast.typed.stat.IndexLaunchNum) then
+      for _, value in ipairs(node.values) do
+        if not is_invariant_expr(variant, value) then return false end
+      end
+    else
+      if not is_invariant_expr(variant, node.value) then return false end
+    end
+    for _, stat in ipairs(node.preamble) do
+      if not analyze_stat(variant, stat) then return false end
+    end
+    local launch_variant = {}
+    for symbol, flag in pairs(variant) do
+      launch_variant[symbol] = flag
+    end
+    launch_variant[node.symbol] = nil
+    return analyze_exprs(launch_variant, node.call)
+
+  else
+    -- everything else (returns, breaks, deletions, fences, explicit
+    -- traces, must-epochs, mapping calls, ...) disqualifies the loop
+    return false
+  end
+end
+
+-- A loop qualifies for automatic tracing if its body issues at least
+-- one operation and the whole body passes the analysis above.
+local function can_auto_trace(node, block)
+  local variant = collect_variant_symbols(node)
+  if not contains_operations(block) then return false end
+  return analyze_block(variant, block)
+end
+
+local function should_trace(node, block)
+  if node.annotations.trace:is(ast.annotation.Demand) then
+    return true
+  end
+  if not std.config["auto-trace"] or
+    node.annotations.trace:is(ast.annotation.Forbid)
+  then
+    return false
+  end
+  -- only loops repeat, so only loops are worth tracing automatically
+  if not (node:is(ast.typed.stat.While) or
+          node:is(ast.typed.stat.ForNum) or
+          node:is(ast.typed.stat.ForList) or
+          node:is(ast.typed.stat.Repeat))
+  then
+    return false
+  end
+  -- analyze the already-processed block so that an explicit trace on an
+  -- inner loop disqualifies the outer one (traces must not nest)
+  return can_auto_trace(node, block)
+end
+
 local function apply_tracing_block(cx, node)
   local block = optimize_traces.block(cx, node.block)
 
-  if not node.annotations.trace:is(ast.annotation.Demand) then
+  if not should_trace(node, block) then
     return node { block = block }
   end
 
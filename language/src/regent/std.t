@@ -4487,6 +4487,10 @@ local function incremental_compile_tasks()
     c.mkdir(cache_regent_dir, 0x1c0)
   end
 
+  -- First pass: compute each variant's checksum and collect the cache
+  -- misses that actually need to be compiled.
+  local misses = terralib.newlist()
+  local pending = {}
   for _, variant in ipairs(variants) do
     local exports = { [variant:wrapper_name()] = variant:make_wrapper() }
     local checksum_m
@@ -4500,19 +4504,13 @@ local function incremental_compile_tasks()
     local cache_filename = cache_regent_dir .. "/" .. checksum_m .. ".o"
 
     if c.access(cache_filename, c.F_OK) == -1 then
-      -- If object file doesn't exist then create it.
+      -- If object file doesn't exist then remember to create it (variants
+      -- with identical checksums only need to be compiled once).
       pclog:info('cached file does NOT exist '  .. cache_filename .. ': task = ' .. variant.definition:getname())
-
-      -- Save to a temporary file first. This is important to avoid race
-      -- conditions in case multiple compilations are proceeding concurrently.
-      local objtmp = os.tmpname()
-      terralib.saveobj(objtmp, "object", exports, nil, nil, base.opt_profile)
-
-      -- Now attempt to move the object file into place. Note: This is atomic,
-      -- so we don't need to worry about races.
-      local ok = os.execute("/bin/mv ".. objtmp .. " " .. cache_filename)
-      if ok ~= 0 then
-        assert(false, "failed to move cache file")
+      if not pending[cache_filename] then
+        pending[cache_filename] = true
+        misses:insert({ variant = variant, exports = exports,
+                        filename = cache_filename })
       end
     else
       -- Otherwise do nothing (will automatically reuse the cached object file).
@@ -4522,6 +4520,94 @@ local function incremental_compile_tasks()
     objfiles:insert(cache_filename)
   end
 
+  local function compile_miss(miss)
+    -- Save to a temporary file first. This is important to avoid race
+    -- conditions in case multiple compilations are proceeding concurrently.
+    local objtmp = os.tmpname()
+    terralib.saveobj(objtmp, "object", miss.exports, nil, nil, base.opt_profile)
+
+    -- Now attempt to move the object file into place. Note: This is atomic,
+    -- so we don't need to worry about races (between our own slaves or with
+    -- other regent processes sharing the cache).
+    local ok = os.execute("/bin/mv ".. objtmp .. " " .. miss.filename)
+    if ok ~= 0 then
+      assert(false, "failed to move cache file")
+    end
+  end
+
+  -- Second pass: compile the misses, distributing them to slave processes
+  -- on demand when parallel compilation was requested.
+  local num_slaves = math.max(tonumber(std.config["jobs"]) or 1, 1)
+  if num_slaves == 1 or #misses <= 1 then
+    for _, miss in ipairs(misses) do
+      profile('compile', miss.variant, function() compile_miss(miss) end)()
+    end
+  else
+    local slave_pids = terralib.newlist()
+    local slave_pipes = terralib.newlist()
+    local slave2master = make_pipe()
+    for slave_id = 1,math.min(num_slaves, #misses) do
+      pclog:info('master: spawning slave ' .. slave_id)
+      local master2slave = make_pipe()
+      slave_pipes:insert(master2slave)
+      local pid = c.fork()
+      assert(pid >= 0, 'fork failed')
+      if pid == 0 then
+        slave2master:close_read_end()
+        master2slave:close_write_end()
+        while true do
+          pclog:info('slave ' .. slave_id .. ': signaling master to send work')
+          slave2master:write_int(slave_id)
+          local miss_id = master2slave:read_int()
+          assert(0 <= miss_id and miss_id <= #misses,
+                 'slave ' .. slave_id .. ': miss id read error')
+          if miss_id == 0 then
+            pclog:info('slave ' .. slave_id .. ': stopping')
+            break
+          end
+          local miss = misses[miss_id]
+          pclog:info('slave ' .. slave_id .. ': compiling ' ..
+                     tostring(miss.variant) .. ' to file ' .. miss.filename)
+          profile('compile', miss.variant, function() compile_miss(miss) end)()
+        end
+        slave2master:close_write_end()
+        master2slave:close_read_end()
+        os.exit(c.EXIT_SUCCESS)
+      else
+        pclog:info('master: slave ' .. slave_id .. ' spawned as pid ' .. pid)
+        slave_pids:insert(pid)
+        master2slave:close_read_end()
+      end
+    end
+    slave2master:close_write_end()
+    local num_spawned = #slave_pids
+    local next_miss = 1
+    local num_stopped = 0
+    while num_stopped < num_spawned do
+      pclog:info('master: waiting for next available slave')
+      local slave_id = slave2master:read_int()
+      assert(1 <= slave_id and slave_id <= num_spawned,
+             'master: slave id read error')
+      local master2slave = slave_pipes[slave_id]
+      if next_miss <= #misses then
+        pclog:info('master: assigning ' .. tostring(misses[next_miss].variant) ..
+                   ' to slave ' .. slave_id)
+        master2slave:write_int(next_miss)
+        next_miss = next_miss + 1
+      else
+        pclog:info('master: sending stop command to slave ' .. slave_id)
+        master2slave:write_int(0)
+        master2slave:close_write_end()
+        num_stopped = num_stopped + 1
+      end
+    end
+    for slave_id,pid in ipairs(slave_pids) do
+      pclog:info('master: waiting for slave ' .. slave_id .. ' to finish')
+      c.waitpid(pid, nil, 0)
+    end
+    slave2master:close_read_end()
+  end
+
   -- Declare all task wrappers using a (fake) header file, so the compiler will
   -- expect them to be linked-in later.
   local header = [[
@@ -1390,6 +1390,54 @@ namespace Legion {
                              Realm::RegionInstance instance) const;
     };
 
+    /**
+     * \class FutureMapSnapshot
+     * A future map snapshot is an immutable view of all the point
+     * futures in a future map. Constructing a snapshot blocks until
+     * every point future has been materialized on the local node.
+     * After that, point lookups index directly into a flat table of
+     * future handles without entering the runtime or acquiring any
+     * locks, which makes snapshots well suited to loops that poll
+     * many points repeatedly (e.g. testing readiness each timestep).
+     * The table is sized by the bounding box of the future map's
+     * domain, so snapshots of very sparse future maps can be memory
+     * intensive. Like future maps, snapshots should not escape the
+     * context in which the future map was created as the runtime
+     * reclaims the futures when the enclosing context completes.
+     */
+    class FutureMapSnapshot {
+    public:
+      FutureMapSnapshot(void);
+      FutureMapSnapshot(const FutureMapSnapshot &rhs) = default;
+      FutureMapSnapshot(FutureMapSnapshot &&rhs) noexcept = default;
+      FutureMapSnapshot& operator=(const FutureMapSnapshot &rhs) = default;
+      FutureMapSnapshot& operator=(FutureMapSnapshot &&rhs) noexcept = default;
+    private:
+      // Only future maps can make non-empty snapshots
+      friend class FutureMap;
+      FutureMapSnapshot(const Domain &domain, std::vector<Future> &&futures);
+    public:
+      inline bool exists(void) const { return !futures.empty(); }
+      /**
+       * Return the future for the given point without entering the
+       * runtime. The point must be contained in the snapshot's domain.
+       * @param point the point in the index space launch
+       * @return a future for the point in the index task launch
+       */
+      inline Future get_future(const DomainPoint &point) const;
+      inline Future operator[](const DomainPoint &point) const
+        { return get_future(point); }
+      /**
+       * Return the domain of points that can be used to index
+       * into this snapshot.
+       * @return domain of all points in the snapshot
+       */
+      inline Domain get_domain(void) const { return domain; }
+    private:
+      Domain domain;
+      std::vector<Future> futures;
+    };
+
     /**
      * \class FutureMap
      * Future maps are the values returned from asynchronous index space
@@ -1495,12 +1543,22 @@ namespace Legion {
                             const char *warning_string = NULL) const; 
     public:
       /**
-       * This method will return the domain of points that can be 
+       * This method will return the domain of points that can be
        * used to index into this future map.
        * @return domain of all points in the future map
        */
       Domain get_future_map_domain(void) const;
-    }; 
+    public:
+      /**
+       * Construct an immutable snapshot of this future map. This call
+       * blocks until every point future has been materialized locally,
+       * but the resulting snapshot supports repeated point lookups
+       * without entering the runtime or acquiring any locks. See the
+       * documentation of FutureMapSnapshot for the details.
+       * @return a snapshot of all the point futures in this future map
+       */
+      FutureMapSnapshot get_snapshot(void) const;
+    };
 
 
     //==========================================================================
@@ -2662,6 +2720,10 @@ namespace Legion {
        * @return the privilege mode for this physical region
        */
       PrivilegeMode get_privilege(void) const;
+      /**
+       * @return the coherence property for this physical region
+       */
+      CoherenceProperty get_coherence(void) const;
       /**
        * Return the memories where the underlying physical instances locate.
        */
@@ -2800,6 +2862,8 @@ namespace Legion {
      *  - const FT* ptr(const Rect<N,T>&, size_t = sizeof(FT)) const (dense)
      *  - const FT* ptr(const Rect<N,T>&, size_t strides[N], 
      *                  size_t=sizeof(FT)) const
+     *  - const FT* aligned_ptr<ALIGNMENT>(const Rect<N,T>&,
+     *                  size_t=sizeof(FT)) const (dense, affine only)
      *  - const FT& operator[](const Point<N,T>&) const
      *
      * READ_WRITE
@@ -2809,6 +2873,8 @@ namespace Legion {
      *  - FT* ptr(const Point<N,T>&) const
      *  - FT* ptr(const Rect<N,T>&, size_t = sizeof(FT)) const (must be dense)
      *  - FT* ptr(const Rect<N,T>&, size_t strides[N], size_t=sizeof(FT)) const
+     *  - FT* aligned_ptr<ALIGNMENT>(const Rect<N,T>&,
+     *                  size_t=sizeof(FT)) const (dense, affine only)
      *  - FT& operator[](const Point<N,T>&) const
      *  - template<typename REDOP, bool EXCLUSIVE> 
      *      void reduce(const Point<N,T>&, REDOP::RHS) const
@@ -2819,6 +2885,8 @@ namespace Legion {
      *  - FT* ptr(const Point<N,T>&) const
      *  - FT* ptr(const Rect<N,T>&, size_t = sizeof(FT)) const (must be dense)
      *  - FT* ptr(const Rect<N,T>&, size_t strides[N], size_t=sizeof(FT)) const
+     *  - FT* aligned_ptr<ALIGNMENT>(const Rect<N,T>&,
+     *                  size_t=sizeof(FT)) const (dense, affine only)
      *  - FT& operator[](const Point<N,T>&) const
      */
     template<PrivilegeMode MODE, typename FT, int N, typename COORD_T = coord_t,
@@ -3382,6 +3450,8 @@ namespace Legion {
      *  - FT* ptr(const Point<N,T>&) const
      *  - FT* ptr(const Rect<N,T>&, size_t = sizeof(FT)) const (must be dense)
      *  - FT* ptr(const Rect<N,T>&, size_t strides[N], size_t=sizeof(FT)) const
+     *  - FT* aligned_ptr<ALIGNMENT>(const Rect<N,T>&,
+     *                  size_t=sizeof(FT)) const (dense, affine only)
      *  - FT& operator[](const Point<N,T>&) const
      *  - template<typename REDOP, bool EXCLUSIVE> 
      *      void reduce(const Point<N,T>&, REDOP::RHS) const
@@ -3684,10 +3754,16 @@ namespace Legion {
      * \class SpanIterator
      * While the common model for compact instances is to use a piece iterator
      * to walk over pieces and create a field accessor to index the elements in
-     * each piece, some applications want to transpose these loops and walk 
-     * linearly over all spans of a field with a common stride without needing 
-     * to know which piece they belong to. The SpanIterator class allows this 
-     * piece-agnostic traversal of a field.
+     * each piece, some applications want to transpose these loops and walk
+     * linearly over all spans of a field with a common stride without needing
+     * to know which piece they belong to. The SpanIterator class allows this
+     * piece-agnostic traversal of a field. Note that this is also the
+     * preferred way to iterate fields over sparse index spaces: with
+     * 'privileges_only' set, the pieces are intersected with the dense
+     * rectangles of the privilege space's sparsity map, so each span is a
+     * (pointer, count, stride) run over populated points only and kernels
+     * pay no per-point iterator overhead for the empty space, unlike
+     * traversals built on PointInDomainIterator.
      */
     template<PrivilegeMode PM, typename FT, int DIM, typename COORD_T = coord_t>
     class SpanIterator {
@@ -7832,6 +7908,22 @@ namespace Legion {
        */
       void progress_unordered_operations(Context ctx);
 
+      /**
+       * Advise the runtime that upcoming operations launched by this task
+       * are likely to access the given logical region so that it can begin
+       * warming up the versioning metadata for the region ahead of need.
+       * This is purely a performance hint: it acquires no privileges,
+       * performs no synchronization, and the runtime is free to ignore it.
+       * @param ctx enclosing task context
+       * @param handle the logical region expected to be accessed, which
+       *          must be a subregion of a region requirement of this task
+       * @param fields optional set of fields expected to be accessed; an
+       *          empty set means any fields of the enclosing requirement
+       */
+      void prefetch_region(Context ctx, LogicalRegion handle,
+                           const std::set<FieldID> &fields =
+                                                  std::set<FieldID>());
+
       /**
        * @deprecated
        * Attach an HDF5 file as a physical region. The file must already 
@@ -8224,7 +8316,32 @@ namespace Legion {
       Future issue_execution_fence(Context ctx, const char *provenance = NULL);
     public:
       //------------------------------------------------------------------------
-      // Tracing Operations 
+      // Checkpoint Support
+      //------------------------------------------------------------------------
+      /**
+       * Return the number of operations with write or reduction
+       * privileges on the given field of the region's tree that have
+       * been analyzed in this context so far. Applications implementing
+       * incremental checkpointing can record this count when writing a
+       * checkpoint and compare it against a later sample to decide
+       * whether the field's data may have changed and therefore needs
+       * to be written out again. The count is maintained at the
+       * granularity of the whole region tree so it is conservative: a
+       * write to any region in the tree advances the count for the
+       * written fields. Since operations are analyzed asynchronously,
+       * issue an execution fence and wait on its future before sampling
+       * the count to get a consistent snapshot.
+       * @param ctx the enclosing task context
+       * @param handle the logical region being queried
+       * @param fid the field being queried
+       * @return number of write operations analyzed for the field so far
+       */
+      unsigned long long get_field_write_count(Context ctx,
+                                               LogicalRegion handle,
+                                               FieldID fid);
+    public:
+      //------------------------------------------------------------------------
+      // Tracing Operations
       //------------------------------------------------------------------------
       /**
        * Start a new trace of legion operations. Tracing enables
@@ -10097,11 +10214,38 @@ namespace Legion {
 				      const CodeDescriptor &codedesc,
 				      const void *user_data = NULL,
 				      size_t user_len = 0,
-                                      size_t return_type_size = 
+                                      size_t return_type_size =
                                                       LEGION_MAX_RETURN_SIZE,
                                       VariantID vid = LEGION_AUTO_GENERATE_ID,
                                       bool has_return_type_size = true);
 
+      /**
+       * Begin batching the broadcasts for dynamic task variant
+       * registrations that request global registration. Normally each
+       * such registration performs its own broadcast to all the other
+       * nodes and blocks until every node has completed the
+       * registration, which serializes a round trip per variant. While
+       * a batch is open the broadcasts are deferred and the calls to
+       * register_task_variant return as soon as the local registration
+       * is complete. The matching call to end_task_variant_batch packs
+       * all of the deferred variants into a single broadcast and blocks
+       * until every node has registered all of them. Applications that
+       * register many variants (e.g. per-type template instantiations)
+       * should wrap the registrations in a batch. Batches may be
+       * nested, in which case only the outermost end call performs the
+       * broadcast. It is illegal to launch a task that might use one of
+       * the batched variants remotely before the batch is ended.
+       */
+      void begin_task_variant_batch(void);
+
+      /**
+       * End a batch of dynamic task variant registrations started with
+       * begin_task_variant_batch and broadcast all of the deferred
+       * variants to the other nodes in a single exchange. This call
+       * will block until every node has performed the registrations.
+       */
+      void end_task_variant_batch(void);
+
       /**
        * Statically register a new task variant with the runtime with
        * a non-void return type prior to the runtime starting. This call
@@ -901,10 +901,200 @@
       static inline uint64_t extract_mask(__m256d value);
     protected:
       BitMaskHelp::BitVector<MAX> bits;
-      uint64_t sum_mask; 
+      uint64_t sum_mask;
     };
 #endif // __AVX__
 
+#ifdef __AVX512F__
+    /////////////////////////////////////////////////////////////
+    // AVX-512 Bit Mask
+    /////////////////////////////////////////////////////////////
+    template<unsigned int MAX>
+    class alignas(64) AVX512BitMask
+      : public BitMaskHelp::Heapify<AVX512BitMask<MAX> > {
+    public:
+      static constexpr unsigned ELEMENT_SIZE =
+        BitMaskHelp::BitVector<MAX>::ELEMENT_SIZE;
+      static constexpr unsigned BIT_ELMTS = MAX/ELEMENT_SIZE;
+      static constexpr unsigned AVX512_ELMTS = MAX/512;
+      static constexpr unsigned MAXSIZE = MAX;
+    public:
+      explicit AVX512BitMask(uint64_t init = 0);
+      AVX512BitMask(const AVX512BitMask &rhs);
+      ~AVX512BitMask(void);
+    public:
+      inline void set_bit(unsigned bit);
+      inline void unset_bit(unsigned bit);
+      inline void assign_bit(unsigned bit, bool val);
+      inline bool is_set(unsigned bit) const;
+      inline int find_first_set(void) const;
+      inline int find_next_set(unsigned start) const;
+      inline int find_index(unsigned bit) const;
+      inline int get_index(unsigned index) const;
+      inline bool empty(void) const;
+      inline void clear(void);
+    public:
+      inline size_t size(void) const { return pop_count(); }
+      inline bool contains(unsigned bit) const { return is_set(bit); }
+      inline void add(unsigned bit) { set_bit(bit); }
+      inline void insert(unsigned bit) { set_bit(bit); }
+      inline void remove(unsigned bit) { unset_bit(bit); }
+    public:
+      inline bool operator==(const AVX512BitMask &rhs) const;
+      inline bool operator<(const AVX512BitMask &rhs) const;
+      inline bool operator!=(const AVX512BitMask &rhs) const;
+    public:
+      inline const uint64_t& operator[](const unsigned &idx) const;
+      inline uint64_t& operator[](const unsigned &idx);
+      inline AVX512BitMask& operator=(const AVX512BitMask &rhs);
+    public:
+      inline AVX512BitMask operator~(void) const;
+      inline AVX512BitMask operator|(const AVX512BitMask &rhs) const;
+      inline AVX512BitMask operator&(const AVX512BitMask &rhs) const;
+      inline AVX512BitMask operator^(const AVX512BitMask &rhs) const;
+    public:
+      inline AVX512BitMask& operator|=(const AVX512BitMask &rhs);
+      inline AVX512BitMask& operator&=(const AVX512BitMask &rhs);
+      inline AVX512BitMask& operator^=(const AVX512BitMask &rhs);
+    public:
+      // Use * for disjointness testing
+      inline bool operator*(const AVX512BitMask &rhs) const;
+      // Set difference
+      inline AVX512BitMask operator-(const AVX512BitMask &rhs) const;
+      inline AVX512BitMask& operator-=(const AVX512BitMask &rhs);
+      // Test to see if everything is zeros
+      inline bool operator!(void) const;
+    public:
+      inline AVX512BitMask operator<<(unsigned shift) const;
+      inline AVX512BitMask operator>>(unsigned shift) const;
+    public:
+      inline AVX512BitMask& operator<<=(unsigned shift);
+      inline AVX512BitMask& operator>>=(unsigned shift);
+    public:
+      inline uint64_t get_hash_key(void) const;
+      inline const uint64_t* base(void) const;
+      template<typename ST>
+      inline void serialize(ST &rez) const;
+      template<typename DT>
+      inline void deserialize(DT &derez);
+      // The functor class must have an 'apply' method that
+      // takes one unsigned argument. This method will map
+      // the functor over all the entries in the mask.
+      template<typename FUNCTOR>
+      inline void map(FUNCTOR &functor) const;
+    public:
+      // Allocates memory that becomes owned by the caller
+      inline char* to_string(void) const;
+    public:
+      inline unsigned pop_count(void) const;
+      static inline unsigned pop_count(const AVX512BitMask<MAX> &mask);
+    protected:
+      // Aligned vector accessors for the underlying bit vector
+      inline __m512i load_vec(unsigned idx) const
+        { return _mm512_load_si512(
+            (const void*)(bits.bit_vector + (idx << 3))); }
+      inline void store_vec(unsigned idx, __m512i value)
+        { _mm512_store_si512((void*)(bits.bit_vector + (idx << 3)), value); }
+    protected:
+      BitMaskHelp::BitVector<MAX> bits;
+    };
+
+    /////////////////////////////////////////////////////////////
+    // AVX-512 Two-Level Bit Mask
+    /////////////////////////////////////////////////////////////
+    template<unsigned int MAX>
+    class alignas(64) AVX512TLBitMask
+      : public BitMaskHelp::Heapify<AVX512TLBitMask<MAX> > {
+    public:
+      static constexpr unsigned ELEMENT_SIZE =
+        BitMaskHelp::BitVector<MAX>::ELEMENT_SIZE;
+      static constexpr unsigned BIT_ELMTS = MAX/ELEMENT_SIZE;
+      static constexpr unsigned AVX512_ELMTS = MAX/512;
+      static constexpr unsigned MAXSIZE = MAX;
+    public:
+      explicit AVX512TLBitMask(uint64_t init = 0);
+      AVX512TLBitMask(const AVX512TLBitMask &rhs);
+      ~AVX512TLBitMask(void);
+    public:
+      inline void set_bit(unsigned bit);
+      inline void unset_bit(unsigned bit);
+      inline void assign_bit(unsigned bit, bool val);
+      inline bool is_set(unsigned bit) const;
+      inline int find_first_set(void) const;
+      inline int find_next_set(unsigned start) const;
+      inline int find_index(unsigned bit) const;
+      inline int get_index(unsigned index) const;
+      inline bool empty(void) const;
+      inline void clear(void);
+    public:
+      inline size_t size(void) const { return pop_count(); }
+      inline bool contains(unsigned bit) const { return is_set(bit); }
+      inline void add(unsigned bit) { set_bit(bit); }
+      inline void insert(unsigned bit) { set_bit(bit); }
+      inline void remove(unsigned bit) { unset_bit(bit); }
+    public:
+      inline bool operator==(const AVX512TLBitMask &rhs) const;
+      inline bool operator<(const AVX512TLBitMask &rhs) const;
+      inline bool operator!=(const AVX512TLBitMask &rhs) const;
+    public:
+      inline const uint64_t& operator[](const unsigned &idx) const;
+      inline uint64_t& operator[](const unsigned &idx);
+      inline AVX512TLBitMask& operator=(const AVX512TLBitMask &rhs);
+    public:
+      inline AVX512TLBitMask operator~(void) const;
+      inline AVX512TLBitMask operator|(const AVX512TLBitMask &rhs) const;
+      inline AVX512TLBitMask operator&(const AVX512TLBitMask &rhs) const;
+      inline AVX512TLBitMask operator^(const AVX512TLBitMask &rhs) const;
+    public:
+      inline AVX512TLBitMask& operator|=(const AVX512TLBitMask &rhs);
+      inline AVX512TLBitMask& operator&=(const AVX512TLBitMask &rhs);
+      inline AVX512TLBitMask& operator^=(const AVX512TLBitMask &rhs);
+    public:
+      // Use * for disjointness testing
+      inline bool operator*(const AVX512TLBitMask &rhs) const;
+      // Set difference
+      inline AVX512TLBitMask operator-(const AVX512TLBitMask &rhs) const;
+      inline AVX512TLBitMask& operator-=(const AVX512TLBitMask &rhs);
+      // Test to see if everything is zeros
+      inline bool operator!(void) const;
+    public:
+      inline AVX512TLBitMask operator<<(unsigned shift) const;
+      inline AVX512TLBitMask operator>>(unsigned shift) const;
+    public:
+      inline AVX512TLBitMask& operator<<=(unsigned shift);
+      inline AVX512TLBitMask& operator>>=(unsigned shift);
+    public:
+      inline uint64_t get_hash_key(void) const;
+      inline const uint64_t* base(void) const;
+      template<typename ST>
+      inline void serialize(ST &rez) const;
+      template<typename DT>
+      inline void deserialize(DT &derez);
+      // The functor class must have an 'apply' method that
+      // takes one unsigned argument. This method will map
+      // the functor over all the entries in the mask.
+      template<typename FUNCTOR>
+      inline void map(FUNCTOR &functor) const;
+    public:
+      // Allocates memory that becomes owned by the caller
+      inline char* to_string(void) const;
+    public:
+      inline unsigned pop_count(void) const;
+      static inline unsigned pop_count(const AVX512TLBitMask<MAX> &mask);
+      static inline uint64_t extract_mask(__m512i value);
+    protected:
+      // Aligned vector accessors for the underlying bit vector
+      inline __m512i load_vec(unsigned idx) const
+        { return _mm512_load_si512(
+            (const void*)(bits.bit_vector + (idx << 3))); }
+      inline void store_vec(unsigned idx, __m512i value)
+        { _mm512_store_si512((void*)(bits.bit_vector + (idx << 3)), value); }
+    protected:
+      BitMaskHelp::BitVector<MAX> bits;
+      uint64_t sum_mask;
+    };
+#endif // __AVX512F__
+
 #ifdef __ALTIVEC__
     /////////////////////////////////////////////////////////////
     // PPC Bit Mask  
@@ -1400,6 +1590,43 @@
       return result;
     }
 
+    //--------------------------------------------------------------------------
+    template<unsigned WORDS, typename ST, typename T>
+    inline void pack_bits(ST &rez, const T *bits)
+    //--------------------------------------------------------------------------
+    {
+      // Sparse wire format for bit masks: a small bitmap recording which
+      // words of the vector are non-zero followed by just those words.
+      // Masks that cross the wire usually name only a few fields or nodes
+      // so this is considerably smaller than shipping the whole vector.
+      constexpr unsigned BYTES = (WORDS + 7) / 8;
+      uint8_t presence[BYTES] = { 0 };
+      for (unsigned idx = 0; idx < WORDS; idx++)
+        if (bits[idx] != 0)
+          presence[idx/8] |= (1 << (idx%8));
+      rez.serialize(presence, BYTES);
+      for (unsigned idx = 0; idx < WORDS; idx++)
+        if (bits[idx] != 0)
+          rez.template serialize(bits[idx]);
+    }
+
+    //--------------------------------------------------------------------------
+    template<unsigned WORDS, typename DT, typename T>
+    inline void unpack_bits(DT &derez, T *bits)
+    //--------------------------------------------------------------------------
+    {
+      constexpr unsigned BYTES = (WORDS + 7) / 8;
+      uint8_t presence[BYTES];
+      derez.deserialize(presence, BYTES);
+      for (unsigned idx = 0; idx < WORDS; idx++)
+      {
+        if (presence[idx/8] & (1 << (idx%8)))
+          derez.template deserialize(bits[idx]);
+        else
+          bits[idx] = 0;
+      }
+    }
+
     /**
      * A helper class for determining alignment of types
      */
@@ -2126,7 +2353,7 @@
     inline void BitMask<T,MAX,SHIFT,MASK>::serialize(ST &rez) const
     //-------------------------------------------------------------------------
     {
-      rez.serialize(bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bit_vector);
     } 
 
     //-------------------------------------------------------------------------
@@ -2135,7 +2362,7 @@
     inline void BitMask<T,MAX,SHIFT,MASK>::deserialize(DT &derez)
     //-------------------------------------------------------------------------
     {
-      derez.deserialize(bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -2882,7 +3109,7 @@
     //-------------------------------------------------------------------------
     {
       rez.template serialize(sum_mask);
-      rez.serialize(bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -2892,7 +3119,7 @@
     //-------------------------------------------------------------------------
     {
       derez.template deserialize(sum_mask);
-      derez.deserialize(bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -3623,7 +3850,7 @@
     inline void SSEBitMask<MAX>::serialize(ST &rez) const
     //-------------------------------------------------------------------------
     {
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -3631,7 +3858,7 @@
     inline void SSEBitMask<MAX>::deserialize(DT &derez)
     //-------------------------------------------------------------------------
     {
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -4372,7 +4599,7 @@
     //-------------------------------------------------------------------------
     {
       rez.serialize(sum_mask);
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -4381,7 +4608,7 @@
     //-------------------------------------------------------------------------
     {
       derez.deserialize(sum_mask);
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -5149,7 +5376,7 @@
     inline void AVXBitMask<MAX>::serialize(ST &rez) const
     //-------------------------------------------------------------------------
     {
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -5157,7 +5384,7 @@
     inline void AVXBitMask<MAX>::deserialize(DT &derez)
     //-------------------------------------------------------------------------
     {
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -5978,7 +6205,7 @@
     //-------------------------------------------------------------------------
     {
       rez.serialize(sum_mask);
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -5987,7 +6214,7 @@
     //-------------------------------------------------------------------------
     {
       derez.deserialize(sum_mask);
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -6101,6 +6328,1452 @@
     }
 #endif // __AVX__
 
+#ifdef __AVX512F__
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    AVX512BitMask<MAX>::AVX512BitMask(uint64_t init /*= 0*/)
+    //-------------------------------------------------------------------------
+    {
+      static_assert((MAX % 512) == 0);
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        bits.bit_vector[idx] = init;
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    AVX512BitMask<MAX>::AVX512BitMask(const AVX512BitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      static_assert((MAX % 512) == 0);
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, rhs.load_vec(idx));
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    AVX512BitMask<MAX>::~AVX512BitMask(void)
+    //-------------------------------------------------------------------------
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512BitMask<MAX>::set_bit(unsigned bit)
+    //-------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(bit < MAX);
+#endif
+      unsigned idx = bit >> 6;
+      bits.bit_vector[idx] |= (1UL << (bit & 0x3F));
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512BitMask<MAX>::unset_bit(unsigned bit)
+    //-------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(bit < MAX);
+#endif
+      unsigned idx = bit >> 6;
+      bits.bit_vector[idx] &= ~(1UL << (bit & 0x3F));
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512BitMask<MAX>::assign_bit(unsigned bit, bool val)
+    //-------------------------------------------------------------------------
+    {
+      if (val)
+        set_bit(bit);
+      else
+        unset_bit(bit);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::is_set(unsigned bit) const
+    //-------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(bit < MAX);
+#endif
+      unsigned idx = bit >> 6;
+      return (bits.bit_vector[idx] & (1UL << (bit & 0x3F)));
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512BitMask<MAX>::find_first_set(void) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        if (bits.bit_vector[idx])
+        {
+          for (unsigned j = 0; j < ELEMENT_SIZE; j++)
+          {
+            if (bits.bit_vector[idx] & (1UL << j))
+            {
+              return (idx*ELEMENT_SIZE + j);
+            }
+          }
+        }
+      }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512BitMask<MAX>::find_index(unsigned bit) const
+    //-------------------------------------------------------------------------
+    {
+      unsigned element = bit >> bits.SHIFT;
+      unsigned offset = bit & bits.MASK;
+      if (bits.bit_vector[element] & (1ULL << offset))
+      {
+        int index = 0;
+        for (unsigned idx = 0; idx < element; idx++)
+          index += __builtin_popcountll(bits.bit_vector[idx]);
+        // Handle dumb c++ shift overflow
+        if (offset == 0)
+          return index;
+        // Just count the bits up to but not including the actual
+        // bit we're looking for since indexes are zero-base
+        index += __builtin_popcountll(
+            bits.bit_vector[element] << (ELEMENT_SIZE - offset));
+        return index;
+      }
+      else // It's not set otherwise so we couldn't find an index
+        return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512BitMask<MAX>::get_index(unsigned index) const
+    //-------------------------------------------------------------------------
+    {
+      int offset = 0;
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        unsigned count = __builtin_popcountll(bits.bit_vector[idx]);
+        if (index < count)
+        {
+          for (unsigned j = 0; j < ELEMENT_SIZE; j++)
+          {
+            if (bits.bit_vector[idx] & (1ULL << j))
+            {
+              if (index == 0)
+                return (offset + j);
+              index--;
+            }
+          }
+        }
+        index -= count;
+        offset += ELEMENT_SIZE;
+      }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512BitMask<MAX>::find_next_set(unsigned start) const
+    //-------------------------------------------------------------------------
+    {
+      int idx = start / ELEMENT_SIZE; // truncate
+      int offset = idx * ELEMENT_SIZE;
+      int j = start % ELEMENT_SIZE;
+      if (j > 0) // if we are already in the middle of element search it
+      {
+        for ( ; j < int(ELEMENT_SIZE); j++)
+        {
+          if (bits.bit_vector[idx] & (1ULL << j))
+            return (offset + j);
+        }
+        idx++;
+        offset += ELEMENT_SIZE;
+      }
+      for ( ; idx < int(BIT_ELMTS); idx++)
+      {
+        if (bits.bit_vector[idx] > 0) // if it has any valid entries, find next
+        {
+          for (j = 0; j < int(ELEMENT_SIZE); j++)
+          {
+            if (bits.bit_vector[idx] & (1ULL << j))
+              return (offset + j);
+          }
+        }
+        offset += ELEMENT_SIZE;
+      }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512BitMask<MAX>::clear(void)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_setzero_si512());
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline const uint64_t& AVX512BitMask<MAX>::operator[](
+                                                 const unsigned int &idx) const
+    //-------------------------------------------------------------------------
+    {
+      return bits.bit_vector[idx];
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline uint64_t& AVX512BitMask<MAX>::operator[](const unsigned int &idx)
+    //-------------------------------------------------------------------------
+    {
+      return bits.bit_vector[idx];
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::operator==(const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        if (_mm512_cmpneq_epi64_mask(load_vec(idx), rhs.load_vec(idx)))
+          return false;
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::operator<(const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      // Only be less than if the bits are a subset of the rhs bits
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        if (bits.bit_vector[idx] < rhs[idx])
+          return true;
+        else if (bits.bit_vector[idx] > rhs[idx])
+          return false;
+      }
+      // Otherwise they are equal so false
+      return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::operator!=(const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      return !(*this == rhs);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator=(
+                                                       const AVX512BitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, rhs.load_vec(idx));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator~(void) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512BitMask<MAX> result;
+      const __m512i ones = _mm512_set1_epi64(-1L);
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        result.store_vec(idx, _mm512_xor_si512(load_vec(idx), ones));
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator|(
+                                                 const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512BitMask<MAX> result;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        result.store_vec(idx, _mm512_or_si512(load_vec(idx),
+                                              rhs.load_vec(idx)));
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator&(
+                                                 const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512BitMask<MAX> result;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        result.store_vec(idx, _mm512_and_si512(load_vec(idx),
+                                               rhs.load_vec(idx)));
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator^(
+                                                 const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512BitMask<MAX> result;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        result.store_vec(idx, _mm512_xor_si512(load_vec(idx),
+                                               rhs.load_vec(idx)));
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator|=(
+                                                       const AVX512BitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_or_si512(load_vec(idx), rhs.load_vec(idx)));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator&=(
+                                                       const AVX512BitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_and_si512(load_vec(idx), rhs.load_vec(idx)));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator^=(
+                                                       const AVX512BitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_xor_si512(load_vec(idx), rhs.load_vec(idx)));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::operator*(const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        if (_mm512_test_epi64_mask(load_vec(idx), rhs.load_vec(idx)))
+          return false;
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator-(
+                                                 const AVX512BitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512BitMask<MAX> result;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        result.store_vec(idx, _mm512_andnot_si512(rhs.load_vec(idx),
+                                                  load_vec(idx)));
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator-=(
+                                                       const AVX512BitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_andnot_si512(rhs.load_vec(idx), load_vec(idx)));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::empty(void) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        const __m512i value = load_vec(idx);
+        if (_mm512_test_epi64_mask(value, value))
+          return false;
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512BitMask<MAX>::operator!(void) const
+    //-------------------------------------------------------------------------
+    {
+      return empty();
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator<<(
+                                                          unsigned shift) const
+    //-------------------------------------------------------------------------
+    {
+      // Find the range
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      AVX512BitMask<MAX> result;
+      if (!local)
+      {
+        // Fast case where we just have to move the individual words
+        for (int idx = (BIT_ELMTS-1); idx >= int(range); idx--)
+        {
+          result[idx] = bits.bit_vector[idx-range];
+        }
+        // fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          result[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (int idx = (BIT_ELMTS-1); idx > int(range); idx--)
+        {
+          uint64_t left = bits.bit_vector[idx-range] << local;
+          uint64_t right = bits.bit_vector[idx-(range+1)] >> ((1 << 6) - local);
+          result[idx] = left | right;
+        }
+        // Handle the last case
+        result[range] = bits.bit_vector[0] << local;
+        // Fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          result[idx] = 0;
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX> AVX512BitMask<MAX>::operator>>(
+                                                          unsigned shift) const
+    //-------------------------------------------------------------------------
+    {
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      AVX512BitMask<MAX> result;
+      if (!local)
+      {
+        // Fast case where we just have to move individual words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-range); idx++)
+        {
+          result[idx] = bits.bit_vector[idx+range];
+        }
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < (BIT_ELMTS); idx++)
+          result[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-(range+1)); idx++)
+        {
+          uint64_t right = bits.bit_vector[idx+range] >> local;
+          uint64_t left = bits.bit_vector[idx+range+1] << ((1 << 6) - local);
+          result[idx] = left | right;
+        }
+        // Handle the last case
+        result[BIT_ELMTS-(range+1)] = bits.bit_vector[BIT_ELMTS-1] >> local;
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < BIT_ELMTS; idx++)
+          result[idx] = 0;
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator<<=(unsigned shift)
+    //-------------------------------------------------------------------------
+    {
+      // Find the range
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      if (!local)
+      {
+        // Fast case where we just have to move the individual words
+        for (int idx = (BIT_ELMTS-1); idx >= int(range); idx--)
+        {
+          bits.bit_vector[idx] = bits.bit_vector[idx-range];
+        }
+        // fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (int idx = (BIT_ELMTS-1); idx > int(range); idx--)
+        {
+          uint64_t left = bits.bit_vector[idx-range] << local;
+          uint64_t right = bits.bit_vector[idx-(range+1)] >> ((1 << 6) - local);
+          bits.bit_vector[idx] = left | right;
+        }
+        // Handle the last case
+        bits.bit_vector[range] = bits.bit_vector[0] << local;
+        // Fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512BitMask<MAX>& AVX512BitMask<MAX>::operator>>=(unsigned shift)
+    //-------------------------------------------------------------------------
+    {
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      if (!local)
+      {
+        // Fast case where we just have to move individual words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-range); idx++)
+        {
+          bits.bit_vector[idx] = bits.bit_vector[idx+range];
+        }
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < (BIT_ELMTS); idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-(range+1)); idx++)
+        {
+          uint64_t right = bits.bit_vector[idx+range] >> local;
+          uint64_t left = bits.bit_vector[idx+range+1] << ((1 << 6) - local);
+          bits.bit_vector[idx] = left | right;
+        }
+        // Handle the last case
+        bits.bit_vector[BIT_ELMTS-(range+1)] =
+                                      bits.bit_vector[BIT_ELMTS-1] >> local;
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < BIT_ELMTS; idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline uint64_t AVX512BitMask<MAX>::get_hash_key(void) const
+    //-------------------------------------------------------------------------
+    {
+      uint64_t result = 0;
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        result |= bits.bit_vector[idx];
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline const uint64_t* AVX512BitMask<MAX>::base(void) const
+    //-------------------------------------------------------------------------
+    {
+      return bits.bit_vector;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX> template<typename ST>
+    inline void AVX512BitMask<MAX>::serialize(ST &rez) const
+    //-------------------------------------------------------------------------
+    {
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX> template<typename DT>
+    inline void AVX512BitMask<MAX>::deserialize(DT &derez)
+    //-------------------------------------------------------------------------
+    {
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX> template<typename FUNCTOR>
+    inline void AVX512BitMask<MAX>::map(FUNCTOR &functor) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        if (bits.bit_vector[idx])
+        {
+          unsigned value = idx * ELEMENT_SIZE;
+          for (unsigned i = 0; i < ELEMENT_SIZE; i++, value++)
+            if (bits.bit_vector[idx] & (1ULL << i))
+              functor.apply(value);
+        }
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline char* AVX512BitMask<MAX>::to_string(void) const
+    //-------------------------------------------------------------------------
+    {
+      return BitMaskHelp::to_string(bits.bit_vector, MAX);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline unsigned AVX512BitMask<MAX>::pop_count(void) const
+    //-------------------------------------------------------------------------
+    {
+      unsigned result = 0;
+#ifndef VALGRIND
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        result += __builtin_popcountll(bits.bit_vector[idx]);
+      }
+#else
+      for (unsigned idx = 0; idx < MAX; idx++)
+      {
+        if (is_set(idx))
+          result++;
+      }
+#endif
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    /*static*/ inline unsigned AVX512BitMask<MAX>::pop_count(
+                                                const AVX512BitMask<MAX> &mask)
+    //-------------------------------------------------------------------------
+    {
+      unsigned result = 0;
+#ifndef VALGRIND
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        result += __builtin_popcountll(mask[idx]);
+      }
+#else
+      for (unsigned idx = 0; idx < MAX; idx++)
+      {
+        if (mask.is_set(idx))
+          result++;
+      }
+#endif
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    AVX512TLBitMask<MAX>::AVX512TLBitMask(uint64_t init /*= 0*/)
+      : sum_mask(init)
+    //-------------------------------------------------------------------------
+    {
+      static_assert((MAX % 512) == 0);
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        bits.bit_vector[idx] = init;
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    AVX512TLBitMask<MAX>::AVX512TLBitMask(const AVX512TLBitMask &rhs)
+      : sum_mask(rhs.sum_mask)
+    //-------------------------------------------------------------------------
+    {
+      static_assert((MAX % 512) == 0);
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, rhs.load_vec(idx));
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    AVX512TLBitMask<MAX>::~AVX512TLBitMask(void)
+    //-------------------------------------------------------------------------
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512TLBitMask<MAX>::set_bit(unsigned bit)
+    //-------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(bit < MAX);
+#endif
+      unsigned idx = bit >> 6;
+      const uint64_t set_mask = (1UL << (bit & 0x3F));
+      bits.bit_vector[idx] |= set_mask;
+      sum_mask |= set_mask;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512TLBitMask<MAX>::unset_bit(unsigned bit)
+    //-------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(bit < MAX);
+#endif
+      unsigned idx = bit >> 6;
+      const uint64_t set_mask = (1UL << (bit & 0x3F));
+      const uint64_t unset_mask = ~set_mask;
+      bits.bit_vector[idx] &= unset_mask;
+      // Unset the summary mask and then reset if necessary
+      sum_mask &= unset_mask;
+      for (unsigned i = 0; i < BIT_ELMTS; i++)
+        sum_mask |= bits.bit_vector[i];
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512TLBitMask<MAX>::assign_bit(unsigned bit, bool val)
+    //-------------------------------------------------------------------------
+    {
+      if (val)
+        set_bit(bit);
+      else
+        unset_bit(bit);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::is_set(unsigned bit) const
+    //-------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(bit < MAX);
+#endif
+      unsigned idx = bit >> 6;
+      return (bits.bit_vector[idx] & (1UL << (bit & 0x3F)));
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512TLBitMask<MAX>::find_first_set(void) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        if (bits.bit_vector[idx])
+        {
+          for (unsigned j = 0; j < ELEMENT_SIZE; j++)
+          {
+            if (bits.bit_vector[idx] & (1UL << j))
+            {
+              return (idx*ELEMENT_SIZE + j);
+            }
+          }
+        }
+      }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512TLBitMask<MAX>::find_index(unsigned bit) const
+    //-------------------------------------------------------------------------
+    {
+      unsigned element = bit >> bits.SHIFT;
+      unsigned offset = bit & bits.MASK;
+      if (bits.bit_vector[element] & (1ULL << offset))
+      {
+        int index = 0;
+        for (unsigned idx = 0; idx < element; idx++)
+          index += __builtin_popcountll(bits.bit_vector[idx]);
+        // Handle dumb c++ shift overflow
+        if (offset == 0)
+          return index;
+        // Just count the bits up to but not including the actual
+        // bit we're looking for since indexes are zero-base
+        index += __builtin_popcountll(
+            bits.bit_vector[element] << (ELEMENT_SIZE - offset));
+        return index;
+      }
+      else // It's not set otherwise so we couldn't find an index
+        return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512TLBitMask<MAX>::get_index(unsigned index) const
+    //-------------------------------------------------------------------------
+    {
+      int offset = 0;
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        unsigned count = __builtin_popcountll(bits.bit_vector[idx]);
+        if (index < count)
+        {
+          for (unsigned j = 0; j < ELEMENT_SIZE; j++)
+          {
+            if (bits.bit_vector[idx] & (1ULL << j))
+            {
+              if (index == 0)
+                return (offset + j);
+              index--;
+            }
+          }
+        }
+        index -= count;
+        offset += ELEMENT_SIZE;
+      }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline int AVX512TLBitMask<MAX>::find_next_set(unsigned start) const
+    //-------------------------------------------------------------------------
+    {
+      int idx = start / ELEMENT_SIZE; // truncate
+      int offset = idx * ELEMENT_SIZE;
+      int j = start % ELEMENT_SIZE;
+      if (j > 0) // if we are already in the middle of element search it
+      {
+        for ( ; j < int(ELEMENT_SIZE); j++)
+        {
+          if (bits.bit_vector[idx] & (1ULL << j))
+            return (offset + j);
+        }
+        idx++;
+        offset += ELEMENT_SIZE;
+      }
+      for ( ; idx < int(BIT_ELMTS); idx++)
+      {
+        if (bits.bit_vector[idx] > 0) // if it has any valid entries, find next
+        {
+          for (j = 0; j < int(ELEMENT_SIZE); j++)
+          {
+            if (bits.bit_vector[idx] & (1ULL << j))
+              return (offset + j);
+          }
+        }
+        offset += ELEMENT_SIZE;
+      }
+      return -1;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void AVX512TLBitMask<MAX>::clear(void)
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_setzero_si512());
+      }
+      sum_mask = 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline const uint64_t& AVX512TLBitMask<MAX>::operator[](
+                                                 const unsigned int &idx) const
+    //-------------------------------------------------------------------------
+    {
+      return bits.bit_vector[idx];
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline uint64_t& AVX512TLBitMask<MAX>::operator[](const unsigned int &idx)
+    //-------------------------------------------------------------------------
+    {
+      return bits.bit_vector[idx];
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::operator==(
+                                                 const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      if (sum_mask != rhs.sum_mask)
+        return false;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        if (_mm512_cmpneq_epi64_mask(load_vec(idx), rhs.load_vec(idx)))
+          return false;
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::operator<(const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      // Only be less than if the bits are a subset of the rhs bits
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        if (bits.bit_vector[idx] < rhs[idx])
+          return true;
+        else if (bits.bit_vector[idx] > rhs[idx])
+          return false;
+      }
+      // Otherwise they are equal so false
+      return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::operator!=(
+                                                 const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      return !(*this == rhs);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator=(
+                                                     const AVX512TLBitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      sum_mask = rhs.sum_mask;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, rhs.load_vec(idx));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator~(void) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512TLBitMask<MAX> result;
+      __m512i temp_sum = _mm512_setzero_si512();
+      const __m512i ones = _mm512_set1_epi64(-1L);
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        const __m512i value = _mm512_xor_si512(load_vec(idx), ones);
+        result.store_vec(idx, value);
+        temp_sum = _mm512_or_si512(temp_sum, value);
+      }
+      result.sum_mask = extract_mask(temp_sum);
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator|(
+                                               const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512TLBitMask<MAX> result;
+      result.sum_mask = sum_mask | rhs.sum_mask;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        result.store_vec(idx, _mm512_or_si512(load_vec(idx),
+                                              rhs.load_vec(idx)));
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator&(
+                                               const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512TLBitMask<MAX> result;
+      // If they are independent then we are done
+      if (sum_mask & rhs.sum_mask)
+      {
+        __m512i temp_sum = _mm512_setzero_si512();
+        for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+        {
+          const __m512i value = _mm512_and_si512(load_vec(idx),
+                                                 rhs.load_vec(idx));
+          result.store_vec(idx, value);
+          temp_sum = _mm512_or_si512(temp_sum, value);
+        }
+        result.sum_mask = extract_mask(temp_sum);
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator^(
+                                               const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512TLBitMask<MAX> result;
+      __m512i temp_sum = _mm512_setzero_si512();
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        const __m512i value = _mm512_xor_si512(load_vec(idx),
+                                               rhs.load_vec(idx));
+        result.store_vec(idx, value);
+        temp_sum = _mm512_or_si512(temp_sum, value);
+      }
+      result.sum_mask = extract_mask(temp_sum);
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator|=(
+                                                     const AVX512TLBitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      sum_mask |= rhs.sum_mask;
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        store_vec(idx, _mm512_or_si512(load_vec(idx), rhs.load_vec(idx)));
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator&=(
+                                                     const AVX512TLBitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      if (sum_mask & rhs.sum_mask)
+      {
+        __m512i temp_sum = _mm512_setzero_si512();
+        for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+        {
+          const __m512i value = _mm512_and_si512(load_vec(idx),
+                                                 rhs.load_vec(idx));
+          store_vec(idx, value);
+          temp_sum = _mm512_or_si512(temp_sum, value);
+        }
+        sum_mask = extract_mask(temp_sum);
+      }
+      else
+      {
+        sum_mask = 0;
+        for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+          store_vec(idx, _mm512_setzero_si512());
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator^=(
+                                                     const AVX512TLBitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      __m512i temp_sum = _mm512_setzero_si512();
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        const __m512i value = _mm512_xor_si512(load_vec(idx),
+                                               rhs.load_vec(idx));
+        store_vec(idx, value);
+        temp_sum = _mm512_or_si512(temp_sum, value);
+      }
+      sum_mask = extract_mask(temp_sum);
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::operator*(const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      if (sum_mask & rhs.sum_mask)
+      {
+        for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+        {
+          if (_mm512_test_epi64_mask(load_vec(idx), rhs.load_vec(idx)))
+            return false;
+        }
+      }
+      return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator-(
+                                               const AVX512TLBitMask &rhs) const
+    //-------------------------------------------------------------------------
+    {
+      AVX512TLBitMask<MAX> result;
+      __m512i temp_sum = _mm512_setzero_si512();
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        const __m512i value = _mm512_andnot_si512(rhs.load_vec(idx),
+                                                  load_vec(idx));
+        result.store_vec(idx, value);
+        temp_sum = _mm512_or_si512(temp_sum, value);
+      }
+      result.sum_mask = extract_mask(temp_sum);
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator-=(
+                                                     const AVX512TLBitMask &rhs)
+    //-------------------------------------------------------------------------
+    {
+      __m512i temp_sum = _mm512_setzero_si512();
+      for (unsigned idx = 0; idx < AVX512_ELMTS; idx++)
+      {
+        const __m512i value = _mm512_andnot_si512(rhs.load_vec(idx),
+                                                  load_vec(idx));
+        store_vec(idx, value);
+        temp_sum = _mm512_or_si512(temp_sum, value);
+      }
+      sum_mask = extract_mask(temp_sum);
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::empty(void) const
+    //-------------------------------------------------------------------------
+    {
+      // A great reason to have a summary mask
+      return (sum_mask == 0);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline bool AVX512TLBitMask<MAX>::operator!(void) const
+    //-------------------------------------------------------------------------
+    {
+      return empty();
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator<<(
+                                                          unsigned shift) const
+    //-------------------------------------------------------------------------
+    {
+      // Find the range
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      AVX512TLBitMask<MAX> result;
+      if (!local)
+      {
+        // Fast case where we just have to move the individual words
+        for (int idx = (BIT_ELMTS-1); idx >= int(range); idx--)
+        {
+          result[idx] = bits.bit_vector[idx-range];
+          result.sum_mask |= result[idx];
+        }
+        // fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          result[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (int idx = (BIT_ELMTS-1); idx > int(range); idx--)
+        {
+          uint64_t left = bits.bit_vector[idx-range] << local;
+          uint64_t right = bits.bit_vector[idx-(range+1)] >> ((1 << 6) - local);
+          result[idx] = left | right;
+          result.sum_mask |= result[idx];
+        }
+        // Handle the last case
+        result[range] = bits.bit_vector[0] << local;
+        result.sum_mask |= result[range];
+        // Fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          result[idx] = 0;
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX> AVX512TLBitMask<MAX>::operator>>(
+                                                          unsigned shift) const
+    //-------------------------------------------------------------------------
+    {
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      AVX512TLBitMask<MAX> result;
+      if (!local)
+      {
+        // Fast case where we just have to move individual words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-range); idx++)
+        {
+          result[idx] = bits.bit_vector[idx+range];
+          result.sum_mask |= result[idx];
+        }
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < (BIT_ELMTS); idx++)
+          result[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-(range+1)); idx++)
+        {
+          uint64_t right = bits.bit_vector[idx+range] >> local;
+          uint64_t left = bits.bit_vector[idx+range+1] << ((1 << 6) - local);
+          result[idx] = left | right;
+          result.sum_mask |= result[idx];
+        }
+        // Handle the last case
+        result[BIT_ELMTS-(range+1)] = bits.bit_vector[BIT_ELMTS-1] >> local;
+        result.sum_mask |= result[BIT_ELMTS-(range+1)];
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < BIT_ELMTS; idx++)
+          result[idx] = 0;
+      }
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator<<=(
+                                                                unsigned shift)
+    //-------------------------------------------------------------------------
+    {
+      // Find the range
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      sum_mask = 0;
+      if (!local)
+      {
+        // Fast case where we just have to move the individual words
+        for (int idx = (BIT_ELMTS-1); idx >= int(range); idx--)
+        {
+          bits.bit_vector[idx] = bits.bit_vector[idx-range];
+          sum_mask |= bits.bit_vector[idx];
+        }
+        // fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (int idx = (BIT_ELMTS-1); idx > int(range); idx--)
+        {
+          uint64_t left = bits.bit_vector[idx-range] << local;
+          uint64_t right = bits.bit_vector[idx-(range+1)] >> ((1 << 6) - local);
+          bits.bit_vector[idx] = left | right;
+          sum_mask |= bits.bit_vector[idx];
+        }
+        // Handle the last case
+        bits.bit_vector[range] = bits.bit_vector[0] << local;
+        sum_mask |= bits.bit_vector[range];
+        // Fill in everything else with zeros
+        for (unsigned idx = 0; idx < range; idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline AVX512TLBitMask<MAX>& AVX512TLBitMask<MAX>::operator>>=(
+                                                                unsigned shift)
+    //-------------------------------------------------------------------------
+    {
+      unsigned range = shift >> 6;
+      unsigned local = shift & 0x3F;
+      sum_mask = 0;
+      if (!local)
+      {
+        // Fast case where we just have to move individual words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-range); idx++)
+        {
+          bits.bit_vector[idx] = bits.bit_vector[idx+range];
+          sum_mask |= bits.bit_vector[idx];
+        }
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < (BIT_ELMTS); idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      else
+      {
+        // Slow case with merging words
+        for (unsigned idx = 0; idx < (BIT_ELMTS-(range+1)); idx++)
+        {
+          uint64_t right = bits.bit_vector[idx+range] >> local;
+          uint64_t left = bits.bit_vector[idx+range+1] << ((1 << 6) - local);
+          bits.bit_vector[idx] = left | right;
+          sum_mask |= bits.bit_vector[idx];
+        }
+        // Handle the last case
+        bits.bit_vector[BIT_ELMTS-(range+1)] =
+                                      bits.bit_vector[BIT_ELMTS-1] >> local;
+        sum_mask |= bits.bit_vector[BIT_ELMTS-(range+1)];
+        // Fill in everything else with zeros
+        for (unsigned idx = (BIT_ELMTS-range); idx < BIT_ELMTS; idx++)
+          bits.bit_vector[idx] = 0;
+      }
+      return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline uint64_t AVX512TLBitMask<MAX>::get_hash_key(void) const
+    //-------------------------------------------------------------------------
+    {
+      return sum_mask;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline const uint64_t* AVX512TLBitMask<MAX>::base(void) const
+    //-------------------------------------------------------------------------
+    {
+      return bits.bit_vector;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX> template<typename ST>
+    inline void AVX512TLBitMask<MAX>::serialize(ST &rez) const
+    //-------------------------------------------------------------------------
+    {
+      rez.serialize(sum_mask);
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX> template<typename DT>
+    inline void AVX512TLBitMask<MAX>::deserialize(DT &derez)
+    //-------------------------------------------------------------------------
+    {
+      derez.deserialize(sum_mask);
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX> template<typename FUNCTOR>
+    inline void AVX512TLBitMask<MAX>::map(FUNCTOR &functor) const
+    //-------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        if (bits.bit_vector[idx])
+        {
+          unsigned value = idx * ELEMENT_SIZE;
+          for (unsigned i = 0; i < ELEMENT_SIZE; i++, value++)
+            if (bits.bit_vector[idx] & (1ULL << i))
+              functor.apply(value);
+        }
+      }
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline char* AVX512TLBitMask<MAX>::to_string(void) const
+    //-------------------------------------------------------------------------
+    {
+      return BitMaskHelp::to_string(bits.bit_vector, MAX);
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline unsigned AVX512TLBitMask<MAX>::pop_count(void) const
+    //-------------------------------------------------------------------------
+    {
+      if (!sum_mask)
+        return 0;
+      unsigned result = 0;
+#ifndef VALGRIND
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        result += __builtin_popcountll(bits.bit_vector[idx]);
+      }
+#else
+      for (unsigned idx = 0; idx < MAX; idx++)
+      {
+        if (is_set(idx))
+          result++;
+      }
+#endif
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    /*static*/ inline unsigned AVX512TLBitMask<MAX>::pop_count(
+                                              const AVX512TLBitMask<MAX> &mask)
+    //-------------------------------------------------------------------------
+    {
+      unsigned result = 0;
+#ifndef VALGRIND
+      for (unsigned idx = 0; idx < BIT_ELMTS; idx++)
+      {
+        result += __builtin_popcountll(mask[idx]);
+      }
+#else
+      for (unsigned idx = 0; idx < MAX; idx++)
+      {
+        if (mask.is_set(idx))
+          result++;
+      }
+#endif
+      return result;
+    }
+
+    //-------------------------------------------------------------------------
+    template<unsigned int MAX>
+    /*static*/ inline uint64_t AVX512TLBitMask<MAX>::extract_mask(
+                                                                 __m512i value)
+    //-------------------------------------------------------------------------
+    {
+      return _mm512_reduce_or_epi64(value);
+    }
+#endif // __AVX512F__
+
 #ifdef __ALTIVEC__
     //-------------------------------------------------------------------------
     template<unsigned int MAX>
@@ -6726,7 +8399,7 @@
     inline void PPCBitMask<MAX>::serialize(ST &rez) const
     //-------------------------------------------------------------------------
     {
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -6734,7 +8407,7 @@
     inline void PPCBitMask<MAX>::deserialize(DT &derez)
     //-------------------------------------------------------------------------
     {
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -7503,7 +9176,7 @@
     //-------------------------------------------------------------------------
     {
       rez.serialize(sum_mask);
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -7512,7 +9185,7 @@
     //-------------------------------------------------------------------------
     {
       derez.deserialize(sum_mask);
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -8227,7 +9900,7 @@
     inline void NeonBitMask<MAX>::serialize(ST &rez) const
     //-------------------------------------------------------------------------
     {
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -8235,7 +9908,7 @@
     inline void NeonBitMask<MAX>::deserialize(DT &derez)
     //-------------------------------------------------------------------------
     {
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -9004,7 +10677,7 @@
     //-------------------------------------------------------------------------
     {
       rez.serialize(sum_mask);
-      rez.serialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::pack_bits<BIT_ELMTS>(rez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -9013,7 +10686,7 @@
     //-------------------------------------------------------------------------
     {
       derez.deserialize(sum_mask);
-      derez.deserialize(bits.bit_vector, (MAX/8));
+      BitMaskHelp::unpack_bits<BIT_ELMTS>(derez, bits.bit_vector);
     }
 
     //-------------------------------------------------------------------------
@@ -56,7 +56,7 @@ namespace Legion {
         notready_owner(owner_space), sent_global_references(0),
         received_global_references(0), total_sent_references(0),
         total_received_references(0), remaining_responses(0),
-        registered_with_runtime(false)
+        sent_downgrade_restart(false), registered_with_runtime(false)
     //--------------------------------------------------------------------------
     {
       if (collective_mapping != NULL)
@@ -68,6 +68,7 @@ namespace Legion {
       }
       if (do_registration)
         register_with_runtime();
+      LEGION_HOT_COUNTER(GC_COLLECTABLE_CREATIONS);
     }
 
     //--------------------------------------------------------------------------
@@ -85,6 +86,7 @@ namespace Legion {
     DistributedCollectable::~DistributedCollectable(void)
     //--------------------------------------------------------------------------
     {
+      LEGION_HOT_COUNTER(GC_COLLECTABLE_DELETIONS);
 #ifdef DEBUG_LEGION
       assert(gc_references == 0);
       assert(resource_references == 0);
@@ -731,10 +733,11 @@ namespace Legion {
           // doing collections or we can wait for the next removal
           check_for_downgrade_restart(local_space);
         }
-        else if (current_state == PENDING_LOCAL_REF_STATE)
+        else if ((current_state == PENDING_LOCAL_REF_STATE) &&
+                  !sent_downgrade_restart)
         {
           // Send a notification to the downgrade owner to check if it
-          // needs to resume collections now that this reference has 
+          // needs to resume collections now that this reference has
           // been unpacked. This is not just a performance optimization.
           // It is vital to forward progress as it removes the necessity
           // to poll on downgrades while we are waiting for references
@@ -742,9 +745,12 @@ namespace Legion {
           // you can't even check whether it is safe to downgrade this
           // node or not since we're not the downgrade owner so we have
           // to notify the downgrade owner about the unpacked references
+          // One notification is enough to get the downgrade owner to
+          // poll us again, so suppress duplicates until the next check
           Serializer rez;
           rez.serialize(did);
           runtime->send_did_downgrade_restart(downgrade_owner, rez);
+          sent_downgrade_restart = true;
         }
       }
     }
@@ -925,6 +931,9 @@ namespace Legion {
 #endif
       // Update the downgrade owner
       downgrade_owner = owner;
+      // Starting a new round of checks, so any unpacks after this need
+      // to send a fresh restart notification to the downgrade owner
+      sent_downgrade_restart = false;
       if (can_downgrade())
       {
         // We're ready to be downgraded
@@ -1848,10 +1857,11 @@ namespace Legion {
           // doing collections or we can wait for the next removal
           check_for_downgrade_restart(local_space);
         }
-        else if (current_state == PENDING_GLOBAL_REF_STATE)
+        else if ((current_state == PENDING_GLOBAL_REF_STATE) &&
+                  !sent_downgrade_restart)
         {
           // Send a notification to the downgrade owner to check if it
-          // needs to resume collections now that this reference has 
+          // needs to resume collections now that this reference has
           // been unpacked. This is not just a performance optimization.
           // It is vital to forward progress as it removes the necessity
           // to poll on downgrades while we are waiting for references
@@ -1859,9 +1869,12 @@ namespace Legion {
           // you can't even check whether it is safe to downgrade this
           // node or not since we're not the downgrade owner so we have
           // to notify the downgrade owner about the unpacked references
+          // One notification is enough to get the downgrade owner to
+          // poll us again, so suppress duplicates until the next check
           Serializer rez;
           rez.serialize(did);
           runtime->send_did_downgrade_restart(downgrade_owner, rez);
+          sent_downgrade_restart = true;
         }
       }
     }
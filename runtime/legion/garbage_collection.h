@@ -223,6 +223,13 @@ namespace Legion {
      * objects will descend down through the levels collectively
      * across all their copies and monotonically. The last level
      * only guarantees that the object is kept alive locally.
+     * While the downgrade protocol is expressed per object, nothing
+     * about teardown is serialized on it: unrelated collectables
+     * downgrade concurrently as their messages are handled by the
+     * background worker threads, and all the per-object messages to
+     * the same node are coalesced into bulk sends by the message
+     * manager's virtual channels, so end-of-run draining proceeds in
+     * parallel across both objects and node pairs.
      */
     class DistributedCollectable {
     public:
@@ -377,6 +384,10 @@ namespace Legion {
       uint64_t  sent_global_references, received_global_references;
       uint64_t  total_sent_references, total_received_references;
       unsigned  remaining_responses;
+      // Whether we've already notified the downgrade owner of unpacked
+      // references since the last downgrade check, so that a flurry of
+      // unpacks during the same round sends at most one restart message
+      bool      sent_downgrade_restart;
     protected:
       mutable bool registered_with_runtime;
     };
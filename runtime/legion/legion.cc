@@ -2771,8 +2771,53 @@ namespace Legion {
         return impl->get_domain();
     }
 
+    //--------------------------------------------------------------------------
+    FutureMapSnapshot FutureMap::get_snapshot(void) const
+    //--------------------------------------------------------------------------
+    {
+      if (impl == NULL)
+        return FutureMapSnapshot();
+      const Domain domain = impl->get_domain();
+      // Size the table by the bounding box so lookups can index it
+      // directly from the point coordinates
+      size_t volume = 1;
+      for (int d = 0; d < domain.get_dim(); d++)
+        volume *= (domain.hi()[d] - domain.lo()[d] + 1);
+      std::vector<Future> futures(volume);
+      for (Domain::DomainPointIterator itr(domain); itr; itr++)
+      {
+        size_t index = 0;
+        for (int d = domain.get_dim() - 1; d >= 0; d--)
+          index = index * (domain.hi()[d] - domain.lo()[d] + 1) +
+            (itr.p[d] - domain.lo()[d]);
+        // This materializes the future on the local node, blocking
+        // to fetch it from the owner if necessary
+        futures[index] = impl->get_future(itr.p, false/*internal*/);
+      }
+      return FutureMapSnapshot(domain, std::move(futures));
+    }
+
+    /////////////////////////////////////////////////////////////
+    // Future Map Snapshot
+    /////////////////////////////////////////////////////////////
+
+    //--------------------------------------------------------------------------
+    FutureMapSnapshot::FutureMapSnapshot(void)
+      : domain(Domain::NO_DOMAIN)
+    //--------------------------------------------------------------------------
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    FutureMapSnapshot::FutureMapSnapshot(const Domain &d,
+                                         std::vector<Future> &&futs)
+      : domain(d), futures(std::move(futs))
+    //--------------------------------------------------------------------------
+    {
+    }
+
     /////////////////////////////////////////////////////////////
-    // Physical Region 
+    // Physical Region
     /////////////////////////////////////////////////////////////
 
     //--------------------------------------------------------------------------
@@ -2903,6 +2948,16 @@ namespace Legion {
         return LEGION_NO_ACCESS;
     }
 
+    //--------------------------------------------------------------------------
+    CoherenceProperty PhysicalRegion::get_coherence(void) const
+    //--------------------------------------------------------------------------
+    {
+      if (impl != NULL)
+        return impl->get_coherence();
+      else
+        return LEGION_EXCLUSIVE;
+    }
+
     //--------------------------------------------------------------------------
     void PhysicalRegion::get_memories(std::set<Memory>& memories,
                         bool silence_warnings, const char *warning_string) const
@@ -6233,6 +6288,14 @@ namespace Legion {
       ctx->progress_unordered_operations();
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::prefetch_region(Context ctx, LogicalRegion handle,
+                                  const std::set<FieldID> &fields)
+    //--------------------------------------------------------------------------
+    {
+      ctx->prefetch_region(handle, fields);
+    }
+
     LEGION_DISABLE_DEPRECATED_WARNINGS
 
     //--------------------------------------------------------------------------
@@ -6505,6 +6568,14 @@ namespace Legion {
       return ctx->issue_execution_fence(provenance);
     }
 
+    //--------------------------------------------------------------------------
+    unsigned long long Runtime::get_field_write_count(Context ctx,
+                                              LogicalRegion handle, FieldID fid)
+    //--------------------------------------------------------------------------
+    {
+      return ctx->get_field_write_count(handle, fid);
+    }
+
     //--------------------------------------------------------------------------
     void Runtime::begin_trace(
        Context ctx, TraceID tid, bool logical_only /*= false*/,
@@ -7658,10 +7729,24 @@ namespace Legion {
                                     bool has_return_type_size /*= true*/)
     //--------------------------------------------------------------------------
     {
-      return runtime->register_variant(registrar, user_data, user_len, 
+      return runtime->register_variant(registrar, user_data, user_len,
              realm_desc, return_type_size, has_return_type_size, vid);
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::begin_task_variant_batch(void)
+    //--------------------------------------------------------------------------
+    {
+      runtime->begin_variant_registration_batch();
+    }
+
+    //--------------------------------------------------------------------------
+    void Runtime::end_task_variant_batch(void)
+    //--------------------------------------------------------------------------
+    {
+      runtime->end_variant_registration_batch();
+    }
+
     //--------------------------------------------------------------------------
     /*static*/ VariantID Runtime::preregister_task_variant(
               const TaskVariantRegistrar &registrar,
@@ -2145,6 +2145,22 @@ namespace Legion {
         }
         return true;
       }
+
+      // Annotate a pointer obtained from an affine accessor with a static
+      // alignment promise so that compilers can auto-vectorize loops that
+      // walk the allocation without peeling for unknown alignment
+      template<size_t ALIGNMENT, typename FT> __CUDA_HD__
+      static inline FT* assume_aligned(FT *ptr)
+      {
+        static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0,
+                      "ALIGNMENT must be a power of two");
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+        return static_cast<FT*>(__builtin_assume_aligned(ptr, ALIGNMENT));
+#else
+        return ptr;
+#endif
+      }
     }
 
     ////////////////////////////////////////////////////////////
@@ -3119,6 +3135,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline const FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline const FT& operator[](const Point<N,T>& p) const
         { 
@@ -3303,6 +3329,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline const FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline const FT& operator[](const Point<N,T>& p) const
         { 
@@ -3452,6 +3488,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo); 
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline const FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline const FT& operator[](const Point<1,T>& p) const
         { 
@@ -3618,6 +3664,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline const FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline const FT& operator[](const Point<1,T>& p) const
         { 
@@ -3701,6 +3757,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -3825,6 +3891,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -3931,6 +4007,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -4042,6 +4128,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -4138,6 +4234,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -4256,6 +4362,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -4349,6 +4465,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -4454,6 +4580,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -4532,6 +4668,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -4638,6 +4784,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -4726,6 +4882,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -4819,6 +4985,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -4847,6 +5023,28 @@ namespace Legion {
 #undef DEFERRED_VALUE_BUFFER_CONSTRUCTORS
 #undef DEFERRED_VALUE_BUFFER_CONSTRUCTORS_WITH_BOUNDS
 
+    namespace Internal {
+      // An EXCLUSIVE=true ReductionAccessor performs unguarded reduction
+      // folds, which is only safe if nothing else can be touching the
+      // instance while the accessor is live, so in debug builds reject
+      // coherence modes that permit concurrent users of the instance
+      static inline void check_exclusive_reduction(const PhysicalRegion &r,
+                                                   bool exclusive)
+      {
+#ifdef DEBUG_LEGION
+        if (exclusive && ((r.get_coherence() == LEGION_SIMULTANEOUS) ||
+                          (r.get_coherence() == LEGION_RELAXED)))
+        {
+          fprintf(stderr, "ERROR: creating an EXCLUSIVE=true "
+              "ReductionAccessor on a region mapped with simultaneous or "
+              "relaxed coherence - unguarded reduction folds are not safe "
+              "when other users can access the instance concurrently\n");
+          assert(false);
+        }
+#endif
+      }
+    };
+
 #define PHYSICAL_REGION_CONSTRUCTORS(DIM, FIELD_CHECK)                        \
       ReductionAccessor(const PhysicalRegion &region, FieldID fid,            \
                         ReductionOpID redop, bool silence_warnings = false,   \
@@ -4856,6 +5054,7 @@ namespace Legion {
                         bool check_field_size = FIELD_CHECK)                  \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -4878,6 +5077,7 @@ namespace Legion {
                         bool check_field_size = FIELD_CHECK)                  \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -4901,6 +5101,7 @@ namespace Legion {
                         bool check_field_size = FIELD_CHECK)                  \
       {                                                                       \
         DomainT<M,T> is;                                                      \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<M,T>(),            \
@@ -4925,6 +5126,7 @@ namespace Legion {
                         bool check_field_size = FIELD_CHECK)                  \
       {                                                                       \
         DomainT<M,T> is;                                                      \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<M,T>(),            \
@@ -4955,6 +5157,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<DIM,T>(),             \
@@ -4996,6 +5199,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<DIM,T>(),             \
@@ -5033,6 +5237,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<M,T> is;                                                    \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
               LEGION_REDUCE, fid, actual_field_size, &is,                     \
               Internal::NT_TemplateHelper::encode_tag<M,T>(),                 \
@@ -5071,6 +5276,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<M,T> is;                                                    \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<M,T>(),               \
@@ -5099,6 +5305,7 @@ namespace Legion {
         : field(fid)                                                          \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -5123,6 +5330,7 @@ namespace Legion {
         : field(fid)                                                          \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -5148,6 +5356,7 @@ namespace Legion {
         : field(fid)                                                          \
       {                                                                       \
         DomainT<M,T> is;                                                      \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<M,T>(),            \
@@ -5174,6 +5383,7 @@ namespace Legion {
         : field(fid)                                                          \
       {                                                                       \
         DomainT<M,T> is;                                                      \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<M,T>(),            \
@@ -5207,6 +5417,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<DIM,T>(),             \
@@ -5260,6 +5471,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<DIM,T>(),             \
@@ -5309,6 +5521,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<M,T> is;                                                    \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<M,T>(),               \
@@ -5359,6 +5572,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<M,T> is;                                                    \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<M,T>(),               \
@@ -8320,6 +8534,7 @@ namespace Legion {
                         bool check_field_size = FIELD_CHECK)                  \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -8343,6 +8558,7 @@ namespace Legion {
                         bool check_field_size = FIELD_CHECK)                  \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -8374,6 +8590,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
               LEGION_REDUCE, fid, actual_field_size, &is,                     \
               Internal::NT_TemplateHelper::encode_tag<DIM,T>(),               \
@@ -8413,6 +8630,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
               LEGION_REDUCE, fid, actual_field_size, &is,                     \
               Internal::NT_TemplateHelper::encode_tag<DIM,T>(),               \
@@ -8442,6 +8660,7 @@ namespace Legion {
         : field(fid)                                                          \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -8467,6 +8686,7 @@ namespace Legion {
         : field(fid)                                                          \
       {                                                                       \
         DomainT<DIM,T> is;                                                    \
+        Internal::check_exclusive_reduction(region, EXCLUSIVE);               \
         const Realm::RegionInstance instance =                                \
          region.get_instance_info(LEGION_REDUCE, fid, actual_field_size,      \
               &is, Internal::NT_TemplateHelper::encode_tag<DIM,T>(),          \
@@ -8501,6 +8721,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
               LEGION_REDUCE, fid, actual_field_size, &is,                     \
               Internal::NT_TemplateHelper::encode_tag<DIM,T>(),               \
@@ -8551,6 +8772,7 @@ namespace Legion {
         for (InputIterator it = start; it != stop; it++)                      \
         {                                                                     \
           DomainT<DIM,T> is;                                                  \
+          Internal::check_exclusive_reduction(*it, EXCLUSIVE);                \
           const Realm::RegionInstance inst = it->get_instance_info(           \
                 LEGION_REDUCE, fid, actual_field_size, &is,                   \
                 Internal::NT_TemplateHelper::encode_tag<DIM,T>(),             \
@@ -9394,6 +9616,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -9544,6 +9776,16 @@ namespace Legion {
             strides[i] = accessor.strides[i] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<N,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<N,T>& p) const
         { 
@@ -9649,6 +9891,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -9786,6 +10038,16 @@ namespace Legion {
           strides[0] = accessor.strides[0] / field_size;
           return accessor.ptr(r.lo);
         }
+      // Same as the 'ptr' method for rectangles above, but with a compile
+      // time promise that the resulting pointer is aligned to ALIGNMENT
+      // bytes, which helps compilers auto-vectorize loops over the data
+      template<size_t ALIGNMENT>
+      __CUDA_HD__
+      inline FT* LEGION_RESTRICT aligned_ptr(const Rect<1,T>& r,
+                          size_t field_size = sizeof(FT)) const
+        {
+          return Internal::assume_aligned<ALIGNMENT>(ptr(r, field_size));
+        }
       __CUDA_HD__
       inline FT& operator[](const Point<1,T>& p) const
         { 
@@ -18742,6 +19004,23 @@ namespace Legion {
       return f.get_void_result();
     }
 
+    //--------------------------------------------------------------------------
+    inline Future FutureMapSnapshot::get_future(const DomainPoint &point) const
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(exists());
+      assert(domain.contains(point));
+#endif
+      // Index straight into the flat table without entering the runtime
+      const DomainPoint lo = domain.lo();
+      const DomainPoint hi = domain.hi();
+      size_t index = 0;
+      for (int d = domain.get_dim() - 1; d >= 0; d--)
+        index = index * (hi[d] - lo[d] + 1) + (point[d] - lo[d]);
+      return futures[index];
+    }
+
     //--------------------------------------------------------------------------
     template<int DIM, typename T>
     DomainT<DIM,T> PhysicalRegion::get_bounds(void) const
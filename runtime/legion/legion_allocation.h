@@ -138,6 +138,7 @@ namespace Legion {
       DIFFERENCE_EXPR_ALLOC,
       INSTANCE_EXPR_ALLOC,
       REMOTE_EXPR_ALLOC,
+      ARENA_BLOCK_ALLOC,
       UNTRACKED_ALLOC, // must be last
     };
 
@@ -399,6 +400,126 @@ namespace Legion {
       free(ptr);
     }
 
+    /**
+     * \class LegionArena
+     * A bump allocator for short-lived objects that all share the same
+     * lifetime, such as the analysis temporaries built up while mapping
+     * a single operation. Allocations are satisfied out of chained blocks
+     * with a pointer bump and are returned to the heap wholesale when the
+     * arena is reset or destroyed, which keeps steady-state hot paths off
+     * the global heap. The arena never runs the destructors of objects
+     * allocated from it; that remains the responsibility of the caller.
+     */
+    class LegionArena {
+    public:
+      static constexpr size_t DEFAULT_BLOCK_SIZE = 32768;
+    public:
+      inline explicit LegionArena(size_t block = DEFAULT_BLOCK_SIZE)
+        : block_size(block), blocks(NULL), next(NULL), limit(NULL) { }
+      LegionArena(const LegionArena &rhs) = delete;
+      inline ~LegionArena(void) { reset(); }
+    public:
+      LegionArena& operator=(const LegionArena &rhs) = delete;
+    public:
+      inline void* allocate(size_t size, size_t alignment)
+      {
+        uintptr_t base = reinterpret_cast<uintptr_t>(next);
+        uintptr_t aligned = (base + (alignment-1)) & ~uintptr_t(alignment-1);
+        if ((next == NULL) ||
+            ((aligned + size) > reinterpret_cast<uintptr_t>(limit)))
+        {
+          const size_t needed = sizeof(Block) + size + alignment;
+          const size_t to_alloc = (needed > block_size) ? needed : block_size;
+          Block *block =
+            static_cast<Block*>(legion_malloc(ARENA_BLOCK_ALLOC, to_alloc));
+          block->next = blocks;
+          block->size = to_alloc;
+          blocks = block;
+          next = reinterpret_cast<char*>(block) + sizeof(Block);
+          limit = reinterpret_cast<char*>(block) + to_alloc;
+          base = reinterpret_cast<uintptr_t>(next);
+          aligned = (base + (alignment-1)) & ~uintptr_t(alignment-1);
+        }
+        next = reinterpret_cast<char*>(aligned + size);
+        return reinterpret_cast<void*>(aligned);
+      }
+      template<typename T, typename... Args>
+      inline T* create(Args&&... args)
+      {
+        return ::new (allocate(sizeof(T), alignof(T)))
+          T(std::forward<Args>(args)...);
+      }
+      inline void reset(void)
+      {
+        while (blocks != NULL)
+        {
+          Block *block = blocks;
+          blocks = block->next;
+          legion_free(ARENA_BLOCK_ALLOC, block, block->size);
+        }
+        next = NULL;
+        limit = NULL;
+      }
+    protected:
+      struct Block {
+      public:
+        Block *next;
+        size_t size;
+      };
+    protected:
+      const size_t block_size;
+      Block *blocks;
+      char *next;
+      char *limit;
+    };
+
+    /**
+     * \class LegionArenaAllocator
+     * An STL allocator adapter over a LegionArena for containers whose
+     * nodes should come out of an arena. Deallocation is a no-op since
+     * the memory is reclaimed in bulk when the arena is reset, so this
+     * should only be used for containers that do not outlive their arena.
+     */
+    template<typename T>
+    class LegionArenaAllocator {
+    public:
+      typedef size_t          size_type;
+      typedef ptrdiff_t difference_type;
+      typedef T*                pointer;
+      typedef const T*    const_pointer;
+      typedef T&              reference;
+      typedef const T&  const_reference;
+      typedef T              value_type;
+    public:
+      template<typename U>
+      struct rebind {
+        typedef LegionArenaAllocator<U> other;
+      };
+    public:
+      inline explicit LegionArenaAllocator(LegionArena *a) : arena(a) { }
+      inline LegionArenaAllocator(const LegionArenaAllocator<T> &rhs)
+        : arena(rhs.arena) { }
+      template<typename U>
+      inline LegionArenaAllocator(const LegionArenaAllocator<U> &rhs)
+        : arena(rhs.arena) { }
+    public:
+      inline T* allocate(std::size_t cnt)
+      {
+        return static_cast<T*>(arena->allocate(cnt * sizeof(T), alignof(T)));
+      }
+      inline void deallocate(T *ptr, std::size_t size)
+      {
+        // Reclaimed in bulk when the arena is reset
+      }
+    public:
+      inline bool operator==(const LegionArenaAllocator &rhs) const
+        { return (arena == rhs.arena); }
+      inline bool operator!=(const LegionArenaAllocator &rhs) const
+        { return !operator==(rhs); }
+    public:
+      LegionArena *arena;
+    };
+
     /**
      * \class LegionAllocator
      * A custom Legion allocator for tracing memory usage in STL
@@ -4886,7 +4886,7 @@ namespace Legion {
     LogicalState::LogicalState(RegionTreeNode *node, ContextID c)
       : owner(node), total_timeout_check_iterations(MIN_TIMEOUT_CHECK_SIZE),
         remaining_timeout_check_iterations(total_timeout_check_iterations),
-        timeout_exchange(NULL)
+        timeout_exchange(NULL), projection_tracking(NULL)
     //--------------------------------------------------------------------------
     {
     }
@@ -4895,6 +4895,8 @@ namespace Legion {
     LogicalState::~LogicalState(void)
     //--------------------------------------------------------------------------
     {
+      if (projection_tracking != NULL)
+        delete projection_tracking;
     }
 
     //--------------------------------------------------------------------------
@@ -4907,9 +4909,7 @@ namespace Legion {
       assert(prev_epoch_users.empty());
       assert(timeout_exchange == NULL);
       assert(refinement_trackers.empty());
-      assert(projection_summary_cache.empty());
-      assert(interfering_shards.empty());
-      assert(pointwise_dependences.empty());
+      assert(projection_tracking == NULL);
 #endif
     }
 
@@ -4994,13 +4994,20 @@ namespace Legion {
           delete it->first;
         refinement_trackers.clear();
       }
-      while (!projection_summary_cache.empty())
+      if (projection_tracking != NULL)
       {
-        ProjectionSummary *summary = projection_summary_cache.back();
-        projection_summary_cache.pop_back();
-        if ((projection_summary_cache.size() < PROJECTION_CACHE_SIZE) &&
-            summary->remove_reference())
-          delete summary;
+        std::list<ProjectionSummary*> &cache =
+          projection_tracking->projection_summary_cache;
+        while (!cache.empty())
+        {
+          ProjectionSummary *summary = cache.back();
+          cache.pop_back();
+          if ((cache.size() < PROJECTION_CACHE_SIZE) &&
+              summary->remove_reference())
+            delete summary;
+        }
+        delete projection_tracking;
+        projection_tracking = NULL;
       }
     }
 
@@ -5092,21 +5099,23 @@ namespace Legion {
       // Check to see if the projection functor is functional
       if (proj_info.projection->is_functional)
       {
+        if (projection_tracking == NULL)
+          projection_tracking = new ProjectionTracking;
+        std::list<ProjectionSummary*> &cache =
+          projection_tracking->projection_summary_cache;
         // Check to see if we can find this in the cache
         unsigned index = 0;
         ProjectionSummary *invalidated = NULL;
         for (std::list<ProjectionSummary*>::iterator it =
-              projection_summary_cache.begin(); it !=
-              projection_summary_cache.end(); it++, index++)
+              cache.begin(); it != cache.end(); it++, index++)
         {
           if ((*it)->matches(proj_info, req))
           {
             ProjectionSummary *result = *it;
             // Move it to the front of the list if it wasn't already there
-            if (it != projection_summary_cache.begin())
+            if (it != cache.begin())
             {
-              projection_summary_cache.splice(projection_summary_cache.begin(),
-                  projection_summary_cache, it);
+              cache.splice(cache.begin(), cache, it);
               // If this wasn't already in the cache range with a reference
               // then we need to update the reference counts
               if (PROJECTION_CACHE_SIZE <= index)
@@ -5145,10 +5154,10 @@ namespace Legion {
       if (proj_info.projection->is_functional)
       {
         result->add_reference();
-        projection_summary_cache.push_front(result);
+        projection_tracking->projection_summary_cache.push_front(result);
       }
       return result;
-    } 
+    }
 
     //--------------------------------------------------------------------------
     void LogicalState::remove_projection_summary(ProjectionSummary *summary)
@@ -5157,23 +5166,28 @@ namespace Legion {
 #ifdef DEBUG_LEGION
       assert(summary->owner == this);
 #endif
+      // Summaries can only be recorded in the projection tracking structures
+      // so if we never made them there is nothing to filter
+      if (projection_tracking == NULL)
+        return;
+      std::list<ProjectionSummary*> &cache =
+        projection_tracking->projection_summary_cache;
       if (summary->projection->is_functional &&
-          (PROJECTION_CACHE_SIZE <= projection_summary_cache.size()))
+          (PROJECTION_CACHE_SIZE <= cache.size()))
       {
         // Only need to filter from things not in the cache so start
         // from the back and only go up to the last element not in the cache
         // Note: handle the off-by-one case where we're deleting the last
         // thing in the cache because we're about to add a new summary
-        const unsigned stop = 
-          (projection_summary_cache.size() - PROJECTION_CACHE_SIZE) + 1;
+        const unsigned stop = (cache.size() - PROJECTION_CACHE_SIZE) + 1;
         std::list<ProjectionSummary*>::reverse_iterator finder =
-          projection_summary_cache.rbegin();
+          cache.rbegin();
         for (unsigned idx = 0; idx < stop; idx++)
         {
           if ((*finder) == summary)
           {
             // Reverse iterators are stupid
-            projection_summary_cache.erase(std::next(finder).base());
+            cache.erase(std::next(finder).base());
             break;
           }
           finder++;
@@ -5184,27 +5198,28 @@ namespace Legion {
         std::unordered_map<ProjectionSummary*,
           std::unordered_map<ProjectionSummary*,
             std::pair<bool,bool> > >::iterator finder =
-              pointwise_dependences.find(summary);
-        if (finder != pointwise_dependences.end())
+              projection_tracking->pointwise_dependences.find(summary);
+        if (finder != projection_tracking->pointwise_dependences.end())
         {
           for (std::unordered_map<ProjectionSummary*,
                 std::pair<bool,bool> >::const_iterator it =
                   finder->second.begin(); it != finder->second.end(); it++)
-            pointwise_dependences[it->first].erase(summary);
-          pointwise_dependences.erase(finder);
+            projection_tracking->pointwise_dependences[it->first].erase(
+                                                                    summary);
+          projection_tracking->pointwise_dependences.erase(finder);
         }
       }
       std::unordered_map<ProjectionSummary*,
         std::unordered_map<ProjectionSummary*,
           std::pair<bool,bool> > >::iterator finder =
-            interfering_shards.find(summary);
-      if (finder != interfering_shards.end())
+            projection_tracking->interfering_shards.find(summary);
+      if (finder != projection_tracking->interfering_shards.end())
       {
         for (std::unordered_map<ProjectionSummary*,
               std::pair<bool,bool> >::const_iterator it =
               finder->second.begin(); it != finder->second.end(); it++)
-          interfering_shards[it->first].erase(summary);
-        interfering_shards.erase(finder);
+          projection_tracking->interfering_shards[it->first].erase(summary);
+        projection_tracking->interfering_shards.erase(finder);
       }
     }
 
@@ -5224,26 +5239,33 @@ namespace Legion {
         // have exactly one kind of shard user
         return (!one->can_perform_name_based_self_analysis() ||
                 !one->has_unique_shard_users());
-      std::unordered_map<ProjectionSummary*,
-        std::unordered_map<ProjectionSummary*,
-          std::pair<bool,bool> > >::const_iterator
-            one_finder = interfering_shards.find(one);
-      if (one_finder != interfering_shards.end())
+      if (projection_tracking != NULL)
       {
         std::unordered_map<ProjectionSummary*,
-          std::pair<bool,bool> >::const_iterator
-            two_finder = one_finder->second.find(two);
-        if (two_finder != one_finder->second.end())
+          std::unordered_map<ProjectionSummary*,
+            std::pair<bool,bool> > >::const_iterator one_finder =
+              projection_tracking->interfering_shards.find(one);
+        if (one_finder != projection_tracking->interfering_shards.end())
         {
-          dominates = two_finder->second.second;
-          return two_finder->second.first;
+          std::unordered_map<ProjectionSummary*,
+            std::pair<bool,bool> >::const_iterator
+              two_finder = one_finder->second.find(two);
+          if (two_finder != one_finder->second.end())
+          {
+            dominates = two_finder->second.second;
+            return two_finder->second.first;
+          }
         }
       }
+      else
+        projection_tracking = new ProjectionTracking;
       // Do the test and save the results for later
-      const bool result = 
+      const bool result =
         analysis.context->has_interfering_shards(one, two, dominates);
-      interfering_shards[one][two] = std::make_pair(result, dominates);
-      interfering_shards[two][one] = std::make_pair(result, dominates);
+      projection_tracking->interfering_shards[one][two] =
+        std::make_pair(result, dominates);
+      projection_tracking->interfering_shards[two][one] =
+        std::make_pair(result, dominates);
       return result;
     }
 
@@ -5279,21 +5301,26 @@ namespace Legion {
       }
       // Before we do the local analysis, see if we can find the result
       // in the cache from a prior computation
-      std::unordered_map<ProjectionSummary*,
-        std::unordered_map<ProjectionSummary*,
-          std::pair<bool,bool> > >::const_iterator
-          one_finder = pointwise_dependences.find(one);
-      if (one_finder != pointwise_dependences.end())
+      if (projection_tracking != NULL)
       {
         std::unordered_map<ProjectionSummary*,
-          std::pair<bool,bool> >::const_iterator two_finder =
-            one_finder->second.find(two);
-        if (two_finder != one_finder->second.end())
+          std::unordered_map<ProjectionSummary*,
+            std::pair<bool,bool> > >::const_iterator one_finder =
+              projection_tracking->pointwise_dependences.find(one);
+        if (one_finder != projection_tracking->pointwise_dependences.end())
         {
-          dominates = two_finder->second.second;
-          return two_finder->second.first;
+          std::unordered_map<ProjectionSummary*,
+            std::pair<bool,bool> >::const_iterator two_finder =
+              one_finder->second.find(two);
+          if (two_finder != one_finder->second.end())
+          {
+            dominates = two_finder->second.second;
+            return two_finder->second.first;
+          }
         }
       }
+      else
+        projection_tracking = new ProjectionTracking;
       // If they are different summaries, but are using the same projection
       // function and either one's launch domain is a (non-strict) subset of
       // the other's launch domain then we can do pointwise dependence 
@@ -5313,8 +5340,10 @@ namespace Legion {
         if (one->domain == two->domain)
         {
           // If they both have the same domain then this is easy
-          pointwise_dependences[one][two] = std::make_pair(true,true);
-          pointwise_dependences[two][one] = std::make_pair(true,true);
+          projection_tracking->pointwise_dependences[one][two] =
+            std::make_pair(true,true);
+          projection_tracking->pointwise_dependences[two][one] =
+            std::make_pair(true,true);
           dominates = true;
           return true;
         }
@@ -5323,13 +5352,13 @@ namespace Legion {
           const bool one_dominates = one->domain->dominates(two->domain);
           dominates = two->domain->dominates(one->domain);
           const bool result = one_dominates || dominates;
-          pointwise_dependences[one][two] =
+          projection_tracking->pointwise_dependences[one][two] =
             std::make_pair(result, dominates);
           // Keep the data structure symmetric for when we go to
           // prune out projection summaries
-          pointwise_dependences[two][one] =
+          projection_tracking->pointwise_dependences[two][one] =
             std::make_pair(result, one_dominates);
-          return result; 
+          return result;
         }
       }
       // If we get here, do the more expensive check to see if we can do
@@ -5342,9 +5371,9 @@ namespace Legion {
       // Same logic applies here as above: if either dominates then you
       // can do pointwise dependence analysis
       const bool result = dominance.first || dominance.second;
-      pointwise_dependences[one][two] =
+      projection_tracking->pointwise_dependences[one][two] =
         std::make_pair(result, dominance.second);
-      pointwise_dependences[two][one] =
+      projection_tracking->pointwise_dependences[two][one] =
         std::make_pair(result, dominance.first);
       dominates = dominance.second;
       return result;
@@ -6408,6 +6437,36 @@ namespace Legion {
       internal_op->end_dependence_analysis();
     }
 
+    //--------------------------------------------------------------------------
+    RegionNode* LogicalAnalysis::find_parent_node(LogicalRegion parent)
+    //--------------------------------------------------------------------------
+    {
+      std::map<LogicalRegion,ParentState>::iterator finder =
+        parent_states.find(parent);
+      if (finder == parent_states.end())
+        finder = parent_states.emplace(parent,
+            ParentState(op->runtime->forest->get_node(parent))).first;
+      return finder->second.node;
+    }
+
+    //--------------------------------------------------------------------------
+    const FieldMask& LogicalAnalysis::find_user_mask(LogicalRegion parent,
+             RegionNode *parent_node, const std::set<FieldID> &privilege_fields)
+    //--------------------------------------------------------------------------
+    {
+      ParentState &state = parent_states[parent];
+#ifdef DEBUG_LEGION
+      assert(state.node == parent_node);
+#endif
+      for (std::vector<std::pair<std::set<FieldID>,FieldMask> >::const_iterator
+            it = state.masks.begin(); it != state.masks.end(); it++)
+        if (it->first == privilege_fields)
+          return it->second;
+      state.masks.emplace_back(std::make_pair(privilege_fields,
+            parent_node->column_source->get_field_mask(privilege_fields)));
+      return state.masks.back().second;
+    }
+
     /////////////////////////////////////////////////////////////
     // Copy Fill Guard
     /////////////////////////////////////////////////////////////
@@ -6710,24 +6769,25 @@ namespace Legion {
         if ((*it)->remove_base_valid_ref(AGGREGATOR_REF))
           delete (*it);
       all_views.clear();
-      // Delete all our copy updates
+      // Destroy all our copy updates, their memory is reclaimed in
+      // bulk when the update arena is destroyed with this aggregator
       for (LegionMap<InstanceView*,FieldMaskSet<Update> >::const_iterator
             mit = sources.begin(); mit != sources.end(); mit++)
       {
-        for (FieldMaskSet<Update>::const_iterator it = 
+        for (FieldMaskSet<Update>::const_iterator it =
               mit->second.begin(); it != mit->second.end(); it++)
-          delete it->first;
+          it->first->~Update();
       }
       for (std::vector<LegionMap<InstanceView*,
-                FieldMaskSet<Update> > >::const_iterator rit = 
+                FieldMaskSet<Update> > >::const_iterator rit =
             reductions.begin(); rit != reductions.end(); rit++)
       {
         for (LegionMap<InstanceView*,FieldMaskSet<Update> >::const_iterator
               mit = rit->begin(); mit != rit->end(); mit++)
         {
-          for (FieldMaskSet<Update>::const_iterator it = 
+          for (FieldMaskSet<Update>::const_iterator it =
                 mit->second.begin(); it != mit->second.end(); it++)
-            delete it->first;
+            it->first->~Update();
         }
       }
     }
@@ -6855,8 +6915,8 @@ namespace Legion {
       update_fields |= src_mask;
       record_view(dst_view);
       record_view(src_view);
-      CopyUpdate *update = 
-        new CopyUpdate(src_view, src_man, src_mask, expr, redop, helper);
+      CopyUpdate *update = update_arena.create<CopyUpdate>(
+          src_view, src_man, src_mask, expr, redop, helper);
       FieldMaskSet<Update> &updates = sources[dst_view];
       if (helper == NULL)
         updates.insert(update, src_mask);
@@ -7218,8 +7278,8 @@ namespace Legion {
       update_fields |= fill_mask;
       record_view(src_view);
       record_view(dst_view);
-      FillUpdate *update = 
-        new FillUpdate(src_view, fill_mask, expr, fill_guard, helper); 
+      FillUpdate *update = update_arena.create<FillUpdate>(
+          src_view, fill_mask, expr, fill_guard, helper);
       if (helper == NULL)
         sources[dst_view].insert(update, fill_mask);
       else
@@ -7282,8 +7342,8 @@ namespace Legion {
         }
         else
           src_man = it->first->as_individual_view()->get_manager();
-        CopyUpdate *update = new CopyUpdate(it->first, src_man, src_mask,
-                                            it->second, redop, across_helper);
+        CopyUpdate *update = update_arena.create<CopyUpdate>(it->first,
+                            src_man, src_mask, it->second, redop, across_helper);
         // Ignore shadows when tracing, we only care about the normal
         // preconditions and postconditions for the copies
         if (tracing_eq != NULL)
@@ -7506,10 +7566,24 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       bool pipelined = true;
+      LEGION_HOT_COUNTER(ANALYSIS_AGGREGATOR_UPDATE_BATCHES);
       std::vector<ApEvent> *target_events = NULL;
+      // First see if there are any groups of individual destination views
+      // that are all replicating the same data from a common individual
+      // source view and can therefore be handled with a broadcast tree
+      // instead of a series of point-to-point copies from the source
+      std::set<InstanceView*> broadcast_targets;
+      if (manage_dst_events && !trace_info.recording &&
+          (updates.size() > LEGION_COLLECTIVE_RADIX))
+        pipelined = issue_broadcast_copies(updates, trace_info, precondition,
+                        recorded_events, restricted_output, broadcast_targets);
       for (LegionMap<InstanceView*,FieldMaskSet<Update> >::const_iterator
             uit = updates.begin(); uit != updates.end(); uit++)
       {
+        // Skip any targets that were handled by a broadcast tree
+        if (!broadcast_targets.empty() && (broadcast_targets.find(uit->first)
+              != broadcast_targets.end()))
+          continue;
         ApEvent dst_precondition = precondition;
         // In the case where we're not managing destination events
         // then we need to incorporate any event postconditions from
@@ -7583,6 +7657,125 @@ namespace Legion {
       return pipelined;
     }
 
+    //--------------------------------------------------------------------------
+    bool CopyFillAggregator::issue_broadcast_copies(
+         const LegionMap<InstanceView*,FieldMaskSet<Update> > &updates,
+         const PhysicalTraceInfo &trace_info, const ApEvent precondition,
+         std::set<RtEvent> &recorded_events, const bool restricted_output,
+         std::set<InstanceView*> &broadcast_targets)
+    //--------------------------------------------------------------------------
+    {
+      // Look for groups of individual destination views that are all
+      // receiving the same read-only data from a common individual source
+      // view. This comes up when a read-only region is replicated out to
+      // many nodes at the start of a phase of an application. Issuing all
+      // the copies point-to-point serializes them on the outgoing bandwidth
+      // of the source node, so instead we build a radix tree of copies with
+      // the early destinations forwarding the data on to later ones, the
+      // same way that collective views broadcast between their instances.
+      // Note that collective destination views are not considered here
+      // because they already get spanning broadcast trees of their own.
+      typedef std::pair<std::pair<IndividualView*,PhysicalManager*>,
+                        IndexSpaceExpression*> BroadcastKey;
+      std::map<BroadcastKey,std::vector<InstanceView*> > groups;
+      std::map<BroadcastKey,FieldMask> group_masks;
+      for (LegionMap<InstanceView*,FieldMaskSet<Update> >::const_iterator
+            uit = updates.begin(); uit != updates.end(); uit++)
+      {
+        // Anything more complicated than a single update to an individual
+        // destination view goes down the normal path
+        if (!uit->first->is_individual_view() || (uit->second.size() != 1))
+          continue;
+        std::vector<FillUpdate*> fills;
+        std::map<InstanceView*,std::vector<CopyUpdate*> > copies;
+        uit->second.begin()->first->sort_updates(copies, fills);
+        if (!fills.empty() || (copies.size() != 1))
+          continue;
+        CopyUpdate *update = copies.begin()->second.back();
+        if ((update->redop != 0) || (update->across_helper != NULL) ||
+            !update->source->is_individual_view())
+          continue;
+        const BroadcastKey key(std::make_pair(
+              update->source->as_individual_view(), update->src_man),
+            update->expr);
+        // All the members of a group need to agree on the fields too
+        const FieldMask &mask = uit->second.get_valid_mask();
+        std::map<BroadcastKey,FieldMask>::const_iterator mask_finder =
+          group_masks.find(key);
+        if (mask_finder == group_masks.end())
+          group_masks[key] = mask;
+        else if (mask_finder->second != mask)
+          continue;
+        groups[key].push_back(uit->first);
+      }
+      bool pipelined = true;
+      const IndexSpaceID match_space = analysis->get_collective_match_space();
+      for (std::map<BroadcastKey,std::vector<InstanceView*> >::const_iterator
+            git = groups.begin(); git != groups.end(); git++)
+      {
+        // If the group fits within a single radix of the source then the
+        // tree degenerates to the point-to-point copies we already have
+        const std::vector<InstanceView*> &targets = git->second;
+        if (targets.size() <= LEGION_COLLECTIVE_RADIX)
+          continue;
+        const FieldMask &copy_mask = group_masks[git->first];
+        IndexSpaceExpression *copy_expr = git->first.second;
+        std::vector<ApEvent> done_events(targets.size());
+        for (unsigned idx = 0; idx < targets.size(); idx++)
+        {
+          InstanceView *target = targets[idx];
+          // The source occupies node zero of the tree and target idx
+          // corresponds to node idx+1, so the parent of target idx is
+          // node idx/radix with node zero being the original source
+          const unsigned parent = idx / LEGION_COLLECTIVE_RADIX;
+          InstanceView *source;
+          PhysicalManager *src_man;
+          ApEvent pre = precondition;
+          if (parent == 0)
+          {
+            source = git->first.first.first;
+            src_man = git->first.first.second;
+          }
+          else
+          {
+            // Forward the data from an earlier destination, making sure
+            // that we explicitly depend on its copy having finished since
+            // there is no guarantee that its copy user has been recorded
+            // on the view by the time we compute our preconditions
+            IndividualView *parent_view =
+              targets[parent-1]->as_individual_view();
+            source = parent_view;
+            src_man = parent_view->get_manager();
+            pre = Runtime::merge_events(&trace_info, precondition,
+                                        done_events[parent-1]);
+          }
+          // We need the completion event for any copy whose destination
+          // is going to feed copies to children later in the tree
+          const bool needs_event = track_events ||
+            (((idx + 1) * LEGION_COLLECTIVE_RADIX) < targets.size());
+          const ApEvent result = target->copy_from(source, pre,
+                                    predicate_guard, 0/*redop*/, copy_expr,
+                                    analysis->op, dst_index, match_space,
+                                    copy_mask, src_man, trace_info,
+                                    recorded_events, effects,
+                                    NULL/*across helper*/,
+                                    true/*manage dst events*/,
+                                    restricted_output, needs_event);
+          done_events[idx] = result;
+          if (result.exists() && track_events)
+            events.push_back(result);
+          broadcast_targets.insert(target);
+          // Same pipelining check as the normal path in perform_updates
+          if (pipelined && (collective_mapping != target->collective_mapping)
+              && ((collective_mapping == NULL) ||
+                  (target->collective_mapping == NULL) ||
+                  (*collective_mapping != *(target->collective_mapping))))
+            pipelined = false;
+        }
+      }
+      return pipelined;
+    }
+
     //--------------------------------------------------------------------------
     void CopyFillAggregator::issue_fills(InstanceView *target,
                                          const std::vector<FillUpdate*> &fills,
@@ -7602,6 +7795,7 @@ namespace Legion {
       assert((fills[0]->across_helper == NULL) || !manage_dst_events);
       assert((dst_events == NULL) || track_events);
 #endif
+      LEGION_HOT_COUNTER_ADD(ANALYSIS_AGGREGATOR_FILLS, fills.size());
       const IndexSpaceID match_space = analysis->get_collective_match_space();
       if (fills.size() == 1)
       {
@@ -7718,6 +7912,7 @@ namespace Legion {
       assert((dst_events == NULL) || track_events);
 #endif
       const IndexSpaceID match_space = analysis->get_collective_match_space();
+      LEGION_HOT_COUNTER(ANALYSIS_AGGREGATOR_COPY_BATCHES);
       // We'll also look for an interesting optimization case here 
       // that was identified by cuNumeric tensor contractions, in 
       // some cases we'll have a group of individual views in the
@@ -12536,9 +12731,12 @@ namespace Legion {
         tracing_preconditions(NULL), tracing_anticonditions(NULL),
         tracing_postconditions(NULL), tracing_dirty_fields(NULL),
         logical_owner_space(logical), replicated_owner_state(NULL),
-        migration_index(0), sample_count(0)
+        migration_index(0), sample_count(0), owner_history_index(0),
+        pending_migration_target(logical), migration_pin_count(0)
     //--------------------------------------------------------------------------
     {
+      for (unsigned idx = 0; idx < MIGRATION_HISTORY; idx++)
+        owner_history[idx] = logical;
       context->add_nested_resource_ref(did);
       context->add_nested_gc_ref(did);
       set_expr->add_nested_expression_reference(did);
@@ -13801,6 +13999,80 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    bool EquivalenceSet::can_skip_dense_update(const UpdateAnalysis &analysis,
+                                               const FieldMask &user_mask) const
+    //--------------------------------------------------------------------------
+    {
+      // Already holding the eq_lock from EquivalenceSet::analyze method
+      // This checks for the common case of mapping a single instance that
+      // is already fully valid by name for all the fields over the whole
+      // dense equivalence set. In that case the general analysis below is
+      // guaranteed to issue no copies or fills and to leave the state of
+      // the equivalence set unchanged, so the caller can skip all the
+      // index space expression arithmetic and go straight to registering
+      // users on the views. Anything unusual (reductions, restrictions,
+      // partial validity, guards, tracing, collective views) falls back
+      // to the fully general path.
+      if (IS_REDUCE(analysis.usage) || IS_WRITE_DISCARD(analysis.usage) ||
+          IS_READ_DISCARD(analysis.usage))
+        return false;
+      if (analysis.trace_info.recording || !analysis.record_valid)
+        return false;
+      // No pending reductions, restrictions, or partially valid data
+      // for any of the fields that we are updating
+      if (!(user_mask * reduction_fields))
+        return false;
+      if (!(user_mask * restricted_fields))
+        return false;
+      if (!(user_mask * partial_valid_fields))
+        return false;
+      // Read-only operations with overlapping guards need to serialize
+      // through the general path
+      if (!read_only_guards.empty() &&
+          !(user_mask * read_only_guards.get_valid_mask()))
+        return false;
+      // Check that we have a single individual target instance that
+      // covers all the fields being updated
+      if (analysis.target_views.size() != 1)
+        return false;
+      const FieldMaskSet<InstanceView> &targets = analysis.target_views[0];
+      if (targets.size() != 1)
+        return false;
+      FieldMaskSet<InstanceView>::const_iterator target = targets.begin();
+      if (!target->first->is_individual_view())
+        return false;
+      if (!!(user_mask - target->second))
+        return false;
+      // The target must already be fully valid by name for all the fields
+      FieldMaskSet<LogicalView>::const_iterator valid_finder =
+        total_valid_instances.find(target->first);
+      if (valid_finder == total_valid_instances.end())
+        return false;
+      if (!!(user_mask - valid_finder->second))
+        return false;
+      if (IS_WRITE(analysis.usage))
+      {
+        // For writes the target must also be the only valid instance so
+        // that skipping the invalidation leaves no stale instances behind
+        if (total_valid_instances.size() != 1)
+          return false;
+        if (!collective_instances.empty() &&
+            !(user_mask * collective_instances.get_valid_mask()))
+          return false;
+      }
+      // The data must already be initialized for all the fields so both
+      // the uninitialized-use check and the initialized-data update in
+      // the general path are guaranteed to be no-ops
+      FieldMaskSet<IndexSpaceExpression>::const_iterator init_finder =
+        initialized_data.find(set_expr);
+      if (init_finder == initialized_data.end())
+        return false;
+      if (!!(user_mask - init_finder->second))
+        return false;
+      return true;
+    }
+
     //--------------------------------------------------------------------------
     void EquivalenceSet::update_set(UpdateAnalysis &analysis,
                                     IndexSpaceExpression *expr,
@@ -13811,9 +14083,16 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       // Already holding the eq_lock from EquivalenceSet::analyze method
-      // Now that we're ready to perform the analysis 
-      // we need to lock the analysis 
+      // Now that we're ready to perform the analysis
+      // we need to lock the analysis
       AutoLock a_lock(analysis);
+#ifndef LEGION_DISABLE_DENSE_UPDATE_FAST_PATH
+      // Fast path: a single dense instance that is already fully valid
+      // needs no copies and no state updates, so skip the expression
+      // arithmetic and go straight to the view registration
+      if (expr_covers && can_skip_dense_update(analysis, user_mask))
+        return;
+#endif
       // Check for any uninitialized data
       // Don't report uninitialized warnings for empty equivalence classes
       if (analysis.check_initialized && !set_expr->is_empty())
@@ -14215,6 +14494,7 @@ namespace Legion {
           }
           runtime->send_equivalence_set_owner_update(eq_source, rez);
           applied_events.insert(notification_event);
+          LEGION_HOT_COUNTER(ANALYSIS_EQ_SET_OWNER_UPDATES);
         }
         return;
       }
@@ -14325,6 +14605,55 @@ namespace Legion {
       sample_count = 0;
       // Reset this for the next iteration
       next_samples.clear();
+      // Filter the decision through the access-pattern history: only
+      // move the set on a sustained shift and pin sets that are
+      // bouncing back and forth between the same nodes
+      if (logical_owner_space != new_logical_owner)
+      {
+        if (migration_pin_count > 0)
+        {
+          // This set recently ping-ponged so it is pinned in place;
+          // ride out the cooldown before considering moving it again
+          if (--migration_pin_count == 0)
+          {
+            // Forget the old owners once the pin expires so the set
+            // is free to migrate anywhere again
+            for (unsigned idx = 0; idx < MIGRATION_HISTORY; idx++)
+              owner_history[idx] = logical_owner_space;
+          }
+          LEGION_HOT_COUNTER(ANALYSIS_EQ_SET_MIGRATIONS_PINNED);
+          new_logical_owner = logical_owner_space;
+        }
+        else if (new_logical_owner != pending_migration_target)
+        {
+          // Require the same destination to win consecutive migration
+          // tests so that a transient burst of requests from one node
+          // does not move the set; only sustained shifts do
+          pending_migration_target = new_logical_owner;
+          LEGION_HOT_COUNTER(ANALYSIS_EQ_SET_MIGRATIONS_DEFERRED);
+          new_logical_owner = logical_owner_space;
+        }
+        else
+        {
+          // If the destination is one of our recent owners then this
+          // set is ping-ponging between nodes, e.g. for an alternating
+          // producer-consumer pattern; pin it where it is now instead
+          // of paying to move the state back and forth every few epochs
+          for (unsigned idx = 0; idx < MIGRATION_HISTORY; idx++)
+          {
+            if (owner_history[idx] != new_logical_owner)
+              continue;
+            log_migration.info("Pinning Equivalence Set %llx on %d "
+                "(ping-pong with %d)", did, local_space, new_logical_owner);
+            migration_pin_count = MIGRATION_PIN_TESTS;
+            LEGION_HOT_COUNTER(ANALYSIS_EQ_SET_MIGRATIONS_PINNED);
+            new_logical_owner = logical_owner_space;
+            break;
+          }
+        }
+      }
+      else
+        pending_migration_target = logical_owner_space;
       // See if we are actually going to do the migration
       if (logical_owner_space == new_logical_owner)
       {
@@ -14344,12 +14673,17 @@ namespace Legion {
           }
           runtime->send_equivalence_set_owner_update(eq_source, rez);
           applied_events.insert(notification_event);
+          LEGION_HOT_COUNTER(ANALYSIS_EQ_SET_OWNER_UPDATES);
         }
         return;
       }
       // At this point we've decided to do the migration
       log_migration.info("Migrating Equivalence Set %llx from %d to %d",
           did, local_space, new_logical_owner);
+      LEGION_HOT_COUNTER(ANALYSIS_EQ_SET_MIGRATIONS);
+      // Remember the owner we are leaving for ping-pong detection
+      owner_history[owner_history_index] = logical_owner_space;
+      owner_history_index = (owner_history_index + 1) % MIGRATION_HISTORY;
       const FieldMask all_ones(LEGION_FIELD_MASK_FIELD_ALL_ONES);
       // Do the migration
       Serializer rez;
@@ -23613,13 +23947,21 @@ namespace Legion {
                                                const FieldMask &mask) const
     //--------------------------------------------------------------------------
     {
-      for (FieldMaskSet<EquivalenceSet>::const_iterator it = 
+      // This scan is linear in the number of cached sets which can be
+      // large when sets have fragmented by field (e.g. regions with many
+      // fields accessed a field at a time), so stop as soon as we've
+      // covered all the requested fields
+      FieldMask remaining = mask & equivalence_sets.get_valid_mask();
+      for (FieldMaskSet<EquivalenceSet>::const_iterator it =
             equivalence_sets.begin(); it != equivalence_sets.end(); it++)
       {
-        const FieldMask overlap = it->second & mask;
+        const FieldMask overlap = it->second & remaining;
         if (!overlap)
           continue;
         version_info->record_equivalence_set(it->first, overlap);
+        remaining -= overlap;
+        if (!remaining)
+          break;
       }
     }
 
@@ -24357,6 +24699,31 @@ namespace Legion {
     {
     }
 
+    //--------------------------------------------------------------------------
+    bool VersionManager::find_dominant_owner(AddressSpaceID &owner) const
+    //--------------------------------------------------------------------------
+    {
+      std::map<AddressSpaceID,unsigned> counts;
+      {
+        AutoLock m_lock(manager_lock,1,false/*exclusive*/);
+        if (equivalence_sets.empty())
+          return false;
+        for (FieldMaskSet<EquivalenceSet>::const_iterator it =
+              equivalence_sets.begin(); it != equivalence_sets.end(); it++)
+          counts[it->first->get_logical_owner_hint()]++;
+      }
+      unsigned best_count = 0;
+      for (std::map<AddressSpaceID,unsigned>::const_iterator it =
+            counts.begin(); it != counts.end(); it++)
+      {
+        if (it->second <= best_count)
+          continue;
+        best_count = it->second;
+        owner = it->first;
+      }
+      return true;
+    }
+
     //--------------------------------------------------------------------------
     void VersionManager::perform_versioning_analysis(InnerContext *outermost,
                  VersionInfo *version_info, RegionNode *region_node,
@@ -1479,20 +1479,28 @@ namespace Legion {
       FieldMaskSet<RefinementTracker> refinement_trackers;
     public:
       static constexpr size_t PROJECTION_CACHE_SIZE = 32;
-      // Note that this list can grow bigger than PROJECTION_CACHE_SIZE
-      // but we only keep references on the entries within the size of the
-      // cache. This allows us to still hit on projections that are still
-      // alive from other references, but also allows those entries to
-      // be pruned out once they are no longer alive
-      std::list<ProjectionSummary*> projection_summary_cache;
-      std::unordered_map<ProjectionSummary*,
+      // Cold bookkeeping for projection summaries. These structures are only
+      // touched when analyzing projection region requirements and they are
+      // bulky, so we keep them out of line behind a lazily-allocated struct
+      // so the hot members of this class traversed on every dependence
+      // analysis stay densely packed in the cache.
+      struct ProjectionTracking : public LegionHeapify<ProjectionTracking> {
+        // Note that this list can grow bigger than PROJECTION_CACHE_SIZE
+        // but we only keep references on the entries within the size of the
+        // cache. This allows us to still hit on projections that are still
+        // alive from other references, but also allows those entries to
+        // be pruned out once they are no longer alive
+        std::list<ProjectionSummary*> projection_summary_cache;
         std::unordered_map<ProjectionSummary*,
-         std::pair<bool/*interferes*/,bool/*dominates*/> > > interfering_shards;
-      // Track which pairs of projection summaries have point-wise mapping
-      // dependences between them.
-      std::unordered_map<ProjectionSummary*,
-       std::unordered_map<ProjectionSummary*,
-       std::pair<bool/*pointwise*/,bool/*dominates*/> > > pointwise_dependences;
+          std::unordered_map<ProjectionSummary*,
+          std::pair<bool/*interferes*/,bool/*dominates*/> > > interfering_shards;
+        // Track which pairs of projection summaries have point-wise mapping
+        // dependences between them.
+        std::unordered_map<ProjectionSummary*,
+         std::unordered_map<ProjectionSummary*,
+         std::pair<bool/*pointwise*/,bool/*dominates*/> > > pointwise_dependences;
+      };
+      ProjectionTracking *projection_tracking;
     };
 
     typedef DynamicTableAllocator<LogicalState,10,8> LogicalStateAllocator;
@@ -1544,6 +1552,25 @@ namespace Legion {
                                    RegionTreeNode *path_node,
                                    const LogicalUser *user,
                                    const FieldMask &mask);
+    public:
+      // Batched lookups shared across all the region requirements of a
+      // single operation: index launches commonly name the same parent
+      // region and privilege fields in many requirements, so memoize the
+      // region tree node resolution and the field mask computation here
+      // to amortize the forest and field space lock acquisitions across
+      // the whole launch rather than paying them per requirement
+      RegionNode* find_parent_node(LogicalRegion parent);
+      const FieldMask& find_user_mask(LogicalRegion parent,
+          RegionNode *parent_node, const std::set<FieldID> &privilege_fields);
+    protected:
+      struct ParentState {
+      public:
+        ParentState(void) : node(NULL) { }
+        ParentState(RegionNode *n) : node(n) { }
+      public:
+        RegionNode *node;
+        std::vector<std::pair<std::set<FieldID>,FieldMask> > masks;
+      };
     protected:
       void issue_internal_operation(RegionTreeNode *node,
           InternalOp *close_op, const FieldMask &internal_mask,
@@ -1562,6 +1589,7 @@ namespace Legion {
       // know that they will be in order across shards too 
       OrderedRefinements pending_refinements;
       std::map<RegionTreeNode*,MergeCloseOp*> pending_closes;
+      std::map<LogicalRegion,ParentState> parent_states;
     };
 
     /**
@@ -1953,6 +1981,13 @@ namespace Legion {
                            const bool restricted_output,
                            std::map<InstanceView*,
                                     std::vector<ApEvent> > *dst_events);
+      bool issue_broadcast_copies(const LegionMap<InstanceView*,
+                            FieldMaskSet<Update> > &updates,
+                           const PhysicalTraceInfo &trace_info,
+                           const ApEvent precondition,
+                           std::set<RtEvent> &recorded_events,
+                           const bool restricted_output,
+                           std::set<InstanceView*> &broadcast_targets);
       void issue_fills(InstanceView *target,
                        const std::vector<FillUpdate*> &fills,
                        std::set<RtEvent> &recorded_events,
@@ -1991,7 +2026,12 @@ namespace Legion {
       const bool track_events;
     protected:
       FieldMask update_fields;
-      LegionMap<InstanceView*,FieldMaskSet<Update> > sources; 
+      // Arena for the copy and fill updates recorded by this aggregator,
+      // all of which live until the aggregator is destroyed, so we bump
+      // allocate them here instead of going through the global heap for
+      // every update on the mapping hot path
+      LegionArena update_arena;
+      LegionMap<InstanceView*,FieldMaskSet<Update> > sources;
       std::vector</*vector over reduction epochs*/
         LegionMap<InstanceView*,FieldMaskSet<Update> > > reductions;
       // Figure out the reduction operator is for each epoch of a
@@ -3302,6 +3342,17 @@ namespace Legion {
      * the equivalence set for each of the different fields.
      * It's also possible for the equivalence set to be refined
      * into sub equivalence sets which then subsum it's responsibility.
+     * A note on memory growth: the state tracked here is compacted
+     * eagerly as it is mutated rather than by any background sweep.
+     * Partial valid instances whose expressions grow to cover the set
+     * expression are promoted into the total valid instances, entries
+     * for the same view with overlapping fields are merged under their
+     * union expression (see record_partial_valid_instance), and filters
+     * tighten the summary masks as entries are removed. Sets themselves
+     * are distributed collectables that are reclaimed when refinements
+     * or context cleanup invalidate them, so long-run analysis memory
+     * is bounded by the live refinement structure and not by the
+     * history of regions that were ever touched.
      */
     class EquivalenceSet : public DistributedCollectable,
                            public LegionHeapify<EquivalenceSet> {
@@ -3385,6 +3436,10 @@ namespace Legion {
       // Must be called while holding the lock
       inline bool is_logical_owner(void) const
         { return (local_space == logical_owner_space); }
+      // Sample the logical owner without taking the lock, only to be
+      // used as a placement hint since the result can be stale
+      inline AddressSpaceID get_logical_owner_hint(void) const
+        { return logical_owner_space; }
     public:
       // From distributed collectable
       virtual void notify_invalid(void) { assert(false); }
@@ -3687,6 +3742,8 @@ namespace Legion {
           std::map<LogicalView*,unsigned> *view_refs_to_remove = NULL);
       bool find_fully_valid_fields(InstanceView *inst, FieldMask &inst_mask,
           IndexSpaceExpression *expr, const bool expr_covers) const;
+      bool can_skip_dense_update(const UpdateAnalysis &analysis,
+          const FieldMask &user_mask) const;
       bool find_partial_valid_fields(InstanceView *inst, FieldMask &inst_mask,
           IndexSpaceExpression *expr, const bool expr_covers,
           FieldMaskSet<IndexSpaceExpression> &partial_valid_exprs) const;
@@ -3880,10 +3937,23 @@ namespace Legion {
       static constexpr unsigned SAMPLES_PER_MIGRATION_TEST = 64;
       // How many total epochs we want to remember
       static constexpr unsigned MIGRATION_EPOCHS = 2;
-      std::vector<std::pair<AddressSpaceID,unsigned> > 
+      std::vector<std::pair<AddressSpaceID,unsigned> >
         user_samples[MIGRATION_EPOCHS];
       unsigned migration_index;
       unsigned sample_count;
+      // How many past owners to remember for detecting sets that are
+      // bouncing back and forth between the same nodes
+      static constexpr unsigned MIGRATION_HISTORY = 4;
+      // How many migration tests a ping-ponging set stays pinned for
+      static constexpr unsigned MIGRATION_PIN_TESTS = 4;
+      // Ring of the owners this set has migrated away from
+      AddressSpaceID owner_history[MIGRATION_HISTORY];
+      unsigned owner_history_index;
+      // The destination that won the previous migration test; we only
+      // migrate when the same destination wins consecutive tests
+      AddressSpaceID pending_migration_target;
+      // Number of remaining migration tests for which this set is pinned
+      unsigned migration_pin_count;
     };
 
     /**
@@ -3925,10 +3995,13 @@ namespace Legion {
     public:
       VersionManager& operator=(const VersionManager &rhs) = delete;
     public:
-      inline bool has_versions(const FieldMask &mask) const 
+      inline bool has_versions(const FieldMask &mask) const
         { return !(mask - equivalence_sets.get_valid_mask()); }
       inline const FieldMask& get_version_mask(void) const
         { return equivalence_sets.get_valid_mask(); }
+      // Find the address space that owns the most of our cached
+      // equivalence sets, returns false if we have none cached
+      bool find_dominant_owner(AddressSpaceID &owner) const;
     public:
       void perform_versioning_analysis(InnerContext *outermost,
                                        VersionInfo *version_info,
@@ -550,9 +550,132 @@ namespace Legion {
     //--------------------------------------------------------------------------
     OccurrenceWatcher::OccurrenceWatcher(InnerContext *context,
                                       const Mapper::ContextConfigOutput &config)
-      : cache(context), visit_threshold(config.auto_tracing_visit_threshold)
+      : cache(context), visit_threshold(config.auto_tracing_visit_threshold),
+        min_trace_length(config.auto_tracing_min_trace_length)
     //--------------------------------------------------------------------------
     {
+      if (!context->runtime->auto_trace_file.empty())
+        load_traces(context->runtime->auto_trace_file);
+    }
+
+    //--------------------------------------------------------------------------
+    OccurrenceWatcher::~OccurrenceWatcher(void)
+    //--------------------------------------------------------------------------
+    {
+      if (!cache.context->runtime->auto_trace_file.empty())
+        dump_traces(cache.context->runtime->auto_trace_file);
+    }
+
+    //--------------------------------------------------------------------------
+    void OccurrenceWatcher::load_traces(const std::string &filename)
+    //--------------------------------------------------------------------------
+    {
+      FILE *file = fopen(filename.c_str(), "rb");
+      if (file == NULL)
+        return;
+      const uint64_t our_task_id = cache.context->owner_task->task_id;
+      unsigned loaded = 0;
+      for ( ; ; )
+      {
+        uint64_t task_id, length;
+        Murmur3Hasher::Hash structural;
+        if (fread(&task_id, sizeof(task_id), 1, file) != 1)
+          break;
+        if (fread(&structural, sizeof(structural), 1, file) != 1)
+          break;
+        if (fread(&length, sizeof(length), 1, file) != 1)
+          break;
+        if (length == 0)
+          break;
+        std::vector<Murmur3Hasher::Hash> hashes(length);
+        if (fread(&hashes.front(), sizeof(Murmur3Hasher::Hash),
+                  length, file) != length)
+          break;
+        // Only load traces learned for the same kind of parent task
+        if (task_id != our_task_id)
+          continue;
+        // The same trace can appear in the file multiple times when
+        // several nodes or runs appended it, so dedupe on insertion
+        const TrieQueryResult result = trie.query(&hashes.front(), length);
+        if (result.prefix || result.contains || result.superstring)
+          continue;
+        TraceCandidate candidate(0/*opidx*/, structural);
+        candidate.completed = true;
+        candidate.from_file = true;
+        trie.insert(&hashes.front(), length, candidate);
+        if (!!structural)
+          committed_structures.insert(structural);
+        // Commit straight to the trace cache so the very first occurrence
+        // in this run can be replayed without waiting for the trace to
+        // reach the visit threshold and prove itself all over again
+        if (!cache.has_prefix(hashes))
+          cache.insert(hashes, 0/*opidx*/);
+        loaded++;
+      }
+      fclose(file);
+      if (loaded > 0)
+        log_auto_trace.info() << "Loaded " << loaded << " traces for task "
+                              << cache.context->owner_task->get_task_name()
+                              << " from " << filename;
+    }
+
+    //--------------------------------------------------------------------------
+    void OccurrenceWatcher::dump_traces(const std::string &filename)
+    //--------------------------------------------------------------------------
+    {
+      FILE *file = fopen(filename.c_str(), "ab");
+      if (file == NULL)
+      {
+        log_auto_trace.warning() << "Failed to open auto trace file "
+                                 << filename << " for appending";
+        return;
+      }
+      std::vector<Murmur3Hasher::Hash> prefix;
+      dump_node(file, trie.get_root(), prefix);
+      fclose(file);
+    }
+
+    //--------------------------------------------------------------------------
+    void OccurrenceWatcher::dump_node(FILE *file,
+                             TrieNode<Murmur3Hasher::Hash,TraceCandidate> *node,
+                             std::vector<Murmur3Hasher::Hash> &prefix)
+    //--------------------------------------------------------------------------
+    {
+      // Only write out traces that were committed during this run -
+      // candidates that never reached the visit threshold have not shown
+      // they are worth replaying, and candidates loaded from the file
+      // are already in it
+      if (node->get_end() && !prefix.empty())
+      {
+        const TraceCandidate &candidate = node->get_value();
+        if (candidate.completed && !candidate.from_file)
+        {
+          const uint64_t task_id = cache.context->owner_task->task_id;
+          const uint64_t length = prefix.size();
+          if ((fwrite(&task_id, sizeof(task_id), 1, file) != 1) ||
+              (fwrite(&candidate.structural,
+                      sizeof(candidate.structural), 1, file) != 1) ||
+              (fwrite(&length, sizeof(length), 1, file) != 1) ||
+              (fwrite(&prefix.front(), sizeof(Murmur3Hasher::Hash),
+                      length, file) != length))
+          {
+            log_auto_trace.warning() << "Failed to append trace to auto "
+                                     << "trace file";
+            return;
+          }
+        }
+      }
+      const std::unordered_map<Murmur3Hasher::Hash,
+            TrieNode<Murmur3Hasher::Hash,TraceCandidate>*> &children =
+              node->get_children();
+      for (std::unordered_map<Murmur3Hasher::Hash,
+            TrieNode<Murmur3Hasher::Hash,TraceCandidate>*>::const_iterator
+            it = children.begin(); it != children.end(); it++)
+      {
+        prefix.push_back(it->first);
+        dump_node(file, it->second, prefix);
+        prefix.pop_back();
+      }
     }
 
     //--------------------------------------------------------------------------
@@ -586,9 +709,31 @@ namespace Legion {
             candidate.visits++;
             candidate.previous_visited_opidx = opidx;
           }
-          if ((visit_threshold <= candidate.visits) && !candidate.completed)
+          // Scale the visit threshold down for traces longer than the
+          // minimum length since they amortize the per-operation pipeline
+          // overhead over proportionally more operations, e.g. a trace
+          // twice the minimum length only needs half the visits. This is
+          // what makes chains of very short tasks start replaying quickly.
+          // We always require at least two qualifying visits though so a
+          // trace has actually repeated before we pay to capture it. The
+          // mapper retains control of both inputs to this heuristic
+          // through its context configuration.
+          uint64_t effective_threshold = visit_threshold;
+          if ((min_trace_length > 0) && (pointer.depth > min_trace_length))
+            effective_threshold = std::max<uint64_t>(2,
+                (visit_threshold * min_trace_length) / pointer.depth);
+          // A candidate is committed once it reaches the visit threshold,
+          // or immediately if it is isomorphic to a trace that was already
+          // committed, since a structurally identical trace has already
+          // proven that this shape of trace is worth replaying
+          if (((effective_threshold <= candidate.visits) ||
+               (!!candidate.structural &&
+                (committed_structures.find(candidate.structural) !=
+                 committed_structures.end()))) && !candidate.completed)
           {
             candidate.completed = true;
+            if (!!candidate.structural)
+              committed_structures.insert(candidate.structural);
             std::vector<Murmur3Hasher::Hash> hashes(pointer.depth);
             for (unsigned j = 0; j < pointer.depth; j++) 
             {
@@ -656,10 +801,11 @@ namespace Legion {
 
     //--------------------------------------------------------------------------
     void OccurrenceWatcher::insert(const Murmur3Hasher::Hash *hashes,
-                                                    size_t size, uint64_t opidx)
+                                   size_t size, uint64_t opidx,
+                                   Murmur3Hasher::Hash structural)
     //--------------------------------------------------------------------------
     {
-      trie.insert(hashes, size, TraceCandidate(opidx));
+      trie.insert(hashes, size, TraceCandidate(opidx, structural));
     }
 
     //--------------------------------------------------------------------------
@@ -688,16 +834,19 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       hashes.reserve(batchsize+1);
+      structural_hashes.reserve(batchsize+1);
     }
 
     //--------------------------------------------------------------------------
     bool TraceRecognizer::record_operation_hash(Operation *op,
-                                          Murmur3Hasher &hasher, uint64_t opidx)
+                                            TraceHasher &hasher, uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher::Hash hash;
-      hasher.finalize(hash);
+      Murmur3Hasher::Hash hash, structural;
+      hasher.concrete.finalize(hash);
+      hasher.structural.finalize(structural);
       hashes.push_back(hash);
+      structural_hashes.push_back(structural);
       if (check_for_repeats(opidx))
         update_watcher(opidx);
       return watcher.record_operation(op, hash, opidx);
@@ -718,7 +867,9 @@ namespace Legion {
       // dummy hash value into the trace identifier so that the
       // traces it finds don't span across these operations.
       // Generate a unique hash and enqueue it
-      hashes.push_back(get_unique_hash());
+      const Murmur3Hasher::Hash unique = get_unique_hash();
+      hashes.push_back(unique);
+      structural_hashes.push_back(unique);
       if (check_for_repeats(opidx))
         update_watcher(opidx);
       watcher.flush(opidx);
@@ -746,13 +897,16 @@ namespace Legion {
       {
         // Insert the sentinel token before launching the meta task.
         hashes.push_back(SENTINEL);
+        structural_hashes.push_back(SENTINEL);
         repeat_results.emplace_back(FindRepeatsResult());
         FindRepeatsResult &repeat = repeat_results.back();
         FindRepeatsTaskArgs args(this, &repeat);
         repeat.start = &hashes.front();
+        repeat.structural_start = &structural_hashes.front();
         repeat.size = hashes.size();
         repeat.opidx = opidx;
         hashes.swap(repeat.hashes);
+        structural_hashes.swap(repeat.structural_hashes);
         // Runtime meta-task in program order
         repeat.finish_event = implicit_runtime->issue_runtime_meta_task(args,
             LG_THROUGHPUT_WORK_PRIORITY, repeat_results.size() > 1 ?
@@ -773,6 +927,7 @@ namespace Legion {
         repeat_results.emplace_back(FindRepeatsResult());
         FindRepeatsResult &repeat = repeat_results.back();
         repeat.start = &hashes[start];
+        repeat.structural_start = &structural_hashes[start];
         repeat.size = window_size;
         repeat.opidx = opidx;
         FindRepeatsTaskArgs args(this, &repeat);
@@ -819,7 +974,8 @@ namespace Legion {
         FindRepeatsResult &repeats = repeat_results.front();
         for (std::vector<NonOverlappingRepeatsResult>::const_iterator it =
               repeats.result.begin(); it != repeats.result.end(); it++)
-          add_trace(repeats.start+it->start, (it->end - it->start), opidx);
+          add_trace(repeats.start+it->start, repeats.structural_start+it->start,
+                    (it->end - it->start), opidx);
         repeat_results.pop_front();
       }
       if (double_wait_interval)
@@ -828,22 +984,24 @@ namespace Legion {
 
     //--------------------------------------------------------------------------
     void TraceRecognizer::add_trace(const Murmur3Hasher::Hash *hashes,
+                                    const Murmur3Hasher::Hash *structural,
                                     uint64_t size, uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      if (size < min_trace_length) 
+      if (size < min_trace_length)
         return;
       // Check that we aren't uint64_t max before attempting to do
       // some arithmetic that will overflow.
       if ((max_trace_length != std::numeric_limits<unsigned>::max()) &&
-          (size > (max_trace_length + min_trace_length))) 
+          (size > (max_trace_length + min_trace_length)))
       {
         // If we're larger than the max trace length (plus a little slack),
         // then break up this trace into smaller pieces that we'll insert
         // into our watched data structures. First, insert a trace of the
         // maximum length, then insert the rest of the trace.
-        add_trace(hashes, max_trace_length, opidx);
-        add_trace(hashes+max_trace_length, size - max_trace_length, opidx);
+        add_trace(hashes, structural, max_trace_length, opidx);
+        add_trace(hashes+max_trace_length, structural+max_trace_length,
+            size - max_trace_length, opidx);
         return;
       }
       TrieQueryResult query = watcher.query(hashes, size);
@@ -855,9 +1013,16 @@ namespace Legion {
       // If the trace we're trying to insert is also not a superstring
       // of an existing trace, then this is the easy case where we can
       // just insert it and move on.
-      if (!query.superstring) 
+      if (!query.superstring)
       {
-        watcher.insert(hashes, size, opidx);
+        // Combine the structural hashes of the operations in the trace
+        // into a single signature that isomorphic traces will share
+        Murmur3Hasher signature_hasher;
+        for (uint64_t idx = 0; idx < size; idx++)
+          signature_hasher.hash(structural[idx]);
+        Murmur3Hasher::Hash signature;
+        signature_hasher.finalize(signature);
+        watcher.insert(hashes, size, opidx, signature);
         return;
       }
 #ifdef DEBUG_LEGION
@@ -866,7 +1031,8 @@ namespace Legion {
       // If the trace we're inserting is a superstring of another
       // string in the recorded set of traces, then splice out the
       // contained prefix and try to insert the rest of the trace.
-      add_trace(hashes + query.superstring_match, 
+      add_trace(hashes + query.superstring_match,
+          structural + query.superstring_match,
           size - query.superstring_match, opidx);
     }
 
@@ -1172,17 +1338,30 @@ namespace Legion {
       if (unordered || (this->current_trace != NULL) || !outermost)
         return T::add_to_dependence_queue(
             op, dependences, unordered, true/*outermost*/);
-      else if (op->record_trace_hash(this->recognizer, this->opidx))
-      {
-        this->opidx++;
-        return true;
-      }
       else
       {
-        // Increment the current trace blocking index so we know
-        // when we need to flush operations under blocking calls
-        this->current_trace_blocking_index = this->next_blocking_index;
-        return T::add_to_dependence_queue(op, dependences);
+        // Launch the prepipeline stage now, before the recognizer gets a
+        // chance to buffer this operation while it deliberates about
+        // replays. The prepipeline work (mapper task options, parent
+        // region indexes) only needs the operation to be initialized, so
+        // it can overlap with trace recognition and any time spent in the
+        // trace cache's buffer instead of waiting until the operation is
+        // flushed to the dependence queue. The later launch from
+        // add_to_dependence_queue recognizes that the stage already ran.
+        if (op->has_prepipeline_stage())
+          this->add_to_prepipeline_queue(op);
+        if (op->record_trace_hash(this->recognizer, this->opidx))
+        {
+          this->opidx++;
+          return true;
+        }
+        else
+        {
+          // Increment the current trace blocking index so we know
+          // when we need to flush operations under blocking calls
+          this->current_trace_blocking_index = this->next_blocking_index;
+          return T::add_to_dependence_queue(op, dependences);
+        }
       }
     }
 
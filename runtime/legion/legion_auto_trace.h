@@ -22,8 +22,10 @@
 #include "legion/legion_utilities.h"
 #include "legion/trie.h"
 
+#include <cstdio>
 #include <limits>
 #include <queue>
+#include <unordered_set>
 
 template<>
 struct std::hash<Legion::Internal::Murmur3Hasher::Hash> {
@@ -56,6 +58,41 @@ namespace Legion {
     // Declare all of the necessary loggers.
     LEGION_EXTERN_LOGGER_DECLARATIONS
 
+    /**
+     * \class TraceHasher
+     * The trace hasher computes two hashes over an operation at the same
+     * time: a concrete hash over everything that identifies the operation
+     * (used for finding exact repeats to replay), and a structural hash
+     * that skips the names of regions, partitions, and futures so that
+     * operations which differ only in which data they name hash the same.
+     * Traces whose structural hashes match are isomorphic, which the
+     * occurrence watcher uses to promote candidates that share a structure
+     * with an already-committed trace without waiting for them to hit the
+     * visit threshold on their own.
+     */
+    class TraceHasher {
+    public:
+      template<typename T, bool PRECISE = true>
+      inline void hash(const T &value)
+        {
+          concrete.hash<T,PRECISE>(value);
+          structural.hash<T,PRECISE>(value);
+        }
+      inline void hash(const void *value, size_t size)
+        {
+          concrete.hash(value, size);
+          structural.hash(value, size);
+        }
+      // For values that name data (regions, partitions, futures) which
+      // should not contribute to the structural hash
+      template<typename T, bool PRECISE = true>
+      inline void hash_concrete(const T &value)
+        { concrete.hash<T,PRECISE>(value); }
+    public:
+      Murmur3Hasher concrete;
+      Murmur3Hasher structural;
+    };
+
     /**
      * \class TraceCache
      * The trace cache maintains a trie corresponding to traces that have
@@ -205,13 +242,15 @@ namespace Legion {
     public:
       OccurrenceWatcher(InnerContext *context,
           const Mapper::ContextConfigOutput &config);
+      ~OccurrenceWatcher(void);
     public:
       bool record_operation(Operation *op,
-          Murmur3Hasher::Hash hash, uint64_t opidx); 
+          Murmur3Hasher::Hash hash, uint64_t opidx);
       bool record_noop(Operation *op);
       void flush(uint64_t opidx);
-      void insert(const Murmur3Hasher::Hash *hashes, 
-                  size_t size, uint64_t opidx);
+      void insert(const Murmur3Hasher::Hash *hashes,
+                  size_t size, uint64_t opidx,
+                  Murmur3Hasher::Hash structural);
       TrieQueryResult query(const Murmur3Hasher::Hash *hashes,
                             size_t size) const;
     private:
@@ -220,9 +259,13 @@ namespace Legion {
       struct TraceCandidate {
         // Needs to be default constructable.
         TraceCandidate() : opidx(0) { }
-        TraceCandidate(uint64_t opidx_) : opidx(opidx_) { }
+        TraceCandidate(uint64_t opidx_, Murmur3Hasher::Hash structural_)
+          : opidx(opidx_), structural(structural_) { }
         // The opidx that this trace was inserted at.
         uint64_t opidx;
+        // Structural hash of the trace, shared by isomorphic traces
+        // that differ only in which regions or futures they name.
+        Murmur3Hasher::Hash structural;
         // The occurrence watcher will only maintain the number
         // of visits. I don't think that we need to do decaying visits
         // here, though we might want to lower the amount of traces that
@@ -235,9 +278,34 @@ namespace Legion {
         bool completed = false;
         // The opidx that this trace was previously visited at.
         uint64_t previous_visited_opidx = 0;
+        // Set for candidates loaded from a previous run through
+        // -lg:auto_trace_file so they are not written out again.
+        bool from_file = false;
       };
       Trie<Murmur3Hasher::Hash, TraceCandidate> trie;
+    private:
+      // Persistence of learned traces across runs: traces committed in a
+      // previous run are loaded from the -lg:auto_trace_file file straight
+      // into the trace cache so their first occurrence in this run can be
+      // replayed, and traces committed during this run are appended to the
+      // same file when the context is torn down
+      void load_traces(const std::string &filename);
+      void dump_traces(const std::string &filename);
+      void dump_node(FILE *file,
+          TrieNode<Murmur3Hasher::Hash,TraceCandidate> *node,
+          std::vector<Murmur3Hasher::Hash> &prefix);
       const uint64_t visit_threshold;
+      // Minimum trace length from the context configuration, used to
+      // scale the visit threshold down for long traces: replaying a long
+      // trace amortizes the per-operation pipeline overhead over more
+      // operations so it does not need as many visits to prove itself
+      const uint64_t min_trace_length;
+      // Structural hashes of candidates that have already been committed
+      // to the trace cache. A candidate whose structural hash appears in
+      // this set is isomorphic to a committed trace and has already
+      // demonstrated its worth, so it is committed on its first visit
+      // instead of waiting to reach the visit threshold itself.
+      std::unordered_set<Murmur3Hasher::Hash> committed_structures;
     private:
       // TriePointer maintains an active trace being
       // traversed in the watcher's trie.
@@ -273,8 +341,10 @@ namespace Legion {
       };
       struct FindRepeatsResult {
         std::vector<Murmur3Hasher::Hash> hashes; // only for storage
+        std::vector<Murmur3Hasher::Hash> structural_hashes; // only for storage
         std::vector<NonOverlappingRepeatsResult> result;
         Murmur3Hasher::Hash *start;
+        Murmur3Hasher::Hash *structural_start;
         size_t size;
         uint64_t opidx;
         RtEvent finish_event;
@@ -295,15 +365,16 @@ namespace Legion {
       TraceRecognizer(InnerContext *context,
           const Mapper::ContextConfigOutput &config);
     public:
-      bool record_operation_hash(Operation *op, 
-          Murmur3Hasher &hasher, uint64_t opidx);
+      bool record_operation_hash(Operation *op,
+          TraceHasher &hasher, uint64_t opidx);
       bool record_operation_noop(Operation *op);
       bool record_operation_untraceable(uint64_t opidx);
       static void find_repeats(const void *args);
     private:
       bool check_for_repeats(uint64_t opidx);
       void update_watcher(uint64_t opidx);
-      void add_trace(const Murmur3Hasher::Hash *hashes, 
+      void add_trace(const Murmur3Hasher::Hash *hashes,
+                     const Murmur3Hasher::Hash *structural,
                      uint64_t size, uint64_t opidx);
       void compute_suffix_array(const Murmur3Hasher::Hash *hashes, size_t size,
                                 std::vector<size_t> &sarray,
@@ -331,7 +402,11 @@ namespace Legion {
       static constexpr Murmur3Hasher::Hash SENTINEL = {};
     private:
       OccurrenceWatcher watcher;
-      std::vector<Murmur3Hasher::Hash> hashes; 
+      std::vector<Murmur3Hasher::Hash> hashes;
+      // Structural hashes for the same operations as 'hashes', kept in
+      // lockstep so that repeats found in the concrete stream can be
+      // structurally hashed as well
+      std::vector<Murmur3Hasher::Hash> structural_hashes;
       std::deque<FindRepeatsResult> repeat_results;
       // unique_hash_value maintains a counter of non-traceable operations
       // seen so far, used to generate unique hashes for those operations.
@@ -3696,6 +3696,29 @@ legion_task_launcher_execute_outputs(legion_runtime_t runtime_,
     return CObjectWrapper::wrap(new Future(f));
 }
 
+void
+legion_task_launcher_execute_batch(legion_runtime_t runtime_,
+                                   legion_context_t ctx_,
+                                   legion_task_launcher_t *launchers_,
+                                   size_t num_launchers,
+                                   legion_future_t *futures_ /* = NULL */)
+{
+  Runtime *runtime = CObjectWrapper::unwrap(runtime_);
+  Context ctx = CObjectWrapper::unwrap(ctx_)->context();
+
+  for (size_t idx = 0; idx < num_launchers; ++idx)
+  {
+    TaskLauncher *launcher = CObjectWrapper::unwrap(launchers_[idx]);
+    Future f = runtime->execute_task(ctx, *launcher);
+    if (futures_ == NULL)
+      continue;
+    if (launcher->elide_future_return)
+      futures_[idx].impl = nullptr;
+    else
+      futures_[idx] = CObjectWrapper::wrap(new Future(f));
+  }
+}
+
 unsigned
 legion_task_launcher_add_region_requirement_logical_region(
   legion_task_launcher_t launcher_,
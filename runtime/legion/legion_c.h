@@ -2978,6 +2978,25 @@ extern "C" {
                                        legion_output_requirement_t *reqs,
                                        size_t reqs_size);
 
+  /**
+   * Execute a batch of task launchers with a single call, amortizing
+   * the per-call overhead of foreign function interfaces across the
+   * whole batch. Launchers are executed in array order. If `futures`
+   * is non-NULL it must have room for `num_launchers` entries; the
+   * future for each launch is stored in the corresponding entry (with
+   * a NULL impl for launchers that elide their future return) and the
+   * caller takes ownership of the stored futures. If `futures` is
+   * NULL all futures are discarded.
+   *
+   * @see Legion::Runtime::execute_task()
+   */
+  void
+  legion_task_launcher_execute_batch(legion_runtime_t runtime,
+                                     legion_context_t ctx,
+                                     legion_task_launcher_t *launchers,
+                                     size_t num_launchers,
+                                     legion_future_t *futures /* = NULL */);
+
   /**
    * @see Legion::TaskLauncher::add_region_requirement()
    */
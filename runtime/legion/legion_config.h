@@ -32,6 +32,18 @@
 #define __CUDA_HD__
 #endif
 
+// Define a macro for restrict-qualifying pointers returned by accessors
+// so that compilers can assume they do not alias other pointers
+#ifndef LEGION_RESTRICT
+#if defined (__GNUC__) || defined (__clang__)
+#define LEGION_RESTRICT __restrict__
+#elif defined (_MSC_VER)
+#define LEGION_RESTRICT __restrict
+#else
+#define LEGION_RESTRICT
+#endif
+#endif
+
 /**
  * \file legion_config.h
  */
@@ -373,6 +385,13 @@
 #define LEGION_DEFAULT_MAX_MESSAGE_SIZE        (DEFAULT_MAX_MESSAGE_SIZE)
 #endif
 #endif
+// The maximum number of remote nodes that a single node will send
+// the slices of an index space task launch to directly before it
+// switches to relaying them through intermediate nodes so that the
+// fan-out at any one node stays bounded
+#ifndef LEGION_DEFAULT_MAX_SLICE_FANOUT
+#define LEGION_DEFAULT_MAX_SLICE_FANOUT        64
+#endif
 // Number of events to place in each GC epoch
 // Large counts improve efficiency but add latency to
 // garbage collection.  Smaller count reduce efficiency
@@ -425,6 +444,13 @@
 #define LEGION_MAX_RECYCLABLE_OBJECTS      1024
 #endif
 
+// The maximum number of operations of each of the most common
+// kinds that a thread will cache locally for recycling before
+// returning a batch of them to the shared free lists.
+#ifndef LEGION_LOCAL_OP_CACHE_SIZE
+#define LEGION_LOCAL_OP_CACHE_SIZE           16
+#endif
+
 // An initial seed for random numbers
 // generated by the high-level runtime.
 #ifndef LEGION_INIT_SEED
@@ -1454,7 +1454,7 @@ namespace Legion {
         next_created_index(reqs.size()), context_configuration(config),
         parent_req_indexes(parent_indexes), virtual_mapped(virt_mapped), 
         total_children_count(0), next_blocking_index(0),
-        outstanding_prepipeline_tasks(0),
+        outstanding_prepipeline_tasks(0), outstanding_allocation_bytes(0),
         enqueue_task_comp_queue(CompletionQueue::NO_QUEUE),
         trigger_execution_comp_queue(CompletionQueue::NO_QUEUE),
         deferred_execution_comp_queue(CompletionQueue::NO_QUEUE),
@@ -3018,6 +3018,13 @@ namespace Legion {
                         LocalLock *&tree_lock, bool return_null_if_doesnt_exist)
     //--------------------------------------------------------------------------
     {
+      // Check the lock-striped cache first so the common case of repeated
+      // lookups for the same requirement (e.g. the points of an index space
+      // task launch) does not need to contend on the privilege lock
+      EqKDTree *cached =
+        find_cached_equivalence_set_kd_tree(req_index, tree_lock);
+      if (cached != NULL)
+        return cached;
       // Use the privilege lock since we also need to access the created
       // requirements data structure as well in this routine
       RtEvent wait_on;
@@ -3035,6 +3042,8 @@ namespace Legion {
           if (finder != equivalence_set_trees.end())
           {
             tree_lock = finder->second.lock;
+            cache_equivalence_set_kd_tree(req_index,
+                finder->second.tree, tree_lock);
             return finder->second.tree;
           }
           else if (return_null_if_doesnt_exist)
@@ -3063,6 +3072,8 @@ namespace Legion {
           if (finder != equivalence_set_trees.end())
           {
             tree_lock = finder->second.lock;
+            cache_equivalence_set_kd_tree(req_index,
+                finder->second.tree, tree_lock);
             return finder->second.tree;
           }
           // save a guard that we're making this
@@ -3094,6 +3105,7 @@ namespace Legion {
         if (finder->second.exists())
           Runtime::trigger_event(finder->second);
         pending_equivalence_set_trees.erase(finder);
+        cache_equivalence_set_kd_tree(req_index, tree, tree_lock);
         return tree;
       }
       else
@@ -3106,9 +3118,49 @@ namespace Legion {
         assert(finder != equivalence_set_trees.end());
 #endif
         tree_lock = finder->second.lock;
+        cache_equivalence_set_kd_tree(req_index,
+            finder->second.tree, tree_lock);
         return finder->second.tree;
       }
-    } 
+    }
+
+    //--------------------------------------------------------------------------
+    EqKDTree* InnerContext::find_cached_equivalence_set_kd_tree(
+                                 unsigned req_index, LocalLock *&tree_lock) const
+    //--------------------------------------------------------------------------
+    {
+      const EqKDTreeCacheStripe &stripe =
+        equivalence_set_tree_cache[req_index % EQ_KD_TREE_CACHE_STRIPES];
+      AutoLock s_lock(stripe.stripe_lock,1,false/*exclusive*/);
+      std::map<unsigned,std::pair<EqKDTree*,LocalLock*> >::const_iterator
+        finder = stripe.trees.find(req_index);
+      if (finder == stripe.trees.end())
+        return NULL;
+      tree_lock = finder->second.second;
+      return finder->second.first;
+    }
+
+    //--------------------------------------------------------------------------
+    void InnerContext::cache_equivalence_set_kd_tree(unsigned req_index,
+                                          EqKDTree *tree, LocalLock *tree_lock)
+    //--------------------------------------------------------------------------
+    {
+      EqKDTreeCacheStripe &stripe =
+        equivalence_set_tree_cache[req_index % EQ_KD_TREE_CACHE_STRIPES];
+      AutoLock s_lock(stripe.stripe_lock);
+      stripe.trees[req_index] = std::make_pair(tree, tree_lock);
+    }
+
+    //--------------------------------------------------------------------------
+    void InnerContext::invalidate_equivalence_set_kd_tree_cache(
+                                                             unsigned req_index)
+    //--------------------------------------------------------------------------
+    {
+      EqKDTreeCacheStripe &stripe =
+        equivalence_set_tree_cache[req_index % EQ_KD_TREE_CACHE_STRIPES];
+      AutoLock s_lock(stripe.stripe_lock);
+      stripe.trees.erase(req_index);
+    }
 
     //--------------------------------------------------------------------------
     EqKDTree* InnerContext::find_or_create_output_set_kd_tree(
@@ -8143,6 +8195,62 @@ namespace Legion {
       insert_unordered_ops(d_lock);
     }
 
+    //--------------------------------------------------------------------------
+    void InnerContext::prefetch_region(LogicalRegion handle,
+                                       const std::set<FieldID> &fields)
+    //--------------------------------------------------------------------------
+    {
+      AutoRuntimeCall call(this);
+      // This is purely an advisory call so we just look for a parent region
+      // requirement that dominates the handle and warm up its equivalence
+      // set tree off the critical path; if we can't find one then the hint
+      // is silently ignored which is always safe
+      for (unsigned idx = 0; idx < regions.size(); idx++)
+      {
+        const RegionRequirement &our_req = regions[idx];
+        if (our_req.region.get_tree_id() != handle.get_tree_id())
+          continue;
+        if (!runtime->forest->is_subregion(handle, our_req.region))
+          continue;
+        if (!fields.empty())
+        {
+          bool overlaps = false;
+          for (std::set<FieldID>::const_iterator it =
+                fields.begin(); it != fields.end(); it++)
+          {
+            if (our_req.privilege_fields.find(*it) ==
+                our_req.privilege_fields.end())
+              continue;
+            overlaps = true;
+            break;
+          }
+          if (!overlaps)
+            continue;
+        }
+        // If the tree already exists there is nothing to warm up
+        LocalLock *tree_lock = NULL;
+        if (find_cached_equivalence_set_kd_tree(idx, tree_lock) != NULL)
+          continue;
+        // Defer the actual construction to a meta-task so the application
+        // thread never pays for building the tree
+        add_base_gc_ref(META_TASK_REF);
+        PrefetchEqSetTreeArgs args(this, idx);
+        runtime->issue_runtime_meta_task(args, LG_THROUGHPUT_WORK_PRIORITY);
+      }
+    }
+
+    //--------------------------------------------------------------------------
+    /*static*/ void InnerContext::handle_prefetch_equivalence_set_tree(
+                                                               const void *args)
+    //--------------------------------------------------------------------------
+    {
+      const PrefetchEqSetTreeArgs *pargs = (const PrefetchEqSetTreeArgs*)args;
+      LocalLock *tree_lock = NULL;
+      pargs->context->find_equivalence_set_kd_tree(pargs->req_index, tree_lock);
+      if (pargs->context->remove_base_gc_ref(META_TASK_REF))
+        delete pargs->context;
+    }
+
     //--------------------------------------------------------------------------
     FutureMap InnerContext::execute_must_epoch(
                                               const MustEpochLauncher &launcher)
@@ -8241,7 +8349,35 @@ namespace Legion {
       Future f = fence_op->initialize(this, FenceOp::EXECUTION_FENCE,
                                       true/*return future*/, provenance);
       add_to_dependence_queue(fence_op);
-      return f; 
+      return f;
+    }
+
+    //--------------------------------------------------------------------------
+    unsigned long long InnerContext::get_field_write_count(
+                                          LogicalRegion handle, FieldID fid) const
+    //--------------------------------------------------------------------------
+    {
+      const std::pair<RegionTreeID,FieldID> key(handle.get_tree_id(), fid);
+      AutoLock fw_lock(field_write_lock,1,false/*exclusive*/);
+      std::map<std::pair<RegionTreeID,FieldID>,unsigned long long>::
+        const_iterator finder = field_write_counts.find(key);
+      if (finder == field_write_counts.end())
+        return 0;
+      return finder->second;
+    }
+
+    //--------------------------------------------------------------------------
+    void InnerContext::record_field_writes(const RegionRequirement &req)
+    //--------------------------------------------------------------------------
+    {
+      const RegionTreeID tid =
+        (req.handle_type == LEGION_PARTITION_PROJECTION) ?
+          req.partition.get_tree_id() : req.region.get_tree_id();
+      AutoLock fw_lock(field_write_lock);
+      for (std::set<FieldID>::const_iterator it =
+            req.privilege_fields.begin(); it !=
+            req.privilege_fields.end(); it++)
+        field_write_counts[std::pair<RegionTreeID,FieldID>(tid, *it)]++;
     }
 
     //--------------------------------------------------------------------------
@@ -8732,6 +8868,19 @@ namespace Legion {
       bool issue_task = false;
       {
         AutoLock r_lock(ready_lock);
+        // In streaming mode apply backpressure before this operation can
+        // map if the children mapped ahead of it are already holding more
+        // instance bytes than the mapper's watermark allows; note we also
+        // stay queued behind any already-throttled operations to keep the
+        // mapping order the same as the program order
+        if ((context_configuration.max_outstanding_allocation_bytes > 0) &&
+            ((outstanding_allocation_bytes >=
+              context_configuration.max_outstanding_allocation_bytes) ||
+             !allocation_throttled_ops.empty()))
+        {
+          allocation_throttled_ops.push_back(op);
+          return;
+        }
         issue_task = ready_queue.empty();
         ready_queue.push_back(op);
       }
@@ -10413,14 +10562,68 @@ namespace Legion {
     }
 
     //--------------------------------------------------------------------------
-    void InnerContext::decrement_pending(TaskOp *child)
+    void InnerContext::decrement_pending(SingleTask *child)
     //--------------------------------------------------------------------------
     {
+      // Release any instance bytes the child was charged when it mapped
+      release_mapped_allocation(child->get_mapped_allocation_bytes());
       // Don't need to do this if we are scheduled by frames
       if (context_configuration.min_tasks_to_schedule > 0)
         decrement_pending(true/*need deferral*/);
     }
 
+    //--------------------------------------------------------------------------
+    void InnerContext::record_mapped_allocation(size_t bytes)
+    //--------------------------------------------------------------------------
+    {
+      if ((context_configuration.max_outstanding_allocation_bytes == 0) ||
+          (bytes == 0))
+        return;
+      AutoLock r_lock(ready_lock);
+      outstanding_allocation_bytes += bytes;
+    }
+
+    //--------------------------------------------------------------------------
+    void InnerContext::release_mapped_allocation(size_t bytes)
+    //--------------------------------------------------------------------------
+    {
+      if ((context_configuration.max_outstanding_allocation_bytes == 0) ||
+          (bytes == 0))
+        return;
+      Operation *first_op = NULL;
+      bool issue_task = false;
+      {
+        AutoLock r_lock(ready_lock);
+#ifdef DEBUG_LEGION
+        assert(outstanding_allocation_bytes >= bytes);
+#endif
+        outstanding_allocation_bytes -= bytes;
+        if (allocation_throttled_ops.empty())
+          return;
+        // Apply the same hysteresis as the task window so throttled
+        // operations are not released until we are comfortably below
+        // the watermark
+        const size_t low_watermark =
+          ((100 - context_configuration.hysteresis_percentage) *
+           context_configuration.max_outstanding_allocation_bytes) / 100;
+        if (outstanding_allocation_bytes > low_watermark)
+          return;
+        issue_task = ready_queue.empty();
+        first_op = allocation_throttled_ops.front();
+        while (!allocation_throttled_ops.empty())
+        {
+          ready_queue.push_back(allocation_throttled_ops.front());
+          allocation_throttled_ops.pop_front();
+        }
+      }
+      if (issue_task)
+      {
+        add_base_resource_ref(META_TASK_REF);
+        TriggerReadyArgs args(first_op, this);
+        runtime->issue_runtime_meta_task(args, LG_THROUGHPUT_WORK_PRIORITY);
+      }
+    }
+
     //--------------------------------------------------------------------------
     void InnerContext::decrement_pending(bool need_deferral)
     //--------------------------------------------------------------------------
@@ -10956,10 +11159,11 @@ namespace Legion {
             finder->second.tree, finder->second.lock,
             close_mask, applied_events, false/*move to previous*/);
         equivalence_set_trees.erase(finder);
+        invalidate_equivalence_set_kd_tree_cache(idx);
         if (!applied_events.empty())
           applied.insert(applied_events.begin(), applied_events.end());
       }
-      // Also tell any traces to invalidate their references to the 
+      // Also tell any traces to invalidate their references to the
       // equivalence set tree data structures
       for (std::map<TraceID,LogicalTrace*>::const_iterator it =
             traces.begin(); it != traces.end(); it++)
@@ -10998,6 +11202,7 @@ namespace Legion {
           finder->second.tree->add_reference();
           return_regions[node] = finder->second.tree;
           equivalence_set_trees.erase(finder);
+          invalidate_equivalence_set_kd_tree_cache(it->first);
         }
         else
         {
@@ -11012,6 +11217,7 @@ namespace Legion {
             finder->second.tree, finder->second.lock,
             close_mask, applied_events, false/*move to previous*/);
           equivalence_set_trees.erase(finder);
+          invalidate_equivalence_set_kd_tree_cache(it->first);
           if (!applied_events.empty())
             applied.insert(applied_events.begin(), applied_events.end());
         }
@@ -11119,6 +11325,7 @@ namespace Legion {
         // equivalence set trees data structure resizes
         AutoLock priv_lock(privilege_lock);
         equivalence_set_trees.erase(req_index);
+        invalidate_equivalence_set_kd_tree_cache(req_index);
         // Also need to remove the returnable privileges information
         // and any created region requirements
         returnable_privileges.erase(req_index);
@@ -12875,7 +13082,9 @@ namespace Legion {
         next_logical_collective_index(1), next_physical_template_index(0), 
         next_replicate_bar_index(0), next_logical_bar_index(0),
         unordered_ops_counter(0), unordered_ops_epoch(MIN_UNORDERED_OPS_EPOCH),
-        unordered_collective(NULL), minimize_repeats_collective(NULL)
+        unordered_collective(NULL), deferred_verification_hasher(NULL),
+        deferred_verification_epoch(0), deferred_verification_calls(0),
+        minimize_repeats_collective(NULL)
     //--------------------------------------------------------------------------
     {
 #ifdef DEBUG_LEGION_COLLECTIVES
@@ -12917,6 +13126,8 @@ namespace Legion {
         minimize_repeats_collective->wait_all_reduce();
         delete minimize_repeats_collective;
       }
+      if (deferred_verification_hasher != NULL)
+        delete deferred_verification_hasher;
     }
 
     //--------------------------------------------------------------------------
@@ -13943,6 +14154,17 @@ namespace Legion {
         const char *description, Provenance *provenance, bool verify_every_call)
     //--------------------------------------------------------------------------
     {
+      if (runtime->defer_control_replication && !verify_every_call)
+      {
+        // In deferred mode we just fold this hash into the running hash
+        // for the current epoch and save the collective comparison for
+        // the next epoch boundary, see verify_deferred_hashes
+        if (deferred_verification_hasher == NULL)
+          deferred_verification_hasher = new Murmur3Hasher();
+        deferred_verification_hasher->hash(hash, 2 * sizeof(uint64_t));
+        deferred_verification_calls++;
+        return true;
+      }
       VerifyReplicableExchange exchange(COLLECTIVE_LOC_82, this);
       const VerifyReplicableExchange::ShardHashes &hashes =
         exchange.exchange(hash);
@@ -13978,6 +14200,41 @@ namespace Legion {
       return false;
     }
 
+    //--------------------------------------------------------------------------
+    void ReplicateContext::verify_deferred_hashes(const char *description)
+    //--------------------------------------------------------------------------
+    {
+      if (!runtime->defer_control_replication)
+        return;
+      // Always do the exchange even if we didn't record any calls this
+      // epoch since a divergent shard might have recorded some and we
+      // need all the shards to participate in the same collectives
+      uint64_t hash[2];
+      if (deferred_verification_hasher != NULL)
+      {
+        deferred_verification_hasher->finalize(hash);
+        delete deferred_verification_hasher;
+        deferred_verification_hasher = NULL;
+      }
+      else
+        hash[0] = hash[1] = 0;
+      VerifyReplicableExchange exchange(COLLECTIVE_LOC_82, this);
+      const VerifyReplicableExchange::ShardHashes &hashes =
+        exchange.exchange(hash);
+      if (hashes.size() > 1)
+        REPORT_LEGION_ERROR(ERROR_CONTROL_REPLICATION_VIOLATION,
+            "Detected control replication violation in task %s (UID %lld) "
+            "on shard %d: the summary hash of the %lld runtime API calls "
+            "performed during epoch %lld (ending at %s) differs between "
+            "the shards. Re-run with -lg:safe_ctrlrepl 1 to pinpoint the "
+            "exact call and argument that diverged.", get_task_name(),
+            get_unique_id(), owner_shard->shard_id,
+            (long long)deferred_verification_calls,
+            (long long)deferred_verification_epoch, description)
+      deferred_verification_calls = 0;
+      deferred_verification_epoch++;
+    }
+
     //--------------------------------------------------------------------------
     EquivalenceSet* ReplicateContext::create_initial_equivalence_set(
                                      unsigned idx, const RegionRequirement &req)
@@ -20110,6 +20367,7 @@ namespace Legion {
         if (hasher.verify(__func__))
           break;
       }
+      verify_deferred_hashes(__func__);
 #ifdef DEBUG_LEGION
       if (owner_shard->shard_id == 0)
         log_run.debug("Issuing an execution fence in task %s (ID %lld)",
@@ -20149,6 +20407,7 @@ namespace Legion {
         if (hasher.verify(__func__))
           break;
       }
+      verify_deferred_hashes(__func__);
       if (runtime->no_tracing) return;
       if (runtime->no_physical_tracing) logical_only = true;
 #ifdef DEBUG_LEGION
@@ -20233,6 +20492,7 @@ namespace Legion {
         if (hasher.verify(__func__))
           break;
       }
+      verify_deferred_hashes(__func__);
       InnerContext::end_trace(tid, deprecated, provenance);
     }
 
@@ -20292,6 +20552,7 @@ namespace Legion {
         if (hasher.verify(__func__))
           break;
       }
+      verify_deferred_hashes(__func__);
       InnerContext::end_task(res, res_size, owned, deferred_result_instance,
            callback_functor,resource,freefunc,metadataptr,metadatasize,effects);
     }
@@ -20553,12 +20814,12 @@ namespace Legion {
           // Iterate all the points in the launch space and compute their
           // shards and record them in the shard users
           ProjectionRegion *projection = result->as_region_projection();
-          for (Domain::DomainPointIterator itr(launch_domain); itr; itr++)
-          {
-            const ShardID shard =
-              proj_info.sharding_function->find_owner(*itr, shard_domain);
-            projection->add_user(shard);
-          }
+          const std::vector<ShardID> &assignments =
+            proj_info.sharding_function->find_shard_assignments(
+                                              launch_domain, shard_domain);
+          for (std::vector<ShardID>::const_iterator it =
+                assignments.begin(); it != assignments.end(); it++)
+            projection->add_user(*it);
           return new ProjectionSummary(proj_info, result, op, index, req, 
               state, true/*disjoint*/, false/*unique*/);
         }
@@ -20570,10 +20831,13 @@ namespace Legion {
             state->owner->as_partition_node()->row_source;
           IndexSpaceNode *color_space = partition->color_space;
           ProjectionPartition *projection = result->as_partition_projection();
+          const std::vector<ShardID> &assignments =
+            proj_info.sharding_function->find_shard_assignments(
+                                              launch_domain, shard_domain);
+          unsigned point_index = 0;
           for (Domain::DomainPointIterator itr(launch_domain); itr; itr++)
           {
-            const ShardID shard =
-              proj_info.sharding_function->find_owner(*itr, shard_domain);
+            const ShardID shard = assignments[point_index++];
             if (shard == local_shard)
               continue;
             const LegionColor color = color_space->linearize_color(*itr);
@@ -25520,6 +25784,15 @@ namespace Legion {
       return Future();
     }
 
+    //--------------------------------------------------------------------------
+    unsigned long long LeafContext::get_field_write_count(
+                                          LogicalRegion handle, FieldID fid) const
+    //--------------------------------------------------------------------------
+    {
+      // Leaf tasks don't launch any operations so there are no writes
+      return 0;
+    }
+
     //--------------------------------------------------------------------------
     void LeafContext::complete_frame(Provenance *provenance)
     //--------------------------------------------------------------------------
@@ -495,6 +495,11 @@ namespace Legion {
                                     const bool flush, const bool unordered,
                                     Provenance *provenance) = 0;
       virtual void progress_unordered_operations(bool end_task = false) = 0;
+      // Advisory prefetch of the versioning metadata for a subregion that
+      // upcoming operations are expected to access; contexts that do not
+      // support the hint simply ignore it
+      virtual void prefetch_region(LogicalRegion handle,
+                                   const std::set<FieldID> &fields) { }
       virtual FutureMap execute_must_epoch(
                                  const MustEpochLauncher &launcher) = 0;
       virtual Future issue_timing_measurement(
@@ -502,6 +507,8 @@ namespace Legion {
       virtual Future select_tunable_value(const TunableLauncher &launcher) = 0;
       virtual Future issue_mapping_fence(Provenance *provenance) = 0;
       virtual Future issue_execution_fence(Provenance *provenance) = 0;
+      virtual unsigned long long get_field_write_count(LogicalRegion handle,
+                                                       FieldID fid) const = 0;
       virtual void complete_frame(Provenance *provenance) = 0;
       virtual Predicate create_predicate(const Future &f,
                                          Provenance *provenance) = 0;
@@ -895,6 +902,17 @@ namespace Legion {
         const PartitionKind kind;
         const char *const func;
       };
+      struct PrefetchEqSetTreeArgs : public LgTaskArgs<PrefetchEqSetTreeArgs> {
+      public:
+        static const LgTaskID TASK_ID = LG_PREFETCH_EQ_SET_TREE_TASK_ID;
+      public:
+        PrefetchEqSetTreeArgs(InnerContext *ctx, unsigned index)
+          : LgTaskArgs<PrefetchEqSetTreeArgs>(ctx->get_unique_id()),
+            context(ctx), req_index(index) { }
+      public:
+        InnerContext *const context;
+        const unsigned req_index;
+      };
       template<typename T>
       struct QueueEntry {
       public:
@@ -1117,6 +1135,11 @@ namespace Legion {
                       EquivalenceSet *set, const FieldMask &mask);
       EqKDTree* find_equivalence_set_kd_tree(unsigned req_index,
           LocalLock *&tree_lock, bool return_null_if_doesnt_exist = false);
+      EqKDTree* find_cached_equivalence_set_kd_tree(unsigned req_index,
+          LocalLock *&tree_lock) const;
+      void cache_equivalence_set_kd_tree(unsigned req_index,
+          EqKDTree *tree, LocalLock *tree_lock);
+      void invalidate_equivalence_set_kd_tree_cache(unsigned req_index);
       EqKDTree* find_or_create_output_set_kd_tree(unsigned req_index,
                                                   LocalLock *&tree_lock);
       void finalize_output_eqkd_tree(unsigned req_index);
@@ -1516,11 +1539,16 @@ namespace Legion {
                                       const bool flush, const bool unordered,
                                       Provenance *provenance);
       virtual void progress_unordered_operations(bool end_task = false);
+      virtual void prefetch_region(LogicalRegion handle,
+                                   const std::set<FieldID> &fields);
       virtual FutureMap execute_must_epoch(const MustEpochLauncher &launcher);
       virtual Future issue_timing_measurement(const TimingLauncher &launcher);
       virtual Future select_tunable_value(const TunableLauncher &launcher);
       virtual Future issue_mapping_fence(Provenance *provenance);
       virtual Future issue_execution_fence(Provenance *provenance);
+      virtual unsigned long long get_field_write_count(LogicalRegion handle,
+                                                       FieldID fid) const;
+      void record_field_writes(const RegionRequirement &req);
       virtual void complete_frame(Provenance *provenance);
       virtual Predicate create_predicate(const Future &f,
                                          Provenance *provenance);
@@ -1622,8 +1650,14 @@ namespace Legion {
       void increment_outstanding(void);
       void decrement_outstanding(void);
       void increment_pending(void);
-      void decrement_pending(TaskOp *child);
+      void decrement_pending(SingleTask *child);
       void decrement_pending(bool need_deferral);
+      // Streaming-mode accounting of instance bytes held by children
+      // that have mapped but not yet begun executing
+      inline size_t get_max_outstanding_allocation_bytes(void) const
+        { return context_configuration.max_outstanding_allocation_bytes; }
+      void record_mapped_allocation(size_t bytes);
+      void release_mapped_allocation(size_t bytes);
       void increment_frame(void);
       void decrement_frame(void);
       void finish_frame(FrameOp *frame);
@@ -1784,6 +1818,7 @@ namespace Legion {
       static void handle_deferred_completion_queue(const void *args);
       static void handle_trigger_commit_queue(const void *args);
       static void handle_deferred_commit_queue(const void *args);
+      static void handle_prefetch_equivalence_set_tree(const void *args);
     public:
       void send_context(AddressSpaceID source);
     public:
@@ -1872,7 +1907,14 @@ namespace Legion {
       // Number of outstanding deletions using this created requirement
       // The last one to send the count to zero actually gets to delete
       // the requirement and the logical region
-      std::map<unsigned,unsigned>               deletion_counts; 
+      std::map<unsigned,unsigned>               deletion_counts;
+    protected:
+      // Counts of operations with write or reduce privileges analyzed
+      // against each field of each region tree, sampled by applications
+      // performing incremental checkpointing
+      mutable LocalLock                         field_write_lock;
+      std::map<std::pair<RegionTreeID,FieldID>,
+               unsigned long long>              field_write_counts;
     protected:
       // Equivalence set trees are used for finding the equivalence sets
       // for a given parent region requirement. Note that each of these
@@ -1896,6 +1938,20 @@ namespace Legion {
       std::map<unsigned,EqKDRoot>                       equivalence_set_trees;
       // Pending computations for equivalence set trees
       std::map<unsigned,RtUserEvent>            pending_equivalence_set_trees;
+      // A lock-striped cache of the roots in equivalence_set_trees so that
+      // the versioning analysis hot path can resolve the tree for a region
+      // requirement without contending on the privilege lock, which is
+      // otherwise a serialization point for wide index space task launches.
+      // Entries are added lazily after a tree has been recorded in
+      // equivalence_set_trees and must be pruned whenever the corresponding
+      // entry is removed from that data structure.
+      static constexpr unsigned EQ_KD_TREE_CACHE_STRIPES = 16;
+      struct EqKDTreeCacheStripe {
+      public:
+        mutable LocalLock stripe_lock;
+        std::map<unsigned,std::pair<EqKDTree*,LocalLock*> > trees;
+      };
+      EqKDTreeCacheStripe equivalence_set_tree_cache[EQ_KD_TREE_CACHE_STRIPES];
     protected:
       const Mapper::ContextConfigOutput     context_configuration;
       TaskTreeCoordinates                   context_coordinates;
@@ -1945,6 +2001,11 @@ namespace Legion {
     protected: 
       mutable LocalLock                               ready_lock;
       std::deque<Operation*>                          ready_queue;
+      // Bytes of instances held by mapped-but-not-yet-running children,
+      // only maintained when streaming mode is enabled by the mapper
+      size_t                                          outstanding_allocation_bytes;
+      // Operations waiting to map until the bytes drop below the watermark
+      std::deque<Operation*>                          allocation_throttled_ops;
     protected:
       mutable LocalLock                               enqueue_task_lock;
       std::list<QueueEntry<SingleTask*> >             enqueue_task_queue;
@@ -2449,6 +2510,9 @@ namespace Legion {
     public: // HashVerifier method
       bool verify_hash(const uint64_t hash[2],
           const char *description, Provenance *provenance, bool every);
+      // In deferred mode this compares the hash accumulated since the
+      // previous trace/fence/end-task boundary across all the shards
+      void verify_deferred_hashes(const char *description);
     protected:
       void receive_replicate_resources(uint64_t return_index,
               std::map<LogicalRegion,unsigned> &created_regions,
@@ -3370,6 +3434,13 @@ namespace Legion {
       unsigned unordered_ops_counter;
       unsigned unordered_ops_epoch;
       UnorderedExchange *unordered_collective;
+    protected:
+      // State for deferred control replication checking: a running hash
+      // of the API calls made since the last epoch boundary, made lazily
+      // since most contexts will never use it
+      Murmur3Hasher *deferred_verification_hasher;
+      uint64_t deferred_verification_epoch;
+      uint64_t deferred_verification_calls;
     protected:
       // Collective for auto-tracing to determine the number of minimum
       // number of repeat jobs that are ready across all the shards
@@ -3926,6 +3997,8 @@ namespace Legion {
       virtual Future select_tunable_value(const TunableLauncher &launcher);
       virtual Future issue_mapping_fence(Provenance *provenance);
       virtual Future issue_execution_fence(Provenance *provenance);
+      virtual unsigned long long get_field_write_count(LogicalRegion handle,
+                                                       FieldID fid) const;
       virtual void complete_frame(Provenance *provenance);
       virtual Predicate create_predicate(const Future &f,
                                          Provenance *provenance);
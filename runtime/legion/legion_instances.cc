@@ -951,7 +951,8 @@ namespace Legion {
         use_event(Runtime::create_ap_user_event(NULL)),
         instance_ready((k == UNBOUND_INSTANCE_KIND) ? 
             Runtime::create_rt_user_event() : RtUserEvent::NO_RT_USER_EVENT),
-        kind(k), producer_event(p_event), gc_state(init), pending_changes(0),
+        kind(k), producer_event(p_event), gc_state(init),
+        last_collectable_time(0), pending_changes(0),
         failed_collection_count(0), min_gc_priority(0), added_gc_events(0),
         valid_references(0), sent_valid_references(0),
         received_valid_references(0), padded_reservations(NULL)
@@ -1798,6 +1799,10 @@ namespace Legion {
       if (!is_external_instance() || (gc_state != COLLECTED_GC_STATE))
       {
         gc_state = COLLECTABLE_GC_STATE;
+        // Record when this instance went cold so the memory manager can
+        // prefer evicting the longest-idle instances first
+        last_collectable_time.store(
+            Realm::Clock::current_time_in_nanoseconds());
         // If this instance is set to eager collection priority
         // then we try to do that now
         if (min_gc_priority == LEGION_GC_EAGER_PRIORITY)
@@ -3496,7 +3501,11 @@ namespace Legion {
           layout->log_instance_layout(unique_event);
         }
 
-        if (is_owner() && has_remote_instances())
+        // Broadcast the update to any remote copies of this manager,
+        // forwarding along the collective mapping tree if we're part of one
+        if ((is_owner() && has_remote_instances()) ||
+            ((collective_mapping != NULL) &&
+             collective_mapping->contains(local_space)))
           broadcast_manager_update();
 
         Runtime::trigger_event_untraced(
@@ -3517,8 +3526,25 @@ namespace Legion {
         rez.serialize(instance_ready);
         rez.serialize(instance_footprint);
       }
-      BroadcastFunctor functor(context->runtime, rez);
-      map_over_remote_instances(functor);
+      // If we're part of a collective mapping then forward the update
+      // along the broadcast tree to our children so replicated managers
+      // see log(N) fan-out from each node rather than O(N) from the owner
+      if ((collective_mapping != NULL) &&
+          collective_mapping->contains(local_space))
+      {
+        std::vector<AddressSpaceID> children;
+        collective_mapping->get_children(owner_space, local_space, children);
+        for (std::vector<AddressSpaceID>::const_iterator it =
+              children.begin(); it != children.end(); it++)
+          context->runtime->send_manager_update(*it, rez);
+      }
+      // The owner also has to handle any remote copies that were
+      // requested outside of the collective mapping
+      if (is_owner() && has_remote_instances())
+      {
+        BroadcastFunctor functor(context->runtime, rez);
+        map_over_remote_instances(functor);
+      }
     }
 
     //--------------------------------------------------------------------------
@@ -3798,7 +3824,7 @@ namespace Legion {
         creator_id(cid), instance(PhysicalInstance::NO_INST), 
         field_space_node(node), instance_domain(expr), tree_id(tid), 
         redop_id(0), reduction_op(NULL), realm_layout(NULL), piece_list(NULL),
-        piece_list_size(0), valid(true), allocated(false)
+        piece_list_size(0), num_pieces(0), valid(true), allocated(false)
     //--------------------------------------------------------------------------
     {
       if (pl != NULL)
@@ -3820,6 +3846,72 @@ namespace Legion {
         free(piece_list);
     }
 
+    //--------------------------------------------------------------------------
+    bool InstanceBuilder::create_realm_layout(RegionTreeForest *forest,
+                         LayoutConstraintKind *unsat_kind, unsigned *unsat_index)
+    //--------------------------------------------------------------------------
+    {
+      if (!valid)
+        initialize(forest);
+      bool compact = false;
+      const SpecializedConstraint &spec = constraints.specialized_constraint;
+      switch (spec.get_kind())
+      {
+        case LEGION_COMPACT_SPECIALIZE:
+        case LEGION_COMPACT_REDUCTION_SPECIALIZE:
+          {
+            compact = true;
+            break;
+          }
+        default:
+          break;
+      }
+      if (realm_layout == NULL)
+      {
+        const std::vector<FieldID> &field_set =
+          constraints.field_constraint.get_field_set();
+        realm_layout =
+          instance_domain->create_layout(constraints, field_set,
+             field_sizes, compact, &piece_list, &piece_list_size, &num_pieces);
+#ifdef DEBUG_LEGION
+        assert(realm_layout != NULL);
+#endif
+      }
+      // If we were doing a compact layout then Check that we met
+      // the constraints for efficiency and number of pieces
+      if (compact && (spec.max_pieces < num_pieces))
+      {
+        if (unsat_kind != NULL)
+          *unsat_kind = LEGION_SPECIALIZED_CONSTRAINT;
+        if (unsat_index != NULL)
+          *unsat_index = 0;
+        return false;
+      }
+      return true;
+    }
+
+    //--------------------------------------------------------------------------
+    ReductionOpID InstanceBuilder::get_redop(RegionTreeForest *forest)
+    //--------------------------------------------------------------------------
+    {
+      if (!valid)
+        initialize(forest);
+      return redop_id;
+    }
+
+    //--------------------------------------------------------------------------
+    size_t InstanceBuilder::compute_footprint(RegionTreeForest *forest)
+    //--------------------------------------------------------------------------
+    {
+      if (!valid)
+        initialize(forest);
+      if (field_sizes.empty())
+        return 0;
+      if (!create_realm_layout(forest, NULL/*unsat kind*/, NULL/*unsat index*/))
+        return 0;
+      return realm_layout->bytes_used;
+    }
+
     //--------------------------------------------------------------------------
     PhysicalManager* InstanceBuilder::create_physical_instance(
         RegionTreeForest *forest, LayoutConstraintKind *unsat_kind,
@@ -3844,42 +3936,11 @@ namespace Legion {
           *unsat_index = 0;
         return NULL;
       }
-      if (realm_layout == NULL)
+      if (!create_realm_layout(forest, unsat_kind, unsat_index))
       {
-        const std::vector<FieldID> &field_set = 
-          constraints.field_constraint.get_field_set();
-        bool compact = false;
-        const SpecializedConstraint &spec = constraints.specialized_constraint;
-        switch (spec.get_kind())
-        {
-          case LEGION_COMPACT_SPECIALIZE:
-          case LEGION_COMPACT_REDUCTION_SPECIALIZE:
-            {
-              compact = true;
-              break;
-            }
-          default:
-            break;
-        }
-        size_t num_pieces = 0;
-        realm_layout =
-          instance_domain->create_layout(constraints, field_set,
-             field_sizes, compact, &piece_list, &piece_list_size, &num_pieces);
-#ifdef DEBUG_LEGION
-        assert(realm_layout != NULL);
-#endif
-        // If we were doing a compact layout then Check that we met 
-        // the constraints for efficiency and number of pieces
-        if (compact && (spec.max_pieces < num_pieces))
-        {
-          if (unsat_kind != NULL)
-            *unsat_kind = LEGION_SPECIALIZED_CONSTRAINT;
-          if (unsat_index != NULL)
-            *unsat_index = 0;
-          if (footprint != NULL)
-            *footprint = realm_layout->bytes_used;
-          return NULL;
-        }
+        if (footprint != NULL)
+          *footprint = realm_layout->bytes_used;
+        return NULL;
       }
 #ifdef DEBUG_LEGION
       assert(realm_layout != NULL);
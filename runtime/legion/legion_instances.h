@@ -386,6 +386,8 @@ namespace Legion {
     public:
       bool is_collected(void) const;
       bool can_collect(bool &already_collected) const;
+      inline long long get_last_collectable_time(void) const
+        { return last_collectable_time.load(); }
       bool acquire_collect(std::set<ApEvent> &gc_events, 
           uint64_t &sent_valid, uint64_t &received_valid);
       bool collect(RtEvent &collected, PhysicalInstance *hole = NULL,
@@ -528,7 +530,11 @@ namespace Legion {
       std::map<DistributedID,RtUserEvent> pending_views;
     protected:
       // Stuff for garbage collection
-      std::atomic<GarbageCollectionState> gc_state; 
+      std::atomic<GarbageCollectionState> gc_state;
+      // Time at which this instance last transitioned from valid back to
+      // collectable, used by the memory manager to evict colder (longer
+      // idle) instances before warmer ones within a GC priority class
+      std::atomic<long long> last_collectable_time;
       unsigned pending_changes;
       std::atomic<unsigned> failed_collection_count;
       RtEvent collection_ready;
@@ -622,7 +628,7 @@ namespace Legion {
           creator_id(cid), instance(PhysicalInstance::NO_INST), 
           field_space_node(NULL), instance_domain(NULL), tree_id(0),
           redop_id(0), reduction_op(NULL), realm_layout(NULL), piece_list(NULL),
-          piece_list_size(0), valid(false), allocated(false) { }
+          piece_list_size(0), num_pieces(0), valid(false), allocated(false) { }
       InstanceBuilder(const std::vector<LogicalRegion> &regs,
                       IndexSpaceExpression *expr, FieldSpaceNode *node,
                       RegionTreeID tree_id, const LayoutConstraintSet &cons, 
@@ -637,6 +643,9 @@ namespace Legion {
                         RtEvent collection_done = RtEvent::NO_RT_EVENT,
                         PhysicalInstance hole = PhysicalInstance::NO_INST,
                         LgEvent hole_unique = LgEvent::NO_LG_EVENT);
+      // These two initialize the builder as necessary
+      ReductionOpID get_redop(RegionTreeForest *forest);
+      size_t compute_footprint(RegionTreeForest *forest);
     public:
       virtual bool handle_profiling_response(
           const Realm::ProfilingResponse &response, const void *orig, 
@@ -645,6 +654,9 @@ namespace Legion {
       void compute_space_and_domain(RegionTreeForest *forest);
     protected:
       void compute_layout_parameters(void);
+      bool create_realm_layout(RegionTreeForest *forest,
+                               LayoutConstraintKind *unsat_kind,
+                               unsigned *unsat_index);
     protected:
       const std::vector<LogicalRegion> &regions;
       LayoutConstraintSet constraints;
@@ -668,6 +680,7 @@ namespace Legion {
       Realm::InstanceLayoutGeneric *realm_layout;
       void *piece_list;
       size_t piece_list_size;
+      size_t num_pieces;
     public:
       LgEvent caller_fevent;
       LgEvent current_unique_event;
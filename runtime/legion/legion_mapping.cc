@@ -20,6 +20,7 @@
 #include "legion/legion_views.h"
 #include "legion/legion_mapping.h"
 #include "legion/mapper_manager.h"
+#include "legion/legion_context.h"
 #include "legion/legion_instances.h"
 
 namespace Legion {
@@ -1553,6 +1554,46 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    bool MapperRuntime::find_dominant_equivalence_set_owner(MapperContext ctx,
+                                    LogicalRegion handle, AddressSpace &owner) const
+    //--------------------------------------------------------------------------
+    {
+      if (!handle.exists())
+        return false;
+      // Some mapper calls (e.g. handle_message) have no operation and
+      // therefore no context in which to look up versioning information
+      if (ctx->operation == NULL)
+        return false;
+      AutoMapperCall call(ctx, Internal::MAPPER_FIND_DOMINANT_EQ_OWNER_CALL);
+      Internal::InnerContext *context = ctx->operation->get_context();
+      Internal::RegionNode *node = runtime->forest->get_node(handle);
+      Internal::VersionManager &manager =
+        node->get_current_version_manager(context->get_physical_tree_context());
+      return manager.find_dominant_owner(owner);
+    }
+
+    //--------------------------------------------------------------------------
+    bool MapperRuntime::query_memory_pressure(MapperContext ctx,
+                                   Memory target_memory, size_t &capacity_bytes,
+                                   size_t &remaining_bytes,
+                                   size_t &pending_allocations) const
+    //--------------------------------------------------------------------------
+    {
+      if (!target_memory.exists())
+        return false;
+      AutoMapperCall call(ctx, Internal::MAPPER_QUERY_MEMORY_PRESSURE_CALL);
+      Internal::MemoryManager *manager =
+        runtime->find_memory_manager(target_memory);
+      // Only the owner has an accurate view of the allocator state
+      if (!manager->is_owner)
+        return false;
+      capacity_bytes = manager->capacity;
+      remaining_bytes = manager->remaining_capacity.load();
+      pending_allocations = manager->count_pending_allocations();
+      return true;
+    }
+
     //--------------------------------------------------------------------------
     void MapperRuntime::set_garbage_collection_priority(MapperContext ctx,
                      const PhysicalInstance &instance, GCPriority priority) const
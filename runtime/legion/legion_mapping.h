@@ -1671,6 +1671,17 @@ namespace Legion {
        * enough ahead that it can be halted for this context by setting
        * the 'min_tasks_to_schedule' parameter.
        *
+       * In addition to throttling on counts of sub-operations, the mapper
+       * can request a streaming execution mode by setting the
+       * 'max_outstanding_allocation_bytes' parameter to a non-zero value.
+       * In this mode the runtime tracks the total bytes of physical
+       * instances held by sub-tasks that have mapped but not yet begun
+       * executing and stops mapping further sub-operations in this context
+       * once that total exceeds the watermark, resuming (subject to the
+       * same 'hysteresis_percentage') as mapped sub-tasks begin executing.
+       * This applies backpressure before new instances are allocated on
+       * deep pipelines instead of waiting for allocation failures.
+       *
        * The mapper can control the granularity of Legion meta-tasks
        * for this context with the 'meta_task_vector_width' parameter
        * which control how many meta-tasks get batched together for 
@@ -1737,7 +1748,8 @@ namespace Legion {
         unsigned                                hysteresis_percentage; // = 25
         unsigned                                max_outstanding_frames; // = 2
         unsigned                                min_tasks_to_schedule; // = 64
-        unsigned                                min_frames_to_schedule; // = 0 
+        unsigned                                min_frames_to_schedule; // = 0
+        size_t                                  max_outstanding_allocation_bytes; // = 0 (disabled)
         unsigned                                meta_task_vector_width; // = 16
         unsigned                                max_templates_per_trace; // = 16
         bool                                    mutable_priority; // = false
@@ -2321,10 +2333,36 @@ namespace Legion {
                                    MapperContext ctx, Memory target_memory,
                                    LayoutConstraintID layout_id,
                                    const std::vector<LogicalRegion> &regions,
-                                   std::vector<PhysicalInstance> &results, 
+                                   std::vector<PhysicalInstance> &results,
                                    bool acquire = false,
                                    bool tight_region_bounds = false) const;
-      void set_garbage_collection_priority(MapperContext ctx, 
+      // Find the address space that owns the majority of the cached
+      // equivalence set metadata for a logical region in the context of
+      // the operation being mapped. Returns false if the runtime has no
+      // cached versioning information for the region, which happens if
+      // no operation in this context has used it yet. The result is a
+      // placement hint: mappers can target a processor in that address
+      // space in select_task_options (without setting map_locally) so
+      // the mapping of the task and any instance queries it performs
+      // run on the node where the metadata already lives.
+      bool find_dominant_equivalence_set_owner(MapperContext ctx,
+                                   LogicalRegion handle,
+                                   AddressSpace &owner) const;
+      // Query the allocation state of a memory from the runtime's
+      // allocator: the total capacity in bytes, the bytes not currently
+      // assigned to any instance, and the number of allocation requests
+      // queued up waiting for garbage collection to make space. Mappers
+      // can consult this to steer new instances away from memories that
+      // are under pressure rather than discovering fullness when
+      // create_physical_instance fails and retrying. Returns false for
+      // memories whose allocator lives in a remote address space since
+      // those values would already be stale when they arrived; query
+      // the memories local to this node.
+      bool query_memory_pressure(MapperContext ctx, Memory target_memory,
+                                   size_t &capacity_bytes,
+                                   size_t &remaining_bytes,
+                                   size_t &pending_allocations) const;
+      void set_garbage_collection_priority(MapperContext ctx,
                 const PhysicalInstance &instance, GCPriority priority) const;
       // These methods will atomically check to make sure that these instances
       // are still valid and then add an implicit reference to them to ensure
@@ -2380,7 +2418,14 @@ namespace Legion {
       // fits within the footprint of the original instance. The runtime will
       // return a boolean indicating whether the redistricting was successful.
       // If the invocation is successful, the 'instance' will be overwritten
-      // with a handle to the new instance.
+      // with a handle to the new instance. The requirement that the original
+      // instance hold no valid data is fundamental rather than an artifact:
+      // reusing the memory for a different layout while preserving contents
+      // would mean transforming the data in place, and the copy engines
+      // cannot do that since the transform would overwrite source elements
+      // before they are read. To change the layout of live data, copy it to
+      // an instance with the new layout first and redistrict the old one
+      // afterwards for reuse.
       bool redistrict_instance(MapperContext ctx, PhysicalInstance &instance,
                                const LayoutConstraintSet &constraints,
                                const std::vector<LogicalRegion> &regions,
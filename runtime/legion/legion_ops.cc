@@ -1635,9 +1635,14 @@ namespace Legion {
           // Someone else already started, figure out if we need to wait
           if (prepipelined == 1)
           {
+            // The auto-tracer launches the prepipeline stage speculatively
+            // while it buffers operations, so the launch from the
+            // dependence queue can find the stage already in flight; that
+            // caller never waits on the result so just let it go
+            if (!from_logical_analysis)
+              return RtEvent::NO_RT_EVENT;
             // Only partially through so make an event to trigger when done
 #ifdef DEBUG_LEGION
-            assert(from_logical_analysis);
             assert(!prepipelined_event.exists());
 #endif
             prepipelined_event = Runtime::create_rt_user_event();
@@ -1774,32 +1779,35 @@ namespace Legion {
     }
 
     //--------------------------------------------------------------------------
-    /*static*/ void Operation::hash_requirement(Murmur3Hasher &hasher,
+    /*static*/ void Operation::hash_requirement(TraceHasher &hasher,
                                                    const RegionRequirement &req)
     //--------------------------------------------------------------------------
     {
+      // The names of the regions and partitions only go into the concrete
+      // hash so that requirements that differ just in which data they name
+      // still have the same structural hash
       if (req.region.exists()) {
         hasher.hash<bool>(true); // is_reg
-        hasher.hash(req.region.get_index_space().get_id());
-        hasher.hash(req.region.get_field_space().get_id());
-        hasher.hash(req.region.get_tree_id());
+        hasher.hash_concrete(req.region.get_index_space().get_id());
+        hasher.hash_concrete(req.region.get_field_space().get_id());
+        hasher.hash_concrete(req.region.get_tree_id());
       } else {
         hasher.hash<bool>(false); // is_reg
-        hasher.hash(req.partition.get_index_partition().get_id());
-        hasher.hash(req.partition.get_field_space().get_id());
-        hasher.hash(req.partition.get_tree_id());
+        hasher.hash_concrete(req.partition.get_index_partition().get_id());
+        hasher.hash_concrete(req.partition.get_field_space().get_id());
+        hasher.hash_concrete(req.partition.get_tree_id());
       }
       for (std::set<FieldID>::const_iterator it = req.privilege_fields.begin();
            it != req.privilege_fields.end(); it++)
         hasher.hash(*it);
-      for (std::vector<FieldID>::const_iterator it = 
+      for (std::vector<FieldID>::const_iterator it =
             req.instance_fields.begin(); it != req.instance_fields.end(); it++)
         hasher.hash(*it);
       hasher.hash(req.privilege);
       hasher.hash(req.prop);
-      hasher.hash(req.parent.get_index_space().get_id());
-      hasher.hash(req.parent.get_field_space().get_id());
-      hasher.hash(req.parent.get_tree_id());
+      hasher.hash_concrete(req.parent.get_index_space().get_id());
+      hasher.hash_concrete(req.parent.get_field_space().get_id());
+      hasher.hash_concrete(req.parent.get_tree_id());
       hasher.hash(req.redop);
       // Excluding the fields: tag and flags.
       hasher.hash(req.handle_type);
@@ -2072,7 +2080,7 @@ namespace Legion {
         // Notify all our mapping dependences, note we can do this while
         // holding the lock since notifying them doesn't involve taking
         // their locks
-        for (std::map<Operation*,GenerationID>::const_iterator it =
+        for (SmallPointerMap<Operation,GenerationID>::const_iterator it =
               outgoing.begin(); it != outgoing.end(); it++)
           it->first->satisfy_mapping_dependence();
         if (executed)
@@ -2205,7 +2213,7 @@ namespace Legion {
               // notify our upstream operations that they too are hardened
               // but skip any operations that are themselves hardened as
               // they would already be included from the verification users
-              for (std::map<Operation*,GenerationID>::const_iterator it =
+              for (SmallPointerMap<Operation,GenerationID>::const_iterator it =
                     incoming.begin(); it != incoming.end(); it++)
                 if (verification_notifications.find(it->first) ==
                     verification_notifications.end())
@@ -2550,7 +2558,7 @@ namespace Legion {
           //assert(outstanding_mapping_references > 0);
 #endif
           // Check to see if we've already recorded this dependence
-          std::map<Operation*,GenerationID>::const_iterator finder = 
+          SmallPointerMap<Operation,GenerationID>::const_iterator finder =
             outgoing.find(op);
           if ((finder == outgoing.end()) || (finder->second != op_gen))
           {
@@ -2642,7 +2650,7 @@ namespace Legion {
             // If we're hardened we notify all upstream operations that
             // we're officially hardened, if we're not hardened we only
             // notify the upstream ones that are not themselves hardened
-            for (std::map<Operation*,GenerationID>::const_iterator it =
+            for (SmallPointerMap<Operation,GenerationID>::const_iterator it =
                   incoming.begin(); it != incoming.end(); it++)
               if (hardened || (verification_notifications.find(it->first) ==
                   verification_notifications.end()))
@@ -2690,7 +2698,7 @@ namespace Legion {
           // If we're hardened we notify all upstream operations that
           // we're officially hardened, if we're not hardened we only
           // notify the upstream ones that are not themselves hardened
-          for (std::map<Operation*,GenerationID>::const_iterator it =
+          for (SmallPointerMap<Operation,GenerationID>::const_iterator it =
                 incoming.begin(); it != incoming.end(); it++)
             if (hardened || (verification_notifications.find(it->first) ==
                 verification_notifications.end()))
@@ -4298,11 +4306,9 @@ namespace Legion {
         rez.serialize(*it);
       }
       rez.serialize(req.instance_fields.size());
-      for (std::vector<FieldID>::const_iterator it = 
-            req.instance_fields.begin(); it != req.instance_fields.end(); it++)
-      {
-        rez.serialize(*it);
-      }
+      if (!req.instance_fields.empty())
+        rez.serialize(&req.instance_fields.front(),
+            req.instance_fields.size() * sizeof(FieldID));
       rez.serialize(req.privilege);
       rez.serialize(req.prop);
       rez.serialize(req.parent);
@@ -4357,15 +4363,17 @@ namespace Legion {
       {
         FieldID fid;
         derez.deserialize(fid);
-        req.privilege_fields.insert(fid);
+        // Fields were packed in sorted order so hint the insertion
+        // point to avoid rebalancing work on every insert
+        req.privilege_fields.insert(req.privilege_fields.end(), fid);
       }
       size_t num_instance_fields;
       derez.deserialize(num_instance_fields);
-      for (unsigned idx = 0; idx < num_instance_fields; idx++)
+      if (num_instance_fields > 0)
       {
-        FieldID fid;
-        derez.deserialize(fid);
-        req.instance_fields.push_back(fid);
+        req.instance_fields.resize(num_instance_fields);
+        derez.deserialize(&req.instance_fields.front(),
+            num_instance_fields * sizeof(FieldID));
       }
       derez.deserialize(req.privilege);
       derez.deserialize(req.prop);
@@ -4604,6 +4612,25 @@ namespace Legion {
         return (predication_state == PREDICATED_TRUE_STATE);
     }
 
+    //--------------------------------------------------------------------------
+    bool PredicatedOp::check_predicate_resolved_false(void)
+    //--------------------------------------------------------------------------
+    {
+      if ((predication_state != PENDING_PREDICATE_STATE) || (predicate == NULL))
+        return (predication_state == PREDICATED_FALSE_STATE);
+      RtEvent ready;
+      const bool value = predicate->get_predicate(ready);
+      // If the predicate hasn't resolved yet then we'll find out its
+      // value the normal way in trigger_ready
+      if (ready.exists() || value)
+        return false;
+      // Hold the lock while doing this to prevent races on checking
+      // the predication state
+      AutoLock o_lock(op_lock);
+      predication_state = PREDICATED_FALSE_STATE;
+      return true;
+    }
+
     /////////////////////////////////////////////////////////////
     // External Mapping
     /////////////////////////////////////////////////////////////
@@ -4968,16 +4995,13 @@ namespace Legion {
 
       if (!atomic_locks.empty() || !arrive_barriers.empty())
       {
-        // They've already been sorted in order 
-        for (std::map<Reservation,bool>::const_iterator it = 
+        // They've already been sorted in order
+        map_complete_event =
+          Runtime::acquire_ap_reservations(atomic_locks, map_complete_event);
+        // We can also issue the release conditions on our termination
+        for (std::map<Reservation,bool>::const_iterator it =
               atomic_locks.begin(); it != atomic_locks.end(); it++)
-        {
-          map_complete_event = 
-                Runtime::acquire_ap_reservation(it->first, it->second,
-                                                map_complete_event);
-          // We can also issue the release condition on our termination
           Runtime::release_reservation(it->first, termination_event);
-        }
         for (std::vector<PhaseBarrier>::iterator it = 
               arrive_barriers.begin(); it != arrive_barriers.end(); it++)
         {
@@ -7483,7 +7507,7 @@ namespace Legion {
     bool CopyOp::record_trace_hash(TraceRecognizer &recognizer, uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
       for (std::vector<RegionRequirement>::const_iterator it = 
             src_requirements.begin(); it != src_requirements.end(); it++)
@@ -10043,7 +10067,7 @@ namespace Legion {
     bool FenceOp::record_trace_hash(TraceRecognizer &recognizer, uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
       hasher.hash(fence_kind);
       return recognizer.record_operation_hash(this, hasher, opidx);
@@ -10754,10 +10778,14 @@ namespace Legion {
               dependences.begin(); dit != dependences.end(); dit++)
           register_dependence(dit->first, dit->second);
         // We still need to perform the invalidations in this path as well
+        // Note that region deletions filter specific fields too so that we
+        // only invalidate state for the fields of the deleted requirement
+        // and leave any other logical state in the subtree warm
         const ContextID ctx = parent_ctx->get_logical_tree_context();
         for (unsigned idx = 0; idx < deletion_requirements.size(); idx++)
           runtime->forest->invalidate_current_context(ctx,
-              deletion_requirements[idx], (kind == FIELD_DELETION));
+              deletion_requirements[idx], (kind == FIELD_DELETION) ||
+              (kind == LOGICAL_REGION_DELETION));
         return;
       }
       create_deletion_requirements();
@@ -10769,10 +10797,14 @@ namespace Legion {
       analyze_region_requirements();
       // Now we can invalidate the context since all internal operations
       // have been recorded in the tree
+      // Region deletions filter specific fields as well so that logical
+      // state for unrelated fields in the same subtree survives the
+      // deletion and does not need to be re-derived afterwards
       const ContextID ctx = parent_ctx->get_logical_tree_context();
       for (unsigned idx = 0; idx < deletion_requirements.size(); idx++)
         runtime->forest->invalidate_current_context(ctx,
-            deletion_requirements[idx], (kind == FIELD_DELETION));
+            deletion_requirements[idx], (kind == FIELD_DELETION) ||
+            (kind == LOGICAL_REGION_DELETION));
       if (runtime->legion_spy_enabled)
         log_deletion_requirements();
     }
@@ -12490,10 +12522,10 @@ namespace Legion {
                                       uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
-      hasher.hash(logical_region);
-      hasher.hash(parent_region);
+      hasher.hash_concrete(logical_region);
+      hasher.hash_concrete(parent_region);
       for (std::set<FieldID>::const_iterator it = fields.begin();
             it != fields.end(); it++)
         hasher.hash(*it);
@@ -13296,10 +13328,10 @@ namespace Legion {
                                       uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
-      hasher.hash(logical_region);
-      hasher.hash(parent_region);
+      hasher.hash_concrete(logical_region);
+      hasher.hash_concrete(parent_region);
       for (std::set<FieldID>::const_iterator it = fields.begin();
             it != fields.end(); it++)
         hasher.hash(*it);
@@ -13944,6 +13976,14 @@ namespace Legion {
 #endif
       initialize_operation(ctx, provenance);
       future = f;
+      // Predicate futures always contain a single boolean, so record that
+      // bound now: it lets request_runtime_instance allocate the
+      // host-visible instance up front instead of blocking a runtime
+      // meta-task thread until the producer (e.g. a GPU task with its
+      // result in framebuffer memory) finishes and reports its size, and
+      // the device-to-host copy of the value is then issued asynchronously
+      // as soon as the result is ready
+      future.impl->record_upper_bound_size(sizeof(bool));
       predicate = Predicate(ctx->create_predicate_impl(this));
       to_predicate = true;
       if (runtime->legion_spy_enabled)
@@ -18648,14 +18688,14 @@ namespace Legion {
     bool FillOp::record_trace_hash(TraceRecognizer &recognizer, uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
       hash_requirement(hasher, requirement);
       hasher.hash<bool>(is_index_space);
       if (is_index_space)
         hasher.hash(index_domain);
       if (future.exists())
-        hasher.hash(future.impl->did);
+        hasher.hash_concrete(future.impl->did);
       else
         hasher.hash(value, value_size);
       return recognizer.record_operation_hash(this, hasher, opidx);
@@ -22819,6 +22859,7 @@ namespace Legion {
     {
       MemoizableOp::activate();
       redop_id = 0;
+      redop_fold_index = 0;
       future_result_size = 0;
       serdez_redop_buffer = NULL;
       serdez_upper_bound = SIZE_MAX;
@@ -22948,7 +22989,12 @@ namespace Legion {
                                           FutureImpl *future)
     //--------------------------------------------------------------------------
     {
-      const RtEvent ready = future->find_runtime_instance_ready();
+      // Serdez reductions need to wait for their host buffers to be ready
+      // while reduction operators only need the future instances to have
+      // been recorded since the folds take the instance ready events as
+      // preconditions and consume the data wherever it already lives
+      const RtEvent ready = (serdez_redop_fns != NULL) ?
+        future->find_runtime_instance_ready() : future->subscribe();
       if (ready.exists())
         ready_events.push_back(ready);
     }
@@ -22979,7 +23025,7 @@ namespace Legion {
                                         uint64_t opidx)
     //--------------------------------------------------------------------------
     {
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
       return recognizer.record_operation_hash(this, hasher, opidx);
     }
@@ -22989,15 +23035,20 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       // Call from both trigger_mapping and trigger_replay
-      // Request host buffers for any of the source instances
       populate_sources();
-      // Always make sure we'll have buffers ready on the host for us to
-      // access in order to use for doing the all-reduce
-      for (std::map<DomainPoint,FutureImpl*>::const_iterator it =
-            sources.begin(); it != sources.end(); it++)
-        prepare_future(map_applied_conditions, it->second);
-      if (initial_value.impl != NULL)
-        prepare_future(map_applied_conditions, initial_value.impl);
+      // Serdez reductions fold through explicit host buffers so make sure
+      // we'll have buffers ready on the host for us to access. Reduction
+      // operators on the other hand fold directly between future instances
+      // wherever they already live so there is no need to stage the source
+      // values through the host for them.
+      if (serdez_redop_fns != NULL)
+      {
+        for (std::map<DomainPoint,FutureImpl*>::const_iterator it =
+              sources.begin(); it != sources.end(); it++)
+          prepare_future(map_applied_conditions, it->second);
+        if (initial_value.impl != NULL)
+          prepare_future(map_applied_conditions, initial_value.impl);
+      }
       if (future_result_size < SIZE_MAX)
       {
         // We can only make the future results now if we have an actual
@@ -23195,8 +23246,15 @@ namespace Legion {
             FutureInstance::create_local(&redop->identity,
               redop->sizeof_rhs, false/*own*/));
       }
+      // Keep track of where the instance for the mapper's first choice
+      // of memory ends up since that is where reduction folds are applied
       if (runtime_visible > 0)
+      {
         std::swap(targets.front(), targets[runtime_visible]);
+        redop_fold_index = runtime_visible;
+      }
+      else
+        redop_fold_index = 0;
     }
 
     //--------------------------------------------------------------------------
@@ -23216,42 +23274,60 @@ namespace Legion {
     ApEvent AllReduceOp::all_reduce_redop(RtEvent &executed)
     //--------------------------------------------------------------------------
     {
-      std::vector<ApEvent> preconditions(targets.size());
-      for (unsigned idx = 0; idx < targets.size(); idx++)
-        preconditions[idx] = init_redop_target(targets[idx]);
-      std::vector<ApEvent> postconditions;
+#ifdef DEBUG_LEGION
+      assert(!targets.empty());
+      assert(redop_fold_index < targets.size());
+#endif
+      // Fold all the sources into a single target and then copy the final
+      // result out to any of the other targets. The fold target is the
+      // instance in the first memory requested by the mapper so that
+      // device-resident future values can fold directly on the device
+      // using the reduction kernels registered with Realm and only the
+      // final result needs to move to the other memories.
+      FutureInstance *fold_target = targets[redop_fold_index];
+      ApEvent fold_precondition = init_redop_target(fold_target);
       if (deterministic)
       {
         for (std::map<DomainPoint,FutureImpl*>::const_iterator it =
               sources.begin(); it != sources.end(); it++)
         {
-          for (unsigned idx = 0; idx < targets.size(); idx++)
-            preconditions[idx] = it->second->reduce_to(targets[idx],
-                this, redop_id, redop, true/*exclusive*/, preconditions[idx]);
+          fold_precondition = it->second->reduce_to(fold_target,
+              this, redop_id, redop, true/*exclusive*/, fold_precondition);
           if (runtime->legion_spy_enabled)
             LegionSpy::log_future_use(unique_op_id, it->second->did);
         }
-        for (std::vector<ApEvent>::const_iterator it =
-              preconditions.begin(); it != preconditions.end(); it++)
-          if (it->exists())
-            postconditions.push_back(*it);
       }
       else
       {
+        std::vector<ApEvent> fold_events;
         for (std::map<DomainPoint,FutureImpl*>::const_iterator it =
               sources.begin(); it != sources.end(); it++)
         {
-          for (unsigned idx = 0; idx < targets.size(); idx++)
-          {
-            const ApEvent done = it->second->reduce_to(targets[idx],
-                this, redop_id, redop, false/*exclusive*/, preconditions[idx]);
-            if (done.exists())
-              postconditions.push_back(done);
-          }
+          const ApEvent done = it->second->reduce_to(fold_target,
+              this, redop_id, redop, false/*exclusive*/, fold_precondition);
+          if (done.exists())
+            fold_events.push_back(done);
           if (runtime->legion_spy_enabled)
             LegionSpy::log_future_use(unique_op_id, it->second->did);
         }
+        if (!fold_events.empty())
+          fold_precondition = Runtime::merge_events(NULL, fold_events);
+      }
+      if (targets.size() == 1)
+        return fold_precondition;
+      // Broadcast the final result to the rest of the targets
+      std::vector<ApEvent> postconditions;
+      for (unsigned idx = 0; idx < targets.size(); idx++)
+      {
+        if (idx == redop_fold_index)
+          continue;
+        const ApEvent done =
+          targets[idx]->copy_from(fold_target, this, fold_precondition);
+        if (done.exists())
+          postconditions.push_back(done);
       }
+      if (fold_precondition.exists())
+        postconditions.push_back(fold_precondition);
       if (!postconditions.empty())
         return Runtime::merge_events(NULL, postconditions);
       else
@@ -499,7 +499,7 @@ namespace Legion {
       virtual bool is_tracing_fence(void) const { return false; }
       // Record the trace hash for this operation
       virtual bool record_trace_hash(TraceRecognizer &recognizer, uint64_t idx);
-      static void hash_requirement(Murmur3Hasher &hasher, 
+      static void hash_requirement(TraceHasher &hasher,
                                    const RegionRequirement &req);
     public: // virtual methods for mapping
       // Pick the sources for a copy operations
@@ -708,9 +708,9 @@ namespace Legion {
       uint64_t context_index;
     protected:
       // Operations on which this operation depends
-      std::map<Operation*,GenerationID> incoming;
+      SmallPointerMap<Operation,GenerationID> incoming;
       // Operations which depend on this operation
-      std::map<Operation*,GenerationID> outgoing;
+      SmallPointerMap<Operation,GenerationID> outgoing;
       // Mapping dependences
       std::atomic<unsigned> remaining_mapping_dependences;
       // Number of outstanding mapping references, once this goes to 
@@ -1240,6 +1240,11 @@ namespace Legion {
       // its value.  Give it the current processor in case it
       // needs to wait for the value
       bool get_predicate_value(size_t index);
+      // Non-blocking test for whether the predicate has already resolved
+      // false. Pipeline stages that run before trigger_ready can use this
+      // to elide work (e.g. mapper calls) for operations that we know are
+      // never going to map
+      bool check_predicate_resolved_false(void);
     public:
       // This method gets invoked if a predicate for a predicated
       // operation resolves to false before we try to map the operation 
@@ -4366,6 +4371,9 @@ namespace Legion {
       std::vector<FutureInstance*> targets;
       std::vector<Memory> target_memories;
       std::vector<RtEvent> map_applied_conditions;
+      // Index of the target instance in the first memory requested by
+      // the mapper which is where we apply the reduction folds
+      unsigned redop_fold_index;
       size_t future_result_size;
       FutureInstance *serdez_redop_instance;
       void *serdez_redop_buffer;
@@ -30,6 +30,37 @@ namespace Legion {
 
     extern Realm::Logger log_prof;
 
+#ifdef LEGION_ENABLE_HOT_COUNTERS
+    Realm::Logger log_counters("counters");
+
+    /*static*/ const char *const
+                         HotCounters::counter_names[LAST_COUNTER_KIND] = {
+      "analysis.eq_set_migrations",
+      "analysis.eq_set_migrations_deferred",
+      "analysis.eq_set_migrations_pinned",
+      "analysis.eq_set_owner_updates",
+      "analysis.aggregator_update_batches",
+      "analysis.aggregator_copy_batches",
+      "analysis.aggregator_fills",
+      "trace.template_captures",
+      "trace.template_replays",
+      "gc.collectable_creations",
+      "gc.collectable_deletions",
+    };
+
+    /*static*/ std::atomic<unsigned long long>
+                         HotCounters::counters[LAST_COUNTER_KIND];
+
+    //--------------------------------------------------------------------------
+    /*static*/ void HotCounters::dump_counters(void)
+    //--------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < LAST_COUNTER_KIND; idx++)
+        log_counters.print("%s: %llu", counter_names[idx],
+            counters[idx].load(std::memory_order_relaxed));
+    }
+#endif
+
     //--------------------------------------------------------------------------
     ArrivalInfo::ArrivalInfo(void)
       : arrival_time(0), trigger_time(std::numeric_limits<timestamp_t>::min())
@@ -2285,7 +2316,8 @@ namespace Legion {
                                    const bool slow_config_ok,
                                    const bool self_prof,
                                    const bool no_critical,
-                                   const bool all_arrivals)
+                                   const bool all_arrivals,
+                                   const bool detail)
       : runtime(rt), done_event(Realm::UserEvent::create_user_event()),
         minimum_call_threshold(call_threshold * 1000 /*convert us to ns*/),
         output_footprint_threshold(footprint_threshold), 
@@ -2298,12 +2330,14 @@ namespace Legion {
 #else
         all_critical_arrivals(all_arrivals),
 #endif
+        detail_enabled(detail),
         next_backtrace_id((runtime->address_space == 0) ?
             runtime->total_address_spaces : runtime->address_space),
 #ifndef DEBUG_LEGION
         total_outstanding_requests(1/*start with guard*/),
 #endif
-        total_memory_footprint(0), implicit_top_level_task_proc(0),
+        total_memory_footprint(0), outstanding_flush(false),
+        implicit_top_level_task_proc(0),
         need_default_mapper_warning(!slow_config_ok)
     //--------------------------------------------------------------------------
     {
@@ -2681,6 +2715,9 @@ namespace Legion {
     TaskID tid, VariantID vid, UniqueID task_uid, Processor p, LgEvent critical)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_TASK);
 #else
@@ -2710,6 +2747,9 @@ namespace Legion {
                                   LgTaskID tid, Operation *op, LgEvent critical)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_META);
 #else
@@ -2767,6 +2807,9 @@ namespace Legion {
                                           CollectiveKind collective)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_COPY, count);
 #else
@@ -2797,6 +2840,9 @@ namespace Legion {
                                           CollectiveKind collective)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_FILL);
 #else
@@ -2825,6 +2871,9 @@ namespace Legion {
                                           Operation *op, LgEvent unique_event)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_INST); 
 #else
@@ -2851,6 +2900,9 @@ namespace Legion {
                                            LgEvent critical)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_PARTITION);
 #else
@@ -2874,6 +2926,9 @@ namespace Legion {
                       TaskID tid, VariantID vid, UniqueID uid, LgEvent critical)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_TASK);
 #else
@@ -2900,6 +2955,9 @@ namespace Legion {
                                    LgTaskID tid, UniqueID uid, LgEvent critical)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_META);
 #else
@@ -2928,6 +2986,9 @@ namespace Legion {
                                           CollectiveKind collective)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_COPY, count);
 #else
@@ -2958,6 +3019,9 @@ namespace Legion {
                                           CollectiveKind collective)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_FILL);
 #else
@@ -2986,6 +3050,9 @@ namespace Legion {
                                           UniqueID uid, LgEvent unique_event)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_INST);
 #else
@@ -3012,6 +3079,9 @@ namespace Legion {
                                            LgEvent critical)
     //--------------------------------------------------------------------------
     {
+      // Nothing to request if this node is not recording detail
+      if (!detail_enabled)
+        return;
 #ifdef DEBUG_LEGION
       increment_total_outstanding_requests(LEGION_PROF_PARTITION);
 #else
@@ -3495,6 +3565,23 @@ namespace Legion {
         // Let's actually make this quadratic so it's not just linear
         if (output_footprint_threshold > 0)
           over_scale *= over_scale;
+        // Offload the serialization (and any compression) to a meta-task
+        // on the profiler's target processor so we don't perturb whoever
+        // is recording this response, unless we're more than twice over
+        // the limit, which means the flusher isn't keeping up and we need
+        // to apply real back-pressure by dumping inline
+        if ((output_footprint_threshold > 0) &&
+            (footprint <= (2 * output_footprint_threshold)))
+        {
+          bool expected = false;
+          if (outstanding_flush.compare_exchange_strong(expected, true))
+          {
+            DeferProfilingFlushArgs args(this, inst, over_scale);
+            runtime->issue_runtime_meta_task(args, LG_LOW_PRIORITY,
+                RtEvent::NO_RT_EVENT, target_proc);
+          }
+          return;
+        }
         if (!serializer->is_thread_safe())
         {
           // Need a lock to protect the serializer
@@ -3505,7 +3592,7 @@ namespace Legion {
           diff = inst->dump_inter(serializer, over_scale);
 #ifdef DEBUG_LEGION
 #ifndef NDEBUG
-        footprint = 
+        footprint =
 #endif
 #endif
           total_memory_footprint.fetch_sub(diff);
@@ -3515,6 +3602,50 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    /*static*/ void LegionProfiler::handle_deferred_flush(const void *args)
+    //--------------------------------------------------------------------------
+    {
+      const DeferProfilingFlushArgs *dargs =
+        (const DeferProfilingFlushArgs*)args;
+      dargs->profiler->perform_deferred_flush(dargs->inst, dargs->over_scale);
+    }
+
+    //--------------------------------------------------------------------------
+    void LegionProfiler::perform_deferred_flush(LegionProfInstance *inst,
+                                                double over_scale)
+    //--------------------------------------------------------------------------
+    {
+      size_t diff = 0;
+      if (!serializer->is_thread_safe())
+      {
+        // Need a lock to protect the serializer
+        AutoLock p_lock(profiler_lock);
+        diff = inst->dump_inter(serializer, over_scale);
+      }
+      else
+        diff = inst->dump_inter(serializer, over_scale);
+      const size_t footprint = total_memory_footprint.fetch_sub(diff) - diff;
+      outstanding_flush.store(false);
+      // If this instance still has data holding us over the threshold
+      // then launch another flush task to keep draining - each task is
+      // bounded by the output latency goal so we don't monopolize the
+      // target processor
+      if ((diff > 0) && (footprint > output_footprint_threshold))
+      {
+        bool expected = false;
+        if (outstanding_flush.compare_exchange_strong(expected, true))
+        {
+          double over_scale_next =
+            double(footprint) / double(output_footprint_threshold);
+          over_scale_next *= over_scale_next;
+          DeferProfilingFlushArgs next_args(this, inst, over_scale_next);
+          runtime->issue_runtime_meta_task(next_args, LG_LOW_PRIORITY,
+              RtEvent::NO_RT_EVENT, target_proc);
+        }
+      }
+    }
+
     //--------------------------------------------------------------------------
     void LegionProfiler::issue_default_mapper_warning(Operation *op,
                                                    const char *mapper_call_name)
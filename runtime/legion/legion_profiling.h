@@ -38,6 +38,16 @@
 #define DETAILED_PROFILER(runtime, call) // Nothing
 #endif
 
+#ifdef LEGION_ENABLE_HOT_COUNTERS
+#define LEGION_HOT_COUNTER(kind) \
+  HotCounters::increment(HotCounters::kind)
+#define LEGION_HOT_COUNTER_ADD(kind, count) \
+  HotCounters::increment(HotCounters::kind, count)
+#else
+#define LEGION_HOT_COUNTER(kind) // Nothing
+#define LEGION_HOT_COUNTER_ADD(kind, count) // Nothing
+#endif
+
 // This version tracks the compabilitity of the Legion Prof logging
 // format. Whenver you make changes to the logging format, increment the number
 // stored in legion_profiling_version.h to track the change.
@@ -57,7 +67,47 @@ namespace Legion {
     typedef ::realm_id_t InstID;
     typedef ::realm_id_t IDType;
 
-    // This class helps us profile barriers by allowing us to 
+#ifdef LEGION_ENABLE_HOT_COUNTERS
+    /**
+     * \class HotCounters
+     * A compile-time-gated set of named counters for instrumenting hot
+     * paths in the runtime analysis. Counters cost nothing when the
+     * framework is disabled and a single relaxed atomic increment when
+     * it is enabled, so they are safe to leave in place on hot paths.
+     * The counts are dumped per node through the 'counters' logger when
+     * the runtime is finalized. To add a counter, append a kind to the
+     * enum below and its name to the table in legion_profiling.cc,
+     * prefixing the name with the subsystem it instruments.
+     */
+    class HotCounters {
+    public:
+      enum CounterKind {
+        ANALYSIS_EQ_SET_MIGRATIONS,
+        ANALYSIS_EQ_SET_MIGRATIONS_DEFERRED,
+        ANALYSIS_EQ_SET_MIGRATIONS_PINNED,
+        ANALYSIS_EQ_SET_OWNER_UPDATES,
+        ANALYSIS_AGGREGATOR_UPDATE_BATCHES,
+        ANALYSIS_AGGREGATOR_COPY_BATCHES,
+        ANALYSIS_AGGREGATOR_FILLS,
+        TRACE_TEMPLATE_CAPTURES,
+        TRACE_TEMPLATE_REPLAYS,
+        GC_COLLECTABLE_CREATIONS,
+        GC_COLLECTABLE_DELETIONS,
+        LAST_COUNTER_KIND, // must be last
+      };
+    public:
+      static inline void increment(CounterKind kind,
+                                   unsigned long long count = 1)
+        { counters[kind].fetch_add(count, std::memory_order_relaxed); }
+      // Called once per node when the runtime is finalized
+      static void dump_counters(void);
+    private:
+      static const char *const counter_names[LAST_COUNTER_KIND];
+      static std::atomic<unsigned long long> counters[LAST_COUNTER_KIND];
+    };
+#endif
+
+    // This class helps us profile barriers by allowing us to
     // find the latest barrier arrival to trigger
     struct ArrivalInfo {
     public:
@@ -807,7 +857,8 @@ namespace Legion {
                      const bool slow_config_ok,
                      const bool self_profile,
                      const bool no_critical,
-                     const bool all_arrivals);
+                     const bool all_arrivals,
+                     const bool detail);
       LegionProfiler(const LegionProfiler &rhs) = delete;
       virtual ~LegionProfiler(void);
     public:
@@ -911,8 +962,25 @@ namespace Legion {
       void increment_total_outstanding_requests(unsigned cnt = 1);
       void decrement_total_outstanding_requests(unsigned cnt = 1);
 #endif
+    public:
+      struct DeferProfilingFlushArgs :
+        public LgTaskArgs<DeferProfilingFlushArgs> {
+      public:
+        static const LgTaskID TASK_ID = LG_DEFER_PROFILING_FLUSH_TASK_ID;
+      public:
+        DeferProfilingFlushArgs(LegionProfiler *prof,
+                                LegionProfInstance *i, double over)
+          : LgTaskArgs(implicit_provenance), profiler(prof),
+            inst(i), over_scale(over) { }
+      public:
+        LegionProfiler *const profiler;
+        LegionProfInstance *const inst;
+        const double over_scale;
+      };
     public:
       void update_footprint(size_t diff, LegionProfInstance *inst);
+      static void handle_deferred_flush(const void *args);
+      void perform_deferred_flush(LegionProfInstance *inst, double over_scale);
     public:
       void issue_default_mapper_warning(Operation *op, const char *call_name);
     public:
@@ -936,6 +1004,10 @@ namespace Legion {
       // Whether we are recording all the critical barrier arrivals
       // or we are doing a reduction with the barrier to compute it
       const bool all_critical_arrivals;
+      // Whether this node records per-operation detail (tasks, metas,
+      // copies, fills, instances, partitions) - disabled on nodes beyond
+      // the -lg:prof_detail_nodes cutoff to bound log volume at scale
+      const bool detail_enabled;
     private:
       LegionProfSerializer* serializer;
       mutable LocalLock profiler_lock;
@@ -955,6 +1027,8 @@ namespace Legion {
     private:
       // For knowing when we need to start dumping early
       std::atomic<size_t> total_memory_footprint;
+      // Whether we have a deferred flush meta-task in flight
+      std::atomic<bool> outstanding_flush;
     private:
       std::atomic<ProcID> implicit_top_level_task_proc;
       std::optional<TaskID> external_implicit_task;
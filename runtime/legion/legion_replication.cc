@@ -1807,8 +1807,13 @@ namespace Legion {
             runtime->forest->find_domain(sharding_space, sharding_domain);
           else
             sharding_domain = launch_domain;
+          const std::vector<ShardID> &assignments =
+            sharding_function->find_shard_assignments(launch_domain,
+                                                      sharding_domain);
+          unsigned point_index = 0;
           for (Domain::DomainPointIterator itr(launch_domain); itr; itr++)
           {
+            const unsigned index = point_index++;
             Color color = functor->color(*itr, index_domain);
             std::map<Color,ConcurrentGroup>::iterator finder =
               concurrent_groups.find(color);
@@ -1816,9 +1821,8 @@ namespace Legion {
             if (finder == concurrent_groups.end())
               continue;
             finder->second.color_points++;
-            // Compute the shard for this point
-            ShardID color_shard = 
-              sharding_function->find_owner(*itr, sharding_domain);
+            // Lookup the shard for this point
+            ShardID color_shard = assignments[index];
             if (!std::binary_search(finder->second.shards.begin(),
                   finder->second.shards.end(), color_shard))
             {
@@ -5985,6 +5989,7 @@ namespace Legion {
 #ifdef DEBUG_LEGION
       assert(redop != NULL);
       assert(serdez_redop_collective == NULL);
+      assert(serdez_redop_exchange == NULL);
       assert(all_reduce_collective == NULL);
       assert(reduction_collective == NULL);
       assert(broadcast_collective == NULL);
@@ -6003,8 +6008,12 @@ namespace Legion {
           all_reduce_collective = new FutureAllReduceCollective(this,
               COLLECTIVE_LOC_97, ctx, redop_id, redop);
       }
-      else
+      else if (deterministic)
         serdez_redop_collective = new BufferExchange(ctx, COLLECTIVE_LOC_97);
+      else
+        // Commutative folds can be applied on the fly during the exchange
+        serdez_redop_exchange = new SerdezRedopExchange(ctx,
+            COLLECTIVE_LOC_97, serdez_redop_fns, redop);
     }
 
     //--------------------------------------------------------------------------
@@ -6013,6 +6022,7 @@ namespace Legion {
     {
       AllReduceOp::activate();
       serdez_redop_collective = NULL;
+      serdez_redop_exchange = NULL;
       all_reduce_collective = NULL;
       reduction_collective = NULL;
       broadcast_collective = NULL;
@@ -6025,6 +6035,8 @@ namespace Legion {
       AllReduceOp::deactivate(false/*free*/);
       if (serdez_redop_collective != NULL)
         delete serdez_redop_collective;
+      if (serdez_redop_exchange != NULL)
+        delete serdez_redop_exchange;
       if (all_reduce_collective != NULL)
         delete all_reduce_collective;
       if (reduction_collective != NULL)
@@ -6102,11 +6114,21 @@ namespace Legion {
             sources.begin(); it != sources.end(); it++)
         fold_serdez(it->second);
       // Now we need an all-to-all to get the values from other shards
-      const std::map<ShardID,std::pair<void*,size_t> > &remote_buffers =
-        serdez_redop_collective->exchange_buffers(serdez_redop_buffer,
-                                    future_result_size, deterministic);
-      if (deterministic)
+      if (serdez_redop_exchange != NULL)
       {
+        // Commutative case: the folds were applied on the fly as the
+        // buffers from the other shards moved through the exchange
+        serdez_redop_buffer = serdez_redop_exchange->all_reduce_buffers(
+            serdez_redop_buffer, future_result_size, future_result_size);
+      }
+      else
+      {
+#ifdef DEBUG_LEGION
+        assert(deterministic);
+#endif
+        const std::map<ShardID,std::pair<void*,size_t> > &remote_buffers =
+          serdez_redop_collective->exchange_buffers(serdez_redop_buffer,
+                                      future_result_size, true/*keep self*/);
         // Reset this back to empty so we can reduce in order across shards
         // Note the serdez_redop_collective took ownership of deleting
         // the buffer in this case so we know that it is not leaking
@@ -6125,18 +6147,6 @@ namespace Legion {
                                 future_result_size, it->second.first);
         }
       }
-      else
-      {
-        for (std::map<ShardID,std::pair<void*,size_t> >::const_iterator it =
-              remote_buffers.begin(); it != remote_buffers.end(); it++)
-        {
-#ifdef DEBUG_LEGION
-          assert(it->first != serdez_redop_collective->local_shard);
-#endif
-          (*(serdez_redop_fns->fold_fn))(redop, serdez_redop_buffer,
-                              future_result_size, it->second.first);
-        }
-      }
     }
 
     //--------------------------------------------------------------------------
@@ -10957,6 +10967,96 @@ namespace Legion {
         runtime->send_message(message, target_space, rez, true/*flush*/);
     }
 
+    //--------------------------------------------------------------------------
+    void ShardManager::compute_collective_tree(ShardID origin, ShardID local,
+                 int radix, ShardID &parent, std::vector<ShardID> &children) const
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(origin < total_shards);
+      assert(local < total_shards);
+#endif
+      parent = local;
+      // Group the shards by their address space, keeping both the groups
+      // and the shards inside them in a deterministic order so that every
+      // shard computes the same tree without communication
+      std::map<AddressSpaceID,std::vector<ShardID> > groups;
+      for (ShardID shard = 0; shard < total_shards; shard++)
+        groups[(*address_spaces)[shard]].push_back(shard);
+      // The origin becomes the representative of its own group
+      const AddressSpaceID origin_space = (*address_spaces)[origin];
+      std::vector<ShardID> &origin_group = groups[origin_space];
+      for (unsigned idx = 0; idx < origin_group.size(); idx++)
+      {
+        if (origin_group[idx] != origin)
+          continue;
+        origin_group.erase(origin_group.begin()+idx);
+        origin_group.insert(origin_group.begin(), origin);
+        break;
+      }
+      // Order the groups with the origin's group first and the others
+      // rotated around it by address space
+      std::vector<const std::vector<ShardID>*> ordered_groups;
+      ordered_groups.reserve(groups.size());
+      std::map<AddressSpaceID,std::vector<ShardID> >::const_iterator
+        origin_finder = groups.find(origin_space);
+      for (std::map<AddressSpaceID,std::vector<ShardID> >::const_iterator it =
+            origin_finder; it != groups.end(); it++)
+        ordered_groups.push_back(&it->second);
+      for (std::map<AddressSpaceID,std::vector<ShardID> >::const_iterator it =
+            groups.begin(); it != origin_finder; it++)
+        ordered_groups.push_back(&it->second);
+      // Find our group and our position within it
+      const AddressSpaceID local_space = (*address_spaces)[local];
+      int group_index = -1;
+      for (unsigned idx = 0; idx < ordered_groups.size(); idx++)
+      {
+        if ((*address_spaces)[ordered_groups[idx]->front()] != local_space)
+          continue;
+        group_index = idx;
+        break;
+      }
+#ifdef DEBUG_LEGION
+      assert(group_index >= 0);
+#endif
+      const std::vector<ShardID> &group = *ordered_groups[group_index];
+      int position = -1;
+      for (unsigned idx = 0; idx < group.size(); idx++)
+      {
+        if (group[idx] != local)
+          continue;
+        position = idx;
+        break;
+      }
+#ifdef DEBUG_LEGION
+      assert(position >= 0);
+#endif
+      // Edges between groups connect their representative shards
+      if (position == 0)
+      {
+        for (int idx = 1; idx <= radix; idx++)
+        {
+          const int child_group = group_index * radix + idx;
+          if (child_group >= int(ordered_groups.size()))
+            break;
+          children.push_back(ordered_groups[child_group]->front());
+        }
+        if (group_index > 0)
+          parent = ordered_groups[(group_index - 1) / radix]->front();
+      }
+      else
+        parent = group[(position - 1) / radix];
+      // Edges within a group form their own radix tree under the
+      // representative
+      for (int idx = 1; idx <= radix; idx++)
+      {
+        const unsigned child = position * radix + idx;
+        if (child >= group.size())
+          break;
+        children.push_back(group[child]);
+      }
+    }
+
     //--------------------------------------------------------------------------
     void ShardManager::handle_collective_message(Deserializer &derez)
     //--------------------------------------------------------------------------
@@ -12660,21 +12760,21 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       const MessageKind message = get_message_kind();
-      const int local_index = convert_to_index(local_shard, origin);
-      for (int idx = 1; idx <= shard_collective_radix; idx++)
+      ShardID parent = local_shard;
+      std::vector<ShardID> children;
+      manager->compute_collective_tree(origin, local_shard,
+                              shard_collective_radix, parent, children);
+      for (std::vector<ShardID>::const_iterator it =
+            children.begin(); it != children.end(); it++)
       {
-        const int target_index = local_index * shard_collective_radix + idx; 
-        if (target_index >= int(manager->total_shards))
-          break;
-        ShardID target = convert_to_shard(target_index, origin);
         Serializer rez;
         {
           rez.serialize(manager->did);
-          rez.serialize(target);
+          rez.serialize(*it);
           rez.serialize(collective_index);
           pack_collective(rez);
         }
-        manager->send_collective_message(message, target, rez);
+        manager->send_collective_message(message, *it, rez);
       }
     }
 
@@ -12855,15 +12955,14 @@ namespace Legion {
     void GatherCollective::send_message(void)
     //--------------------------------------------------------------------------
     {
-      // Convert to our local index
-      const int local_index = convert_to_index(local_shard, target);
+      // Find our parent in the collective tree rooted at the target
+      ShardID next = local_shard;
+      std::vector<ShardID> children;
+      manager->compute_collective_tree(target, local_shard,
+                              shard_collective_radix, next, children);
 #ifdef DEBUG_LEGION
-      assert(local_index > 0); // should never be here for zero
+      assert(next != local_shard); // should never be here for the target
 #endif
-      // Subtract by 1 and then divide to get the target (truncate)
-      const int target_index = (local_index - 1) / shard_collective_radix;
-      // Then convert back to the target
-      ShardID next = convert_to_shard(target_index, target);
       Serializer rez;
       {
         rez.serialize(manager->did);
@@ -12880,16 +12979,13 @@ namespace Legion {
     int GatherCollective::compute_expected_notifications(void) const
     //--------------------------------------------------------------------------
     {
-      int result = 1; // always have one arriver for ourself
-      const int index = convert_to_index(local_shard, target);
-      for (int idx = 1; idx <= shard_collective_radix; idx++)
-      {
-        const int source_index = index * shard_collective_radix + idx;
-        if (source_index >= int(manager->total_shards))
-          break;
-        result++;
-      }
-      return result;
+      // We hear from each of our children in the collective tree along
+      // with one arrival for ourself
+      ShardID parent = local_shard;
+      std::vector<ShardID> children;
+      manager->compute_collective_tree(target, local_shard,
+                              shard_collective_radix, parent, children);
+      return (1 + int(children.size()));
     }
 
     /////////////////////////////////////////////////////////////
@@ -14856,7 +14952,143 @@ namespace Legion {
     }
 
     /////////////////////////////////////////////////////////////
-    // Future Name Exchange 
+    // Serdez Redop Exchange
+    /////////////////////////////////////////////////////////////
+
+    //--------------------------------------------------------------------------
+    SerdezRedopExchange::SerdezRedopExchange(ReplicateContext *ctx,
+                                             CollectiveIndexLocation loc,
+                                             const SerdezRedopFns *fns,
+                                             const ReductionOp *op)
+      : AllGatherCollective(loc, ctx), serdez_fns(fns), redop(op),
+        local_buffer(NULL), local_size(0), current_stage(-1)
+    //--------------------------------------------------------------------------
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    SerdezRedopExchange::~SerdezRedopExchange(void)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(pending_folds.empty());
+#endif
+      for (std::map<int,std::vector<std::pair<void*,size_t> > >::const_iterator
+            pit = pending_folds.begin(); pit != pending_folds.end(); pit++)
+        for (std::vector<std::pair<void*,size_t> >::const_iterator it =
+              pit->second.begin(); it != pit->second.end(); it++)
+          if (it->second > 0)
+            free(it->first);
+    }
+
+    //--------------------------------------------------------------------------
+    void SerdezRedopExchange::pack_collective_stage(ShardID target,
+                                                    Serializer &rez, int stage)
+    //--------------------------------------------------------------------------
+    {
+      // The first time we pack a new stage, fold in everything we received
+      // for the stage we just finished - we cannot fold any earlier since
+      // messages for later stages can arrive out of order and must not be
+      // double counted when our buffer is packed for downstream stages
+      if (stage != current_stage)
+      {
+        if (!pending_folds.empty())
+        {
+          std::map<int,std::vector<std::pair<void*,size_t> > >::iterator
+            next = pending_folds.begin();
+          if (next->first == current_stage)
+          {
+            fold_pending(next->second);
+            pending_folds.erase(next);
+          }
+        }
+        current_stage = stage;
+      }
+      rez.serialize(local_size);
+      if (local_size > 0)
+        rez.serialize(local_buffer, local_size);
+    }
+
+    //--------------------------------------------------------------------------
+    void SerdezRedopExchange::unpack_collective_stage(Deserializer &derez,
+                                                      int stage)
+    //--------------------------------------------------------------------------
+    {
+      size_t size;
+      derez.deserialize(size);
+      void *buffer = NULL;
+      if (size > 0)
+      {
+        buffer = malloc(size);
+        derez.deserialize(buffer, size);
+      }
+      pending_folds[stage].push_back(std::make_pair(buffer, size));
+    }
+
+    //--------------------------------------------------------------------------
+    RtEvent SerdezRedopExchange::post_complete_exchange(void)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      // Should be at most one stage of folds left
+      assert(pending_folds.size() <= 1);
+#endif
+      if (!pending_folds.empty())
+      {
+        std::map<int,std::vector<std::pair<void*,size_t> > >::iterator
+          last = pending_folds.begin();
+        if (last->first == -1)
+        {
+          // The remainder stage result sent back to a non-participating
+          // shard already includes our own value so just replace ours
+#ifdef DEBUG_LEGION
+          assert(last->second.size() == 1);
+#endif
+          std::pair<void*,size_t> &pending = last->second.back();
+          if (local_size > 0)
+            free(local_buffer);
+          local_buffer = pending.first;
+          local_size = pending.second;
+          last->second.clear();
+        }
+        else
+          fold_pending(last->second);
+        pending_folds.erase(last);
+      }
+      return RtEvent::NO_RT_EVENT;
+    }
+
+    //--------------------------------------------------------------------------
+    void SerdezRedopExchange::fold_pending(
+                                 std::vector<std::pair<void*,size_t> > &buffers)
+    //--------------------------------------------------------------------------
+    {
+      for (std::vector<std::pair<void*,size_t> >::const_iterator it =
+            buffers.begin(); it != buffers.end(); it++)
+      {
+        if (it->second == 0)
+          continue;
+        (*(serdez_fns->fold_fn))(redop, local_buffer, local_size, it->first);
+        free(it->first);
+      }
+      buffers.clear();
+    }
+
+    //--------------------------------------------------------------------------
+    void* SerdezRedopExchange::all_reduce_buffers(void *value, size_t size,
+                                                  size_t &result_size)
+    //--------------------------------------------------------------------------
+    {
+      // Can set these without the lock since we haven't started yet
+      local_buffer = value;
+      local_size = size;
+      perform_collective_sync();
+      result_size = local_size;
+      return local_buffer;
+    }
+
+    /////////////////////////////////////////////////////////////
+    // Future Name Exchange
     /////////////////////////////////////////////////////////////
 
     //--------------------------------------------------------------------------
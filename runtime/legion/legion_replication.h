@@ -357,7 +357,13 @@ namespace Legion {
     /**
      * \class FutureReduction
      * This class builds a reduction tree of futures down to a single
-     * future value.
+     * future value. The tree has the same shape as the underlying radix
+     * gather: interior shards fold the values received from their children
+     * into their local instance (see pack_collective) before forwarding a
+     * single instance up the tree, so no shard ever folds more than radix
+     * instances and the origin shard is not a serial bottleneck. The fold
+     * order at each shard is fixed by shard ID so the result is still
+     * deterministic from run to run for a given number of shards.
      */
     class FutureReductionCollective : public GatherCollective {
     public:
@@ -810,6 +816,53 @@ namespace Legion {
       std::map<ShardID,std::pair<void*,size_t> > results;
     };
 
+    /**
+     * \class SerdezRedopExchange
+     * A class for performing an all-reduce of serdez reduction buffers.
+     * Unlike a BufferExchange, which materializes one buffer from every
+     * shard before the caller folds them all, this collective folds
+     * incoming buffers during the exchange so only a single buffer flows
+     * through each stage of the butterfly. Folds for a stage are deferred
+     * until the next stage is packed (mirroring the approach of the
+     * FutureAllReduceCollective) so each shard's contribution is
+     * incorporated exactly once even when stage messages arrive out of
+     * order. Only safe for non-deterministic reductions since the fold
+     * order varies with message arrival.
+     */
+    class SerdezRedopExchange : public AllGatherCollective<false> {
+    public:
+      SerdezRedopExchange(ReplicateContext *ctx, CollectiveIndexLocation loc,
+                          const SerdezRedopFns *fns, const ReductionOp *redop);
+      SerdezRedopExchange(const SerdezRedopExchange &rhs) = delete;
+      virtual ~SerdezRedopExchange(void);
+    public:
+      SerdezRedopExchange& operator=(const SerdezRedopExchange &rhs) = delete;
+    public:
+      virtual MessageKind get_message_kind(void) const
+        { return SEND_CONTROL_REPLICATION_BUFFER_EXCHANGE; }
+      virtual void pack_collective_stage(ShardID target,
+                                         Serializer &rez, int stage);
+      virtual void unpack_collective_stage(Deserializer &derez, int stage);
+    protected:
+      virtual RtEvent post_complete_exchange(void);
+    public:
+      // Folds the buffers from all the other shards into 'value' during
+      // the exchange - the result is owned by the caller, though note that
+      // the returned pointer can differ from 'value' since serdez folds
+      // are allowed to reallocate their left-hand side
+      void* all_reduce_buffers(void *value, size_t size, size_t &result_size);
+    protected:
+      void fold_pending(std::vector<std::pair<void*,size_t> > &buffers);
+    protected:
+      const SerdezRedopFns *const serdez_fns;
+      const ReductionOp *const redop;
+      // Buffers received for each stage that have not been folded yet
+      std::map<int,std::vector<std::pair<void*,size_t> > > pending_folds;
+      void *local_buffer;
+      size_t local_size;
+      int current_stage;
+    };
+
     /**
      * \class FutureNameExchange
      * A class for doing an all-to-all exchange of future names
@@ -2638,6 +2691,7 @@ namespace Legion {
       virtual ApEvent all_reduce_redop(RtEvent &executed);
     protected:
       BufferExchange *serdez_redop_collective;
+      SerdezRedopExchange *serdez_redop_exchange;
       FutureAllReduceCollective *all_reduce_collective;
       FutureReductionCollective *reduction_collective;
       FutureBroadcastCollective *broadcast_collective;
@@ -3445,9 +3499,15 @@ namespace Legion {
       ApEvent trigger_task_complete(bool local, ApEvent effects_done);
       void trigger_task_commit(bool local, RtEvent precondition);
     public:
-      void send_collective_message(MessageKind message, ShardID target, 
+      void send_collective_message(MessageKind message, ShardID target,
                                    Serializer &rez);
       void handle_collective_message(Deserializer &derez);
+      // Compute the parent and children of 'local' in a locality-aware
+      // radix tree rooted at 'origin': the shards on each address space
+      // form a subtree under a representative shard so that collective
+      // traffic crosses between address spaces at most once per space
+      void compute_collective_tree(ShardID origin, ShardID local, int radix,
+                  ShardID &parent, std::vector<ShardID> &children) const;
     public:
       void send_rendezvous_message(ShardID target, Serializer &rez);
       void handle_rendezvous_message(Deserializer &derez);
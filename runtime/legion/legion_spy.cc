@@ -21,6 +21,118 @@
 
 namespace Legion {
   namespace Internal {
+    namespace LegionSpy {
+
+      SpyBinaryLogger *binary_logger = NULL;
+
+      //------------------------------------------------------------------------
+      SpyBinaryLogger::SpyBinaryLogger(const std::string &file_name,
+                                       AddressSpaceID space)
+        : binary_log(NULL), logger_lock(Reservation::create_reservation())
+      //------------------------------------------------------------------------
+      {
+        // Follow the profiler convention of substituting a '%' in the
+        // file name with the address space so that every node writes
+        // its own file
+        std::string name = file_name;
+        const size_t pct = name.find_first_of('%');
+        if (pct != std::string::npos)
+        {
+          char buffer[16];
+          snprintf(buffer, sizeof buffer, "%u", space);
+          name = name.substr(0, pct) + buffer + name.substr(pct + 1);
+        }
+        binary_log = fopen(name.c_str(), "wb");
+        assert(binary_log != NULL);
+        // Write a small header identifying the file, the format version,
+        // and the node that produced it; all fields after the header are
+        // signed 64-bit integers in the native byte order
+        const char magic[8] = { 'l','g','s','p','y','b','i','n' };
+        fwrite(magic, 1, sizeof magic, binary_log);
+        const unsigned version = BINARY_VERSION;
+        fwrite(&version, sizeof version, 1, binary_log);
+        const unsigned node = space;
+        fwrite(&node, sizeof node, 1, binary_log);
+      }
+
+      //------------------------------------------------------------------------
+      SpyBinaryLogger::~SpyBinaryLogger(void)
+      //------------------------------------------------------------------------
+      {
+        if (binary_log != NULL)
+          fclose(binary_log);
+        binary_log = NULL;
+        if (logger_lock.exists())
+          logger_lock.destroy_reservation();
+        logger_lock = Reservation::NO_RESERVATION;
+      }
+
+      //------------------------------------------------------------------------
+      void SpyBinaryLogger::record(RecordKind kind,
+                                   const long long *fields, size_t count)
+      //------------------------------------------------------------------------
+      {
+        const unsigned char tag = kind;
+        RtEvent lock_event(logger_lock.acquire(0, true/*exclusive*/));
+        lock_event.wait();
+        fwrite(&tag, sizeof tag, 1, binary_log);
+        fwrite(fields, sizeof(long long), count, binary_log);
+        logger_lock.release();
+      }
+
+      unsigned sampling_rate = 0;
+
+      namespace {
+        // Unique IDs of the index points that were sampled out; only
+        // ever populated when sampling_rate is larger than one so the
+        // common case of full logging never takes the lock below
+        LocalLock sampling_lock;
+        std::unordered_set<UniqueID> suppressed_points;
+      };
+
+      //------------------------------------------------------------------------
+      bool sample_index_point(UniqueID point_id)
+      //------------------------------------------------------------------------
+      {
+        if (sampling_rate <= 1)
+          return true;
+        // Use a multiplicative hash of the unique ID so that strided
+        // unique ID generation across the nodes cannot alias the rate
+        const uint64_t hash = point_id * 0x9E3779B97F4A7C15ull;
+        if ((hash % sampling_rate) == 0)
+          return true;
+        AutoLock s_lock(sampling_lock);
+        suppressed_points.insert(point_id);
+        return false;
+      }
+
+      //------------------------------------------------------------------------
+      bool sample_point_alias(UniqueID original_id, UniqueID local_id)
+      //------------------------------------------------------------------------
+      {
+        if (sampling_rate <= 1)
+          return true;
+        // Only operations that went through sample_index_point can be
+        // sampled out, so individual tasks that were sent remotely and
+        // take this path are always logged
+        AutoLock s_lock(sampling_lock);
+        if (suppressed_points.find(original_id) == suppressed_points.end())
+          return true;
+        suppressed_points.insert(local_id);
+        return false;
+      }
+
+      //------------------------------------------------------------------------
+      bool point_suppressed(UniqueID unique_id)
+      //------------------------------------------------------------------------
+      {
+        if (sampling_rate <= 1)
+          return false;
+        AutoLock s_lock(sampling_lock);
+        return (suppressed_points.find(unique_id) != suppressed_points.end());
+      }
+
+    }; // namespace LegionSpy
 
     //--------------------------------------------------------------------------
     TreeStateLogger::TreeStateLogger(void)
@@ -35,6 +35,86 @@ namespace Legion {
 
       extern Realm::Logger log_spy;
 
+      /**
+       * \class SpyBinaryLogger
+       * An alternative sink for the high-frequency realm event graph
+       * logging calls made in detailed Legion Spy mode. Instead of
+       * rendering each call to text through the realm logger, records
+       * are written as a tag byte followed by fixed-size binary fields
+       * to a per-node file, which is considerably cheaper on the
+       * critical path and much smaller on disk. The binary files can
+       * be converted back into the text format understood by
+       * tools/legion_spy.py with tools/legion_spy_bin2log.py, which
+       * must be kept in sync with the record kinds below and with the
+       * fields recorded by the logging calls in this file.
+       */
+      class SpyBinaryLogger {
+      public:
+        // The version of the binary file format, bump this any time
+        // the record kinds or their fields change
+        static const unsigned BINARY_VERSION = 1;
+        enum RecordKind {
+          EVENT_DEPENDENCE_RECORD = 0,
+          RESERVATION_ACQUIRE_RECORD,
+          AP_USER_EVENT_RECORD,
+          RT_USER_EVENT_RECORD,
+          PRED_EVENT_RECORD,
+          AP_USER_EVENT_TRIGGER_RECORD,
+          RT_USER_EVENT_TRIGGER_RECORD,
+          PRED_EVENT_TRIGGER_RECORD,
+          OPERATION_EVENTS_RECORD,
+          COPY_EVENTS_RECORD,
+          COPY_FIELD_RECORD,
+          INDIRECT_EVENTS_RECORD,
+          INDIRECT_FIELD_RECORD,
+          INDIRECT_INSTANCE_RECORD,
+          INDIRECT_GROUP_RECORD,
+          FILL_EVENTS_RECORD,
+          FILL_FIELD_RECORD,
+          DEPPART_EVENTS_RECORD,
+          REPLAY_OPERATION_RECORD,
+          LAST_RECORD_KIND, // must be last
+        };
+      public:
+        SpyBinaryLogger(const std::string &file_name, AddressSpaceID space);
+        ~SpyBinaryLogger(void);
+      public:
+        void record(RecordKind kind, const long long *fields, size_t count);
+      private:
+        FILE *binary_log;
+        Reservation logger_lock;
+      };
+
+      // Installed during runtime start-up when -lg:spy_binary is passed
+      // on the command line, before any of the logging calls below can
+      // be made, and deleted again during runtime tear-down
+      extern SpyBinaryLogger *binary_logger;
+
+      // When this is larger than one, only one in every sampling_rate
+      // points of each index space launch has its spy records logged,
+      // which makes graph-level debugging with tools/legion_spy.py
+      // feasible on runs whose full operation graphs are too large to
+      // render. Sampling is stratified: every non-point operation is
+      // always logged completely, and a sampled point keeps all of its
+      // records so that the subgraphs the tool renders are exact. Set
+      // during runtime start-up from -lg:spy_sample before any
+      // operations can be logged
+      extern unsigned sampling_rate;
+
+      // Decide whether a point of an index space launch should be
+      // logged, remembering the unique IDs of the points that were
+      // sampled out so that the logging calls below can filter all of
+      // their other records too; the decision is a deterministic hash
+      // of the unique ID so every call site agrees on it. Defined in
+      // legion_spy.cc
+      bool sample_index_point(UniqueID point_id);
+      // Propagate the sampling decision for an operation across the
+      // wire to the unique ID it was assigned on a remote node
+      bool sample_point_alias(UniqueID original_id, UniqueID local_id);
+      // Test whether an operation was sampled out by the calls above;
+      // always false for operations that are not index launch points
+      bool point_suppressed(UniqueID unique_id);
+
       // One time logger calls to record what gets logged
       static inline void log_legion_spy_config(void)
       {
@@ -45,6 +125,11 @@ namespace Legion {
 #endif
       }
 
+      static inline void log_sampling_rate(unsigned rate)
+      {
+        log_spy.print("Legion Spy Sampling %u", rate);
+      }
+
       // Logger calls for the machine architecture
       static inline void log_processor_kind(unsigned kind, const char *name)
       {
@@ -755,6 +840,8 @@ namespace Legion {
       static inline void log_slice_point(UniqueID slice_id, UniqueID point_id,
                                          const DomainPoint &point)
       {
+        if (!sample_index_point(point_id))
+          return;
 #if LEGION_MAX_DIM == 1
         log_spy.print("Slice Point %llu %llu %u %lld", 
 		      slice_id, point_id, point.dim, 
@@ -834,12 +921,16 @@ namespace Legion {
 
       static inline void log_point_point(UniqueID p1, UniqueID p2)
       {
+        if (!sample_point_alias(p1, p2))
+          return;
         log_spy.print("Point Point %llu %llu", p1, p2);
       }
 
       static inline void log_index_point(UniqueID index_id, UniqueID point_id,
                                          const DomainPoint &point)
       {
+        if (!sample_index_point(point_id))
+          return;
 #if LEGION_MAX_DIM == 1
         log_spy.print("Index Point %llu %llu %u %lld", 
                       index_id, point_id, point.dim, 
@@ -938,6 +1029,8 @@ namespace Legion {
       static inline void log_intra_space_dependence(UniqueID point_id,
                                                     const DomainPoint &point)
       {
+        if (point_suppressed(point_id))
+          return;
 #if LEGION_MAX_DIM == 1
         log_spy.print("Intra Space Dependence %llu %u %lld", 
 		      point_id, point.dim, 
@@ -1018,6 +1111,8 @@ namespace Legion {
       static inline void log_operation_provenance(UniqueID unique_id,
                                     const std::string_view &provenance)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Operation Provenance %llu %.*s", unique_id,
             int(provenance.length()), 
             (provenance.length() == 0) ? "" : provenance.data());
@@ -1026,12 +1121,16 @@ namespace Legion {
       static inline void log_child_operation_index(UniqueID parent_id, 
                                        size_t index, UniqueID child_id)
       {
+        if (point_suppressed(child_id))
+          return;
         log_spy.print("Operation Index %llu %zd %llu",
             parent_id, index, child_id);
       }
 
       static inline void log_predicated_false_op(UniqueID unique_id)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Predicate False %lld", unique_id);
       }
 
@@ -1041,6 +1140,8 @@ namespace Legion {
           unsigned field_component, unsigned tree_id, unsigned privilege, 
           unsigned coherence, unsigned redop, IDType parent_index)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Logical Requirement %llu %u %u " IDFMT " %u %u "
 		      "%u %u %u " IDFMT, unique_id, index, region, 
                       index_component, field_component, tree_id,
@@ -1050,6 +1151,8 @@ namespace Legion {
       static inline void log_requirement_fields(UniqueID unique_id, 
           unsigned index, const std::set<unsigned> &logical_fields)
       {
+        if (point_suppressed(unique_id))
+          return;
         for (std::set<unsigned>::const_iterator it = logical_fields.begin();
               it != logical_fields.end(); it++)
         {
@@ -1061,6 +1164,8 @@ namespace Legion {
       static inline void log_requirement_fields(UniqueID unique_id, 
           unsigned index, const std::vector<FieldID> &logical_fields)
       {
+        if (point_suppressed(unique_id))
+          return;
         for (std::vector<FieldID>::const_iterator it = logical_fields.begin();
               it != logical_fields.end(); it++)
         {
@@ -1080,7 +1185,9 @@ namespace Legion {
       static inline void log_requirement_projection(UniqueID unique_id,
                                       unsigned index, ProjectionID pid)
       {
-        log_spy.print("Logical Requirement Projection %llu %u %u", 
+        if (point_suppressed(unique_id))
+          return;
+        log_spy.print("Logical Requirement Projection %llu %u %u",
                       unique_id, index, pid);
       }
 
@@ -1199,6 +1306,8 @@ namespace Legion {
                                              DistributedID future_did,
                                              const DomainPoint &point)
       {
+        if (point_suppressed(creator_id))
+          return;
 #if LEGION_MAX_DIM == 1
         log_spy.print("Future Creation %llu %llu %u %lld",
                       creator_id, future_did, point.dim,
@@ -1279,6 +1388,8 @@ namespace Legion {
       static inline void log_future_use(UniqueID user_id,
                                         DistributedID future_did)
       {
+        if (point_suppressed(user_id))
+          return;
         log_spy.print("Future Usage %llu %llu", user_id, future_did);
       }
 
@@ -1402,12 +1513,16 @@ namespace Legion {
       // Logger calls for mapping decisions
       static inline void log_variant_decision(UniqueID unique_id, unsigned vid)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Variant Decision %llu %u", unique_id, vid);
       }
 
       static inline void log_mapping_decision(UniqueID unique_id, 
                                 unsigned index, FieldID fid, LgEvent inst_event)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Mapping Decision %llu %d %d " IDFMT "", unique_id,
 		      index, fid, inst_event.id);
       }
@@ -1415,6 +1530,8 @@ namespace Legion {
       static inline void log_post_mapping_decision(UniqueID unique_id, 
                                 unsigned index, FieldID fid, LgEvent inst_event)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Post Mapping Decision %llu %d %d " IDFMT "", unique_id,
 		      index, fid, inst_event.id);
       }
@@ -1422,16 +1539,22 @@ namespace Legion {
       static inline void log_task_priority(UniqueID unique_id, 
                                            TaskPriority priority)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Task Priority %llu %d", unique_id, priority);
       }
 
       static inline void log_task_processor(UniqueID unique_id, IDType proc_id)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Task Processor %llu " IDFMT "", unique_id, proc_id);
       }
 
       static inline void log_task_premapping(UniqueID unique_id, unsigned index)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Task Premapping %llu %d", unique_id, index);
       }
 
@@ -1443,6 +1566,8 @@ namespace Legion {
       static inline void log_tunable_value(UniqueID unique_id, unsigned index,
                                     const void *value, size_t num_bytes)
       {
+        if (point_suppressed(unique_id))
+          return;
         // Build a hex string for the value
         size_t buffer_size = ((8 * num_bytes) / 4) + 1;
         char *buffer = (char*)malloc(buffer_size);
@@ -1479,6 +1604,8 @@ namespace Legion {
       static inline void log_phase_barrier_arrival(UniqueID unique_id,
                                                    ApBarrier barrier)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Phase Barrier Arrive %llu " IDFMT "",
                       unique_id, barrier.id);
       }
@@ -1486,6 +1613,8 @@ namespace Legion {
       static inline void log_phase_barrier_wait(UniqueID unique_id,
                                                 ApEvent previous)
       {
+        if (point_suppressed(unique_id))
+          return;
         log_spy.print("Phase Barrier Wait %llu " IDFMT "",
                       unique_id, previous.id);
       }
@@ -1493,7 +1622,9 @@ namespace Legion {
       static inline void log_collective_rendezvous(UniqueID unique_id,
                   unsigned requirement_index, unsigned analysis_index)
       {
-        log_spy.print("Collective Rendezvous %llu %u %u", unique_id, 
+        if (point_suppressed(unique_id))
+          return;
+        log_spy.print("Collective Rendezvous %llu %u %u", unique_id,
                                   requirement_index, analysis_index);
       }
 
@@ -1509,7 +1640,11 @@ namespace Legion {
                 UniqueID prev_id, unsigned prev_idx, UniqueID next_id, 
                 unsigned next_idx, unsigned dep_type, bool pointwise = false)
       {
-        log_spy.print("Mapping Dependence %llu %llu %u %llu %u %d %d", 
+        // Keep the subgraphs of sampled points exact by dropping any
+        // dependences with an endpoint that was sampled out
+        if (point_suppressed(prev_id) || point_suppressed(next_id))
+          return;
+        log_spy.print("Mapping Dependence %llu %llu %u %llu %u %d %d",
 		      context, prev_id, prev_idx, next_id, next_idx, dep_type,
                       pointwise ? 1 : 0);
       }
@@ -1517,6 +1652,8 @@ namespace Legion {
       static inline void log_future_dependence(UniqueID context, 
                 UniqueID prev_id, UniqueID next_id, bool pointwise = false)
       {
+        if (point_suppressed(prev_id) || point_suppressed(next_id))
+          return;
         log_spy.print("Future Dependence %llu %llu %llu %d",
             context, prev_id, next_id, pointwise ? 1 : 0);
       }
@@ -1524,47 +1661,107 @@ namespace Legion {
       // Logger calls for realm events
       static inline void log_event_dependence(LgEvent one, LgEvent two)
       {
-        if (one != two)
-          log_spy.print("Event Event " IDFMT " " IDFMT, 
-			one.id, two.id);
+        if (one == two)
+          return;
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)one.id, (long long)two.id };
+          binary_logger->record(SpyBinaryLogger::EVENT_DEPENDENCE_RECORD,
+                                fields, 2);
+          return;
+        }
+        log_spy.print("Event Event " IDFMT " " IDFMT,
+		      one.id, two.id);
       }
 
       static inline void log_reservation_acquire(Reservation r, 
                                                  LgEvent pre, LgEvent post)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)r.id,
+                                (long long)pre.id, (long long)post.id };
+          binary_logger->record(SpyBinaryLogger::RESERVATION_ACQUIRE_RECORD,
+                                fields, 3);
+          return;
+        }
         log_spy.print("Reservation " IDFMT " " IDFMT " " IDFMT,
                       r.id, pre.id, post.id);
       }
 
       static inline void log_ap_user_event(ApUserEvent event)
       {
-        log_spy.print("Ap User Event " IDFMT " %llu", 
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)event.id,
+                                (long long)implicit_provenance };
+          binary_logger->record(SpyBinaryLogger::AP_USER_EVENT_RECORD,
+                                fields, 2);
+          return;
+        }
+        log_spy.print("Ap User Event " IDFMT " %llu",
                       event.id, implicit_provenance);
       }
 
       static inline void log_rt_user_event(RtUserEvent event)
       {
-        log_spy.print("Rt User Event " IDFMT " %llu", 
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)event.id,
+                                (long long)implicit_provenance };
+          binary_logger->record(SpyBinaryLogger::RT_USER_EVENT_RECORD,
+                                fields, 2);
+          return;
+        }
+        log_spy.print("Rt User Event " IDFMT " %llu",
                       event.id, implicit_provenance);
       }
 
       static inline void log_pred_event(PredEvent event)
       {
+        if (binary_logger != NULL)
+        {
+          const long long field = event.id;
+          binary_logger->record(SpyBinaryLogger::PRED_EVENT_RECORD,
+                                &field, 1);
+          return;
+        }
         log_spy.print("Pred Event " IDFMT, event.id);
       }
 
       static inline void log_ap_user_event_trigger(ApUserEvent event)
       {
+        if (binary_logger != NULL)
+        {
+          const long long field = event.id;
+          binary_logger->record(SpyBinaryLogger::AP_USER_EVENT_TRIGGER_RECORD,
+                                &field, 1);
+          return;
+        }
         log_spy.print("Ap User Event Trigger " IDFMT, event.id);
       }
 
       static inline void log_rt_user_event_trigger(RtUserEvent event)
       {
+        if (binary_logger != NULL)
+        {
+          const long long field = event.id;
+          binary_logger->record(SpyBinaryLogger::RT_USER_EVENT_TRIGGER_RECORD,
+                                &field, 1);
+          return;
+        }
         log_spy.print("Rt User Event Trigger " IDFMT, event.id);
       }
 
       static inline void log_pred_event_trigger(PredEvent event)
       {
+        if (binary_logger != NULL)
+        {
+          const long long field = event.id;
+          binary_logger->record(SpyBinaryLogger::PRED_EVENT_TRIGGER_RECORD,
+                                &field, 1);
+          return;
+        }
         log_spy.print("Pred Event Trigger " IDFMT, event.id);
       }
 
@@ -1575,6 +1772,16 @@ namespace Legion {
       static inline void log_operation_events(UniqueID uid,
                                               LgEvent pre, LgEvent post)
       {
+        if (point_suppressed(uid))
+          return;
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)uid,
+                                (long long)pre.id, (long long)post.id };
+          binary_logger->record(SpyBinaryLogger::OPERATION_EVENTS_RECORD,
+                                fields, 3);
+          return;
+        }
         log_spy.print("Operation Events %llu " IDFMT " " IDFMT,
 		      uid, pre.id, post.id);
       }
@@ -1586,6 +1793,15 @@ namespace Legion {
                                          LgEvent pre, LgEvent post,
                                          CollectiveKind collective)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)op_unique_id, (long long)expr_id,
+                                src_tree_id, dst_tree_id, (long long)pre.id,
+                                (long long)post.id, collective };
+          binary_logger->record(SpyBinaryLogger::COPY_EVENTS_RECORD,
+                                fields, 7);
+          return;
+        }
         log_spy.print("Copy Events %llu %lld %d %d " IDFMT " " IDFMT " %d",
                       op_unique_id, expr_id, src_tree_id,
                       dst_tree_id, pre.id, post.id, collective);
@@ -1595,6 +1811,15 @@ namespace Legion {
                                         LgEvent src_event, FieldID dst_fid,
                                         LgEvent dst_event, ReductionOpID redop)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)post.id, src_fid,
+                                (long long)src_event.id, dst_fid,
+                                (long long)dst_event.id, redop };
+          binary_logger->record(SpyBinaryLogger::COPY_FIELD_RECORD,
+                                fields, 6);
+          return;
+        }
         log_spy.print("Copy Field " IDFMT " %d " IDFMT " %d " IDFMT " %d",
                   post.id, src_fid, src_event.id, dst_fid, dst_event.id, redop);
       }
@@ -1604,6 +1829,15 @@ namespace Legion {
                                              unsigned indirection_id,
                                              LgEvent pre, LgEvent post)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)op_unique_id, (long long)expr_id,
+                                indirection_id, (long long)pre.id,
+                                (long long)post.id };
+          binary_logger->record(SpyBinaryLogger::INDIRECT_EVENTS_RECORD,
+                                fields, 5);
+          return;
+        }
         log_spy.print("Indirect Events %llu %lld %d " IDFMT " " IDFMT,
               op_unique_id, expr_id, indirection_id, pre.id, post.id);
       }
@@ -1613,6 +1847,15 @@ namespace Legion {
                                         FieldID dst_fid, LgEvent dst_event, 
                                         int dst_indirect, ReductionOpID redop)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)post.id, src_fid,
+                                (long long)src_event.id, src_indirect, dst_fid,
+                                (long long)dst_event.id, dst_indirect, redop };
+          binary_logger->record(SpyBinaryLogger::INDIRECT_FIELD_RECORD,
+                                fields, 8);
+          return;
+        }
         log_spy.print("Indirect Field " IDFMT " %d " IDFMT " %d %d " IDFMT
                        " %d %d", post.id, src_fid, src_event.id, src_indirect,
                        dst_fid, dst_event.id, dst_indirect, redop);
@@ -1621,6 +1864,14 @@ namespace Legion {
       static inline void log_indirect_instance(unsigned indirection_id,
                         unsigned index, LgEvent inst_event, FieldID fid)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { indirection_id, index,
+                                (long long)inst_event.id, fid };
+          binary_logger->record(SpyBinaryLogger::INDIRECT_INSTANCE_RECORD,
+                                fields, 4);
+          return;
+        }
         log_spy.print("Indirect Instance %u %u " IDFMT " %d",
                       indirection_id, index, inst_event.id, fid);
       }
@@ -1628,6 +1879,15 @@ namespace Legion {
       static inline void log_indirect_group(unsigned indirection_id,
                         unsigned index, LgEvent inst_event, IDType index_space)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { indirection_id, index,
+                                (long long)inst_event.id,
+                                (long long)index_space };
+          binary_logger->record(SpyBinaryLogger::INDIRECT_GROUP_RECORD,
+                                fields, 4);
+          return;
+        }
         log_spy.print("Indirect Group %u %u " IDFMT " %llu",
           indirection_id, index, inst_event.id, index_space);
       }
@@ -1640,6 +1900,16 @@ namespace Legion {
                                          UniqueID fill_unique_id,
                                          CollectiveKind collective)
       {
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)op_unique_id, (long long)expr_id,
+                                handle.get_id(), tree_id, (long long)pre.id,
+                                (long long)post.id, (long long)fill_unique_id,
+                                collective };
+          binary_logger->record(SpyBinaryLogger::FILL_EVENTS_RECORD,
+                                fields, 8);
+          return;
+        }
         log_spy.print("Fill Events %llu %lld %d %d " IDFMT " " IDFMT " %llu %d",
 		      op_unique_id, expr_id, handle.get_id(), tree_id,
 		      pre.id, post.id, fill_unique_id, collective);
@@ -1648,7 +1918,15 @@ namespace Legion {
       static inline void log_fill_field(LgEvent post, 
                                         FieldID fid, LgEvent dst_event)
       {
-        log_spy.print("Fill Field " IDFMT " %d " IDFMT, 
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)post.id, fid,
+                                (long long)dst_event.id };
+          binary_logger->record(SpyBinaryLogger::FILL_FIELD_RECORD,
+                                fields, 3);
+          return;
+        }
+        log_spy.print("Fill Field " IDFMT " %d " IDFMT,
                       post.id, fid, dst_event.id);
       }
 
@@ -1662,6 +1940,15 @@ namespace Legion {
         // which of course breaks Legion Spy's way of logging deppart
         // operations uniquely as their completion event
         assert(pre != post);
+        if (binary_logger != NULL)
+        {
+          const long long fields[] = { (long long)op_unique_id, (long long)expr_id,
+                                (long long)pre.id, (long long)post.id,
+                                op_kind };
+          binary_logger->record(SpyBinaryLogger::DEPPART_EVENTS_RECORD,
+                                fields, 5);
+          return;
+        }
         log_spy.print("Deppart Events %llu %lld " IDFMT " " IDFMT " %d",
                       op_unique_id, expr_id, pre.id, post.id, op_kind);
       }
@@ -1672,8 +1959,17 @@ namespace Legion {
       // incomplete because a job crashes in the middle of a run
       static inline void log_replay_operation(UniqueID op_unique_id)
       {
+        if (point_suppressed(op_unique_id))
+          return;
+        if (binary_logger != NULL)
+        {
+          const long long field = op_unique_id;
+          binary_logger->record(SpyBinaryLogger::REPLAY_OPERATION_RECORD,
+                                &field, 1);
+          return;
+        }
         log_spy.print("Replay Operation %llu", op_unique_id);
-      } 
+      }
 
       // Logging for equivalence set creation
       static inline void log_equivalence_set(DistributedID did,
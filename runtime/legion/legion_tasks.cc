@@ -156,7 +156,7 @@ namespace Legion {
           args = arg_manager->get_allocation();
         }
         else
-          args = legion_malloc(TASK_ARGS_ALLOC, arglen);
+          args = allocate_task_args(arglen);
         derez.deserialize(args,arglen);
       }
       unpack_mappable(*this, derez); 
@@ -396,7 +396,7 @@ namespace Legion {
           arg_manager = NULL;
         }
         else
-          legion_free(TASK_ARGS_ALLOC, args, arglen);
+          free_task_args();
         args = NULL;
         arglen = 0;
       }
@@ -1342,7 +1342,7 @@ namespace Legion {
       else if (arglen > 0)
       {
         // If there is no argument manager then we do the copy no matter what
-        this->args = legion_malloc(TASK_ARGS_ALLOC, arglen);
+        this->args = allocate_task_args(arglen);
         memcpy(args,rhs->args,arglen);
       }
       this->map_id = rhs->map_id;
@@ -1980,7 +1980,7 @@ namespace Legion {
           arg_manager = NULL;
         }
         else
-          legion_free(TASK_ARGS_ALLOC, args, arglen);
+          free_task_args();
       }
       if (local_args != NULL)
         free(local_args);
@@ -2176,6 +2176,7 @@ namespace Legion {
       selected_variant = 0;
       task_priority = 0;
       perform_postmap = false;
+      mapped_allocation_bytes = 0;
       execution_context = NULL;
       remote_trace_recorder = NULL;
       shard_manager = NULL;
@@ -2498,6 +2499,18 @@ namespace Legion {
                                 const std::deque<InstanceSet> &parent_instances)
     //--------------------------------------------------------------------------
     {
+      // This is the synchronous fast path for executing a child task: it
+      // runs the variant directly on the parent task's stack using the
+      // parent's mapped instances, skipping mapping and the round trip
+      // through the Realm processor ready queue. It is deliberately gated
+      // on both the launcher ('enable_inlining') and the mapper
+      // ('inline_task' in select_task_options) rather than being applied
+      // automatically by the runtime: the decision has to be made before
+      // the mapping stages run since an inlined task borrows the parent's
+      // physical state, and by the time we would otherwise know that the
+      // task's preconditions have triggered we are usually executing in a
+      // meta-task on a utility processor where application variants are
+      // not permitted to run.
 #ifdef DEBUG_LEGION
       assert(parent_instances.size() == regions.size());
 #endif
@@ -3597,7 +3610,8 @@ namespace Legion {
       context_configuration.min_tasks_to_schedule = 
         runtime->initial_tasks_to_schedule;
       context_configuration.min_frames_to_schedule = 0;
-      context_configuration.meta_task_vector_width = 
+      context_configuration.max_outstanding_allocation_bytes = 0;
+      context_configuration.meta_task_vector_width =
         runtime->initial_meta_task_vector_width;
       context_configuration.max_templates_per_trace =
         LEGION_DEFAULT_MAX_TEMPLATES_PER_TRACE;
@@ -5260,21 +5274,41 @@ namespace Legion {
       if (!atomic_locks.empty())
       {
         // Take all the locks in order in the proper way
+        start_condition =
+          Runtime::acquire_ap_reservations(atomic_locks, start_condition);
         to_release.reserve(atomic_locks.size());
-        for (std::map<Reservation,bool>::const_iterator it = 
+        for (std::map<Reservation,bool>::const_iterator it =
               atomic_locks.begin(); it != atomic_locks.end(); it++)
-        {
-          start_condition = Runtime::acquire_ap_reservation(it->first, 
-                                          it->second, start_condition);
           to_release.push_back(it->first);
-        }
       }
       // STEP 3: Finally we get to launch the task
-      // Mark that we have an outstanding task in this context 
+      // Mark that we have an outstanding task in this context
       if (inline_task)
         parent_ctx->increment_inlined();
       else
+      {
+        // In streaming mode charge the parent context for the instance
+        // bytes we hold mapped until we actually start running so it can
+        // apply backpressure before mapping more operations
+        if (parent_ctx->get_max_outstanding_allocation_bytes() > 0)
+        {
+          for (std::deque<InstanceSet>::const_iterator it =
+                physical_instances.begin(); it !=
+                physical_instances.end(); it++)
+          {
+            for (unsigned idx = 0; idx < it->size(); idx++)
+            {
+              const InstanceRef &ref = (*it)[idx];
+              if (ref.is_virtual_ref())
+                continue;
+              mapped_allocation_bytes +=
+                ref.get_physical_manager()->get_instance_size();
+            }
+          }
+          parent_ctx->record_mapped_allocation(mapped_allocation_bytes);
+        }
         parent_ctx->increment_pending();
+      }
       // Note there is a potential scary race condition to be aware of here: 
       // once we launch this task it's possible for this task to run and 
       // clean up before we finish the execution of this function thereby
@@ -5931,6 +5965,9 @@ namespace Legion {
       // Watch out for the cleanup race with some acrobatics here
       // to handle the case where the iterator is invalidated
       std::vector<RtEvent> wait_for;
+      // Group up any remote slices by their target node so we can bound
+      // the fan-out at this node when sending them
+      std::map<AddressSpaceID,std::vector<SliceTask*> > remote_slices;
       std::list<SliceTask*>::const_iterator it = slices.begin();
       while (true)
       {
@@ -5958,7 +5995,8 @@ namespace Legion {
           // We can only send it away if it is not origin mapped
           // otherwise it has to stay here until it is fully mapped
           if (!slice->is_origin_mapped())
-            runtime->send_task(slice);
+            remote_slices[
+              runtime->find_address_space(slice->target_proc)].push_back(slice);
           else
             slice->trigger_mapping();
         }
@@ -5970,6 +6008,12 @@ namespace Legion {
         if (done)
           break;
       }
+      // Now that we are no longer traversing the slice list we can send
+      // off any remote slices; if they span more target nodes than we
+      // want to fan-out to directly from here then the runtime relays
+      // them through intermediate nodes to bound the sends at any node
+      if (!remote_slices.empty())
+        runtime->send_slices(remote_slices);
       // Must-epoch operations are nasty little beasts and have
       // to wait for the effects to finish before returning
       if (!wait_for.empty())
@@ -6520,7 +6564,7 @@ namespace Legion {
       arglen = launcher.argument.get_size();
       if (arglen > 0)
       {
-        args = legion_malloc(TASK_ARGS_ALLOC, arglen);
+        args = allocate_task_args(arglen);
         memcpy(args,launcher.argument.get_ptr(),arglen);
       }
       map_id = launcher.map_id;
@@ -6696,10 +6740,12 @@ namespace Legion {
     void IndividualTask::trigger_prepipeline_stage(void)
     //--------------------------------------------------------------------------
     {
-      if (!options_selected)
+      // Skip the mapper call for tasks whose predicate has already resolved
+      // false since they are never going to map or run
+      if (!options_selected && !check_predicate_resolved_false())
       {
         const bool inline_task = select_task_options(false/*prioritize*/);
-        if (inline_task) 
+        if (inline_task)
         {
           REPORT_LEGION_WARNING(LEGION_WARNING_MAPPER_REQUESTED_INLINE,
                           "Mapper %s requested to inline task %s "
@@ -6802,7 +6848,7 @@ namespace Legion {
     {
       if (output_regions.size() > 0)
         return recognizer.record_operation_untraceable(opidx);
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
       hasher.hash(task_id);
       for (std::vector<RegionRequirement>::const_iterator it = 
@@ -10162,9 +10208,11 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       // First compute the parent indexes
-      compute_parent_indexes(); 
+      compute_parent_indexes();
       // Initialize the privilege paths
-      if (!options_selected)
+      // Skip the mapper call for tasks whose predicate has already resolved
+      // false since they are never going to map or run
+      if (!options_selected && !check_predicate_resolved_false())
       {
         const bool inline_task = select_task_options(false/*prioritize*/);
         if (inline_task) 
@@ -10403,7 +10451,7 @@ namespace Legion {
     {
       if (output_regions.size() > 0)
         return recognizer.record_operation_untraceable(opidx);
-      Murmur3Hasher hasher;
+      TraceHasher hasher;
       hasher.hash(get_operation_kind());
       hasher.hash(task_id);
       for (std::vector<RegionRequirement>::const_iterator it = 
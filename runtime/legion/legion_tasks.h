@@ -47,8 +47,26 @@ namespace Legion {
           OutputRequirement &req, Deserializer &derez);
     public:
       virtual void set_context_index(uint64_t index) = 0;
+    protected:
+      // Small task arguments are copied inline into the task object so that
+      // the common case of a few POD values skips the heap allocation and
+      // free on every launch; larger arguments fall back to legion_malloc
+      static const size_t INLINE_TASK_ARG_SIZE = 64;
+      inline void* allocate_task_args(size_t size)
+        {
+          if (size <= INLINE_TASK_ARG_SIZE)
+            return inline_args;
+          else
+            return legion_malloc(TASK_ARGS_ALLOC, size);
+        }
+      inline void free_task_args(void)
+        {
+          if (args != inline_args)
+            legion_free(TASK_ARGS_ALLOC, args, arglen);
+        }
     protected:
       AllocManager *arg_manager;
+      alignas(16) uint8_t inline_args[INLINE_TASK_ARG_SIZE];
     };
 
     /**
@@ -428,6 +446,8 @@ namespace Legion {
         { return no_access_regions; }
       inline VariantID get_selected_variant(void) const
         { return selected_variant; }
+      inline size_t get_mapped_allocation_bytes(void) const
+        { return mapped_allocation_bytes; }
       inline const std::set<RtEvent>& get_map_applied_conditions(void) const
         { return map_applied_conditions; }
       inline RtEvent get_profiling_reported(void) const
@@ -580,6 +600,9 @@ namespace Legion {
       VariantID                                   selected_variant;
       TaskPriority                                task_priority;
       bool                                        perform_postmap;
+      // Instance bytes charged to the parent context when streaming
+      // mode is enabled, released when this task starts running
+      size_t                                      mapped_allocation_bytes;
     protected:
       // Events that must be triggered before we are done mapping
       std::set<RtEvent>                     map_applied_conditions;
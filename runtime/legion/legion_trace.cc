@@ -2074,7 +2074,8 @@ namespace Legion {
         // Wait for the preconditions to be ready
         if (current_ready.exists() && !current_ready.has_triggered())
           current_ready.wait();
-        bool valid = current->check_preconditions();
+        bool valid = current->check_preconditions(
+            op->get_begin_operation(), map_applied_events);
         bool acquired = valid ? current->acquire_instance_references() : false;
         // Now do the exchange between the operations to handle the case
         // of control replication to see if all the shards agree on what
@@ -2106,7 +2107,8 @@ namespace Legion {
             // Wait for the prefetched analyses to finish and clean them up
             if (next_ready.exists() && !next_ready.has_triggered())
               next_ready.wait();
-            templates[idx-1]->check_preconditions();
+            templates[idx-1]->check_preconditions(
+                op->get_begin_operation(), map_applied_events);
           }
           // Everybody agreed to reuse this template so make it the
           // new current template and shuffle it to the front
@@ -2354,18 +2356,41 @@ namespace Legion {
 #ifdef DEBUG_LEGION
           assert(!templates.empty());
 #endif
-          PhysicalTemplate *to_delete = templates.front();
+          // Templates are stored in least-recently-used order (oldest at
+          // the front), but pure LRU eviction is a poor fit here because
+          // templates are not all equally valuable: a template that has
+          // paid for its capture with many replays is worth keeping over
+          // a newer one that has barely been used, and a template that
+          // pins lots of instance memory is more expensive to cache than
+          // a small one. Score each template by the replays it has
+          // produced weighted by its recency and discounted by the
+          // instance memory it keeps resident, then evict the lowest
+          unsigned victim_index = 0;
+          double victim_score = 0.0;
+          for (unsigned idx = 0; idx < templates.size(); idx++)
+          {
+            PhysicalTemplate *candidate = templates[idx];
+            const double benefit =
+              double(candidate->get_total_replays()) * double(idx + 1);
+            // Measure resident memory in megabytes so that small
+            // templates are not unduly penalized for their footprint
+            const double resident =
+              double(candidate->get_template_footprint() >> 20) + 1.0;
+            const double score = benefit / resident;
+            if ((idx == 0) || (score < victim_score))
+            {
+              victim_index = idx;
+              victim_score = score;
+            }
+          }
+          PhysicalTemplate *to_delete = templates[victim_index];
           ApEvent pending_deletion;
-          if (!to_delete->defer_template_deletion(pending_deletion, 
+          if (!to_delete->defer_template_deletion(pending_deletion,
                                             map_applied_conditions))
             delete to_delete;
           else if (pending_deletion.exists())
             execution_postconditions.insert(pending_deletion);
-          // Remove the least recently used (first) one from the vector
-          // shift it to the back first though, should be fast
-          if (templates.size() > 1)
-            std::rotate(templates.begin(),templates.begin()+1,templates.end());
-          templates.pop_back();
+          templates.erase(templates.begin() + victim_index);
         }
         if (++new_template_count > LEGION_NEW_TEMPLATE_WARNING_COUNT)
         {
@@ -4613,6 +4638,8 @@ namespace Legion {
         last_fence(NULL), remaining_replays(0), total_logical(0)
     //--------------------------------------------------------------------------
     {
+      last_failed_condition = NO_FAILED_CONDITION;
+      last_failed_anticondition = false;
       events.push_back(fence_event);
       event_map[fence_event] = fence_completion_id;
       finished_transitive_reduction.store(NULL);
@@ -4743,6 +4770,22 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       std::vector<RtEvent> ready_events;
+      if (last_failed_condition != NO_FAILED_CONDITION)
+      {
+        // Only test the condition set that failed the last check: if it
+        // is still failing then we can reject this template without
+        // paying for the analyses on all the other condition sets
+        if (last_failed_anticondition)
+          anticonditions[last_failed_condition]->test_anticonditions(op,
+              last_failed_condition, ready_events, applied_events);
+        else
+          preconditions[last_failed_condition]->test_preconditions(op,
+              last_failed_condition, ready_events, applied_events);
+        if (!ready_events.empty())
+          return Runtime::merge_events(ready_events);
+        else
+          return RtEvent::NO_RT_EVENT;
+      }
       for (unsigned idx = 0; idx < preconditions.size(); idx++)
         preconditions[idx]->test_preconditions(op, idx, ready_events,
                                                applied_events);
@@ -4756,18 +4799,87 @@ namespace Legion {
     }
 
     //--------------------------------------------------------------------------
-    bool PhysicalTemplate::check_preconditions(void)
+    bool PhysicalTemplate::check_preconditions(FenceOp *op,
+                                              std::set<RtEvent> &applied_events)
     //--------------------------------------------------------------------------
     {
+      // Note that these checks are only performed when a trace is being
+      // (re-)entered and a template has to be selected: recurrent replays
+      // of an idempotent template skip this method (and its analyses and
+      // allocations) entirely because the template's postconditions are
+      // known to re-establish its preconditions. When we do get here some
+      // other operations have run since the last replay and could have
+      // mutated any of the equivalence sets, so there is no sound way to
+      // elide the full analyses with a cheaper local check
+      unsigned already_checked = NO_FAILED_CONDITION;
+      bool already_checked_anti = false;
+      if (last_failed_condition != NO_FAILED_CONDITION)
+      {
+        // We only tested the condition set that failed last time
+        const unsigned index = last_failed_condition;
+        const bool anti = last_failed_anticondition;
+        last_failed_condition = NO_FAILED_CONDITION;
+        const bool passed = anti ?
+          anticonditions[index]->check_anticonditions() :
+          preconditions[index]->check_preconditions();
+        if (!passed)
+        {
+          // Still failing for the same reason, no need to test the rest
+          last_failed_condition = index;
+          last_failed_anticondition = anti;
+          return false;
+        }
+        // The previously failing condition passes now, so test all the
+        // other condition sets; we already have this one's verdict in
+        // hand so there's no need to run its analysis a second time
+        already_checked = index;
+        already_checked_anti = anti;
+        std::vector<RtEvent> ready_events;
+        for (unsigned idx = 0; idx < preconditions.size(); idx++)
+          if (anti || (idx != index))
+            preconditions[idx]->test_preconditions(op, idx, ready_events,
+                                                   applied_events);
+        for (unsigned idx = 0; idx < anticonditions.size(); idx++)
+          if (!anti || (idx != index))
+            anticonditions[idx]->test_anticonditions(op, idx, ready_events,
+                                                     applied_events);
+        if (!ready_events.empty())
+        {
+          const RtEvent ready = Runtime::merge_events(ready_events);
+          if (ready.exists() && !ready.has_triggered())
+            ready.wait();
+        }
+      }
       bool result = true;
-      for (std::vector<TraceConditionSet*>::const_iterator it = 
-            preconditions.begin(); it != preconditions.end(); it++)
-        if (!(*it)->check_preconditions())
+      for (unsigned idx = 0; idx < preconditions.size(); idx++)
+      {
+        if (!already_checked_anti && (idx == already_checked))
+          continue;
+        if (!preconditions[idx]->check_preconditions())
+        {
+          // Remember the first failure for the next test
+          if (result)
+          {
+            last_failed_condition = idx;
+            last_failed_anticondition = false;
+          }
           result = false;
-      for (std::vector<TraceConditionSet*>::const_iterator it = 
-            anticonditions.begin(); it != anticonditions.end(); it++)
-        if (!(*it)->check_anticonditions())
+        }
+      }
+      for (unsigned idx = 0; idx < anticonditions.size(); idx++)
+      {
+        if (already_checked_anti && (idx == already_checked))
+          continue;
+        if (!anticonditions[idx]->check_anticonditions())
+        {
+          if (result)
+          {
+            last_failed_condition = idx;
+            last_failed_anticondition = true;
+          }
           result = false;
+        }
+      }
       return result;
     }
 
@@ -5031,6 +5143,7 @@ namespace Legion {
                                                 bool has_blocking_call)
     //--------------------------------------------------------------------------
     {
+      LEGION_HOT_COUNTER(TRACE_TEMPLATE_CAPTURES);
       if (has_no_consensus.load())
         replayable = NOT_REPLAYABLE_CONSENSUS;
       else if (has_blocking_call)
@@ -5070,9 +5183,15 @@ namespace Legion {
           TransitiveReductionArgs args(this, state);
           trace->runtime->issue_runtime_meta_task(args, LG_LOW_PRIORITY);
         }
-        // Can dump now if we're not deferring the transitive reduction
-        else if (trace->runtime->dump_physical_traces)
-          dump_template();
+        else
+        {
+          // Can dump now if we're not deferring the transitive reduction
+          if (trace->runtime->dump_physical_traces)
+            dump_template();
+          // No deferred transitive reduction will rewrite the instructions
+          // so we can shed the capture-time encoding now
+          release_capture_state();
+        }
       }
       else
       {
@@ -5368,6 +5487,20 @@ namespace Legion {
         (*it)->executor->release_shadow_instances();
     }
 
+    //--------------------------------------------------------------------------
+    size_t PhysicalTemplate::get_template_footprint(void) const
+    //--------------------------------------------------------------------------
+    {
+      // Sum the footprints of all the instances that this template keeps
+      // pinned with gc references as a measure of how much memory pressure
+      // keeping this template cached puts on the rest of the system
+      size_t footprint = 0;
+      for (std::vector<PhysicalManager*>::const_iterator it =
+            all_instances.begin(); it != all_instances.end(); it++)
+        footprint += (*it)->instance_footprint;
+      return footprint;
+    }
+
     //--------------------------------------------------------------------------
     void PhysicalTemplate::optimize(CompleteOp *op,bool do_transitive_reduction)
     //--------------------------------------------------------------------------
@@ -5453,6 +5586,49 @@ namespace Legion {
         if ((*it)->remove_base_expression_reference(TRACE_REF))
           delete (*it);
       recorded_expressions.clear();
+      // The instruction stream is in its final form now (unless a deferred
+      // transitive reduction rewrites it later) so we can flatten the
+      // merge-event instructions for efficient replay
+      flatten_merge_events();
+    }
+
+    //--------------------------------------------------------------------------
+    void PhysicalTemplate::flatten_merge_events(void)
+    //--------------------------------------------------------------------------
+    {
+      // Flatten the input sets of the merge-event instructions into compact
+      // vectors so that replays iterate an array instead of walking a
+      // node-based set on every execution of the template. This is redone
+      // whenever an optimization pass rewrites the merge instructions after
+      // they have already been flattened.
+      for (std::vector<Instruction*>::const_iterator it =
+            instructions.begin(); it != instructions.end(); it++)
+      {
+        MergeEvent *merge = (*it)->as_merge_event();
+        if (merge == NULL)
+          continue;
+        merge->rhs_flat.assign(merge->rhs.begin(), merge->rhs.end());
+      }
+    }
+
+    //--------------------------------------------------------------------------
+    void PhysicalTemplate::release_capture_state(void)
+    //--------------------------------------------------------------------------
+    {
+      // The instruction stream is in its final executable form: replays
+      // only read the flattened merge inputs, so the input sets - whose
+      // node-based storage dominates the footprint of large templates -
+      // can be released now
+      for (std::vector<Instruction*>::const_iterator it =
+            instructions.begin(); it != instructions.end(); it++)
+      {
+        MergeEvent *merge = (*it)->as_merge_event();
+        if (merge == NULL)
+          continue;
+        merge->rhs_flat.assign(merge->rhs.begin(), merge->rhs.end());
+        merge->rhs_flat.shrink_to_fit();
+        std::set<unsigned>().swap(merge->rhs);
+      }
     }
 
     //--------------------------------------------------------------------------
@@ -6066,8 +6242,18 @@ namespace Legion {
         }
         else
         {
-          slice_index = next_slice_id;
-          next_slice_id = (next_slice_id + 1) % replay_parallelism;
+          // Instructions that don't belong to an operation (e.g. merge
+          // events made by the transitive reduction) should go on the
+          // slice that produces their input events when we can find one,
+          // otherwise every one of their dependences would need a
+          // crossing event to get across the slice boundary
+          slice_index =
+            find_replay_slice_preference(inst, gen, slice_indices_by_inst);
+          if (slice_index == -1U)
+          {
+            slice_index = next_slice_id;
+            next_slice_id = (next_slice_id + 1) % replay_parallelism;
+          }
           if (kind == CREATE_AP_USER_EVENT)
           {
             // Save which slice this is on so the later trigger will
@@ -6266,6 +6452,50 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    unsigned PhysicalTemplate::find_replay_slice_preference(Instruction *inst,
+                           const std::vector<unsigned> &gen,
+                           const std::vector<unsigned> &slice_indices_by_inst)
+                           const
+    //--------------------------------------------------------------------------
+    {
+      // Only merge events carry enough dependence information to have a
+      // preference, everything else gets round-robined by the caller
+      if (inst->get_kind() != MERGE_EVENT)
+        return -1U;
+      MergeEvent *merge = inst->as_merge_event();
+      // Vote for the slice that produces the most of our input events,
+      // since each input from a different slice needs a crossing event
+      std::map<unsigned,unsigned> votes;
+      for (std::set<unsigned>::const_iterator it =
+            merge->rhs.begin(); it != merge->rhs.end(); it++)
+      {
+        // The fence event is set before any slice replays so it never
+        // constrains our placement
+        if ((*it == 0) || (gen[*it] == 0))
+          continue;
+#ifdef DEBUG_LEGION
+        assert(gen[*it] != -1U);
+#endif
+        const unsigned generator_slice = slice_indices_by_inst[gen[*it]];
+#ifdef DEBUG_LEGION
+        assert(generator_slice != -1U);
+#endif
+        votes[generator_slice]++;
+      }
+      unsigned result = -1U;
+      unsigned best = 0;
+      for (std::map<unsigned,unsigned>::const_iterator it =
+            votes.begin(); it != votes.end(); it++)
+      {
+        if (it->second <= best)
+          continue;
+        best = it->second;
+        result = it->first;
+      }
+      return result;
+    }
+
     //--------------------------------------------------------------------------
     void PhysicalTemplate::initialize_transitive_reduction_frontiers(
        std::vector<unsigned> &topo_order, std::vector<unsigned> &inv_topo_order)
@@ -6766,6 +6996,10 @@ namespace Legion {
         // We also need to rerun the propagate copies analysis to
         // remove any mergers which contain only a single input
         propagate_copies(NULL/*don't need the gen out*/);
+        // The transitive reduction and copy propagation both rewrite the
+        // merge instructions and nothing else will, so recompute the
+        // flattened inputs and drop the capture-time encoding
+        release_capture_state();
         if (trace->runtime->dump_physical_traces)
           dump_template();
       }
@@ -8191,6 +8425,7 @@ namespace Legion {
     void PhysicalTemplate::start_replay(void)
     //--------------------------------------------------------------------------
     {
+      LEGION_HOT_COUNTER(TRACE_TEMPLATE_REPLAYS);
       Runtime *runtime = trace->runtime;
       const std::vector<Processor> &replay_targets = 
         trace->get_replay_targets();
@@ -10551,14 +10786,31 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       std::vector<ApEvent> to_merge;
-      to_merge.reserve(rhs.size());
-      for (std::set<unsigned>::const_iterator it =
-            rhs.begin(); it != rhs.end(); it++)
+      if (!rhs_flat.empty())
+      {
+        // Use the flattened inputs if the template has finished being
+        // optimized since they are much faster to iterate than the set
+        to_merge.reserve(rhs_flat.size());
+        for (std::vector<unsigned>::const_iterator it =
+              rhs_flat.begin(); it != rhs_flat.end(); it++)
+        {
+#ifdef DEBUG_LEGION
+          assert(*it < events.size());
+#endif
+          to_merge.push_back(events[*it]);
+        }
+      }
+      else
       {
+        to_merge.reserve(rhs.size());
+        for (std::set<unsigned>::const_iterator it =
+              rhs.begin(); it != rhs.end(); it++)
+        {
 #ifdef DEBUG_LEGION
-        assert(*it < events.size());
+          assert(*it < events.size());
 #endif
-        to_merge.push_back(events[*it]);
+          to_merge.push_back(events[*it]);
+        }
       }
       ApEvent result = Runtime::merge_events(NULL, to_merge);
       events[lhs] = result;
@@ -10570,12 +10822,25 @@ namespace Legion {
     {
       std::stringstream ss;
       ss << "events[" << lhs << "] = Runtime::merge_events(";
+      // Use the flattened inputs if the set has already been released
       unsigned count = 0;
-      for (std::set<unsigned>::iterator it = rhs.begin(); it != rhs.end();
-           ++it)
+      if (!rhs_flat.empty())
       {
-        if (count++ != 0) ss << ",";
-        ss << "events[" << *it << "]";
+        for (std::vector<unsigned>::const_iterator it = rhs_flat.begin();
+             it != rhs_flat.end(); ++it)
+        {
+          if (count++ != 0) ss << ",";
+          ss << "events[" << *it << "]";
+        }
+      }
+      else
+      {
+        for (std::set<unsigned>::iterator it = rhs.begin(); it != rhs.end();
+             ++it)
+        {
+          if (count++ != 0) ss << ",";
+          ss << "events[" << *it << "]";
+        }
       }
       ss << ")    (owner: " << owner << ")";
       return ss.str();
@@ -919,6 +919,8 @@ namespace Legion {
           const std::vector<unsigned> &inv_topo_order,
           const std::vector<std::vector<unsigned> > &incoming_reduced);
       void check_finalize_transitive_reduction(void);
+      void flatten_merge_events(void);
+      void release_capture_state(void);
       void propagate_copies(std::vector<unsigned> *gen);
       void eliminate_dead_code(std::vector<unsigned> &gen);
       void prepare_parallel_replay(const std::vector<unsigned> &gen);
@@ -948,7 +950,8 @@ namespace Legion {
 #endif
       RtEvent test_preconditions(FenceOp *op,
                                  std::set<RtEvent> &applied_events);
-      bool check_preconditions(void);
+      bool check_preconditions(FenceOp *op,
+                               std::set<RtEvent> &applied_events);
       void apply_postconditions(FenceOp *op,
                                 std::set<RtEvent> &applied_events);
       void invalidate_equivalence_sets(void) const;
@@ -971,9 +974,11 @@ namespace Legion {
       inline bool is_replaying(void) const { return trace->is_replaying(); }
       inline bool is_replayable(void) const
         { return (replayable == REPLAYABLE); }
-      inline bool is_idempotent(void) const 
+      inline bool is_idempotent(void) const
         { return (idempotency == IDEMPOTENT); }
       inline void record_no_consensus(void) { has_no_consensus.store(true); }
+      inline size_t get_total_replays(void) const { return total_replays; }
+      size_t get_template_footprint(void) const;
     public:
       virtual bool is_recording(void) const { return trace->is_recording(); }
       virtual void add_recorder_reference(void) { /*do nothing*/ }
@@ -1178,6 +1183,10 @@ namespace Legion {
                            std::map<unsigned,
                               std::pair<unsigned,unsigned> > &crossing_counts,
                            std::vector<Instruction*> &crossing_instructions);
+      unsigned find_replay_slice_preference(Instruction *inst,
+                           const std::vector<unsigned> &gen,
+                           const std::vector<unsigned> &slice_indices_by_inst)
+                           const;
     public:
       PhysicalTrace * const trace;
     protected:
@@ -1272,9 +1281,18 @@ namespace Legion {
       // THESE ARE SHARDED FOR CONTROL REPLICATION!!!
       // Each share has a disjoint set of trace conditions that they are
       // responsible for handling checking
-      std::vector<TraceConditionSet*> preconditions; 
+      std::vector<TraceConditionSet*> preconditions;
       std::vector<TraceConditionSet*> anticonditions;
       std::vector<TraceConditionSet*> postconditions;
+      // Memoized index of the condition set that failed the most recent
+      // replay precondition check. When a template is repeatedly
+      // invalidated by the same delta (e.g. an iterative solver changing
+      // one boundary task between replays) the same condition keeps
+      // failing, so we test it first and only pay for the full sweep of
+      // analyses across all the condition sets if it passes again.
+      static const unsigned NO_FAILED_CONDITION = UINT_MAX;
+      unsigned last_failed_condition;
+      bool last_failed_anticondition;
 #ifdef LEGION_SPY
     private:
       UniqueID prev_fence_uid;
@@ -1682,6 +1700,12 @@ namespace Legion {
       friend class ShardedPhysicalTemplate;
       unsigned lhs;
       std::set<unsigned> rhs;
+      // Flattened copy of 'rhs' computed once the template has finished
+      // being optimized so that replays do not walk the set every time;
+      // when the instruction stream reaches its final form the set itself
+      // is released since its node-based storage dominates the footprint
+      // of large templates
+      std::vector<unsigned> rhs_flat;
     };
 
     /**
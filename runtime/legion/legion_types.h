@@ -109,6 +109,10 @@ template<unsigned int MAX> class SSETLBitMask;
 template<unsigned int MAX> class AVXBitMask;
 template<unsigned int MAX> class AVXTLBitMask;
 #endif
+#ifdef __AVX512F__
+template<unsigned int MAX> class AVX512BitMask;
+template<unsigned int MAX> class AVX512TLBitMask;
+#endif
 #ifdef __ALTIVEC__
 template<unsigned int MAX> class PPCBitMask;
 template<unsigned int MAX> class PPCTLBitMask;
@@ -460,6 +464,9 @@ namespace Legion {
       LG_DEFER_DELETION_COMMIT_TASK_ID,
       LG_YIELD_TASK_ID,
       LG_AUTO_TRACE_PROCESS_REPEATS_TASK_ID,
+      LG_DEFER_PROFILING_FLUSH_TASK_ID,
+      LG_PREFETCH_EQ_SET_TREE_TASK_ID,
+      LG_DEFER_REGION_TREE_FREE_TASK_ID,
       // this marks the beginning of task IDs tracked by the shutdown algorithm
       LG_BEGIN_SHUTDOWN_TASK_IDS,
       LG_RETRY_SHUTDOWN_TASK_ID = LG_BEGIN_SHUTDOWN_TASK_IDS,
@@ -562,6 +569,9 @@ namespace Legion {
         "Defer Deletion Commit",                                  \
         "Yield",                                                  \
         "Auto Trace Find Repeats",                                \
+        "Defer Profiling Flush",                                  \
+        "Prefetch Equivalence Set Tree",                          \
+        "Defer Region Tree Free",                                 \
         "Retry Shutdown",                                         \
         "Remote Message",                                         \
       };
@@ -747,6 +757,7 @@ namespace Legion {
     enum MessageKind {
       SEND_STARTUP_BARRIER,
       TASK_MESSAGE,
+      SLICE_RELAY_MESSAGE,
       STEAL_MESSAGE,
       ADVERTISEMENT_MESSAGE,
       SEND_REGISTRATION_CALLBACK,
@@ -880,6 +891,7 @@ namespace Legion {
       SEND_VIEW_REGISTER_USER,
       SEND_VIEW_FIND_COPY_PRE_REQUEST,
       SEND_VIEW_ADD_COPY_USER,
+      SEND_VIEW_INVALIDATE_READ_CACHES,
       SEND_VIEW_FIND_LAST_USERS_REQUEST,
       SEND_VIEW_FIND_LAST_USERS_RESPONSE,
       SEND_MANAGER_REQUEST,
@@ -1084,6 +1096,7 @@ namespace Legion {
       const char *name[LAST_SEND_KIND] = {                            \
         "Send Startup Barrier",                                       \
         "Task Message",                                               \
+        "Slice Relay Message",                                        \
         "Steal Message",                                              \
         "Advertisement Message",                                      \
         "Send Registration Callback",                                 \
@@ -1217,6 +1230,7 @@ namespace Legion {
         "Send View Register User",                                    \
         "Send View Find Copy Preconditions Request",                  \
         "Send View Add Copy User",                                    \
+        "Send View Invalidate Read Caches",                           \
         "Send View Find Last Users Request",                          \
         "Send View Find Last Users Response",                         \
         "Send Manager Request",                                       \
@@ -1464,6 +1478,8 @@ namespace Legion {
       MAPPER_REDISTRICT_INSTANCE_CALL,
       MAPPER_FIND_PHYSICAL_INSTANCE_CALL,
       MAPPER_FIND_PHYSICAL_INSTANCES_CALL,
+      MAPPER_FIND_DOMINANT_EQ_OWNER_CALL,
+      MAPPER_QUERY_MEMORY_PRESSURE_CALL,
       MAPPER_SET_GC_PRIORITY_CALL,
       MAPPER_ACQUIRE_INSTANCE_CALL,
       MAPPER_ACQUIRE_INSTANCES_CALL,
@@ -1697,6 +1713,8 @@ namespace Legion {
       "MapperRuntime::redistrict_instance",                           \
       "MapperRuntime::find_physical_instance",                        \
       "MapperRuntime::find_physical_instances",                       \
+      "MapperRuntime::find_dominant_equivalence_set_owner",           \
+      "MapperRuntime::query_memory_pressure",                         \
       "MapperRuntime::set_garbage_collection_priority",               \
       "MapperRuntime::acquire_instance",                              \
       "MapperRuntime::acquire_instances",                             \
@@ -2186,6 +2204,7 @@ namespace Legion {
     class BarrierAdvance;
 
     // legion_auto_trace.h
+    class TraceHasher;
     class TraceRecognizer;
 
     // region_tree.h
@@ -2710,7 +2729,21 @@ namespace Legion {
 #define LEGION_FIELD_MASK_FIELD_MASK          0x3F
 #define LEGION_FIELD_MASK_FIELD_ALL_ONES      0xFFFFFFFFFFFFFFFF
 
-#if defined(__AVX__)
+#if defined(__AVX512F__)
+#if (LEGION_MAX_FIELDS > 512)
+    typedef AVX512TLBitMask<LEGION_MAX_FIELDS> FieldMask;
+#elif (LEGION_MAX_FIELDS > 256)
+    typedef AVX512BitMask<LEGION_MAX_FIELDS> FieldMask;
+#elif (LEGION_MAX_FIELDS > 128)
+    typedef AVXBitMask<LEGION_MAX_FIELDS> FieldMask;
+#elif (LEGION_MAX_FIELDS > 64)
+    typedef SSEBitMask<LEGION_MAX_FIELDS> FieldMask;
+#else
+    typedef BitMask<LEGION_FIELD_MASK_FIELD_TYPE,LEGION_MAX_FIELDS,
+                    LEGION_FIELD_MASK_FIELD_SHIFT,
+                    LEGION_FIELD_MASK_FIELD_MASK> FieldMask;
+#endif
+#elif defined(__AVX__)
 #if (LEGION_MAX_FIELDS > 256)
     typedef AVXTLBitMask<LEGION_MAX_FIELDS> FieldMask;
 #elif (LEGION_MAX_FIELDS > 128)
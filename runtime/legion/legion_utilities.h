@@ -107,6 +107,12 @@ namespace Legion {
       template<unsigned int MAX>
       inline void serialize(const AVXTLBitMask<MAX> &mask);
 #endif
+#ifdef __AVX512F__
+      template<unsigned int MAX>
+      inline void serialize(const AVX512BitMask<MAX> &mask);
+      template<unsigned int MAX>
+      inline void serialize(const AVX512TLBitMask<MAX> &mask);
+#endif
 #ifdef __ALTIVEC__
       template<unsigned int MAX>
       inline void serialize(const PPCBitMask<MAX> &mask);
@@ -197,6 +203,12 @@ namespace Legion {
       template<unsigned int MAX>
       inline void deserialize(AVXTLBitMask<MAX> &mask);
 #endif
+#ifdef __AVX512F__
+      template<unsigned int MAX>
+      inline void deserialize(AVX512BitMask<MAX> &mask);
+      template<unsigned int MAX>
+      inline void deserialize(AVX512TLBitMask<MAX> &mask);
+#endif
 #ifdef __ALTIVEC__
       template<unsigned int MAX>
       inline void deserialize(PPCBitMask<MAX> &mask);
@@ -860,6 +872,72 @@ namespace Legion {
     private:
       uintptr_t ptr;
     };
+
+    // A small pointer map is a map from pointers to values that stores a
+    // handful of entries in-place and falls back to an open-addressed,
+    // pointer-hashed flat table once it grows past the inline capacity.
+    // It supports insertion, lookup, and iteration but not erasure, and
+    // avoids the per-node heap allocation that std::map performs on its
+    // insertion path, which matters for things like operation dependence
+    // records where most maps never exceed a few entries
+    template<typename T, typename V, unsigned INLINE = 8>
+    class SmallPointerMap {
+    public:
+      struct Entry {
+      public:
+        T *first;
+        V second;
+      };
+      class const_iterator {
+      public:
+        const_iterator(void) : current(NULL), stop(NULL) { }
+        const_iterator(const Entry *start, const Entry *bound)
+          : current(start), stop(bound) { skip_empty(); }
+      public:
+        inline const Entry& operator*(void) const { return *current; }
+        inline const Entry* operator->(void) const { return current; }
+        inline const_iterator& operator++(void)
+          { current++; skip_empty(); return *this; }
+        inline const_iterator operator++(int)
+          { const_iterator result = *this; current++; skip_empty();
+            return result; }
+        inline bool operator==(const const_iterator &rhs) const
+          { return (current == rhs.current); }
+        inline bool operator!=(const const_iterator &rhs) const
+          { return (current != rhs.current); }
+      private:
+        inline void skip_empty(void)
+          { while ((current != stop) && (current->first == NULL)) current++; }
+      private:
+        const Entry *current, *stop;
+      };
+    public:
+      inline SmallPointerMap(void);
+      SmallPointerMap(const SmallPointerMap &rhs) = delete;
+      inline SmallPointerMap(SmallPointerMap &&rhs);
+      inline ~SmallPointerMap(void);
+    public:
+      SmallPointerMap& operator=(const SmallPointerMap &rhs) = delete;
+      inline SmallPointerMap& operator=(SmallPointerMap &&rhs);
+    public:
+      inline bool empty(void) const { return (num_entries == 0); }
+      inline size_t size(void) const { return num_entries; }
+      inline void clear(void);
+      inline V& operator[](T *key);
+      inline const_iterator find(T *key) const;
+      inline const_iterator begin(void) const;
+      inline const_iterator end(void) const;
+    private:
+      inline void grow_table(void);
+      static inline size_t hash_pointer(const T *key, size_t mask);
+    private:
+      Entry inline_entries[INLINE];
+      // The overflow table is non-NULL once we exceed the inline
+      // capacity and always has a power-of-two number of slots
+      Entry *table;
+      size_t table_size;
+      size_t num_entries;
+    };
   }; // namspace Internal
 
     //--------------------------------------------------------------------------
@@ -951,6 +1029,24 @@ namespace Legion {
     }
 #endif
 
+#ifdef __AVX512F__
+    //--------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void Serializer::serialize(const AVX512BitMask<MAX> &mask)
+    //--------------------------------------------------------------------------
+    {
+      mask.serialize(*this);
+    }
+
+    //--------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void Serializer::serialize(const AVX512TLBitMask<MAX> &mask)
+    //--------------------------------------------------------------------------
+    {
+      mask.serialize(*this);
+    }
+#endif
+
 #ifdef __ALTIVEC__
     //--------------------------------------------------------------------------
     template<unsigned int MAX>
@@ -1215,6 +1311,24 @@ namespace Legion {
     }
 #endif
 
+#ifdef __AVX512F__
+    //--------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void Deserializer::deserialize(AVX512BitMask<MAX> &mask)
+    //--------------------------------------------------------------------------
+    {
+      mask.deserialize(*this);
+    }
+
+    //--------------------------------------------------------------------------
+    template<unsigned int MAX>
+    inline void Deserializer::deserialize(AVX512TLBitMask<MAX> &mask)
+    //--------------------------------------------------------------------------
+    {
+      mask.deserialize(*this);
+    }
+#endif
+
 #ifdef __ALTIVEC__
     //--------------------------------------------------------------------------
     template<unsigned int MAX>
@@ -2978,6 +3092,198 @@ namespace Legion {
       return *reinterpret_cast<const std::vector<T*>*>(ptr ^ 0x1);
     }
 
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline SmallPointerMap<T,V,INLINE>::SmallPointerMap(void)
+      : table(NULL), table_size(0), num_entries(0)
+    //--------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < INLINE; idx++)
+        inline_entries[idx].first = NULL;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline SmallPointerMap<T,V,INLINE>::SmallPointerMap(SmallPointerMap &&rhs)
+      : table(rhs.table), table_size(rhs.table_size),
+        num_entries(rhs.num_entries)
+    //--------------------------------------------------------------------------
+    {
+      for (unsigned idx = 0; idx < INLINE; idx++)
+        inline_entries[idx] = rhs.inline_entries[idx];
+      rhs.clear();
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline SmallPointerMap<T,V,INLINE>::~SmallPointerMap(void)
+    //--------------------------------------------------------------------------
+    {
+      if (table != NULL)
+        delete[] table;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline SmallPointerMap<T,V,INLINE>&
+                     SmallPointerMap<T,V,INLINE>::operator=(SmallPointerMap &&rhs)
+    //--------------------------------------------------------------------------
+    {
+      if (table != NULL)
+        delete[] table;
+      table = rhs.table;
+      table_size = rhs.table_size;
+      num_entries = rhs.num_entries;
+      for (unsigned idx = 0; idx < INLINE; idx++)
+        inline_entries[idx] = rhs.inline_entries[idx];
+      rhs.table = NULL;
+      rhs.clear();
+      return *this;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline void SmallPointerMap<T,V,INLINE>::clear(void)
+    //--------------------------------------------------------------------------
+    {
+      if (table != NULL)
+      {
+        delete[] table;
+        table = NULL;
+        table_size = 0;
+      }
+      for (unsigned idx = 0; idx < INLINE; idx++)
+        inline_entries[idx].first = NULL;
+      num_entries = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline size_t SmallPointerMap<T,V,INLINE>::hash_pointer(const T *key,
+                                                            size_t mask)
+    //--------------------------------------------------------------------------
+    {
+      // Shift off the alignment bits and mix so that nearby pointers
+      // spread out over the table
+      uintptr_t bits = reinterpret_cast<uintptr_t>(key) >> 4;
+      bits *= 0x9E3779B97F4A7C15ULL;
+      return ((bits >> 32) ^ bits) & mask;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline void SmallPointerMap<T,V,INLINE>::grow_table(void)
+    //--------------------------------------------------------------------------
+    {
+      const size_t new_size = (table == NULL) ? 4*INLINE : 2*table_size;
+      Entry *const new_table = new Entry[new_size];
+      for (size_t idx = 0; idx < new_size; idx++)
+        new_table[idx].first = NULL;
+      const Entry *const old_table = (table == NULL) ? inline_entries : table;
+      const size_t old_size = (table == NULL) ? INLINE : table_size;
+      for (size_t idx = 0; idx < old_size; idx++)
+      {
+        if (old_table[idx].first == NULL)
+          continue;
+        size_t slot = hash_pointer(old_table[idx].first, new_size - 1);
+        while (new_table[slot].first != NULL)
+          slot = (slot + 1) & (new_size - 1);
+        new_table[slot] = old_table[idx];
+      }
+      if (table != NULL)
+        delete[] table;
+      table = new_table;
+      table_size = new_size;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline V& SmallPointerMap<T,V,INLINE>::operator[](T *key)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(key != NULL);
+#endif
+      if (table == NULL)
+      {
+        // Inline entries are stored densely in insertion order
+        for (unsigned idx = 0; idx < num_entries; idx++)
+          if (inline_entries[idx].first == key)
+            return inline_entries[idx].second;
+        if (num_entries < INLINE)
+        {
+          Entry &entry = inline_entries[num_entries++];
+          entry.first = key;
+          entry.second = V();
+          return entry.second;
+        }
+        // Overflowed the inline storage so switch to the table
+        grow_table();
+      }
+      // Keep the load factor no higher than three quarters
+      else if ((4 * (num_entries + 1)) > (3 * table_size))
+        grow_table();
+      size_t slot = hash_pointer(key, table_size - 1);
+      while (table[slot].first != NULL)
+      {
+        if (table[slot].first == key)
+          return table[slot].second;
+        slot = (slot + 1) & (table_size - 1);
+      }
+      Entry &entry = table[slot];
+      entry.first = key;
+      entry.second = V();
+      num_entries++;
+      return entry.second;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline typename SmallPointerMap<T,V,INLINE>::const_iterator
+                            SmallPointerMap<T,V,INLINE>::find(T *key) const
+    //--------------------------------------------------------------------------
+    {
+      if (table == NULL)
+      {
+        for (unsigned idx = 0; idx < num_entries; idx++)
+          if (inline_entries[idx].first == key)
+            return const_iterator(inline_entries + idx,
+                                  inline_entries + num_entries);
+        return end();
+      }
+      size_t slot = hash_pointer(key, table_size - 1);
+      while (table[slot].first != NULL)
+      {
+        if (table[slot].first == key)
+          return const_iterator(table + slot, table + table_size);
+        slot = (slot + 1) & (table_size - 1);
+      }
+      return end();
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline typename SmallPointerMap<T,V,INLINE>::const_iterator
+                                  SmallPointerMap<T,V,INLINE>::begin(void) const
+    //--------------------------------------------------------------------------
+    {
+      if (table == NULL)
+        return const_iterator(inline_entries, inline_entries + num_entries);
+      return const_iterator(table, table + table_size);
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T, typename V, unsigned INLINE>
+    inline typename SmallPointerMap<T,V,INLINE>::const_iterator
+                                    SmallPointerMap<T,V,INLINE>::end(void) const
+    //--------------------------------------------------------------------------
+    {
+      if (table == NULL)
+        return const_iterator(inline_entries + num_entries,
+                              inline_entries + num_entries);
+      return const_iterator(table + table_size, table + table_size);
+    }
+
     //--------------------------------------------------------------------------
     template<typename T>
     inline void compute_field_sets(FieldMask universe_mask,
@@ -3187,8 +3493,103 @@ namespace Legion {
     }
 
     /**
-     * \class FieldMaskSet 
-     * A template helper class for tracking collections of 
+     * \class SmallVector
+     * A vector with inline storage for its first N elements that only
+     * falls back to a heap allocation once it grows beyond N. The heap
+     * allocations go through the LegionAllocator so they participate in
+     * the usual allocation tracking. This is intended for hot paths that
+     * build small scratch collections (e.g. the epoch user filtering in
+     * the views) where the common case fits in the inline storage and
+     * we want to avoid pointer-chasing a heap-allocated buffer.
+     */
+    template<typename T, unsigned N, AllocationType A = UNTRACKED_ALLOC>
+    class SmallVector {
+    public:
+      typedef T* iterator;
+      typedef const T* const_iterator;
+    public:
+      SmallVector(void)
+        : heap_elements(NULL), num_elements(0), capacity(N) { }
+      SmallVector(const SmallVector &rhs) = delete;
+      SmallVector& operator=(const SmallVector &rhs) = delete;
+      ~SmallVector(void)
+      {
+        clear();
+        if (heap_elements != NULL)
+          LegionAllocator<T,A>().deallocate(heap_elements, capacity);
+      }
+    public:
+      inline bool empty(void) const { return (num_elements == 0); }
+      inline size_t size(void) const { return num_elements; }
+      inline T& operator[](unsigned idx) { return elements()[idx]; }
+      inline const T& operator[](unsigned idx) const
+        { return elements()[idx]; }
+      inline T& back(void) { return elements()[num_elements-1]; }
+      inline const T& back(void) const { return elements()[num_elements-1]; }
+      inline iterator begin(void) { return elements(); }
+      inline iterator end(void) { return elements() + num_elements; }
+      inline const_iterator begin(void) const { return elements(); }
+      inline const_iterator end(void) const
+        { return elements() + num_elements; }
+    public:
+      inline void push_back(const T &value)
+      {
+        if (num_elements == capacity)
+          grow();
+        ::new (static_cast<void*>(elements() + num_elements)) T(value);
+        num_elements++;
+      }
+      inline void pop_back(void)
+      {
+        num_elements--;
+        elements()[num_elements].~T();
+      }
+      inline void clear(void)
+      {
+        T *elems = elements();
+        for (unsigned idx = 0; idx < num_elements; idx++)
+          elems[idx].~T();
+        num_elements = 0;
+      }
+    private:
+      inline T* elements(void)
+      {
+        if (heap_elements != NULL)
+          return heap_elements;
+        return reinterpret_cast<T*>(inline_elements);
+      }
+      inline const T* elements(void) const
+      {
+        if (heap_elements != NULL)
+          return heap_elements;
+        return reinterpret_cast<const T*>(inline_elements);
+      }
+      void grow(void)
+      {
+        const unsigned new_capacity = 2 * capacity;
+        T *new_elements = LegionAllocator<T,A>().allocate(new_capacity);
+        T *old_elements = elements();
+        for (unsigned idx = 0; idx < num_elements; idx++)
+        {
+          ::new (static_cast<void*>(new_elements + idx))
+            T(std::move(old_elements[idx]));
+          old_elements[idx].~T();
+        }
+        if (heap_elements != NULL)
+          LegionAllocator<T,A>().deallocate(heap_elements, capacity);
+        heap_elements = new_elements;
+        capacity = new_capacity;
+      }
+    private:
+      alignas(T) char inline_elements[N * sizeof(T)];
+      T *heap_elements;
+      unsigned num_elements;
+      unsigned capacity;
+    };
+
+    /**
+     * \class FieldMaskSet
+     * A template helper class for tracking collections of
      * objects associated with different sets of fields
      */
     template<typename T, AllocationType A = UNTRACKED_ALLOC,
@@ -390,7 +390,7 @@ namespace Legion {
         if (non_dominated != current_to_filter.get_valid_mask())
         {
           // Selectively filter
-          std::vector<PhysicalUser*> to_delete;
+          SmallVector<PhysicalUser*,4> to_delete;
           for (FieldMaskSet<PhysicalUser>::iterator it =
                 current_to_filter.begin(); it != current_to_filter.end(); it++)
           {
@@ -398,7 +398,7 @@ namespace Legion {
             if (!it->second)
               to_delete.push_back(it->first);
           }
-          for (std::vector<PhysicalUser*>::const_iterator it =
+          for (SmallVector<PhysicalUser*,4>::const_iterator it =
                 to_delete.begin(); it != to_delete.end(); it++)
           {
             current_to_filter.erase(*it);
@@ -780,7 +780,7 @@ namespace Legion {
       if (!subviews.empty() && !(subviews.get_valid_mask() * subview_mask))
       {
         bool need_tighten = true;
-        std::vector<ExprView*> to_delete;
+        SmallVector<ExprView*,4> to_delete;
         FieldMaskSet<ExprView> dominating_subviews;
 
         for (FieldMaskSet<ExprView>::iterator it = 
@@ -869,7 +869,7 @@ namespace Legion {
         }
         if (!to_delete.empty())
         {
-          for (std::vector<ExprView*>::const_iterator it = 
+          for (SmallVector<ExprView*,4>::const_iterator it =
                 to_delete.begin(); it != to_delete.end(); it++)
           {
             subviews.erase(*it);
@@ -1028,7 +1028,7 @@ namespace Legion {
       // No need to hold the lock for this part we know that no one
       // is going to be modifying this data structure at the same time
       FieldMaskSet<ExprView> new_subviews;
-      std::vector<ExprView*> to_delete;
+      SmallVector<ExprView*,4> to_delete;
       for (FieldMaskSet<ExprView>::iterator it = subviews.begin();
             it != subviews.end(); it++)
       {
@@ -1069,7 +1069,7 @@ namespace Legion {
       subviews.swap(new_subviews);
       if (!to_delete.empty())
       {
-        for (std::vector<ExprView*>::const_iterator it = 
+        for (SmallVector<ExprView*,4>::const_iterator it =
               to_delete.begin(); it != to_delete.end(); it++)
           if ((*it)->remove_reference())
             delete (*it);
@@ -1391,7 +1391,8 @@ namespace Legion {
         manager(man), logical_owner(log_owner), current_users(
         (log_owner == local_space) ? new ExprView(this->did, rt->forest, 
           manager->instance_domain, manager->is_unbound()) : NULL),
-        expr_cache_uses(0), outstanding_additions(0)
+        expr_cache_uses(0), outstanding_additions(0),
+        has_read_subscribers(false)
     //--------------------------------------------------------------------------
     {
 #ifdef DEBUG_LEGION
@@ -2037,9 +2038,13 @@ namespace Legion {
                             op_id, index, wait_on_events, trace_info.recording);
         }
         // Add our local user
-        add_internal_task_user(usage, user_expr, user_mask, term_event, 
+        add_internal_task_user(usage, user_expr, user_mask, term_event,
                                op_id, index);
-        manager->record_instance_user(term_event, applied_events); 
+        // If this user mutates the instance then any cached read
+        // preconditions on remote nodes are now stale
+        if (!IS_READ_ONLY(usage))
+          invalidate_remote_read_caches(user_mask, applied_events);
+        manager->record_instance_user(term_event, applied_events);
         // At this point tasks shouldn't be allowed to wait on themselves
 #ifdef DEBUG_LEGION
         if (term_event.exists())
@@ -2065,6 +2070,18 @@ namespace Legion {
     {
       if (!is_logical_owner())
       {
+        // Check to see if we have a cached precondition from the owner
+        // that is still valid so we can answer this query locally; the
+        // owner will have invalidated our cache if any user was added
+        // since then that mutates the instance
+        const bool cacheable = reading && (redop == 0) && !trace_info.recording;
+        if (cacheable)
+        {
+          ApEvent cached_event;
+          if (find_cached_read_precondition(copy_expr->expr_id, copy_mask,
+                                            cached_event))
+            return cached_event;
+        }
         // Check to see if there are any replicated fields here which we
         // can handle locally so we don't have to send a message to the owner
         ApEvent result_event;
@@ -2091,6 +2108,11 @@ namespace Legion {
             rez.serialize(applied);
             trace_info.pack_trace_info(rez);
           }
+          // Record the cache entry before sending the request so that an
+          // invalidation racing ahead of the response cannot miss it
+          if (cacheable)
+            record_cached_read_precondition(copy_expr->expr_id, copy_mask,
+                                            ready_event);
           runtime->send_view_find_copy_preconditions_request(logical_owner,rez);
           applied_events.insert(applied);
           result_event = ready_event;
@@ -2164,12 +2186,163 @@ namespace Legion {
         const RegionUsage usage(reading ? LEGION_READ_ONLY : 
             (redop > 0) ? LEGION_REDUCE : LEGION_READ_WRITE, 
             (redop > 0) ? LEGION_ATOMIC : LEGION_EXCLUSIVE, redop);
-        add_internal_copy_user(usage, copy_expr, copy_mask, term_event, 
+        add_internal_copy_user(usage, copy_expr, copy_mask, term_event,
                                op_id, index);
+        // If this user mutates the instance then any cached read
+        // preconditions on remote nodes are now stale
+        if (!reading)
+          invalidate_remote_read_caches(copy_mask, applied_events);
         manager->record_instance_user(term_event, applied_events);
       }
     }
 
+    //--------------------------------------------------------------------------
+    bool IndividualView::find_cached_read_precondition(
+          IndexSpaceExprID expr_id, const FieldMask &mask, ApEvent &result) const
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(!is_logical_owner());
+#endif
+      AutoLock v_lock(view_lock,1,false/*exclusive*/);
+      std::map<IndexSpaceExprID,EventFieldMap>::const_iterator finder =
+        cached_read_preconditions.find(expr_id);
+      if (finder == cached_read_preconditions.end())
+        return false;
+      for (EventFieldMap::const_iterator it =
+            finder->second.begin(); it != finder->second.end(); it++)
+      {
+        if (!(mask - it->second))
+        {
+          result = it->first;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    //--------------------------------------------------------------------------
+    void IndividualView::record_cached_read_precondition(
+                IndexSpaceExprID expr_id, const FieldMask &mask, ApEvent ready)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(!is_logical_owner());
+#endif
+      AutoLock v_lock(view_lock);
+      EventFieldMap &events = cached_read_preconditions[expr_id];
+      // Don't let the cache grow without bound in the case where the
+      // expressions or fields being read change over time
+      if (events.size() >= MAX_CACHED_READ_EVENTS)
+        events.clear();
+      events[ready] |= mask;
+    }
+
+    //--------------------------------------------------------------------------
+    void IndividualView::invalidate_cached_read_preconditions(
+                                                          const FieldMask &mask)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(!is_logical_owner());
+#endif
+      AutoLock v_lock(view_lock);
+      std::map<IndexSpaceExprID,EventFieldMap>::iterator eit =
+        cached_read_preconditions.begin();
+      while (eit != cached_read_preconditions.end())
+      {
+        EventFieldMap::iterator it = eit->second.begin();
+        while (it != eit->second.end())
+        {
+          it->second -= mask;
+          if (!it->second)
+          {
+            EventFieldMap::iterator to_delete = it++;
+            eit->second.erase(to_delete);
+          }
+          else
+            it++;
+        }
+        if (eit->second.empty())
+        {
+          std::map<IndexSpaceExprID,EventFieldMap>::iterator to_delete = eit++;
+          cached_read_preconditions.erase(to_delete);
+        }
+        else
+          eit++;
+      }
+    }
+
+    //--------------------------------------------------------------------------
+    void IndividualView::record_remote_read_subscriber(
+                              AddressSpaceID subscriber, const FieldMask &mask)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(is_logical_owner());
+      assert(subscriber != local_space);
+#endif
+      AutoLock v_lock(view_lock);
+      remote_read_subscribers[subscriber] |= mask;
+      // Note we never reset this flag once it is set, which is safe
+      // because subscriptions are sticky until invalidated
+      if (!has_read_subscribers.load())
+        has_read_subscribers.store(true);
+    }
+
+    //--------------------------------------------------------------------------
+    void IndividualView::invalidate_remote_read_caches(const FieldMask &mask,
+                                            std::set<RtEvent> &applied_events)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(is_logical_owner());
+#endif
+      // Common case: no node has ever cached read preconditions
+      if (!has_read_subscribers.load())
+        return;
+      std::vector<AddressSpaceID> to_invalidate;
+      {
+        AutoLock v_lock(view_lock);
+        LegionMap<AddressSpaceID,FieldMask>::iterator it =
+          remote_read_subscribers.begin();
+        while (it != remote_read_subscribers.end())
+        {
+          if (it->second * mask)
+          {
+            it++;
+            continue;
+          }
+          to_invalidate.push_back(it->first);
+          it->second -= mask;
+          if (!it->second)
+          {
+            LegionMap<AddressSpaceID,FieldMask>::iterator to_delete = it++;
+            remote_read_subscribers.erase(to_delete);
+          }
+          else
+            it++;
+        }
+      }
+      // The acknowledgements are applied effects of whatever operation
+      // added the mutating user so that no operation that depends on it
+      // can map on a remote node before its cache has been invalidated
+      for (std::vector<AddressSpaceID>::const_iterator it =
+            to_invalidate.begin(); it != to_invalidate.end(); it++)
+      {
+        const RtUserEvent done = Runtime::create_rt_user_event();
+        Serializer rez;
+        {
+          RezCheck z(rez);
+          rez.serialize(did);
+          rez.serialize(mask);
+          rez.serialize(done);
+        }
+        runtime->send_view_invalidate_read_caches(*it, rez);
+        applied_events.insert(done);
+      }
+    }
+
     //--------------------------------------------------------------------------
     void IndividualView::find_last_users(PhysicalManager *instance,
                                       std::set<ApEvent> &events,
@@ -3124,13 +3297,38 @@ namespace Legion {
                                          std::vector<Reservation> &reservations)
     //--------------------------------------------------------------------------
     {
-      const RtEvent ready = 
+      const uint64_t hash_key = mask.get_hash_key();
+      // First check to see if we've memoized this result
+      {
+        AutoLock v_lock(view_lock,1,false/*exclusive*/);
+        std::map<LEGION_FIELD_MASK_FIELD_TYPE,LegionList<std::pair<FieldMask,
+          std::vector<Reservation> > > >::const_iterator finder =
+            reservation_cache.find(hash_key);
+        if (finder != reservation_cache.end())
+        {
+          for (LegionList<std::pair<FieldMask,std::vector<Reservation> > >::
+                const_iterator it = finder->second.begin();
+                it != finder->second.end(); it++)
+          {
+            if (it->first == mask)
+            {
+              reservations = it->second;
+              return;
+            }
+          }
+        }
+      }
+      const RtEvent ready =
         find_field_reservations(mask, &reservations, runtime->address_space);
       if (ready.exists() && !ready.has_triggered())
         ready.wait();
       // Sort them into order if necessary
       if (reservations.size() > 1)
         std::sort(reservations.begin(), reservations.end());
+      // Save the result in the cache, duplicates from races here are benign
+      AutoLock v_lock(view_lock);
+      reservation_cache[hash_key].push_back(
+          std::pair<FieldMask,std::vector<Reservation> >(mask, reservations));
     }
 
     //--------------------------------------------------------------------------
@@ -3329,6 +3527,11 @@ namespace Legion {
       if (ready.exists() && !ready.has_triggered())
         ready.wait();
       IndividualView *inst_view = view->as_individual_view();
+      // Record the requester as a caching reader before computing the
+      // preconditions so that any mutating user added afterwards is
+      // guaranteed to send it an invalidation
+      if (reading && (redop == 0) && !trace_info.recording)
+        inst_view->record_remote_read_subscriber(source, copy_mask);
       const ApEvent pre = inst_view->find_copy_preconditions(reading, redop,
           copy_mask, copy_expr, op_id, index, applied_events, trace_info);
       Runtime::trigger_event(to_trigger, pre, trace_info, applied_events);
@@ -3385,6 +3588,30 @@ namespace Legion {
         Runtime::trigger_event(applied_event);
     }
 
+    //--------------------------------------------------------------------------
+    /*static*/ void IndividualView::handle_view_invalidate_read_caches(
+                                        Deserializer &derez, Runtime *runtime)
+    //--------------------------------------------------------------------------
+    {
+      DerezCheck z(derez);
+      DistributedID did;
+      derez.deserialize(did);
+      RtEvent ready = RtEvent::NO_RT_EVENT;
+      LogicalView *view = runtime->find_or_request_logical_view(did, ready);
+      FieldMask mask;
+      derez.deserialize(mask);
+      RtUserEvent done;
+      derez.deserialize(done);
+
+      if (ready.exists() && !ready.has_triggered())
+        ready.wait();
+#ifdef DEBUG_LEGION
+      assert(view->is_individual_view());
+#endif
+      view->as_individual_view()->invalidate_cached_read_preconditions(mask);
+      Runtime::trigger_event(done);
+    }
+
     //--------------------------------------------------------------------------
     void IndividualView::handle_view_find_last_users_request(
                    Deserializer &derez, Runtime *runtime, AddressSpaceID source)
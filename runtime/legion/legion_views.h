@@ -313,6 +313,22 @@ namespace Legion {
                                    const FieldMask &mask,
                                    IndexSpaceExpression *user_expr,
                                    std::vector<RtEvent> &applied) const;
+    public:
+      // Methods for maintaining cached read-only copy preconditions on
+      // remote nodes so that repeatedly-read instances do not need to
+      // query the logical owner for every reading copy
+      void record_remote_read_subscriber(AddressSpaceID subscriber,
+                                         const FieldMask &mask);
+      void invalidate_remote_read_caches(const FieldMask &mask,
+                                         std::set<RtEvent> &applied_events);
+    protected:
+      bool find_cached_read_precondition(IndexSpaceExprID expr_id,
+                                         const FieldMask &mask,
+                                         ApEvent &result) const;
+      void record_cached_read_precondition(IndexSpaceExprID expr_id,
+                                           const FieldMask &mask,
+                                           ApEvent ready);
+      void invalidate_cached_read_preconditions(const FieldMask &mask);
     public:
       void pack_fields(Serializer &rez,
                        const std::vector<CopySrcDstField> &fields) const;
@@ -381,6 +397,8 @@ namespace Legion {
                         Runtime *runtime, AddressSpaceID source);
       static void handle_view_add_copy_user(Deserializer &derez,
                         Runtime *runtime, AddressSpaceID source);
+      static void handle_view_invalidate_read_caches(Deserializer &derez,
+                        Runtime *runtime);
       static void handle_view_find_last_users_request(Deserializer &derz,
                         Runtime *runtime, AddressSpaceID source);
       static void handle_view_find_last_users_response(Deserializer &derez);
@@ -414,6 +432,26 @@ namespace Legion {
       std::atomic<unsigned> outstanding_additions;
       RtUserEvent clean_waiting;
       std::map<unsigned,Reservation> view_reservations;
+      // Memoized sorted reservation vectors so repeated reduction copies
+      // with the same fields skip the per-field lookup and sort, keyed by
+      // the hash of the field mask (same scheme as the compressed mask
+      // cache in LayoutDescription); safe because reservations for a
+      // field are never removed during the lifetime of the view
+      std::map<LEGION_FIELD_MASK_FIELD_TYPE,
+               LegionList<std::pair<FieldMask,std::vector<Reservation> > > >
+        reservation_cache;
+    protected:
+      // On the logical owner: the nodes that have cached read-only copy
+      // preconditions for this view and the fields those caches cover,
+      // invalidated whenever a mutating user is added to the view
+      LegionMap<AddressSpaceID,FieldMask> remote_read_subscribers;
+      // Quick test to elide the lock when no node has ever subscribed
+      std::atomic<bool> has_read_subscribers;
+      // On remote nodes: read-only copy preconditions previously computed
+      // by the logical owner, valid until the owner sends an invalidation
+      std::map<IndexSpaceExprID,EventFieldMap> cached_read_preconditions;
+      // Bound the number of cached events we keep for any one expression
+      static constexpr unsigned MAX_CACHED_READ_EVENTS = 32;
     protected:
       // This is an infrequently used data structure for handling collective
       // register user calls on individual managers that occurs with certain
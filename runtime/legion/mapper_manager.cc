@@ -37,7 +37,7 @@ namespace Legion {
         kind(k), operation(op), acquired_instances((op == NULL) ? NULL :
             operation->get_acquired_instances_ref()), profiling_ranges(NULL),
         start_time(0), reentrant(manager->initially_reentrant), paused(false),
-        runtime_call(false), priority(prioritize)
+        runtime_call(false), mapper_locked(false), priority(prioritize)
     //--------------------------------------------------------------------------
     {
 #ifdef DEBUG_LEGION
@@ -1383,6 +1383,9 @@ namespace Legion {
                         "Invalid duplicate mapper lock request in mapper call "
                         "%s for mapper %s", get_mapper_call_name(info->kind),
                         mapper->get_mapper_name())
+        // Record that this call holds (or is waiting to hold) the lock
+        // so that finish_mapper_call knows it has cleanup to perform
+        info->mapper_locked = true;
         switch (lock_state)
         {
           case UNLOCKED_STATE:
@@ -1442,6 +1445,7 @@ namespace Legion {
                         get_mapper_call_name(info->kind),
                         mapper->get_mapper_name())
         current_holders.erase(finder);
+        info->mapper_locked = false;
         // See if we can now give the lock to someone else
         if (current_holders.empty())
           release_lock(to_trigger);
@@ -1518,12 +1522,18 @@ namespace Legion {
         implicit_profiler->record_mapper_call(mapper_id, processor, info->kind,
             (info->operation == NULL) ? 0 : info->operation->get_unique_op_id(),
             info->start_time, Realm::Clock::current_time_in_nanoseconds());
+      // In the common case of a mapper call that never locked the mapper
+      // we can skip taking the mapper lock entirely since there is no
+      // bookkeeping for us to clean up. Only the thread performing this
+      // call ever writes 'mapper_locked' so this test is race free.
+      if (!info->mapper_locked)
+        return;
       std::vector<RtUserEvent> to_trigger;
       {
         AutoLock m_lock(mapper_lock);
         // Check to see if we need to release the lock for the mapper call
-        std::set<MappingCallInfo*>::iterator finder = 
-            current_holders.find(info);     
+        std::set<MappingCallInfo*>::iterator finder =
+            current_holders.find(info);
         if (finder != current_holders.end())
         {
           current_holders.erase(finder);
@@ -459,6 +459,10 @@ namespace Legion {
       bool                              paused;
       // Whether we're inside a runtime call from the mapper
       bool                              runtime_call;
+      // Whether this call currently holds the mapper lock in the
+      // concurrent synchronization model, only ever accessed by the
+      // thread performing this mapper call so no synchronization needed
+      bool                              mapper_locked;
       const bool                        priority;
     };
 
@@ -1398,7 +1398,14 @@ namespace Legion {
           {
             RegionNode *node = get_node(handle);
             if (node->remove_base_gc_ref(APPLICATION_REF))
-              delete node;
+            {
+              // Defer the actual tear-down of the tree to the background
+              // cleanup lane: regridding applications destroy and recreate
+              // whole trees at once and the recursive freeing is pure
+              // cleanup that nothing needs to wait behind
+              DeferRegionTreeFreeArgs args(node);
+              runtime->issue_runtime_meta_task(args, LG_LOW_PRIORITY);
+            }
           }
         }
         else
@@ -1415,13 +1422,27 @@ namespace Legion {
         {
           RegionNode *node = get_node(handle);
           if (node->remove_base_gc_ref(APPLICATION_REF))
-            delete node;
+          {
+            // See the comment above about deferring the tear-down
+            DeferRegionTreeFreeArgs args(node);
+            runtime->issue_runtime_meta_task(args, LG_LOW_PRIORITY);
+          }
         }
         else
           runtime->send_logical_region_destruction(handle, owner_space,applied);
       }
     }
 
+    //--------------------------------------------------------------------------
+    /*static*/ void RegionTreeForest::handle_defer_region_tree_free(
+                                                               const void *args)
+    //--------------------------------------------------------------------------
+    {
+      const DeferRegionTreeFreeArgs *dargs =
+        (const DeferRegionTreeFreeArgs*)args;
+      delete dargs->node;
+    }
+
     //--------------------------------------------------------------------------
     LogicalPartition RegionTreeForest::get_logical_partition(
                                     LogicalRegion parent, IndexPartition handle)
@@ -1594,6 +1615,10 @@ namespace Legion {
       // If this is a NO_ACCESS, then we'll have no dependences so we're done
       if (IS_NO_ACCESS(req))
         return;
+      // Record any writing requirements so applications doing incremental
+      // checkpointing can ask which fields might have changed
+      if (HAS_WRITE(req))
+        op->get_context()->record_field_writes(req);
 
       ProjectionType htype = req.handle_type;
       bool is_ispace_htype = (htype == LEGION_SINGULAR_PROJECTION ||
@@ -1605,13 +1630,16 @@ namespace Legion {
         get_node(req.region.get_index_space()) :
         (IndexTreeNode *)get_node(req.partition.get_index_partition());
 
-      RegionNode *parent_node = get_node(req.parent);
+      // Resolve the parent node and user mask through the logical analysis
+      // so repeated lookups are amortized across all the requirements of
+      // the operation being analyzed
+      RegionNode *parent_node = logical_analysis.find_parent_node(req.parent);
 
       RegionTreePath path;
       initialize_path(child_node, parent_node->row_source, path);
 
-      FieldMask user_mask = 
-        parent_node->column_source->get_field_mask(req.privilege_fields);
+      const FieldMask user_mask = logical_analysis.find_user_mask(
+          req.parent, parent_node, req.privilege_fields);
       LogicalTraceInfo trace_info(op, idx, req, user_mask);
       if (trace_info.skip_analysis)
         return;
@@ -3730,16 +3758,23 @@ namespace Legion {
       if (!space.exists())
         REPORT_LEGION_ERROR(ERROR_INVALID_REQUEST_FOR_INDEXSPACE,
           "Invalid request for IndexSpace NO_SPACE.")
+      // Wait-free fast path for nodes we've looked up before
+      IndexSpaceNode *cached = index_node_cache.find(space);
+      if (cached != NULL)
+        return cached;
       RtEvent wait_on;
       IndexSpaceNode *result = NULL;
       {
-        AutoLock l_lock(lookup_lock,1,false/*exclusive*/); 
-        std::map<IndexSpace,IndexSpaceNode*>::const_iterator finder = 
+        AutoLock l_lock(lookup_lock,1,false/*exclusive*/);
+        std::map<IndexSpace,IndexSpaceNode*>::const_iterator finder =
           index_nodes.find(space);
         if (finder != index_nodes.end())
         {
           if (!finder->second->initialized.exists())
+          {
+            index_node_cache.insert(space, finder->second);
             return finder->second;
+          }
           if ((defer != NULL) && !finder->second->initialized.has_triggered())
           {
             *defer = finder->second->initialized;
@@ -3873,6 +3908,10 @@ namespace Legion {
       if (!part.exists())
         REPORT_LEGION_ERROR(ERROR_INVALID_REQUEST_INDEXPARTITION,
           "Invalid request for IndexPartition NO_PART.")
+      // Wait-free fast path for nodes we've looked up before
+      IndexPartNode *cached = index_part_cache.find(part);
+      if (cached != NULL)
+        return cached;
       RtEvent wait_on;
       IndexPartNode *result = NULL;
       {
@@ -3882,7 +3921,10 @@ namespace Legion {
         if (finder != index_parts.end())
         {
           if (!finder->second->initialized.exists())
+          {
+            index_part_cache.insert(part, finder->second);
             return finder->second;
+          }
           if ((defer != NULL) && !finder->second->initialized.has_triggered())
           {
             *defer = finder->second->initialized;
@@ -4014,16 +4056,23 @@ namespace Legion {
       if (!space.exists())
         REPORT_LEGION_ERROR(ERROR_INVALID_REQUEST_FIELDSPACE,
           "Invalid request for FieldSpace NO_SPACE.")
+      // Wait-free fast path for nodes we've looked up before
+      FieldSpaceNode *cached = field_node_cache.find(space);
+      if (cached != NULL)
+        return cached;
       RtEvent wait_on;
       FieldSpaceNode *result = NULL;
       {
         AutoLock l_lock(lookup_lock,1,false/*exclusive*/);
-        std::map<FieldSpace,FieldSpaceNode*>::const_iterator finder = 
+        std::map<FieldSpace,FieldSpaceNode*>::const_iterator finder =
           field_nodes.find(space);
         if (finder != field_nodes.end())
         {
           if (!finder->second->initialized.exists())
+          {
+            field_node_cache.insert(space, finder->second);
             return finder->second;
+          }
           if ((defer != NULL) && !finder->second->initialized.has_triggered())
           {
             *defer = finder->second->initialized;
@@ -4150,18 +4199,25 @@ namespace Legion {
       if (!handle.exists())
         REPORT_LEGION_ERROR(ERROR_INVALID_REQUEST_LOGICALREGION,
           "Invalid request for LogicalRegion NO_REGION.")
+      // Wait-free fast path for nodes we've looked up before
+      RegionNode *cached = region_node_cache.find(handle);
+      if (cached != NULL)
+        return cached;
       // Check to see if the node already exists
       RtEvent wait_on;
       RegionNode *result = NULL;
       bool has_top_level_region = false;
       {
         AutoLock l_lock(lookup_lock,1,false/*exclusive*/);
-        std::map<LogicalRegion,RegionNode*>::const_iterator finder = 
+        std::map<LogicalRegion,RegionNode*>::const_iterator finder =
           region_nodes.find(handle);
         if (finder != region_nodes.end())
         {
           if (!finder->second->initialized.exists())
+          {
+            region_node_cache.insert(handle, finder->second);
             return finder->second;
+          }
           wait_on = finder->second->initialized;
           result = finder->second;
         }
@@ -4321,6 +4377,10 @@ namespace Legion {
       if (!handle.exists())
         REPORT_LEGION_ERROR(ERROR_INVALID_REQUEST_LOGICALPARTITION,
           "Invalid request for LogicalPartition NO_PART.")
+      // Wait-free fast path for nodes we've looked up before
+      PartitionNode *cached = part_node_cache.find(handle);
+      if (cached != NULL)
+        return cached;
       RtEvent wait_on;
       PartitionNode *result = NULL;
       // Check to see if the node already exists
@@ -4336,7 +4396,10 @@ namespace Legion {
             result = it->second;
           }
           else
+          {
+            part_node_cache.insert(handle, it->second);
             return it->second;
+          }
         }
       }
       if (result != NULL)
@@ -4384,16 +4447,23 @@ namespace Legion {
         REPORT_LEGION_ERROR(ERROR_INVALID_REQUEST_TREE_ID,
           "Invalid request for tree ID 0 which is never a tree ID")
       }
+      // Wait-free fast path for trees we've looked up before
+      RegionNode *cached = tree_node_cache.find(tid);
+      if (cached != NULL)
+        return cached;
       RtEvent wait_on;
       RegionNode *result = NULL;
       {
         AutoLock l_lock(lookup_lock,1,false/*exclusive*/);
-        std::map<RegionTreeID,RegionNode*>::const_iterator finder = 
+        std::map<RegionTreeID,RegionNode*>::const_iterator finder =
           tree_nodes.find(tid);
         if (finder != tree_nodes.end())
         {
           if (!finder->second->initialized.exists())
+          {
+            tree_node_cache.insert(tid, finder->second);
             return finder->second;
+          }
           wait_on = finder->second->initialized;
           result = finder->second;
         }
@@ -4531,6 +4601,7 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock l_lock(lookup_lock);
+      index_node_cache.remove(space);
 #ifdef DEBUG_LEGION
       std::map<IndexSpace,IndexSpaceNode*>::iterator finder = 
         index_nodes.find(space);
@@ -4546,6 +4617,7 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock l_lock(lookup_lock);
+      index_part_cache.remove(part);
 #ifdef DEBUG_LEGION
       assert(index_part_requests.find(part) == index_part_requests.end());
       std::map<IndexPartition,IndexPartNode*>::iterator finder = 
@@ -4562,6 +4634,7 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock l_lock(lookup_lock);
+      field_node_cache.remove(space);
 #ifdef DEBUG_LEGION
       std::map<FieldSpace,FieldSpaceNode*>::iterator finder = 
         field_nodes.find(space);
@@ -4577,6 +4650,9 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock l_lock(lookup_lock);
+      region_node_cache.remove(handle);
+      if (top)
+        tree_node_cache.remove(handle.get_tree_id());
 #ifdef DEBUG_LEGION
       if (top)
       {
@@ -4602,7 +4678,8 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock l_lock(lookup_lock);
-      std::map<LogicalPartition,PartitionNode*>::iterator finder = 
+      part_node_cache.remove(handle);
+      std::map<LogicalPartition,PartitionNode*>::iterator finder =
         part_nodes.find(handle);
 #ifdef DEBUG_LEGION
       assert(finder != part_nodes.end());
@@ -5386,7 +5463,12 @@ namespace Legion {
         IndexSpaceExpression *lhs_canon = lhs->get_canonical_expression(this);
         IndexSpaceExpression *rhs_canon = rhs->get_canonical_expression(this);
         if (lhs_canon == rhs_canon)
+        {
+          // Congruent expressions so the result is the same as the inputs
+          lhs->add_base_expression_reference(LIVE_EXPR_REF);
+          ImplicitReferenceTracker::record_live_expression(lhs);
           return lhs;
+        }
         std::vector<IndexSpaceExpression*> exprs(2);
         if (compare_expressions(lhs_canon, rhs_canon))
         {
@@ -5676,7 +5758,12 @@ namespace Legion {
         IndexSpaceExpression *lhs_canon = lhs->get_canonical_expression(this);
         IndexSpaceExpression *rhs_canon = rhs->get_canonical_expression(this);
         if (lhs_canon == rhs_canon)
+        {
+          // Congruent expressions so the result is the same as the inputs
+          lhs->add_base_expression_reference(LIVE_EXPR_REF);
+          ImplicitReferenceTracker::record_live_expression(lhs);
           return lhs;
+        }
         std::vector<IndexSpaceExpression*> exprs(2);
         if (compare_expressions(lhs_canon, rhs_canon))
         {
@@ -6066,8 +6153,10 @@ namespace Legion {
       if (expr->is_empty())
         return expr;
       const uint64_t hash_key = expr->get_canonical_hash();
-      AutoLock c_lock(congruence_lock);
-      return expr->find_congruent_expression(canonical_expressions[hash_key]);
+      const unsigned shard = hash_key % NUM_CONGRUENCE_SHARDS;
+      AutoLock c_lock(congruence_locks[shard]);
+      return expr->find_congruent_expression(
+          canonical_expressions[shard][hash_key]);
     }
 
     //--------------------------------------------------------------------------
@@ -6079,11 +6168,12 @@ namespace Legion {
       if (expr->is_empty())
         return;
       const uint64_t hash_key = expr->get_canonical_hash();
-      AutoLock c_lock(congruence_lock);
+      const unsigned shard = hash_key % NUM_CONGRUENCE_SHARDS;
+      AutoLock c_lock(congruence_locks[shard]);
       std::unordered_map<uint64_t,CanonicalSet>::iterator finder =
-        canonical_expressions.find(hash_key);
+        canonical_expressions[shard].find(hash_key);
 #ifdef DEBUG_LEGION
-      assert(finder != canonical_expressions.end());
+      assert(finder != canonical_expressions[shard].end());
 #ifndef NDEBUG
       const bool found = 
 #endif
@@ -6093,7 +6183,7 @@ namespace Legion {
       assert(found);
 #endif
       if (finder->second.empty())
-        canonical_expressions.erase(finder);
+        canonical_expressions[shard].erase(finder);
     }
 
     //--------------------------------------------------------------------------
@@ -6579,6 +6669,21 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    /*static*/ bool IndexSpaceExpression::definitely_disjoint(
+                          IndexSpaceExpression *lhs, IndexSpaceExpression *rhs)
+    //--------------------------------------------------------------------------
+    {
+      // Quick rejection test: if we can get conservative bounds for both
+      // expressions without blocking and those bounds don't overlap then
+      // the expressions cannot intersect and we can skip building and
+      // tightening the intersection expression entirely
+      Domain left, right;
+      if (!lhs->get_loose_bounds(left) || !rhs->get_loose_bounds(right))
+        return false;
+      return left.intersection(right).empty();
+    }
+
     //--------------------------------------------------------------------------
     bool IndexSpaceExpression::test_intersection_nonblocking(
                         IndexSpaceExpression *other, RegionTreeForest *context,
@@ -6587,8 +6692,11 @@ namespace Legion {
     {
       if (second)
       {
+        // Check for an obvious miss before doing the full intersection
+        if (definitely_disjoint(this, other))
+          return false;
         // We've got two non pending expressions, so we can just test them
-        IndexSpaceExpression *overlap = 
+        IndexSpaceExpression *overlap =
           context->intersect_index_spaces(this, other);
         return !overlap->is_empty();
       }
@@ -8869,9 +8977,13 @@ namespace Legion {
           return false;
         // Otherwise fall through and do the expensive test
       }
+      // Far-apart spaces are the common case, so try the cheap bounding
+      // rectangle test before paying for a full intersection
+      if (IndexSpaceExpression::definitely_disjoint(this, rhs))
+        return false;
       if (!compute)
         return true;
-      IndexSpaceExpression *intersect = 
+      IndexSpaceExpression *intersect =
         context->intersect_index_spaces(this, rhs);
       return !intersect->is_empty();
     }
@@ -8933,7 +9045,7 @@ namespace Legion {
         handle(p), parent(par), color_space(color_sp), 
         total_children(color_sp->get_volume()), 
         max_linearized_color(color_sp->get_max_linearized_color()),
-        total_children_volume(0), total_intersection_volume(0),
+        disjoint_complete_computation(NULL),
         has_disjoint(true), disjoint(dis),
         has_complete(comp >= 0), complete(comp != 0), first_entry(NULL)
     //--------------------------------------------------------------------------
@@ -8961,7 +9073,7 @@ namespace Legion {
         handle(p), parent(par), color_space(color_sp), 
         total_children(color_sp->get_volume()),
         max_linearized_color(color_sp->get_max_linearized_color()),
-        total_children_volume(0), total_intersection_volume(0),
+        disjoint_complete_computation(NULL),
         has_disjoint(false), disjoint(true),
         has_complete(comp >= 0), complete(comp != 0), first_entry(NULL)
     //--------------------------------------------------------------------------
@@ -8982,23 +9094,31 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       // Figure out how many notifications we're waiting for
-      if (is_owner() || ((collective_mapping != NULL) && 
+      // Note that nodes that are not participating in the computation
+      // never allocate the computation state and just wait for the
+      // result to be broadcast back down to them
+      if (is_owner() || ((collective_mapping != NULL) &&
             collective_mapping->contains(local_space)))
       {
-        remaining_local_disjoint_complete_notifications = 0;
+#ifdef DEBUG_LEGION
+        assert(disjoint_complete_computation == NULL);
+#endif
+        DisjointCompleteComputation *computation =
+          new DisjointCompleteComputation();
+        disjoint_complete_computation = computation;
         // Count how many locat notifications we're going to get
         for (ColorSpaceIterator itr(this, true/*local only*/); itr; itr++)
-          remaining_local_disjoint_complete_notifications++;
+          computation->remaining_local_notifications++;
         // One for the disjointness task that will run
-        if (remaining_local_disjoint_complete_notifications > 0)
-          remaining_global_disjoint_complete_notifications = 1;
+        if (computation->remaining_local_notifications > 0)
+          computation->remaining_global_notifications = 1;
         else
-          remaining_global_disjoint_complete_notifications = 0;
+          computation->remaining_global_notifications = 0;
         // More notifications from any remote nodes
         if (collective_mapping != NULL)
-          remaining_global_disjoint_complete_notifications +=
+          computation->remaining_global_notifications +=
             collective_mapping->count_children(owner_space, local_space);
-        if (remaining_global_disjoint_complete_notifications == 0)
+        if (computation->remaining_global_notifications == 0)
         {
 #ifdef DEBUG_LEGION
           assert(!is_owner());
@@ -9010,14 +9130,12 @@ namespace Legion {
             RezCheck z(rez);
             rez.serialize(handle);
             rez.serialize<int>(1); // up and compressed
-            rez.serialize(total_children_volume);
-            rez.serialize(total_intersection_volume);
+            rez.serialize(computation->total_children_volume);
+            rez.serialize(computation->total_intersection_volume);
           }
           runtime->send_index_partition_disjoint_update(target,rez,initialized);
         }
       }
-      else
-        remaining_global_disjoint_complete_notifications = 0;
       // Add a reference to be removed only after both the disjointness 
       // and the completeness is set
       add_base_valid_ref(REGION_TREE_REF);
@@ -9036,13 +9154,15 @@ namespace Legion {
             delete (*it);
         partition_trackers.clear();
       }
+      if (disjoint_complete_computation != NULL)
+        delete disjoint_complete_computation;
       // Lastly we can unregister ourselves with the context
       if (registered_with_runtime)
         context->remove_node(handle);
       if (parent->remove_nested_resource_ref(did))
         delete parent;
       if (color_space->remove_nested_resource_ref(did))
-        delete color_space; 
+        delete color_space;
     }
 
     //--------------------------------------------------------------------------
@@ -9572,15 +9692,19 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock n_lock(node_lock);
-      if (!has_disjoint || !has_complete)
+      if ((!has_disjoint || !has_complete) &&
+          (disjoint_complete_computation != NULL))
       {
 #ifdef DEBUG_LEGION
-        assert(remaining_local_disjoint_complete_notifications > 0);
-        assert(remaining_global_disjoint_complete_notifications > 0);
+        assert(disjoint_complete_computation->
+                remaining_local_notifications > 0);
+        assert(disjoint_complete_computation->
+                remaining_global_notifications > 0);
 #endif
-        if (--remaining_local_disjoint_complete_notifications == 0)
+        if (--disjoint_complete_computation->
+              remaining_local_notifications == 0)
         {
-          // Launch the task to perform the local disjointness 
+          // Launch the task to perform the local disjointness
           // and completeness tests
           DisjointnessArgs args(this);
           runtime->issue_runtime_meta_task(args,
@@ -9906,13 +10030,17 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock n_lock(node_lock);
-      total_children_volume += children_volume;
-      total_intersection_volume += intersection_volume;
+#ifdef DEBUG_LEGION
+      assert(disjoint_complete_computation != NULL);
+#endif
+      DisjointCompleteComputation *computation = disjoint_complete_computation;
+      computation->total_children_volume += children_volume;
+      computation->total_intersection_volume += intersection_volume;
       // Check to see if we've seen all our arrivals
 #ifdef DEBUG_LEGION
-      assert(remaining_global_disjoint_complete_notifications > 0);
+      assert(computation->remaining_global_notifications > 0);
 #endif
-      if (--remaining_global_disjoint_complete_notifications == 0)
+      if (--computation->remaining_global_notifications == 0)
       {
         if (is_owner())
           return finalize_disjoint_complete();
@@ -9926,8 +10054,8 @@ namespace Legion {
             RezCheck z(rez);
             rez.serialize(handle);
             rez.serialize<int>(1); // up and compressed
-            rez.serialize(total_children_volume);
-            rez.serialize(total_intersection_volume);
+            rez.serialize(computation->total_children_volume);
+            rez.serialize(computation->total_intersection_volume);
           }
           runtime->send_index_partition_disjoint_update(target,rez,initialized);
         }
@@ -9943,51 +10071,55 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       AutoLock n_lock(node_lock);
-      if (!total_children_volumes.empty())
+#ifdef DEBUG_LEGION
+      assert(disjoint_complete_computation != NULL);
+#endif
+      DisjointCompleteComputation *computation = disjoint_complete_computation;
+      if (!computation->total_children_volumes.empty())
       {
         for (std::map<LegionColor,uint64_t>::const_iterator it =
               children_volumes.begin(); it != children_volumes.end(); it++)
-          total_children_volumes.insert(*it);
+          computation->total_children_volumes.insert(*it);
       }
       else
-        total_children_volumes.swap(children_volumes);
+        computation->total_children_volumes.swap(children_volumes);
       if (intersection_volumes != NULL)
       {
-        if (!total_intersection_volumes.empty())
+        if (!computation->total_intersection_volumes.empty())
         {
           for (std::map<std::pair<LegionColor,LegionColor>,
                         uint64_t>::const_iterator it =
                 intersection_volumes->begin(); it != 
                 intersection_volumes->end(); it++)
-            total_intersection_volumes.insert(*it);
+            computation->total_intersection_volumes.insert(*it);
         }
         else
-          total_intersection_volumes.swap(*intersection_volumes);
+          computation->total_intersection_volumes.swap(*intersection_volumes);
       }
       // Check to see if we've seen all our arrivals
 #ifdef DEBUG_LEGION
-      assert(remaining_global_disjoint_complete_notifications > 0);
+      assert(computation->remaining_global_notifications > 0);
 #endif
-      if (--remaining_global_disjoint_complete_notifications == 0)
+      if (--computation->remaining_global_notifications == 0)
       {
         if (is_owner())
         {
           // We can now compute the final sums
 #ifdef DEBUG_LEGION
-          assert(total_children_volume == 0);
-          assert(total_intersection_volume == 0);
+          assert(computation->total_children_volume == 0);
+          assert(computation->total_intersection_volume == 0);
 #endif
           for (std::map<LegionColor,uint64_t>::const_iterator it =
-                total_children_volumes.begin(); it !=
-                total_children_volumes.end(); it++)
-            total_children_volume += it->second;
-          total_children_volumes.clear();
+                computation->total_children_volumes.begin(); it !=
+                computation->total_children_volumes.end(); it++)
+            computation->total_children_volume += it->second;
+          computation->total_children_volumes.clear();
           for (std::map<std::pair<LegionColor,LegionColor>,
                           uint64_t>::const_iterator it =
-                total_intersection_volumes.begin(); it !=
-                total_intersection_volumes.end(); it++)
-            total_intersection_volume += it->second;
-          total_intersection_volumes.clear();
+                computation->total_intersection_volumes.begin(); it !=
+                computation->total_intersection_volumes.end(); it++)
+            computation->total_intersection_volume += it->second;
+          computation->total_intersection_volumes.clear();
           return finalize_disjoint_complete();
         }
         else
@@ -10000,18 +10132,20 @@ namespace Legion {
             RezCheck z(rez);
             rez.serialize(handle);
             rez.serialize<int>(-1); // up and not compressed
-            rez.serialize<size_t>(total_children_volumes.size());
+            rez.serialize<size_t>(computation->total_children_volumes.size());
             for (std::map<LegionColor,uint64_t>::const_iterator it =
-                  total_children_volumes.begin(); it !=
-                  total_children_volumes.end(); it++)
+                  computation->total_children_volumes.begin(); it !=
+                  computation->total_children_volumes.end(); it++)
             {
               rez.serialize(it->first);
               rez.serialize(it->second);
             }
-            rez.serialize<size_t>(total_intersection_volumes.size());
+            rez.serialize<size_t>(
+                computation->total_intersection_volumes.size());
             for (std::map<std::pair<LegionColor,LegionColor>,uint64_t>::
-                  const_iterator it = total_intersection_volumes.begin();
-                  it != total_intersection_volumes.end(); it++)
+                  const_iterator it = 
+                  computation->total_intersection_volumes.begin();
+                  it != computation->total_intersection_volumes.end(); it++)
             {
               rez.serialize(it->first.first);
               rez.serialize(it->first.second);
@@ -10019,8 +10153,8 @@ namespace Legion {
             }
           }
           runtime->send_index_partition_disjoint_update(target,rez,initialized);
-          total_children_volumes.clear();
-          total_intersection_volumes.clear();
+          computation->total_children_volumes.clear();
+          computation->total_intersection_volumes.clear();
         }
       }
       return false;
@@ -10032,6 +10166,13 @@ namespace Legion {
     {
       if (is_owner())
       {
+#ifdef DEBUG_LEGION
+        assert(disjoint_complete_computation != NULL);
+#endif
+        uint64_t total_children_volume =
+          disjoint_complete_computation->total_children_volume;
+        const uint64_t total_intersection_volume =
+          disjoint_complete_computation->total_intersection_volume;
         const size_t parent_volume = parent->get_volume();
         // We can now tell what our status is
         if (is_complete(false/*from app*/, true/*false if not ready*/))
@@ -10079,6 +10220,12 @@ namespace Legion {
           implicit_profiler->register_index_partition(parent->handle.id,
               handle.id, disjoint.load(), color);
       }
+      // The computation is done so we can reclaim its state now
+      if (disjoint_complete_computation != NULL)
+      {
+        delete disjoint_complete_computation;
+        disjoint_complete_computation = NULL;
+      }
       has_disjoint.store(true);
       has_complete.store(true);
       if (disjoint_complete_ready.exists())
@@ -10253,7 +10400,8 @@ namespace Legion {
         derez.deserialize(is_complete);
         AutoLock n_lock(node_lock);
 #ifdef DEBUG_LEGION
-        assert(remaining_global_disjoint_complete_notifications == 0);
+        assert((disjoint_complete_computation == NULL) ||
+            (disjoint_complete_computation->remaining_global_notifications==0));
 #endif
         disjoint.store(is_disjoint);
         complete.store(is_complete);
@@ -10380,6 +10528,10 @@ namespace Legion {
           return false;
         // Otherwise fall through and do the expensive test
       }
+      // All our children are contained by our parent, so if the parent's
+      // bounds can't overlap the other space then neither can any child
+      if (IndexSpaceExpression::definitely_disjoint(parent, rhs))
+        return false;
       if (!compute)
         return true;
       std::vector<LegionColor> interfering;
@@ -10439,6 +10591,11 @@ namespace Legion {
           return false;
         // Otherwise we fall through and do the expensive test
       }
+      // Both partitions are contained by their parents, so disjoint
+      // parent bounds prove the partitions disjoint too
+      if ((parent != rhs->parent) &&
+          IndexSpaceExpression::definitely_disjoint(parent, rhs->parent))
+        return false;
       if (!compute)
         return true;
       if (parent != rhs->parent)
@@ -14535,21 +14692,12 @@ namespace Legion {
             collective_mapping->pack(rez);
           else
             CollectiveMapping::pack_null(rez);
-          // Pack the field infos
-          if (allocation_state == FIELD_ALLOC_READ_ONLY)
-          {
-            size_t num_fields = field_infos.size();
-            rez.serialize<size_t>(num_fields);
-            for (std::map<FieldID,FieldInfo>::const_iterator it = 
-                  field_infos.begin(); it != field_infos.end(); it++)
-            {
-              rez.serialize(it->first);
-              it->second.serialize(rez);
-            }
-            remote_field_infos.insert(target);
-          }
-          else
-            rez.serialize<size_t>(0);
+          // Field infos are propagated lazily rather than pushed eagerly:
+          // the target starts out invalid and pulls a copy from us on its
+          // first use of the field metadata (becoming a read-only copy at
+          // that point), which avoids broadcasting every field to nodes
+          // that never touch most of them
+          rez.serialize<size_t>(0);
           rez.serialize<size_t>(semantic_info.size());
           for (LegionMap<SemanticTag,SemanticInfo>::iterator it = 
                 semantic_info.begin(); it != semantic_info.end(); it++)
@@ -15212,7 +15360,9 @@ namespace Legion {
       else
       {
         // Not the owner
-        AutoLock n_lock(node_lock,1,false/*exclusive*/);
+        // Take the lock in exclusive mode since we might need to record
+        // an outstanding request to coalesce concurrent local requests
+        AutoLock n_lock(node_lock);
         // check to see if we lost the race
         if (allocation_state != FIELD_ALLOC_INVALID)
         {
@@ -15248,9 +15398,23 @@ namespace Legion {
         }
         else
         {
+          // Coalesce concurrent local requests so that at most one
+          // request for the field infos is in flight to the owner at a
+          // time - everyone else waits for the response (which should
+          // make us a read-only copy) and then tries again
+          if ((source == local_space) && outstanding_infos_request.exists()
+              && !outstanding_infos_request.has_triggered())
+          {
+            const RtEvent wait_on = outstanding_infos_request;
+            n_lock.release();
+            wait_on.wait();
+            return request_field_infos_copy(copy, source, to_trigger);
+          }
           // Did not lose the race, send the request back to the owner
           if (!to_trigger.exists())
             to_trigger = Runtime::create_rt_user_event();
+          if (source == local_space)
+            outstanding_infos_request = to_trigger;
           Serializer rez;
           {
             RezCheck z(rez);
@@ -16419,6 +16583,12 @@ namespace Legion {
         return;
       LogicalState &state = get_logical_state(ctx);
       state.clear_deleted_state(ctx, deleted_mask);
+      // If the deletion covered everything that was here then do a full
+      // clear as well to reclaim the projection summary cache and any
+      // timeout exchange before the node itself can be deleted
+      if (state.field_states.empty() && state.curr_epoch_users.empty() &&
+          state.prev_epoch_users.empty() && state.refinement_trackers.empty())
+        state.clear();
     }
 
     //--------------------------------------------------------------------------
@@ -101,8 +101,209 @@ namespace Legion {
       RegionTreeForest *const forest;
     protected:
       IndexSpaceOperation *result;
-    }; 
-    
+    };
+
+    /**
+     * \class NodeLookupCache
+     * An RCU-style cache that accelerates steady-state lookups of
+     * region tree nodes. Readers are wait-free: they walk a hash table
+     * of immutable entries published with release stores and never take
+     * the forest lookup lock. This is just a cache though - the maps
+     * guarded by the lookup lock remain the authoritative state and
+     * only fully initialized nodes are ever published here, so a reader
+     * that misses (or races with a table resize) simply falls back to
+     * the locked lookup path. Invalidations are performed by writers
+     * holding the lookup lock in exclusive mode which serializes them
+     * with all insertions, while insertions from concurrent readers
+     * holding the lock in read-only mode synchronize on the bucket
+     * heads. Retired tables and invalidated entries are kept around
+     * until the cache is destroyed since node destruction is rare
+     * compared to the lookups this is accelerating.
+     */
+    template<typename K, typename V, typename HASH>
+    class NodeLookupCache {
+    private:
+      struct Entry {
+      public:
+        Entry(const K &k, V *v, Entry *n)
+          : key(k), value(v), next(n), valid(true) { }
+      public:
+        const K key;
+        V *const value;
+        Entry *const next;
+        std::atomic<bool> valid;
+      };
+      struct Table {
+      public:
+        Table(size_t cap, Table *old)
+          : capacity(cap), buckets(new std::atomic<Entry*>[cap]), older(old)
+        {
+          for (unsigned idx = 0; idx < capacity; idx++)
+            buckets[idx].store(NULL, std::memory_order_relaxed);
+        }
+        ~Table(void)
+        {
+          for (unsigned idx = 0; idx < capacity; idx++)
+          {
+            Entry *entry = buckets[idx].load(std::memory_order_relaxed);
+            while (entry != NULL)
+            {
+              Entry *next = entry->next;
+              delete entry;
+              entry = next;
+            }
+          }
+          delete[] buckets;
+        }
+      public:
+        const size_t capacity; // always a power of two
+        std::atomic<Entry*> *const buckets;
+        Table *const older;
+      };
+    public:
+      NodeLookupCache(size_t initial_capacity = 256)
+        : current(new Table(initial_capacity, NULL)), entries(0) { }
+      NodeLookupCache(const NodeLookupCache &rhs) = delete;
+      ~NodeLookupCache(void)
+      {
+        Table *table = current.load(std::memory_order_relaxed);
+        while (table != NULL)
+        {
+          Table *older = table->older;
+          delete table;
+          table = older;
+        }
+      }
+    public:
+      NodeLookupCache& operator=(const NodeLookupCache &rhs) = delete;
+    public:
+      // Wait-free lookup, returns NULL on a miss in which case the
+      // caller needs to fall back to the locked lookup path
+      inline V* find(const K &key) const
+      {
+        const Table *table = current.load(std::memory_order_acquire);
+        const size_t index = HASH()(key) & (table->capacity - 1);
+        for (const Entry *entry =
+              table->buckets[index].load(std::memory_order_acquire);
+              entry != NULL; entry = entry->next)
+          if (entry->key == key)
+            return entry->valid.load(std::memory_order_acquire) ?
+              entry->value : NULL;
+        return NULL;
+      }
+      // Publish a fully initialized node, the caller must hold the
+      // lookup lock in at least read-only mode
+      void insert(const K &key, V *value)
+      {
+        Table *table = current.load(std::memory_order_acquire);
+        const size_t index = HASH()(key) & (table->capacity - 1);
+        std::atomic<Entry*> &bucket = table->buckets[index];
+        Entry *head = bucket.load(std::memory_order_acquire);
+        while (true)
+        {
+          // Check for a duplicate insertion racing ahead of us
+          bool duplicate = false;
+          for (Entry *entry = head; entry != NULL; entry = entry->next)
+          {
+            if (entry->key != key)
+              continue;
+            duplicate = entry->valid.load(std::memory_order_acquire);
+            break;
+          }
+          if (duplicate)
+            return;
+          Entry *entry = new Entry(key, value, head);
+          if (bucket.compare_exchange_strong(head, entry,
+                std::memory_order_release, std::memory_order_acquire))
+            break;
+          // Lost the race to another inserter, try again
+          delete entry;
+        }
+        // Grow the table if the load factor reaches one, entries that
+        // concurrent inserters race into the old table are simply lost
+        // from the cache which is benign since they will miss and fall
+        // back to the locked lookup path
+        if ((entries.fetch_add(1) + 1) >= table->capacity)
+        {
+          Table *larger = new Table(2 * table->capacity, table);
+          for (unsigned idx = 0; idx < table->capacity; idx++)
+            for (Entry *entry =
+                  table->buckets[idx].load(std::memory_order_acquire);
+                  entry != NULL; entry = entry->next)
+              if (entry->valid.load(std::memory_order_acquire))
+              {
+                std::atomic<Entry*> &target =
+                  larger->buckets[HASH()(entry->key) & (larger->capacity - 1)];
+                target.store(new Entry(entry->key, entry->value,
+                      target.load(std::memory_order_relaxed)),
+                    std::memory_order_relaxed);
+              }
+          Table *expected = table;
+          if (!current.compare_exchange_strong(expected, larger,
+                std::memory_order_release, std::memory_order_acquire))
+          {
+            // Someone else already installed a larger table
+            // Unchain the old table before deleting our copy so we
+            // don't free tables that are still in use
+            *const_cast<Table**>(&larger->older) = NULL;
+            delete larger;
+          }
+        }
+      }
+      // Invalidate the entry for a node that is being removed, the
+      // caller must hold the lookup lock in exclusive mode which
+      // serializes this with all insertions. We walk the retired
+      // tables too in case a concurrent reader loaded one of them
+      // before it was replaced
+      void remove(const K &key)
+      {
+        for (Table *table = current.load(std::memory_order_acquire);
+              table != NULL; table = table->older)
+        {
+          const size_t index = HASH()(key) & (table->capacity - 1);
+          for (Entry *entry =
+                table->buckets[index].load(std::memory_order_acquire);
+                entry != NULL; entry = entry->next)
+            if (entry->key == key)
+              entry->valid.store(false, std::memory_order_release);
+        }
+      }
+    private:
+      std::atomic<Table*> current;
+      std::atomic<size_t> entries;
+    };
+
+    // Hash functors for the node lookup caches, mixing the bits of the
+    // handle ids so that consecutively generated ids spread out
+    struct NodeCacheHasher {
+    public:
+      inline size_t mix(uint64_t v) const
+      {
+        v ^= v >> 30;
+        v *= 0xBF58476D1CE4E5B9ULL;
+        v ^= v >> 27;
+        v *= 0x94D049BB133111EBULL;
+        v ^= v >> 31;
+        return v;
+      }
+      inline size_t operator()(const IndexSpace &space) const
+        { return mix(space.get_id()); }
+      inline size_t operator()(const IndexPartition &part) const
+        { return mix(part.get_id()); }
+      inline size_t operator()(const FieldSpace &space) const
+        { return mix(space.get_id()); }
+      inline size_t operator()(const LogicalRegion &handle) const
+        { return mix((uint64_t(handle.get_tree_id()) << 40) ^
+                     (uint64_t(handle.get_field_space().get_id()) << 20) ^
+                      uint64_t(handle.get_index_space().get_id())); }
+      inline size_t operator()(const LogicalPartition &handle) const
+        { return mix((uint64_t(handle.get_tree_id()) << 40) ^
+                     (uint64_t(handle.get_field_space().get_id()) << 20) ^
+                      uint64_t(handle.get_index_partition().get_id())); }
+      inline size_t operator()(const RegionTreeID &tid) const
+        { return mix(tid); }
+    };
+
     /**
      * \class RegionTreeForest
      * "In the darkness of the forest resides the one true magic..."
@@ -137,7 +338,18 @@ namespace Legion {
       public:
         const IndexPartition handle;
         const RtUserEvent ready;
-      };   
+      };
+      struct DeferRegionTreeFreeArgs :
+        public LgTaskArgs<DeferRegionTreeFreeArgs> {
+      public:
+        static const LgTaskID TASK_ID = LG_DEFER_REGION_TREE_FREE_TASK_ID;
+      public:
+        DeferRegionTreeFreeArgs(RegionNode *n)
+          : LgTaskArgs<DeferRegionTreeFreeArgs>(implicit_provenance),
+            node(n) { }
+      public:
+        RegionNode *const node;
+      };
     public:
       RegionTreeForest(Runtime *rt);
       RegionTreeForest(const RegionTreeForest &rhs);
@@ -385,6 +597,7 @@ namespace Legion {
       void destroy_logical_region(LogicalRegion handle,
                                   std::set<RtEvent> &applied,
                                   const CollectiveMapping *mapping = NULL);
+      static void handle_defer_region_tree_free(const void *args);
     public:
       LogicalPartition get_logical_partition(LogicalRegion parent, 
                                              IndexPartition handle);
@@ -911,7 +1124,6 @@ namespace Legion {
     protected:
       mutable LocalLock lookup_lock;
       mutable LocalLock lookup_is_op_lock;
-      mutable LocalLock congruence_lock;
     private:
       // The lookup lock must be held when accessing these
       // data structures
@@ -921,6 +1133,21 @@ namespace Legion {
       std::map<LogicalRegion,RegionNode*>     region_nodes;
       std::map<LogicalPartition,PartitionNode*> part_nodes;
       std::map<RegionTreeID,RegionNode*>        tree_nodes;
+    private:
+      // Wait-free caches in front of the maps above for steady-state
+      // lookups of initialized nodes, see NodeLookupCache for details
+      NodeLookupCache<IndexSpace,IndexSpaceNode,NodeCacheHasher>
+                                                        index_node_cache;
+      NodeLookupCache<IndexPartition,IndexPartNode,NodeCacheHasher>
+                                                        index_part_cache;
+      NodeLookupCache<FieldSpace,FieldSpaceNode,NodeCacheHasher>
+                                                        field_node_cache;
+      NodeLookupCache<LogicalRegion,RegionNode,NodeCacheHasher>
+                                                        region_node_cache;
+      NodeLookupCache<LogicalPartition,PartitionNode,NodeCacheHasher>
+                                                        part_node_cache;
+      NodeLookupCache<RegionTreeID,RegionNode,NodeCacheHasher>
+                                                        tree_node_cache;
     private:
       // pending events for requested nodes
       std::map<IndexSpace,RtEvent>       index_space_requests;
@@ -942,9 +1169,15 @@ namespace Legion {
     private:
       // In order for the symbolic analysis to work, we need to know that
       // we don't have multiple symbols for congruent expressions. This data
-      // structure is used to find congruent expressions where they exist
+      // structure is used to find congruent expressions where they exist.
+      // The table is sharded by hash so that canonicalizing new expressions
+      // in different buckets does not serialize on a single global lock,
+      // especially since congruence tests can be expensive
       typedef SmallPointerVector<IndexSpaceExpression,true> CanonicalSet;
-      std::unordered_map<uint64_t/*hash*/,CanonicalSet> canonical_expressions;
+      static const unsigned NUM_CONGRUENCE_SHARDS = 32;
+      mutable LocalLock congruence_locks[NUM_CONGRUENCE_SHARDS];
+      std::unordered_map<uint64_t/*hash*/,CanonicalSet>
+                            canonical_expressions[NUM_CONGRUENCE_SHARDS];
     public:
       static const unsigned MAX_EXPRESSION_FANOUT = 32;
     };
@@ -1306,6 +1539,11 @@ namespace Legion {
       virtual Domain get_tight_domain(void) = 0;
       [[nodiscard]] virtual ApEvent get_loose_domain(Domain &domain,
           ApUserEvent &done_event) = 0;
+      // Get a (possibly loose) dense rectangular bound on this expression
+      // without blocking, returning false if no bound is available yet -
+      // since the bound is a superset of the points, two expressions with
+      // non-overlapping bounds are definitely disjoint
+      virtual bool get_loose_bounds(Domain &bounds) = 0;
       virtual void record_index_space_user(ApEvent user) = 0;
       virtual void tighten_index_space(void) = 0;
       virtual bool is_set(void) const { return true; }
@@ -1346,6 +1584,10 @@ namespace Legion {
                                                     unsigned count = 1) = 0;
       virtual bool test_intersection_nonblocking(IndexSpaceExpression *expr,
          RegionTreeForest *context, ApEvent &precondition, bool second = false);
+      // Returns true only when the loose bounds of both expressions are
+      // available without blocking and prove the expressions cannot overlap
+      static bool definitely_disjoint(IndexSpaceExpression *lhs,
+                                      IndexSpaceExpression *rhs);
     public:
       virtual IndexSpaceNode* create_node(IndexSpace handle, DistributedID did,
           RtEvent initialized, Provenance *provenance,
@@ -1636,6 +1878,7 @@ namespace Legion {
       virtual Domain get_tight_domain(void) = 0;
       [[nodiscard]] virtual ApEvent get_loose_domain(Domain &domain,
           ApUserEvent &done_event) = 0;
+      virtual bool get_loose_bounds(Domain &bounds) = 0;
       virtual void record_index_space_user(ApEvent user) = 0;
       virtual void tighten_index_space(void) = 0;
       virtual bool check_empty(void) = 0;
@@ -1644,7 +1887,7 @@ namespace Legion {
       virtual void skip_unpack_expression(Deserializer &derez) const = 0;
     public:
 #ifdef DEBUG_LEGION
-      virtual bool is_valid(void) 
+      virtual bool is_valid(void)
         { return DistributedCollectable::is_global(); }
 #endif
       virtual DistributedID get_distributed_id(void) const { return did; }
@@ -1692,6 +1935,7 @@ namespace Legion {
       virtual Domain get_tight_domain(void);
       [[nodiscard]] virtual ApEvent get_loose_domain(Domain &domain,
           ApUserEvent &done_event);
+      virtual bool get_loose_bounds(Domain &bounds);
       virtual void record_index_space_user(ApEvent user);
       virtual void tighten_index_space(void);
       virtual bool check_empty(void);
@@ -2251,6 +2495,7 @@ namespace Legion {
       virtual Domain get_tight_domain(void) = 0;
       [[nodiscard]] virtual ApEvent get_loose_domain(Domain &domain,
           ApUserEvent &done_event) = 0;
+      virtual bool get_loose_bounds(Domain &bounds) = 0;
       virtual RtEvent add_sparsity_map_references(const Domain &domain,
           unsigned references) = 0;
       virtual void record_index_space_user(ApEvent user) = 0;
@@ -2508,6 +2753,7 @@ namespace Legion {
       virtual Domain get_tight_domain(void);
       [[nodiscard]] virtual ApEvent get_loose_domain(Domain &domain,
           ApUserEvent &done_event);
+      virtual bool get_loose_bounds(Domain &bounds);
       virtual RtEvent add_sparsity_map_references(const Domain &domain,
           unsigned references);
       virtual void record_index_space_user(ApEvent user);
@@ -3908,13 +4154,28 @@ namespace Legion {
       std::set<std::pair<LegionColor,LegionColor> > aliased_subspaces;
       std::list<PartitionTracker*> partition_trackers;
     protected:
-      // Support for computing disjointness locally
-      uint64_t total_children_volume, total_intersection_volume;
-      std::map<LegionColor,uint64_t> total_children_volumes;
-      std::map<std::pair<LegionColor,LegionColor>,
-               uint64_t> total_intersection_volumes;
-      unsigned remaining_local_disjoint_complete_notifications;
-      unsigned remaining_global_disjoint_complete_notifications;
+      // Support for computing disjointness and completeness locally.
+      // This state is only live while the computation is in flight, so
+      // we keep it out of line behind a lazily-allocated struct and
+      // reclaim it as soon as the results are finalized. Partition nodes
+      // are replicated on every address space that uses them, so keeping
+      // the long-lived part of the node small matters at large scales.
+      struct DisjointCompleteComputation :
+        public LegionHeapify<DisjointCompleteComputation> {
+      public:
+        DisjointCompleteComputation(void)
+          : total_children_volume(0), total_intersection_volume(0),
+            remaining_local_notifications(0),
+            remaining_global_notifications(0) { }
+      public:
+        uint64_t total_children_volume, total_intersection_volume;
+        std::map<LegionColor,uint64_t> total_children_volumes;
+        std::map<std::pair<LegionColor,LegionColor>,
+                 uint64_t> total_intersection_volumes;
+        unsigned remaining_local_notifications;
+        unsigned remaining_global_notifications;
+      };
+      DisjointCompleteComputation *disjoint_complete_computation;
     protected:
       std::atomic<bool> has_disjoint, disjoint;
       std::atomic<bool> has_complete, complete;
@@ -4432,6 +4693,10 @@ namespace Legion {
       std::list<std::pair<unsigned,RtEvent> > available_indexes;
       // Keep track of the nodes with remote copies of field_infos
       mutable std::set<AddressSpaceID> remote_field_infos;
+      // If we are not the owner, the event for any local request for
+      // the field infos that is still in flight so that concurrent
+      // requests can be coalesced into a single message to the owner
+      mutable RtEvent outstanding_infos_request;
       // An event for recording when we are available for allocation
       // on the owner node in the case we had to send invalidations
       RtEvent pending_field_allocation;
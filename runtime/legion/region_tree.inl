@@ -1048,6 +1048,7 @@ namespace Legion {
               layout->bytes_used = piece_start + stride;
             pl.pieces.push_back(piece);
           }
+          pl.rebuild_index();
         }
         else
           li = finder->second;
@@ -1529,6 +1530,23 @@ namespace Legion {
       return result;
     }
 
+    //--------------------------------------------------------------------------
+    template<int DIM, typename T>
+    bool IndexSpaceOperationT<DIM,T>::get_loose_bounds(Domain &bounds)
+    //--------------------------------------------------------------------------
+    {
+      // The realm index space is computed when the operation is made so its
+      // bounds are always available as a superset of the tight result
+      DomainT<DIM,T> bounding;
+      if (is_index_space_tight.load())
+        bounding.bounds = tight_index_space.bounds;
+      else
+        bounding.bounds = realm_index_space.bounds;
+      bounding.sparsity.id = 0;
+      bounds = Domain(bounding);
+      return true;
+    }
+
     //--------------------------------------------------------------------------
     template<int DIM, typename T>
     void IndexSpaceOperationT<DIM,T>::record_index_space_user(ApEvent user)
@@ -2832,6 +2850,23 @@ namespace Legion {
       return result;
     }
 
+    //--------------------------------------------------------------------------
+    template<int DIM, typename T>
+    bool IndexSpaceNodeT<DIM,T>::get_loose_bounds(Domain &bounds)
+    //--------------------------------------------------------------------------
+    {
+      // If the index space hasn't been computed yet then we can't provide
+      // any bound without blocking
+      if (!index_space_set.load())
+        return false;
+      AutoLock n_lock(node_lock,1,false/*exclusive*/);
+      DomainT<DIM,T> bounding;
+      bounding.bounds = realm_index_space.bounds;
+      bounding.sparsity.id = 0;
+      bounds = Domain(bounding);
+      return true;
+    }
+
     //--------------------------------------------------------------------------
     template<int DIM, typename T>
     RtEvent IndexSpaceNodeT<DIM,T>::add_sparsity_map_references(
@@ -10777,10 +10812,7 @@ namespace Legion {
         if (!indirections.empty())
           std::abort();
         // No need for tracing to know about the reservations
-        for (std::map<Reservation,bool>::const_iterator it =
-              reservations.begin(); it != reservations.end(); it++)
-          copy_pre = Runtime::acquire_ap_reservation(it->first, 
-                                          it->second, copy_pre);
+        copy_pre = Runtime::acquire_ap_reservations(reservations, copy_pre);
       }
       if (indirections.empty() || individual_field_indexes.empty())
       {
@@ -78,6 +78,7 @@ namespace Legion {
     Realm::Logger log_shutdown("shutdown");
     Realm::Logger log_tracing("tracing");
     Realm::Logger log_auto_trace("auto_trace");
+    Realm::Logger log_layout_mining("layout_mining");
     namespace LegionSpy {
       Realm::Logger log_spy("legion_spy");
     };
@@ -91,6 +92,8 @@ namespace Legion {
     thread_local LgEvent implicit_fevent = LgEvent::NO_LG_EVENT;
     thread_local unsigned inside_registration_callback=NO_REGISTRATION_CALLBACK;
     thread_local ImplicitReferenceTracker *implicit_reference_tracker = NULL;
+    // Per-thread cache of recycled operations, only used in runtime.cc
+    thread_local Runtime::LocalOperationCache *implicit_op_cache = NULL;
 #ifdef DEBUG_LEGION_CALLERS
     thread_local LgTaskID implicit_task_kind = LG_SCHEDULER_ID;
     thread_local LgTaskID implicit_task_caller = LG_SCHEDULER_ID;
@@ -1584,6 +1587,18 @@ namespace Legion {
       return pending_finder->second.inst_ready;
     }
 
+    //--------------------------------------------------------------------------
+    void FutureImpl::record_upper_bound_size(size_t bound)
+    //--------------------------------------------------------------------------
+    {
+      AutoLock f_lock(future_lock);
+      // Nothing to do if we already know the actual size
+      if (!empty.load() || future_size_set)
+        return;
+      if (bound < upper_bound_size)
+        upper_bound_size = bound;
+    }
+
     //--------------------------------------------------------------------------
     RtEvent FutureImpl::find_runtime_instance_ready(void)
     //--------------------------------------------------------------------------
@@ -1991,6 +2006,14 @@ namespace Legion {
       AutoLock f_lock(future_lock);
       if (!empty.load() || future_size_set)
         return;
+      if (size > upper_bound_size)
+        REPORT_LEGION_ERROR(ERROR_FUTURE_SIZE_MISMATCH,
+            "Future size mismatch! Future has a result of %zd bytes but "
+            "its consumers declared an upper bound of %zd bytes, e.g. by "
+            "using it to construct a predicate, which requires a future "
+            "containing a single boolean. (UID %lld)", size,
+            upper_bound_size, (producer_op == NULL) ? 0 :
+              producer_op->get_unique_op_id())
       upper_bound_size = size;
       future_size = size;
       future_size_set = true;
@@ -2057,6 +2080,14 @@ namespace Legion {
       // must be called while we are already holding the lock
       future_size =
         instances.empty() ? 0 : instances.begin()->second.instance->size;
+      if (future_size > upper_bound_size)
+        REPORT_LEGION_ERROR(ERROR_FUTURE_SIZE_MISMATCH,
+            "Future size mismatch! Future has a result of %zd bytes but "
+            "its consumers declared an upper bound of %zd bytes, e.g. by "
+            "using it to construct a predicate, which requires a future "
+            "containing a single boolean. (UID %lld)", future_size,
+            upper_bound_size, (producer_op == NULL) ? 0 :
+              producer_op->get_unique_op_id())
       future_size_set = true;
       if (future_size_ready.exists())
       {
@@ -2754,7 +2785,41 @@ namespace Legion {
     void FutureImpl::notify_local(void)
     //--------------------------------------------------------------------------
     {
-      // Nothing to do
+      // All the global references are gone at this point so nothing can
+      // consume the value of this future anymore. Reclaim the payload
+      // storage eagerly since the deletion of the future itself can be
+      // delayed arbitrarily by the distributed collection protocol and
+      // resource references from other data structures.
+      AutoLock f_lock(future_lock);
+      for (std::map<Memory,FutureInstanceTracker>::iterator
+            it = instances.begin(); it != instances.end(); it++)
+      {
+        if (it->second.remote_postcondition.exists())
+        {
+          // This is a remote instance that we unpacked and nobody
+          // used it so we can just clean it up since we don't own it
+#ifdef DEBUG_LEGION
+          assert(it->second.read_events.empty());
+#endif
+          Runtime::trigger_event_untraced(it->second.remote_postcondition,
+              it->second.ready_event);
+          delete it->second.instance;
+        }
+        else
+        {
+          // Merge together all the events for destroying this future instance
+          ApEvent precondition = it->second.ready_event;
+          if (!it->second.read_events.empty())
+          {
+            if (precondition.exists())
+              it->second.read_events.push_back(precondition);
+            precondition = Runtime::merge_events(NULL, it->second.read_events);
+          }
+          if (!it->second.instance->defer_deletion(precondition))
+            delete it->second.instance;
+        }
+      }
+      instances.clear();
     }
 
     //--------------------------------------------------------------------------
@@ -3352,9 +3417,11 @@ namespace Legion {
       assert(!freeproc.exists() || (freeproc.kind() != Processor::UTIL_PROC));
       assert(instance.exists() || external_allocation);
       assert((data != NULL) || instance.exists());
-      assert(unique_event.exists() || !instance.exists() || 
+      assert(unique_event.exists() || !instance.exists() ||
           (implicit_runtime->profiler == NULL));
 #endif
+      if (own_allocation)
+        implicit_runtime->record_future_instance_allocation(size);
     }
 
     //--------------------------------------------------------------------------
@@ -3380,15 +3447,38 @@ namespace Legion {
       assert(instance.exists() || external_allocation);
       assert((data != NULL) || instance.exists());
       assert((resource != NULL) || inst.exists());
-      assert(unique_event.exists() || !instance.exists() || 
+      assert(unique_event.exists() || !instance.exists() ||
           (implicit_runtime->profiler == NULL));
 #endif
+      if (own_allocation)
+        implicit_runtime->record_future_instance_allocation(size);
+    }
+
+    //--------------------------------------------------------------------------
+    FutureInstance::FutureInstance(const void *d, size_t s)
+      : size(s), memory(implicit_runtime->runtime_system_memory),
+        resource(NULL), freefunc(NULL), freeproc(Processor::NO_PROC),
+        external_allocation(true), is_meta_visible(true),
+        own_allocation(false), data(inline_buffer),
+        instance(PhysicalInstance::NO_INST),
+        use_event(RtEvent::NO_RT_EVENT),
+        unique_event(LgEvent::NO_LG_EVENT), own_instance(false)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(size > 0);
+      assert(size <= MAX_INLINE_SIZE);
+      assert(memory.exists());
+#endif
+      memcpy(inline_buffer, d, size);
     }
 
     //--------------------------------------------------------------------------
     FutureInstance::~FutureInstance(void)
     //--------------------------------------------------------------------------
     {
+      if (own_allocation)
+        implicit_runtime->record_future_instance_deletion(size);
       // Make sure our instance is valid before we try to delete it
       if (instance.exists() && use_event.exists() && !use_event.has_triggered())
         use_event.wait();
@@ -3746,6 +3836,10 @@ namespace Legion {
 #endif
     //--------------------------------------------------------------------------
     {
+      // If the value is inlined in our metadata then it has to move out
+      // to its own allocation before an instance can refer to it
+      if (is_inline())
+        promote_inline_buffer();
       if (needed != size)
       {
         // The unusual case where we need to make a new instance to reflect
@@ -3868,6 +3962,24 @@ namespace Legion {
       return instance;
     }
 
+    //--------------------------------------------------------------------------
+    void FutureInstance::promote_inline_buffer(void)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(is_inline());
+      assert(!instance.exists());
+      assert(resource == NULL);
+#endif
+      void *buffer = malloc(size);
+      memcpy(buffer, inline_buffer, size);
+      resource = new Realm::ExternalMemoryResource(
+          reinterpret_cast<uintptr_t>(buffer), size, false/*read only*/);
+      data.store(buffer);
+      // We own the promoted allocation and need to free it
+      own_allocation = true;
+    }
+
     //--------------------------------------------------------------------------
     bool FutureInstance::defer_deletion(ApEvent precondition)
     //--------------------------------------------------------------------------
@@ -3931,6 +4043,10 @@ namespace Legion {
       }
       else
       {
+        // If the value is inlined in our metadata then it has to move
+        // out to its own allocation before a reference to it escapes
+        if (is_inline())
+          promote_inline_buffer();
         rez.serialize<bool>(false); // by value
         rez.serialize(data.load());
         bool dummy_owner = true;
@@ -3991,6 +4107,14 @@ namespace Legion {
       derez.deserialize<bool>(pass_by_value);
       if (pass_by_value)
       {
+        // Small values go straight into the inline metadata buffer
+        if (size <= MAX_INLINE_SIZE)
+        {
+          FutureInstance *result =
+            new FutureInstance(derez.get_current_pointer(), size);
+          derez.advance_pointer(size);
+          return result;
+        }
         void *data = malloc(size);
         derez.deserialize(data, size);
         return new FutureInstance(data, size, true/*external*/);
@@ -4053,6 +4177,16 @@ namespace Legion {
                                                           size_t size, bool own)
     //--------------------------------------------------------------------------
     {
+      // Small values are inlined directly into the metadata which saves
+      // a separate allocation for the very common small scalar futures
+      if (size <= MAX_INLINE_SIZE)
+      {
+        FutureInstance *result = new FutureInstance(value, size);
+        // We were given the allocation so we need to clean it up
+        if (own)
+          free(const_cast<void*>(value));
+        return result;
+      }
       // Copy the data into a buffer we own if we don't already
       if (!own)
       {
@@ -4382,6 +4516,10 @@ namespace Legion {
             context->get_unique_id(),
             (warning_string == NULL) ? "" : warning_string)
       context->record_blocking_call(blocking_index);
+      // Note this is a single event wait regardless of how many points the
+      // future map has: the commit event of the producing operation already
+      // subsumes the completion of every point future, so there is no need
+      // to visit (or even instantiate) the individual point futures here
       if (op != NULL)
         context->wait_on_future_map(this, op->get_commit_event(op_gen));
     }
@@ -5198,9 +5336,12 @@ namespace Legion {
       IndexSpaceNode *local_points = runtime->forest->get_node(local_space);
       Domain domain = local_points->get_tight_domain();
       std::vector<RtEvent> ready_events;
+      const std::vector<ShardID> &assignments =
+        function->find_shard_assignments(domain, sharding_domain);
+      unsigned point_index = 0;
       for (Domain::DomainPointIterator itr(domain); itr; itr++)
       {
-        const ShardID shard = function->find_owner(itr.p, sharding_domain);
+        const ShardID shard = assignments[point_index++];
         if (shard == local_shard)
         {
           RtEvent ready;
@@ -5413,6 +5554,13 @@ namespace Legion {
       return req.privilege;
     }
 
+    //--------------------------------------------------------------------------
+    CoherenceProperty PhysicalRegionImpl::get_coherence(void) const
+    //--------------------------------------------------------------------------
+    {
+      return req.prop;
+    }
+
     //--------------------------------------------------------------------------
     void PhysicalRegionImpl::unmap_region(void)
     //--------------------------------------------------------------------------
@@ -5830,6 +5978,8 @@ namespace Legion {
             else
               bounds->get_index_space_domain(realm_is, type_tag);
           }
+          if (runtime->mine_layouts)
+            log_accessor_usage(fid, field_size, mode, manager);
           return manager->get_instance();
         }
       }
@@ -5839,6 +5989,36 @@ namespace Legion {
       return PhysicalInstance::NO_INST;
     }
 
+    //--------------------------------------------------------------------------
+    void PhysicalRegionImpl::log_accessor_usage(FieldID fid, size_t field_size,
+                                 PrivilegeMode mode, PhysicalManager *manager)
+    //--------------------------------------------------------------------------
+    {
+      // Find the index of our region requirement in the parent task so
+      // the offline miner can correlate accessors with task variants
+      unsigned req_index = 0;
+      TaskID task_id = 0;
+      if (context->owner_task != NULL)
+      {
+        task_id = context->owner_task->task_id;
+        const std::vector<RegionRequirement> &regions =
+          context->owner_task->regions;
+        for (unsigned idx = 0; idx < regions.size(); idx++)
+        {
+          if (regions[idx].region == req.region)
+          {
+            req_index = idx;
+            break;
+          }
+        }
+      }
+      log_layout_mining.info("accessor task=%s task_id=%d uid=%lld region=%d "
+          "fid=%d size=%zd mode=%d memory=" IDFMT,
+          context->get_task_name(), task_id, context->get_unique_id(),
+          req_index, fid, field_size, mode,
+          manager->memory_manager->memory.id);
+    }
+
     //--------------------------------------------------------------------------
     PhysicalInstance PhysicalRegionImpl::get_padding_info(FieldID fid,
                               size_t field_size, Domain *inner, Domain &outer,
@@ -10442,7 +10622,7 @@ namespace Legion {
       : memory(m), owner_space(m.address_space()),
         is_owner(is_owner_memory(m, rt->address_space)),
         capacity(m.capacity()), remaining_capacity(capacity), runtime(rt),
-        outstanding_task_local_allocations(0),
+        failed_query_epoch(0), outstanding_task_local_allocations(0),
         outstanding_unbounded_allocations(0),
         unbounded_pool_scope(LEGION_BOUNDED_POOL), collective_lamport_clock(0),
         ready_collective_tasks(0), outstanding_collective_tasks(0)
@@ -10476,6 +10656,14 @@ namespace Legion {
     {
     }
 
+    //--------------------------------------------------------------------------
+    size_t MemoryManager::count_pending_allocations(void) const
+    //--------------------------------------------------------------------------
+    {
+      AutoLock m_lock(manager_lock,1,false/*exclusive*/);
+      return pending_allocation_attempts.size();
+    }
+
     //--------------------------------------------------------------------------
     void MemoryManager::find_shutdown_preconditions(
                                                std::set<ApEvent> &preconditions)
@@ -10626,6 +10814,7 @@ namespace Legion {
       assert(insts.find(manager) == insts.end());
 #endif
       insts[manager] = LEGION_GC_NEVER_PRIORITY;
+      invalidate_failed_queries(manager->tree_id);
     }
 
     //--------------------------------------------------------------------------
@@ -10926,10 +11115,22 @@ namespace Legion {
       }
       else
       {
+        // Common case for co-located shards (or any mappers in the same
+        // process) mapping the same read-only data: the instance already
+        // exists, so try to find and acquire it before serializing
+        // behind the allocation privilege, which lets all the local
+        // shards map the shared instance concurrently
+        if (find_satisfying_instance(constraints, regions, result,
+              acquire, tight_region_bounds, remote))
+        {
+          if (footprint != NULL)
+            *footprint = result.get_instance_size();
+          return true;
+        }
         // Create the builder and initialize it before getting
         // the allocation privilege to avoid deadlock scenario
         InstanceBuilder builder(regions, constraints, runtime, this,creator_id);
-        builder.initialize(runtime->forest); 
+        builder.initialize(runtime->forest);
         // First get our allocation privileges so we're the only
         // one trying to do any allocations
         const RtEvent wait_on =
@@ -11036,6 +11237,16 @@ namespace Legion {
       }
       else
       {
+        // Same fast path as the constraint-set variant above: find and
+        // acquire an existing instance without taking the allocation
+        // privilege so co-located shards don't serialize on it
+        if (find_satisfying_instance(*constraints, regions, result,
+              acquire, tight_region_bounds, remote))
+        {
+          if (footprint != NULL)
+            *footprint = result.get_instance_size();
+          return true;
+        }
         // Create the builder and initialize it before getting
         // the allocation privilege to avoid deadlock scenario
         InstanceBuilder builder(regions,*constraints, runtime, this,creator_id);
@@ -11050,7 +11261,7 @@ namespace Legion {
         if (wait_on.exists())
           wait_on.wait();
         // Since this is find or acquire, first see if we can find
-        // an instance that has already been makde that satisfies 
+        // an instance that has already been makde that satisfies
         // our layout constraints
         // Try to find an instance first and then make one
         bool success = find_satisfying_instance(*constraints, regions,
@@ -11405,9 +11616,51 @@ namespace Legion {
       }
       else
       {
+        // See if we already know that this query cannot be satisfied
+        FailedQueryKey key;
+        key.layout_id = constraints->layout_id;
+        key.regions = regions;
+        key.tight_bounds = tight_region_bounds;
+        RegionTreeID tree_id = 0;
+        for (std::vector<LogicalRegion>::const_iterator it =
+              regions.begin(); it != regions.end(); it++)
+        {
+          if (!it->exists())
+            continue;
+          tree_id = it->get_tree_id();
+          break;
+        }
+        unsigned long long epoch;
+        {
+          AutoLock m_lock(manager_lock, 1, false/*exclusive*/);
+          std::map<RegionTreeID,std::set<FailedQueryKey> >::const_iterator
+            finder = failed_queries.find(tree_id);
+          if ((finder != failed_queries.end()) &&
+              (finder->second.find(key) != finder->second.end()))
+            return false;
+          epoch = failed_query_epoch;
+        }
         // Try to find an instance
-        return find_satisfying_instance(*constraints, regions, result, acquire,
-                                        tight_region_bounds, remote);
+        bool any_entailed = false;
+        if (find_satisfying_instance(*constraints, regions, result, acquire,
+                              tight_region_bounds, remote, &any_entailed))
+          return true;
+        // Record the negative result, but only if the failure was not an
+        // acquire race and no instances were registered while we searched
+        if (!any_entailed)
+        {
+          AutoLock m_lock(manager_lock);
+          if (epoch == failed_query_epoch)
+          {
+            std::set<FailedQueryKey> &failures = failed_queries[tree_id];
+            // Paranoid defense against unbounded growth from a mapper
+            // that generates an endless stream of distinct queries
+            if (failures.size() >= MAX_FAILED_QUERIES_PER_TREE)
+              failures.clear();
+            failures.insert(key);
+          }
+        }
+        return false;
       }
     }
 
@@ -12295,8 +12548,9 @@ namespace Legion {
     bool MemoryManager::find_satisfying_instance(
                                 const LayoutConstraintSet &constraints,
                                 const std::vector<LogicalRegion> &regions,
-                                MappingInstance &result, bool acquire, 
-                                bool tight_region_bounds, bool remote)
+                                MappingInstance &result, bool acquire,
+                                bool tight_region_bounds, bool remote,
+                                bool *any_entailed /*= NULL*/)
     //--------------------------------------------------------------------------
     {
       RegionTreeID tree_id = 0;
@@ -12370,6 +12624,8 @@ namespace Legion {
               continue;
             if ((*it)->entails(constraints, NULL))
             {
+              if (any_entailed != NULL)
+                *any_entailed = true;
               // Check to see if we need to acquire
               // If we fail to acquire then keep going
               if (acquire && !(*it)->acquire_instance(MAPPING_ACQUIRE_REF))
@@ -12389,6 +12645,8 @@ namespace Legion {
           {
             if ((*it)->entails(constraints, NULL))
             {
+              if (any_entailed != NULL)
+                *any_entailed = true;
               // Check to see if we need to acquire
               // If we fail to acquire then keep going
               if (acquire && !(*it)->acquire_instance(MAPPING_ACQUIRE_REF))
@@ -12604,6 +12862,19 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    void MemoryManager::invalidate_failed_queries(RegionTreeID tree_id)
+    //--------------------------------------------------------------------------
+    {
+      // A newly-recorded instance can satisfy previously failed queries
+      failed_query_epoch++;
+      if (failed_queries.empty())
+        return;
+      failed_queries.erase(tree_id);
+      // Queries that did not name any regions searched every tree
+      failed_queries.erase(0);
+    }
+
     //--------------------------------------------------------------------------
     PhysicalManager* MemoryManager::create_unbound_instance(
                                                LogicalRegion region,
@@ -12990,6 +13261,23 @@ namespace Legion {
           }
           if (next->second.empty())
             collectable_instances.erase(next);
+          // Sort the candidates of this priority class so that we consider
+          // evicting the instances that have been idle the longest first.
+          // Candidates are popped from the back of these vectors so we
+          // order them from most recently used down to least recently used.
+          struct WarmestFirst {
+            inline bool operator()(PhysicalManager *left,
+                                   PhysicalManager *right) const
+            {
+              return (left->get_last_collectable_time() >
+                      right->get_last_collectable_time());
+            }
+          };
+          std::sort(perfect_holes.begin(), perfect_holes.end(),WarmestFirst());
+          std::sort(small_holes.begin(), small_holes.end(), WarmestFirst());
+          for (std::map<size_t,std::vector<PhysicalManager*> >::iterator it =
+                large_holes.begin(); it != large_holes.end(); it++)
+            std::sort(it->second.begin(), it->second.end(), WarmestFirst());
         }
         else
           current_priority = LEGION_GC_NEVER_PRIORITY;
@@ -13188,8 +13476,45 @@ namespace Legion {
 #ifdef DEBUG_LEGION
       assert(is_owner);
 #endif
-      // First, just try to make the instance as is, if it works we are done 
       size_t needed_size;
+      // For reduction instance requests first look for a dead reduction
+      // instance with the same reduction op and footprint whose memory we
+      // can recycle with a redistrict: applications that create and destroy
+      // reduction instances every timestep then reuse the same allocation
+      // instead of paying Realm for a fresh one each epoch
+      if (builder.get_redop(runtime->forest) > 0)
+      {
+        const size_t recycle_size = builder.compute_footprint(runtime->forest);
+        if (recycle_size > 0)
+        {
+          PhysicalInstance hole = PhysicalInstance::NO_INST;
+          LgEvent hole_unique;
+          const RtEvent collection_done = find_reduction_hole(recycle_size,
+              builder.get_redop(runtime->forest), hole, hole_unique);
+          if (hole.exists())
+          {
+            PhysicalManager *recycled = builder.create_physical_instance(
+                runtime->forest, unsat_kind, unsat_index, &needed_size,
+                collection_done, hole, hole_unique);
+            if (footprint != NULL)
+              *footprint = needed_size;
+            if (recycled != NULL)
+            {
+#ifdef DEBUG_LEGION
+#ifndef NDEBUG
+              size_t previous =
+#endif
+#endif
+                remaining_capacity.fetch_sub(needed_size);
+#ifdef DEBUG_LEGION
+              assert(needed_size <= previous);
+#endif
+              return recycled;
+            }
+          }
+        }
+      }
+      // First, just try to make the instance as is, if it works we are done
       PhysicalManager *result = builder.create_physical_instance(
           runtime->forest, unsat_kind, unsat_index, &needed_size);
       if (footprint != NULL)
@@ -13237,6 +13562,76 @@ namespace Legion {
       return result;
     }
 
+    //--------------------------------------------------------------------------
+    RtEvent MemoryManager::find_reduction_hole(size_t needed_size,
+              ReductionOpID redop, PhysicalInstance &hole, LgEvent &hole_unique)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(is_owner);
+      assert(!hole.exists());
+#endif
+      // Once a reduction instance loses its last valid reference its
+      // contents are dead (any applied reductions have been flushed) so
+      // there is no value in keeping it around for reuse the way there is
+      // for normal instances; recycling its memory eagerly is always safe
+      std::vector<PhysicalManager*> candidates;
+      {
+        AutoLock m_lock(manager_lock);
+        for (std::map<GCPriority,std::set<PhysicalManager*>,
+              std::greater<GCPriority> >::const_iterator pit =
+              collectable_instances.begin(); pit !=
+              collectable_instances.end(); pit++)
+        {
+          for (std::set<PhysicalManager*>::const_iterator it =
+                pit->second.begin(); it != pit->second.end(); it++)
+          {
+            if (((*it)->redop != redop) ||
+                ((*it)->instance_footprint != needed_size))
+              continue;
+            bool already_collected = false;
+            if (!(*it)->can_collect(already_collected))
+              continue;
+            // Add a reference that ensures that this manager won't be
+            // deleted out from under us when we do the call to 'collect'
+            (*it)->add_base_gc_ref(MEMORY_MANAGER_REF);
+            candidates.push_back(*it);
+          }
+        }
+      }
+      RtEvent result;
+      for (std::vector<PhysicalManager*>::const_iterator it =
+            candidates.begin(); it != candidates.end(); it++)
+      {
+        if (!hole.exists())
+        {
+          RtEvent collected;
+          if ((*it)->collect(collected, &hole))
+          {
+            // The credit here is matched by the debit the caller performs
+            // when the recycled instance takes over this memory
+#ifdef DEBUG_LEGION
+#ifndef NDEBUG
+            const size_t previous =
+#endif
+#endif
+              remaining_capacity.fetch_add((*it)->instance_footprint);
+#ifdef DEBUG_LEGION
+            assert((previous + (*it)->instance_footprint) <= capacity);
+#endif
+            if (hole.exists())
+            {
+              hole_unique = (*it)->get_unique_event();
+              result = collected;
+            }
+          }
+        }
+        if ((*it)->remove_base_gc_ref(MEMORY_MANAGER_REF))
+          delete (*it);
+      }
+      return result;
+    }
+
     //--------------------------------------------------------------------------
     void MemoryManager::record_created_instance(PhysicalManager *manager,
                                               bool acquire, GCPriority priority)
@@ -13274,6 +13669,7 @@ namespace Legion {
         assert(insts.find(manager) == insts.end());
 #endif
         insts[manager] = priority;
+        invalidate_failed_queries(manager->tree_id);
         if (priority != LEGION_GC_NEVER_PRIORITY)
           collectable_instances[priority].insert(manager);
       }
@@ -14239,6 +14635,7 @@ namespace Legion {
         assert(insts.find(manager) == insts.end());
 #endif
         insts[manager] = LEGION_GC_NEVER_PRIORITY;
+        invalidate_failed_queries(manager->tree_id);
       }
       return RtEvent::NO_RT_EVENT;
     }
@@ -15251,6 +15648,11 @@ namespace Legion {
               runtime->handle_task(derez);
               break;
             }
+          case SLICE_RELAY_MESSAGE:
+            {
+              runtime->handle_slice_relay(derez);
+              break;
+            }
           case STEAL_MESSAGE:
             {
               runtime->handle_steal(derez);
@@ -15955,6 +16357,11 @@ namespace Legion {
               runtime->handle_view_add_copy_user(derez, remote_address_space);
               break;
             }
+          case SEND_VIEW_INVALIDATE_READ_CACHES:
+            {
+              runtime->handle_view_invalidate_read_caches(derez);
+              break;
+            }
           case SEND_VIEW_FIND_LAST_USERS_REQUEST:
             {
               runtime->handle_view_find_last_users_request(derez,
@@ -17959,11 +18366,13 @@ namespace Legion {
     /////////////////////////////////////////////////////////////
 
     //--------------------------------------------------------------------------
-    VariantImpl::VariantImpl(Runtime *rt, VariantID v, TaskImpl *own, 
+    VariantImpl::VariantImpl(Runtime *rt, VariantID v, TaskImpl *own,
                              const TaskVariantRegistrar &registrar,
                              size_t return_size, bool has_return_size,
                              const CodeDescriptor &realm,
-                             const void *udata/*=NULL*/,size_t udata_size/*=0*/)
+                             const void *udata/*=NULL*/,size_t udata_size/*=0*/,
+                             const void *desc_blob/*=NULL*/,
+                             size_t desc_blob_size/*=0*/)
       : vid(v), owner(own), runtime(rt), global(registrar.global_registration),
         needs_padding(check_padding(rt, registrar.layout_constraints)),
         has_return_type_size(has_return_size), return_type_size(return_size),
@@ -17995,43 +18404,101 @@ namespace Legion {
       }
       else
         variant_name = strdup(registrar.task_variant_name);
-      // If a global registration was requested, but the code descriptor
-      // provided does not have portable implementations, try to make one
-      // (if it fails, we'll complain below)
-      if (global && !realm_descriptor.has_portable_implementations())
-	realm_descriptor.create_portable_implementation();
+      if (desc_blob != NULL)
+      {
+        // We arrived with a serialized portable code descriptor, defer
+        // both its deserialization and the realm registration until the
+        // first time this variant is dispatched on this node so that
+        // nodes which never run the variant do not pay for materializing
+        // it, see materialize_descriptor
+        descriptor_blob = malloc(desc_blob_size);
+        memcpy(descriptor_blob, desc_blob, desc_blob_size);
+        descriptor_blob_size = desc_blob_size;
+        descriptor_materialized.store(false);
+        descriptor_materializing.store(false);
+        descriptor_ready_event = Runtime::create_rt_user_event();
+      }
+      else
+      {
+        descriptor_blob = NULL;
+        descriptor_blob_size = 0;
+        descriptor_materialized.store(true);
+        descriptor_materializing.store(true);
+        // If a global registration was requested, but the code descriptor
+        // provided does not have portable implementations, try to make one
+        // (if it fails, we'll complain below)
+        if (global && !realm_descriptor.has_portable_implementations())
+          realm_descriptor.create_portable_implementation();
+        ready_event = perform_realm_registration();
+        // Check that global registration has portable implementations
+        if (global && (!realm_descriptor.has_portable_implementations()))
+          REPORT_LEGION_ERROR(ERROR_ILLEGAL_GLOBAL_VARIANT_REGISTRATION,
+               "Variant %s requested global registration without "
+                           "a portable implementation.", variant_name)
+      }
+      // register this with the runtime profiler if we have to
+      if (runtime->profiler != NULL)
+        runtime->profiler->register_task_variant(own->task_id, vid,
+            variant_name);
+      if (leaf_variant && inner_variant)
+        REPORT_LEGION_ERROR(ERROR_INVALID_TASK_VARIANT_PROPERTIES,
+                      "Task variant %s (ID %d) of task %s (ID %d) is not "
+                      "permitted to be both inner and leaf tasks "
+                      "simultaneously.", variant_name, vid,
+                      owner->get_name(), owner->task_id)
+      if (runtime->record_registration)
+        log_run.print("Task variant %s of task %s (ID %d) has Realm ID %ld",
+              variant_name, owner->get_name(), owner->task_id, descriptor_id);
+    }
+
+    //--------------------------------------------------------------------------
+    VariantImpl::~VariantImpl(void)
+    //--------------------------------------------------------------------------
+    {
+      if (user_data != NULL)
+        free(user_data);
+      if (variant_name != NULL)
+        free(variant_name);
+      if (descriptor_blob != NULL)
+        free(descriptor_blob);
+    }
+
+    //--------------------------------------------------------------------------
+    ApEvent VariantImpl::perform_realm_registration(void)
+    //--------------------------------------------------------------------------
+    {
       // Perform the registration, the normal case is not to have separate
       // runtime instances, but if we do have them, we only register on
       // the local processor
       if (!runtime->separate_runtime_instances)
       {
         Realm::ProfilingRequestSet profiling_requests;
-        const ProcessorConstraint &proc_constraint = 
+        const ProcessorConstraint &proc_constraint =
           execution_constraints.processor_constraint;
         if (proc_constraint.valid_kinds.empty())
         {
-          REPORT_LEGION_WARNING(LEGION_WARNING_MISSING_PROC_CONSTRAINT, 
+          REPORT_LEGION_WARNING(LEGION_WARNING_MISSING_PROC_CONSTRAINT,
                      "NO PROCESSOR CONSTRAINT SPECIFIED FOR VARIANT"
                      " %s (ID %d) OF TASK %s (ID %d)! ASSUMING LOC_PROC!",
                      variant_name, vid, owner->get_name(false), owner->task_id)
-          ready_event = ApEvent(Processor::register_task_by_kind(
-                Processor::LOC_PROC, false/*global*/, descriptor_id, 
+          return ApEvent(Processor::register_task_by_kind(
+                Processor::LOC_PROC, false/*global*/, descriptor_id,
                 realm_descriptor, profiling_requests, user_data, user_data_size));
         }
         else if (proc_constraint.valid_kinds.size() > 1)
         {
           std::set<ApEvent> ready_events;
-          for (std::vector<Processor::Kind>::const_iterator it = 
+          for (std::vector<Processor::Kind>::const_iterator it =
                 proc_constraint.valid_kinds.begin(); it !=
                 proc_constraint.valid_kinds.end(); it++)
             ready_events.insert(ApEvent(Processor::register_task_by_kind(*it,
-                false/*global*/, descriptor_id, realm_descriptor, 
+                false/*global*/, descriptor_id, realm_descriptor,
                 profiling_requests, user_data, user_data_size)));
-          ready_event = Runtime::merge_events(NULL, ready_events);
+          return Runtime::merge_events(NULL, ready_events);
         }
         else
-          ready_event = ApEvent(Processor::register_task_by_kind(
-              proc_constraint.valid_kinds[0], false/*global*/, descriptor_id, 
+          return ApEvent(Processor::register_task_by_kind(
+              proc_constraint.valid_kinds[0], false/*global*/, descriptor_id,
               realm_descriptor, profiling_requests, user_data, user_data_size));
       }
       else
@@ -18042,7 +18509,7 @@ namespace Legion {
         Machine::ProcessorQuery local_procs(runtime->machine);
         local_procs.local_address_space();
         std::set<ApEvent> ready_events;
-        for (Machine::ProcessorQuery::iterator it = 
+        for (Machine::ProcessorQuery::iterator it =
               local_procs.begin(); it != local_procs.end(); it++)
         {
           const Processor::Kind kind = it->kind();
@@ -18050,41 +18517,45 @@ namespace Legion {
             continue;
           Realm::ProfilingRequestSet profiling_requests;
           ready_events.insert(ApEvent(Processor::register_task_by_kind(kind,
-                          false/*global*/, descriptor_id, realm_descriptor, 
+                          false/*global*/, descriptor_id, realm_descriptor,
                           profiling_requests, user_data, user_data_size)));
           handled_kinds.insert(kind);
         }
         if (!ready_events.empty())
-          ready_event = Runtime::merge_events(NULL, ready_events);
+          return Runtime::merge_events(NULL, ready_events);
+        return ApEvent::NO_AP_EVENT;
       }
-      // register this with the runtime profiler if we have to
-      if (runtime->profiler != NULL)
-        runtime->profiler->register_task_variant(own->task_id, vid,
-            variant_name);
-      // Check that global registration has portable implementations
-      if (global && (!realm_descriptor.has_portable_implementations()))
-        REPORT_LEGION_ERROR(ERROR_ILLEGAL_GLOBAL_VARIANT_REGISTRATION, 
-             "Variant %s requested global registration without "
-                         "a portable implementation.", variant_name)
-      if (leaf_variant && inner_variant)
-        REPORT_LEGION_ERROR(ERROR_INVALID_TASK_VARIANT_PROPERTIES,
-                      "Task variant %s (ID %d) of task %s (ID %d) is not "
-                      "permitted to be both inner and leaf tasks "
-                      "simultaneously.", variant_name, vid,
-                      owner->get_name(), owner->task_id)
-      if (runtime->record_registration)
-        log_run.print("Task variant %s of task %s (ID %d) has Realm ID %ld",
-              variant_name, owner->get_name(), owner->task_id, descriptor_id);
     }
 
     //--------------------------------------------------------------------------
-    VariantImpl::~VariantImpl(void)
+    void VariantImpl::materialize_descriptor(void)
     //--------------------------------------------------------------------------
     {
-      if (user_data != NULL)
-        free(user_data);
-      if (variant_name != NULL)
-        free(variant_name);
+      bool expected = false;
+      if (descriptor_materializing.compare_exchange_strong(expected, true))
+      {
+        // We won the race so deserialize the deferred portable code
+        // descriptor and register it with the local realm processors
+        Realm::Serialization::FixedBufferDeserializer
+          deserializer(descriptor_blob, descriptor_blob_size);
+#ifdef DEBUG_LEGION
+#ifndef NDEBUG
+        bool ok =
+#endif
+                  realm_descriptor.deserialize(deserializer);
+        assert(ok);
+#else
+        realm_descriptor.deserialize(deserializer);
+#endif
+        ready_event = perform_realm_registration();
+        descriptor_materialized.store(true);
+        Runtime::trigger_event(descriptor_ready_event);
+      }
+      else if (!descriptor_materialized.load())
+      {
+        // Someone else is materializing the descriptor, wait for them
+        descriptor_ready_event.wait();
+      }
     }
 
     //--------------------------------------------------------------------------
@@ -18131,6 +18602,10 @@ namespace Legion {
       runtime->increment_total_outstanding_tasks();
 #endif
       DETAILED_PROFILER(runtime, REALM_SPAWN_TASK_CALL);
+      // If this variant arrived with a lazy descriptor blob then make
+      // sure it has been materialized locally before we can spawn it
+      if (!descriptor_materialized.load())
+        materialize_descriptor();
       if (ready_event.exists())
         return ApEvent(target.spawn(descriptor_id, &ctx, sizeof(ctx),requests,
            Runtime::merge_events(NULL, precondition, ready_event), priority));
@@ -18158,6 +18633,17 @@ namespace Legion {
     void VariantImpl::broadcast_variant(RtUserEvent done, AddressSpaceID origin,
                                         AddressSpaceID local)
     //--------------------------------------------------------------------------
+    {
+      const std::vector<VariantImpl*> variants(1, this);
+      broadcast_variants(runtime, variants, done, origin, local);
+    }
+
+    //--------------------------------------------------------------------------
+    /*static*/ void VariantImpl::broadcast_variants(Runtime *runtime,
+                                  const std::vector<VariantImpl*> &variants,
+                                  RtUserEvent done, AddressSpaceID origin,
+                                  AddressSpaceID local)
+    //--------------------------------------------------------------------------
     {
       std::vector<AddressSpaceID> targets;
       std::vector<AddressSpaceID> locals;
@@ -18181,46 +18667,11 @@ namespace Legion {
           Serializer rez;
           {
             RezCheck z(rez);
-            // pack the code descriptors 
-            Realm::Serialization::ByteCountSerializer counter;
-            realm_descriptor.serialize(counter, true/*portable*/);
-            const size_t impl_size = counter.bytes_used();
-            rez.serialize(impl_size);
-            {
-              Realm::Serialization::FixedBufferSerializer 
-                serializer(rez.reserve_bytes(impl_size), impl_size);
-              realm_descriptor.serialize(serializer, true/*portable*/);
-            }
-            rez.serialize(owner->task_id);
-            rez.serialize(vid);
-            // Extra padding to fix a realm bug for now
-            rez.serialize(vid);
+            rez.serialize<size_t>(variants.size());
+            for (std::vector<VariantImpl*>::const_iterator it =
+                  variants.begin(); it != variants.end(); it++)
+              (*it)->pack_variant(rez);
             rez.serialize(next_done);
-            rez.serialize(return_type_size);
-            rez.serialize(has_return_type_size);
-            rez.serialize(user_data_size);
-            if (user_data_size > 0)
-              rez.serialize(user_data, user_data_size);
-            rez.serialize(leaf_variant);
-            if (leaf_variant)
-            {
-              rez.serialize<size_t>(leaf_pool_bounds.size());
-              for (std::map<Memory::Kind,PoolBounds>::const_iterator it =
-                    leaf_pool_bounds.begin(); it !=
-                    leaf_pool_bounds.end(); it++)
-              {
-                rez.serialize(it->first);
-                rez.serialize(it->second);
-              }
-            }
-            rez.serialize(inner_variant);
-            rez.serialize(idempotent_variant);
-            rez.serialize(replicable_variant);
-            size_t name_size = strlen(variant_name)+1;
-            rez.serialize(variant_name, name_size);
-            // Pack the constraints
-            execution_constraints.serialize(rez);
-            layout_constraints.serialize(rez);
             rez.serialize(origin);
             rez.serialize(locals[idx]);
           }
@@ -18233,6 +18684,61 @@ namespace Legion {
         Runtime::trigger_event(done);
     }
 
+    //--------------------------------------------------------------------------
+    void VariantImpl::pack_variant(Serializer &rez)
+    //--------------------------------------------------------------------------
+    {
+      // Pack the code descriptor, forwarding the still-serialized blob
+      // directly if this variant arrived with a lazy descriptor, the
+      // blob is immutable once set so this is safe without the lock
+      if (descriptor_blob != NULL)
+      {
+        rez.serialize(descriptor_blob_size);
+        rez.serialize(descriptor_blob, descriptor_blob_size);
+      }
+      else
+      {
+        Realm::Serialization::ByteCountSerializer counter;
+        realm_descriptor.serialize(counter, true/*portable*/);
+        const size_t impl_size = counter.bytes_used();
+        rez.serialize(impl_size);
+        {
+          Realm::Serialization::FixedBufferSerializer
+            serializer(rez.reserve_bytes(impl_size), impl_size);
+          realm_descriptor.serialize(serializer, true/*portable*/);
+        }
+      }
+      rez.serialize(owner->task_id);
+      rez.serialize(vid);
+      // Extra padding to fix a realm bug for now
+      rez.serialize(vid);
+      rez.serialize(return_type_size);
+      rez.serialize(has_return_type_size);
+      rez.serialize(user_data_size);
+      if (user_data_size > 0)
+        rez.serialize(user_data, user_data_size);
+      rez.serialize(leaf_variant);
+      if (leaf_variant)
+      {
+        rez.serialize<size_t>(leaf_pool_bounds.size());
+        for (std::map<Memory::Kind,PoolBounds>::const_iterator it =
+              leaf_pool_bounds.begin(); it !=
+              leaf_pool_bounds.end(); it++)
+        {
+          rez.serialize(it->first);
+          rez.serialize(it->second);
+        }
+      }
+      rez.serialize(inner_variant);
+      rez.serialize(idempotent_variant);
+      rez.serialize(replicable_variant);
+      size_t name_size = strlen(variant_name)+1;
+      rez.serialize(variant_name, name_size);
+      // Pack the constraints
+      execution_constraints.serialize(rez);
+      layout_constraints.serialize(rez);
+    }
+
     //--------------------------------------------------------------------------
     void VariantImpl::find_padded_locks(SingleTask *task,
                         const std::vector<RegionRequirement> &regions,
@@ -18366,83 +18872,71 @@ namespace Legion {
     //--------------------------------------------------------------------------
     {
       DerezCheck z(derez);
-      size_t impl_size;
-      derez.deserialize(impl_size);
-      CodeDescriptor realm_desc;
-      {
-        // Realm's serializers assume properly aligned buffers, so
-        // malloc a temporary buffer here and copy the data to ensure
-        // alignment.
-        void *impl_buffer = malloc(impl_size);
-#ifdef DEBUG_LEGION
-        assert(impl_buffer);
-#endif
-        memcpy(impl_buffer, derez.get_current_pointer(), impl_size);
+      size_t num_variants;
+      derez.deserialize(num_variants);
+      std::vector<VariantImpl*> variants(num_variants);
+      for (unsigned vidx = 0; vidx < num_variants; vidx++)
+      {
+        size_t impl_size;
+        derez.deserialize(impl_size);
+        // Keep the code descriptor in its serialized form, it will only
+        // be deserialized if and when this node dispatches the variant
+        const void *impl_buffer = derez.get_current_pointer();
         derez.advance_pointer(impl_size);
-        Realm::Serialization::FixedBufferDeserializer
-          deserializer(impl_buffer, impl_size);
-#ifdef DEBUG_LEGION
-#ifndef NDEBUG
-        bool ok =
-#endif
-                  realm_desc.deserialize(deserializer);
-        assert(ok);
-#else
-        realm_desc.deserialize(deserializer);
-#endif
-        free(impl_buffer);
+        TaskID task_id;
+        derez.deserialize(task_id);
+        TaskVariantRegistrar registrar(task_id, false/*global*/);
+        VariantID variant_id;
+        derez.deserialize(variant_id);
+        // Extra padding to fix a realm bug for now
+        derez.deserialize(variant_id);
+        size_t return_type_size;
+        derez.deserialize(return_type_size);
+        bool has_return_type_size;
+        derez.deserialize(has_return_type_size);
+        size_t user_data_size;
+        derez.deserialize(user_data_size);
+        const void *user_data = derez.get_current_pointer();
+        derez.advance_pointer(user_data_size);
+        derez.deserialize(registrar.leaf_variant);
+        if (registrar.leaf_variant)
+        {
+          size_t num_pools;
+          derez.deserialize(num_pools);
+          for (unsigned idx = 0; idx < num_pools; idx++)
+          {
+            Memory::Kind memkind;
+            derez.deserialize(memkind);
+            derez.deserialize(registrar.leaf_pool_bounds[memkind]);
+          }
+        }
+        derez.deserialize(registrar.inner_variant);
+        derez.deserialize(registrar.idempotent_variant);
+        derez.deserialize(registrar.replicable_variant);
+        // The last thing will be the name
+        registrar.task_variant_name = (const char*)derez.get_current_pointer();
+        size_t name_size = strlen(registrar.task_variant_name)+1;
+        derez.advance_pointer(name_size);
+        // Unpack the constraints
+        registrar.execution_constraints.deserialize(derez);
+        registrar.layout_constraints.deserialize(derez);
+        // Ask the runtime to perform the registration
+        // Can lie about preregistration since the user would already have
+        // gotten there error message on the owner node
+        const CodeDescriptor empty_desc;
+        runtime->register_variant(registrar, user_data, user_data_size,
+              empty_desc, return_type_size, has_return_type_size, variant_id,
+              false/*check task*/, false/*check context*/,
+              true/*preregistered*/, impl_buffer, impl_size);
+        variants[vidx] = runtime->find_variant_impl(task_id, variant_id);
       }
-      TaskID task_id;
-      derez.deserialize(task_id);
-      TaskVariantRegistrar registrar(task_id, false/*global*/);
-      VariantID variant_id;
-      derez.deserialize(variant_id);
-      // Extra padding to fix a realm bug for now
-      derez.deserialize(variant_id); 
       RtUserEvent done;
       derez.deserialize(done);
-      size_t return_type_size;
-      derez.deserialize(return_type_size);
-      bool has_return_type_size;
-      derez.deserialize(has_return_type_size);
-      size_t user_data_size;
-      derez.deserialize(user_data_size);
-      const void *user_data = derez.get_current_pointer();
-      derez.advance_pointer(user_data_size);
-      derez.deserialize(registrar.leaf_variant);
-      if (registrar.leaf_variant)
-      {
-        size_t num_pools;
-        derez.deserialize(num_pools);
-        for (unsigned idx = 0; idx < num_pools; idx++)
-        {
-          Memory::Kind memkind;
-          derez.deserialize(memkind);
-          derez.deserialize(registrar.leaf_pool_bounds[memkind]);
-        }
-      }
-      derez.deserialize(registrar.inner_variant);
-      derez.deserialize(registrar.idempotent_variant);
-      derez.deserialize(registrar.replicable_variant);
-      // The last thing will be the name
-      registrar.task_variant_name = (const char*)derez.get_current_pointer();
-      size_t name_size = strlen(registrar.task_variant_name)+1;
-      derez.advance_pointer(name_size);
-      // Unpack the constraints
-      registrar.execution_constraints.deserialize(derez);
-      registrar.layout_constraints.deserialize(derez);
-      // Ask the runtime to perform the registration 
-      // Can lie about preregistration since the user would already have
-      // gotten there error message on the owner node
-      runtime->register_variant(registrar, user_data, user_data_size,
-            realm_desc, return_type_size, has_return_type_size, variant_id,
-            false/*check task*/, false/*check context*/, true/*preregistered*/);
       AddressSpaceID origin;
       derez.deserialize(origin);
       AddressSpaceID local;
       derez.deserialize(local);
-      VariantImpl *impl = runtime->find_variant_impl(task_id, variant_id);
-      impl->broadcast_variant(done, origin, local);
+      broadcast_variants(runtime, variants, done, origin, local);
     }
 
     /////////////////////////////////////////////////////////////
@@ -18996,10 +19490,93 @@ namespace Legion {
           return result;
         }
       }
-    } 
+    }
 
     //--------------------------------------------------------------------------
-    void ProjectionFunction::project_points(const RegionRequirement &req, 
+    bool ProjectionFunction::replay_memoized_results(
+                  const RegionRequirement &req, unsigned index,
+                  const Domain &launch_domain,
+                  const std::vector<PointTask*> &point_tasks)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(is_functional);
+#endif
+      AutoLock p_lock(projection_reservation);
+      const std::map<DomainPoint,LogicalRegion> *memo = NULL;
+      if (req.handle_type == LEGION_PARTITION_PROJECTION)
+      {
+        std::map<std::pair<LogicalPartition,Domain>,
+                 std::map<DomainPoint,LogicalRegion> >::const_iterator
+          finder = partition_memos.find(
+              std::make_pair(req.partition, launch_domain));
+        if (finder != partition_memos.end())
+          memo = &finder->second;
+      }
+      else
+      {
+        std::map<std::pair<LogicalRegion,Domain>,
+                 std::map<DomainPoint,LogicalRegion> >::const_iterator
+          finder = region_memos.find(std::make_pair(req.region, launch_domain));
+        if (finder != region_memos.end())
+          memo = &finder->second;
+      }
+      if (memo == NULL)
+        return false;
+      // All of our points need to be present before we can replay anything
+      // since different shards project different subsets of the launch domain
+      std::vector<LogicalRegion> regions(point_tasks.size());
+      for (unsigned idx = 0; idx < point_tasks.size(); idx++)
+      {
+        std::map<DomainPoint,LogicalRegion>::const_iterator finder =
+          memo->find(point_tasks[idx]->get_domain_point());
+        if (finder == memo->end())
+          return false;
+        regions[idx] = finder->second;
+      }
+      // These results were validated when they were memoized so there is
+      // no need to check them again
+      for (unsigned idx = 0; idx < point_tasks.size(); idx++)
+        point_tasks[idx]->set_projection_result(index, regions[idx]);
+      return true;
+    }
+
+    //--------------------------------------------------------------------------
+    void ProjectionFunction::memoize_results(const RegionRequirement &req,
+                  const Domain &launch_domain,
+                  const std::vector<PointTask*> &point_tasks,
+                  const std::vector<LogicalRegion> &results)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(point_tasks.size() == results.size());
+#endif
+      AutoLock p_lock(projection_reservation);
+      std::map<DomainPoint,LogicalRegion> *memo = NULL;
+      if (req.handle_type == LEGION_PARTITION_PROJECTION)
+      {
+        const std::pair<LogicalPartition,Domain> key(req.partition,
+                                                     launch_domain);
+        // Bound the number of launch shapes we remember with epoch clears
+        if ((partition_memos.size() >= MAX_MEMOIZED_LAUNCHES) &&
+            (partition_memos.find(key) == partition_memos.end()))
+          partition_memos.clear();
+        memo = &partition_memos[key];
+      }
+      else
+      {
+        const std::pair<LogicalRegion,Domain> key(req.region, launch_domain);
+        if ((region_memos.size() >= MAX_MEMOIZED_LAUNCHES) &&
+            (region_memos.find(key) == region_memos.end()))
+          region_memos.clear();
+        memo = &region_memos[key];
+      }
+      for (unsigned idx = 0; idx < point_tasks.size(); idx++)
+        (*memo)[point_tasks[idx]->get_domain_point()] = results[idx];
+    }
+
+    //--------------------------------------------------------------------------
+    void ProjectionFunction::project_points(const RegionRequirement &req,
                   unsigned index, Runtime *runtime, const Domain &launch_domain,
                   const std::vector<PointTask*> &point_tasks,
                   const std::vector<PointwiseDependence> *pointwise_dependences,
@@ -19025,7 +19602,15 @@ namespace Legion {
       // Can skip pointwise analysis if we're replaying
       if (replaying)
         pointwise_dependences = NULL;
-      if (find_dependences || (pointwise_dependences != NULL))
+      // For functional projections on launches that need no dependence
+      // analysis, try to replay results memoized from an earlier launch of
+      // the same shape, and memoize the results we compute if we can't
+      const bool memoize = is_functional && (args == NULL) &&
+        !find_dependences && (pointwise_dependences == NULL);
+      if (memoize &&
+          replay_memoized_results(req, index, launch_domain, point_tasks))
+        return;
+      if (find_dependences || (pointwise_dependences != NULL) || memoize)
         pointwise_regions.reserve(point_tasks.size());
       if (!is_exclusive)
       {
@@ -19057,7 +19642,7 @@ namespace Legion {
               }
               check_containment((*it), index, region_deps);
             }
-            else if (pointwise_dependences != NULL)
+            else if ((pointwise_dependences != NULL) || memoize)
               pointwise_regions.emplace_back(result);
           }
         }
@@ -19087,7 +19672,7 @@ namespace Legion {
               }
               check_containment((*it), index, region_deps);
             }
-            else if (pointwise_dependences != NULL)
+            else if ((pointwise_dependences != NULL) || memoize)
               pointwise_regions.emplace_back(result);
           }
         }
@@ -19121,7 +19706,7 @@ namespace Legion {
               }
               check_containment((*it), index, region_deps);
             }
-            else if (pointwise_dependences != NULL)
+            else if ((pointwise_dependences != NULL) || memoize)
               pointwise_regions.emplace_back(result);
           }
         }
@@ -19154,7 +19739,7 @@ namespace Legion {
               }
               check_containment((*it), index, region_deps);
             }
-            else if (pointwise_dependences != NULL)
+            else if ((pointwise_dependences != NULL) || memoize)
               pointwise_regions.emplace_back(result);
           }
         }
@@ -19216,6 +19801,8 @@ namespace Legion {
           }
         }
       }
+      if (memoize && !pointwise_regions.empty())
+        memoize_results(req, launch_domain, point_tasks, pointwise_regions);
     }
 
     //--------------------------------------------------------------------------
@@ -20131,6 +20718,34 @@ namespace Legion {
       }
     }
 
+    //--------------------------------------------------------------------------
+    const std::vector<ShardID>& ShardingFunction::find_shard_assignments(
+                            const Domain &domain, const Domain &sharding_space)
+    //--------------------------------------------------------------------------
+    {
+      const std::pair<Domain,Domain> key(domain, sharding_space);
+      // Check to see if we already have it
+      {
+        AutoLock s_lock(sharding_lock,1,false/*exclusive*/);
+        std::map<std::pair<Domain,Domain>,std::vector<ShardID> >::
+          const_iterator finder = shard_assignments.find(key);
+        if (finder != shard_assignments.end())
+          return finder->second;
+      }
+      // Compute the assignments outside the lock since the functor
+      // invocations can be arbitrarily expensive
+      std::vector<ShardID> assignments;
+      assignments.reserve(domain.get_volume());
+      for (Domain::DomainPointIterator itr(domain); itr; itr++)
+        assignments.push_back(find_owner(itr.p, sharding_space));
+      AutoLock s_lock(sharding_lock);
+      // If we lost the race then this keeps the existing entry
+      // Note that map entries are stable so it is safe to return a
+      // reference to the vector even as other entries are added
+      return shard_assignments.emplace(key,
+          std::move(assignments)).first->second;
+    }
+
     //--------------------------------------------------------------------------
     IndexSpace ShardingFunction::find_shard_space(ShardID shard,
      IndexSpaceNode *full_space, IndexSpace shard_space, Provenance *provenance)
@@ -20243,11 +20858,17 @@ namespace Legion {
         initial_meta_task_vector_width(config.initial_meta_task_vector_width),
         max_message_size(config.max_message_size),
         gc_epoch_size(config.gc_epoch_size),
+        gc_utility_procs(config.gc_utility_procs),
         max_control_replication_contexts(
                       config.max_control_replication_contexts),
         max_local_fields(config.max_local_fields),
         max_replay_parallelism(config.max_replay_parallelism),
-        safe_control_replication(config.safe_control_replication),
+        safe_control_replication(
+            // Deferred checking still needs the API calls to be hashed
+            ((config.safe_control_replication == 0) &&
+             config.defer_control_replication) ? 1 :
+              config.safe_control_replication),
+        defer_control_replication(config.defer_control_replication),
         program_order_execution(config.program_order_execution),
         dump_physical_traces(config.dump_physical_traces),
         no_tracing(config.no_tracing),
@@ -20281,8 +20902,10 @@ namespace Legion {
         legion_spy_enabled(config.legion_spy_enabled),
         supply_default_mapper(default_mapper),
         enable_test_mapper(config.enable_test_mapper),
+        mine_layouts(config.mine_layouts),
         legion_ldb_enabled(!config.ldb_file.empty()),
         replay_file(legion_ldb_enabled ? config.ldb_file : config.replay_file),
+        auto_trace_file(config.auto_trace_file),
 #ifdef DEBUG_LEGION
         logging_region_tree_state(config.logging_region_tree_state),
         verbose_logging(config.verbose_logging),
@@ -20293,7 +20916,8 @@ namespace Legion {
         dump_free_ranges(config.dump_free_ranges),
         legion_collective_radix(config.legion_collective_radix),
         mpi_rank_table((mpi_rank >= 0) ? new MPIRankTable(this) : NULL),
-        prepared_for_shutdown(false), total_outstanding_tasks(0), 
+        prepared_for_shutdown(false), future_instance_live_bytes(0),
+        future_instance_peak_bytes(0), total_outstanding_tasks(0),
         outstanding_top_level_tasks(initialize_outstanding_top_level_tasks(
               address_space, total_address_spaces, legion_collective_radix)),
         local_procs(locals), local_utils(local_utilities),
@@ -20351,6 +20975,10 @@ namespace Legion {
             address_space, LEGION_MAX_NUM_NODES)
       log_run.debug("Initializing Legion runtime in address space %x",
                             address_space);
+      // Load any profile-guided layout relaxations before any variants
+      // can be registered
+      if (!config.layout_override_file.empty())
+        load_layout_overrides(config.layout_override_file);
       // Construct a local utility processor group
       if (local_utils.empty())
       {
@@ -20366,22 +20994,40 @@ namespace Legion {
           utility_group = ProcessorGroup::create_group(util_group);
         }
         local_group = utility_group;
+        gc_group = utility_group;
       }
       else
       {
-        if (local_utils.size() == 1)
-          utility_group = *(local_utils.begin());
+        std::vector<Processor> util_g(local_utils.begin(), local_utils.end());
+        // If we were asked to dedicate some utility processors to a
+        // separate lane for background cleanup then split them off here
+        // so cleanup meta-tasks can never occupy all the utility
+        // processors ahead of the analysis and mapping path
+        if ((gc_utility_procs > 0) && (util_g.size() > gc_utility_procs))
+        {
+          std::vector<Processor> gc_g(util_g.end() - gc_utility_procs,
+                                      util_g.end());
+          util_g.resize(util_g.size() - gc_utility_procs);
+          if (gc_g.size() == 1)
+            gc_group = gc_g.front();
+          else
+            gc_group = ProcessorGroup::create_group(gc_g);
+        }
+        if (util_g.size() == 1)
+          utility_group = util_g.front();
         else
-        {
-          std::vector<Processor> util_g(local_utils.begin(), local_utils.end());
           utility_group = ProcessorGroup::create_group(util_g);
-        }
+        // Without a dedicated lane the cleanup work shares the utility
+        // processors and is ordered behind everything else by priority
+        if (!gc_group.exists())
+          gc_group = utility_group;
         std::vector<Processor> all_local(locals.begin(), locals.end());
         all_local.insert(all_local.end(),local_utils.begin(),local_utils.end());
         local_group = ProcessorGroup::create_group(all_local);
       }
 #ifdef DEBUG_LEGION
       assert(utility_group.exists());
+      assert(gc_group.exists());
 #endif
       // For each of the processors in our local set construct a manager
       for (std::set<Processor>::const_iterator it = local_procs.begin();
@@ -20409,6 +21055,8 @@ namespace Legion {
       // Add in reverse order so lower numbers get popped off first
       for (unsigned idx = 0; idx < LEGION_DEFAULT_CONTEXTS; idx++)
         available_contexts[idx] = LEGION_DEFAULT_CONTEXTS-(idx+1);
+      // No variant registration batches are open initially
+      variant_registration_batch_depth = 0;
       // Initialize our random number generator state
       random_state[0] = address_space & 0xFFFF; // low-order bits of node ID 
       random_state[1] = (address_space >> 16) & 0xFFFF; // high-order bits
@@ -20424,6 +21072,16 @@ namespace Legion {
 
       if (config.legion_spy_enabled)
         log_local_machine();
+#ifdef LEGION_SPY
+      // Switch the high-frequency realm event graph logging calls over
+      // to the compact binary format if the user requested it, see
+      // tools/legion_spy_bin2log.py for converting the output back to
+      // the text format that tools/legion_spy.py consumes
+      if (!config.spy_binary_file.empty() &&
+          (LegionSpy::binary_logger == NULL))
+        LegionSpy::binary_logger = new LegionSpy::SpyBinaryLogger(
+                                config.spy_binary_file, address_space);
+#endif
 
 #ifdef LEGION_TRACE_ALLOCATION
       allocation_tracing_count.store(0);
@@ -20470,11 +21128,13 @@ namespace Legion {
         initial_tasks_to_schedule(rhs.initial_tasks_to_schedule),
         initial_meta_task_vector_width(rhs.initial_meta_task_vector_width),
         max_message_size(rhs.max_message_size),
-        gc_epoch_size(rhs.gc_epoch_size), 
+        gc_epoch_size(rhs.gc_epoch_size),
+        gc_utility_procs(rhs.gc_utility_procs),
         max_control_replication_contexts(rhs.max_control_replication_contexts),
         max_local_fields(rhs.max_local_fields),
         max_replay_parallelism(rhs.max_replay_parallelism),
         safe_control_replication(rhs.safe_control_replication),
+        defer_control_replication(rhs.defer_control_replication),
         program_order_execution(rhs.program_order_execution),
         dump_physical_traces(rhs.dump_physical_traces),
         no_tracing(rhs.no_tracing),
@@ -20502,8 +21162,10 @@ namespace Legion {
         legion_spy_enabled(rhs.legion_spy_enabled),
         supply_default_mapper(rhs.supply_default_mapper),
         enable_test_mapper(rhs.enable_test_mapper),
+        mine_layouts(rhs.mine_layouts),
         legion_ldb_enabled(rhs.legion_ldb_enabled),
         replay_file(rhs.replay_file),
+        auto_trace_file(rhs.auto_trace_file),
 #ifdef DEBUG_LEGION
         logging_region_tree_state(rhs.logging_region_tree_state),
         verbose_logging(rhs.verbose_logging),
@@ -20579,7 +21241,34 @@ namespace Legion {
       {
         delete it->second;
       }
-      proc_managers.clear(); 
+      proc_managers.clear();
+      // Reclaim any operations still held in the per-thread caches so
+      // they are freed along with the shared free lists below. Note that
+      // we intentionally do not delete the cache objects themselves since
+      // the owning threads still hold pointers to them; they are tiny and
+      // any thread that later touches a different runtime will see the
+      // runtime mismatch and fall back to the shared free lists.
+      {
+        AutoLock l_lock(local_op_cache_lock);
+        for (std::vector<LocalOperationCache*>::const_iterator it =
+              local_operation_caches.begin(); it !=
+              local_operation_caches.end(); it++)
+        {
+          available_individual_tasks.insert(available_individual_tasks.end(),
+              (*it)->individual_tasks.begin(), (*it)->individual_tasks.end());
+          (*it)->individual_tasks.clear();
+          available_map_ops.insert(available_map_ops.end(),
+              (*it)->map_ops.begin(), (*it)->map_ops.end());
+          (*it)->map_ops.clear();
+          available_copy_ops.insert(available_copy_ops.end(),
+              (*it)->copy_ops.begin(), (*it)->copy_ops.end());
+          (*it)->copy_ops.clear();
+          available_fence_ops.insert(available_fence_ops.end(),
+              (*it)->fence_ops.begin(), (*it)->fence_ops.end());
+          (*it)->fence_ops.clear();
+        }
+        local_operation_caches.clear();
+      }
       free_available(available_individual_tasks);
       free_available(available_point_tasks);
       free_available(available_index_tasks);
@@ -20716,6 +21405,13 @@ namespace Legion {
           if ((*it)->remove_reference())
             delete (*it);
       provenances.clear();
+#ifdef LEGION_SPY
+      if (LegionSpy::binary_logger != NULL)
+      {
+        delete LegionSpy::binary_logger;
+        LegionSpy::binary_logger = NULL;
+      }
+#endif
 #ifdef DEBUG_LEGION
       if (logging_region_tree_state)
 	delete tree_state_logger;
@@ -20902,7 +21598,10 @@ namespace Legion {
                                     config.slow_config_ok,
                                     config.prof_self_profile,
                                     config.prof_no_critical_paths,
-                                    config.prof_all_critical_arrivals);
+                                    config.prof_all_critical_arrivals,
+                                    (config.prof_detail_nodes == 0) ||
+                                    (address_space <
+                                     config.prof_detail_nodes));
       MAPPER_CALL_NAMES(lg_mapper_calls);
       profiler->record_mapper_call_kinds(lg_mapper_calls, LAST_MAPPER_CALL);
       RUNTIME_CALL_DESCRIPTIONS(lg_runtime_calls);
@@ -21505,6 +22204,16 @@ namespace Legion {
         it->second->finalize();
       if (profiler != NULL)
         profiler->finalize();
+      // Report the high-water mark for future instance memory along with
+      // anything that is still live so users can see reclamation working
+      if (future_instance_peak_bytes.load() > 0)
+        log_run.info("future instance memory: peak %zd bytes, "
+                     "live at shutdown %zd bytes",
+                     future_instance_peak_bytes.load(),
+                     future_instance_live_bytes.load());
+#ifdef LEGION_ENABLE_HOT_COUNTERS
+      HotCounters::dump_counters();
+#endif
     }
     
     //--------------------------------------------------------------------------
@@ -24357,6 +25066,43 @@ namespace Legion {
       return finder->second.result;
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::load_layout_overrides(const std::string &filename)
+    //--------------------------------------------------------------------------
+    {
+      FILE *file = fopen(filename.c_str(), "r");
+      if (file == NULL)
+      {
+        log_run.warning("Unable to open layout override file '%s', "
+            "no layout constraints will be relaxed", filename.c_str());
+        return;
+      }
+      char line[256];
+      unsigned loaded = 0;
+      while (fgets(line, sizeof(line), file) != NULL)
+      {
+        // Skip comments and blank lines
+        const char *ptr = line;
+        while ((*ptr == ' ') || (*ptr == '\t'))
+          ptr++;
+        if ((*ptr == '#') || (*ptr == '\n') || (*ptr == '\0'))
+          continue;
+        unsigned task_id, region_index;
+        if (sscanf(ptr, "%u %u", &task_id, &region_index) != 2)
+        {
+          log_run.warning("Ignoring malformed line in layout override "
+              "file '%s': %s", filename.c_str(), line);
+          continue;
+        }
+        relaxed_layout_constraints.insert(
+            std::make_pair(TaskID(task_id), region_index));
+        loaded++;
+      }
+      fclose(file);
+      log_run.info("Loaded %d layout constraint overrides from '%s'",
+                   loaded, filename.c_str());
+    }
+
     //--------------------------------------------------------------------------
     VariantID Runtime::register_variant(const TaskVariantRegistrar &registrar,
                                   const void *user_data, size_t user_data_size,
@@ -24365,7 +25111,9 @@ namespace Legion {
                                   VariantID vid /*= AUTO_GENERATE_ID*/,
                                   bool check_task_id /*= true*/,
                                   bool check_context /*= true*/,
-                                  bool preregistered /*= false*/)
+                                  bool preregistered /*= false*/,
+                                  const void *descriptor_blob /*= NULL*/,
+                                  size_t descriptor_blob_size /*= 0*/)
     //--------------------------------------------------------------------------
     {
       if (check_context && (implicit_context != NULL))
@@ -24383,6 +25131,38 @@ namespace Legion {
                       registrar.task_id, LEGION_MAX_APPLICATION_TASK_ID, 
                       LEGION_MACRO_TO_STRING(LEGION_MAX_APPLICATION_TASK_ID))
 #endif  
+      // Apply any profile-guided layout relaxations before the variant
+      // is recorded: constraints that the mining run showed to be
+      // unnecessary are dropped so the mapper can pick layouts freely
+      if (!relaxed_layout_constraints.empty() &&
+          !registrar.layout_constraints.layouts.empty())
+      {
+        TaskVariantRegistrar relaxed = registrar;
+        std::multimap<unsigned,LayoutConstraintID> &layouts =
+          relaxed.layout_constraints.layouts;
+        bool changed = false;
+        for (std::multimap<unsigned,LayoutConstraintID>::iterator it =
+              layouts.begin(); it != layouts.end(); /*nothing*/)
+        {
+          if (relaxed_layout_constraints.find(std::make_pair(
+                  registrar.task_id, it->first)) !=
+              relaxed_layout_constraints.end())
+          {
+            log_variant.info("Dropping layout constraint %lu for region %d "
+                "of task %d from the layout override file",
+                it->second, it->first, registrar.task_id);
+            it = layouts.erase(it);
+            changed = true;
+          }
+          else
+            it++;
+        }
+        if (changed)
+          return register_variant(relaxed, user_data, user_data_size,
+              realm_code_desc, return_type_size, has_return_size, vid,
+              check_task_id, check_context, preregistered,
+              descriptor_blob, descriptor_blob_size);
+      }
       // First find the task implementation
       TaskImpl *task_impl = find_or_create_task_impl(registrar.task_id);
       // See if we need to make a new variant ID
@@ -24396,28 +25176,72 @@ namespace Legion {
       // Make our variant and add it to the set of variants
       VariantImpl *impl = new VariantImpl(this, vid, task_impl, registrar,
                                           return_type_size, has_return_size,
-                                          realm_code_desc, user_data, 
-                                          user_data_size);
+                                          realm_code_desc, user_data,
+                                          user_data_size, descriptor_blob,
+                                          descriptor_blob_size);
       // Add this variant to the owner
       task_impl->add_variant(impl);
+      bool defer_broadcast = false;
       {
         AutoLock tv_lock(task_variant_lock);
         variant_table.push_back(impl);
+        // If there is an open registration batch then defer the
+        // broadcast until the batch is ended
+        if (registrar.global_registration && (total_address_spaces > 1) &&
+            (variant_registration_batch_depth > 0))
+        {
+          pending_variant_broadcasts.push_back(impl);
+          defer_broadcast = true;
+        }
       }
       // If this is a global registration we need to broadcast the variant
-      if (registrar.global_registration && (total_address_spaces > 1))
+      if (registrar.global_registration && (total_address_spaces > 1) &&
+          !defer_broadcast)
       {
         RtUserEvent done_event = Runtime::create_rt_user_event();
         impl->broadcast_variant(done_event, address_space, 0);
         done_event.wait();
       }
       if (legion_spy_enabled)
-        LegionSpy::log_task_variant(registrar.task_id, vid, 
+        LegionSpy::log_task_variant(registrar.task_id, vid,
                                     impl->is_inner(), impl->is_leaf(),
                                     impl->is_idempotent(), impl->get_name());
       return vid;
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::begin_variant_registration_batch(void)
+    //--------------------------------------------------------------------------
+    {
+      AutoLock tv_lock(task_variant_lock);
+      variant_registration_batch_depth++;
+    }
+
+    //--------------------------------------------------------------------------
+    void Runtime::end_variant_registration_batch(void)
+    //--------------------------------------------------------------------------
+    {
+      std::vector<VariantImpl*> to_broadcast;
+      {
+        AutoLock tv_lock(task_variant_lock);
+#ifdef DEBUG_LEGION
+        assert(variant_registration_batch_depth > 0);
+#endif
+        // Only the outermost batch performs the broadcast
+        if (--variant_registration_batch_depth > 0)
+          return;
+        to_broadcast.swap(pending_variant_broadcasts);
+      }
+      if (to_broadcast.empty())
+        return;
+      // Pack all the deferred variants into a single broadcast tree
+      // exchange and wait for every node to finish registering them
+      RtUserEvent done_event = Runtime::create_rt_user_event();
+      VariantImpl::broadcast_variants(this, to_broadcast, done_event,
+                                      address_space, 0/*local*/);
+      done_event.wait();
+    }
+
     //--------------------------------------------------------------------------
     TaskImpl* Runtime::find_or_create_task_impl(TaskID task_id)
     //--------------------------------------------------------------------------
@@ -25063,6 +25887,141 @@ namespace Legion {
         task->deactivate();
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::send_slices(
+                 std::map<AddressSpaceID,std::vector<SliceTask*> > &slices)
+    //--------------------------------------------------------------------------
+    {
+      // If we're only talking to a small number of nodes then just send
+      // each of the slices to its target directly
+      if (slices.size() <= LEGION_DEFAULT_MAX_SLICE_FANOUT)
+      {
+        for (std::map<AddressSpaceID,std::vector<SliceTask*> >::const_iterator
+              sit = slices.begin(); sit != slices.end(); sit++)
+          for (std::vector<SliceTask*>::const_iterator it =
+                sit->second.begin(); it != sit->second.end(); it++)
+            send_task(*it);
+        return;
+      }
+      // Too many target nodes to send to them all from here without
+      // serializing on our own NIC, so pack each slice for its final
+      // destination and relay the packed messages through intermediate
+      // nodes, each of which handles a contiguous range of the targets
+      const size_t chunk_size =
+        (slices.size() + LEGION_DEFAULT_MAX_SLICE_FANOUT - 1) /
+          LEGION_DEFAULT_MAX_SLICE_FANOUT;
+      std::map<AddressSpaceID,std::vector<SliceTask*> >::const_iterator
+        sit = slices.begin();
+      while (sit != slices.end())
+      {
+        size_t num_spaces = 0;
+        size_t num_entries = 0;
+        std::map<AddressSpaceID,std::vector<SliceTask*> >::const_iterator
+          stop = sit;
+        while ((num_spaces < chunk_size) && (stop != slices.end()))
+        {
+          num_entries += stop->second.size();
+          num_spaces++;
+          stop++;
+        }
+        // The first node of the range serves as the relay
+        const AddressSpaceID relay_space = sit->first;
+        Serializer rez;
+        {
+          RezCheck z(rez);
+          rez.serialize(num_entries);
+          for (/*nothing*/; sit != stop; sit++)
+          {
+            for (std::vector<SliceTask*>::const_iterator it =
+                  sit->second.begin(); it != sit->second.end(); it++)
+            {
+              rez.serialize(sit->first);
+              // Pack the same payload a TASK_MESSAGE would carry so the
+              // relay nodes can forward it without unpacking it
+              Serializer inner;
+              bool deactivate_task;
+              {
+                RezCheck z2(inner);
+                inner.serialize((*it)->target_proc);
+                inner.serialize((*it)->get_task_kind());
+                deactivate_task = (*it)->pack_task(inner, sit->first);
+              }
+              rez.serialize(inner.get_used_bytes());
+              rez.serialize(inner.get_buffer(), inner.get_used_bytes());
+              if (deactivate_task)
+                (*it)->deactivate();
+            }
+          }
+        }
+        find_messenger(relay_space)->send_message(SLICE_RELAY_MESSAGE,
+                                                  rez, true/*flush*/);
+      }
+    }
+
+    //--------------------------------------------------------------------------
+    void Runtime::relay_packed_slices(const std::map<AddressSpaceID,
+                     std::vector<std::pair<const void*,size_t> > > &groups)
+    //--------------------------------------------------------------------------
+    {
+      if (groups.size() <= LEGION_DEFAULT_MAX_SLICE_FANOUT)
+      {
+        // Few enough targets that we can send to each of them directly
+        for (std::map<AddressSpaceID,
+              std::vector<std::pair<const void*,size_t> > >::const_iterator
+              git = groups.begin(); git != groups.end(); git++)
+        {
+          MessageManager *manager = find_messenger(git->first);
+          for (std::vector<std::pair<const void*,size_t> >::const_iterator
+                it = git->second.begin(); it != git->second.end(); it++)
+          {
+            Serializer rez;
+            rez.serialize(it->first, it->second);
+            manager->send_message(TASK_MESSAGE, rez, true/*flush*/);
+          }
+        }
+        return;
+      }
+      // Still too many targets so keep the relay tree going
+      const size_t chunk_size =
+        (groups.size() + LEGION_DEFAULT_MAX_SLICE_FANOUT - 1) /
+          LEGION_DEFAULT_MAX_SLICE_FANOUT;
+      std::map<AddressSpaceID,
+        std::vector<std::pair<const void*,size_t> > >::const_iterator
+          git = groups.begin();
+      while (git != groups.end())
+      {
+        size_t num_spaces = 0;
+        size_t num_entries = 0;
+        std::map<AddressSpaceID,
+          std::vector<std::pair<const void*,size_t> > >::const_iterator
+            stop = git;
+        while ((num_spaces < chunk_size) && (stop != groups.end()))
+        {
+          num_entries += stop->second.size();
+          num_spaces++;
+          stop++;
+        }
+        const AddressSpaceID relay_space = git->first;
+        Serializer rez;
+        {
+          RezCheck z(rez);
+          rez.serialize(num_entries);
+          for (/*nothing*/; git != stop; git++)
+          {
+            for (std::vector<std::pair<const void*,size_t> >::const_iterator
+                  it = git->second.begin(); it != git->second.end(); it++)
+            {
+              rez.serialize(git->first);
+              rez.serialize(it->second);
+              rez.serialize(it->first, it->second);
+            }
+          }
+        }
+        find_messenger(relay_space)->send_message(SLICE_RELAY_MESSAGE,
+                                                  rez, true/*flush*/);
+      }
+    }
+
     //--------------------------------------------------------------------------
     void Runtime::send_tasks(Processor target, std::vector<SingleTask*> &tasks)
     //--------------------------------------------------------------------------
@@ -26431,6 +27390,15 @@ namespace Legion {
                                                           true/*flush*/);
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::send_view_invalidate_read_caches(AddressSpaceID target,
+                                                   Serializer &rez)
+    //--------------------------------------------------------------------------
+    {
+      find_messenger(target)->send_message(SEND_VIEW_INVALIDATE_READ_CACHES,
+                                                          rez, true/*flush*/);
+    }
+
     //--------------------------------------------------------------------------
     void Runtime::send_view_find_last_users_request(AddressSpaceID target,
                                                     Serializer &rez)
@@ -27755,6 +28723,38 @@ namespace Legion {
       TaskOp::process_unpack_task(this, derez);
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::handle_slice_relay(Deserializer &derez)
+    //--------------------------------------------------------------------------
+    {
+      DerezCheck z(derez);
+      size_t num_entries;
+      derez.deserialize(num_entries);
+      // Unpack any slices that were destined for us and group the rest
+      // by their final target so we can forward them along, continuing
+      // the relay tree if there are still too many targets
+      std::map<AddressSpaceID,
+        std::vector<std::pair<const void*,size_t> > > forward;
+      for (unsigned idx = 0; idx < num_entries; idx++)
+      {
+        AddressSpaceID space;
+        derez.deserialize(space);
+        size_t size;
+        derez.deserialize(size);
+        const void *buffer = derez.get_current_pointer();
+        derez.advance_pointer(size);
+        if (space == address_space)
+        {
+          Deserializer inner(buffer, size);
+          handle_task(inner);
+        }
+        else
+          forward[space].push_back(std::make_pair(buffer, size));
+      }
+      if (!forward.empty())
+        relay_packed_slices(forward);
+    }
+
     //--------------------------------------------------------------------------
     void Runtime::handle_steal(Deserializer &derez)
     //--------------------------------------------------------------------------
@@ -29178,6 +30178,13 @@ namespace Legion {
       IndividualView::handle_view_add_copy_user(derez, this, source);
     }
 
+    //--------------------------------------------------------------------------
+    void Runtime::handle_view_invalidate_read_caches(Deserializer &derez)
+    //--------------------------------------------------------------------------
+    {
+      IndividualView::handle_view_invalidate_read_caches(derez, this);
+    }
+
     //--------------------------------------------------------------------------
     void Runtime::handle_view_find_last_users_request(Deserializer &derez,
                                                       AddressSpaceID source)
@@ -31709,12 +32716,41 @@ namespace Legion {
     }
 #endif
 
+    //--------------------------------------------------------------------------
+    Runtime::LocalOperationCache* Runtime::find_local_operation_cache(void)
+    //--------------------------------------------------------------------------
+    {
+      if (implicit_op_cache == NULL)
+      {
+        LocalOperationCache *cache = new LocalOperationCache(this);
+        {
+          AutoLock l_lock(local_op_cache_lock);
+          local_operation_caches.push_back(cache);
+        }
+        implicit_op_cache = cache;
+      }
+      // With separate runtime instances a thread can touch more than one
+      // runtime object, fall back to the shared free lists in that case
+      if (implicit_op_cache->runtime != this)
+        return NULL;
+      return implicit_op_cache;
+    }
+
     //--------------------------------------------------------------------------
     IndividualTask* Runtime::get_available_individual_task(void)
     //--------------------------------------------------------------------------
     {
+#ifndef DEBUG_LEGION
+      // Don't use the per-thread caches in debug mode so that the
+      // out_individual_tasks tracking sees every allocation
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+        return get_available_cached<IndividualTask,
+          Predicated<IndividualTask> >(cache->individual_tasks,
+              individual_task_lock, available_individual_tasks);
+#endif
       IndividualTask *result = get_available<IndividualTask,
-                     Predicated<IndividualTask> >(individual_task_lock, 
+                     Predicated<IndividualTask> >(individual_task_lock,
                                          available_individual_tasks);
 #ifdef DEBUG_LEGION
       AutoLock i_lock(individual_task_lock);
@@ -31766,6 +32802,10 @@ namespace Legion {
     MapOp* Runtime::get_available_map_op(void)
     //--------------------------------------------------------------------------
     {
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+        return get_available_cached<MapOp,MapOp>(cache->map_ops,
+                                        map_op_lock, available_map_ops);
       return get_available(map_op_lock, available_map_ops);
     }
 
@@ -31773,6 +32813,10 @@ namespace Legion {
     CopyOp* Runtime::get_available_copy_op(void)
     //--------------------------------------------------------------------------
     {
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+        return get_available_cached<CopyOp,Predicated<CopyOp> >(
+                  cache->copy_ops, copy_op_lock, available_copy_ops);
       return get_available<CopyOp,Predicated<CopyOp> >(
                         copy_op_lock, available_copy_ops);
     }
@@ -31806,6 +32850,10 @@ namespace Legion {
     FenceOp* Runtime::get_available_fence_op(void)
     //--------------------------------------------------------------------------
     {
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+        return get_available_cached<FenceOp,Memoizable<FenceOp> >(
+                  cache->fence_ops, fence_op_lock, available_fence_ops);
       return get_available<FenceOp,Memoizable<FenceOp> >(
                       fence_op_lock, available_fence_ops);
     }
@@ -32314,6 +33362,15 @@ namespace Legion {
     void Runtime::free_individual_task(IndividualTask *task)
     //--------------------------------------------------------------------------
     {
+#ifndef DEBUG_LEGION
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+      {
+        release_operation_cached(cache->individual_tasks,
+            individual_task_lock, available_individual_tasks, task);
+        return;
+      }
+#endif
       AutoLock i_lock(individual_task_lock);
       release_operation<false>(available_individual_tasks, task);
 #ifdef DEBUG_LEGION
@@ -32366,6 +33423,13 @@ namespace Legion {
     void Runtime::free_map_op(MapOp *op)
     //--------------------------------------------------------------------------
     {
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+      {
+        release_operation_cached(cache->map_ops, map_op_lock,
+                                 available_map_ops, op);
+        return;
+      }
       AutoLock m_lock(map_op_lock);
       release_operation<false>(available_map_ops, op);
     }
@@ -32374,6 +33438,13 @@ namespace Legion {
     void Runtime::free_copy_op(CopyOp *op)
     //--------------------------------------------------------------------------
     {
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+      {
+        release_operation_cached(cache->copy_ops, copy_op_lock,
+                                 available_copy_ops, op);
+        return;
+      }
       AutoLock c_lock(copy_op_lock);
       release_operation<false>(available_copy_ops, op);
     }
@@ -32398,6 +33469,13 @@ namespace Legion {
     void Runtime::free_fence_op(FenceOp *op)
     //--------------------------------------------------------------------------
     {
+      LocalOperationCache *cache = find_local_operation_cache();
+      if (cache != NULL)
+      {
+        release_operation_cached(cache->fence_ops, fence_op_lock,
+                                 available_fence_ops, op);
+        return;
+      }
       AutoLock f_lock(fence_op_lock);
       release_operation<false>(available_fence_ops, op);
     }
@@ -34195,7 +35273,17 @@ namespace Legion {
         perform_slow_config_checks(config);
       // Configure legion spy if necessary
       if (config.legion_spy_enabled)
+      {
         LegionSpy::log_legion_spy_config();
+        // Turn on stratified sampling of index launch points if it was
+        // requested, recording the rate so tools/legion_spy.py knows
+        // that missing points are expected rather than lost records
+        if (config.spy_sampling_rate > 1)
+        {
+          LegionSpy::sampling_rate = config.spy_sampling_rate;
+          LegionSpy::log_sampling_rate(config.spy_sampling_rate);
+        }
+      }
       // Construct our runtime objects 
       std::set<Processor> local_procs;
       std::map<Processor,Runtime*> processor_mapping;
@@ -34403,6 +35491,8 @@ namespace Legion {
         .add_option_bool("-lg:safe_tracing", config.safe_tracing, !filter)
         .add_option_int("-lg:safe_ctrlrepl",
                          config.safe_control_replication, !filter)
+        .add_option_bool("-lg:defer_ctrlrepl",
+                         config.defer_control_replication, !filter)
         .add_option_bool("-lg:inorder",config.program_order_execution,!filter)
         .add_option_bool("-lg:dump_physical_traces",
                          config.dump_physical_traces, !filter)
@@ -34436,6 +35526,7 @@ namespace Legion {
                          config.dump_free_ranges, !filter)
         .add_option_int("-lg:message",config.max_message_size, !filter)
         .add_option_int("-lg:epoch", config.gc_epoch_size, !filter)
+        .add_option_int("-lg:gc_procs", config.gc_utility_procs, !filter)
         .add_option_int("-lg:local", config.max_local_fields, !filter)
         .add_option_int("-lg:parallel_replay", 
                         config.max_replay_parallelism, !filter)
@@ -34447,6 +35538,13 @@ namespace Legion {
         .add_option_int("-lg:delay", config.delay_start, !filter)
         .add_option_string("-lg:replay", config.replay_file, !filter)
         .add_option_string("-lg:ldb", config.ldb_file, !filter)
+        .add_option_string("-lg:spy_binary", config.spy_binary_file, !filter)
+        .add_option_int("-lg:spy_sample", config.spy_sampling_rate, !filter)
+        .add_option_string("-lg:auto_trace_file",
+                           config.auto_trace_file, !filter)
+        .add_option_bool("-lg:mine_layouts", config.mine_layouts, !filter)
+        .add_option_string("-lg:layout_overrides",
+                           config.layout_override_file, !filter)
 #ifdef DEBUG_LEGION
         .add_option_bool("-lg:tree",config.logging_region_tree_state, !filter)
         .add_option_bool("-lg:verbose",config.verbose_logging, !filter)
@@ -34455,6 +35553,8 @@ namespace Legion {
                          config.physical_logging_only,!filter)
 #endif
         .add_option_int("-lg:prof", config.num_profiling_nodes, !filter)
+        .add_option_int("-lg:prof_detail_nodes",
+                        config.prof_detail_nodes, !filter)
         .add_option_string("-lg:serializer", config.serializer_type, !filter)
         .add_option_string("-lg:prof_logfile", config.prof_logfile, !filter)
         .add_option_int("-lg:prof_footprint", 
@@ -36325,6 +37425,21 @@ namespace Legion {
             TimingOp::handle_deferred_measurement(args);
             break;
           }
+        case LG_DEFER_PROFILING_FLUSH_TASK_ID:
+          {
+            LegionProfiler::handle_deferred_flush(args);
+            break;
+          }
+        case LG_PREFETCH_EQ_SET_TREE_TASK_ID:
+          {
+            InnerContext::handle_prefetch_equivalence_set_tree(args);
+            break;
+          }
+        case LG_DEFER_REGION_TREE_FREE_TASK_ID:
+          {
+            RegionTreeForest::handle_defer_region_tree_free(args);
+            break;
+          }
         case LG_TASK_IMPL_SEMANTIC_INFO_REQ_TASK_ID:
           {
             TaskImpl::SemanticRequestArgs *req_args = 
@@ -373,6 +373,10 @@ namespace Legion {
       ApEvent find_application_instance_ready(Memory target, SingleTask *task);
       void request_runtime_instance(Operation *op);
       RtEvent find_runtime_instance_ready(void);
+      // Record a bound on the size of this future known from how it is
+      // being consumed (e.g. predicates are always a single boolean) so
+      // instances can be allocated before the producer reports its size
+      void record_upper_bound_size(size_t bound);
       const void *find_runtime_buffer(TaskContext *ctx, size_t &expected_size);
       ApEvent copy_to(FutureInstance *target, Operation *op,
                       ApEvent precondition);
@@ -578,6 +582,10 @@ namespace Legion {
                      RtEvent use_event = RtEvent::NO_RT_EVENT);
       FutureInstance(const FutureInstance &rhs) = delete;
       ~FutureInstance(void);
+    private:
+      // Constructor for small values that are inlined directly into
+      // the future instance metadata, see create_local
+      FutureInstance(const void *data, size_t size);
     public:
       FutureInstance& operator=(const FutureInstance &rhs) = delete;
     public:
@@ -606,8 +614,12 @@ namespace Legion {
 #endif
       bool defer_deletion(ApEvent precondition);
     public:
-      bool is_immediate(void) const; 
+      bool is_immediate(void) const;
       bool can_pack_by_value(void) const;
+      // Whether the data for this future instance lives in the small
+      // buffer inlined in the metadata rather than its own allocation
+      inline bool is_inline(void) const
+        { return (data.load() == inline_buffer); }
       // You only need to check the return value if you set pack_ownership=false
       // as that is when the you need to make sure the instance isn't deleted
       // remotely, whereas in all other cases it is safe to delete locally
@@ -623,10 +635,18 @@ namespace Legion {
       static void handle_free_external(const void *args);
       static void free_host_memory(const Realm::ExternalInstanceResource &mem);
       static void handle_defer_deletion(const void *args);
+    private:
+      // Move an inline value out to its own allocation because it is
+      // about to escape the lifetime of this object
+      void promote_inline_buffer(void);
+    public:
+      // Values no larger than this are stored directly in the future
+      // instance metadata instead of their own heap allocation
+      static const size_t MAX_INLINE_SIZE = 64;
     public:
       const size_t size;
       const Memory memory;
-      const Realm::ExternalInstanceResource *const resource;
+      const Realm::ExternalInstanceResource *resource;
       void (*const freefunc)(const Realm::ExternalInstanceResource&);
       const Processor freeproc;
       const bool external_allocation;
@@ -646,6 +666,8 @@ namespace Legion {
       // We can own the instance without owning the allocation in the case
       // of external allocations that we don't own but make an instance later
       bool own_instance;
+      // Small values live here instead of in their own allocation
+      uint8_t inline_buffer[MAX_INLINE_SIZE];
     };
 
     /**
@@ -868,6 +890,7 @@ namespace Legion {
       bool is_mapped(void) const;
       LogicalRegion get_logical_region(void) const;
       PrivilegeMode get_privilege(void) const;
+      CoherenceProperty get_coherence(void) const;
     public:
       void unmap_region(void);
       ApEvent remap_region(ApEvent new_ready_event, uint64_t blocking);
@@ -900,6 +923,8 @@ namespace Legion {
                                         bool check_field_size);
       void report_incompatible_accessor(const char *accessor_kind,
                              PhysicalInstance instance, FieldID fid);
+      void log_accessor_usage(FieldID fid, size_t field_size,
+                             PrivilegeMode mode, PhysicalManager *manager);
       void report_incompatible_multi_accessor(unsigned index, FieldID fid,
                            PhysicalInstance inst1, PhysicalInstance inst2);
       void report_colocation_violation(const char *accessor_kind,
@@ -1053,6 +1078,13 @@ namespace Legion {
       const bool grouped_fields;
     private:
       // Output data batched during task execution
+      // Note that all returned data stays buffered here until the task
+      // completes: downstream consumers only learn the final extents (and
+      // hence the index space of the output region) at finalize time, so
+      // there is no way to map a prefix of the output while the producer
+      // is still appending. Streaming consumption of partially produced
+      // outputs would need the region tree to version partially-bound
+      // index spaces, which nothing in the dependence analysis supports.
       std::map<FieldID,PhysicalInstance> returned_instances;
       std::vector<PhysicalManager*> managers;
       DomainPoint extents;
@@ -1753,6 +1785,9 @@ namespace Legion {
         }
       inline void update_remaining_capacity(size_t size)
         { remaining_capacity.fetch_add(size); }
+      // Count the allocation requests queued waiting for collections,
+      // used by mappers querying for memory pressure
+      size_t count_pending_allocations(void) const;
     public:
       void find_shutdown_preconditions(std::set<ApEvent> &preconditions);
       void prepare_for_shutdown(void);
@@ -1879,8 +1914,9 @@ namespace Legion {
     protected:
       bool find_satisfying_instance(const LayoutConstraintSet &constraints,
                                     const std::vector<LogicalRegion> &regions,
-                                    MappingInstance &result, bool acquire, 
-                                    bool tight_region_bounds, bool remote);
+                                    MappingInstance &result, bool acquire,
+                                    bool tight_region_bounds, bool remote,
+                                    bool *any_entailed = NULL);
       void find_satisfying_instances(const LayoutConstraintSet &constraints,
                                     const std::vector<LogicalRegion> &regions,
                                     std::vector<MappingInstance> &results, 
@@ -1892,6 +1928,8 @@ namespace Legion {
                                     bool tight_region_bounds, bool remote);
       void release_candidate_references(const std::deque<PhysicalManager*>
                                                         &candidates) const;
+      // Must be called while holding the manager lock
+      void invalidate_failed_queries(RegionTreeID tree_id);
     public:
       PhysicalManager* create_unbound_instance(LogicalRegion region,
                                                LayoutConstraintSet &constraints,
@@ -1911,6 +1949,10 @@ namespace Legion {
                                           size_t *footprint,
                                           LayoutConstraintKind *unsat_kind,
                                           unsigned *unsat_index);
+      // Try to collect a dead reduction instance with a matching reduction
+      // op and footprint so its memory can be recycled with a redistrict
+      RtEvent find_reduction_hole(size_t needed_size, ReductionOpID redop,
+                                  PhysicalInstance &hole, LgEvent &hole_unique);
     public:
       void remove_collectable(GCPriority priority, PhysicalManager *manager);
     public:
@@ -1964,6 +2006,34 @@ namespace Legion {
       typedef LegionMap<PhysicalManager*,GCPriority,
                         MEMORY_INSTANCES_ALLOC> TreeInstances;
       std::map<RegionTreeID,TreeInstances> current_instances;
+      // Directory of failed find_physical_instance queries, keyed by the
+      // layout constraint ID, so the common caching-mapper pattern of
+      // repeating the same unsatisfiable query gets a constant-time
+      // negative answer instead of a full constraint-matching search
+      // Entries are pruned whenever a new instance is recorded for their
+      // region tree since that is the only way that a previously failed
+      // query can begin succeeding
+      // This data structure is protected by the manager_lock
+      struct FailedQueryKey {
+      public:
+        inline bool operator<(const FailedQueryKey &rhs) const
+        {
+          if (layout_id < rhs.layout_id) return true;
+          if (layout_id > rhs.layout_id) return false;
+          if (tight_bounds < rhs.tight_bounds) return true;
+          if (tight_bounds > rhs.tight_bounds) return false;
+          return (regions < rhs.regions);
+        }
+      public:
+        LayoutConstraintID layout_id;
+        std::vector<LogicalRegion> regions;
+        bool tight_bounds;
+      };
+      static const size_t MAX_FAILED_QUERIES_PER_TREE = 1024;
+      std::map<RegionTreeID,std::set<FailedQueryKey> > failed_queries;
+      // Bumped on every instance registration so that a search that raced
+      // with a registration does not record a stale negative result
+      unsigned long long failed_query_epoch;
       // Keep track of all groupings of instances based on their 
       // garbage collection priorities and placement in memory
       std::map<GCPriority,std::set<PhysicalManager*>,
@@ -2363,11 +2433,13 @@ namespace Legion {
     public:
       static const AllocationType alloc_type = VARIANT_IMPL_ALLOC;
     public:
-      VariantImpl(Runtime *runtime, VariantID vid, TaskImpl *owner, 
-                  const TaskVariantRegistrar &registrar, 
+      VariantImpl(Runtime *runtime, VariantID vid, TaskImpl *owner,
+                  const TaskVariantRegistrar &registrar,
                   size_t return_type_size, bool has_return_type_size,
                   const CodeDescriptor &realm_desc,
-                  const void *user_data = NULL, size_t user_data_size = 0);
+                  const void *user_data = NULL, size_t user_data_size = 0,
+                  const void *descriptor_blob = NULL,
+                  size_t descriptor_blob_size = 0);
       VariantImpl(const VariantImpl &rhs) = delete;
       ~VariantImpl(void);
     public:
@@ -2395,16 +2467,27 @@ namespace Legion {
     public:
       void broadcast_variant(RtUserEvent done, AddressSpaceID origin,
                              AddressSpaceID local);
-      void find_padded_locks(SingleTask *task, 
+      static void broadcast_variants(Runtime *runtime,
+                             const std::vector<VariantImpl*> &variants,
+                             RtUserEvent done, AddressSpaceID origin,
+                             AddressSpaceID local);
+      void pack_variant(Serializer &rez);
+      // Deserialize a deferred portable code descriptor and register it
+      // with the local realm processors, called before the first dispatch
+      // of a variant that arrived with a lazy descriptor blob
+      void materialize_descriptor(void);
+      void find_padded_locks(SingleTask *task,
                     const std::vector<RegionRequirement> &regions,
                     const std::deque<InstanceSet> &physical_instances) const;
       void record_padded_fields(const std::vector<RegionRequirement> &regions,
                     const std::vector<PhysicalRegion> &physical_regions) const;
     public:
-      static void handle_variant_broadcast(Runtime *runtime, 
+      static void handle_variant_broadcast(Runtime *runtime,
                                            Deserializer &derez);
       static bool check_padding(Runtime *runtime,
                                 const TaskLayoutConstraintSet &constraints);
+    protected:
+      ApEvent perform_realm_registration(void);
     public:
       const VariantID vid;
       TaskImpl *const owner;
@@ -2424,6 +2507,18 @@ namespace Legion {
       void *user_data;
       size_t user_data_size;
       ApEvent ready_event;
+    private:
+      // For variants registered remotely with a lazy descriptor blob,
+      // the realm code descriptor is only deserialized and registered
+      // with the local processors the first time the variant is
+      // dispatched so that nodes which never run the variant do not
+      // pay for materializing it. The blob is immutable once set so it
+      // can also be forwarded to other nodes without deserializing it.
+      void *descriptor_blob;
+      size_t descriptor_blob_size;
+      std::atomic<bool> descriptor_materialized;
+      std::atomic<bool> descriptor_materializing;
+      RtUserEvent descriptor_ready_event;
     private: // properties
       const bool leaf_variant;
       const bool inner_variant;
@@ -2598,6 +2693,19 @@ namespace Legion {
           unsigned region_index, const RegionRequirement &req,
           IndexSpaceNode *domain, const std::vector<LogicalRegion> &regions,
           std::map<LogicalRegion,std::vector<DomainPoint> > &dependences);
+    public:
+      // Memoization of results for functional projection functors: these
+      // are pure functions of the upper bound, point, launch domain, and
+      // args, so repeated index launches of the same shape can replay the
+      // results of an earlier launch and skip both the functor invocation
+      // and the result validation
+      bool replay_memoized_results(const RegionRequirement &req,
+                                   unsigned index, const Domain &launch_domain,
+                                   const std::vector<PointTask*> &point_tasks);
+      void memoize_results(const RegionRequirement &req,
+                           const Domain &launch_domain,
+                           const std::vector<PointTask*> &point_tasks,
+                           const std::vector<LogicalRegion> &results);
     protected:
       // Old checking code explicitly for tasks
       void check_projection_region_result(LogicalRegion upper_bound,
@@ -2649,8 +2757,18 @@ namespace Legion {
       const ProjectionID projection_id;
       ProjectionFunctor *const functor;
     protected:
-      mutable LocalLock projection_reservation;  
-    }; 
+      mutable LocalLock projection_reservation;
+    protected:
+      // Memoized projection results, guarded by projection_reservation
+      // Note that no invalidation is needed when the region tree changes:
+      // region tree IDs are never reused, so a deleted upper bound just
+      // leaves behind a dead entry until the next epoch clear
+      static const size_t MAX_MEMOIZED_LAUNCHES = 64;
+      std::map<std::pair<LogicalRegion,Domain>,
+               std::map<DomainPoint,LogicalRegion> > region_memos;
+      std::map<std::pair<LogicalPartition,Domain>,
+               std::map<DomainPoint,LogicalRegion> > partition_memos;
+    };
 
     /**
      * \class CyclicShardingFunctor
@@ -2726,6 +2844,13 @@ namespace Legion {
     public:
       ShardID find_owner(const DomainPoint &point,
                          const Domain &sharding_space);
+      // Compute (or find the memoized copy of) the shard assignment for
+      // every point of 'domain' in domain-iteration order. Since the
+      // shard manager shares this function object across launches,
+      // repeated launches over the same domain skip the per-point
+      // sharding computation entirely.
+      const std::vector<ShardID>& find_shard_assignments(
+                         const Domain &domain, const Domain &sharding_space);
       IndexSpace find_shard_space(ShardID shard, IndexSpaceNode *full_space,
           IndexSpace sharding_space, Provenance *provenance);
       bool find_shard_participants(IndexSpaceNode *full_space,
@@ -2745,6 +2870,8 @@ namespace Legion {
       std::map<ShardKey,IndexSpace/*result*/> shard_index_spaces;
       std::map<std::pair<IndexSpace,IndexSpace>,
                std::vector<ShardID> > shard_participants;
+      std::map<std::pair<Domain,Domain>,
+               std::vector<ShardID> > shard_assignments;
     };
 
     /**
@@ -2787,11 +2914,13 @@ namespace Legion {
                 LEGION_DEFAULT_META_TASK_VECTOR_WIDTH),
             max_message_size(LEGION_DEFAULT_MAX_MESSAGE_SIZE),
             gc_epoch_size(LEGION_DEFAULT_GC_EPOCH_SIZE),
+            gc_utility_procs(0),
             max_control_replication_contexts(
                         LEGION_DEFAULT_MAX_CONTROL_REPLICATION_CONTEXTS),
             max_local_fields(LEGION_DEFAULT_LOCAL_FIELDS),
             max_replay_parallelism(LEGION_DEFAULT_MAX_REPLAY_PARALLELISM),
             safe_control_replication(0),
+            defer_control_replication(false),
             program_order_execution(false),
             dump_physical_traces(false),
             enable_automatic_tracing(false),
@@ -2823,7 +2952,9 @@ namespace Legion {
 #else
             legion_spy_enabled(false),
 #endif
+            spy_sampling_rate(0),
             enable_test_mapper(false),
+            mine_layouts(false),
             slow_config_ok(false),
 #ifdef DEBUG_LEGION
             logging_region_tree_state(false),
@@ -2836,6 +2967,7 @@ namespace Legion {
 #endif
             dump_free_ranges(false),
             num_profiling_nodes(0),
+            prof_detail_nodes(0),
             serializer_type("binary"),
             prof_footprint_threshold(128 << 20),
             prof_target_latency(100),
@@ -2852,11 +2984,17 @@ namespace Legion {
         unsigned initial_meta_task_vector_width;
         unsigned max_message_size;
         unsigned gc_epoch_size;
+        // number of utility processors to dedicate to the cleanup lane
+        unsigned gc_utility_procs;
         unsigned max_control_replication_contexts;
         unsigned max_local_fields;
         unsigned max_replay_parallelism;
         unsigned safe_control_replication;
       public:
+        // Accumulate control replication hashes locally and only compare
+        // them collectively at trace/fence/end-task boundaries so the
+        // checks are cheap enough to leave on outside of debugging runs
+        bool defer_control_replication;
         bool program_order_execution;
         bool dump_physical_traces;
         bool enable_automatic_tracing;
@@ -2884,9 +3022,22 @@ namespace Legion {
         bool disable_independence_tests;
         bool enable_pointwise_analysis;
         bool legion_spy_enabled;
+        // When larger than one, sample only one in this many points of
+        // each index space launch in the spy logs, see the comment on
+        // LegionSpy::sampling_rate in legion_spy.h
+        unsigned spy_sampling_rate;
         bool enable_test_mapper;
+        // Log every accessor construction so the offline miner can see
+        // which fields tasks actually touch together
+        bool mine_layouts;
         std::string replay_file;
         std::string ldb_file;
+        std::string spy_binary_file;
+        std::string auto_trace_file;
+        // File of (task_id, region index) pairs whose registration-time
+        // layout constraints should be dropped, typically produced by
+        // tools/mine_layout_constraints.py from a mining run
+        std::string layout_override_file;
         bool slow_config_ok;
 #ifdef DEBUG_LEGION
         bool logging_region_tree_state;
@@ -2898,6 +3049,10 @@ namespace Legion {
         bool dump_free_ranges;
       public:
         unsigned num_profiling_nodes;
+        // If non-zero, only the first this-many nodes record per-operation
+        // detail (tasks, metas, copies, fills, instances, partitions);
+        // the rest still log descriptors and handle remote responses
+        unsigned prof_detail_nodes;
         std::string serializer_type;
         std::string prof_logfile;
         size_t prof_footprint_threshold;
@@ -2973,6 +3128,7 @@ namespace Legion {
       VirtualManager *virtual_manager;
       Processor local_group; // all local processors
       Processor utility_group; // all utility processors
+      Processor gc_group; // lane for background cleanup meta-tasks
       const size_t num_utility_procs;
     public:
       const InputArgs input_args;
@@ -2982,11 +3138,13 @@ namespace Legion {
       const unsigned initial_meta_task_vector_width;
       const unsigned max_message_size;
       const unsigned gc_epoch_size;
+      const unsigned gc_utility_procs;
       const unsigned max_control_replication_contexts;
       const unsigned max_local_fields;
       const unsigned max_replay_parallelism;
       const unsigned safe_control_replication;
     public:
+      const bool defer_control_replication;
       const bool program_order_execution;
       const bool dump_physical_traces;
       const bool no_tracing;
@@ -3005,6 +3163,14 @@ namespace Legion {
       const bool separate_runtime_instances;
       const bool record_registration;
       const bool stealing_disabled;
+      // Resilient mode keeps extra operation state around (see the
+      // hardened-operation tracking in legion_ops.h) so that region
+      // exceptions can roll operations back; it does not replicate the
+      // owner state of distributed collectables or shard managers, so
+      // the loss of a node is still fatal to the run. Surviving node
+      // failure would require every owner-homed structure to maintain a
+      // writable replica and a takeover protocol layered on a network
+      // module that can report peer death, neither of which exists today.
       const bool resilient_mode;
       const bool unsafe_launch;
       const bool unsafe_mapper;
@@ -3014,8 +3180,13 @@ namespace Legion {
       const bool legion_spy_enabled;
       const bool supply_default_mapper;
       const bool enable_test_mapper;
+      // Log accessor constructions for offline layout constraint mining
+      const bool mine_layouts;
       const bool legion_ldb_enabled;
       const std::string replay_file;
+      // File in which the automatic tracing infrastructure persists the
+      // traces it learned so later runs can start replaying immediately
+      const std::string auto_trace_file;
 #ifdef DEBUG_LEGION
       const bool logging_region_tree_state;
       const bool verbose_logging;
@@ -3373,7 +3544,12 @@ namespace Legion {
                                  VariantID vid = LEGION_AUTO_GENERATE_ID,
                                  bool check_task_id = true,
                                  bool check_context = true,
-                                 bool preregistered = false);
+                                 bool preregistered = false,
+                                 const void *descriptor_blob = NULL,
+                                 size_t descriptor_blob_size = 0);
+      void load_layout_overrides(const std::string &filename);
+      void begin_variant_registration_batch(void);
+      void end_variant_registration_batch(void);
       TaskImpl* find_or_create_task_impl(TaskID task_id);
       TaskImpl* find_task_impl(TaskID task_id);
       VariantImpl* find_variant_impl(TaskID task_id, VariantID variant_id,
@@ -3408,6 +3584,10 @@ namespace Legion {
       void send_startup_barrier(AddressSpaceID target, Serializer &rez);
       void send_task(IndividualTask *task);
       void send_task(SliceTask *task);
+      void send_slices(std::map<AddressSpaceID,
+                                std::vector<SliceTask*> > &slices);
+      void relay_packed_slices(const std::map<AddressSpaceID,
+                std::vector<std::pair<const void*,size_t> > > &groups);
       void send_tasks(Processor target, std::vector<SingleTask*> &tasks);
       void send_steal_request(const std::multimap<Processor,MapperID> &targets,
                               Processor thief);
@@ -3625,6 +3805,8 @@ namespace Legion {
       void send_view_find_copy_preconditions_request(AddressSpaceID target,
                                                      Serializer &rez);
       void send_view_add_copy_user(AddressSpaceID target, Serializer &rez);
+      void send_view_invalidate_read_caches(AddressSpaceID target,
+                                            Serializer &rez);
       void send_view_find_last_users_request(AddressSpaceID target,
                                              Serializer &rez);
       void send_view_find_last_users_response(AddressSpaceID target,
@@ -3869,6 +4051,7 @@ namespace Legion {
       // Complementary tasks for handling messages
       void handle_startup_barrier(Deserializer &derez);
       void handle_task(Deserializer &derez);
+      void handle_slice_relay(Deserializer &derez);
       void handle_steal(Deserializer &derez);
       void handle_advertisement(Deserializer &derez);
 #ifdef LEGION_USE_LIBDL
@@ -4047,6 +4230,7 @@ namespace Legion {
       void handle_view_copy_pre_request(Deserializer &derez,
                                         AddressSpaceID source);
       void handle_view_add_copy_user(Deserializer &derez,AddressSpaceID source);
+      void handle_view_invalidate_read_caches(Deserializer &derez);
       void handle_view_find_last_users_request(Deserializer &derez,
                                                AddressSpaceID source);
       void handle_view_find_last_users_response(Deserializer &derez);
@@ -4333,6 +4517,7 @@ namespace Legion {
     public:
       inline Processor find_local_group(void) { return local_group; }
       inline Processor find_utility_group(void) { return utility_group; }
+      inline Processor find_gc_group(void) { return gc_group; }
       Processor find_processor_group(const std::vector<Processor> &procs);
       ProcessorMask find_processor_mask(const std::vector<Processor> &procs);
       template<typename T>
@@ -4430,6 +4615,29 @@ namespace Legion {
       inline void free_available(std::deque<T*> &queue);
       template<bool CAN_BE_DELETED, typename T>
       inline void release_operation(std::deque<T*> &queue, T* operation);
+    public:
+      // Per-thread caches of recycled operations for the most common
+      // operation kinds so the hot allocate/free paths do not need to
+      // take the locks protecting the shared free lists. Threads refill
+      // from and return to the shared free lists in batches.
+      struct LocalOperationCache {
+      public:
+        LocalOperationCache(Runtime *rt)
+          : runtime(rt) { }
+      public:
+        Runtime *const runtime;
+        std::deque<IndividualTask*> individual_tasks;
+        std::deque<MapOp*>          map_ops;
+        std::deque<CopyOp*>         copy_ops;
+        std::deque<FenceOp*>        fence_ops;
+      };
+      LocalOperationCache* find_local_operation_cache(void);
+      template<typename T, typename WRAP>
+      inline T* get_available_cached(std::deque<T*> &local_queue,
+                      LocalLock &local_lock, std::deque<T*> &shared_queue);
+      template<typename T>
+      inline void release_operation_cached(std::deque<T*> &local_queue,
+                LocalLock &local_lock, std::deque<T*> &shared_queue, T *op);
     public:
       IndividualTask*       get_available_individual_task(void);
       PointTask*            get_available_point_task(void);
@@ -4657,6 +4865,14 @@ namespace Legion {
       void process_message_task(const void *args, size_t arglen); 
     protected:
       bool prepared_for_shutdown;
+    public:
+      // Accounting for owned future instance payloads so we can report
+      // whether eager reclamation of future memory is keeping up
+      inline void record_future_instance_allocation(size_t size);
+      inline void record_future_instance_deletion(size_t size);
+    protected:
+      std::atomic<size_t> future_instance_live_bytes;
+      std::atomic<size_t> future_instance_peak_bytes;
     protected:
 #ifdef DEBUG_LEGION
       mutable LocalLock outstanding_task_lock;
@@ -4694,10 +4910,19 @@ namespace Legion {
       // For every endpoint processor map to its address space
       std::map<Processor,AddressSpaceID> endpoint_spaces;
     protected:
-      // The task table 
+      // The task table
       mutable LocalLock task_variant_lock;
       std::map<TaskID,TaskImpl*> task_table;
       std::deque<VariantImpl*> variant_table;
+      // Profile-guided layout relaxations loaded from -lg:layout_overrides:
+      // registration-time layout constraints for these (task ID, region
+      // index) pairs are dropped so the mapper can pick layouts freely
+      // Read-only after start-up so no lock is needed
+      std::set<std::pair<TaskID,unsigned> > relaxed_layout_constraints;
+      // Global variant registrations with their broadcasts deferred by
+      // an open registration batch, protected by the task variant lock
+      unsigned variant_registration_batch_depth;
+      std::vector<VariantImpl*> pending_variant_broadcasts;
     protected:
       // Constraint sets
       mutable LocalLock layout_constraints_lock;
@@ -4966,6 +5191,11 @@ namespace Legion {
       mutable LocalLock timing_op_lock;
       mutable LocalLock tunable_op_lock;
       mutable LocalLock all_reduce_op_lock;
+    protected:
+      // Registry of the per-thread operation caches so we can reclaim
+      // any cached operations when the runtime is deleted
+      mutable LocalLock local_op_cache_lock;
+      std::vector<LocalOperationCache*> local_operation_caches;
     protected:
       std::deque<IndividualTask*>       available_individual_tasks;
       std::deque<PointTask*>            available_point_tasks;
@@ -5294,6 +5524,9 @@ namespace Legion {
     public:
       static inline ApEvent acquire_ap_reservation(Reservation r,bool exclusive,
                                    ApEvent precondition = ApEvent::NO_AP_EVENT);
+      static inline ApEvent acquire_ap_reservations(
+                                   const std::map<Reservation,bool> &rsrvs,
+                                   ApEvent precondition = ApEvent::NO_AP_EVENT);
       static inline RtEvent acquire_rt_reservation(Reservation r,bool exclusive,
                                    RtEvent precondition = RtEvent::NO_RT_EVENT);
       static inline void release_reservation(Reservation r,
@@ -5433,6 +5666,63 @@ namespace Legion {
         queue.push_front(operation);
     }
 
+    //--------------------------------------------------------------------------
+    template<typename T, typename WRAP>
+    inline T* Runtime::get_available_cached(std::deque<T*> &local_queue,
+                        LocalLock &local_lock, std::deque<T*> &shared_queue)
+    //--------------------------------------------------------------------------
+    {
+      static_assert(sizeof(T) == sizeof(WRAP), "wrapper sizes should match");
+      if (local_queue.empty())
+      {
+        // Batch refill from the shared free list so that we only pay
+        // for the lock once every several operations
+        AutoLock l_lock(local_lock);
+        for (unsigned idx = 0; !shared_queue.empty() &&
+              (idx < (LEGION_LOCAL_OP_CACHE_SIZE / 2)); idx++)
+        {
+          local_queue.push_back(shared_queue.front());
+          shared_queue.pop_front();
+        }
+      }
+      T *result = NULL;
+      if (!local_queue.empty())
+      {
+        result = local_queue.front();
+        local_queue.pop_front();
+      }
+      else
+      {
+#ifdef LEGION_TRACE_ALLOCATION
+        HandleAllocation<T,HasAllocType<T>::value>::trace_allocation();
+#endif
+        void *ptr = legion_alloc_aligned<T,false/*bytes*/>(1/*count*/);
+        result = new(ptr) WRAP(this);
+      }
+      result->activate();
+      return result;
+    }
+
+    //--------------------------------------------------------------------------
+    template<typename T>
+    inline void Runtime::release_operation_cached(std::deque<T*> &local_queue,
+                  LocalLock &local_lock, std::deque<T*> &shared_queue, T *op)
+    //--------------------------------------------------------------------------
+    {
+      if (local_queue.size() == LEGION_LOCAL_OP_CACHE_SIZE)
+      {
+        // Batch return half the cache to the shared free list with a
+        // single lock acquisition
+        AutoLock l_lock(local_lock);
+        for (unsigned idx = 0; idx < (LEGION_LOCAL_OP_CACHE_SIZE/2); idx++)
+        {
+          shared_queue.push_front(local_queue.back());
+          local_queue.pop_back();
+        }
+      }
+      local_queue.push_front(op);
+    }
+
     //--------------------------------------------------------------------------
     template<typename T>
     inline RtEvent Runtime::issue_runtime_meta_task(const LgTaskArgs<T> &args,
@@ -5454,8 +5744,13 @@ namespace Legion {
       if (!target.exists())
       {
         // If we don't have a processor to explicitly target, figure
-        // out which of our utility processors to use
-        target = utility_group;
+        // out which of our utility processors to use - background
+        // cleanup work goes to its own lane so it can never occupy
+        // all the utility processors ahead of the critical path
+        if (priority <= LG_LOW_PRIORITY)
+          target = gc_group;
+        else
+          target = utility_group;
       }
 #ifdef DEBUG_LEGION
       assert(target.exists());
@@ -6340,6 +6635,26 @@ namespace Legion {
       b = RtBarrier(copy.alter_arrival_count(delta));
     }
 
+    //--------------------------------------------------------------------------
+    inline void Runtime::record_future_instance_allocation(size_t size)
+    //--------------------------------------------------------------------------
+    {
+      const size_t live = future_instance_live_bytes.fetch_add(size) + size;
+      size_t peak = future_instance_peak_bytes.load();
+      while ((peak < live) &&
+          !future_instance_peak_bytes.compare_exchange_weak(peak, live)) { }
+    }
+
+    //--------------------------------------------------------------------------
+    inline void Runtime::record_future_instance_deletion(size_t size)
+    //--------------------------------------------------------------------------
+    {
+#ifdef DEBUG_LEGION
+      assert(future_instance_live_bytes.load() >= size);
+#endif
+      future_instance_live_bytes.fetch_sub(size);
+    }
+
     //--------------------------------------------------------------------------
     /*static*/ inline ApEvent Runtime::acquire_ap_reservation(Reservation r,
                                            bool exclusive, ApEvent precondition)
@@ -6364,6 +6679,48 @@ namespace Legion {
       return result;
     }
 
+    //--------------------------------------------------------------------------
+    /*static*/ inline ApEvent Runtime::acquire_ap_reservations(
+               const std::map<Reservation,bool> &rsrvs, ApEvent precondition)
+    //--------------------------------------------------------------------------
+    {
+#if defined(LEGION_SPY) || defined(LEGION_DISABLE_EVENT_PRUNING)
+      // Legion Spy needs to observe each acquisition individually
+      for (std::map<Reservation,bool>::const_iterator it =
+            rsrvs.begin(); it != rsrvs.end(); it++)
+        precondition =
+          acquire_ap_reservation(it->first, it->second, precondition);
+      return precondition;
+#else
+      if (implicit_profiler != NULL)
+      {
+        // So does the profiler
+        for (std::map<Reservation,bool>::const_iterator it =
+              rsrvs.begin(); it != rsrvs.end(); it++)
+          precondition =
+            acquire_ap_reservation(it->first, it->second, precondition);
+        return precondition;
+      }
+      // Chain all the acquisitions through Realm in a single call so that
+      // the common uncontended case does not need to make any events
+      std::vector<Reservation> reservations;
+      std::vector<unsigned> modes;
+      std::vector<bool> exclusive;
+      reservations.reserve(rsrvs.size());
+      modes.reserve(rsrvs.size());
+      exclusive.reserve(rsrvs.size());
+      for (std::map<Reservation,bool>::const_iterator it =
+            rsrvs.begin(); it != rsrvs.end(); it++)
+      {
+        reservations.push_back(it->first);
+        modes.push_back(it->second ? 0 : 1);
+        exclusive.push_back(it->second);
+      }
+      return ApEvent(Reservation::acquire_ordered(reservations, modes,
+                                                  exclusive, precondition));
+#endif
+    }
+
     //--------------------------------------------------------------------------
     /*static*/ inline RtEvent Runtime::acquire_rt_reservation(Reservation r,
                                            bool exclusive, RtEvent precondition)
@@ -6396,6 +6753,8 @@ namespace Legion {
           break;
         case TASK_MESSAGE:
           return TASK_VIRTUAL_CHANNEL;
+        case SLICE_RELAY_MESSAGE:
+          return TASK_VIRTUAL_CHANNEL;
         case STEAL_MESSAGE:
           return MAPPER_VIRTUAL_CHANNEL;
         case ADVERTISEMENT_MESSAGE:
@@ -6679,6 +7038,8 @@ namespace Legion {
           return UPDATE_VIRTUAL_CHANNEL;
         case SEND_VIEW_ADD_COPY_USER:
           return UPDATE_VIRTUAL_CHANNEL;
+        case SEND_VIEW_INVALIDATE_READ_CACHES:
+          return UPDATE_VIRTUAL_CHANNEL;
         case SEND_VIEW_FIND_LAST_USERS_REQUEST:
           break;
         case SEND_VIEW_FIND_LAST_USERS_RESPONSE:
@@ -32,6 +32,7 @@
 #define STATIC_EXACT_REGION           false
 #define STATIC_REPLICATION_ENABLED    true
 #define STATIC_SAME_ADDRESS_SPACE     false
+#define STATIC_BALANCE_SLICES         false
 
 // This is the default implementation of the mapper interface for
 // the general low level runtime
@@ -41,6 +42,10 @@ namespace Legion {
 
     Logger log_mapper("default_mapper");
 
+    /*static*/ LocalLock DefaultMapper::task_cost_lock;
+    /*static*/ std::map<TaskID,DefaultMapper::PointCostHistory>
+                                          DefaultMapper::task_cost_histories;
+
     //--------------------------------------------------------------------------
     /*static*/ const char* DefaultMapper::create_default_name(Processor p)
     //--------------------------------------------------------------------------
@@ -77,7 +82,8 @@ namespace Legion {
         map_locally(STATIC_MAP_LOCALLY),
         exact_region(STATIC_EXACT_REGION),
         replication_enabled(STATIC_REPLICATION_ENABLED),
-        same_address_space(STATIC_SAME_ADDRESS_SPACE)
+        same_address_space(STATIC_SAME_ADDRESS_SPACE),
+        balance_slices(STATIC_BALANCE_SLICES)
     //--------------------------------------------------------------------------
     {
       log_mapper.spew("Initializing the default mapper for "
@@ -112,6 +118,7 @@ namespace Legion {
           BOOL_ARG("-dm:exact_region", exact_region);
           INT_ARG("-dm:replicate", replication_enabled);
           BOOL_ARG("-dm:same_address_space", same_address_space);
+          BOOL_ARG("-dm:balance_slices", balance_slices);
 #undef BOOL_ARG
 #undef INT_ARG
         }
@@ -1065,6 +1072,11 @@ namespace Legion {
       // be scheduled on as determined by select initial task
       Processor::Kind target_kind =
         task.must_epoch_task ? local_proc.kind() : task.target_proc.kind();
+      // If we're profiling point runtimes and have history for this task,
+      // use a cost-weighted decomposition instead of the static blocks
+      if (balance_slices &&
+          default_balance_slices(ctx, task, target_kind, input, output))
+        return;
       switch (target_kind)
       {
         case Processor::LOC_PROC:
@@ -1255,6 +1267,108 @@ namespace Legion {
       cached_slices[input.domain] = output.slices;
     }
 
+    //--------------------------------------------------------------------------
+    bool DefaultMapper::default_balance_slices(MapperContext ctx,
+                                               const Task &task,
+                                               Processor::Kind target_kind,
+                                               const SliceTaskInput &input,
+                                                     SliceTaskOutput &output)
+    //--------------------------------------------------------------------------
+    {
+      // Only dense 1-D launch domains are balanced for now - everything
+      // else falls back to the static decomposition
+      if (input.domain.get_dim() != 1)
+        return false;
+      const Rect<1,coord_t> bounds = input.domain;
+      const size_t volume = bounds.volume();
+      if (volume == 0)
+        return false;
+      // Pull a snapshot of the observed costs for this task so we don't
+      // hold the lock while building the slices
+      std::vector<long long> costs(volume, -1);
+      long long measured_cost = 0;
+      size_t measured_points = 0;
+      {
+        Mapping::AutoLock cost_lock(ctx, task_cost_lock);
+        std::map<TaskID,PointCostHistory>::const_iterator finder =
+          task_cost_histories.find(task.task_id);
+        if (finder == task_cost_histories.end())
+          return false;
+        const PointCostHistory &history = finder->second;
+        size_t idx = 0;
+        for (PointInRectIterator<1> pir(bounds); pir(); pir++, idx++)
+        {
+          std::map<DomainPoint,long long>::const_iterator cost_finder =
+            history.point_costs.find(DomainPoint(*pir));
+          if (cost_finder == history.point_costs.end())
+            continue;
+          costs[idx] = cost_finder->second;
+          measured_cost += cost_finder->second;
+          measured_points++;
+        }
+      }
+      // Require observations for at least half the points so that a few
+      // early measurements don't skew the whole decomposition
+      if (measured_points < ((volume + 1) / 2))
+        return false;
+      // Select the target processors the same way the static path does
+      Machine::ProcessorQuery all_procs(machine);
+      all_procs.only_kind(target_kind);
+      if (((task.tag & SAME_ADDRESS_SPACE) != 0) || same_address_space)
+        all_procs.local_address_space();
+      else if (replication_enabled && (task.get_depth() == 1))
+      {
+        const Task *parent = task.get_parent_task();
+        if ((parent != NULL) && (parent->get_total_shards() > 1))
+          all_procs.local_address_space();
+      }
+      std::vector<Processor> procs(all_procs.begin(), all_procs.end());
+      if (procs.empty())
+        return false;
+      // Unmeasured points are assumed to cost the average of the others
+      const long long average_cost = measured_cost / measured_points;
+      long long total_cost = 0;
+      for (size_t idx = 0; idx < volume; idx++)
+      {
+        if (costs[idx] <= 0)
+          costs[idx] = (average_cost > 0) ? average_cost : 1;
+        total_cost += costs[idx];
+      }
+      // Walk the points in order, closing each slice once it has met its
+      // share of the total cost (while leaving at least one point for
+      // every remaining slice) so processors get similar amounts of work
+      const size_t num_slices = std::min(volume, procs.size());
+      output.slices.reserve(num_slices);
+      long long accumulated = 0;
+      coord_t slice_lo = bounds.lo[0];
+      size_t slice_index = 0;
+      size_t idx = 0;
+      for (coord_t p = bounds.lo[0]; p <= bounds.hi[0]; p++, idx++)
+      {
+        accumulated += costs[idx];
+        const size_t points_left = volume - idx - 1;
+        const size_t slices_left = num_slices - slice_index - 1;
+        const bool close = (slices_left == 0) ? (points_left == 0) :
+          ((points_left == slices_left) ||
+           ((accumulated * (long long)num_slices) >=
+            (total_cost * (long long)(slice_index + 1))));
+        if (close)
+        {
+          const Point<1,coord_t> point_lo(slice_lo), point_hi(p);
+          const Rect<1,coord_t> slice(point_lo, point_hi);
+          output.slices.push_back(TaskSlice(slice, procs[slice_index],
+                false/*recurse*/, stealing_enabled));
+          slice_lo = p + 1;
+          slice_index++;
+        }
+      }
+      log_mapper.spew("Default mapper balanced %zd points of task %s "
+                      "across %zd slices", volume, task.get_task_name(),
+                      output.slices.size());
+      // Balanced slices are never cached since the costs keep evolving
+      return true;
+    }
+
     //--------------------------------------------------------------------------
     void DefaultMapper::map_task(const MapperContext      ctx,
                                  const Task&              task,
@@ -1294,6 +1408,11 @@ namespace Legion {
       output.chosen_variant = chosen.variant;
       output.task_priority = default_policy_select_task_priority(ctx, task);
       output.postmap_task = false;
+      // If we're balancing slices, ask for the timeline of every point of
+      // an index launch so later launches can weight their decomposition
+      if (balance_slices && task.is_index_space)
+        output.task_prof_requests.add_measurement<
+                                  ProfilingMeasurements::OperationTimeline>();
       // Figure out our target processors
       if (input.shard_processor.exists())
         output.target_procs.resize(1, input.shard_processor);
@@ -2174,6 +2293,28 @@ namespace Legion {
       return true;
     }
 
+    //--------------------------------------------------------------------------
+    static inline bool has_better_affinity(
+                              const Machine::ProcessorMemoryAffinity &affinity,
+                              Memory memory, Memory best_memory,
+                              unsigned best_bandwidth, unsigned best_latency)
+    //--------------------------------------------------------------------------
+    {
+      if (!best_memory.exists())
+        return true;
+      // Rank memories by bandwidth first, then use latency to break any
+      // ties so that equal-bandwidth memories in different NUMA domains
+      // are ordered by their distance from the target processor, and
+      // finally prefer socket memories over system memory since their
+      // pages are pinned to a single domain
+      if (affinity.bandwidth != best_bandwidth)
+        return (affinity.bandwidth > best_bandwidth);
+      if (affinity.latency != best_latency)
+        return (affinity.latency < best_latency);
+      return ((memory.kind() == Memory::SOCKET_MEM) &&
+              (best_memory.kind() != Memory::SOCKET_MEM));
+    }
+
     //--------------------------------------------------------------------------
     Memory DefaultMapper::default_policy_select_target_memory(MapperContext ctx,
                                        Processor target_proc,
@@ -2209,11 +2350,15 @@ namespace Legion {
                          "This machine is really messed up!", target_proc.id);
         assert(false);
       }
-      // Figure out the memory with the highest-bandwidth
+      // Figure out the memory with the highest-bandwidth, breaking ties
+      // on latency so that on multi-socket nodes we land in the NUMA
+      // domain closest to the target processor
       Memory best_memory = Memory::NO_MEMORY;
       unsigned best_bandwidth = 0;
+      unsigned best_latency = 0;
       Memory best_rdma_memory = Memory::NO_MEMORY;
       unsigned best_rdma_bandwidth = 0;
+      unsigned best_rdma_latency = 0;
       std::vector<Machine::ProcessorMemoryAffinity> affinity(1);
       for (Machine::MemoryQuery::iterator it = visible_memories.begin();
             it != visible_memories.end(); it++)
@@ -2224,15 +2369,18 @@ namespace Legion {
         machine.get_proc_mem_affinity(affinity, target_proc, *it,
 				      false /*not just local affinities*/);
         assert(affinity.size() == 1);
-        if (!best_memory.exists() || (affinity[0].bandwidth > best_bandwidth)) {
+        if (has_better_affinity(affinity[0], *it, best_memory,
+                                best_bandwidth, best_latency)) {
           best_memory = *it;
           best_bandwidth = affinity[0].bandwidth;
+          best_latency = affinity[0].latency;
         }
         if ((it->kind() == Memory::REGDMA_MEM || it->kind() == Memory::Z_COPY_MEM) &&
-	    (!best_rdma_memory.exists() ||
-	     (affinity[0].bandwidth > best_rdma_bandwidth))) {
+	    has_better_affinity(affinity[0], *it, best_rdma_memory,
+				best_rdma_bandwidth, best_rdma_latency)) {
           best_rdma_memory = *it;
           best_rdma_bandwidth = affinity[0].bandwidth;
+          best_rdma_latency = affinity[0].latency;
         }
       }
       if (!best_memory.exists())
@@ -2272,9 +2420,12 @@ namespace Legion {
                          "This machine is really messed up!", target_proc.id);
         assert(false);
       }
-      // Figure out the memory with the highest-bandwidth
+      // Figure out the memory with the highest-bandwidth, breaking ties
+      // on latency so that on multi-socket nodes we land in the NUMA
+      // domain closest to the target processor
       Memory best_memory = Memory::NO_MEMORY;
       unsigned best_bandwidth = 0;
+      unsigned best_latency = 0;
       std::vector<Machine::ProcessorMemoryAffinity> affinity(1);
       for (Machine::MemoryQuery::iterator it = visible_memories.begin();
             it != visible_memories.end(); it++)
@@ -2283,9 +2434,11 @@ namespace Legion {
         machine.get_proc_mem_affinity(affinity, target_proc, *it,
 				      false /*not just local affinities*/);
         assert(affinity.size() == 1);
-        if (!best_memory.exists() || (affinity[0].bandwidth > best_bandwidth)) {
+        if (has_better_affinity(affinity[0], *it, best_memory,
+                                best_bandwidth, best_latency)) {
           best_memory = *it;
           best_bandwidth = affinity[0].bandwidth;
+          best_latency = affinity[0].latency;
         }
       }
       assert(best_memory.exists());
@@ -2735,8 +2888,27 @@ namespace Legion {
     {
       log_mapper.spew("Default report_profiling for Task in %s",
                       get_mapper_name());
-      // We don't ask for any task profiling right now so assert if we see this
-      assert(false);
+      // The only task profiling we request is the timeline used for
+      // balancing index launch slices
+      assert(balance_slices);
+      ProfilingMeasurements::OperationTimeline *timeline =
+        input.profiling_responses.get_measurement<
+                                  ProfilingMeasurements::OperationTimeline>();
+      if (timeline == NULL)
+        return;
+      if ((timeline->start_time !=
+            ProfilingMeasurements::OperationTimeline::INVALID_TIMESTAMP) &&
+          (timeline->end_time !=
+            ProfilingMeasurements::OperationTimeline::INVALID_TIMESTAMP))
+      {
+        Mapping::AutoLock cost_lock(ctx, task_cost_lock);
+        PointCostHistory &history = task_cost_histories[task.task_id];
+        long long &cost = history.point_costs[task.index_point];
+        history.total_cost -= cost;
+        cost = timeline->end_time - timeline->start_time;
+        history.total_cost += cost;
+      }
+      delete timeline;
     }
 
     //--------------------------------------------------------------------------
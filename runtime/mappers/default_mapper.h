@@ -441,6 +441,10 @@ namespace Legion {
                               const SliceTaskInput &input,
                                     SliceTaskOutput &output,
             std::map<Domain,std::vector<TaskSlice> > &cached_slices) const;
+      bool default_balance_slices(MapperContext ctx, const Task &task,
+                              Processor::Kind target_kind,
+                              const SliceTaskInput &input,
+                                    SliceTaskOutput &output);
       bool default_create_custom_instances(MapperContext ctx,
                               Processor target, Memory target_memory,
                               const RegionRequirement &req, unsigned index,
@@ -581,6 +585,17 @@ namespace Legion {
                LayoutConstraintID>             reduction_constraint_cache;
       std::map<Processor,Memory>               cached_target_memory,
 	                                       cached_rdma_target_memory;
+      // Per-point task runtimes observed via profiling responses, used
+      // by default_balance_slices to weight index launch decompositions.
+      // This table is shared by all the mapper instances in the process
+      // because point tasks report their timelines to the mappers of the
+      // processors they ran on, not to the mapper that sliced the launch
+      struct PointCostHistory {
+        std::map<DomainPoint,long long>        point_costs; // nanoseconds
+        long long                              total_cost = 0;
+      };
+      static LocalLock                         task_cost_lock;
+      static std::map<TaskID,PointCostHistory> task_cost_histories;
     protected:
       // The maximum number of tasks a mapper will allow to be stolen at a time
       // Controlled by -dm:thefts
@@ -608,6 +623,10 @@ namespace Legion {
       // Controlled by -dm:replicate (true by default)
       bool replication_enabled;
       bool same_address_space;
+      // Whether to profile per-point task runtimes and use them to
+      // produce cost-balanced slices for index launches
+      // Controlled by -dm:balance_slices (false by default)
+      bool balance_slices;
     };
 
   }; // namespace Mapping
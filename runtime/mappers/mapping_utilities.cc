@@ -158,6 +158,63 @@ namespace Legion {
         MachineQueryInterface::sort_memories(machine, mem, stack, latency);
       }
 
+      //------------------------------------------------------------------------
+      Memory MachineQueryInterface::find_local_numa_memory(Processor proc)
+      //------------------------------------------------------------------------
+      {
+        std::map<Processor,Memory>::iterator finder =
+                                                  proc_numa_table.find(proc);
+        if (finder != proc_numa_table.end())
+          return finder->second;
+        Memory result =
+          MachineQueryInterface::find_local_numa_memory(machine, proc);
+        proc_numa_table[proc] = result;
+        return result;
+      }
+
+      //------------------------------------------------------------------------
+      /*static*/ Memory MachineQueryInterface::find_local_numa_memory(
+                                                Machine machine, Processor proc)
+      //------------------------------------------------------------------------
+      {
+        std::vector<Machine::ProcessorMemoryAffinity> affinities;
+        machine.get_proc_mem_affinity(affinities, proc);
+        Memory result = Memory::NO_MEMORY;
+        unsigned best_bandwidth = 0, best_latency = 0;
+        bool best_socket = false;
+        for (std::vector<Machine::ProcessorMemoryAffinity>::const_iterator
+              it = affinities.begin(); it != affinities.end(); it++)
+        {
+          const Memory::Kind kind = it->m.kind();
+          if ((kind != Memory::SOCKET_MEM) && (kind != Memory::SYSTEM_MEM))
+            continue;
+          if (it->m.capacity() == 0)
+            continue;
+          const bool is_socket = (kind == Memory::SOCKET_MEM);
+          if (result.exists())
+          {
+            // Socket memories are pinned to a single NUMA domain, so
+            // prefer them over system memory, then rank by bandwidth
+            // with latency breaking any ties between domains
+            if (best_socket && !is_socket)
+              continue;
+            if (best_socket == is_socket)
+            {
+              if (it->bandwidth < best_bandwidth)
+                continue;
+              if ((it->bandwidth == best_bandwidth) &&
+                  (it->latency >= best_latency))
+                continue;
+            }
+          }
+          result = it->m;
+          best_bandwidth = it->bandwidth;
+          best_latency = it->latency;
+          best_socket = is_socket;
+        }
+        return result;
+      }
+
       //------------------------------------------------------------------------
       Memory MachineQueryInterface::find_memory_kind(Processor proc,
                                                      Memory::Kind kind)
@@ -606,6 +663,48 @@ namespace Legion {
       {
       }
 
+      /**********************************
+       * Decision Cache
+       **********************************/
+
+      //------------------------------------------------------------------------
+      DecisionCacheBase::DecisionCacheBase(unsigned max_failures)
+        : current_epoch(0), max_failed_replays(max_failures),
+          hits(0), misses(0)
+      //------------------------------------------------------------------------
+      {
+      }
+
+      //------------------------------------------------------------------------
+      void DecisionCacheBase::invalidate_all_decisions(void)
+      //------------------------------------------------------------------------
+      {
+        // Entries recorded in older epochs are dropped lazily when their
+        // hashes are next looked up
+        current_epoch++;
+      }
+
+      //------------------------------------------------------------------------
+      bool DecisionCacheBase::check_entry(const EntryBase &entry) const
+      //------------------------------------------------------------------------
+      {
+        return (entry.epoch == current_epoch);
+      }
+
+      //------------------------------------------------------------------------
+      bool DecisionCacheBase::count_failed_replay(EntryBase &entry)
+      //------------------------------------------------------------------------
+      {
+        return (++entry.failed_replays >= max_failed_replays);
+      }
+
+      //------------------------------------------------------------------------
+      DecisionCacheBase::EntryBase::EntryBase(void)
+        : epoch(0), failed_replays(0)
+      //------------------------------------------------------------------------
+      {
+      }
+
       /************************
        * Mapping Profiler
        ************************/
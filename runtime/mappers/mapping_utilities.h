@@ -60,6 +60,15 @@ namespace Legion {
                                bool latency);
         static void find_memory_stack(Machine machine, Memory mem,
                             std::vector<Memory> &stack, bool latency);
+        /**
+         * Find the NUMA domain memory with the best affinity to the
+         * specified processor, ranking socket and system memories by
+         * bandwidth and using latency to break ties between domains.
+         * Returns NO_MEMORY if the processor has no affinity to any
+         * socket or system memory.
+         */
+        Memory find_local_numa_memory(Processor proc);
+        static Memory find_local_numa_memory(Machine machine, Processor proc);
         /**
          * Find the memory of a given kind that is visible from
          * the specified processor.
@@ -107,6 +116,7 @@ namespace Legion {
         Memory global_memory;
         std::map<Processor,std::vector<Memory> > proc_mem_stacks;
         std::map<Memory,std::vector<Memory> > mem_mem_stacks;
+        std::map<Processor,Memory> proc_numa_table;
         std::map<std::pair<Processor,Memory::Kind>,Memory> proc_mem_table;
         std::map<std::pair<Memory,Memory::Kind>,Memory> mem_mem_table;
         std::map<std::pair<Memory,Processor::Kind>,Processor> mem_proc_table;
@@ -175,6 +185,94 @@ namespace Legion {
         std::map<MappingKey,MemoizedMapping> permanent_mappings;
       };
 
+      /**
+       * A generic cache for memoizing expensive mapper decisions keyed by
+       * a hash of the inputs to a mapper call (e.g. the task hash computed
+       * by DefaultMapper::compute_task_hash). The cache itself does not
+       * interpret decisions, so replaying one skips the policy logic that
+       * produced it, but the mapper must revalidate replayed decisions
+       * against the runtime (e.g. with acquire_and_filter_instances for
+       * cached physical instances) and report failures so that decisions
+       * that no longer validate are dropped instead of retried forever.
+       * State the runtime can change out from under the mapper is covered
+       * by an epoch: each decision records the epoch at which it was made
+       * and bumping the epoch (e.g. when the mapper learns the machine
+       * model changed) lazily invalidates every older decision.
+       */
+      class DecisionCacheBase {
+      public:
+        typedef unsigned long long DecisionHash;
+      public:
+        DecisionCacheBase(unsigned max_failures = 4);
+      public:
+        /**
+         * Lazily invalidate all currently cached decisions, e.g. because
+         * the machine model changed.
+         */
+        void invalidate_all_decisions(void);
+        /**
+         * Cache effectiveness counters for tuning hash functions
+         */
+        inline unsigned long long get_hits(void) const { return hits; }
+        inline unsigned long long get_misses(void) const { return misses; }
+      protected:
+        struct EntryBase {
+        public:
+          EntryBase(void);
+        public:
+          unsigned epoch;
+          unsigned failed_replays;
+        };
+      protected:
+        // Check whether an entry was recorded in the current epoch
+        bool check_entry(const EntryBase &entry) const;
+        // Count a failed replay, returning true if the entry should be
+        // dropped from the cache
+        bool count_failed_replay(EntryBase &entry);
+      protected:
+        unsigned current_epoch;
+        const unsigned max_failed_replays;
+        unsigned long long hits, misses;
+      };
+
+      template<typename DECISION>
+      class DecisionCache : public DecisionCacheBase {
+      public:
+        DecisionCache(unsigned max_failures = 4);
+      public:
+        /**
+         * Look for a decision recorded under this hash, copying it out
+         * and returning true if a valid one is present. The caller is
+         * expected to validate the decision with the runtime before
+         * acting on it and to call report_failed_replay if the
+         * validation does not succeed.
+         */
+        bool find_decision(DecisionHash hash, DECISION &decision);
+        /**
+         * Record (or overwrite) the decision for this hash, resetting
+         * any failure count from a prior decision.
+         */
+        void record_decision(DecisionHash hash, const DECISION &decision);
+        /**
+         * Report that runtime validation of a previously found decision
+         * failed (e.g. a cached instance was deleted). After enough
+         * failures the decision is dropped so the policy logic runs
+         * again and records a fresh one.
+         */
+        void report_failed_replay(DecisionHash hash);
+        /**
+         * Drop the decision for this hash immediately.
+         */
+        void remove_decision(DecisionHash hash);
+      protected:
+        struct Entry : public EntryBase {
+        public:
+          DECISION decision;
+        };
+      protected:
+        std::map<DecisionHash,Entry> decisions;
+      };
+
       /**
        * The Mapping Profiler will cycle through all the different
        * variants of the task until it has reached the required
@@ -342,6 +440,70 @@ namespace Legion {
 
       /** @} */
 
+      //------------------------------------------------------------------------
+      template<typename DECISION>
+      DecisionCache<DECISION>::DecisionCache(unsigned max_failures)
+        : DecisionCacheBase(max_failures)
+      //------------------------------------------------------------------------
+      {
+      }
+
+      //------------------------------------------------------------------------
+      template<typename DECISION>
+      bool DecisionCache<DECISION>::find_decision(DecisionHash hash,
+                                                  DECISION &decision)
+      //------------------------------------------------------------------------
+      {
+        typename std::map<DecisionHash,Entry>::iterator finder =
+          decisions.find(hash);
+        if (finder != decisions.end())
+        {
+          if (check_entry(finder->second))
+          {
+            decision = finder->second.decision;
+            hits++;
+            return true;
+          }
+          // Recorded in an older epoch so drop it now
+          decisions.erase(finder);
+        }
+        misses++;
+        return false;
+      }
+
+      //------------------------------------------------------------------------
+      template<typename DECISION>
+      void DecisionCache<DECISION>::record_decision(DecisionHash hash,
+                                                    const DECISION &decision)
+      //------------------------------------------------------------------------
+      {
+        Entry &entry = decisions[hash];
+        entry.epoch = current_epoch;
+        entry.failed_replays = 0;
+        entry.decision = decision;
+      }
+
+      //------------------------------------------------------------------------
+      template<typename DECISION>
+      void DecisionCache<DECISION>::report_failed_replay(DecisionHash hash)
+      //------------------------------------------------------------------------
+      {
+        typename std::map<DecisionHash,Entry>::iterator finder =
+          decisions.find(hash);
+        if (finder == decisions.end())
+          return;
+        if (count_failed_replay(finder->second))
+          decisions.erase(finder);
+      }
+
+      //------------------------------------------------------------------------
+      template<typename DECISION>
+      void DecisionCache<DECISION>::remove_decision(DecisionHash hash)
+      //------------------------------------------------------------------------
+      {
+        decisions.erase(hash);
+      }
+
     }; // namespace Utilities
   }; // namespace Mapping
 }; // namespace Legion
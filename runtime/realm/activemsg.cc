@@ -28,13 +28,20 @@ namespace Realm {
   Realm::Logger log_amhandler("amhandler");
 
   namespace Config {
-    // if true, the number and min/max/avg/stddev duration of handler per
-    //  message type is recorded and printed
+    // if true, the number, min/max/avg/stddev duration, and total payload
+    //  bytes of handler per message type is recorded and printed
     bool profile_activemsg_handlers = false;
 
     // the maximum time we're willing to spend on inline message
     //  handlers
     long long max_inline_message_time = 5000 /* nanoseconds*/;
+
+    // the maximum time a small message may be held back while a batch
+    //  for its target node fills - zero disables coalescing entirely
+    long long am_coalescing_budget = 0 /* nanoseconds*/;
+
+    // the maximum number of packed bytes in a coalesced batch
+    size_t am_coalescing_max_bytes = 1024;
   };
 
 
@@ -95,10 +102,11 @@ namespace Realm {
   //
 
   ActiveMessageHandlerStats::ActiveMessageHandlerStats(void)
-    : count(0), sum(0), sum2(0), minval(~size_t(0)), maxval(0)
+    : count(0), sum(0), sum2(0), minval(~size_t(0)), maxval(0), bytes(0)
   {}
 
-  void ActiveMessageHandlerStats::record(long long t_start, long long t_end)
+  void ActiveMessageHandlerStats::record(long long t_start, long long t_end,
+					 size_t payload_bytes)
   {
     long long delta = t_end - t_start;
     size_t val = (delta > 0) ? delta : 0;
@@ -107,6 +115,7 @@ namespace Realm {
     maxval.fetch_max(val);
     sum.fetch_add(val);
     sum2.fetch_add(val * val); // TODO: smarter math to avoid overflow
+    bytes.fetch_add(payload_bytes);
   }
 
 
@@ -136,10 +145,11 @@ namespace Realm {
 
   void ActiveMessageHandlerTable::record_message_handler_call(MessageID id,
 							      long long t_start,
-							      long long t_end)
+							      long long t_end,
+							      size_t payload_bytes)
   {
     assert(id < handlers.size());
-    handlers[id].stats.record(t_start, t_end);
+    handlers[id].stats.record(t_start, t_end, payload_bytes);
   }
 
   void ActiveMessageHandlerTable::report_message_handler_stats()
@@ -155,6 +165,7 @@ namespace Realm {
 	size_t sum2 = stats.sum2.load();
 	size_t minval = stats.minval.load();
 	size_t maxval = stats.maxval.load();
+	size_t bytes = stats.bytes.load();
 	double avg = double(sum) / double(count);
 	double stddev = sqrt((double(sum2) / double(count)) - (avg * avg));
 	log_amhandler.print() << "handler " << i << ": " << handlers[i].name
@@ -162,7 +173,8 @@ namespace Realm {
 			      << " avg=" << avg
 			      << " dev=" << stddev
 			      << " min=" << minval
-			      << " max=" << maxval;
+			      << " max=" << maxval
+			      << " bytes=" << bytes;
       }
     }
   }
@@ -446,7 +458,7 @@ namespace Realm {
 
     // if we have an inline handler and enough time to run it, give it
     //  a go
-    if((handler->handler_inline != 0) &&
+    if(handler && (handler->handler_inline != 0) &&
        (Config::max_inline_message_time > 0) &&
        !work_until.will_expire(Config::max_inline_message_time)) {
       long long t_start = 0;
@@ -457,7 +469,7 @@ namespace Realm {
 				   TimeLimit::relative(Config::max_inline_message_time))) {
 	if(Config::profile_activemsg_handlers) {
 	  long long t_end = Clock::current_time_in_nanoseconds();
-	  handler->stats.record(t_start, t_end);
+	  handler->stats.record(t_start, t_end, payload_size);
 	}
 	if(payload_mode == PAYLOAD_FREE)
 	  free(const_cast<void *>(payload));
@@ -823,7 +835,8 @@ namespace Realm {
 				      current_msg->callback_data2);
 
       if(do_profile)
-	current_msg->handler->stats.record(t_start, t_end);
+	current_msg->handler->stats.record(t_start, t_end,
+					   current_msg->payload_size);
 #ifdef DETAILED_MESSAGE_TIMING
       detailed_message_timing.record(timing_idx,
 				     current_msg->get_peer(),
@@ -908,7 +921,8 @@ namespace Realm {
 					current_msg->callback_data2);
 
 	if(Config::profile_activemsg_handlers)
-	  current_msg->handler->stats.record(t_start, t_end);
+	  current_msg->handler->stats.record(t_start, t_end,
+					   current_msg->payload_size);
 #ifdef DETAILED_MESSAGE_TIMING
 	detailed_message_timing.record(timing_idx, 
 				       current_msg->get_peer(),
@@ -930,4 +944,194 @@ namespace Realm {
   }
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class ActiveMessageCoalescer
+  //
+
+  namespace {
+    // record header, message header and payload are all kept 8-byte
+    //  aligned within the batch payload so that handlers can read their
+    //  headers in place
+    size_t roundup8(size_t bytes) { return ((bytes + 7) & ~size_t(7)); }
+  }; // namespace
+
+  struct ActiveMessageBatchMessage {
+    unsigned short count;
+
+    static void handle_message(NodeID sender, const ActiveMessageBatchMessage &msg,
+			       const void *data, size_t datalen,
+			       TimeLimit work_until);
+  };
+
+  /*static*/ void ActiveMessageBatchMessage::handle_message(
+      NodeID sender, const ActiveMessageBatchMessage &msg, const void *data,
+      size_t datalen, TimeLimit work_until)
+  {
+    const char *pos = static_cast<const char *>(data);
+    const char *end = pos + datalen;
+    for(unsigned i = 0; i < msg.count; i++) {
+      ActiveMessageCoalescer::BatchRecord rec;
+      assert(size_t(end - pos) >= sizeof(rec));
+      memcpy(&rec, pos, sizeof(rec));
+      const char *hdr = pos + sizeof(rec);
+      const char *payload = hdr + roundup8(rec.header_size);
+      pos = payload + roundup8(rec.payload_size);
+      assert(pos <= end);
+
+      ActiveMessageHandlerTable::HandlerEntry *handler =
+	  activemsg_handler_table.lookup_message_handler(rec.msgid);
+      assert(handler != 0);
+
+      long long t_start = 0;
+      if(Config::profile_activemsg_handlers)
+	t_start = Clock::current_time_in_nanoseconds();
+
+      if(handler->handler != 0)
+	(handler->handler)(sender, hdr, payload, rec.payload_size, work_until);
+      else
+	(handler->handler_notimeout)(sender, hdr, payload, rec.payload_size);
+
+      if(Config::profile_activemsg_handlers)
+	handler->stats.record(t_start, Clock::current_time_in_nanoseconds(),
+			      rec.payload_size);
+    }
+    assert(pos == end);
+  }
+
+  ActiveMessageCoalescer::ActiveMessageCoalescer(int _nodes)
+    : BackgroundWorkItem("amcoalescer")
+    , nodes(_nodes)
+    , batches(new TargetBatch[_nodes])
+    , is_active(false)
+  {}
+
+  ActiveMessageCoalescer::~ActiveMessageCoalescer(void)
+  {
+    flush_all();
+#ifdef DEBUG_REALM
+    shutdown_work_item();
+#endif
+    delete[] batches;
+  }
+
+  /*static*/ bool ActiveMessageCoalescer::is_batchable(size_t header_size,
+						       size_t payload_size)
+  {
+    if(Config::am_coalescing_budget <= 0)
+      return false;
+    return ((sizeof(BatchRecord) + roundup8(header_size) + roundup8(payload_size)) <=
+	    Config::am_coalescing_max_bytes);
+  }
+
+  void ActiveMessageCoalescer::enqueue_raw(NodeID target, unsigned short msgid,
+					   const void *header, size_t header_size,
+					   const void *payload, size_t payload_size)
+  {
+    assert((target >= 0) && (target < nodes));
+    assert(header_size <= (unsigned short)-1);
+
+    BatchRecord rec;
+    rec.msgid = msgid;
+    rec.header_size = (unsigned short)header_size;
+    rec.payload_size = (unsigned)payload_size;
+    size_t needed = (sizeof(BatchRecord) + roundup8(header_size) +
+		     roundup8(payload_size));
+
+    // if the batch is too full for this record, take its contents and
+    //  send them once we've dropped the mutex
+    std::vector<char> tosend;
+    unsigned short tosend_count = 0;
+    {
+      AutoLock<> al(mutex);
+      TargetBatch &batch = batches[target];
+      if((batch.count > 0) &&
+	 ((batch.data.size() + needed) > Config::am_coalescing_max_bytes)) {
+	tosend.swap(batch.data);
+	tosend_count = batch.count;
+	batch.count = 0;
+      }
+      if(batch.count == 0)
+	batch.first_enqueue_time = Clock::current_time_in_nanoseconds();
+      size_t ofs = batch.data.size();
+      batch.data.resize(ofs + needed, 0);
+      memcpy(&batch.data[ofs], &rec, sizeof(rec));
+      memcpy(&batch.data[ofs + sizeof(rec)], header, header_size);
+      if(payload_size > 0)
+	memcpy(&batch.data[ofs + sizeof(rec) + roundup8(header_size)],
+	       payload, payload_size);
+      batch.count++;
+      if(!is_active) {
+	is_active = true;
+	make_active();
+      }
+    }
+    if(tosend_count > 0)
+      send_batch(target, tosend_count, tosend.data(), tosend.size());
+  }
+
+  void ActiveMessageCoalescer::send_batch(NodeID target, unsigned short count,
+					  const void *data, size_t datalen)
+  {
+    ActiveMessage<ActiveMessageBatchMessage> amsg(target, datalen);
+    amsg->count = count;
+    amsg.add_payload(data, datalen);
+    amsg.commit();
+  }
+
+  void ActiveMessageCoalescer::flush_all(void)
+  {
+    for(int target = 0; target < nodes; target++) {
+      std::vector<char> tosend;
+      unsigned short tosend_count = 0;
+      {
+	AutoLock<> al(mutex);
+	TargetBatch &batch = batches[target];
+	if(batch.count == 0)
+	  continue;
+	tosend.swap(batch.data);
+	tosend_count = batch.count;
+	batch.count = 0;
+      }
+      send_batch(target, tosend_count, tosend.data(), tosend.size());
+    }
+  }
+
+  bool ActiveMessageCoalescer::do_work(TimeLimit work_until)
+  {
+    long long now = Clock::current_time_in_nanoseconds();
+    for(int target = 0; target < nodes; target++) {
+      std::vector<char> tosend;
+      unsigned short tosend_count = 0;
+      {
+	AutoLock<> al(mutex);
+	TargetBatch &batch = batches[target];
+	if(batch.count == 0)
+	  continue;
+	// batches that haven't aged out yet get picked up on a later pass
+	if((now - batch.first_enqueue_time) < Config::am_coalescing_budget)
+	  continue;
+	tosend.swap(batch.data);
+	tosend_count = batch.count;
+	batch.count = 0;
+      }
+      send_batch(target, tosend_count, tosend.data(), tosend.size());
+    }
+
+    // anything still queued (i.e. not yet aged out) means we want to be
+    //  called again - check under the mutex so that we can't miss an
+    //  enqueue that saw us still active
+    {
+      AutoLock<> al(mutex);
+      for(int target = 0; target < nodes; target++)
+	if(batches[target].count > 0)
+	  return true; // request requeuing
+      is_active = false;
+    }
+    return false;
+  }
+
+  ActiveMessageHandlerReg<ActiveMessageBatchMessage> active_message_batch_message_handler;
+
+
 }; // namespace Realm
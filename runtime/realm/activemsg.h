@@ -43,6 +43,14 @@ namespace Realm {
     // the maximum time we're willing to spend on inline message
     //  handlers
     extern long long max_inline_message_time;
+
+    // the maximum time a small message may be held back while a batch
+    //  for its target node fills, in nanoseconds - zero disables
+    //  coalescing entirely
+    extern long long am_coalescing_budget;
+
+    // the maximum number of packed bytes in a coalesced batch
+    extern size_t am_coalescing_max_bytes;
   };
 
   enum { PAYLOAD_NONE, // no payload in packet
@@ -228,10 +236,10 @@ namespace Realm {
   class ActiveMessageHandlerRegBase;
 
   struct ActiveMessageHandlerStats {
-    atomic<size_t> count, sum, sum2, minval, maxval;
+    atomic<size_t> count, sum, sum2, minval, maxval, bytes;
 
     ActiveMessageHandlerStats(void);
-    void record(long long t_start, long long t_end);
+    void record(long long t_start, long long t_end, size_t payload_bytes);
   };
 
   struct FragmentInfo {
@@ -261,7 +269,8 @@ namespace Realm {
 
     const char *lookup_message_name(MessageID id);
     void record_message_handler_call(MessageID id,
-				     long long t_start, long long t_end);
+				     long long t_start, long long t_end,
+				     size_t payload_bytes);
     void report_message_handler_stats();
 
     static void append_handler_reg(ActiveMessageHandlerRegBase *new_reg);
@@ -454,6 +463,59 @@ namespace Realm {
         frag_message;
   };
 
+  // coalesces small, single-target active messages bound for the same
+  //  node into one network message, amortizing per-message injection
+  //  overhead when message rate rather than bandwidth is the scaling
+  //  limit - a batch is flushed when it fills or when its oldest message
+  //  has been held for the configured latency budget
+  class REALM_INTERNAL_API_EXTERNAL_LINKAGE ActiveMessageCoalescer : public BackgroundWorkItem {
+  public:
+    ActiveMessageCoalescer(int _nodes);
+    virtual ~ActiveMessageCoalescer(void);
+
+    // a message may be coalesced only if coalescing is enabled and the
+    //  message is small enough - messages that need completion callbacks
+    //  or a remote payload destination must not be enqueued
+    static bool is_batchable(size_t header_size, size_t payload_size);
+
+    // appends a message to the batch for 'target', flushing en route if
+    //  it would not fit - 'T' must be a registered message type
+    template <typename T>
+    void enqueue(NodeID target, const T &header,
+		 const void *payload = nullptr, size_t payload_size = 0);
+
+    // sends any partially-full batches immediately
+    void flush_all(void);
+
+    virtual bool do_work(TimeLimit work_until);
+
+    // wire format for one message within a batch payload - followed by
+    //  the header and payload bytes, each padded to 8 byte alignment
+    struct BatchRecord {
+      unsigned short msgid;
+      unsigned short header_size;
+      unsigned payload_size;
+    };
+
+  protected:
+    void enqueue_raw(NodeID target, unsigned short msgid,
+		     const void *header, size_t header_size,
+		     const void *payload, size_t payload_size);
+    void send_batch(NodeID target, unsigned short count,
+		    const void *data, size_t datalen);
+
+    struct TargetBatch {
+      std::vector<char> data;  // packed BatchRecords
+      unsigned short count = 0;
+      long long first_enqueue_time = 0;
+    };
+
+    int nodes;
+    Mutex mutex; // protects 'batches' and 'is_active'
+    TargetBatch *batches;
+    bool is_active;
+  };
+
   template <typename UserHdr>
   struct WrappedWithFragInfo {
     FragmentInfo frag_info;
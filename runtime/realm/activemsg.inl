@@ -819,4 +819,18 @@ namespace Realm {
   }
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class ActiveMessageCoalescer
+  //
+
+  template <typename T>
+  void ActiveMessageCoalescer::enqueue(NodeID target, const T &header,
+				       const void *payload, size_t payload_size)
+  {
+    unsigned short msgid = activemsg_handler_table.lookup_message_id<T>();
+    enqueue_raw(target, msgid, &header, sizeof(T), payload, payload_size);
+  }
+
+
 };
@@ -294,6 +294,18 @@ namespace Realm {
                              work_until);
       }
 
+      // simple arrivals (no reduction payload and no deferral on another
+      //  event) are cheap enough to run directly in the polling thread -
+      //  anything heavier takes the normal queued path
+      static bool handle_inline(NodeID sender, const BarrierAdjustMessage &args,
+                                const void *data, size_t datalen, TimeLimit work_until)
+      {
+        if((datalen > 0) || args.wait_on.exists())
+          return false;
+        handle_message(sender, args, data, datalen, work_until);
+        return true;
+      }
+
       static void send_request(NodeID target, Barrier barrier, int delta, Event wait_on,
                                NodeID sender, bool forwarded, const void *data,
                                size_t datalen)
@@ -335,13 +347,94 @@ namespace Realm {
     };
   } // namespace
 
+  // reduction payloads that span several generations tend to change few
+  //  bytes from one generation to the next (e.g. per-cell convergence
+  //  flags), so multi-generation trigger payloads can be sent as the first
+  //  value raw followed by per-generation deltas against the previous
+  //  generation's value - each delta is a sequence of (skip,copy) byte
+  //  count pairs followed by 'copy' replacement bytes
+  static bool delta_encode_values(const char *values, size_t value_size, size_t count,
+                                  std::vector<char> &encoded)
+  {
+    assert(count >= 2);
+    if(value_size > size_t(uint32_t(-1)))
+      return false;
+    const size_t raw_size = count * value_size;
+    encoded.reserve(value_size);
+    encoded.insert(encoded.end(), values, values + value_size);
+    for(size_t idx = 1; idx < count; idx++) {
+      const char *base = values + ((idx - 1) * value_size);
+      const char *cur = values + (idx * value_size);
+      size_t pos = 0;
+      while(pos < value_size) {
+        size_t skip = 0;
+        while(((pos + skip) < value_size) && (base[pos + skip] == cur[pos + skip]))
+          skip++;
+        size_t copy = 0;
+        while(((pos + skip + copy) < value_size) &&
+              (base[pos + skip + copy] != cur[pos + skip + copy]))
+          copy++;
+        uint32_t run[2] = {uint32_t(skip), uint32_t(copy)};
+        encoded.insert(encoded.end(), reinterpret_cast<const char *>(run),
+                       reinterpret_cast<const char *>(run) + sizeof(run));
+        encoded.insert(encoded.end(), cur + pos + skip, cur + pos + skip + copy);
+        pos += skip + copy;
+        // give up as soon as the encoding stops paying for itself
+        if(encoded.size() >= raw_size)
+          return false;
+      }
+    }
+    return true;
+  }
+
+  static void delta_decode_values(const char *encoded, size_t encoded_len,
+                                  size_t value_size, size_t count,
+                                  std::vector<char> &values)
+  {
+    values.resize(count * value_size);
+    assert(encoded_len >= value_size);
+    memcpy(values.data(), encoded, value_size);
+    size_t off = value_size;
+    for(size_t idx = 1; idx < count; idx++) {
+      char *cur = values.data() + (idx * value_size);
+      // start from the previous generation's value and patch the changed runs
+      memcpy(cur, cur - value_size, value_size);
+      size_t pos = 0;
+      while(pos < value_size) {
+        uint32_t run[2];
+        assert((off + sizeof(run)) <= encoded_len);
+        memcpy(run, encoded + off, sizeof(run));
+        off += sizeof(run);
+        pos += run[0];
+        assert((pos + run[1]) <= value_size);
+        assert((off + run[1]) <= encoded_len);
+        memcpy(cur + pos, encoded + off, run[1]);
+        off += run[1];
+        pos += run[1];
+      }
+    }
+    assert(off == encoded_len);
+  }
+
 #ifndef BARRIER_ENABLE_BROADCAST
   /*static*/ void BarrierTriggerMessage::send_request(
       NodeID target, ID::IDType barrier_id, EventImpl::gen_t trigger_gen,
       EventImpl::gen_t previous_gen, EventImpl::gen_t first_generation,
       ReductionOpID redop_id, NodeID migration_target, unsigned base_arrival_count,
-      const void *data, size_t datalen)
+      const void *data, size_t datalen, size_t value_size)
   {
+    // a subscriber catching up on several triggered generations gets one
+    //  value per generation - try the delta encoding and keep it only if it
+    //  is actually smaller than the raw values
+    size_t raw_datalen = 0;
+    std::vector<char> encoded;
+    if((value_size > 0) && (datalen > value_size) &&
+       delta_encode_values(static_cast<const char *>(data), value_size,
+                           datalen / value_size, encoded)) {
+      raw_datalen = datalen;
+      data = encoded.data();
+      datalen = encoded.size();
+    }
     ActiveMessage<BarrierTriggerMessage> amsg(target, datalen);
     amsg->barrier_id = barrier_id;
     amsg->trigger_gen = trigger_gen;
@@ -350,6 +443,7 @@ namespace Realm {
     amsg->redop_id = redop_id;
     amsg->migration_target = migration_target;
     amsg->base_arrival_count = base_arrival_count;
+    amsg->raw_datalen = raw_datalen;
     amsg.add_payload(data, datalen);
     amsg.commit();
   }
@@ -368,6 +462,19 @@ namespace Realm {
     Barrier b = id.convert<Barrier>();
     BarrierImpl *impl = get_runtime()->get_barrier_impl(b);
 
+    // delta-encoded reduction payloads are expanded back into one value
+    //  per generation before any of them are stored
+    std::vector<char> expanded;
+    if((datalen > 0) && (args.raw_datalen > 0)) {
+      const size_t count = args.trigger_gen - args.previous_gen;
+      assert(count > 0);
+      assert((args.raw_datalen % count) == 0);
+      delta_decode_values(static_cast<const char *>(data), datalen,
+                          args.raw_datalen / count, count, expanded);
+      data = expanded.data();
+      datalen = expanded.size();
+    }
+
     // we'll probably end up with a list of local waiters to notify
     EventWaiter::EventWaiterList local_notifications;
     {
@@ -1041,7 +1148,8 @@ namespace Realm {
         }
         BarrierTriggerMessage::send_request(
             (*it).node, me.id, tgt_trigger_gen, (*it).previous_gen, first_generation,
-            redop_id, migration_target, base_arrival_count, data, datalen);
+            redop_id, migration_target, base_arrival_count, data, datalen,
+            redop ? redop->sizeof_lhs : 0);
 #else
       if(!remote_notifications.empty()) {
         AutoLock<> al(mutex);
@@ -1380,7 +1488,7 @@ namespace Realm {
       BarrierTriggerMessage::send_request(
           subscriber, me.id, trigger_gen, previous_gen, first_generation, redop_id,
           (NodeID)-1 /*no migration*/, 0 /*dummy arrival count*/, final_values_copy,
-          final_values_size);
+          final_values_size, redop ? redop->sizeof_lhs : 0);
 #else
       BarrierTriggerMessageArgs trigger_args;
       trigger_args.internal.trigger_gen = trigger_gen;
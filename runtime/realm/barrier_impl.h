@@ -83,6 +83,9 @@ namespace Realm {
     ReductionOpID redop_id;
     NodeID migration_target;
     unsigned base_arrival_count;
+    // when nonzero, the payload is a delta-encoded form of 'raw_datalen'
+    //  bytes of per-generation reduction values
+    size_t raw_datalen;
 
     static void handle_message(NodeID sender, const BarrierTriggerMessage &msg,
                                const void *data, size_t datalen, TimeLimit work_until);
@@ -91,10 +94,20 @@ namespace Realm {
                              EventImpl::gen_t trigger_gen, EventImpl::gen_t previous_gen,
                              EventImpl::gen_t first_generation, ReductionOpID redop_id,
                              NodeID migration_target, unsigned base_arrival_count,
-                             const void *data, size_t datalen);
+                             const void *data, size_t datalen, size_t value_size);
   };
 #endif
 
+  // barriers whose arrivals and waiters all sit on one node need no active
+  //  messages: arrivals on the owner node update the generation state and
+  //  wake waiters under the local mutex, and a barrier whose activity turns
+  //  out to live entirely on some other node migrates its ownership there
+  //  (see the migration logic in adjust_arrival), after which its operations
+  //  are local too - remote traffic only resumes if another node arrives or
+  //  subscribes. a flat sense-reversing barrier would shave the remaining
+  //  mutex+tracker cost but cannot express dynamic arrival counts,
+  //  timestamped adjustments, or barrier reductions, so the general
+  //  structure is used even for the local case
   class BarrierImpl : public EventImpl {
   public:
     static const ID::ID_Types ID_TYPE = ID::ID_BARRIER;
@@ -37,7 +37,8 @@ namespace Realm {
 			 CoreReservationSet& crs,
 			 const std::string& _name,
 			 int _numa_domain,
-			 bool _pin_thread, size_t _stack_size);
+			 bool _pin_thread, size_t _stack_size,
+			 bool _scalable = false, bool _start_parked = false);
     ~BackgroundWorkThread(void);
 
     void main_loop(void);
@@ -45,10 +46,14 @@ namespace Realm {
     void join(void);
 
   protected:
+    bool park(void);
+
     BackgroundWorkManager *manager;
     CoreReservation *rsrv;
     Thread *me;
     int numa_domain;
+    bool scalable;     // is this thread eligible for park/unpark?
+    bool start_parked; // should this thread park before doing any work?
   };
 
   BackgroundWorkThread::BackgroundWorkThread(BackgroundWorkManager *_manager,
@@ -56,9 +61,13 @@ namespace Realm {
 					     const std::string& _name,
 					     int _numa_domain,
 					     bool _pin_thread,
-					     size_t _stack_size)
+					     size_t _stack_size,
+					     bool _scalable /*= false*/,
+					     bool _start_parked /*= false*/)
     : manager(_manager)
     , numa_domain(_numa_domain)
+    , scalable(_scalable)
+    , start_parked(_start_parked)
   {
     CoreReservationParameters params;
     params.set_numa_domain(_numa_domain);
@@ -81,6 +90,30 @@ namespace Realm {
     delete rsrv;
   }
 
+  // parks this thread until the manager unparks it in response to demand -
+  //  returns false if a shutdown raced with the park attempt
+  bool BackgroundWorkThread::park(void)
+  {
+    Doorbell *db = Doorbell::get_thread_doorbell();
+    db->prepare();
+    {
+      AutoLock<> al(manager->mutex);
+      // check the shutdown bit under the mutex so that
+      //  'stop_dedicated_workers' is guaranteed to see our doorbell if it
+      //  drains the parked list after setting the bit
+      if((manager->worker_state.load() &
+          BackgroundWorkManager::STATE_SHUTDOWN_BIT) != 0) {
+        db->cancel();
+        return false;
+      }
+      manager->parked_workers.push_back(db);
+    }
+    log_bgwork.debug() << "dedicated worker parked - worker=" << this;
+    db->wait();
+    log_bgwork.debug() << "dedicated worker unparked - worker=" << this;
+    return true;
+  }
+
   void BackgroundWorkThread::main_loop(void)
   {
     BackgroundWorkManager::Worker worker;
@@ -89,6 +122,11 @@ namespace Realm {
 
     log_bgwork.info() << "dedicated worker starting - worker=" << this << " numa=" << numa_domain;
 
+    // extra workers in an adaptively-scaled pool wait to be needed before
+    //  participating
+    if(start_parked)
+      park();
+
     long long spin_until = -1;
     while(true) {
       uint32_t state_val = manager->worker_state.load_acquire();
@@ -126,6 +164,15 @@ namespace Realm {
         }
       }
 
+      // an idle worker from a grown pool parks (leaving the pool) instead of
+      //  sleeping, once things have been quiet for long enough
+      if(scalable && manager->attempt_park_worker()) {
+        if(!park())
+          break; // shutdown raced with us
+        spin_until = -1;
+        continue;
+      }
+
       // all other options exhausted - try to increment sleeping worker
       //   count, but only if nothing has changed (false conflicts with
       //   other workers going to sleep aren't a big deal)
@@ -167,6 +214,13 @@ namespace Realm {
   BackgroundWorkManager::BackgroundWorkManager(void)
     : num_work_items(0)
     , worker_state(0)
+    , active_worker_count(0)
+    , last_scale_time(0)
+    , last_saturated_time(0)
+    , total_grow_events(0)
+    , total_shrink_events(0)
+    , total_saturation_events(0)
+    , total_timelimit_overruns(0)
   {
     for(unsigned i = 0; i < BITMASK_ARRAY_SIZE; i++)
       active_work_item_mask[i].store(0);
@@ -256,6 +310,68 @@ namespace Realm {
         // try to release mutex, but loop in case work was delegated to us
         act_pops = db_mutex.attempt_exit(tstate);
       }
+    } else if(cfg.max_workers > cfg.generic_workers) {
+      // nobody to wake - every unparked worker is busy, which is the
+      //  saturation signal for adaptive pool growth
+      long long now = Clock::current_time_in_nanoseconds(true /*absolute*/);
+      last_saturated_time.store(now);
+      total_saturation_events.fetch_add(1);
+      maybe_grow_workers(now);
+    }
+  }
+
+  bool BackgroundWorkManager::attempt_park_worker(void)
+  {
+    if(cfg.max_workers <= cfg.generic_workers)
+      return false;
+
+    // hysteresis - don't shrink unless things have been quiet for a while
+    long long now = Clock::current_time_in_nanoseconds(true /*absolute*/);
+    long long quiet_for = 8 * cfg.scale_interval;
+    if(((now - last_saturated_time.load()) < quiet_for) ||
+       ((now - last_scale_time.load()) < quiet_for))
+      return false;
+
+    // never shrink the pool below the configured baseline
+    unsigned count = active_worker_count.load();
+    while(count > cfg.generic_workers) {
+      if(active_worker_count.compare_exchange(count, count - 1)) {
+        last_scale_time.store(now);
+        total_shrink_events.fetch_add(1);
+        log_bgwork.info() << "worker pool shrink: manager=" << this
+                          << " active=" << (count - 1);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void BackgroundWorkManager::maybe_grow_workers(long long now)
+  {
+    // rate-limit growth, and use the CAS on the timestamp to pick a single
+    //  grower when many advertisers see saturation at once
+    long long last = last_scale_time.load();
+    if((now - last) < cfg.scale_interval)
+      return;
+    if(active_worker_count.load() >= cfg.max_workers)
+      return;
+    if(!last_scale_time.compare_exchange(last, now))
+      return;
+
+    Doorbell *db = 0;
+    {
+      AutoLock<> al(mutex);
+      if(!parked_workers.empty()) {
+        db = parked_workers.back();
+        parked_workers.pop_back();
+      }
+    }
+    if(db) {
+      unsigned count = active_worker_count.fetch_add(1) + 1;
+      total_grow_events.fetch_add(1);
+      log_bgwork.info() << "worker pool grow: manager=" << this
+                        << " active=" << count;
+      db->notify(0);
     }
   }
 
@@ -268,7 +384,9 @@ namespace Realm {
         .add_option_int("-ll:bgnumapin", cfg.pin_numa)
         .add_option_int("-ll:bgstack", cfg.worker_stacksize_in_kb)
         .add_option_int("-ll:bgspin", cfg.worker_spin_interval)
-        .add_option_int("-ll:bgslice", cfg.work_item_timeslice);
+        .add_option_int("-ll:bgslice", cfg.work_item_timeslice)
+        .add_option_int("-ll:bgworkmax", cfg.max_workers)
+        .add_option_int("-ll:bgscaleint", cfg.scale_interval);
 
     bool ok = cp.parse_command_line(cmdline);
     assert(ok);
@@ -276,13 +394,20 @@ namespace Realm {
 
   void BackgroundWorkManager::start_dedicated_workers(Realm::CoreReservationSet& crs)
   {
-    for(unsigned i = 0; i < cfg.generic_workers; i++)
+    // with adaptive scaling enabled, the extra workers are created up front
+    //  (core reservations can't be made later) but start parked
+    unsigned total_generic = std::max(cfg.generic_workers, cfg.max_workers);
+    bool scalable = (cfg.max_workers > cfg.generic_workers);
+    active_worker_count.store(cfg.generic_workers);
+    for(unsigned i = 0; i < total_generic; i++)
       dedicated_workers.push_back(new BackgroundWorkThread(this,
 							   crs,
 							   stringbuilder() << "dedicated worker (generic) #" << (i + 1),
 							   -1, // numa
 							   cfg.pin_generic,
-							   cfg.worker_stacksize_in_kb << 10));
+							   cfg.worker_stacksize_in_kb << 10,
+							   scalable,
+							   (i >= cfg.generic_workers)));
 
     if(cfg.per_numa_workers > 0) {
       std::map<int, NumaNodeCpuInfo> cpuinfo;
@@ -317,6 +442,25 @@ namespace Realm {
     // set flag and signal any sleeping workers
     uint32_t prev_state = worker_state.fetch_or(STATE_SHUTDOWN_BIT);
 
+    // parked workers get woken directly - any worker that parks after the
+    //  bit is set will see it before waiting (see BackgroundWorkThread::park)
+    {
+      std::vector<Doorbell *> to_wake;
+      {
+        AutoLock<> al(mutex);
+        to_wake.swap(parked_workers);
+      }
+      for(Doorbell *db : to_wake)
+        db->notify(0);
+    }
+
+    if(cfg.max_workers > cfg.generic_workers)
+      log_bgwork.info() << "adaptive worker scaling: manager=" << this
+                        << " grows=" << total_grow_events.load()
+                        << " shrinks=" << total_shrink_events.load()
+                        << " saturations=" << total_saturation_events.load()
+                        << " overruns=" << total_timelimit_overruns.load();
+
     // use CAS to actually claim workers since work advertisers might get
     //   some of them
     while(true) {
@@ -627,6 +771,22 @@ namespace Realm {
 	                           0);
 	  log_bgwork.print() << "work: slot=" << slot << " elapsed=" << elapsed << " overshoot=" << overshoot;
 #endif
+          // when adaptive scaling is on, note timeslice overruns - an item
+          //  that blows through its quantum delays everything else sharing
+          //  this worker, so treat it like saturation if work is pending
+          if(manager->cfg.max_workers > manager->cfg.generic_workers) {
+            long long t_now = Clock::current_time_in_nanoseconds(true /*absolute*/);
+            if(t_now > t_quantum) {
+              manager->total_timelimit_overruns.fetch_add(1);
+              manager->last_saturated_time.store(t_now);
+              uint32_t pending = ((manager->worker_state.load() >>
+                                   BackgroundWorkManager::STATE_ACTIVE_ITEMS_SHIFT) &
+                                  BackgroundWorkManager::STATE_ACTIVE_ITEMS_MASK);
+              if(pending != 0)
+                manager->maybe_grow_workers(t_now);
+            }
+          }
+
           // we're done with this slot for now
           manager->work_item_usecounts[slot].fetch_sub_acqrel(1);
 
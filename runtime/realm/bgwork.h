@@ -44,6 +44,14 @@ namespace Realm {
       size_t worker_stacksize_in_kb = 1024;
       long long worker_spin_interval = 0;
       long long work_item_timeslice = 100000;
+      // if larger than 'generic_workers', enables adaptive scaling of the
+      //  generic worker pool: extra workers start parked and are unparked
+      //  when the active pool is saturated, then re-parked once demand
+      //  subsides - the pool never shrinks below 'generic_workers'
+      unsigned max_workers = 0;
+      // minimum time (in ns) between pool growth actions - shrinking uses a
+      //  multiple of this for hysteresis
+      long long scale_interval = 2000000;
     };
 
     void configure_from_cmdline(std::vector<std::string>& cmdline);
@@ -121,6 +129,18 @@ namespace Realm {
     DoorbellList db_list;
 
     std::vector<BackgroundWorkThread *> dedicated_workers;
+
+    // adaptive scaling of the generic worker pool (see cfg.max_workers) -
+    //  parked workers are distinct from sleeping ones in that they are not
+    //  eligible for wakeup by 'advertise_work'
+    bool attempt_park_worker(void);
+    void maybe_grow_workers(long long now);
+
+    atomic<unsigned> active_worker_count;
+    atomic<long long> last_scale_time, last_saturated_time;
+    atomic<uint64_t> total_grow_events, total_shrink_events;
+    atomic<uint64_t> total_saturation_events, total_timelimit_overruns;
+    std::vector<Doorbell *> parked_workers; // protected by 'mutex'
   };
 
   class REALM_INTERNAL_API_EXTERNAL_LINKAGE BackgroundWorkItem {
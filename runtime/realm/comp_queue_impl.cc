@@ -376,7 +376,7 @@ namespace Realm {
   {
     AutoLock<> al(mutex);
     if(resizable) {
-      assert(cur_events == 0);
+      assert(cur_events.load() == 0);
     } else {
       assert(wr_ptr.load() == consume_ptr.load());
     }
@@ -385,7 +385,7 @@ namespace Realm {
     pending_events.store(0);
     commit_ptr.store(0);
     consume_ptr.store(0);
-    cur_events = 0;
+    cur_events.store(0);
     resizable = _resizable;
     // round up to a power of 2 for easy modulo arithmetic
     max_events = 1;
@@ -475,9 +475,9 @@ namespace Realm {
 
   Event CompQueueImpl::get_local_progress_event(void)
   {
-    // non-resizable queues can observe a non-empty queue and return NO_EVENT
-    //  without taking the lock
-    if(!resizable && (rd_ptr.load() < commit_ptr.load())) {
+    // an observably non-empty queue can return NO_EVENT without taking
+    //  the lock
+    if(resizable ? (cur_events.load() > 0) : (rd_ptr.load() < commit_ptr.load())) {
       return Event::NO_EVENT;
     }
 
@@ -487,7 +487,7 @@ namespace Realm {
       // now that we hold the lock, check emptiness consistent with progress
       //  event information
       if(resizable) {
-        if(cur_events > 0) {
+        if(cur_events.load() > 0) {
           assert(local_progress_event == 0);
           return Event::NO_EVENT;
         }
@@ -524,15 +524,15 @@ namespace Realm {
     // if queue is non-empty, we'll just immediately trigger the event
     bool immediate_trigger = false;
 
-    // non-resizable queues can check without even taking the lock
-    if(!resizable && (rd_ptr.load() < commit_ptr.load())) {
+    // an observably non-empty queue can be checked without taking the lock
+    if(resizable ? (cur_events.load() > 0) : (rd_ptr.load() < commit_ptr.load())) {
       immediate_trigger = true;
     } else {
       AutoLock<> al(mutex);
       // now that we hold the lock, check emptiness consistent with progress
       //  event information
       if(resizable) {
-        if(cur_events > 0) {
+        if(cur_events.load() > 0) {
           immediate_trigger = true;
         }
       } else {
@@ -562,9 +562,14 @@ namespace Realm {
   size_t CompQueueImpl::pop_events(Event *events, size_t max_to_pop)
   {
     if(resizable) {
+      // lock-free early out so that polling an empty queue from many
+      //  threads doesn't serialize on the mutex
+      if((cur_events.load() == 0) || (max_to_pop == 0))
+        return 0;
       AutoLock<> al(mutex);
-      if((cur_events > 0) && (max_to_pop > 0)) {
-        size_t count = std::min(cur_events, max_to_pop);
+      size_t avail = cur_events.load();
+      if((avail > 0) && (max_to_pop > 0)) {
+        size_t count = std::min(avail, max_to_pop);
 
         // get current offset and advance pointer
         size_t rd_ofs = rd_ptr.fetch_add(count) & (max_events - 1);
@@ -582,7 +587,7 @@ namespace Realm {
           }
         }
 
-        cur_events -= count;
+        cur_events.fetch_sub(count);
 
         return count;
       } else
@@ -648,28 +653,29 @@ namespace Realm {
     if(resizable) {
       AutoLock<> al(mutex);
       // check for overflow
-      if(cur_events >= max_events) {
+      size_t num_events = cur_events.load();
+      if(num_events >= max_events) {
         // should detect it precisely
-        assert(cur_events == max_events);
+        assert(num_events == max_events);
         size_t new_size = max_events * 2;
         std::unique_ptr<Event[]> new_events = std::make_unique<Event[]>(new_size);
         size_t rd_ofs = rd_ptr.load() & (max_events - 1);
         if(rd_ofs > 0) {
           // most cases wrap around
           memcpy(new_events.get(), completed_events.get() + rd_ofs,
-                 (cur_events - rd_ofs) * sizeof(Event));
-          memcpy(new_events.get() + (cur_events - rd_ofs), completed_events.get(),
+                 (num_events - rd_ofs) * sizeof(Event));
+          memcpy(new_events.get() + (num_events - rd_ofs), completed_events.get(),
                  rd_ofs * sizeof(Event));
         } else {
-          memcpy(new_events.get(), completed_events.get(), cur_events * sizeof(Event));
+          memcpy(new_events.get(), completed_events.get(), num_events * sizeof(Event));
         }
         completed_events = std::move(new_events);
         rd_ptr.store(0);
-        wr_ptr.store(cur_events);
+        wr_ptr.store(num_events);
         max_events = new_size;
       }
 
-      cur_events++;
+      cur_events.fetch_add(1);
       if(waiter != 0) {
         pending_events.fetch_sub(1);
         // add waiter to free list for reuse
@@ -115,7 +115,9 @@ namespace Realm {
 
     atomic<size_t> commit_ptr = atomic<size_t>(0);
     atomic<size_t> consume_ptr = atomic<size_t>(0);
-    size_t cur_events = 0;
+    // mutated only while holding the mutex, but read without it by pollers
+    //  of resizable queues
+    atomic<size_t> cur_events = atomic<size_t>(0);
 
     std::unique_ptr<Event[]> completed_events = nullptr;
 
@@ -154,6 +154,8 @@ namespace Realm {
       unsigned fabric_clique = -1U;
       CUuuid fabric_uuid = {0};
       bool pageable_access_supported = false;
+      // whether cuStreamWaitValue32 and friends can be used on this device
+      bool stream_mem_ops_supported = false;
 
 #ifdef REALM_USE_CUDART_HIJACK
       cudaDeviceProp prop;
@@ -223,6 +225,7 @@ namespace Realm {
 
     protected:
       static void cuda_callback(CUstream stream, CUresult res, void *data);
+      static void cuda_hostfn(void *data);
       GPU *gpu = nullptr;
     };
 
@@ -240,6 +243,7 @@ namespace Realm {
 
     protected:
       static void cuda_start_callback(CUstream stream, CUresult res, void *data);
+      static void cuda_start_hostfn(void *data);
     };
 
     // a class that represents a CUDA stream and work associated with
@@ -415,6 +419,8 @@ namespace Realm {
       GPUStream *get_null_task_stream(void) const;
       GPUStream *get_next_task_stream(bool create = false);
       GPUStream *get_next_d2d_stream();
+      GPUStream *get_next_h2d_stream();
+      GPUStream *get_next_d2h_stream();
 
       void launch_batch_affine_fill_kernel(void *fill_info, size_t dim, size_t elemSize,
                                            size_t volume, GPUStream *stream);
@@ -430,6 +436,12 @@ namespace Realm {
       bool is_accessible_host_mem(const MemoryImpl *mem) const;
       bool is_accessible_gpu_mem(const MemoryImpl *mem) const;
 
+      // attempts to enqueue a device-side wait for 'event' on 'stream' using
+      //  stream memory operations - returns false if the driver/device lacks
+      //  support (or the flag pool is exhausted) and the caller must fall
+      //  back to waiting on the host
+      bool enqueue_device_wait(GPUStream *stream, Event event);
+
       bool register_reduction(ReductionOpID redop_id, CUfunction apply_excl,
                               CUfunction apply_nonexcl, CUfunction fold_excl,
                               CUfunction fold_nonexcl);
@@ -490,18 +502,30 @@ namespace Realm {
       std::set<Memory> peer_fbs;
 
       // streams for different copy types and a pile for actual tasks
-      GPUStream *host_to_device_stream = nullptr;
-      GPUStream *device_to_host_stream = nullptr;
       GPUStream *device_to_device_stream = nullptr;
+      std::vector<GPUStream *> host_to_device_streams;
+      std::vector<GPUStream *> device_to_host_streams;
       std::vector<GPUStream *> device_to_device_streams;
       std::vector<GPUStream *> peer_to_peer_streams; // indexed by target
       std::vector<GPUStream *> task_streams;
       atomic<unsigned> next_task_stream = atomic<unsigned>(0);
       atomic<unsigned> next_d2d_stream = atomic<unsigned>(0);
+      atomic<unsigned> next_h2d_stream = atomic<unsigned>(0);
+      atomic<unsigned> next_d2h_stream = atomic<unsigned>(0);
       size_t cupti_activity_refcount = 0;
 
       GPUEventPool event_pool;
 
+      // a small pool of device-visible 32-bit flags used for device-side
+      //  waits on realm events - the host sets a flag when the event
+      //  triggers and a stream waits on it with cuStreamWaitValue32,
+      //  avoiding a host hop between dependent pieces of gpu work
+      static const unsigned NUM_DEVICE_WAIT_FLAGS = 256;
+      Mutex device_wait_mutex;
+      atomic<uint32_t> *device_wait_flags_cpu = nullptr;
+      CUdeviceptr device_wait_flags_gpu = 0;
+      std::vector<unsigned> device_wait_free_list;
+
       // this can technically be different in each context (but probably isn't
       //  in practice)
       int least_stream_priority, greatest_stream_priority;
@@ -1377,6 +1401,7 @@ namespace Realm {
   __op__(cuMemExportToShareableHandle, CUDA_VERSION);                                    \
   __op__(cuMemImportFromShareableHandle, CUDA_VERSION);                                  \
   __op__(cuStreamWaitEvent, CUDA_VERSION);                                               \
+  __op__(cuStreamWaitValue32, CUDA_VERSION);                                             \
   __op__(cuStreamQuery, CUDA_VERSION);                                                   \
   __op__(cuMemGetAddressRange, CUDA_VERSION);                                            \
   __op__(cuPointerGetAttributes, CUDA_VERSION);                                          \
@@ -460,7 +460,15 @@ namespace Realm {
     void GPUWorkFence::enqueue_on_stream(GPUStream *stream)
     {
       if(stream->get_gpu()->module->config->cfg_fences_use_callbacks) {
-	CHECK_CU( CUDA_DRIVER_FNPTR(cuStreamAddCallback)(stream->get_stream(), &cuda_callback, (void *)this, 0) );
+	// prefer cuLaunchHostFunc when the driver has it - unlike the
+	//  deprecated cuStreamAddCallback, it does not serialize the rest
+	//  of the stream behind the host-side work, so back-to-back small
+	//  tasks' kernels keep flowing while fences are signaled
+	if(CUDA_DRIVER_HAS_FNPTR(cuLaunchHostFunc)) {
+	  CHECK_CU( CUDA_DRIVER_FNPTR(cuLaunchHostFunc)(stream->get_stream(), &cuda_hostfn, (void *)this) );
+	} else {
+	  CHECK_CU( CUDA_DRIVER_FNPTR(cuStreamAddCallback)(stream->get_stream(), &cuda_callback, (void *)this, 0) );
+	}
       } else {
 	stream->add_fence(this);
       }
@@ -474,6 +482,13 @@ namespace Realm {
       me->mark_finished(true /*succesful*/);
     }
 
+    /*static*/ void GPUWorkFence::cuda_hostfn(void *data)
+    {
+      GPUWorkFence *me = (GPUWorkFence *)data;
+
+      me->mark_finished(true /*succesful*/);
+    }
+
     ////////////////////////////////////////////////////////////////////////
     //
     // class GPUWorkStart
@@ -490,7 +505,13 @@ namespace Realm {
     void GPUWorkStart::enqueue_on_stream(GPUStream *stream)
     {
       if(stream->get_gpu()->module->config->cfg_fences_use_callbacks) {
-	CHECK_CU( CUDA_DRIVER_FNPTR(cuStreamAddCallback)(stream->get_stream(), &cuda_start_callback, (void *)this, 0) );
+	// see GPUWorkFence::enqueue_on_stream for why cuLaunchHostFunc is
+	//  preferred over cuStreamAddCallback when available
+	if(CUDA_DRIVER_HAS_FNPTR(cuLaunchHostFunc)) {
+	  CHECK_CU( CUDA_DRIVER_FNPTR(cuLaunchHostFunc)(stream->get_stream(), &cuda_start_hostfn, (void *)this) );
+	} else {
+	  CHECK_CU( CUDA_DRIVER_FNPTR(cuStreamAddCallback)(stream->get_stream(), &cuda_start_callback, (void *)this, 0) );
+	}
       } else {
 	stream->add_start_event(this);
       }
@@ -510,6 +531,13 @@ namespace Realm {
       me->mark_gpu_work_start();
     }
 
+    /*static*/ void GPUWorkStart::cuda_start_hostfn(void *data)
+    {
+      GPUWorkStart *me = (GPUWorkStart *)data;
+      // record the real start time for the operation
+      me->mark_gpu_work_start();
+    }
+
     ////////////////////////////////////////////////////////////////////////
     //
     // class GPUEventPool
@@ -1063,6 +1091,20 @@ namespace Realm {
       return device_to_device_streams[d2d_stream_index];
     }
 
+    GPUStream *GPU::get_next_h2d_stream()
+    {
+      unsigned h2d_stream_index = (next_h2d_stream.fetch_add(1) %
+                                   module->config->cfg_h2d_streams);
+      return host_to_device_streams[h2d_stream_index];
+    }
+
+    GPUStream *GPU::get_next_d2h_stream()
+    {
+      unsigned d2h_stream_index = (next_d2h_stream.fetch_add(1) %
+                                   module->config->cfg_d2h_streams);
+      return device_to_host_streams[d2h_stream_index];
+    }
+
     static void launch_kernel(const Realm::Cuda::GPU::GPUFuncInfo &func_info, void *params,
                               size_t num_elems, GPUStream *stream)
     {
@@ -2055,8 +2097,32 @@ namespace Realm {
 
       event_pool.init_pool();
 
-      host_to_device_stream = new GPUStream(this, worker);
-      device_to_host_stream = new GPUStream(this, worker);
+      // allocate the flag pool for device-side event waits if the device
+      //  supports stream memory operations
+      if(info->stream_mem_ops_supported && CUDA_DRIVER_HAS_FNPTR(cuStreamWaitValue32)) {
+        GPUAllocation *alloc = GPUAllocation::allocate_host(
+            this, NUM_DEVICE_WAIT_FLAGS * sizeof(uint32_t), false /*!peer_enabled*/,
+            false /*!shareable*/);
+        if(alloc != nullptr) {
+          memset(alloc->get_hptr(), 0, NUM_DEVICE_WAIT_FLAGS * sizeof(uint32_t));
+          device_wait_flags_cpu =
+              reinterpret_cast<atomic<uint32_t> *>(alloc->get_hptr());
+          device_wait_flags_gpu = alloc->get_dptr();
+          device_wait_free_list.resize(NUM_DEVICE_WAIT_FLAGS);
+          for(unsigned i = 0; i < NUM_DEVICE_WAIT_FLAGS; i++)
+            device_wait_free_list[i] = i;
+        }
+      }
+
+      host_to_device_streams.resize(module->config->cfg_h2d_streams, 0);
+      for(unsigned i = 0; i < module->config->cfg_h2d_streams; i++) {
+        host_to_device_streams[i] = new GPUStream(this, worker);
+      }
+
+      device_to_host_streams.resize(module->config->cfg_d2h_streams, 0);
+      for(unsigned i = 0; i < module->config->cfg_d2h_streams; i++) {
+        device_to_host_streams[i] = new GPUStream(this, worker);
+      }
 
       CUdevice dev;
       int numSMs;
@@ -2175,8 +2241,8 @@ namespace Realm {
       event_pool.empty_pool();
 
       // destroy streams
-      delete host_to_device_stream;
-      delete device_to_host_stream;
+      delete_container_contents(host_to_device_streams);
+      delete_container_contents(device_to_host_streams);
 
       delete_container_contents(device_to_device_streams);
 
@@ -2218,6 +2284,87 @@ namespace Realm {
           .first->second;
     }
 
+    // host-side helpers for device-side event waits: the waiter releases
+    //  the flag the stream is spinning on once the realm event triggers,
+    //  and the notification recycles the flag once the stream has moved
+    //  past the wait
+    class GPUDeviceWaitRelease : public EventWaiter {
+    public:
+      GPUDeviceWaitRelease(GPU *_gpu, unsigned _index, Event _event)
+        : gpu(_gpu), index(_index), event(_event)
+      {}
+
+      virtual void event_triggered(bool poisoned, TimeLimit work_until)
+      {
+        // a poisoned precondition still has to release the device-side
+        //  wait - poison propagation remains the caller's responsibility
+        gpu->device_wait_flags_cpu[index].store_release(1);
+        delete this;
+      }
+
+      virtual void print(std::ostream &os) const
+      {
+        os << "device-side event wait: gpu=" << gpu << " flag=" << index
+           << " event=" << event;
+      }
+
+      virtual Event get_finish_event(void) const { return Event::NO_EVENT; }
+
+    protected:
+      GPU *gpu;
+      unsigned index;
+      Event event;
+    };
+
+    class GPUDeviceWaitReclaim : public GPUCompletionNotification {
+    public:
+      GPUDeviceWaitReclaim(GPU *_gpu, unsigned _index)
+        : gpu(_gpu), index(_index)
+      {}
+
+      virtual void request_completed(void)
+      {
+        // the stream is past the wait, so the flag can be rearmed and
+        //  made available to another wait
+        gpu->device_wait_flags_cpu[index].store(0);
+        {
+          AutoLock<> al(gpu->device_wait_mutex);
+          gpu->device_wait_free_list.push_back(index);
+        }
+        delete this;
+      }
+
+    protected:
+      GPU *gpu;
+      unsigned index;
+    };
+
+    bool GPU::enqueue_device_wait(GPUStream *stream, Event event)
+    {
+      if(device_wait_flags_cpu == nullptr)
+        return false;
+      unsigned index;
+      {
+        AutoLock<> al(device_wait_mutex);
+        // too many waits in flight - make the caller fall back to the host
+        if(device_wait_free_list.empty())
+          return false;
+        index = device_wait_free_list.back();
+        device_wait_free_list.pop_back();
+      }
+      CHECK_CU(CUDA_DRIVER_FNPTR(cuStreamWaitValue32)(
+          stream->get_stream(), device_wait_flags_gpu + (index * sizeof(uint32_t)),
+          1 /*value*/, CU_STREAM_WAIT_VALUE_GEQ));
+      log_stream.debug() << "device-side wait enqueued: stream=" << stream->get_stream()
+                         << " event=" << event << " flag=" << index;
+      // reclaim the flag once the stream is past the wait
+      stream->add_notification(new GPUDeviceWaitReclaim(this, index));
+      // and release the wait when the event triggers (which may be
+      //  immediately if the event managed to trigger in the meantime)
+      EventImpl::add_waiter(event, new GPUDeviceWaitRelease(this, index, event));
+      return true;
+    }
+
     void GPU::create_processor(RuntimeImpl *runtime, size_t stack_size)
     {
       Processor p = runtime->next_local_processor_id();
@@ -2530,6 +2677,8 @@ namespace Realm {
       config_map.insert({"dynfb_max_size", &cfg_dynfb_max_size});
       config_map.insert({"task_streams", &cfg_task_streams});
       config_map.insert({"d2d_streams", &cfg_d2d_streams});
+      config_map.insert({"h2d_streams", &cfg_h2d_streams});
+      config_map.insert({"d2h_streams", &cfg_d2h_streams});
 
       resource_map.insert({"gpu", &res_num_gpus});
       resource_map.insert({"fbmem", &res_min_fbmem_size});
@@ -2579,6 +2728,8 @@ namespace Realm {
           .add_option_string("-ll:gpu_ids", cfg_gpu_idxs)
           .add_option_int("-ll:streams", cfg_task_streams)
           .add_option_int("-ll:d2d_streams", cfg_d2d_streams)
+          .add_option_int("-ll:h2d_streams", cfg_h2d_streams)
+          .add_option_int("-ll:d2h_streams", cfg_d2h_streams)
           .add_option_int("-ll:d2d_priority", cfg_d2d_stream_priority)
           .add_option_int("-ll:gpuworkthread", cfg_use_worker_threads)
           .add_option_int("-ll:gpuworker", cfg_use_shared_worker)
@@ -3173,6 +3324,14 @@ namespace Realm {
           CUDA_DRIVER_FNPTR(cuDeviceGetAttribute)
           (&attribute_value, CU_DEVICE_ATTRIBUTE_PAGEABLE_MEMORY_ACCESS, info->device);
           info->pageable_access_supported = !!attribute_value;
+#if CUDA_VERSION >= 11070
+          // stream memory operations are always available with 11.7+ drivers
+          info->stream_mem_ops_supported = true;
+#else
+          CUDA_DRIVER_FNPTR(cuDeviceGetAttribute)
+          (&attribute_value, CU_DEVICE_ATTRIBUTE_CAN_USE_STREAM_MEM_OPS, info->device);
+          info->stream_mem_ops_supported = !!attribute_value;
+#endif
           // Assume x16 PCI-e 2.0 = 8000 MB/s, which is reasonable for most
           // systems
           info->pci_bandwidth = 8000;
@@ -4085,6 +4244,33 @@ namespace Realm {
       return realm_event;
     }
 
+    bool CudaModule::stream_wait_on_event(CUstream_st *cuda_stream, Event event)
+    {
+      bool poisoned = false;
+      if(event.has_triggered_faultaware(poisoned)) {
+        // nothing to wait for (a poisoned event is the caller's problem)
+        return true;
+      }
+      // fast path: a task asking for a wait on its own stream
+      GPUStream *stream = nullptr;
+      if((ThreadLocal::current_gpu_stream != nullptr) &&
+         (ThreadLocal::current_gpu_stream->get_stream() == cuda_stream)) {
+        stream = ThreadLocal::current_gpu_stream;
+      } else {
+        // otherwise see if it's any other stream realm knows how to track
+        for(GPU *gpu : gpus) {
+          stream = gpu->find_stream(cuda_stream);
+          if(stream != nullptr) {
+            break;
+          }
+        }
+      }
+      if(stream == nullptr) {
+        return false;
+      }
+      return stream->get_gpu()->enqueue_device_wait(stream, event);
+    }
+
     bool CudaModule::get_cuda_device_uuid(Processor p, Uuid *uuid) const
     {
       for(const GPU *gpu : gpus) {
@@ -99,6 +99,13 @@ namespace Realm {
 
     REALM_PUBLIC_API bool get_cuda_device_id(Processor p, int *device);
 
+    // asks the CUDA module to make the given (Realm-managed) stream wait
+    //  device-side for a realm event before executing any work subsequently
+    //  placed on it - a false return means device-side waits are unavailable
+    //  (unsupported device/driver or untracked stream) and the caller must
+    //  wait on the host (e.g. event.wait()) instead
+    REALM_PUBLIC_API bool stream_wait_on_event(CUstream_st *stream, Event event);
+
     class GPU;
     class GPUWorker;
     struct GPUInfo;
@@ -125,6 +132,10 @@ namespace Realm {
       int cfg_num_gpus = 0;
       std::string cfg_gpu_idxs;
       unsigned cfg_task_streams = 12, cfg_d2d_streams = 4;
+      // number of streams to spread host<->device copies across - modern
+      //  parts have several copy engines per direction, so one stream per
+      //  direction leaves aggregate copy bandwidth on the table
+      unsigned cfg_h2d_streams = 4, cfg_d2h_streams = 4;
       bool cfg_use_worker_threads = false, cfg_use_shared_worker = true, cfg_pin_sysmem = true;
       bool cfg_fences_use_callbacks = false;
       bool cfg_suppress_hijack_warning = false;
@@ -216,6 +227,17 @@ namespace Realm {
       /// \p cuda_stream completes
       Event make_realm_event(CUstream_st *cuda_stream);
 
+      /// @brief Enqueues a device-side wait on the given \p cuda_stream that
+      /// holds back any work subsequently placed on the stream until
+      /// \p event has triggered, without a return trip through the host
+      /// @param cuda_stream The cuda stream that should wait for \p event -
+      /// must be a stream managed by Realm (e.g. a task stream)
+      /// @param event The Realm::Event the stream must wait for
+      /// @return True if the wait was enqueued (or the event had already
+      /// triggered), false if device-side waits are unavailable and the
+      /// caller must wait on the host instead
+      bool stream_wait_on_event(CUstream_st *cuda_stream, Event event);
+
       bool get_cuda_device_uuid(Processor p, Uuid *uuid) const;
 
       bool get_cuda_device_id(Processor p, int *device) const;
@@ -54,6 +54,20 @@ namespace Realm {
 	mod->set_task_ctxsync_required(is_required);
     }
 
+    // asks the CUDA module to make the given (Realm-managed) stream wait
+    //  device-side for a realm event before executing any work subsequently
+    //  placed on it - a false return means device-side waits are unavailable
+    //  and the caller must wait on the host (e.g. event.wait()) instead
+    inline bool stream_wait_on_event(CUstream_st *stream, Event event)
+    {
+      CudaModule *mod = Runtime::get_runtime().get_module<CudaModule>("cuda");
+      if(mod) {
+        return mod->stream_wait_on_event(stream, event);
+      } else {
+        return false;
+      }
+    }
+
     // fill in cuda related info according to CUDA-capable device associated with processor
     //  `p` if available and returns true, or returns false if processor is unknown,
     //  not associated with a CUDA-capable device, or information is unavailable
@@ -22,11 +22,27 @@
 #include "realm/deppart/inst_helper.h"
 #include "realm/logging.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace Realm {
 
   extern Logger log_part;
   extern Logger log_uop_timing;
 
+  namespace {
+    // detect whether a field type can be compared with operator<= -
+    //  ByFieldMicroOp is also instantiated with Point<N2,T2> field types
+    //  (for image/preimage-style operations), which have no ordering
+    template <typename FT, typename = void>
+    struct is_range_comparable : public std::false_type {};
+
+    template <typename FT>
+    struct is_range_comparable<FT, std::void_t<decltype(std::declval<FT>() <=
+                                                        std::declval<FT>())> >
+      : public std::true_type {};
+  };
+
 
   template <int N, typename T>
   template <typename FT>
@@ -113,6 +129,24 @@ namespace Realm {
   {
     // for now, one access for the whole instance
     AffineAccessor<FT,N,T> a_data(inst, field_offset);
+    const size_t stride0 = a_data.strides[0];
+
+    // the field data can contain values beyond the ones the caller asked
+    //  for (i.e. the requested colors) - don't waste time and memory
+    //  accumulating rectangles for values that would just be thrown away
+    //  when the results are contributed
+    auto value_wanted = [&](FT v) -> bool {
+      if(!value_set.empty())
+	return (value_set.count(v) > 0);
+      // range filtering only exists for field types with an ordering -
+      //  point-typed fields (e.g. from create_association) have no
+      //  operator<= and never set a value range
+      if constexpr(is_range_comparable<FT>::value) {
+	if(value_range_valid)
+	  return ((range_lo <= v) && (v <= range_hi));
+      }
+      return true;
+    };
 
     // double iteration - use the instance's space first, since it's probably smaller
     for(IndexSpaceIterator<N,T> it(inst_space); it.valid; it.step()) {
@@ -120,30 +154,38 @@ namespace Realm {
 	const Rect<N,T>& r = it2.rect;
 	Point<N,T> p = r.lo;
 	while(true) {
-	  FT val = a_data.read(p);
+	  // walk a raw pointer along the dim-0 span rather than redoing the
+	  //  affine offset arithmetic for every point
+	  const char *elem = reinterpret_cast<const char *>(a_data.ptr(p));
+	  FT val = *reinterpret_cast<const FT *>(elem);
 	  Point<N,T> p2 = p;
           while(p2[0] < r.hi[0]) {
             Point<N, T> p3 = p2;
             p3[0]++;
-            FT val2 = a_data.read(p3);
+            elem += stride0;
+            FT val2 = *reinterpret_cast<const FT *>(elem);
             if(val != val2) {
               // record old strip
-              BM *&bmp = bitmasks[val];
-              if(!bmp)
-                bmp = new BM;
-              bmp->add_rect(Rect<N, T>(p, p2));
-              // std::cout << val << ": " << p << ".." << p2 << std::endl;
+              if(value_wanted(val)) {
+                BM *&bmp = bitmasks[val];
+                if(!bmp)
+                  bmp = new BM;
+                bmp->add_rect(Rect<N, T>(p, p2));
+                // std::cout << val << ": " << p << ".." << p2 << std::endl;
+              }
               val = val2;
               p = p3;
             }
             p2 = p3;
           }
           // record whatever strip we have at the end
-          BM *&bmp = bitmasks[val];
-          if(!bmp)
-            bmp = new BM;
-          bmp->add_rect(Rect<N, T>(p, p2));
-          // std::cout << val << ": " << p << ".." << p2 << std::endl;
+          if(value_wanted(val)) {
+            BM *&bmp = bitmasks[val];
+            if(!bmp)
+              bmp = new BM;
+            bmp->add_rect(Rect<N, T>(p, p2));
+            // std::cout << val << ": " << p << ".." << p2 << std::endl;
+          }
 
           // are we done?
           if(p2 == r.hi)
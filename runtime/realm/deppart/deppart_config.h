@@ -28,6 +28,7 @@ namespace Realm {
     extern bool cfg_disable_intersection_optimization;
     extern int cfg_max_rects_in_approximation;
     extern bool cfg_worker_threads_sleep;
+    extern int cfg_max_union_microop_inputs;
 
   };
 
@@ -152,6 +152,7 @@ namespace Realm {
   {
     // for now, one access for the whole instance
     AffineAccessor<Point<N,T>,N2,T2> a_data(inst, field_offset);
+    const size_t stride0 = a_data.strides[0];
 
     // double iteration - use the instance's space first, since it's probably smaller
     for(IndexSpaceIterator<N2,T2> it(inst_space); it.valid; it.step()) {
@@ -159,21 +160,40 @@ namespace Realm {
 	for(IndexSpaceIterator<N2,T2> it2(sources[i], it.rect); it2.valid; it2.step()) {
 	  BM **bmpp = 0;
 
-	  // iterate over each point in the source and see if it points into the parent space	  
-	  for(PointInRectIterator<N2,T2> pir(it2.rect); pir.valid; pir.step()) {
-	    Point<N,T> ptr = a_data.read(pir.p);
-
-	    if(parent_space.contains(ptr)) {
-              // optional filter
-              if(!diff_rhss.empty())
-                if(diff_rhss[i].contains(ptr)) {
-                  //std::cout << "point " << ptr << " filtered!\n";
-                  continue;
-                }
-	      //std::cout << "image " << i << "(" << sources[i] << ") -> " << pir.p << " -> " << ptr << std::endl;
-	      if(!bmpp) bmpp = &bitmasks[i];
-	      if(!*bmpp) *bmpp = new BM;
-	      (*bmpp)->add_point(ptr);
+	  // iterate over each point in the source and see if it points into
+	  //  the parent space - walk a raw pointer along each dim-0 span
+	  //  rather than redoing the affine offset arithmetic for every point
+	  Point<N2,T2> p = it2.rect.lo;
+	  while(true) {
+	    const char *elem = reinterpret_cast<const char *>(a_data.ptr(p));
+	    Point<N2,T2> p2 = p;
+	    while(true) {
+	      const Point<N,T>& ptr = *reinterpret_cast<const Point<N,T> *>(elem);
+
+	      if(parent_space.contains(ptr) &&
+		 (diff_rhss.empty() || !diff_rhss[i].contains(ptr))) {
+		//std::cout << "image " << i << "(" << sources[i] << ") -> " << p2 << " -> " << ptr << std::endl;
+		if(!bmpp) bmpp = &bitmasks[i];
+		if(!*bmpp) *bmpp = new BM;
+		(*bmpp)->add_point(ptr);
+	      }
+
+	      if(p2[0] >= it2.rect.hi[0]) break;
+	      p2[0]++;
+	      elem += stride0;
+	    }
+
+	    // are we done?
+	    if(p2 == it2.rect.hi) break;
+
+	    // now go to the next span, if there is one (can't be in 1-D)
+	    assert(N2 > 1);
+	    for(int j = 0; j < (N2 - 1); j++) {
+	      p[j] = it2.rect.lo[j];
+	      if(p[j + 1] < it2.rect.hi[j + 1]) {
+		p[j + 1] += 1;
+		break;
+	      }
 	    }
 	  }
 	}
@@ -234,17 +254,42 @@ namespace Realm {
   {
     // for now, one access for the whole instance
     AffineAccessor<Point<N,T>,N2,T2> a_data(inst, field_offset);
+    const size_t stride0 = a_data.strides[0];
     //std::cout << "a_data = " << a_data << "\n";
 
-    // simple image operation - project ever 
+    // simple image operation - project ever
     for(IndexSpaceIterator<N2,T2> it(inst_space); it.valid; it.step()) {
-      // iterate over each point in the source and mark what it touches
-      for(PointInRectIterator<N2,T2> pir(it.rect); pir.valid; pir.step()) {
-	Point<N,T> ptr = a_data.read(pir.p);
+      // iterate over each point in the source and mark what it touches -
+      //  walk a raw pointer along each dim-0 span rather than redoing the
+      //  affine offset arithmetic for every point
+      Point<N2,T2> p = it.rect.lo;
+      while(true) {
+	const char *elem = reinterpret_cast<const char *>(a_data.ptr(p));
+	Point<N2,T2> p2 = p;
+	while(true) {
+	  const Point<N,T>& ptr = *reinterpret_cast<const Point<N,T> *>(elem);
+
+	  // make sure to check for containment in the parent space
+	  if(parent_space.contains(ptr))
+	    bitmask.add_point(ptr);
+
+	  if(p2[0] >= it.rect.hi[0]) break;
+	  p2[0]++;
+	  elem += stride0;
+	}
+
+	// are we done?
+	if(p2 == it.rect.hi) break;
 
-	// make sure to check for containment in the parent space
-	if(parent_space.contains(ptr))
-	  bitmask.add_point(ptr);
+	// now go to the next span, if there is one (can't be in 1-D)
+	assert(N2 > 1);
+	for(int j = 0; j < (N2 - 1); j++) {
+	  p[j] = it.rect.lo[j];
+	  if(p[j + 1] < it.rect.hi[j + 1]) {
+	    p[j + 1] += 1;
+	    break;
+	  }
+	}
       }
     }
   }
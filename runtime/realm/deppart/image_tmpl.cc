@@ -26,15 +26,15 @@
 #endif
 
 #define FOREACH_TT(__func__) \
-  __func__(int,int) \
-  __func__(int,unsigned) \
-  __func__(int,long long) \
-  __func__(unsigned,int) \
-  __func__(unsigned,unsigned) \
-  __func__(unsigned,long long) \
-  __func__(long long,int) \
-  __func__(long long,unsigned) \
-  __func__(long long,long long)
+  REALM_CT_IF_INT_INT(__func__(int,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(int,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(int,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(unsigned,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(unsigned,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(unsigned,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(long long,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(long long,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(long long,long long))
 
 
 namespace Realm {
@@ -243,28 +243,28 @@ namespace Realm {
   __func__(1) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
 
 #elif REALM_MAX_DIM == 2
 
@@ -273,65 +273,65 @@ namespace Realm {
   __func__(2) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
 
 #elif REALM_MAX_DIM == 3
 
@@ -341,120 +341,120 @@ namespace Realm {
   __func__(3) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
 
 #elif REALM_MAX_DIM == 4
 
@@ -465,193 +465,193 @@ namespace Realm {
   __func__(4) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
-  __func__(4,int) \
-  __func__(4,unsigned) \
-  __func__(4,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
+  REALM_CT_IF_INT(__func__(4,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
-  __func__(4,int,int) \
-  __func__(4,int,bool) \
-  __func__(4,unsigned,int) \
-  __func__(4,unsigned,bool) \
-  __func__(4,long long,int) \
-  __func__(4,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
+  REALM_CT_IF_INT(__func__(4,int,int)) \
+  REALM_CT_IF_INT(__func__(4,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,int,4,int) \
-  __func__(1,int,4,unsigned) \
-  __func__(1,int,4,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,unsigned,4,int) \
-  __func__(1,unsigned,4,unsigned) \
-  __func__(1,unsigned,4,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
-  __func__(1,long long,4,int) \
-  __func__(1,long long,4,unsigned) \
-  __func__(1,long long,4,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,4,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,int,4,int) \
-  __func__(2,int,4,unsigned) \
-  __func__(2,int,4,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,unsigned,4,int) \
-  __func__(2,unsigned,4,unsigned) \
-  __func__(2,unsigned,4,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
-  __func__(2,long long,4,int) \
-  __func__(2,long long,4,unsigned) \
-  __func__(2,long long,4,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,4,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,int,4,int) \
-  __func__(3,int,4,unsigned) \
-  __func__(3,int,4,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,unsigned,4,int) \
-  __func__(3,unsigned,4,unsigned) \
-  __func__(3,unsigned,4,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
-  __func__(3,long long,4,int) \
-  __func__(3,long long,4,unsigned) \
-  __func__(3,long long,4,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,4,long long)) \
 \
-  __func__(4,int,1,int) \
-  __func__(4,int,1,unsigned) \
-  __func__(4,int,1,long long) \
-  __func__(4,int,2,int) \
-  __func__(4,int,2,unsigned) \
-  __func__(4,int,2,long long) \
-  __func__(4,int,3,int) \
-  __func__(4,int,3,unsigned) \
-  __func__(4,int,3,long long) \
-  __func__(4,int,4,int) \
-  __func__(4,int,4,unsigned) \
-  __func__(4,int,4,long long) \
-  __func__(4,unsigned,1,int) \
-  __func__(4,unsigned,1,unsigned) \
-  __func__(4,unsigned,1,long long) \
-  __func__(4,unsigned,2,int) \
-  __func__(4,unsigned,2,unsigned) \
-  __func__(4,unsigned,2,long long) \
-  __func__(4,unsigned,3,int) \
-  __func__(4,unsigned,3,unsigned) \
-  __func__(4,unsigned,3,long long) \
-  __func__(4,unsigned,4,int) \
-  __func__(4,unsigned,4,unsigned) \
-  __func__(4,unsigned,4,long long) \
-  __func__(4,long long,1,int) \
-  __func__(4,long long,1,unsigned) \
-  __func__(4,long long,1,long long) \
-  __func__(4,long long,2,int) \
-  __func__(4,long long,2,unsigned) \
-  __func__(4,long long,2,long long) \
-  __func__(4,long long,3,int) \
-  __func__(4,long long,3,unsigned) \
-  __func__(4,long long,3,long long) \
-  __func__(4,long long,4,int) \
-  __func__(4,long long,4,unsigned) \
-  __func__(4,long long,4,long long) \
+  REALM_CT_IF_INT_INT(__func__(4,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,4,long long)) \
 
 #elif REALM_MAX_DIM == 5
 
@@ -663,284 +663,284 @@ namespace Realm {
   __func__(5) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
-  __func__(4,int) \
-  __func__(4,unsigned) \
-  __func__(4,long long) \
-  __func__(5,int) \
-  __func__(5,unsigned) \
-  __func__(5,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
+  REALM_CT_IF_INT(__func__(4,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long)) \
+  REALM_CT_IF_INT(__func__(5,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
-  __func__(4,int,int) \
-  __func__(4,int,bool) \
-  __func__(4,unsigned,int) \
-  __func__(4,unsigned,bool) \
-  __func__(4,long long,int) \
-  __func__(4,long long,bool) \
-  __func__(5,int,int) \
-  __func__(5,int,bool) \
-  __func__(5,unsigned,int) \
-  __func__(5,unsigned,bool) \
-  __func__(5,long long,int) \
-  __func__(5,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
+  REALM_CT_IF_INT(__func__(4,int,int)) \
+  REALM_CT_IF_INT(__func__(4,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,bool)) \
+  REALM_CT_IF_INT(__func__(5,int,int)) \
+  REALM_CT_IF_INT(__func__(5,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,int,4,int) \
-  __func__(1,int,4,unsigned) \
-  __func__(1,int,4,long long) \
-  __func__(1,int,5,int) \
-  __func__(1,int,5,unsigned) \
-  __func__(1,int,5,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,unsigned,4,int) \
-  __func__(1,unsigned,4,unsigned) \
-  __func__(1,unsigned,4,long long) \
-  __func__(1,unsigned,5,int) \
-  __func__(1,unsigned,5,unsigned) \
-  __func__(1,unsigned,5,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
-  __func__(1,long long,4,int) \
-  __func__(1,long long,4,unsigned) \
-  __func__(1,long long,4,long long) \
-  __func__(1,long long,5,int) \
-  __func__(1,long long,5,unsigned) \
-  __func__(1,long long,5,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,5,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,int,4,int) \
-  __func__(2,int,4,unsigned) \
-  __func__(2,int,4,long long) \
-  __func__(2,int,5,int) \
-  __func__(2,int,5,unsigned) \
-  __func__(2,int,5,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,unsigned,4,int) \
-  __func__(2,unsigned,4,unsigned) \
-  __func__(2,unsigned,4,long long) \
-  __func__(2,unsigned,5,int) \
-  __func__(2,unsigned,5,unsigned) \
-  __func__(2,unsigned,5,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
-  __func__(2,long long,4,int) \
-  __func__(2,long long,4,unsigned) \
-  __func__(2,long long,4,long long) \
-  __func__(2,long long,5,int) \
-  __func__(2,long long,5,unsigned) \
-  __func__(2,long long,5,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,5,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,int,4,int) \
-  __func__(3,int,4,unsigned) \
-  __func__(3,int,4,long long) \
-  __func__(3,int,5,int) \
-  __func__(3,int,5,unsigned) \
-  __func__(3,int,5,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,unsigned,4,int) \
-  __func__(3,unsigned,4,unsigned) \
-  __func__(3,unsigned,4,long long) \
-  __func__(3,unsigned,5,int) \
-  __func__(3,unsigned,5,unsigned) \
-  __func__(3,unsigned,5,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
-  __func__(3,long long,4,int) \
-  __func__(3,long long,4,unsigned) \
-  __func__(3,long long,4,long long) \
-  __func__(3,long long,5,int) \
-  __func__(3,long long,5,unsigned) \
-  __func__(3,long long,5,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,5,long long)) \
 \
-  __func__(4,int,1,int) \
-  __func__(4,int,1,unsigned) \
-  __func__(4,int,1,long long) \
-  __func__(4,int,2,int) \
-  __func__(4,int,2,unsigned) \
-  __func__(4,int,2,long long) \
-  __func__(4,int,3,int) \
-  __func__(4,int,3,unsigned) \
-  __func__(4,int,3,long long) \
-  __func__(4,int,4,int) \
-  __func__(4,int,4,unsigned) \
-  __func__(4,int,4,long long) \
-  __func__(4,int,5,int) \
-  __func__(4,int,5,unsigned) \
-  __func__(4,int,5,long long) \
-  __func__(4,unsigned,1,int) \
-  __func__(4,unsigned,1,unsigned) \
-  __func__(4,unsigned,1,long long) \
-  __func__(4,unsigned,2,int) \
-  __func__(4,unsigned,2,unsigned) \
-  __func__(4,unsigned,2,long long) \
-  __func__(4,unsigned,3,int) \
-  __func__(4,unsigned,3,unsigned) \
-  __func__(4,unsigned,3,long long) \
-  __func__(4,unsigned,4,int) \
-  __func__(4,unsigned,4,unsigned) \
-  __func__(4,unsigned,4,long long) \
-  __func__(4,unsigned,5,int) \
-  __func__(4,unsigned,5,unsigned) \
-  __func__(4,unsigned,5,long long) \
-  __func__(4,long long,1,int) \
-  __func__(4,long long,1,unsigned) \
-  __func__(4,long long,1,long long) \
-  __func__(4,long long,2,int) \
-  __func__(4,long long,2,unsigned) \
-  __func__(4,long long,2,long long) \
-  __func__(4,long long,3,int) \
-  __func__(4,long long,3,unsigned) \
-  __func__(4,long long,3,long long) \
-  __func__(4,long long,4,int) \
-  __func__(4,long long,4,unsigned) \
-  __func__(4,long long,4,long long) \
-  __func__(4,long long,5,int) \
-  __func__(4,long long,5,unsigned) \
-  __func__(4,long long,5,long long) \
+  REALM_CT_IF_INT_INT(__func__(4,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,5,long long)) \
 \
-  __func__(5,int,1,int) \
-  __func__(5,int,1,unsigned) \
-  __func__(5,int,1,long long) \
-  __func__(5,int,2,int) \
-  __func__(5,int,2,unsigned) \
-  __func__(5,int,2,long long) \
-  __func__(5,int,3,int) \
-  __func__(5,int,3,unsigned) \
-  __func__(5,int,3,long long) \
-  __func__(5,int,4,int) \
-  __func__(5,int,4,unsigned) \
-  __func__(5,int,4,long long) \
-  __func__(5,int,5,int) \
-  __func__(5,int,5,unsigned) \
-  __func__(5,int,5,long long) \
-  __func__(5,unsigned,1,int) \
-  __func__(5,unsigned,1,unsigned) \
-  __func__(5,unsigned,1,long long) \
-  __func__(5,unsigned,2,int) \
-  __func__(5,unsigned,2,unsigned) \
-  __func__(5,unsigned,2,long long) \
-  __func__(5,unsigned,3,int) \
-  __func__(5,unsigned,3,unsigned) \
-  __func__(5,unsigned,3,long long) \
-  __func__(5,unsigned,4,int) \
-  __func__(5,unsigned,4,unsigned) \
-  __func__(5,unsigned,4,long long) \
-  __func__(5,unsigned,5,int) \
-  __func__(5,unsigned,5,unsigned) \
-  __func__(5,unsigned,5,long long) \
-  __func__(5,long long,1,int) \
-  __func__(5,long long,1,unsigned) \
-  __func__(5,long long,1,long long) \
-  __func__(5,long long,2,int) \
-  __func__(5,long long,2,unsigned) \
-  __func__(5,long long,2,long long) \
-  __func__(5,long long,3,int) \
-  __func__(5,long long,3,unsigned) \
-  __func__(5,long long,3,long long) \
-  __func__(5,long long,4,int) \
-  __func__(5,long long,4,unsigned) \
-  __func__(5,long long,4,long long) \
-  __func__(5,long long,5,int) \
-  __func__(5,long long,5,unsigned) \
-  __func__(5,long long,5,long long) \
+  REALM_CT_IF_INT_INT(__func__(5,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,5,long long)) \
 
 #elif REALM_MAX_DIM == 6
 
@@ -953,393 +953,393 @@ namespace Realm {
   __func__(6) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
-  __func__(4,int) \
-  __func__(4,unsigned) \
-  __func__(4,long long) \
-  __func__(5,int) \
-  __func__(5,unsigned) \
-  __func__(5,long long) \
-  __func__(6,int) \
-  __func__(6,unsigned) \
-  __func__(6,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
+  REALM_CT_IF_INT(__func__(4,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long)) \
+  REALM_CT_IF_INT(__func__(5,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long)) \
+  REALM_CT_IF_INT(__func__(6,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
-  __func__(4,int,int) \
-  __func__(4,int,bool) \
-  __func__(4,unsigned,int) \
-  __func__(4,unsigned,bool) \
-  __func__(4,long long,int) \
-  __func__(4,long long,bool) \
-  __func__(5,int,int) \
-  __func__(5,int,bool) \
-  __func__(5,unsigned,int) \
-  __func__(5,unsigned,bool) \
-  __func__(5,long long,int) \
-  __func__(5,long long,bool) \
-  __func__(6,int,int) \
-  __func__(6,int,bool) \
-  __func__(6,unsigned,int) \
-  __func__(6,unsigned,bool) \
-  __func__(6,long long,int) \
-  __func__(6,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
+  REALM_CT_IF_INT(__func__(4,int,int)) \
+  REALM_CT_IF_INT(__func__(4,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,bool)) \
+  REALM_CT_IF_INT(__func__(5,int,int)) \
+  REALM_CT_IF_INT(__func__(5,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,bool)) \
+  REALM_CT_IF_INT(__func__(6,int,int)) \
+  REALM_CT_IF_INT(__func__(6,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,int,4,int) \
-  __func__(1,int,4,unsigned) \
-  __func__(1,int,4,long long) \
-  __func__(1,int,5,int) \
-  __func__(1,int,5,unsigned) \
-  __func__(1,int,5,long long) \
-  __func__(1,int,6,int) \
-  __func__(1,int,6,unsigned) \
-  __func__(1,int,6,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,unsigned,4,int) \
-  __func__(1,unsigned,4,unsigned) \
-  __func__(1,unsigned,4,long long) \
-  __func__(1,unsigned,5,int) \
-  __func__(1,unsigned,5,unsigned) \
-  __func__(1,unsigned,5,long long) \
-  __func__(1,unsigned,6,int) \
-  __func__(1,unsigned,6,unsigned) \
-  __func__(1,unsigned,6,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
-  __func__(1,long long,4,int) \
-  __func__(1,long long,4,unsigned) \
-  __func__(1,long long,4,long long) \
-  __func__(1,long long,5,int) \
-  __func__(1,long long,5,unsigned) \
-  __func__(1,long long,5,long long) \
-  __func__(1,long long,6,int) \
-  __func__(1,long long,6,unsigned) \
-  __func__(1,long long,6,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,6,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,int,4,int) \
-  __func__(2,int,4,unsigned) \
-  __func__(2,int,4,long long) \
-  __func__(2,int,5,int) \
-  __func__(2,int,5,unsigned) \
-  __func__(2,int,5,long long) \
-  __func__(2,int,6,int) \
-  __func__(2,int,6,unsigned) \
-  __func__(2,int,6,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,unsigned,4,int) \
-  __func__(2,unsigned,4,unsigned) \
-  __func__(2,unsigned,4,long long) \
-  __func__(2,unsigned,5,int) \
-  __func__(2,unsigned,5,unsigned) \
-  __func__(2,unsigned,5,long long) \
-  __func__(2,unsigned,6,int) \
-  __func__(2,unsigned,6,unsigned) \
-  __func__(2,unsigned,6,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
-  __func__(2,long long,4,int) \
-  __func__(2,long long,4,unsigned) \
-  __func__(2,long long,4,long long) \
-  __func__(2,long long,5,int) \
-  __func__(2,long long,5,unsigned) \
-  __func__(2,long long,5,long long) \
-  __func__(2,long long,6,int) \
-  __func__(2,long long,6,unsigned) \
-  __func__(2,long long,6,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,6,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,int,4,int) \
-  __func__(3,int,4,unsigned) \
-  __func__(3,int,4,long long) \
-  __func__(3,int,5,int) \
-  __func__(3,int,5,unsigned) \
-  __func__(3,int,5,long long) \
-  __func__(3,int,6,int) \
-  __func__(3,int,6,unsigned) \
-  __func__(3,int,6,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,unsigned,4,int) \
-  __func__(3,unsigned,4,unsigned) \
-  __func__(3,unsigned,4,long long) \
-  __func__(3,unsigned,5,int) \
-  __func__(3,unsigned,5,unsigned) \
-  __func__(3,unsigned,5,long long) \
-  __func__(3,unsigned,6,int) \
-  __func__(3,unsigned,6,unsigned) \
-  __func__(3,unsigned,6,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
-  __func__(3,long long,4,int) \
-  __func__(3,long long,4,unsigned) \
-  __func__(3,long long,4,long long) \
-  __func__(3,long long,5,int) \
-  __func__(3,long long,5,unsigned) \
-  __func__(3,long long,5,long long) \
-  __func__(3,long long,6,int) \
-  __func__(3,long long,6,unsigned) \
-  __func__(3,long long,6,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,6,long long)) \
 \
-  __func__(4,int,1,int) \
-  __func__(4,int,1,unsigned) \
-  __func__(4,int,1,long long) \
-  __func__(4,int,2,int) \
-  __func__(4,int,2,unsigned) \
-  __func__(4,int,2,long long) \
-  __func__(4,int,3,int) \
-  __func__(4,int,3,unsigned) \
-  __func__(4,int,3,long long) \
-  __func__(4,int,4,int) \
-  __func__(4,int,4,unsigned) \
-  __func__(4,int,4,long long) \
-  __func__(4,int,5,int) \
-  __func__(4,int,5,unsigned) \
-  __func__(4,int,5,long long) \
-  __func__(4,int,6,int) \
-  __func__(4,int,6,unsigned) \
-  __func__(4,int,6,long long) \
-  __func__(4,unsigned,1,int) \
-  __func__(4,unsigned,1,unsigned) \
-  __func__(4,unsigned,1,long long) \
-  __func__(4,unsigned,2,int) \
-  __func__(4,unsigned,2,unsigned) \
-  __func__(4,unsigned,2,long long) \
-  __func__(4,unsigned,3,int) \
-  __func__(4,unsigned,3,unsigned) \
-  __func__(4,unsigned,3,long long) \
-  __func__(4,unsigned,4,int) \
-  __func__(4,unsigned,4,unsigned) \
-  __func__(4,unsigned,4,long long) \
-  __func__(4,unsigned,5,int) \
-  __func__(4,unsigned,5,unsigned) \
-  __func__(4,unsigned,5,long long) \
-  __func__(4,unsigned,6,int) \
-  __func__(4,unsigned,6,unsigned) \
-  __func__(4,unsigned,6,long long) \
-  __func__(4,long long,1,int) \
-  __func__(4,long long,1,unsigned) \
-  __func__(4,long long,1,long long) \
-  __func__(4,long long,2,int) \
-  __func__(4,long long,2,unsigned) \
-  __func__(4,long long,2,long long) \
-  __func__(4,long long,3,int) \
-  __func__(4,long long,3,unsigned) \
-  __func__(4,long long,3,long long) \
-  __func__(4,long long,4,int) \
-  __func__(4,long long,4,unsigned) \
-  __func__(4,long long,4,long long) \
-  __func__(4,long long,5,int) \
-  __func__(4,long long,5,unsigned) \
-  __func__(4,long long,5,long long) \
-  __func__(4,long long,6,int) \
-  __func__(4,long long,6,unsigned) \
-  __func__(4,long long,6,long long) \
+  REALM_CT_IF_INT_INT(__func__(4,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,6,long long)) \
 \
-  __func__(5,int,1,int) \
-  __func__(5,int,1,unsigned) \
-  __func__(5,int,1,long long) \
-  __func__(5,int,2,int) \
-  __func__(5,int,2,unsigned) \
-  __func__(5,int,2,long long) \
-  __func__(5,int,3,int) \
-  __func__(5,int,3,unsigned) \
-  __func__(5,int,3,long long) \
-  __func__(5,int,4,int) \
-  __func__(5,int,4,unsigned) \
-  __func__(5,int,4,long long) \
-  __func__(5,int,5,int) \
-  __func__(5,int,5,unsigned) \
-  __func__(5,int,5,long long) \
-  __func__(5,int,6,int) \
-  __func__(5,int,6,unsigned) \
-  __func__(5,int,6,long long) \
-  __func__(5,unsigned,1,int) \
-  __func__(5,unsigned,1,unsigned) \
-  __func__(5,unsigned,1,long long) \
-  __func__(5,unsigned,2,int) \
-  __func__(5,unsigned,2,unsigned) \
-  __func__(5,unsigned,2,long long) \
-  __func__(5,unsigned,3,int) \
-  __func__(5,unsigned,3,unsigned) \
-  __func__(5,unsigned,3,long long) \
-  __func__(5,unsigned,4,int) \
-  __func__(5,unsigned,4,unsigned) \
-  __func__(5,unsigned,4,long long) \
-  __func__(5,unsigned,5,int) \
-  __func__(5,unsigned,5,unsigned) \
-  __func__(5,unsigned,5,long long) \
-  __func__(5,unsigned,6,int) \
-  __func__(5,unsigned,6,unsigned) \
-  __func__(5,unsigned,6,long long) \
-  __func__(5,long long,1,int) \
-  __func__(5,long long,1,unsigned) \
-  __func__(5,long long,1,long long) \
-  __func__(5,long long,2,int) \
-  __func__(5,long long,2,unsigned) \
-  __func__(5,long long,2,long long) \
-  __func__(5,long long,3,int) \
-  __func__(5,long long,3,unsigned) \
-  __func__(5,long long,3,long long) \
-  __func__(5,long long,4,int) \
-  __func__(5,long long,4,unsigned) \
-  __func__(5,long long,4,long long) \
-  __func__(5,long long,5,int) \
-  __func__(5,long long,5,unsigned) \
-  __func__(5,long long,5,long long) \
-  __func__(5,long long,6,int) \
-  __func__(5,long long,6,unsigned) \
-  __func__(5,long long,6,long long) \
+  REALM_CT_IF_INT_INT(__func__(5,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,6,long long)) \
 \
-  __func__(6,int,1,int) \
-  __func__(6,int,1,unsigned) \
-  __func__(6,int,1,long long) \
-  __func__(6,int,2,int) \
-  __func__(6,int,2,unsigned) \
-  __func__(6,int,2,long long) \
-  __func__(6,int,3,int) \
-  __func__(6,int,3,unsigned) \
-  __func__(6,int,3,long long) \
-  __func__(6,int,4,int) \
-  __func__(6,int,4,unsigned) \
-  __func__(6,int,4,long long) \
-  __func__(6,int,5,int) \
-  __func__(6,int,5,unsigned) \
-  __func__(6,int,5,long long) \
-  __func__(6,int,6,int) \
-  __func__(6,int,6,unsigned) \
-  __func__(6,int,6,long long) \
-  __func__(6,unsigned,1,int) \
-  __func__(6,unsigned,1,unsigned) \
-  __func__(6,unsigned,1,long long) \
-  __func__(6,unsigned,2,int) \
-  __func__(6,unsigned,2,unsigned) \
-  __func__(6,unsigned,2,long long) \
-  __func__(6,unsigned,3,int) \
-  __func__(6,unsigned,3,unsigned) \
-  __func__(6,unsigned,3,long long) \
-  __func__(6,unsigned,4,int) \
-  __func__(6,unsigned,4,unsigned) \
-  __func__(6,unsigned,4,long long) \
-  __func__(6,unsigned,5,int) \
-  __func__(6,unsigned,5,unsigned) \
-  __func__(6,unsigned,5,long long) \
-  __func__(6,unsigned,6,int) \
-  __func__(6,unsigned,6,unsigned) \
-  __func__(6,unsigned,6,long long) \
-  __func__(6,long long,1,int) \
-  __func__(6,long long,1,unsigned) \
-  __func__(6,long long,1,long long) \
-  __func__(6,long long,2,int) \
-  __func__(6,long long,2,unsigned) \
-  __func__(6,long long,2,long long) \
-  __func__(6,long long,3,int) \
-  __func__(6,long long,3,unsigned) \
-  __func__(6,long long,3,long long) \
-  __func__(6,long long,4,int) \
-  __func__(6,long long,4,unsigned) \
-  __func__(6,long long,4,long long) \
-  __func__(6,long long,5,int) \
-  __func__(6,long long,5,unsigned) \
-  __func__(6,long long,5,long long) \
-  __func__(6,long long,6,int) \
-  __func__(6,long long,6,unsigned) \
-  __func__(6,long long,6,long long) \
+  REALM_CT_IF_INT_INT(__func__(6,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,6,long long)) \
 
 #elif REALM_MAX_DIM == 7
 
@@ -1353,520 +1353,520 @@ namespace Realm {
   __func__(7) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
-  __func__(4,int) \
-  __func__(4,unsigned) \
-  __func__(4,long long) \
-  __func__(5,int) \
-  __func__(5,unsigned) \
-  __func__(5,long long) \
-  __func__(6,int) \
-  __func__(6,unsigned) \
-  __func__(6,long long) \
-  __func__(7,int) \
-  __func__(7,unsigned) \
-  __func__(7,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
+  REALM_CT_IF_INT(__func__(4,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long)) \
+  REALM_CT_IF_INT(__func__(5,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long)) \
+  REALM_CT_IF_INT(__func__(6,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long)) \
+  REALM_CT_IF_INT(__func__(7,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
-  __func__(4,int,int) \
-  __func__(4,int,bool) \
-  __func__(4,unsigned,int) \
-  __func__(4,unsigned,bool) \
-  __func__(4,long long,int) \
-  __func__(4,long long,bool) \
-  __func__(5,int,int) \
-  __func__(5,int,bool) \
-  __func__(5,unsigned,int) \
-  __func__(5,unsigned,bool) \
-  __func__(5,long long,int) \
-  __func__(5,long long,bool) \
-  __func__(6,int,int) \
-  __func__(6,int,bool) \
-  __func__(6,unsigned,int) \
-  __func__(6,unsigned,bool) \
-  __func__(6,long long,int) \
-  __func__(6,long long,bool) \
-  __func__(7,int,int) \
-  __func__(7,int,bool) \
-  __func__(7,unsigned,int) \
-  __func__(7,unsigned,bool) \
-  __func__(7,long long,int) \
-  __func__(7,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
+  REALM_CT_IF_INT(__func__(4,int,int)) \
+  REALM_CT_IF_INT(__func__(4,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,bool)) \
+  REALM_CT_IF_INT(__func__(5,int,int)) \
+  REALM_CT_IF_INT(__func__(5,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,bool)) \
+  REALM_CT_IF_INT(__func__(6,int,int)) \
+  REALM_CT_IF_INT(__func__(6,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,bool)) \
+  REALM_CT_IF_INT(__func__(7,int,int)) \
+  REALM_CT_IF_INT(__func__(7,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,int,4,int) \
-  __func__(1,int,4,unsigned) \
-  __func__(1,int,4,long long) \
-  __func__(1,int,5,int) \
-  __func__(1,int,5,unsigned) \
-  __func__(1,int,5,long long) \
-  __func__(1,int,6,int) \
-  __func__(1,int,6,unsigned) \
-  __func__(1,int,6,long long) \
-  __func__(1,int,7,int) \
-  __func__(1,int,7,unsigned) \
-  __func__(1,int,7,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,unsigned,4,int) \
-  __func__(1,unsigned,4,unsigned) \
-  __func__(1,unsigned,4,long long) \
-  __func__(1,unsigned,5,int) \
-  __func__(1,unsigned,5,unsigned) \
-  __func__(1,unsigned,5,long long) \
-  __func__(1,unsigned,6,int) \
-  __func__(1,unsigned,6,unsigned) \
-  __func__(1,unsigned,6,long long) \
-  __func__(1,unsigned,7,int) \
-  __func__(1,unsigned,7,unsigned) \
-  __func__(1,unsigned,7,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
-  __func__(1,long long,4,int) \
-  __func__(1,long long,4,unsigned) \
-  __func__(1,long long,4,long long) \
-  __func__(1,long long,5,int) \
-  __func__(1,long long,5,unsigned) \
-  __func__(1,long long,5,long long) \
-  __func__(1,long long,6,int) \
-  __func__(1,long long,6,unsigned) \
-  __func__(1,long long,6,long long) \
-  __func__(1,long long,7,int) \
-  __func__(1,long long,7,unsigned) \
-  __func__(1,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,7,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,int,4,int) \
-  __func__(2,int,4,unsigned) \
-  __func__(2,int,4,long long) \
-  __func__(2,int,5,int) \
-  __func__(2,int,5,unsigned) \
-  __func__(2,int,5,long long) \
-  __func__(2,int,6,int) \
-  __func__(2,int,6,unsigned) \
-  __func__(2,int,6,long long) \
-  __func__(2,int,7,int) \
-  __func__(2,int,7,unsigned) \
-  __func__(2,int,7,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,unsigned,4,int) \
-  __func__(2,unsigned,4,unsigned) \
-  __func__(2,unsigned,4,long long) \
-  __func__(2,unsigned,5,int) \
-  __func__(2,unsigned,5,unsigned) \
-  __func__(2,unsigned,5,long long) \
-  __func__(2,unsigned,6,int) \
-  __func__(2,unsigned,6,unsigned) \
-  __func__(2,unsigned,6,long long) \
-  __func__(2,unsigned,7,int) \
-  __func__(2,unsigned,7,unsigned) \
-  __func__(2,unsigned,7,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
-  __func__(2,long long,4,int) \
-  __func__(2,long long,4,unsigned) \
-  __func__(2,long long,4,long long) \
-  __func__(2,long long,5,int) \
-  __func__(2,long long,5,unsigned) \
-  __func__(2,long long,5,long long) \
-  __func__(2,long long,6,int) \
-  __func__(2,long long,6,unsigned) \
-  __func__(2,long long,6,long long) \
-  __func__(2,long long,7,int) \
-  __func__(2,long long,7,unsigned) \
-  __func__(2,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,7,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,int,4,int) \
-  __func__(3,int,4,unsigned) \
-  __func__(3,int,4,long long) \
-  __func__(3,int,5,int) \
-  __func__(3,int,5,unsigned) \
-  __func__(3,int,5,long long) \
-  __func__(3,int,6,int) \
-  __func__(3,int,6,unsigned) \
-  __func__(3,int,6,long long) \
-  __func__(3,int,7,int) \
-  __func__(3,int,7,unsigned) \
-  __func__(3,int,7,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,unsigned,4,int) \
-  __func__(3,unsigned,4,unsigned) \
-  __func__(3,unsigned,4,long long) \
-  __func__(3,unsigned,5,int) \
-  __func__(3,unsigned,5,unsigned) \
-  __func__(3,unsigned,5,long long) \
-  __func__(3,unsigned,6,int) \
-  __func__(3,unsigned,6,unsigned) \
-  __func__(3,unsigned,6,long long) \
-  __func__(3,unsigned,7,int) \
-  __func__(3,unsigned,7,unsigned) \
-  __func__(3,unsigned,7,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
-  __func__(3,long long,4,int) \
-  __func__(3,long long,4,unsigned) \
-  __func__(3,long long,4,long long) \
-  __func__(3,long long,5,int) \
-  __func__(3,long long,5,unsigned) \
-  __func__(3,long long,5,long long) \
-  __func__(3,long long,6,int) \
-  __func__(3,long long,6,unsigned) \
-  __func__(3,long long,6,long long) \
-  __func__(3,long long,7,int) \
-  __func__(3,long long,7,unsigned) \
-  __func__(3,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,7,long long)) \
 \
-  __func__(4,int,1,int) \
-  __func__(4,int,1,unsigned) \
-  __func__(4,int,1,long long) \
-  __func__(4,int,2,int) \
-  __func__(4,int,2,unsigned) \
-  __func__(4,int,2,long long) \
-  __func__(4,int,3,int) \
-  __func__(4,int,3,unsigned) \
-  __func__(4,int,3,long long) \
-  __func__(4,int,4,int) \
-  __func__(4,int,4,unsigned) \
-  __func__(4,int,4,long long) \
-  __func__(4,int,5,int) \
-  __func__(4,int,5,unsigned) \
-  __func__(4,int,5,long long) \
-  __func__(4,int,6,int) \
-  __func__(4,int,6,unsigned) \
-  __func__(4,int,6,long long) \
-  __func__(4,int,7,int) \
-  __func__(4,int,7,unsigned) \
-  __func__(4,int,7,long long) \
-  __func__(4,unsigned,1,int) \
-  __func__(4,unsigned,1,unsigned) \
-  __func__(4,unsigned,1,long long) \
-  __func__(4,unsigned,2,int) \
-  __func__(4,unsigned,2,unsigned) \
-  __func__(4,unsigned,2,long long) \
-  __func__(4,unsigned,3,int) \
-  __func__(4,unsigned,3,unsigned) \
-  __func__(4,unsigned,3,long long) \
-  __func__(4,unsigned,4,int) \
-  __func__(4,unsigned,4,unsigned) \
-  __func__(4,unsigned,4,long long) \
-  __func__(4,unsigned,5,int) \
-  __func__(4,unsigned,5,unsigned) \
-  __func__(4,unsigned,5,long long) \
-  __func__(4,unsigned,6,int) \
-  __func__(4,unsigned,6,unsigned) \
-  __func__(4,unsigned,6,long long) \
-  __func__(4,unsigned,7,int) \
-  __func__(4,unsigned,7,unsigned) \
-  __func__(4,unsigned,7,long long) \
-  __func__(4,long long,1,int) \
-  __func__(4,long long,1,unsigned) \
-  __func__(4,long long,1,long long) \
-  __func__(4,long long,2,int) \
-  __func__(4,long long,2,unsigned) \
-  __func__(4,long long,2,long long) \
-  __func__(4,long long,3,int) \
-  __func__(4,long long,3,unsigned) \
-  __func__(4,long long,3,long long) \
-  __func__(4,long long,4,int) \
-  __func__(4,long long,4,unsigned) \
-  __func__(4,long long,4,long long) \
-  __func__(4,long long,5,int) \
-  __func__(4,long long,5,unsigned) \
-  __func__(4,long long,5,long long) \
-  __func__(4,long long,6,int) \
-  __func__(4,long long,6,unsigned) \
-  __func__(4,long long,6,long long) \
-  __func__(4,long long,7,int) \
-  __func__(4,long long,7,unsigned) \
-  __func__(4,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(4,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,7,long long)) \
 \
-  __func__(5,int,1,int) \
-  __func__(5,int,1,unsigned) \
-  __func__(5,int,1,long long) \
-  __func__(5,int,2,int) \
-  __func__(5,int,2,unsigned) \
-  __func__(5,int,2,long long) \
-  __func__(5,int,3,int) \
-  __func__(5,int,3,unsigned) \
-  __func__(5,int,3,long long) \
-  __func__(5,int,4,int) \
-  __func__(5,int,4,unsigned) \
-  __func__(5,int,4,long long) \
-  __func__(5,int,5,int) \
-  __func__(5,int,5,unsigned) \
-  __func__(5,int,5,long long) \
-  __func__(5,int,6,int) \
-  __func__(5,int,6,unsigned) \
-  __func__(5,int,6,long long) \
-  __func__(5,int,7,int) \
-  __func__(5,int,7,unsigned) \
-  __func__(5,int,7,long long) \
-  __func__(5,unsigned,1,int) \
-  __func__(5,unsigned,1,unsigned) \
-  __func__(5,unsigned,1,long long) \
-  __func__(5,unsigned,2,int) \
-  __func__(5,unsigned,2,unsigned) \
-  __func__(5,unsigned,2,long long) \
-  __func__(5,unsigned,3,int) \
-  __func__(5,unsigned,3,unsigned) \
-  __func__(5,unsigned,3,long long) \
-  __func__(5,unsigned,4,int) \
-  __func__(5,unsigned,4,unsigned) \
-  __func__(5,unsigned,4,long long) \
-  __func__(5,unsigned,5,int) \
-  __func__(5,unsigned,5,unsigned) \
-  __func__(5,unsigned,5,long long) \
-  __func__(5,unsigned,6,int) \
-  __func__(5,unsigned,6,unsigned) \
-  __func__(5,unsigned,6,long long) \
-  __func__(5,unsigned,7,int) \
-  __func__(5,unsigned,7,unsigned) \
-  __func__(5,unsigned,7,long long) \
-  __func__(5,long long,1,int) \
-  __func__(5,long long,1,unsigned) \
-  __func__(5,long long,1,long long) \
-  __func__(5,long long,2,int) \
-  __func__(5,long long,2,unsigned) \
-  __func__(5,long long,2,long long) \
-  __func__(5,long long,3,int) \
-  __func__(5,long long,3,unsigned) \
-  __func__(5,long long,3,long long) \
-  __func__(5,long long,4,int) \
-  __func__(5,long long,4,unsigned) \
-  __func__(5,long long,4,long long) \
-  __func__(5,long long,5,int) \
-  __func__(5,long long,5,unsigned) \
-  __func__(5,long long,5,long long) \
-  __func__(5,long long,6,int) \
-  __func__(5,long long,6,unsigned) \
-  __func__(5,long long,6,long long) \
-  __func__(5,long long,7,int) \
-  __func__(5,long long,7,unsigned) \
-  __func__(5,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(5,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,7,long long)) \
 \
-  __func__(6,int,1,int) \
-  __func__(6,int,1,unsigned) \
-  __func__(6,int,1,long long) \
-  __func__(6,int,2,int) \
-  __func__(6,int,2,unsigned) \
-  __func__(6,int,2,long long) \
-  __func__(6,int,3,int) \
-  __func__(6,int,3,unsigned) \
-  __func__(6,int,3,long long) \
-  __func__(6,int,4,int) \
-  __func__(6,int,4,unsigned) \
-  __func__(6,int,4,long long) \
-  __func__(6,int,5,int) \
-  __func__(6,int,5,unsigned) \
-  __func__(6,int,5,long long) \
-  __func__(6,int,6,int) \
-  __func__(6,int,6,unsigned) \
-  __func__(6,int,6,long long) \
-  __func__(6,int,7,int) \
-  __func__(6,int,7,unsigned) \
-  __func__(6,int,7,long long) \
-  __func__(6,unsigned,1,int) \
-  __func__(6,unsigned,1,unsigned) \
-  __func__(6,unsigned,1,long long) \
-  __func__(6,unsigned,2,int) \
-  __func__(6,unsigned,2,unsigned) \
-  __func__(6,unsigned,2,long long) \
-  __func__(6,unsigned,3,int) \
-  __func__(6,unsigned,3,unsigned) \
-  __func__(6,unsigned,3,long long) \
-  __func__(6,unsigned,4,int) \
-  __func__(6,unsigned,4,unsigned) \
-  __func__(6,unsigned,4,long long) \
-  __func__(6,unsigned,5,int) \
-  __func__(6,unsigned,5,unsigned) \
-  __func__(6,unsigned,5,long long) \
-  __func__(6,unsigned,6,int) \
-  __func__(6,unsigned,6,unsigned) \
-  __func__(6,unsigned,6,long long) \
-  __func__(6,unsigned,7,int) \
-  __func__(6,unsigned,7,unsigned) \
-  __func__(6,unsigned,7,long long) \
-  __func__(6,long long,1,int) \
-  __func__(6,long long,1,unsigned) \
-  __func__(6,long long,1,long long) \
-  __func__(6,long long,2,int) \
-  __func__(6,long long,2,unsigned) \
-  __func__(6,long long,2,long long) \
-  __func__(6,long long,3,int) \
-  __func__(6,long long,3,unsigned) \
-  __func__(6,long long,3,long long) \
-  __func__(6,long long,4,int) \
-  __func__(6,long long,4,unsigned) \
-  __func__(6,long long,4,long long) \
-  __func__(6,long long,5,int) \
-  __func__(6,long long,5,unsigned) \
-  __func__(6,long long,5,long long) \
-  __func__(6,long long,6,int) \
-  __func__(6,long long,6,unsigned) \
-  __func__(6,long long,6,long long) \
-  __func__(6,long long,7,int) \
-  __func__(6,long long,7,unsigned) \
-  __func__(6,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(6,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,7,long long)) \
 \
-  __func__(7,int,1,int) \
-  __func__(7,int,1,unsigned) \
-  __func__(7,int,1,long long) \
-  __func__(7,int,2,int) \
-  __func__(7,int,2,unsigned) \
-  __func__(7,int,2,long long) \
-  __func__(7,int,3,int) \
-  __func__(7,int,3,unsigned) \
-  __func__(7,int,3,long long) \
-  __func__(7,int,4,int) \
-  __func__(7,int,4,unsigned) \
-  __func__(7,int,4,long long) \
-  __func__(7,int,5,int) \
-  __func__(7,int,5,unsigned) \
-  __func__(7,int,5,long long) \
-  __func__(7,int,6,int) \
-  __func__(7,int,6,unsigned) \
-  __func__(7,int,6,long long) \
-  __func__(7,int,7,int) \
-  __func__(7,int,7,unsigned) \
-  __func__(7,int,7,long long) \
-  __func__(7,unsigned,1,int) \
-  __func__(7,unsigned,1,unsigned) \
-  __func__(7,unsigned,1,long long) \
-  __func__(7,unsigned,2,int) \
-  __func__(7,unsigned,2,unsigned) \
-  __func__(7,unsigned,2,long long) \
-  __func__(7,unsigned,3,int) \
-  __func__(7,unsigned,3,unsigned) \
-  __func__(7,unsigned,3,long long) \
-  __func__(7,unsigned,4,int) \
-  __func__(7,unsigned,4,unsigned) \
-  __func__(7,unsigned,4,long long) \
-  __func__(7,unsigned,5,int) \
-  __func__(7,unsigned,5,unsigned) \
-  __func__(7,unsigned,5,long long) \
-  __func__(7,unsigned,6,int) \
-  __func__(7,unsigned,6,unsigned) \
-  __func__(7,unsigned,6,long long) \
-  __func__(7,unsigned,7,int) \
-  __func__(7,unsigned,7,unsigned) \
-  __func__(7,unsigned,7,long long) \
-  __func__(7,long long,1,int) \
-  __func__(7,long long,1,unsigned) \
-  __func__(7,long long,1,long long) \
-  __func__(7,long long,2,int) \
-  __func__(7,long long,2,unsigned) \
-  __func__(7,long long,2,long long) \
-  __func__(7,long long,3,int) \
-  __func__(7,long long,3,unsigned) \
-  __func__(7,long long,3,long long) \
-  __func__(7,long long,4,int) \
-  __func__(7,long long,4,unsigned) \
-  __func__(7,long long,4,long long) \
-  __func__(7,long long,5,int) \
-  __func__(7,long long,5,unsigned) \
-  __func__(7,long long,5,long long) \
-  __func__(7,long long,6,int) \
-  __func__(7,long long,6,unsigned) \
-  __func__(7,long long,6,long long) \
-  __func__(7,long long,7,int) \
-  __func__(7,long long,7,unsigned) \
-  __func__(7,long long,7,long long) \
+  REALM_CT_IF_INT_INT(__func__(7,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,7,long long)) \
 
 #elif REALM_MAX_DIM == 8
 
@@ -1881,665 +1881,665 @@ namespace Realm {
   __func__(8) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
-  __func__(4,int) \
-  __func__(4,unsigned) \
-  __func__(4,long long) \
-  __func__(5,int) \
-  __func__(5,unsigned) \
-  __func__(5,long long) \
-  __func__(6,int) \
-  __func__(6,unsigned) \
-  __func__(6,long long) \
-  __func__(7,int) \
-  __func__(7,unsigned) \
-  __func__(7,long long) \
-  __func__(8,int) \
-  __func__(8,unsigned) \
-  __func__(8,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
+  REALM_CT_IF_INT(__func__(4,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long)) \
+  REALM_CT_IF_INT(__func__(5,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long)) \
+  REALM_CT_IF_INT(__func__(6,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long)) \
+  REALM_CT_IF_INT(__func__(7,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long)) \
+  REALM_CT_IF_INT(__func__(8,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(8,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(8,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
-  __func__(4,int,int) \
-  __func__(4,int,bool) \
-  __func__(4,unsigned,int) \
-  __func__(4,unsigned,bool) \
-  __func__(4,long long,int) \
-  __func__(4,long long,bool) \
-  __func__(5,int,int) \
-  __func__(5,int,bool) \
-  __func__(5,unsigned,int) \
-  __func__(5,unsigned,bool) \
-  __func__(5,long long,int) \
-  __func__(5,long long,bool) \
-  __func__(6,int,int) \
-  __func__(6,int,bool) \
-  __func__(6,unsigned,int) \
-  __func__(6,unsigned,bool) \
-  __func__(6,long long,int) \
-  __func__(6,long long,bool) \
-  __func__(7,int,int) \
-  __func__(7,int,bool) \
-  __func__(7,unsigned,int) \
-  __func__(7,unsigned,bool) \
-  __func__(7,long long,int) \
-  __func__(7,long long,bool) \
-  __func__(8,int,int) \
-  __func__(8,int,bool) \
-  __func__(8,unsigned,int) \
-  __func__(8,unsigned,bool) \
-  __func__(8,long long,int) \
-  __func__(8,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
+  REALM_CT_IF_INT(__func__(4,int,int)) \
+  REALM_CT_IF_INT(__func__(4,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,bool)) \
+  REALM_CT_IF_INT(__func__(5,int,int)) \
+  REALM_CT_IF_INT(__func__(5,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,bool)) \
+  REALM_CT_IF_INT(__func__(6,int,int)) \
+  REALM_CT_IF_INT(__func__(6,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,bool)) \
+  REALM_CT_IF_INT(__func__(7,int,int)) \
+  REALM_CT_IF_INT(__func__(7,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long,bool)) \
+  REALM_CT_IF_INT(__func__(8,int,int)) \
+  REALM_CT_IF_INT(__func__(8,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(8,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(8,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(8,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(8,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,int,4,int) \
-  __func__(1,int,4,unsigned) \
-  __func__(1,int,4,long long) \
-  __func__(1,int,5,int) \
-  __func__(1,int,5,unsigned) \
-  __func__(1,int,5,long long) \
-  __func__(1,int,6,int) \
-  __func__(1,int,6,unsigned) \
-  __func__(1,int,6,long long) \
-  __func__(1,int,7,int) \
-  __func__(1,int,7,unsigned) \
-  __func__(1,int,7,long long) \
-  __func__(1,int,8,int) \
-  __func__(1,int,8,unsigned) \
-  __func__(1,int,8,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,unsigned,4,int) \
-  __func__(1,unsigned,4,unsigned) \
-  __func__(1,unsigned,4,long long) \
-  __func__(1,unsigned,5,int) \
-  __func__(1,unsigned,5,unsigned) \
-  __func__(1,unsigned,5,long long) \
-  __func__(1,unsigned,6,int) \
-  __func__(1,unsigned,6,unsigned) \
-  __func__(1,unsigned,6,long long) \
-  __func__(1,unsigned,7,int) \
-  __func__(1,unsigned,7,unsigned) \
-  __func__(1,unsigned,7,long long) \
-  __func__(1,unsigned,8,int) \
-  __func__(1,unsigned,8,unsigned) \
-  __func__(1,unsigned,8,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
-  __func__(1,long long,4,int) \
-  __func__(1,long long,4,unsigned) \
-  __func__(1,long long,4,long long) \
-  __func__(1,long long,5,int) \
-  __func__(1,long long,5,unsigned) \
-  __func__(1,long long,5,long long) \
-  __func__(1,long long,6,int) \
-  __func__(1,long long,6,unsigned) \
-  __func__(1,long long,6,long long) \
-  __func__(1,long long,7,int) \
-  __func__(1,long long,7,unsigned) \
-  __func__(1,long long,7,long long) \
-  __func__(1,long long,8,int) \
-  __func__(1,long long,8,unsigned) \
-  __func__(1,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,8,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,int,4,int) \
-  __func__(2,int,4,unsigned) \
-  __func__(2,int,4,long long) \
-  __func__(2,int,5,int) \
-  __func__(2,int,5,unsigned) \
-  __func__(2,int,5,long long) \
-  __func__(2,int,6,int) \
-  __func__(2,int,6,unsigned) \
-  __func__(2,int,6,long long) \
-  __func__(2,int,7,int) \
-  __func__(2,int,7,unsigned) \
-  __func__(2,int,7,long long) \
-  __func__(2,int,8,int) \
-  __func__(2,int,8,unsigned) \
-  __func__(2,int,8,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,unsigned,4,int) \
-  __func__(2,unsigned,4,unsigned) \
-  __func__(2,unsigned,4,long long) \
-  __func__(2,unsigned,5,int) \
-  __func__(2,unsigned,5,unsigned) \
-  __func__(2,unsigned,5,long long) \
-  __func__(2,unsigned,6,int) \
-  __func__(2,unsigned,6,unsigned) \
-  __func__(2,unsigned,6,long long) \
-  __func__(2,unsigned,7,int) \
-  __func__(2,unsigned,7,unsigned) \
-  __func__(2,unsigned,7,long long) \
-  __func__(2,unsigned,8,int) \
-  __func__(2,unsigned,8,unsigned) \
-  __func__(2,unsigned,8,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
-  __func__(2,long long,4,int) \
-  __func__(2,long long,4,unsigned) \
-  __func__(2,long long,4,long long) \
-  __func__(2,long long,5,int) \
-  __func__(2,long long,5,unsigned) \
-  __func__(2,long long,5,long long) \
-  __func__(2,long long,6,int) \
-  __func__(2,long long,6,unsigned) \
-  __func__(2,long long,6,long long) \
-  __func__(2,long long,7,int) \
-  __func__(2,long long,7,unsigned) \
-  __func__(2,long long,7,long long) \
-  __func__(2,long long,8,int) \
-  __func__(2,long long,8,unsigned) \
-  __func__(2,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,8,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,int,4,int) \
-  __func__(3,int,4,unsigned) \
-  __func__(3,int,4,long long) \
-  __func__(3,int,5,int) \
-  __func__(3,int,5,unsigned) \
-  __func__(3,int,5,long long) \
-  __func__(3,int,6,int) \
-  __func__(3,int,6,unsigned) \
-  __func__(3,int,6,long long) \
-  __func__(3,int,7,int) \
-  __func__(3,int,7,unsigned) \
-  __func__(3,int,7,long long) \
-  __func__(3,int,8,int) \
-  __func__(3,int,8,unsigned) \
-  __func__(3,int,8,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,unsigned,4,int) \
-  __func__(3,unsigned,4,unsigned) \
-  __func__(3,unsigned,4,long long) \
-  __func__(3,unsigned,5,int) \
-  __func__(3,unsigned,5,unsigned) \
-  __func__(3,unsigned,5,long long) \
-  __func__(3,unsigned,6,int) \
-  __func__(3,unsigned,6,unsigned) \
-  __func__(3,unsigned,6,long long) \
-  __func__(3,unsigned,7,int) \
-  __func__(3,unsigned,7,unsigned) \
-  __func__(3,unsigned,7,long long) \
-  __func__(3,unsigned,8,int) \
-  __func__(3,unsigned,8,unsigned) \
-  __func__(3,unsigned,8,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
-  __func__(3,long long,4,int) \
-  __func__(3,long long,4,unsigned) \
-  __func__(3,long long,4,long long) \
-  __func__(3,long long,5,int) \
-  __func__(3,long long,5,unsigned) \
-  __func__(3,long long,5,long long) \
-  __func__(3,long long,6,int) \
-  __func__(3,long long,6,unsigned) \
-  __func__(3,long long,6,long long) \
-  __func__(3,long long,7,int) \
-  __func__(3,long long,7,unsigned) \
-  __func__(3,long long,7,long long) \
-  __func__(3,long long,8,int) \
-  __func__(3,long long,8,unsigned) \
-  __func__(3,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,8,long long)) \
 \
-  __func__(4,int,1,int) \
-  __func__(4,int,1,unsigned) \
-  __func__(4,int,1,long long) \
-  __func__(4,int,2,int) \
-  __func__(4,int,2,unsigned) \
-  __func__(4,int,2,long long) \
-  __func__(4,int,3,int) \
-  __func__(4,int,3,unsigned) \
-  __func__(4,int,3,long long) \
-  __func__(4,int,4,int) \
-  __func__(4,int,4,unsigned) \
-  __func__(4,int,4,long long) \
-  __func__(4,int,5,int) \
-  __func__(4,int,5,unsigned) \
-  __func__(4,int,5,long long) \
-  __func__(4,int,6,int) \
-  __func__(4,int,6,unsigned) \
-  __func__(4,int,6,long long) \
-  __func__(4,int,7,int) \
-  __func__(4,int,7,unsigned) \
-  __func__(4,int,7,long long) \
-  __func__(4,int,8,int) \
-  __func__(4,int,8,unsigned) \
-  __func__(4,int,8,long long) \
-  __func__(4,unsigned,1,int) \
-  __func__(4,unsigned,1,unsigned) \
-  __func__(4,unsigned,1,long long) \
-  __func__(4,unsigned,2,int) \
-  __func__(4,unsigned,2,unsigned) \
-  __func__(4,unsigned,2,long long) \
-  __func__(4,unsigned,3,int) \
-  __func__(4,unsigned,3,unsigned) \
-  __func__(4,unsigned,3,long long) \
-  __func__(4,unsigned,4,int) \
-  __func__(4,unsigned,4,unsigned) \
-  __func__(4,unsigned,4,long long) \
-  __func__(4,unsigned,5,int) \
-  __func__(4,unsigned,5,unsigned) \
-  __func__(4,unsigned,5,long long) \
-  __func__(4,unsigned,6,int) \
-  __func__(4,unsigned,6,unsigned) \
-  __func__(4,unsigned,6,long long) \
-  __func__(4,unsigned,7,int) \
-  __func__(4,unsigned,7,unsigned) \
-  __func__(4,unsigned,7,long long) \
-  __func__(4,unsigned,8,int) \
-  __func__(4,unsigned,8,unsigned) \
-  __func__(4,unsigned,8,long long) \
-  __func__(4,long long,1,int) \
-  __func__(4,long long,1,unsigned) \
-  __func__(4,long long,1,long long) \
-  __func__(4,long long,2,int) \
-  __func__(4,long long,2,unsigned) \
-  __func__(4,long long,2,long long) \
-  __func__(4,long long,3,int) \
-  __func__(4,long long,3,unsigned) \
-  __func__(4,long long,3,long long) \
-  __func__(4,long long,4,int) \
-  __func__(4,long long,4,unsigned) \
-  __func__(4,long long,4,long long) \
-  __func__(4,long long,5,int) \
-  __func__(4,long long,5,unsigned) \
-  __func__(4,long long,5,long long) \
-  __func__(4,long long,6,int) \
-  __func__(4,long long,6,unsigned) \
-  __func__(4,long long,6,long long) \
-  __func__(4,long long,7,int) \
-  __func__(4,long long,7,unsigned) \
-  __func__(4,long long,7,long long) \
-  __func__(4,long long,8,int) \
-  __func__(4,long long,8,unsigned) \
-  __func__(4,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(4,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,8,long long)) \
 \
-  __func__(5,int,1,int) \
-  __func__(5,int,1,unsigned) \
-  __func__(5,int,1,long long) \
-  __func__(5,int,2,int) \
-  __func__(5,int,2,unsigned) \
-  __func__(5,int,2,long long) \
-  __func__(5,int,3,int) \
-  __func__(5,int,3,unsigned) \
-  __func__(5,int,3,long long) \
-  __func__(5,int,4,int) \
-  __func__(5,int,4,unsigned) \
-  __func__(5,int,4,long long) \
-  __func__(5,int,5,int) \
-  __func__(5,int,5,unsigned) \
-  __func__(5,int,5,long long) \
-  __func__(5,int,6,int) \
-  __func__(5,int,6,unsigned) \
-  __func__(5,int,6,long long) \
-  __func__(5,int,7,int) \
-  __func__(5,int,7,unsigned) \
-  __func__(5,int,7,long long) \
-  __func__(5,int,8,int) \
-  __func__(5,int,8,unsigned) \
-  __func__(5,int,8,long long) \
-  __func__(5,unsigned,1,int) \
-  __func__(5,unsigned,1,unsigned) \
-  __func__(5,unsigned,1,long long) \
-  __func__(5,unsigned,2,int) \
-  __func__(5,unsigned,2,unsigned) \
-  __func__(5,unsigned,2,long long) \
-  __func__(5,unsigned,3,int) \
-  __func__(5,unsigned,3,unsigned) \
-  __func__(5,unsigned,3,long long) \
-  __func__(5,unsigned,4,int) \
-  __func__(5,unsigned,4,unsigned) \
-  __func__(5,unsigned,4,long long) \
-  __func__(5,unsigned,5,int) \
-  __func__(5,unsigned,5,unsigned) \
-  __func__(5,unsigned,5,long long) \
-  __func__(5,unsigned,6,int) \
-  __func__(5,unsigned,6,unsigned) \
-  __func__(5,unsigned,6,long long) \
-  __func__(5,unsigned,7,int) \
-  __func__(5,unsigned,7,unsigned) \
-  __func__(5,unsigned,7,long long) \
-  __func__(5,unsigned,8,int) \
-  __func__(5,unsigned,8,unsigned) \
-  __func__(5,unsigned,8,long long) \
-  __func__(5,long long,1,int) \
-  __func__(5,long long,1,unsigned) \
-  __func__(5,long long,1,long long) \
-  __func__(5,long long,2,int) \
-  __func__(5,long long,2,unsigned) \
-  __func__(5,long long,2,long long) \
-  __func__(5,long long,3,int) \
-  __func__(5,long long,3,unsigned) \
-  __func__(5,long long,3,long long) \
-  __func__(5,long long,4,int) \
-  __func__(5,long long,4,unsigned) \
-  __func__(5,long long,4,long long) \
-  __func__(5,long long,5,int) \
-  __func__(5,long long,5,unsigned) \
-  __func__(5,long long,5,long long) \
-  __func__(5,long long,6,int) \
-  __func__(5,long long,6,unsigned) \
-  __func__(5,long long,6,long long) \
-  __func__(5,long long,7,int) \
-  __func__(5,long long,7,unsigned) \
-  __func__(5,long long,7,long long) \
-  __func__(5,long long,8,int) \
-  __func__(5,long long,8,unsigned) \
-  __func__(5,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(5,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,8,long long)) \
 \
-  __func__(6,int,1,int) \
-  __func__(6,int,1,unsigned) \
-  __func__(6,int,1,long long) \
-  __func__(6,int,2,int) \
-  __func__(6,int,2,unsigned) \
-  __func__(6,int,2,long long) \
-  __func__(6,int,3,int) \
-  __func__(6,int,3,unsigned) \
-  __func__(6,int,3,long long) \
-  __func__(6,int,4,int) \
-  __func__(6,int,4,unsigned) \
-  __func__(6,int,4,long long) \
-  __func__(6,int,5,int) \
-  __func__(6,int,5,unsigned) \
-  __func__(6,int,5,long long) \
-  __func__(6,int,6,int) \
-  __func__(6,int,6,unsigned) \
-  __func__(6,int,6,long long) \
-  __func__(6,int,7,int) \
-  __func__(6,int,7,unsigned) \
-  __func__(6,int,7,long long) \
-  __func__(6,int,8,int) \
-  __func__(6,int,8,unsigned) \
-  __func__(6,int,8,long long) \
-  __func__(6,unsigned,1,int) \
-  __func__(6,unsigned,1,unsigned) \
-  __func__(6,unsigned,1,long long) \
-  __func__(6,unsigned,2,int) \
-  __func__(6,unsigned,2,unsigned) \
-  __func__(6,unsigned,2,long long) \
-  __func__(6,unsigned,3,int) \
-  __func__(6,unsigned,3,unsigned) \
-  __func__(6,unsigned,3,long long) \
-  __func__(6,unsigned,4,int) \
-  __func__(6,unsigned,4,unsigned) \
-  __func__(6,unsigned,4,long long) \
-  __func__(6,unsigned,5,int) \
-  __func__(6,unsigned,5,unsigned) \
-  __func__(6,unsigned,5,long long) \
-  __func__(6,unsigned,6,int) \
-  __func__(6,unsigned,6,unsigned) \
-  __func__(6,unsigned,6,long long) \
-  __func__(6,unsigned,7,int) \
-  __func__(6,unsigned,7,unsigned) \
-  __func__(6,unsigned,7,long long) \
-  __func__(6,unsigned,8,int) \
-  __func__(6,unsigned,8,unsigned) \
-  __func__(6,unsigned,8,long long) \
-  __func__(6,long long,1,int) \
-  __func__(6,long long,1,unsigned) \
-  __func__(6,long long,1,long long) \
-  __func__(6,long long,2,int) \
-  __func__(6,long long,2,unsigned) \
-  __func__(6,long long,2,long long) \
-  __func__(6,long long,3,int) \
-  __func__(6,long long,3,unsigned) \
-  __func__(6,long long,3,long long) \
-  __func__(6,long long,4,int) \
-  __func__(6,long long,4,unsigned) \
-  __func__(6,long long,4,long long) \
-  __func__(6,long long,5,int) \
-  __func__(6,long long,5,unsigned) \
-  __func__(6,long long,5,long long) \
-  __func__(6,long long,6,int) \
-  __func__(6,long long,6,unsigned) \
-  __func__(6,long long,6,long long) \
-  __func__(6,long long,7,int) \
-  __func__(6,long long,7,unsigned) \
-  __func__(6,long long,7,long long) \
-  __func__(6,long long,8,int) \
-  __func__(6,long long,8,unsigned) \
-  __func__(6,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(6,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,8,long long)) \
 \
-  __func__(7,int,1,int) \
-  __func__(7,int,1,unsigned) \
-  __func__(7,int,1,long long) \
-  __func__(7,int,2,int) \
-  __func__(7,int,2,unsigned) \
-  __func__(7,int,2,long long) \
-  __func__(7,int,3,int) \
-  __func__(7,int,3,unsigned) \
-  __func__(7,int,3,long long) \
-  __func__(7,int,4,int) \
-  __func__(7,int,4,unsigned) \
-  __func__(7,int,4,long long) \
-  __func__(7,int,5,int) \
-  __func__(7,int,5,unsigned) \
-  __func__(7,int,5,long long) \
-  __func__(7,int,6,int) \
-  __func__(7,int,6,unsigned) \
-  __func__(7,int,6,long long) \
-  __func__(7,int,7,int) \
-  __func__(7,int,7,unsigned) \
-  __func__(7,int,7,long long) \
-  __func__(7,int,8,int) \
-  __func__(7,int,8,unsigned) \
-  __func__(7,int,8,long long) \
-  __func__(7,unsigned,1,int) \
-  __func__(7,unsigned,1,unsigned) \
-  __func__(7,unsigned,1,long long) \
-  __func__(7,unsigned,2,int) \
-  __func__(7,unsigned,2,unsigned) \
-  __func__(7,unsigned,2,long long) \
-  __func__(7,unsigned,3,int) \
-  __func__(7,unsigned,3,unsigned) \
-  __func__(7,unsigned,3,long long) \
-  __func__(7,unsigned,4,int) \
-  __func__(7,unsigned,4,unsigned) \
-  __func__(7,unsigned,4,long long) \
-  __func__(7,unsigned,5,int) \
-  __func__(7,unsigned,5,unsigned) \
-  __func__(7,unsigned,5,long long) \
-  __func__(7,unsigned,6,int) \
-  __func__(7,unsigned,6,unsigned) \
-  __func__(7,unsigned,6,long long) \
-  __func__(7,unsigned,7,int) \
-  __func__(7,unsigned,7,unsigned) \
-  __func__(7,unsigned,7,long long) \
-  __func__(7,unsigned,8,int) \
-  __func__(7,unsigned,8,unsigned) \
-  __func__(7,unsigned,8,long long) \
-  __func__(7,long long,1,int) \
-  __func__(7,long long,1,unsigned) \
-  __func__(7,long long,1,long long) \
-  __func__(7,long long,2,int) \
-  __func__(7,long long,2,unsigned) \
-  __func__(7,long long,2,long long) \
-  __func__(7,long long,3,int) \
-  __func__(7,long long,3,unsigned) \
-  __func__(7,long long,3,long long) \
-  __func__(7,long long,4,int) \
-  __func__(7,long long,4,unsigned) \
-  __func__(7,long long,4,long long) \
-  __func__(7,long long,5,int) \
-  __func__(7,long long,5,unsigned) \
-  __func__(7,long long,5,long long) \
-  __func__(7,long long,6,int) \
-  __func__(7,long long,6,unsigned) \
-  __func__(7,long long,6,long long) \
-  __func__(7,long long,7,int) \
-  __func__(7,long long,7,unsigned) \
-  __func__(7,long long,7,long long) \
-  __func__(7,long long,8,int) \
-  __func__(7,long long,8,unsigned) \
-  __func__(7,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(7,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,8,long long)) \
 \
-  __func__(8,int,1,int) \
-  __func__(8,int,1,unsigned) \
-  __func__(8,int,1,long long) \
-  __func__(8,int,2,int) \
-  __func__(8,int,2,unsigned) \
-  __func__(8,int,2,long long) \
-  __func__(8,int,3,int) \
-  __func__(8,int,3,unsigned) \
-  __func__(8,int,3,long long) \
-  __func__(8,int,4,int) \
-  __func__(8,int,4,unsigned) \
-  __func__(8,int,4,long long) \
-  __func__(8,int,5,int) \
-  __func__(8,int,5,unsigned) \
-  __func__(8,int,5,long long) \
-  __func__(8,int,6,int) \
-  __func__(8,int,6,unsigned) \
-  __func__(8,int,6,long long) \
-  __func__(8,int,7,int) \
-  __func__(8,int,7,unsigned) \
-  __func__(8,int,7,long long) \
-  __func__(8,int,8,int) \
-  __func__(8,int,8,unsigned) \
-  __func__(8,int,8,long long) \
-  __func__(8,unsigned,1,int) \
-  __func__(8,unsigned,1,unsigned) \
-  __func__(8,unsigned,1,long long) \
-  __func__(8,unsigned,2,int) \
-  __func__(8,unsigned,2,unsigned) \
-  __func__(8,unsigned,2,long long) \
-  __func__(8,unsigned,3,int) \
-  __func__(8,unsigned,3,unsigned) \
-  __func__(8,unsigned,3,long long) \
-  __func__(8,unsigned,4,int) \
-  __func__(8,unsigned,4,unsigned) \
-  __func__(8,unsigned,4,long long) \
-  __func__(8,unsigned,5,int) \
-  __func__(8,unsigned,5,unsigned) \
-  __func__(8,unsigned,5,long long) \
-  __func__(8,unsigned,6,int) \
-  __func__(8,unsigned,6,unsigned) \
-  __func__(8,unsigned,6,long long) \
-  __func__(8,unsigned,7,int) \
-  __func__(8,unsigned,7,unsigned) \
-  __func__(8,unsigned,7,long long) \
-  __func__(8,unsigned,8,int) \
-  __func__(8,unsigned,8,unsigned) \
-  __func__(8,unsigned,8,long long) \
-  __func__(8,long long,1,int) \
-  __func__(8,long long,1,unsigned) \
-  __func__(8,long long,1,long long) \
-  __func__(8,long long,2,int) \
-  __func__(8,long long,2,unsigned) \
-  __func__(8,long long,2,long long) \
-  __func__(8,long long,3,int) \
-  __func__(8,long long,3,unsigned) \
-  __func__(8,long long,3,long long) \
-  __func__(8,long long,4,int) \
-  __func__(8,long long,4,unsigned) \
-  __func__(8,long long,4,long long) \
-  __func__(8,long long,5,int) \
-  __func__(8,long long,5,unsigned) \
-  __func__(8,long long,5,long long) \
-  __func__(8,long long,6,int) \
-  __func__(8,long long,6,unsigned) \
-  __func__(8,long long,6,long long) \
-  __func__(8,long long,7,int) \
-  __func__(8,long long,7,unsigned) \
-  __func__(8,long long,7,long long) \
-  __func__(8,long long,8,int) \
-  __func__(8,long long,8,unsigned) \
-  __func__(8,long long,8,long long) \
+  REALM_CT_IF_INT_INT(__func__(8,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,8,long long)) \
 
 #elif REALM_MAX_DIM == 9
 
@@ -2555,828 +2555,828 @@ namespace Realm {
   __func__(9) \
 
 #define FOREACH_NT(__func__) \
-  __func__(1,int) \
-  __func__(1,unsigned) \
-  __func__(1,long long) \
-  __func__(2,int) \
-  __func__(2,unsigned) \
-  __func__(2,long long) \
-  __func__(3,int) \
-  __func__(3,unsigned) \
-  __func__(3,long long) \
-  __func__(4,int) \
-  __func__(4,unsigned) \
-  __func__(4,long long) \
-  __func__(5,int) \
-  __func__(5,unsigned) \
-  __func__(5,long long) \
-  __func__(6,int) \
-  __func__(6,unsigned) \
-  __func__(6,long long) \
-  __func__(7,int) \
-  __func__(7,unsigned) \
-  __func__(7,long long) \
-  __func__(8,int) \
-  __func__(8,unsigned) \
-  __func__(8,long long) \
-  __func__(9,int) \
-  __func__(9,unsigned) \
-  __func__(9,long long) \
+  REALM_CT_IF_INT(__func__(1,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long)) \
+  REALM_CT_IF_INT(__func__(2,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long)) \
+  REALM_CT_IF_INT(__func__(3,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long)) \
+  REALM_CT_IF_INT(__func__(4,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long)) \
+  REALM_CT_IF_INT(__func__(5,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long)) \
+  REALM_CT_IF_INT(__func__(6,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long)) \
+  REALM_CT_IF_INT(__func__(7,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long)) \
+  REALM_CT_IF_INT(__func__(8,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(8,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(8,long long)) \
+  REALM_CT_IF_INT(__func__(9,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(9,unsigned)) \
+  REALM_CT_IF_LONGLONG(__func__(9,long long)) \
 
 #define FOREACH_NTF(__func__) \
-  __func__(1,int,int) \
-  __func__(1,int,bool) \
-  __func__(1,unsigned,int) \
-  __func__(1,unsigned,bool) \
-  __func__(1,long long,int) \
-  __func__(1,long long,bool) \
-  __func__(2,int,int) \
-  __func__(2,int,bool) \
-  __func__(2,unsigned,int) \
-  __func__(2,unsigned,bool) \
-  __func__(2,long long,int) \
-  __func__(2,long long,bool) \
-  __func__(3,int,int) \
-  __func__(3,int,bool) \
-  __func__(3,unsigned,int) \
-  __func__(3,unsigned,bool) \
-  __func__(3,long long,int) \
-  __func__(3,long long,bool) \
-  __func__(4,int,int) \
-  __func__(4,int,bool) \
-  __func__(4,unsigned,int) \
-  __func__(4,unsigned,bool) \
-  __func__(4,long long,int) \
-  __func__(4,long long,bool) \
-  __func__(5,int,int) \
-  __func__(5,int,bool) \
-  __func__(5,unsigned,int) \
-  __func__(5,unsigned,bool) \
-  __func__(5,long long,int) \
-  __func__(5,long long,bool) \
-  __func__(6,int,int) \
-  __func__(6,int,bool) \
-  __func__(6,unsigned,int) \
-  __func__(6,unsigned,bool) \
-  __func__(6,long long,int) \
-  __func__(6,long long,bool) \
-  __func__(7,int,int) \
-  __func__(7,int,bool) \
-  __func__(7,unsigned,int) \
-  __func__(7,unsigned,bool) \
-  __func__(7,long long,int) \
-  __func__(7,long long,bool) \
-  __func__(8,int,int) \
-  __func__(8,int,bool) \
-  __func__(8,unsigned,int) \
-  __func__(8,unsigned,bool) \
-  __func__(8,long long,int) \
-  __func__(8,long long,bool) \
-  __func__(9,int,int) \
-  __func__(9,int,bool) \
-  __func__(9,unsigned,int) \
-  __func__(9,unsigned,bool) \
-  __func__(9,long long,int) \
-  __func__(9,long long,bool) \
+  REALM_CT_IF_INT(__func__(1,int,int)) \
+  REALM_CT_IF_INT(__func__(1,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(1,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(1,long long,bool)) \
+  REALM_CT_IF_INT(__func__(2,int,int)) \
+  REALM_CT_IF_INT(__func__(2,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(2,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(2,long long,bool)) \
+  REALM_CT_IF_INT(__func__(3,int,int)) \
+  REALM_CT_IF_INT(__func__(3,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(3,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(3,long long,bool)) \
+  REALM_CT_IF_INT(__func__(4,int,int)) \
+  REALM_CT_IF_INT(__func__(4,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(4,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(4,long long,bool)) \
+  REALM_CT_IF_INT(__func__(5,int,int)) \
+  REALM_CT_IF_INT(__func__(5,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(5,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(5,long long,bool)) \
+  REALM_CT_IF_INT(__func__(6,int,int)) \
+  REALM_CT_IF_INT(__func__(6,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(6,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(6,long long,bool)) \
+  REALM_CT_IF_INT(__func__(7,int,int)) \
+  REALM_CT_IF_INT(__func__(7,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(7,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(7,long long,bool)) \
+  REALM_CT_IF_INT(__func__(8,int,int)) \
+  REALM_CT_IF_INT(__func__(8,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(8,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(8,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(8,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(8,long long,bool)) \
+  REALM_CT_IF_INT(__func__(9,int,int)) \
+  REALM_CT_IF_INT(__func__(9,int,bool)) \
+  REALM_CT_IF_UNSIGNED(__func__(9,unsigned,int)) \
+  REALM_CT_IF_UNSIGNED(__func__(9,unsigned,bool)) \
+  REALM_CT_IF_LONGLONG(__func__(9,long long,int)) \
+  REALM_CT_IF_LONGLONG(__func__(9,long long,bool)) \
 
 #define FOREACH_NTNT(__func__) \
-  __func__(1,int,1,int) \
-  __func__(1,int,1,unsigned) \
-  __func__(1,int,1,long long) \
-  __func__(1,int,2,int) \
-  __func__(1,int,2,unsigned) \
-  __func__(1,int,2,long long) \
-  __func__(1,int,3,int) \
-  __func__(1,int,3,unsigned) \
-  __func__(1,int,3,long long) \
-  __func__(1,int,4,int) \
-  __func__(1,int,4,unsigned) \
-  __func__(1,int,4,long long) \
-  __func__(1,int,5,int) \
-  __func__(1,int,5,unsigned) \
-  __func__(1,int,5,long long) \
-  __func__(1,int,6,int) \
-  __func__(1,int,6,unsigned) \
-  __func__(1,int,6,long long) \
-  __func__(1,int,7,int) \
-  __func__(1,int,7,unsigned) \
-  __func__(1,int,7,long long) \
-  __func__(1,int,8,int) \
-  __func__(1,int,8,unsigned) \
-  __func__(1,int,8,long long) \
-  __func__(1,int,9,int) \
-  __func__(1,int,9,unsigned) \
-  __func__(1,int,9,long long) \
-  __func__(1,unsigned,1,int) \
-  __func__(1,unsigned,1,unsigned) \
-  __func__(1,unsigned,1,long long) \
-  __func__(1,unsigned,2,int) \
-  __func__(1,unsigned,2,unsigned) \
-  __func__(1,unsigned,2,long long) \
-  __func__(1,unsigned,3,int) \
-  __func__(1,unsigned,3,unsigned) \
-  __func__(1,unsigned,3,long long) \
-  __func__(1,unsigned,4,int) \
-  __func__(1,unsigned,4,unsigned) \
-  __func__(1,unsigned,4,long long) \
-  __func__(1,unsigned,5,int) \
-  __func__(1,unsigned,5,unsigned) \
-  __func__(1,unsigned,5,long long) \
-  __func__(1,unsigned,6,int) \
-  __func__(1,unsigned,6,unsigned) \
-  __func__(1,unsigned,6,long long) \
-  __func__(1,unsigned,7,int) \
-  __func__(1,unsigned,7,unsigned) \
-  __func__(1,unsigned,7,long long) \
-  __func__(1,unsigned,8,int) \
-  __func__(1,unsigned,8,unsigned) \
-  __func__(1,unsigned,8,long long) \
-  __func__(1,unsigned,9,int) \
-  __func__(1,unsigned,9,unsigned) \
-  __func__(1,unsigned,9,long long) \
-  __func__(1,long long,1,int) \
-  __func__(1,long long,1,unsigned) \
-  __func__(1,long long,1,long long) \
-  __func__(1,long long,2,int) \
-  __func__(1,long long,2,unsigned) \
-  __func__(1,long long,2,long long) \
-  __func__(1,long long,3,int) \
-  __func__(1,long long,3,unsigned) \
-  __func__(1,long long,3,long long) \
-  __func__(1,long long,4,int) \
-  __func__(1,long long,4,unsigned) \
-  __func__(1,long long,4,long long) \
-  __func__(1,long long,5,int) \
-  __func__(1,long long,5,unsigned) \
-  __func__(1,long long,5,long long) \
-  __func__(1,long long,6,int) \
-  __func__(1,long long,6,unsigned) \
-  __func__(1,long long,6,long long) \
-  __func__(1,long long,7,int) \
-  __func__(1,long long,7,unsigned) \
-  __func__(1,long long,7,long long) \
-  __func__(1,long long,8,int) \
-  __func__(1,long long,8,unsigned) \
-  __func__(1,long long,8,long long) \
-  __func__(1,long long,9,int) \
-  __func__(1,long long,9,unsigned) \
-  __func__(1,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(1,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(1,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(1,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(1,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(1,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(1,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(1,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(1,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(1,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(1,long long,9,long long)) \
 \
-  __func__(2,int,1,int) \
-  __func__(2,int,1,unsigned) \
-  __func__(2,int,1,long long) \
-  __func__(2,int,2,int) \
-  __func__(2,int,2,unsigned) \
-  __func__(2,int,2,long long) \
-  __func__(2,int,3,int) \
-  __func__(2,int,3,unsigned) \
-  __func__(2,int,3,long long) \
-  __func__(2,int,4,int) \
-  __func__(2,int,4,unsigned) \
-  __func__(2,int,4,long long) \
-  __func__(2,int,5,int) \
-  __func__(2,int,5,unsigned) \
-  __func__(2,int,5,long long) \
-  __func__(2,int,6,int) \
-  __func__(2,int,6,unsigned) \
-  __func__(2,int,6,long long) \
-  __func__(2,int,7,int) \
-  __func__(2,int,7,unsigned) \
-  __func__(2,int,7,long long) \
-  __func__(2,int,8,int) \
-  __func__(2,int,8,unsigned) \
-  __func__(2,int,8,long long) \
-  __func__(2,int,9,int) \
-  __func__(2,int,9,unsigned) \
-  __func__(2,int,9,long long) \
-  __func__(2,unsigned,1,int) \
-  __func__(2,unsigned,1,unsigned) \
-  __func__(2,unsigned,1,long long) \
-  __func__(2,unsigned,2,int) \
-  __func__(2,unsigned,2,unsigned) \
-  __func__(2,unsigned,2,long long) \
-  __func__(2,unsigned,3,int) \
-  __func__(2,unsigned,3,unsigned) \
-  __func__(2,unsigned,3,long long) \
-  __func__(2,unsigned,4,int) \
-  __func__(2,unsigned,4,unsigned) \
-  __func__(2,unsigned,4,long long) \
-  __func__(2,unsigned,5,int) \
-  __func__(2,unsigned,5,unsigned) \
-  __func__(2,unsigned,5,long long) \
-  __func__(2,unsigned,6,int) \
-  __func__(2,unsigned,6,unsigned) \
-  __func__(2,unsigned,6,long long) \
-  __func__(2,unsigned,7,int) \
-  __func__(2,unsigned,7,unsigned) \
-  __func__(2,unsigned,7,long long) \
-  __func__(2,unsigned,8,int) \
-  __func__(2,unsigned,8,unsigned) \
-  __func__(2,unsigned,8,long long) \
-  __func__(2,unsigned,9,int) \
-  __func__(2,unsigned,9,unsigned) \
-  __func__(2,unsigned,9,long long) \
-  __func__(2,long long,1,int) \
-  __func__(2,long long,1,unsigned) \
-  __func__(2,long long,1,long long) \
-  __func__(2,long long,2,int) \
-  __func__(2,long long,2,unsigned) \
-  __func__(2,long long,2,long long) \
-  __func__(2,long long,3,int) \
-  __func__(2,long long,3,unsigned) \
-  __func__(2,long long,3,long long) \
-  __func__(2,long long,4,int) \
-  __func__(2,long long,4,unsigned) \
-  __func__(2,long long,4,long long) \
-  __func__(2,long long,5,int) \
-  __func__(2,long long,5,unsigned) \
-  __func__(2,long long,5,long long) \
-  __func__(2,long long,6,int) \
-  __func__(2,long long,6,unsigned) \
-  __func__(2,long long,6,long long) \
-  __func__(2,long long,7,int) \
-  __func__(2,long long,7,unsigned) \
-  __func__(2,long long,7,long long) \
-  __func__(2,long long,8,int) \
-  __func__(2,long long,8,unsigned) \
-  __func__(2,long long,8,long long) \
-  __func__(2,long long,9,int) \
-  __func__(2,long long,9,unsigned) \
-  __func__(2,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(2,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(2,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(2,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(2,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(2,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(2,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(2,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(2,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(2,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(2,long long,9,long long)) \
 \
-  __func__(3,int,1,int) \
-  __func__(3,int,1,unsigned) \
-  __func__(3,int,1,long long) \
-  __func__(3,int,2,int) \
-  __func__(3,int,2,unsigned) \
-  __func__(3,int,2,long long) \
-  __func__(3,int,3,int) \
-  __func__(3,int,3,unsigned) \
-  __func__(3,int,3,long long) \
-  __func__(3,int,4,int) \
-  __func__(3,int,4,unsigned) \
-  __func__(3,int,4,long long) \
-  __func__(3,int,5,int) \
-  __func__(3,int,5,unsigned) \
-  __func__(3,int,5,long long) \
-  __func__(3,int,6,int) \
-  __func__(3,int,6,unsigned) \
-  __func__(3,int,6,long long) \
-  __func__(3,int,7,int) \
-  __func__(3,int,7,unsigned) \
-  __func__(3,int,7,long long) \
-  __func__(3,int,8,int) \
-  __func__(3,int,8,unsigned) \
-  __func__(3,int,8,long long) \
-  __func__(3,int,9,int) \
-  __func__(3,int,9,unsigned) \
-  __func__(3,int,9,long long) \
-  __func__(3,unsigned,1,int) \
-  __func__(3,unsigned,1,unsigned) \
-  __func__(3,unsigned,1,long long) \
-  __func__(3,unsigned,2,int) \
-  __func__(3,unsigned,2,unsigned) \
-  __func__(3,unsigned,2,long long) \
-  __func__(3,unsigned,3,int) \
-  __func__(3,unsigned,3,unsigned) \
-  __func__(3,unsigned,3,long long) \
-  __func__(3,unsigned,4,int) \
-  __func__(3,unsigned,4,unsigned) \
-  __func__(3,unsigned,4,long long) \
-  __func__(3,unsigned,5,int) \
-  __func__(3,unsigned,5,unsigned) \
-  __func__(3,unsigned,5,long long) \
-  __func__(3,unsigned,6,int) \
-  __func__(3,unsigned,6,unsigned) \
-  __func__(3,unsigned,6,long long) \
-  __func__(3,unsigned,7,int) \
-  __func__(3,unsigned,7,unsigned) \
-  __func__(3,unsigned,7,long long) \
-  __func__(3,unsigned,8,int) \
-  __func__(3,unsigned,8,unsigned) \
-  __func__(3,unsigned,8,long long) \
-  __func__(3,unsigned,9,int) \
-  __func__(3,unsigned,9,unsigned) \
-  __func__(3,unsigned,9,long long) \
-  __func__(3,long long,1,int) \
-  __func__(3,long long,1,unsigned) \
-  __func__(3,long long,1,long long) \
-  __func__(3,long long,2,int) \
-  __func__(3,long long,2,unsigned) \
-  __func__(3,long long,2,long long) \
-  __func__(3,long long,3,int) \
-  __func__(3,long long,3,unsigned) \
-  __func__(3,long long,3,long long) \
-  __func__(3,long long,4,int) \
-  __func__(3,long long,4,unsigned) \
-  __func__(3,long long,4,long long) \
-  __func__(3,long long,5,int) \
-  __func__(3,long long,5,unsigned) \
-  __func__(3,long long,5,long long) \
-  __func__(3,long long,6,int) \
-  __func__(3,long long,6,unsigned) \
-  __func__(3,long long,6,long long) \
-  __func__(3,long long,7,int) \
-  __func__(3,long long,7,unsigned) \
-  __func__(3,long long,7,long long) \
-  __func__(3,long long,8,int) \
-  __func__(3,long long,8,unsigned) \
-  __func__(3,long long,8,long long) \
-  __func__(3,long long,9,int) \
-  __func__(3,long long,9,unsigned) \
-  __func__(3,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(3,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(3,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(3,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(3,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(3,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(3,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(3,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(3,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(3,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(3,long long,9,long long)) \
 \
-  __func__(4,int,1,int) \
-  __func__(4,int,1,unsigned) \
-  __func__(4,int,1,long long) \
-  __func__(4,int,2,int) \
-  __func__(4,int,2,unsigned) \
-  __func__(4,int,2,long long) \
-  __func__(4,int,3,int) \
-  __func__(4,int,3,unsigned) \
-  __func__(4,int,3,long long) \
-  __func__(4,int,4,int) \
-  __func__(4,int,4,unsigned) \
-  __func__(4,int,4,long long) \
-  __func__(4,int,5,int) \
-  __func__(4,int,5,unsigned) \
-  __func__(4,int,5,long long) \
-  __func__(4,int,6,int) \
-  __func__(4,int,6,unsigned) \
-  __func__(4,int,6,long long) \
-  __func__(4,int,7,int) \
-  __func__(4,int,7,unsigned) \
-  __func__(4,int,7,long long) \
-  __func__(4,int,8,int) \
-  __func__(4,int,8,unsigned) \
-  __func__(4,int,8,long long) \
-  __func__(4,int,9,int) \
-  __func__(4,int,9,unsigned) \
-  __func__(4,int,9,long long) \
-  __func__(4,unsigned,1,int) \
-  __func__(4,unsigned,1,unsigned) \
-  __func__(4,unsigned,1,long long) \
-  __func__(4,unsigned,2,int) \
-  __func__(4,unsigned,2,unsigned) \
-  __func__(4,unsigned,2,long long) \
-  __func__(4,unsigned,3,int) \
-  __func__(4,unsigned,3,unsigned) \
-  __func__(4,unsigned,3,long long) \
-  __func__(4,unsigned,4,int) \
-  __func__(4,unsigned,4,unsigned) \
-  __func__(4,unsigned,4,long long) \
-  __func__(4,unsigned,5,int) \
-  __func__(4,unsigned,5,unsigned) \
-  __func__(4,unsigned,5,long long) \
-  __func__(4,unsigned,6,int) \
-  __func__(4,unsigned,6,unsigned) \
-  __func__(4,unsigned,6,long long) \
-  __func__(4,unsigned,7,int) \
-  __func__(4,unsigned,7,unsigned) \
-  __func__(4,unsigned,7,long long) \
-  __func__(4,unsigned,8,int) \
-  __func__(4,unsigned,8,unsigned) \
-  __func__(4,unsigned,8,long long) \
-  __func__(4,unsigned,9,int) \
-  __func__(4,unsigned,9,unsigned) \
-  __func__(4,unsigned,9,long long) \
-  __func__(4,long long,1,int) \
-  __func__(4,long long,1,unsigned) \
-  __func__(4,long long,1,long long) \
-  __func__(4,long long,2,int) \
-  __func__(4,long long,2,unsigned) \
-  __func__(4,long long,2,long long) \
-  __func__(4,long long,3,int) \
-  __func__(4,long long,3,unsigned) \
-  __func__(4,long long,3,long long) \
-  __func__(4,long long,4,int) \
-  __func__(4,long long,4,unsigned) \
-  __func__(4,long long,4,long long) \
-  __func__(4,long long,5,int) \
-  __func__(4,long long,5,unsigned) \
-  __func__(4,long long,5,long long) \
-  __func__(4,long long,6,int) \
-  __func__(4,long long,6,unsigned) \
-  __func__(4,long long,6,long long) \
-  __func__(4,long long,7,int) \
-  __func__(4,long long,7,unsigned) \
-  __func__(4,long long,7,long long) \
-  __func__(4,long long,8,int) \
-  __func__(4,long long,8,unsigned) \
-  __func__(4,long long,8,long long) \
-  __func__(4,long long,9,int) \
-  __func__(4,long long,9,unsigned) \
-  __func__(4,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(4,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(4,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(4,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(4,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(4,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(4,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(4,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(4,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(4,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(4,long long,9,long long)) \
 \
-  __func__(5,int,1,int) \
-  __func__(5,int,1,unsigned) \
-  __func__(5,int,1,long long) \
-  __func__(5,int,2,int) \
-  __func__(5,int,2,unsigned) \
-  __func__(5,int,2,long long) \
-  __func__(5,int,3,int) \
-  __func__(5,int,3,unsigned) \
-  __func__(5,int,3,long long) \
-  __func__(5,int,4,int) \
-  __func__(5,int,4,unsigned) \
-  __func__(5,int,4,long long) \
-  __func__(5,int,5,int) \
-  __func__(5,int,5,unsigned) \
-  __func__(5,int,5,long long) \
-  __func__(5,int,6,int) \
-  __func__(5,int,6,unsigned) \
-  __func__(5,int,6,long long) \
-  __func__(5,int,7,int) \
-  __func__(5,int,7,unsigned) \
-  __func__(5,int,7,long long) \
-  __func__(5,int,8,int) \
-  __func__(5,int,8,unsigned) \
-  __func__(5,int,8,long long) \
-  __func__(5,int,9,int) \
-  __func__(5,int,9,unsigned) \
-  __func__(5,int,9,long long) \
-  __func__(5,unsigned,1,int) \
-  __func__(5,unsigned,1,unsigned) \
-  __func__(5,unsigned,1,long long) \
-  __func__(5,unsigned,2,int) \
-  __func__(5,unsigned,2,unsigned) \
-  __func__(5,unsigned,2,long long) \
-  __func__(5,unsigned,3,int) \
-  __func__(5,unsigned,3,unsigned) \
-  __func__(5,unsigned,3,long long) \
-  __func__(5,unsigned,4,int) \
-  __func__(5,unsigned,4,unsigned) \
-  __func__(5,unsigned,4,long long) \
-  __func__(5,unsigned,5,int) \
-  __func__(5,unsigned,5,unsigned) \
-  __func__(5,unsigned,5,long long) \
-  __func__(5,unsigned,6,int) \
-  __func__(5,unsigned,6,unsigned) \
-  __func__(5,unsigned,6,long long) \
-  __func__(5,unsigned,7,int) \
-  __func__(5,unsigned,7,unsigned) \
-  __func__(5,unsigned,7,long long) \
-  __func__(5,unsigned,8,int) \
-  __func__(5,unsigned,8,unsigned) \
-  __func__(5,unsigned,8,long long) \
-  __func__(5,unsigned,9,int) \
-  __func__(5,unsigned,9,unsigned) \
-  __func__(5,unsigned,9,long long) \
-  __func__(5,long long,1,int) \
-  __func__(5,long long,1,unsigned) \
-  __func__(5,long long,1,long long) \
-  __func__(5,long long,2,int) \
-  __func__(5,long long,2,unsigned) \
-  __func__(5,long long,2,long long) \
-  __func__(5,long long,3,int) \
-  __func__(5,long long,3,unsigned) \
-  __func__(5,long long,3,long long) \
-  __func__(5,long long,4,int) \
-  __func__(5,long long,4,unsigned) \
-  __func__(5,long long,4,long long) \
-  __func__(5,long long,5,int) \
-  __func__(5,long long,5,unsigned) \
-  __func__(5,long long,5,long long) \
-  __func__(5,long long,6,int) \
-  __func__(5,long long,6,unsigned) \
-  __func__(5,long long,6,long long) \
-  __func__(5,long long,7,int) \
-  __func__(5,long long,7,unsigned) \
-  __func__(5,long long,7,long long) \
-  __func__(5,long long,8,int) \
-  __func__(5,long long,8,unsigned) \
-  __func__(5,long long,8,long long) \
-  __func__(5,long long,9,int) \
-  __func__(5,long long,9,unsigned) \
-  __func__(5,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(5,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(5,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(5,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(5,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(5,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(5,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(5,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(5,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(5,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(5,long long,9,long long)) \
 \
-  __func__(6,int,1,int) \
-  __func__(6,int,1,unsigned) \
-  __func__(6,int,1,long long) \
-  __func__(6,int,2,int) \
-  __func__(6,int,2,unsigned) \
-  __func__(6,int,2,long long) \
-  __func__(6,int,3,int) \
-  __func__(6,int,3,unsigned) \
-  __func__(6,int,3,long long) \
-  __func__(6,int,4,int) \
-  __func__(6,int,4,unsigned) \
-  __func__(6,int,4,long long) \
-  __func__(6,int,5,int) \
-  __func__(6,int,5,unsigned) \
-  __func__(6,int,5,long long) \
-  __func__(6,int,6,int) \
-  __func__(6,int,6,unsigned) \
-  __func__(6,int,6,long long) \
-  __func__(6,int,7,int) \
-  __func__(6,int,7,unsigned) \
-  __func__(6,int,7,long long) \
-  __func__(6,int,8,int) \
-  __func__(6,int,8,unsigned) \
-  __func__(6,int,8,long long) \
-  __func__(6,int,9,int) \
-  __func__(6,int,9,unsigned) \
-  __func__(6,int,9,long long) \
-  __func__(6,unsigned,1,int) \
-  __func__(6,unsigned,1,unsigned) \
-  __func__(6,unsigned,1,long long) \
-  __func__(6,unsigned,2,int) \
-  __func__(6,unsigned,2,unsigned) \
-  __func__(6,unsigned,2,long long) \
-  __func__(6,unsigned,3,int) \
-  __func__(6,unsigned,3,unsigned) \
-  __func__(6,unsigned,3,long long) \
-  __func__(6,unsigned,4,int) \
-  __func__(6,unsigned,4,unsigned) \
-  __func__(6,unsigned,4,long long) \
-  __func__(6,unsigned,5,int) \
-  __func__(6,unsigned,5,unsigned) \
-  __func__(6,unsigned,5,long long) \
-  __func__(6,unsigned,6,int) \
-  __func__(6,unsigned,6,unsigned) \
-  __func__(6,unsigned,6,long long) \
-  __func__(6,unsigned,7,int) \
-  __func__(6,unsigned,7,unsigned) \
-  __func__(6,unsigned,7,long long) \
-  __func__(6,unsigned,8,int) \
-  __func__(6,unsigned,8,unsigned) \
-  __func__(6,unsigned,8,long long) \
-  __func__(6,unsigned,9,int) \
-  __func__(6,unsigned,9,unsigned) \
-  __func__(6,unsigned,9,long long) \
-  __func__(6,long long,1,int) \
-  __func__(6,long long,1,unsigned) \
-  __func__(6,long long,1,long long) \
-  __func__(6,long long,2,int) \
-  __func__(6,long long,2,unsigned) \
-  __func__(6,long long,2,long long) \
-  __func__(6,long long,3,int) \
-  __func__(6,long long,3,unsigned) \
-  __func__(6,long long,3,long long) \
-  __func__(6,long long,4,int) \
-  __func__(6,long long,4,unsigned) \
-  __func__(6,long long,4,long long) \
-  __func__(6,long long,5,int) \
-  __func__(6,long long,5,unsigned) \
-  __func__(6,long long,5,long long) \
-  __func__(6,long long,6,int) \
-  __func__(6,long long,6,unsigned) \
-  __func__(6,long long,6,long long) \
-  __func__(6,long long,7,int) \
-  __func__(6,long long,7,unsigned) \
-  __func__(6,long long,7,long long) \
-  __func__(6,long long,8,int) \
-  __func__(6,long long,8,unsigned) \
-  __func__(6,long long,8,long long) \
-  __func__(6,long long,9,int) \
-  __func__(6,long long,9,unsigned) \
-  __func__(6,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(6,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(6,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(6,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(6,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(6,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(6,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(6,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(6,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(6,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(6,long long,9,long long)) \
 \
-  __func__(7,int,1,int) \
-  __func__(7,int,1,unsigned) \
-  __func__(7,int,1,long long) \
-  __func__(7,int,2,int) \
-  __func__(7,int,2,unsigned) \
-  __func__(7,int,2,long long) \
-  __func__(7,int,3,int) \
-  __func__(7,int,3,unsigned) \
-  __func__(7,int,3,long long) \
-  __func__(7,int,4,int) \
-  __func__(7,int,4,unsigned) \
-  __func__(7,int,4,long long) \
-  __func__(7,int,5,int) \
-  __func__(7,int,5,unsigned) \
-  __func__(7,int,5,long long) \
-  __func__(7,int,6,int) \
-  __func__(7,int,6,unsigned) \
-  __func__(7,int,6,long long) \
-  __func__(7,int,7,int) \
-  __func__(7,int,7,unsigned) \
-  __func__(7,int,7,long long) \
-  __func__(7,int,8,int) \
-  __func__(7,int,8,unsigned) \
-  __func__(7,int,8,long long) \
-  __func__(7,int,9,int) \
-  __func__(7,int,9,unsigned) \
-  __func__(7,int,9,long long) \
-  __func__(7,unsigned,1,int) \
-  __func__(7,unsigned,1,unsigned) \
-  __func__(7,unsigned,1,long long) \
-  __func__(7,unsigned,2,int) \
-  __func__(7,unsigned,2,unsigned) \
-  __func__(7,unsigned,2,long long) \
-  __func__(7,unsigned,3,int) \
-  __func__(7,unsigned,3,unsigned) \
-  __func__(7,unsigned,3,long long) \
-  __func__(7,unsigned,4,int) \
-  __func__(7,unsigned,4,unsigned) \
-  __func__(7,unsigned,4,long long) \
-  __func__(7,unsigned,5,int) \
-  __func__(7,unsigned,5,unsigned) \
-  __func__(7,unsigned,5,long long) \
-  __func__(7,unsigned,6,int) \
-  __func__(7,unsigned,6,unsigned) \
-  __func__(7,unsigned,6,long long) \
-  __func__(7,unsigned,7,int) \
-  __func__(7,unsigned,7,unsigned) \
-  __func__(7,unsigned,7,long long) \
-  __func__(7,unsigned,8,int) \
-  __func__(7,unsigned,8,unsigned) \
-  __func__(7,unsigned,8,long long) \
-  __func__(7,unsigned,9,int) \
-  __func__(7,unsigned,9,unsigned) \
-  __func__(7,unsigned,9,long long) \
-  __func__(7,long long,1,int) \
-  __func__(7,long long,1,unsigned) \
-  __func__(7,long long,1,long long) \
-  __func__(7,long long,2,int) \
-  __func__(7,long long,2,unsigned) \
-  __func__(7,long long,2,long long) \
-  __func__(7,long long,3,int) \
-  __func__(7,long long,3,unsigned) \
-  __func__(7,long long,3,long long) \
-  __func__(7,long long,4,int) \
-  __func__(7,long long,4,unsigned) \
-  __func__(7,long long,4,long long) \
-  __func__(7,long long,5,int) \
-  __func__(7,long long,5,unsigned) \
-  __func__(7,long long,5,long long) \
-  __func__(7,long long,6,int) \
-  __func__(7,long long,6,unsigned) \
-  __func__(7,long long,6,long long) \
-  __func__(7,long long,7,int) \
-  __func__(7,long long,7,unsigned) \
-  __func__(7,long long,7,long long) \
-  __func__(7,long long,8,int) \
-  __func__(7,long long,8,unsigned) \
-  __func__(7,long long,8,long long) \
-  __func__(7,long long,9,int) \
-  __func__(7,long long,9,unsigned) \
-  __func__(7,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(7,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(7,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(7,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(7,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(7,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(7,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(7,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(7,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(7,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(7,long long,9,long long)) \
 \
-  __func__(8,int,1,int) \
-  __func__(8,int,1,unsigned) \
-  __func__(8,int,1,long long) \
-  __func__(8,int,2,int) \
-  __func__(8,int,2,unsigned) \
-  __func__(8,int,2,long long) \
-  __func__(8,int,3,int) \
-  __func__(8,int,3,unsigned) \
-  __func__(8,int,3,long long) \
-  __func__(8,int,4,int) \
-  __func__(8,int,4,unsigned) \
-  __func__(8,int,4,long long) \
-  __func__(8,int,5,int) \
-  __func__(8,int,5,unsigned) \
-  __func__(8,int,5,long long) \
-  __func__(8,int,6,int) \
-  __func__(8,int,6,unsigned) \
-  __func__(8,int,6,long long) \
-  __func__(8,int,7,int) \
-  __func__(8,int,7,unsigned) \
-  __func__(8,int,7,long long) \
-  __func__(8,int,8,int) \
-  __func__(8,int,8,unsigned) \
-  __func__(8,int,8,long long) \
-  __func__(8,int,9,int) \
-  __func__(8,int,9,unsigned) \
-  __func__(8,int,9,long long) \
-  __func__(8,unsigned,1,int) \
-  __func__(8,unsigned,1,unsigned) \
-  __func__(8,unsigned,1,long long) \
-  __func__(8,unsigned,2,int) \
-  __func__(8,unsigned,2,unsigned) \
-  __func__(8,unsigned,2,long long) \
-  __func__(8,unsigned,3,int) \
-  __func__(8,unsigned,3,unsigned) \
-  __func__(8,unsigned,3,long long) \
-  __func__(8,unsigned,4,int) \
-  __func__(8,unsigned,4,unsigned) \
-  __func__(8,unsigned,4,long long) \
-  __func__(8,unsigned,5,int) \
-  __func__(8,unsigned,5,unsigned) \
-  __func__(8,unsigned,5,long long) \
-  __func__(8,unsigned,6,int) \
-  __func__(8,unsigned,6,unsigned) \
-  __func__(8,unsigned,6,long long) \
-  __func__(8,unsigned,7,int) \
-  __func__(8,unsigned,7,unsigned) \
-  __func__(8,unsigned,7,long long) \
-  __func__(8,unsigned,8,int) \
-  __func__(8,unsigned,8,unsigned) \
-  __func__(8,unsigned,8,long long) \
-  __func__(8,unsigned,9,int) \
-  __func__(8,unsigned,9,unsigned) \
-  __func__(8,unsigned,9,long long) \
-  __func__(8,long long,1,int) \
-  __func__(8,long long,1,unsigned) \
-  __func__(8,long long,1,long long) \
-  __func__(8,long long,2,int) \
-  __func__(8,long long,2,unsigned) \
-  __func__(8,long long,2,long long) \
-  __func__(8,long long,3,int) \
-  __func__(8,long long,3,unsigned) \
-  __func__(8,long long,3,long long) \
-  __func__(8,long long,4,int) \
-  __func__(8,long long,4,unsigned) \
-  __func__(8,long long,4,long long) \
-  __func__(8,long long,5,int) \
-  __func__(8,long long,5,unsigned) \
-  __func__(8,long long,5,long long) \
-  __func__(8,long long,6,int) \
-  __func__(8,long long,6,unsigned) \
-  __func__(8,long long,6,long long) \
-  __func__(8,long long,7,int) \
-  __func__(8,long long,7,unsigned) \
-  __func__(8,long long,7,long long) \
-  __func__(8,long long,8,int) \
-  __func__(8,long long,8,unsigned) \
-  __func__(8,long long,8,long long) \
-  __func__(8,long long,9,int) \
-  __func__(8,long long,9,unsigned) \
-  __func__(8,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(8,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(8,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(8,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(8,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(8,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(8,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(8,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(8,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(8,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(8,long long,9,long long)) \
 \
-  __func__(9,int,1,int) \
-  __func__(9,int,1,unsigned) \
-  __func__(9,int,1,long long) \
-  __func__(9,int,2,int) \
-  __func__(9,int,2,unsigned) \
-  __func__(9,int,2,long long) \
-  __func__(9,int,3,int) \
-  __func__(9,int,3,unsigned) \
-  __func__(9,int,3,long long) \
-  __func__(9,int,4,int) \
-  __func__(9,int,4,unsigned) \
-  __func__(9,int,4,long long) \
-  __func__(9,int,5,int) \
-  __func__(9,int,5,unsigned) \
-  __func__(9,int,5,long long) \
-  __func__(9,int,6,int) \
-  __func__(9,int,6,unsigned) \
-  __func__(9,int,6,long long) \
-  __func__(9,int,7,int) \
-  __func__(9,int,7,unsigned) \
-  __func__(9,int,7,long long) \
-  __func__(9,int,8,int) \
-  __func__(9,int,8,unsigned) \
-  __func__(9,int,8,long long) \
-  __func__(9,int,9,int) \
-  __func__(9,int,9,unsigned) \
-  __func__(9,int,9,long long) \
-  __func__(9,unsigned,1,int) \
-  __func__(9,unsigned,1,unsigned) \
-  __func__(9,unsigned,1,long long) \
-  __func__(9,unsigned,2,int) \
-  __func__(9,unsigned,2,unsigned) \
-  __func__(9,unsigned,2,long long) \
-  __func__(9,unsigned,3,int) \
-  __func__(9,unsigned,3,unsigned) \
-  __func__(9,unsigned,3,long long) \
-  __func__(9,unsigned,4,int) \
-  __func__(9,unsigned,4,unsigned) \
-  __func__(9,unsigned,4,long long) \
-  __func__(9,unsigned,5,int) \
-  __func__(9,unsigned,5,unsigned) \
-  __func__(9,unsigned,5,long long) \
-  __func__(9,unsigned,6,int) \
-  __func__(9,unsigned,6,unsigned) \
-  __func__(9,unsigned,6,long long) \
-  __func__(9,unsigned,7,int) \
-  __func__(9,unsigned,7,unsigned) \
-  __func__(9,unsigned,7,long long) \
-  __func__(9,unsigned,8,int) \
-  __func__(9,unsigned,8,unsigned) \
-  __func__(9,unsigned,8,long long) \
-  __func__(9,unsigned,9,int) \
-  __func__(9,unsigned,9,unsigned) \
-  __func__(9,unsigned,9,long long) \
-  __func__(9,long long,1,int) \
-  __func__(9,long long,1,unsigned) \
-  __func__(9,long long,1,long long) \
-  __func__(9,long long,2,int) \
-  __func__(9,long long,2,unsigned) \
-  __func__(9,long long,2,long long) \
-  __func__(9,long long,3,int) \
-  __func__(9,long long,3,unsigned) \
-  __func__(9,long long,3,long long) \
-  __func__(9,long long,4,int) \
-  __func__(9,long long,4,unsigned) \
-  __func__(9,long long,4,long long) \
-  __func__(9,long long,5,int) \
-  __func__(9,long long,5,unsigned) \
-  __func__(9,long long,5,long long) \
-  __func__(9,long long,6,int) \
-  __func__(9,long long,6,unsigned) \
-  __func__(9,long long,6,long long) \
-  __func__(9,long long,7,int) \
-  __func__(9,long long,7,unsigned) \
-  __func__(9,long long,7,long long) \
-  __func__(9,long long,8,int) \
-  __func__(9,long long,8,unsigned) \
-  __func__(9,long long,8,long long) \
-  __func__(9,long long,9,int) \
-  __func__(9,long long,9,unsigned) \
-  __func__(9,long long,9,long long) \
+  REALM_CT_IF_INT_INT(__func__(9,int,1,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,1,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,1,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,2,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,2,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,2,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,3,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,3,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,3,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,4,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,4,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,4,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,5,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,5,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,5,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,6,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,6,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,6,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,7,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,7,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,7,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,8,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,8,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,8,long long)) \
+  REALM_CT_IF_INT_INT(__func__(9,int,9,int)) \
+  REALM_CT_IF_INT_UNSIGNED(__func__(9,int,9,unsigned)) \
+  REALM_CT_IF_INT_LONGLONG(__func__(9,int,9,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,1,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,1,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,1,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,2,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,2,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,2,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,3,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,3,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,3,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,4,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,4,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,4,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,5,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,5,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,5,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,6,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,6,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,6,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,7,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,7,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,7,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,8,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,8,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,8,long long)) \
+  REALM_CT_IF_UNSIGNED_INT(__func__(9,unsigned,9,int)) \
+  REALM_CT_IF_UNSIGNED_UNSIGNED(__func__(9,unsigned,9,unsigned)) \
+  REALM_CT_IF_UNSIGNED_LONGLONG(__func__(9,unsigned,9,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,1,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,1,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,1,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,2,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,2,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,2,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,3,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,3,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,3,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,4,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,4,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,4,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,5,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,5,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,5,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,6,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,6,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,6,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,7,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,7,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,7,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,8,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,8,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,8,long long)) \
+  REALM_CT_IF_LONGLONG_INT(__func__(9,long long,9,int)) \
+  REALM_CT_IF_LONGLONG_UNSIGNED(__func__(9,long long,9,unsigned)) \
+  REALM_CT_IF_LONGLONG_LONGLONG(__func__(9,long long,9,long long)) \
 
 #else
 #error "Illegal value of REALM_MAX_DIM"
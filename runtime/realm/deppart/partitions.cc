@@ -44,6 +44,7 @@ namespace Realm {
     int cfg_max_rects_in_approximation = 32;
     bool cfg_worker_threads_sleep = true;
     bool cfg_allow_inline_operations = false;
+    int cfg_max_union_microop_inputs = 64; // 0 = never split wide unions
   };
 
   // TODO: C++11 has type_traits and std::make_unsigned
@@ -856,6 +857,7 @@ namespace Realm {
     cp.add_option_bool("-dp:noisectopt", DeppartConfig::cfg_disable_intersection_optimization);
     cp.add_option_int("-dp:sleep", DeppartConfig::cfg_worker_threads_sleep);
     cp.add_option_int("-dp:inline_ok", DeppartConfig::cfg_allow_inline_operations);
+    cp.add_option_int("-dp:union_split", DeppartConfig::cfg_max_union_microop_inputs);
 
     cp.parse_command_line(cmdline);
   }
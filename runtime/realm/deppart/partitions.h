@@ -147,7 +147,19 @@ namespace Realm {
 
   ////////////////////////////////////////
   //
-  
+
+  // a single PartitioningOperation covers an entire batch of same-kind
+  //  requests (e.g. one UnionOperation for a whole compute_unions call,
+  //  one ImageOperation for all targets of a compute_images call), and a
+  //  chain like image(preimage(union(...))) is a chain of such operations:
+  //  each launches immediately, its micro-ops deferring on the sparsity
+  //  maps of its inputs rather than on the upstream operation's finish
+  //  event, so downstream work starts as soon as the data it reads is
+  //  valid.  each link in the chain does materialize its full intermediate
+  //  sparsity map - fusing across operation kinds (streaming one op's
+  //  output rects into the next without materializing) would require the
+  //  caller to hand us the whole operator DAG up front, which the
+  //  one-call-per-operation IndexSpace API cannot express
   class PartitioningOperation : public Operation {
   public:
     PartitioningOperation(const ProfilingRequestSet &reqs,
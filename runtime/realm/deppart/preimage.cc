@@ -98,21 +98,45 @@ namespace Realm {
   {
     // for now, one access for the whole instance
     AffineAccessor<Point<N2,T2>,N,T> a_data(inst, field_offset);
+    const size_t stride0 = a_data.strides[0];
 
     // double iteration - use the instance's space first, since it's probably smaller
     for(IndexSpaceIterator<N,T> it(inst_space); it.valid; it.step()) {
       for(IndexSpaceIterator<N,T> it2(parent_space, it.rect); it2.valid; it2.step()) {
-	// now iterate over each point
-	for(PointInRectIterator<N,T> pir(it2.rect); pir.valid; pir.step()) {
-	  // fetch the pointer and test it against every possible target (ugh)
-	  Point<N2,T2> ptr = a_data.read(pir.p);
+	// now iterate over each point - walk a raw pointer along each dim-0
+	//  span rather than redoing the affine offset arithmetic per point
+	Point<N,T> p = it2.rect.lo;
+	while(true) {
+	  const char *elem = reinterpret_cast<const char *>(a_data.ptr(p));
+	  Point<N,T> p2 = p;
+	  while(true) {
+	    // fetch the pointer and test it against every possible target (ugh)
+	    const Point<N2,T2>& ptr = *reinterpret_cast<const Point<N2,T2> *>(elem);
+
+	    for(size_t i = 0; i < targets.size(); i++)
+	      if(targets[i].contains(ptr)) {
+		BM *&bmp = bitmasks[i];
+		if(!bmp) bmp = new BM;
+		bmp->add_point(p2);
+	      }
+
+	    if(p2[0] >= it2.rect.hi[0]) break;
+	    p2[0]++;
+	    elem += stride0;
+	  }
 
-	  for(size_t i = 0; i < targets.size(); i++)
-	    if(targets[i].contains(ptr)) {
-	      BM *&bmp = bitmasks[i];
-	      if(!bmp) bmp = new BM;
-	      bmp->add_point(pir.p);
+	  // are we done?
+	  if(p2 == it2.rect.hi) break;
+
+	  // now go to the next span, if there is one (can't be in 1-D)
+	  assert(N > 1);
+	  for(int j = 0; j < (N - 1); j++) {
+	    p[j] = it2.rect.lo[j];
+	    if(p[j + 1] < it2.rect.hi[j + 1]) {
+	      p[j + 1] += 1;
+	      break;
 	    }
+	  }
 	}
       }
     }
@@ -164,21 +188,23 @@ namespace Realm {
 #endif
 
     // iterate over sparsity outputs and contribute to all (even if we didn't have any
-    //  points found for it)
-    int empty_count = 0;
+    //  points found for it) - empty contributions are batched so that a wide-fanout
+    //  preimage sends one message per owner node instead of one per empty output
+    std::vector<SparsityMap<N,T> > empty_outputs;
     for(size_t i = 0; i < sparsity_outputs.size(); i++) {
-      SparsityMapImpl<N,T> *impl = SparsityMapImpl<N,T>::lookup(sparsity_outputs[i]);
       typename std::map<int, DenseRectangleList<N,T> *>::const_iterator it2 = rect_map.find(i);
       if(it2 != rect_map.end()) {
+	SparsityMapImpl<N,T> *impl = SparsityMapImpl<N,T>::lookup(sparsity_outputs[i]);
 	impl->contribute_dense_rect_list(it2->second->rects, true /*disjoint*/);
 	delete it2->second;
       } else {
-	impl->contribute_nothing();
-	empty_count++;
+	empty_outputs.push_back(sparsity_outputs[i]);
       }
     }
-    if(empty_count > 0)
-      log_part.info() << empty_count << " empty preimages (out of " << sparsity_outputs.size() << ")";
+    if(!empty_outputs.empty()) {
+      SparsityMapImpl<N,T>::contribute_nothing_many(empty_outputs);
+      log_part.info() << empty_outputs.size() << " empty preimages (out of " << sparsity_outputs.size() << ")";
+    }
   }
 
   template <int N, typename T, int N2, typename T2>
@@ -1154,6 +1154,65 @@ namespace Realm {
   ActiveMessageHandlerReg<RemoteMicroOpMessage<UnionMicroOp<N,T> > > UnionMicroOp<N,T>::areg;
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class BatchedRectIntersector<N,T>
+
+  // tests one rectangle against many at once, holding the batch in
+  //  structure-of-arrays form so that the per-dimension compares across
+  //  the whole batch vectorize instead of branching rect by rect
+  template <int N, typename T>
+  class BatchedRectIntersector {
+  public:
+    BatchedRectIntersector(const IndexSpace<N,T>& space, const Rect<N,T>& bounds)
+    {
+      for(IndexSpaceIterator<N,T> it(space, bounds); it.valid; it.step())
+	add_rect(it.rect);
+    }
+
+    void add_rect(const Rect<N,T>& r)
+    {
+      for(int d = 0; d < N; d++) {
+	los[d].push_back(r.lo[d]);
+	his[d].push_back(r.hi[d]);
+      }
+    }
+
+    bool empty(void) const { return los[0].empty(); }
+
+    // adds the (nonempty) intersection of 'r' with each rectangle in the
+    //  batch to 'bitmask'
+    template <typename BM>
+    void intersect_with(const Rect<N,T>& r, BM& bitmask)
+    {
+      const size_t count = los[0].size();
+      hits.assign(count, 1);
+      for(int d = 0; d < N; d++) {
+	const T *lo = los[d].data();
+	const T *hi = his[d].data();
+	const T rlo = r.lo[d];
+	const T rhi = r.hi[d];
+	char *hit = hits.data();
+	for(size_t i = 0; i < count; i++)
+	  hit[i] &= char((lo[i] <= rhi) && (hi[i] >= rlo));
+      }
+      for(size_t i = 0; i < count; i++) {
+	if(!hits[i]) continue;
+	Rect<N,T> isect;
+	for(int d = 0; d < N; d++) {
+	  isect.lo[d] = std::max(los[d][i], r.lo[d]);
+	  isect.hi[d] = std::min(his[d][i], r.hi[d]);
+	}
+	bitmask.add_rect(isect);
+      }
+    }
+
+  protected:
+    std::vector<T> los[N], his[N];
+    std::vector<char> hits; // reused across calls to intersect_with
+  };
+
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class IntersectionMicroOp<N,T>
@@ -1241,12 +1300,16 @@ namespace Realm {
       return;
     }
 
-    // handle 2 input case with simple double-iteration
+    // handle 2 input case by batching one side's rectangles (restricted
+    //  to the common bounds) and testing each rectangle of the other side
+    //  against the whole batch - this replaces the per-rectangle nested
+    //  iterator walk with loops the compiler can vectorize
     if(inputs.size() == 2) {
-      // double iteration - use the instance's space first, since it's probably smaller
+      BatchedRectIntersector<N,T> batch(inputs[1], bounds);
+      if(batch.empty())
+	return;
       for(IndexSpaceIterator<N,T> it(inputs[0], bounds); it.valid; it.step())
-	for(IndexSpaceIterator<N,T> it2(inputs[1], it.rect); it2.valid; it2.step())
-	  bitmask.add_rect(it2.rect);
+	batch.intersect_with(it.rect, bitmask);
     } else {
       assert(0);
     }
@@ -1656,11 +1719,27 @@ namespace Realm {
   void UnionOperation<N,T>::execute(void)
   {
     for(size_t i = 0; i < outputs.size(); i++) {
-      SparsityMapImpl<N,T>::lookup(outputs[i])->set_contributor_count(1);
-
-      UnionMicroOp<N,T> *uop = new UnionMicroOp<N,T>(inputs[i]);
-      uop->add_sparsity_output(outputs[i]);
-      uop->dispatch(this, true /* ok to run in this thread */);
+      // a union with many operands is split into multiple micro-ops, each
+      //  merging a slice of the operand list - the partial results run
+      //  concurrently on the op queue and the sparsity map owner combines
+      //  them (as it would contributions from other nodes) when finalizing
+      size_t max_inputs = ((DeppartConfig::cfg_max_union_microop_inputs > 0) ?
+			     size_t(DeppartConfig::cfg_max_union_microop_inputs) :
+			     inputs[i].size());
+      size_t num_uops = (inputs[i].size() + max_inputs - 1) / max_inputs;
+      SparsityMapImpl<N,T>::lookup(outputs[i])->set_contributor_count(num_uops);
+
+      for(size_t j = 0; j < num_uops; j++) {
+	size_t lo = j * max_inputs;
+	size_t hi = std::min(lo + max_inputs, inputs[i].size());
+	UnionMicroOp<N,T> *uop =
+	  new UnionMicroOp<N,T>(std::vector<IndexSpace<N,T> >(inputs[i].begin() + lo,
+							      inputs[i].begin() + hi));
+	uop->add_sparsity_output(outputs[i]);
+	// only an unsplit union may run inline - split pieces go to the
+	//  queue so that multiple workers can pick them up
+	uop->dispatch(this, (num_uops == 1) /* ok to run in this thread */);
+      }
     }
   }
 
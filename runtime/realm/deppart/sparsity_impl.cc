@@ -24,6 +24,9 @@
 #include "realm/deppart/inst_helper.h"
 #include "realm/logging.h"
 
+#include <stdint.h>
+#include <string.h>
+
 namespace Realm {
 
   extern Logger log_part;
@@ -1036,17 +1039,19 @@ namespace Realm {
   void SparsityMapCommunicator<N, T>::send_contribute(SparsityMap<N, T> me,
                                                       size_t piece_count,
                                                       size_t total_count, bool disjoint,
-                                                      const void *data, size_t datalen)
+                                                      const void *data, size_t datalen,
+                                                      bool compressed)
   {
     send_contribute(ID(me).sparsity_creator_node(), me, piece_count, total_count,
-                    disjoint, data, datalen);
+                    disjoint, data, datalen, compressed);
   }
 
   template <int N, typename T>
   void SparsityMapCommunicator<N, T>::send_contribute(NodeID target, SparsityMap<N, T> me,
                                                       size_t piece_count,
                                                       size_t total_count, bool disjoint,
-                                                      const void *data, size_t datalen)
+                                                      const void *data, size_t datalen,
+                                                      bool compressed)
   {
     ActiveMessage<typename SparsityMapImpl<N, T>::RemoteSparsityContrib> amsg(target,
                                                                               datalen);
@@ -1054,12 +1059,25 @@ namespace Realm {
     amsg->piece_count = piece_count;
     amsg->total_count = total_count;
     amsg->disjoint = disjoint;
+    amsg->compressed = compressed;
     if(data && datalen) {
       amsg.add_payload(data, datalen, PAYLOAD_COPY);
     }
     amsg.commit();
   }
 
+  template <int N, typename T>
+  void SparsityMapCommunicator<N, T>::send_contribute_nothing(
+      NodeID target, const SparsityMap<N, T> *maps, size_t count)
+  {
+    size_t bytes = count * sizeof(SparsityMap<N, T>);
+    ActiveMessage<typename SparsityMapImpl<N, T>::RemoteSparsityContribNothing> amsg(
+        target, bytes);
+    amsg->count = count;
+    amsg.add_payload(maps, bytes, PAYLOAD_COPY);
+    amsg.commit();
+  }
+
   template <int N, typename T>
   size_t SparsityMapCommunicator<N, T>::recommend_max_payload(NodeID owner,
                                                               bool with_congestion)
@@ -1097,6 +1115,92 @@ namespace Realm {
     }
   }
 
+  template <int N, typename T>
+  /*static*/ void SparsityMapImpl<N, T>::contribute_nothing_many(
+      const std::vector<SparsityMap<N, T>> &maps)
+  {
+    // handle local maps directly, but group remote maps by owner node so
+    //  that each owner gets a single message rather than one per map
+    std::map<NodeID, std::vector<SparsityMap<N, T>>> by_owner;
+    for(size_t i = 0; i < maps.size(); i++) {
+      NodeID owner = ID(maps[i]).sparsity_creator_node();
+      if(owner == Network::my_node_id)
+        lookup(maps[i])->contribute_nothing();
+      else
+        by_owner[owner].push_back(maps[i]);
+    }
+
+    for(typename std::map<NodeID, std::vector<SparsityMap<N, T>>>::const_iterator it =
+            by_owner.begin();
+        it != by_owner.end(); ++it) {
+      // any impl owned by this node can supply the communicator - respect its
+      //  recommended payload limit in case the batch is enormous
+      SparsityMapImpl<N, T> *impl = lookup(it->second[0]);
+      size_t max_per_packet = (impl->sparsity_comm->recommend_max_payload(
+                                   it->first, /*with_congestion=*/false) /
+                               sizeof(SparsityMap<N, T>));
+      assert(max_per_packet > 0);
+      size_t ofs = 0;
+      while(ofs < it->second.size()) {
+        size_t count = std::min(it->second.size() - ofs, max_per_packet);
+        impl->sparsity_comm->send_contribute_nothing(it->first, &it->second[ofs], count);
+        ofs += count;
+      }
+    }
+  }
+
+  // rectangle lists sent over the wire tend to have a lot of redundancy in
+  //  their coordinates - when the coordinate type is wider than 32 bits, we
+  //  try to encode each piece as its first rectangle at full precision
+  //  followed by 32-bit deltas between successive rectangles, roughly halving
+  //  the payload for 64-bit coordinates
+  template <int N, typename T>
+  static bool encode_rect_deltas(const Rect<N, T> *rects, size_t count,
+                                 std::vector<char> &encoded)
+  {
+    // a single rectangle is no larger than the base, so don't bother
+    if(count < 2)
+      return false;
+
+    // every delta must fit in 32 bits or we have to fall back to raw rects
+    for(size_t i = 1; i < count; i++)
+      for(int j = 0; j < N; j++) {
+        long long dlo = ((long long)rects[i].lo[j] - (long long)rects[i - 1].lo[j]);
+        long long dhi = ((long long)rects[i].hi[j] - (long long)rects[i - 1].hi[j]);
+        if((dlo < INT32_MIN) || (dlo > INT32_MAX) || (dhi < INT32_MIN) ||
+           (dhi > INT32_MAX))
+          return false;
+      }
+
+    encoded.resize(sizeof(Rect<N, T>) + ((count - 1) * (2 * N * sizeof(int32_t))));
+    memcpy(encoded.data(), &rects[0], sizeof(Rect<N, T>));
+    int32_t *deltas = reinterpret_cast<int32_t *>(encoded.data() + sizeof(Rect<N, T>));
+    for(size_t i = 1; i < count; i++)
+      for(int j = 0; j < N; j++) {
+        *deltas++ = int32_t(rects[i].lo[j] - rects[i - 1].lo[j]);
+        *deltas++ = int32_t(rects[i].hi[j] - rects[i - 1].hi[j]);
+      }
+    return true;
+  }
+
+  template <int N, typename T>
+  static void decode_rect_deltas(const void *data, size_t datalen,
+                                 std::vector<Rect<N, T>> &rects)
+  {
+    assert(datalen >= sizeof(Rect<N, T>));
+    assert(((datalen - sizeof(Rect<N, T>)) % (2 * N * sizeof(int32_t))) == 0);
+    size_t count = 1 + ((datalen - sizeof(Rect<N, T>)) / (2 * N * sizeof(int32_t)));
+    rects.resize(count);
+    memcpy(&rects[0], data, sizeof(Rect<N, T>));
+    const int32_t *deltas = reinterpret_cast<const int32_t *>(
+        static_cast<const char *>(data) + sizeof(Rect<N, T>));
+    for(size_t i = 1; i < count; i++)
+      for(int j = 0; j < N; j++) {
+        rects[i].lo[j] = rects[i - 1].lo[j] + *deltas++;
+        rects[i].hi[j] = rects[i - 1].hi[j] + *deltas++;
+      }
+  }
+
   template <int N, typename T>
   void
   SparsityMapImpl<N, T>::contribute_dense_rect_list(const std::vector<Rect<N, T>> &rects,
@@ -1113,21 +1217,35 @@ namespace Realm {
       const Rect<N, T> *rdata = (rects.empty() ? 0 : &rects[0]);
       size_t num_pieces = 0;
       size_t remaining = rects.size();
+      std::vector<char> encoded;
       // send partial messages first
       while(remaining > max_to_send) {
 
+        const void *payload = reinterpret_cast<const void *>(rdata);
         size_t bytes = max_to_send * sizeof(Rect<N, T>);
-        sparsity_comm->send_contribute(me, 0, 0, disjoint,
-                                       reinterpret_cast<const void *>(rdata), bytes);
+        bool compressed = ((sizeof(T) > sizeof(int32_t)) &&
+                           encode_rect_deltas(rdata, max_to_send, encoded));
+        if(compressed) {
+          payload = encoded.data();
+          bytes = encoded.size();
+        }
+        sparsity_comm->send_contribute(me, 0, 0, disjoint, payload, bytes, compressed);
         num_pieces++;
         remaining -= max_to_send;
         rdata += max_to_send;
       }
 
       // final message includes the count of all messages (including this one!)
+      const void *payload = reinterpret_cast<const void *>(rdata);
       size_t bytes = remaining * sizeof(Rect<N, T>);
-      sparsity_comm->send_contribute(me, num_pieces + 1, 0, disjoint,
-                                     reinterpret_cast<const void *>(rdata), bytes);
+      bool compressed = ((sizeof(T) > sizeof(int32_t)) &&
+                         encode_rect_deltas(rdata, remaining, encoded));
+      if(compressed) {
+        payload = encoded.data();
+        bytes = encoded.size();
+      }
+      sparsity_comm->send_contribute(me, num_pieces + 1, 0, disjoint, payload, bytes,
+                                     compressed);
       return;
     }
 
@@ -1515,21 +1633,36 @@ namespace Realm {
       const size_t max_to_send = max_bytes_per_packet / sizeof(Rect<N, T>);
       assert(max_to_send > 0);
       size_t num_pieces = 0;
+      std::vector<char> encoded;
 
       // send partial messages first
       while(remaining > max_to_send) {
+        const void *payload = rdata;
         size_t bytes = max_to_send * sizeof(Rect<N, T>);
+        bool compressed = ((sizeof(T) > sizeof(int32_t)) &&
+                           encode_rect_deltas(rdata, max_to_send, encoded));
+        if(compressed) {
+          payload = encoded.data();
+          bytes = encoded.size();
+        }
         sparsity_comm->send_contribute(requestor, me, 0, total_count, /*disjoint=*/true,
-                                       rdata, bytes);
+                                       payload, bytes, compressed);
         num_pieces++;
         remaining -= max_to_send;
         rdata += max_to_send;
       }
 
       // final message includes the count of all messages (including this one!)
+      const void *payload = rdata;
       size_t bytes = remaining * sizeof(Rect<N, T>);
+      bool compressed = ((sizeof(T) > sizeof(int32_t)) &&
+                         encode_rect_deltas(rdata, remaining, encoded));
+      if(compressed) {
+        payload = encoded.data();
+        bytes = encoded.size();
+      }
       sparsity_comm->send_contribute(requestor, me, num_pieces + 1, total_count,
-                                     /*disjoint=*/true, rdata, bytes);
+                                     /*disjoint=*/true, payload, bytes, compressed);
     }
   }
 
@@ -1839,6 +1972,10 @@ namespace Realm {
       typename SparsityMapImpl<N, T>::RemoteSparsityContrib>
       SparsityMapImpl<N, T>::remote_sparsity_contrib_reg;
   template <int N, typename T>
+  /*static*/ ActiveMessageHandlerReg<
+      typename SparsityMapImpl<N, T>::RemoteSparsityContribNothing>
+      SparsityMapImpl<N, T>::remote_sparsity_contrib_nothing_reg;
+  template <int N, typename T>
   /*static*/ ActiveMessageHandlerReg<
       typename SparsityMapImpl<N, T>::SetContribCountMessage>
       SparsityMapImpl<N, T>::set_contrib_count_msg_reg;
@@ -1876,13 +2013,40 @@ namespace Realm {
       const void *data, size_t datalen)
   {
     log_part.info() << "received remote contribution: sparsity=" << msg.sparsity
-                    << " len=" << datalen;
-    size_t count = datalen / sizeof(Rect<N, T>);
-    assert((datalen % sizeof(Rect<N, T>)) == 0);
+                    << " len=" << datalen << " compressed=" << msg.compressed;
     SparsityMapImpl<N, T> *impl = SparsityMapImpl<N, T>::lookup(msg.sparsity);
     impl->record_remote_contributor(sender);
-    impl->contribute_raw_rects((const Rect<N, T> *)data, count, msg.piece_count,
-                               msg.disjoint, msg.total_count);
+    if(msg.compressed) {
+      std::vector<Rect<N, T>> rects;
+      decode_rect_deltas(data, datalen, rects);
+      impl->contribute_raw_rects(&rects[0], rects.size(), msg.piece_count, msg.disjoint,
+                                 msg.total_count);
+    } else {
+      size_t count = datalen / sizeof(Rect<N, T>);
+      assert((datalen % sizeof(Rect<N, T>)) == 0);
+      impl->contribute_raw_rects((const Rect<N, T> *)data, count, msg.piece_count,
+                                 msg.disjoint, msg.total_count);
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class SparsityMapImpl<N,T>::RemoteSparsityContribNothing
+
+  template <int N, typename T>
+  inline /*static*/ void
+  SparsityMapImpl<N, T>::RemoteSparsityContribNothing::handle_message(
+      NodeID sender, const SparsityMapImpl<N, T>::RemoteSparsityContribNothing &msg,
+      const void *data, size_t datalen)
+  {
+    log_part.info() << "received remote empty contributions: count=" << msg.count;
+    assert(datalen == (msg.count * sizeof(SparsityMap<N, T>)));
+    const SparsityMap<N, T> *maps = static_cast<const SparsityMap<N, T> *>(data);
+    for(size_t i = 0; i < msg.count; i++) {
+      SparsityMapImpl<N, T> *impl = SparsityMapImpl<N, T>::lookup(maps[i]);
+      impl->record_remote_contributor(sender);
+      impl->contribute_nothing();
+    }
   }
 
   ////////////////////////////////////////////////////////////////////////
@@ -82,11 +82,16 @@ namespace Realm {
 
     virtual void send_contribute(SparsityMap<N, T> me, size_t piece_count,
                                  size_t total_count, bool disjoint,
-                                 const void *data = nullptr, size_t datalen = 0);
+                                 const void *data = nullptr, size_t datalen = 0,
+                                 bool compressed = false);
 
     virtual void send_contribute(NodeID target, SparsityMap<N, T> me, size_t piece_count,
                                  size_t total_count, bool disjoint,
-                                 const void *data = nullptr, size_t datalen = 0);
+                                 const void *data = nullptr, size_t datalen = 0,
+                                 bool compressed = false);
+
+    virtual void send_contribute_nothing(NodeID target, const SparsityMap<N, T> *maps,
+                                         size_t count);
 
     virtual size_t recommend_max_payload(NodeID owner, bool with_congestion);
   };
@@ -122,6 +127,11 @@ namespace Realm {
     void record_remote_contributor(NodeID contributor);
 
     void contribute_nothing(void);
+    // batched form of contribute_nothing for uops that produce many empty
+    //  outputs (e.g. a wide-fanout preimage) - local maps are handled
+    //  directly and remote maps are batched into one message per owner node
+    //  instead of one per map
+    static void contribute_nothing_many(const std::vector<SparsityMap<N, T>> &maps);
     void contribute_dense_rect_list(const std::vector<Rect<N, T>> &rects, bool disjoint);
     void contribute_raw_rects(const Rect<N, T> *rects, size_t count, size_t piece_count,
                               bool disjoint, size_t total_count);
@@ -152,11 +162,20 @@ namespace Realm {
                           //   are known to be disjoint
       size_t total_count; // if non-zero, advertises the known total number of
                           //  recangles in the sparsity map
+      bool compressed;    // if set, payload is one full-precision rectangle
+                          //  followed by 32-bit coordinate deltas
 
       static void handle_message(NodeID sender, const RemoteSparsityContrib &msg,
                                  const void *data, size_t datalen);
     };
 
+    struct RemoteSparsityContribNothing {
+      size_t count; // number of SparsityMap<N,T> ids in the payload
+
+      static void handle_message(NodeID sender, const RemoteSparsityContribNothing &msg,
+                                 const void *data, size_t datalen);
+    };
+
     struct SetContribCountMessage {
       SparsityMap<N, T> sparsity;
       size_t count;
@@ -170,6 +189,8 @@ namespace Realm {
 
     static ActiveMessageHandlerReg<RemoteSparsityRequest> remote_sparsity_request_reg;
     static ActiveMessageHandlerReg<RemoteSparsityContrib> remote_sparsity_contrib_reg;
+    static ActiveMessageHandlerReg<RemoteSparsityContribNothing>
+        remote_sparsity_contrib_nothing_reg;
     static ActiveMessageHandlerReg<SetContribCountMessage> set_contrib_count_msg_reg;
 
     atomic<int> remaining_contributor_count{0};
@@ -94,7 +94,7 @@ namespace Realm {
       DynamicTableFreeList(DynamicTable<ALLOCATOR>& _table, int _owner, DynamicTableFreeList<ALLOCATOR> *_parent_list = nullptr);
 
       void push_front(ET *entry);
-      void push_front(ET *head, ET *tail);
+      void push_front(ET *head, ET *tail, size_t count);
       ET *pop_front_underlock(void);
       ET *pop_front(void);
 
@@ -105,6 +105,16 @@ namespace Realm {
       // these entries do not go on the local free list unless they are deleted after being used
       void alloc_range(int requested, IT& first_id, IT& last_id);
 
+      // constructs the next window of entries (leasing the id range from the
+      // parent list if we have one) and pushes all of them onto the free list -
+      // building a window constructs and faults in an entire leaf of the
+      // table, so this is intended to be called from a background worker
+      // before the list runs dry rather than stalling an allocator on it
+      void prefill_next_window(void);
+      // returns true if the free list is running low enough on entries that
+      // a call to 'prefill_next_window' would be worthwhile
+      bool needs_prefill(void) const;
+
       DynamicTable<ALLOCATOR>& table;
       // Free list from which we will coordinate reservation of IDs from
       DynamicTableFreeList<ALLOCATOR> *parent_list;
@@ -112,6 +122,8 @@ namespace Realm {
       LT lock;
       atomic<ET *> first_free;
       IT next_alloc;
+      // approximate count of entries currently on the free list
+      atomic<size_t> free_count;
     };
 
     template <typename _ET, size_t _INNER_BITS, size_t _LEAF_BITS>
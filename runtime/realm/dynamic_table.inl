@@ -412,6 +412,7 @@ namespace Realm {
   template <typename ALLOCATOR>
   DynamicTableFreeList<ALLOCATOR>::DynamicTableFreeList(DynamicTable<ALLOCATOR>& _table, int _owner, DynamicTableFreeList<ALLOCATOR> *_parent_list)
     : table(_table), parent_list(_parent_list), owner(_owner), first_free(0), next_alloc(0)
+    , free_count(0)
   {
     assert((parent_list == nullptr) || (parent_list->parent_list == nullptr));
     ALLOCATOR::register_freelist(this);
@@ -427,9 +428,10 @@ namespace Realm {
     do {
       entry->next_free = old_free;
     } while (!first_free.compare_exchange(old_free, entry));
+    free_count.fetch_add(1);
   }
   template<typename ALLOCATOR>
-  void DynamicTableFreeList<ALLOCATOR>::push_front(DynamicTableFreeList<ALLOCATOR>::ET *head, DynamicTableFreeList<ALLOCATOR>::ET *tail)
+  void DynamicTableFreeList<ALLOCATOR>::push_front(DynamicTableFreeList<ALLOCATOR>::ET *head, DynamicTableFreeList<ALLOCATOR>::ET *tail, size_t count)
   {
     // no need for lock - use compare and swap to push item onto front of
     //  free list (no ABA problem because the popper is mutex'd)
@@ -437,6 +439,7 @@ namespace Realm {
     do {
       tail->next_free = old_head;
     } while (!first_free.compare_exchange(old_head, head));
+    free_count.fetch_add(count);
   }
 
   template<typename ALLOCATOR>
@@ -450,6 +453,7 @@ namespace Realm {
       ;
     if(old_first != nullptr) {
       old_first->next_free = nullptr;
+      free_count.fetch_sub(1);
     }
     return old_first;
   }
@@ -508,7 +512,11 @@ namespace Realm {
         ET *rest = head->next_free;
         head->next_free = nullptr;
         if(REALM_LIKELY(rest != nullptr)) {
-          push_front(rest, tail);
+          // the new leaf contributed one entry per id in the window (less
+          //  the unused global index 0) and we're keeping 'head' ourselves
+          const size_t count =
+              (((size_t)1) << ALLOCATOR::LEAF_BITS) - ((to_lookup == 0) ? 2 : 1);
+          push_front(rest, tail, count);
         }
         return head;
       }
@@ -552,4 +560,40 @@ namespace Realm {
     last_id = first_id + (requested - 1);
   }
 
+  template <typename ALLOCATOR>
+  void DynamicTableFreeList<ALLOCATOR>::prefill_next_window(void)
+  {
+    IT to_lookup;
+    {
+      // reserve the next window the same way alloc_entry's refill does so
+      //  the two can safely interleave
+      AutoLock<> al(lock);
+      if(parent_list != nullptr) {
+        ID::IDType end_id;
+        parent_list->alloc_range(((IT)1) << ALLOCATOR::LEAF_BITS, next_alloc, end_id);
+      }
+      to_lookup = next_alloc;
+      next_alloc += ((IT)1) << ALLOCATOR::LEAF_BITS;
+    }
+
+    // the lookup constructs (and faults in) the whole leaf, stitching the
+    //  new entries into a list we then publish on the free list
+    ET *head = nullptr, *tail = nullptr;
+    ET *dummy = table.lookup_entry(to_lookup, owner, &head, &tail);
+    assert(dummy != 0);
+    (void)dummy;
+    if(REALM_LIKELY(head != nullptr)) {
+      const size_t count =
+          (((size_t)1) << ALLOCATOR::LEAF_BITS) - ((to_lookup == 0) ? 1 : 0);
+      push_front(head, tail, count);
+    }
+  }
+
+  template <typename ALLOCATOR>
+  bool DynamicTableFreeList<ALLOCATOR>::needs_prefill(void) const
+  {
+    // running low means less than a quarter of a window's worth of entries
+    return (free_count.load() < ((((size_t)1) << ALLOCATOR::LEAF_BITS) >> 2));
+  }
+
 }; // namespace Realm
@@ -25,6 +25,60 @@ namespace Realm {
   Logger log_event("event");
   Logger log_poison("poison");
 
+  namespace ThreadLocal {
+    // threads that are not bound to a processor (e.g. dma workers and
+    //  background work threads) allocate events from a per-thread free list
+    //  parented to the runtime's global list, avoiding contention on the
+    //  global list's mutex
+    thread_local LocalEventTableAllocator::FreeList *event_free_list = nullptr;
+  };
+
+  namespace {
+    // track the per-thread lists so they can be deleted at shutdown - any
+    //  entries still sitting on one remain stealable through the parent
+    //  list in the meantime
+    Mutex thread_event_free_lists_mutex;
+    std::vector<LocalEventTableAllocator::FreeList *> thread_event_free_lists;
+  }; // namespace
+
+  static LocalEventTableAllocator::FreeList *
+  get_thread_event_free_list(RuntimeImpl *runtime_impl)
+  {
+    if(ThreadLocal::event_free_list == nullptr) {
+      LocalEventTableAllocator::FreeList *free_list =
+          new LocalEventTableAllocator::FreeList(runtime_impl->local_events,
+                                                 Network::my_node_id,
+                                                 runtime_impl->local_event_free_list);
+      {
+        AutoLock<> al(thread_event_free_lists_mutex);
+        thread_event_free_lists.push_back(free_list);
+      }
+      ThreadLocal::event_free_list = free_list;
+    }
+    return ThreadLocal::event_free_list;
+  }
+
+  void cleanup_thread_event_free_lists(void)
+  {
+    AutoLock<> al(thread_event_free_lists_mutex);
+    delete_container_contents(thread_event_free_lists);
+    // any other threads that had a free list are gone by the time we are
+    //  called, so only our own pointer needs to be cleared
+    ThreadLocal::event_free_list = nullptr;
+  }
+
+  // an event with no owning processor goes back to the calling thread's
+  //  free list if it has one, or the global free list if not - creation is
+  //  left to the allocation path so that a free from a previously-unseen
+  //  thread does not reserve a fresh id range
+  static void free_untracked_genevent(GenEventImpl *event_impl)
+  {
+    LocalEventTableAllocator::FreeList *free_list = ThreadLocal::event_free_list;
+    if(free_list == nullptr)
+      free_list = get_runtime()->local_event_free_list;
+    free_list->free_entry(event_impl);
+  }
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class Event
@@ -403,6 +457,11 @@ namespace Realm {
     // if non-zero, eagerly checks deferred user event triggers for loops up to the
     //  specified limit
     int event_loop_detection_limit = 0;
+
+    // if positive, trigger updates for events with more remote subscribers
+    //  than this radix are propagated along a spanning tree of the
+    //  subscriber nodes instead of point-to-point from the owner
+    int event_broadcast_radix = 0;
   }; // namespace Config
 
   void UserEvent::trigger(Event wait_on, bool ignore_faults) const
@@ -788,7 +847,7 @@ namespace Realm {
               event_impl->trigger(finish_gen, Network::my_node_id, true /*poisoned*/,
                                   TimeLimit::responsive());
           if(free_event) {
-            get_runtime()->local_event_free_list->free_entry(event_impl);
+            free_untracked_genevent(event_impl);
           }
         }
       }
@@ -850,7 +909,7 @@ namespace Realm {
         bool free_event = event_impl->trigger(finish_gen, Network::my_node_id,
                                               true /*poisoned*/, work_until);
         if(free_event) {
-          get_runtime()->local_event_free_list->free_entry(event_impl);
+          free_untracked_genevent(event_impl);
         }
       }
     }
@@ -896,7 +955,7 @@ namespace Realm {
         bool free_event = event_impl->trigger(finish_gen, Network::my_node_id,
                                               false /*!poisoned*/, work_until);
         if(free_event) {
-          get_runtime()->local_event_free_list->free_entry(event_impl);
+          free_untracked_genevent(event_impl);
         }
       }
 
@@ -907,7 +966,7 @@ namespace Realm {
           if(event_impl->owning_processor) {
             event_impl->owning_processor->free_genevent(event_impl);
           } else {
-            get_runtime()->local_event_free_list->free_entry(event_impl);
+            free_untracked_genevent(event_impl);
           }
         }
       }
@@ -974,6 +1033,17 @@ namespace Realm {
       impl->handle_remote_subscription(sender, subscribe_gen,
                                        args.previous_subscribe_gen);
     }
+
+    // a subscription that races with a trigger that already happened gets
+    //  its update sent straight back from the polling thread instead of
+    //  waiting for a background worker - the reply is what a remote waiter
+    //  is blocked on, so the handoff is pure added latency
+    static bool handle_inline(NodeID sender, const EventSubscribeMessage &args,
+                              const void *data, size_t datalen, TimeLimit work_until)
+    {
+      handle_message(sender, args, data, datalen);
+      return true;
+    }
   };
 
   struct EventTriggerMessage {
@@ -989,9 +1059,19 @@ namespace Realm {
       bool free_event = impl->trigger(ID(args.event).event_generation(), sender,
                                       args.poisoned, work_until);
       if(free_event) {
-        get_runtime()->local_event_free_list->free_entry(impl);
+        free_untracked_genevent(impl);
       }
     }
+
+    // event triggers are latency-critical, so run them directly in the
+    //  polling thread when a time budget is available - the trigger call
+    //  defers any waiter work that does not fit in the budget
+    static bool handle_inline(NodeID sender, const EventTriggerMessage &args,
+                              const void *data, size_t datalen, TimeLimit work_until)
+    {
+      handle_message(sender, args, data, datalen, work_until);
+      return true;
+    }
   };
 
   struct EventUpdateMessage {
@@ -1014,8 +1094,90 @@ namespace Realm {
       impl->process_update(ID(args.event).event_generation(), new_poisoned_gens,
                            new_poisoned_count, work_until);
     }
+
+    // like remote triggers, updates of untriggered generations are on the
+    //  critical path for remote waiters, so handle them inline as well
+    static bool handle_inline(NodeID sender, const EventUpdateMessage &args,
+                              const void *data, size_t datalen, TimeLimit work_until)
+    {
+      handle_message(sender, args, data, datalen, work_until);
+      return true;
+    }
+  };
+
+  struct EventUpdateBroadcastMessage {
+    Event event;
+    unsigned poisoned_count; // leading payload entries are poisoned generations
+    unsigned radix;          // fan-out used at every level of the tree
+    unsigned index;          // recipient's position in the subscriber list
+
+    static void handle_message(NodeID sender, const EventUpdateBroadcastMessage &args,
+                               const void *data, size_t datalen, TimeLimit work_until);
   };
 
+  // sends one level of an update broadcast - the payload holds the poisoned
+  //  generations followed by the ordered list of all subscriber nodes, so
+  //  each recipient can forward to its own children in the tree
+  static void send_event_update_broadcast(NodeID target, Event event,
+                                          unsigned poisoned_count, unsigned radix,
+                                          unsigned index, const void *payload,
+                                          size_t payload_size)
+  {
+    // updates for different events that fan out through the same child are
+    //  batched into one network message when the configuration permits it
+    ActiveMessageCoalescer *coalescer = get_runtime()->message_coalescer;
+    if((coalescer != nullptr) &&
+       ActiveMessageCoalescer::is_batchable(sizeof(EventUpdateBroadcastMessage),
+                                            payload_size)) {
+      EventUpdateBroadcastMessage msg;
+      msg.event = event;
+      msg.poisoned_count = poisoned_count;
+      msg.radix = radix;
+      msg.index = index;
+      coalescer->enqueue(target, msg, payload, payload_size);
+      return;
+    }
+    ActiveMessage<EventUpdateBroadcastMessage> amsg(target, payload, payload_size);
+    amsg->event = event;
+    amsg->poisoned_count = poisoned_count;
+    amsg->radix = radix;
+    amsg->index = index;
+    amsg.commit();
+  }
+
+  /*static*/ void EventUpdateBroadcastMessage::handle_message(
+      NodeID sender, const EventUpdateBroadcastMessage &args, const void *data,
+      size_t datalen, TimeLimit work_until)
+  {
+    const EventImpl::gen_t *new_poisoned_gens =
+        static_cast<const EventImpl::gen_t *>(data);
+    size_t gen_bytes = args.poisoned_count * sizeof(EventImpl::gen_t);
+    assert(gen_bytes <= datalen);
+    const NodeID *subscribers =
+        reinterpret_cast<const NodeID *>(static_cast<const char *>(data) + gen_bytes);
+    size_t num_subscribers = (datalen - gen_bytes) / sizeof(NodeID);
+    assert((gen_bytes + (num_subscribers * sizeof(NodeID))) == datalen);
+
+    log_event.debug() << "event update (bcast): event=" << args.event
+                      << " index=" << args.index << " poisoned="
+                      << ArrayOstreamHelper<EventImpl::gen_t>(new_poisoned_gens,
+                                                              args.poisoned_count);
+
+    // forward to our children in the tree before doing local wakeups so
+    //  the deeper levels aren't serialized behind them
+    for(unsigned j = 0; j < args.radix; j++) {
+      size_t child = (size_t(args.radix) * (args.index + 1)) + j;
+      if(child >= num_subscribers)
+        break;
+      send_event_update_broadcast(subscribers[child], args.event, args.poisoned_count,
+                                  args.radix, child, data, datalen);
+    }
+
+    GenEventImpl *impl = get_runtime()->get_genevent_impl(args.event);
+    impl->process_update(ID(args.event).event_generation(), new_poisoned_gens,
+                         args.poisoned_count, work_until);
+  }
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class EventCommunicator
@@ -1023,6 +1185,17 @@ namespace Realm {
 
   void EventCommunicator::trigger(Event event, NodeID owner, bool poisoned)
   {
+    // trigger messages are tiny and high-rate, so coalesce them when the
+    //  configuration permits it
+    ActiveMessageCoalescer *coalescer = get_runtime()->message_coalescer;
+    if((coalescer != nullptr) &&
+       ActiveMessageCoalescer::is_batchable(sizeof(EventTriggerMessage), 0)) {
+      EventTriggerMessage msg;
+      msg.event = event;
+      msg.poisoned = poisoned;
+      coalescer->enqueue(owner, msg);
+      return;
+    }
     ActiveMessage<EventTriggerMessage> amsg(owner);
     amsg->event = event;
     amsg->poisoned = poisoned;
@@ -1032,6 +1205,32 @@ namespace Realm {
   void EventCommunicator::update(Event event, NodeSet to_update,
                                  span<EventImpl::gen_t> poisoned_generations)
   {
+    // with enough subscribers (and if enabled), fan the update out through a
+    //  spanning tree of the subscribers rather than sending every message
+    //  from the owner
+    int radix = Config::event_broadcast_radix;
+    if((radix > 0) && (to_update.size() > size_t(radix))) {
+      std::vector<NodeID> subscribers;
+      subscribers.reserve(to_update.size());
+      for(const NodeID node : to_update)
+        subscribers.push_back(node);
+
+      size_t gen_bytes = poisoned_generations.size() * sizeof(EventImpl::gen_t);
+      std::vector<char> payload(gen_bytes + (subscribers.size() * sizeof(NodeID)));
+      if(gen_bytes > 0)
+        memcpy(payload.data(), poisoned_generations.data(), gen_bytes);
+      memcpy(payload.data() + gen_bytes, subscribers.data(),
+             subscribers.size() * sizeof(NodeID));
+
+      size_t roots = std::min(size_t(radix), subscribers.size());
+      for(size_t i = 0; i < roots; i++)
+        send_event_update_broadcast(subscribers[i], event,
+                                    unsigned(poisoned_generations.size()),
+                                    unsigned(radix), unsigned(i), payload.data(),
+                                    payload.size());
+      return;
+    }
+
     for(const NodeID node : to_update) {
       update(event, node, poisoned_generations);
     }
@@ -1283,7 +1482,12 @@ namespace Realm {
       assert(proc_impl != nullptr);
       impl = proc_impl->create_genevent();
     } else {
-      impl = runtime_impl->local_event_free_list->alloc_entry();
+      LocalEventTableAllocator::FreeList *free_list =
+          get_thread_event_free_list(runtime_impl);
+      impl = free_list->alloc_entry();
+      // top up the free list in the background before it runs dry
+      if(free_list->needs_prefill())
+        runtime_impl->event_prefiller.request_prefill(free_list);
     }
 
     assert(impl != nullptr);
@@ -1912,4 +2116,6 @@ namespace Realm {
   ActiveMessageHandlerReg<EventSubscribeMessage> event_subscribe_message_handler;
   ActiveMessageHandlerReg<EventTriggerMessage> event_trigger_message_handler;
   ActiveMessageHandlerReg<EventUpdateMessage> event_update_message_handler;
+  ActiveMessageHandlerReg<EventUpdateBroadcastMessage>
+      event_update_broadcast_message_handler;
 }; // namespace Realm
@@ -44,6 +44,11 @@ namespace Realm {
   extern Logger log_poison; // defined in event_impl.cc
   class ProcessorImpl;      // defined in proc_impl.h
 
+  // deletes the per-thread event free lists created for threads that
+  //  allocate events while not bound to a processor - called during
+  //  runtime shutdown
+  void cleanup_thread_event_free_lists(void);
+
   class EventWaiter {
   public:
     virtual ~EventWaiter(void) {}
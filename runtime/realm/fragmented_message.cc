@@ -23,7 +23,6 @@ namespace Realm {
 
   FragmentedMessage::FragmentedMessage(uint32_t total_chunks)
     : total_chunks(total_chunks)
-    , received_chunks(total_chunks)
     , received_flags(total_chunks, false)
   {}
 
@@ -33,8 +32,43 @@ namespace Realm {
       return false;
     }
 
-    received_chunks[chunk_id].resize(size);
-    std::memcpy(received_chunks[chunk_id].data(), data, size);
+    if(chunk_sizes.empty()) {
+      chunk_sizes.resize(total_chunks, 0);
+    }
+    chunk_sizes[chunk_id] = size;
+
+    if(total_chunks == 1) {
+      // single-chunk message, the arena is just the payload
+      arena.assign(static_cast<const char *>(data),
+                   static_cast<const char *>(data) + size);
+    } else {
+      if((chunk_size == 0) && (chunk_id < (total_chunks - 1))) {
+        // the first non-final chunk fixes the arena layout - size slots for
+        // every chunk up front so later arrivals never reallocate
+        chunk_size = size;
+        arena.resize(chunk_size * size_t(total_chunks));
+        // chunks that beat the layout (e.g. a short final chunk) were
+        // parked in the overflow store - move the ones that fit into
+        // their slots now
+        for(std::map<uint32_t, std::vector<char> >::iterator it =
+              overflow.begin(); it != overflow.end(); ) {
+          if(it->second.size() <= chunk_size) {
+            std::memcpy(arena.data() + size_t(it->first) * chunk_size,
+                        it->second.data(), it->second.size());
+            it = overflow.erase(it);
+          } else
+            ++it;
+        }
+      }
+      if((chunk_size > 0) && (size <= chunk_size)) {
+        std::memcpy(arena.data() + size_t(chunk_id) * chunk_size, data, size);
+      } else {
+        // either the layout is not known yet or this chunk does not fit its
+        // slot - keep it separately and compact on reassembly
+        overflow[chunk_id].assign(static_cast<const char *>(data),
+                                  static_cast<const char *>(data) + size);
+      }
+    }
     received_flags[chunk_id] = true;
     received_count++;
     total_size += size;
@@ -49,18 +83,42 @@ namespace Realm {
 
   size_t FragmentedMessage::size() const { return total_size; }
 
-  std::vector<char> FragmentedMessage::reassemble() const
+  std::vector<char> FragmentedMessage::reassemble()
   {
-    std::vector<char> message;
     if(!is_complete()) {
-      return message;
+      return std::vector<char>();
     }
 
-    message.reserve(size());
-    for(const std::vector<char> &chunk : received_chunks) {
-      message.insert(message.end(), chunk.begin(), chunk.end());
+    // fast path: every non-final chunk was the uniform size the sender
+    // promised and everything landed in its arena slot, so the arena is
+    // already the payload - trim the tail and hand it to the caller
+    bool uniform = overflow.empty();
+    if(uniform && (total_chunks > 1)) {
+      for(uint32_t i = 0; (i + 1) < total_chunks; i++)
+        if(chunk_sizes[i] != chunk_size) {
+          uniform = false;
+          break;
+        }
+    }
+    if(uniform) {
+      arena.resize(total_size);
+      return std::move(arena);
     }
 
-    return message;
+    // uneven chunks - compact them in order into a fresh buffer
+    std::vector<char> result;
+    result.reserve(total_size);
+    for(uint32_t i = 0; i < total_chunks; i++) {
+      std::map<uint32_t, std::vector<char> >::const_iterator it =
+        overflow.find(i);
+      if(it != overflow.end()) {
+        result.insert(result.end(), it->second.begin(), it->second.end());
+      } else {
+        std::vector<char>::const_iterator slot =
+          arena.begin() + size_t(i) * chunk_size;
+        result.insert(result.end(), slot, slot + chunk_sizes[i]);
+      }
+    }
+    return result;
   }
 } // namespace Realm
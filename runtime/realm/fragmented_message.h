@@ -18,6 +18,7 @@
 
 #include "realm/realm_config.h"
 
+#include <map>
 #include <vector>
 #include <cstdint>
 #include <cstring>
@@ -51,8 +52,16 @@ namespace Realm {
    * A few design notes:
    *   • Duplicate fragments are ignored, allowing simple resend logic on the
    *     transmit path.
-   *   • No per-fragment dynamic allocations are performed – each chunk's
-   *     storage is reserved exactly once when its size becomes known.
+   *   • Fragments are copied straight into a single contiguous reassembly
+   *     arena rather than into per-fragment buffers.  The sender cuts every
+   *     chunk except the last to the same size, so the first non-final chunk
+   *     to arrive fixes the arena layout and out-of-order arrivals land at
+   *     `chunk_id * chunk_size` with no further allocation.  A chunk that
+   *     arrives before the layout is known, or that does not fit its slot,
+   *     is kept separately.  When every chunk matched the uniform layout,
+   *     `reassemble()` hands the arena back by move with no concatenation
+   *     copy; uneven chunks are tolerated and compacted in order on
+   *     reassembly instead.
    */
 
   class FragmentedMessage {
@@ -63,12 +72,21 @@ namespace Realm {
 
     bool is_complete() const;
     size_t size() const;
-    std::vector<char> reassemble() const;
+    std::vector<char> reassemble();
 
   private:
     uint32_t total_chunks{0};
     size_t total_size{0};
-    std::vector<std::vector<char>> received_chunks;
+    // uniform size of every non-final chunk, zero until one arrives
+    size_t chunk_size{0};
+    // contiguous reassembly arena indexed by chunk_id * chunk_size
+    std::vector<char> arena;
+    // actual size of every received chunk, used to detect uneven chunks
+    // that require compaction on reassembly
+    std::vector<size_t> chunk_sizes;
+    // chunks that arrived before the arena could be laid out or that do
+    // not fit their arena slot
+    std::map<uint32_t, std::vector<char> > overflow;
     std::vector<bool> received_flags;
     uint32_t received_count{0};
   };
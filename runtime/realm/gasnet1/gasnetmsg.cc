@@ -2478,7 +2478,7 @@ void IncomingMessageNew::run_handler(void)
 
   if(Config::profile_activemsg_handlers)
     activemsg_handler_table.record_message_handler_call(header.hdr.msgid,
-							t_start, t_end);
+							t_start, t_end, nbytes);
 }
 
 int IncomingMessageNew::get_peer(void)
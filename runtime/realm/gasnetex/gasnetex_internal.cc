@@ -2709,8 +2709,12 @@ namespace Realm {
       pktbuf->dec_usecount();
     if(databuf)
       databuf->dec_usecount();
-    if(rget)
-      rget->rgetter->reverse_get_complete(rget);
+    if(rget) {
+      // an rget may have been issued as multiple striped gets - only the
+      //  last piece to arrive completes the rget as a whole
+      if(rget->chunks_left.fetch_sub(1) == 1)
+        rget->rgetter->reverse_get_complete(rget);
+    }
     if(put)
       put->xpair->enqueue_put_header(put);
   }
@@ -3065,6 +3069,9 @@ namespace Realm {
     , internal(_internal)
     , head(0)
     , tailp(&head)
+    , total_rgets(0)
+    , total_striped_rgets(0)
+    , total_striped_bytes(0)
   {}
 
   void ReverseGetter::add_reverse_get(gex_rank_t srcrank, gex_ep_index_t src_ep_index,
@@ -3118,19 +3125,51 @@ namespace Realm {
     }
 
     while(true) {
+      // a sufficiently large get is split into multiple concurrent gets so
+      //  that a multi-rail-capable conduit can spread the pieces across
+      //  NICs - the rget completes only when all pieces have arrived
+      size_t stripe_size = rget->payload_bytes;
+      unsigned num_stripes = 1;
+      if((internal->module->cfg_rget_stripe_size > 0) &&
+         (internal->module->cfg_rget_stripe_count > 1) &&
+         (rget->payload_bytes > internal->module->cfg_rget_stripe_size)) {
+        // divide as evenly as possible, keeping pieces cache-line aligned
+        stripe_size = (((rget->payload_bytes /
+                         internal->module->cfg_rget_stripe_count) + 255) &
+                       ~size_t(255));
+        if(stripe_size < 256)
+          stripe_size = 256;
+        num_stripes = ((rget->payload_bytes + stripe_size - 1) /
+                       stripe_size);
+      }
+
       log_gex.info() << "issuing get: "
 		     << rget->srcrank << "/" << rget->src_ep_index << "/"
 		     << std::hex << rget->src_ptr << std::dec
 		     << " -> " << rget->tgt_ep_index << "/"
 		     << std::hex << rget->tgt_ptr << std::dec
-		     << " size=" << rget->payload_bytes;
+		     << " size=" << rget->payload_bytes
+		     << " stripes=" << num_stripes;
       // be careful here - the "target" is the issuer of the get
-      gex_event_opaque_t done = gex_wrapper_handle.gex_rma_iget(
-          internal->eps[rget->tgt_ep_index], rget->src_ep_index,
-          reinterpret_cast<void *>(rget->tgt_ptr), rget->srcrank,
-          reinterpret_cast<void *>(rget->src_ptr), rget->payload_bytes, 0 /*flags*/);
+      std::vector<gex_event_opaque_t> done_events(num_stripes);
+      for(unsigned i = 0; i < num_stripes; i++) {
+        size_t ofs = i * stripe_size;
+        size_t len = std::min(stripe_size, rget->payload_bytes - ofs);
+        done_events[i] = gex_wrapper_handle.gex_rma_iget(
+            internal->eps[rget->tgt_ep_index], rget->src_ep_index,
+            reinterpret_cast<void *>(rget->tgt_ptr + ofs), rget->srcrank,
+            reinterpret_cast<void *>(rget->src_ptr + ofs), len, 0 /*flags*/);
+      }
+      // set the piece count before any of the events can trigger
+      rget->chunks_left.store(num_stripes);
 
-      // once we add the event to the list, rget might be recycled at any
+      total_rgets.fetch_add(1);
+      if(num_stripes > 1) {
+        total_striped_rgets.fetch_add(1);
+        total_striped_bytes.fetch_add(rget->payload_bytes);
+      }
+
+      // once we add the events to the list, rget might be recycled at any
       //  time, so pop it off the list and peek at the next entry (if any)
       //  before we do that
       PendingReverseGet *next_rget;
@@ -3143,10 +3182,12 @@ namespace Realm {
 	  tailp = &head;
       }
 
-      GASNetEXEvent *ev = internal->event_alloc.alloc_obj();
-      ev->set_event(done);
-      ev->set_rget(rget);
-      internal->poller.add_pending_event(ev);
+      for(unsigned i = 0; i < num_stripes; i++) {
+        GASNetEXEvent *ev = internal->event_alloc.alloc_obj();
+        ev->set_event(done_events[i]);
+        ev->set_rget(rget);
+        internal->poller.add_pending_event(ev);
+      }
 
       if(next_rget) {
 	if(work_until.is_expired()) {
@@ -3490,6 +3531,13 @@ namespace Realm {
     for(size_t i = 0; i < xmitsrcs.size(); i++)
       delete xmitsrcs[i];
     xmitsrcs.clear();
+
+    if(rgetter.total_striped_rgets.load() > 0)
+      log_gex.info() << "striped "
+                     << rgetter.total_striped_rgets.load() << " of "
+                     << rgetter.total_rgets.load() << " reverse gets"
+                     << " (" << rgetter.total_striped_bytes.load()
+                     << " bytes)";
   }
 
   void GASNetEXInternal::get_shared_peers(Realm::NodeSet &shared_peers)
@@ -602,6 +602,9 @@ namespace Realm {
     unsigned char hdr_data[MAX_HDR_SIZE];
     uintptr_t src_ptr, tgt_ptr;
     size_t payload_bytes;
+    // number of in-flight pieces this rget was split into - the rget is
+    //  complete only when the last piece's event triggers
+    atomic<unsigned> chunks_left;
   };
 
   class ReverseGetter : public BackgroundWorkItem {
@@ -619,6 +622,7 @@ namespace Realm {
 
   protected:
     friend class GASNetEXEvent;
+    friend class GASNetEXInternal;
     void reverse_get_complete(PendingReverseGet *rget);
 
     GASNetEXInternal *internal;
@@ -626,6 +630,8 @@ namespace Realm {
     PendingReverseGet *head;
     PendingReverseGet **tailp;
     ChunkedRecycler<PendingReverseGet, 8> rget_alloc;
+    // statistics on how often large gets get striped across the wire
+    atomic<uint64_t> total_rgets, total_striped_rgets, total_striped_bytes;
   };
 
   class GASNetEXInternal {
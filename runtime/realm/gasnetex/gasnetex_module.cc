@@ -397,6 +397,8 @@ namespace Realm {
     , cfg_force_rma(false)
     , cfg_use_rma_put(true)
     , cfg_am_limit(0)
+    , cfg_rget_stripe_size(0)
+    , cfg_rget_stripe_count(4)
     , internal(nullptr)
   {}
 
@@ -468,7 +470,9 @@ namespace Realm {
       .add_option_int_units("-gex:obsize", cfg_outbuf_size)
       .add_option_int("-gex:forcerma", cfg_force_rma)
       .add_option_int("-gex:rmaput", cfg_use_rma_put)
-      .add_option_int("-gex:amlimit", cfg_am_limit);
+      .add_option_int("-gex:amlimit", cfg_am_limit)
+      .add_option_int_units("-gex:rgetstripe", cfg_rget_stripe_size, 'm')
+      .add_option_int("-gex:rgetchunks", cfg_rget_stripe_count);
     size_t deprecated_gsize = 0;
     cp.add_option_int_units("-ll:gsize", deprecated_gsize, 'm');
 
@@ -153,6 +153,12 @@ namespace Realm {
     bool cfg_force_rma;
     bool cfg_use_rma_put;
     int cfg_am_limit;  // upper bound on AMs in flight to any given peer
+    // reverse gets larger than 'rget_stripe_size' are issued as up to
+    //  'rget_stripe_count' concurrent gets so that a multi-rail-capable
+    //  conduit (e.g. ibv with GASNET_IBV_PORTS) can spread the pieces
+    //  across NICs (size of 0 = no striping)
+    size_t cfg_rget_stripe_size;
+    unsigned cfg_rget_stripe_count;
 
   protected:
     GASNetEXInternal *internal;
@@ -37,13 +37,100 @@
  * This file provides a C++ interface to Realm's index spaces.
  */
 
+// the set of coordinate types instantiated for index spaces can be pruned
+//  at build time (e.g. via the Legion_COORD_TYPES cmake option) - builds
+//  that do not say anything get all of them
+#if !defined(REALM_COORD_TYPE_INT32) && !defined(REALM_COORD_TYPE_UINT32) && \
+    !defined(REALM_COORD_TYPE_INT64)
+  #define REALM_COORD_TYPE_INT32
+  #define REALM_COORD_TYPE_UINT32
+  #define REALM_COORD_TYPE_INT64
+#endif
+
+// per-coordinate-type filters for explicit instantiation lists - each wraps
+//  one entry of a FOREACH_* list and expands to nothing when the
+//  corresponding coordinate type is pruned from the build
+#ifdef REALM_COORD_TYPE_INT32
+  #define REALM_CT_IF_INT(x) x
+#else
+  #define REALM_CT_IF_INT(x)
+#endif
+#ifdef REALM_COORD_TYPE_UINT32
+  #define REALM_CT_IF_UNSIGNED(x) x
+#else
+  #define REALM_CT_IF_UNSIGNED(x)
+#endif
+#ifdef REALM_COORD_TYPE_INT64
+  #define REALM_CT_IF_LONGLONG(x) x
+#else
+  #define REALM_CT_IF_LONGLONG(x)
+#endif
+// pairwise filters for the NTNT-style lists - these cannot simply nest the
+//  single-type filters because the entry text acquires unparenthesized
+//  commas once it has been expanded
+#ifdef REALM_COORD_TYPE_INT32
+  #define REALM_CT_IF_INT_INT(x) x
+#else
+  #define REALM_CT_IF_INT_INT(x)
+#endif
+#if defined(REALM_COORD_TYPE_INT32) && defined(REALM_COORD_TYPE_UINT32)
+  #define REALM_CT_IF_INT_UNSIGNED(x) x
+  #define REALM_CT_IF_UNSIGNED_INT(x) x
+#else
+  #define REALM_CT_IF_INT_UNSIGNED(x)
+  #define REALM_CT_IF_UNSIGNED_INT(x)
+#endif
+#if defined(REALM_COORD_TYPE_INT32) && defined(REALM_COORD_TYPE_INT64)
+  #define REALM_CT_IF_INT_LONGLONG(x) x
+  #define REALM_CT_IF_LONGLONG_INT(x) x
+#else
+  #define REALM_CT_IF_INT_LONGLONG(x)
+  #define REALM_CT_IF_LONGLONG_INT(x)
+#endif
+#ifdef REALM_COORD_TYPE_UINT32
+  #define REALM_CT_IF_UNSIGNED_UNSIGNED(x) x
+#else
+  #define REALM_CT_IF_UNSIGNED_UNSIGNED(x)
+#endif
+#if defined(REALM_COORD_TYPE_UINT32) && defined(REALM_COORD_TYPE_INT64)
+  #define REALM_CT_IF_UNSIGNED_LONGLONG(x) x
+  #define REALM_CT_IF_LONGLONG_UNSIGNED(x) x
+#else
+  #define REALM_CT_IF_UNSIGNED_LONGLONG(x)
+  #define REALM_CT_IF_LONGLONG_UNSIGNED(x)
+#endif
+#ifdef REALM_COORD_TYPE_INT64
+  #define REALM_CT_IF_LONGLONG_LONGLONG(x) x
+#else
+  #define REALM_CT_IF_LONGLONG_LONGLONG(x)
+#endif
+
 namespace Realm {
   // NOTE: all these interfaces are templated, which means partitions.cc is going
   //  to have to somehow know which ones to instantiate - this is controlled by the
   //  following type lists, using a bunch of helper stuff from dynamic_templates.h
 
   typedef DynamicTemplates::IntList<1, REALM_MAX_DIM> DIMCOUNTS;
+  // DIMTYPES holds only the coordinate types enabled for this build so that
+  //  demux over the list collapses to fewer (or no) branches when types are
+  //  pruned - note that the dynamic type tags shift when the set changes, so
+  //  all nodes of a job must be built with the same set
+#if defined(REALM_COORD_TYPE_INT32) && defined(REALM_COORD_TYPE_UINT32) && \
+    defined(REALM_COORD_TYPE_INT64)
   typedef DynamicTemplates::TypeList<int, unsigned int, long long>::TL DIMTYPES;
+#elif defined(REALM_COORD_TYPE_INT32) && defined(REALM_COORD_TYPE_UINT32)
+  typedef DynamicTemplates::TypeList<int, unsigned int>::TL DIMTYPES;
+#elif defined(REALM_COORD_TYPE_INT32) && defined(REALM_COORD_TYPE_INT64)
+  typedef DynamicTemplates::TypeList<int, long long>::TL DIMTYPES;
+#elif defined(REALM_COORD_TYPE_UINT32) && defined(REALM_COORD_TYPE_INT64)
+  typedef DynamicTemplates::TypeList<unsigned int, long long>::TL DIMTYPES;
+#elif defined(REALM_COORD_TYPE_INT32)
+  typedef DynamicTemplates::TypeList<int>::TL DIMTYPES;
+#elif defined(REALM_COORD_TYPE_UINT32)
+  typedef DynamicTemplates::TypeList<unsigned int>::TL DIMTYPES;
+#else
+  typedef DynamicTemplates::TypeList<long long>::TL DIMTYPES;
+#endif
   typedef DynamicTemplates::TypeList<int, bool>::TL FLDTYPES;
 
   class ProfilingRequestSet;
@@ -524,6 +524,27 @@ namespace Realm {
       destroy(wait_on);
     }
 
+    /*static*/ void RegionInstance::destroy_instances(
+        const std::vector<RegionInstance> &instances,
+        Event wait_on /*= Event::NO_EVENT*/)
+    {
+      // group the instances by owning memory so that each memory sees its
+      //  whole batch at once
+      std::map<MemoryImpl *, std::vector<RegionInstanceImpl *> > by_memory;
+      for(std::vector<RegionInstance>::const_iterator it = instances.begin();
+          it != instances.end(); ++it) {
+        log_inst.info() << "instance destroyed: inst=" << *it
+                        << " wait_on=" << wait_on;
+        MemoryImpl *mem_impl = get_runtime()->get_memory_impl(*it);
+        assert(mem_impl != nullptr && "invalid memory handle");
+        by_memory[mem_impl].push_back(mem_impl->get_instance(*it));
+      }
+
+      for(std::map<MemoryImpl *, std::vector<RegionInstanceImpl *> >::iterator
+            it = by_memory.begin(); it != by_memory.end(); ++it)
+        it->first->release_multiple_storage_deferrable(it->second, wait_on);
+    }
+
     // it is sometimes useful to re-register an existing instance (in whole or
     //  in part) as an "external" instance (e.g. to provide a different view
     //  on the same bits) - this hopefully gives an ExternalInstanceResource *
@@ -1711,6 +1732,59 @@ namespace Realm {
   /*static*/ Serialization::PolymorphicSerdezSubclass<ExternalInstanceResource, ExternalFileResource> ExternalFileResource::serdez_subclass;
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class ExternalMmapResource
+
+  ExternalMmapResource::ExternalMmapResource()
+    : ExternalInstanceResource(REALM_HASH_TOKEN(ExternalMmapResource))
+  {}
+
+  ExternalMmapResource::ExternalMmapResource(const std::string &_filename,
+                                             realm_file_mode_t _mode,
+                                             size_t _offset /*= 0*/)
+    : ExternalInstanceResource(REALM_HASH_TOKEN(ExternalMmapResource))
+    , filename(_filename)
+    , offset(_offset)
+    , mode(_mode)
+  {}
+
+  bool ExternalMmapResource::satisfies(const InstanceLayoutGeneric &layout) const
+  {
+    // a mapping cannot extend the file, so it has to be big enough already
+    if(std::filesystem::file_size(filename) < (offset + layout.bytes_used))
+      return false;
+    // the mapping itself is page aligned, so the achievable alignment is
+    //  limited only by the offset into the file
+    if(offset == 0)
+      return true;
+    const size_t max_alignment = (offset & -offset);
+    return (layout.alignment_reqd <= max_alignment);
+  }
+
+  // returns the suggested memory in which this resource should be created
+  Memory ExternalMmapResource::suggested_memory() const
+  {
+    // the mapped pages appear in our address space like any other host
+    //  memory, so use the same external sysmem as ExternalMemoryResource
+    CoreModule *mod = get_runtime()->get_module<CoreModule>("core");
+    assert(mod);
+    return mod->ext_sysmem->me;
+  }
+
+  ExternalInstanceResource *ExternalMmapResource::clone(void) const
+  {
+    return new ExternalMmapResource(filename, mode, offset);
+  }
+
+  void ExternalMmapResource::print(std::ostream& os) const
+  {
+    os << "mmap(name='" << filename << "', mode=" << int(mode) << ", offset=" << offset << ")";
+  }
+
+  /*static*/ Serialization::PolymorphicSerdezSubclass<ExternalInstanceResource, ExternalMmapResource> ExternalMmapResource::serdez_subclass;
+
+
   template <int N, typename T>
   /*static*/ Serialization::PolymorphicSerdezSubclass<InstanceLayoutPiece<N,T>, AffineLayoutPiece<N,T> > AffineLayoutPiece<N,T>::serdez_subclass;
 
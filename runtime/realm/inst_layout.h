@@ -46,6 +46,8 @@ enum { Kokkos_Unmanaged = 0x01 };
 #include <vector>
 #include <map>
 #include <iostream>
+#include <algorithm>
+#include <limits>
 
 /**
  * \file int_layout.h
@@ -357,13 +359,27 @@ namespace Realm {
 
     void relocate(size_t base_offset);
 
+    /**
+     * (Re)build the CSR-style lookup index over 'pieces' - must be called
+     * whenever the piece vector changes.  The first dimension is cut into
+     * slabs at every piece boundary so the set of overlapping pieces is
+     * constant within a slab, and each slab records the indices of those
+     * pieces.  A lookup is then a binary search on the slab starts followed
+     * by a scan of just the pieces in that slab.  Lists with only a few
+     * pieces skip the index and fall back to a direct scan.
+     */
+    void rebuild_index(void);
+
     template <typename S>
     bool serialize(S& serializer) const;
     template <typename S>
     bool deserialize(S& deserializer);
 
     std::vector<InstanceLayoutPiece<N,T> *> pieces;
-    // placeholder for lookup structure (e.g. K-D tree)
+    // CSR-style slab index - not serialized (rebuilt on deserialization)
+    std::vector<T> slab_starts;         // sorted start coord of each slab
+    std::vector<unsigned> slab_offsets; // per-slab offsets into 'slab_pieces'
+    std::vector<unsigned> slab_pieces;  // piece indices, grouped by slab
   };
 
   template <int N, typename T>
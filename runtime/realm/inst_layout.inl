@@ -147,13 +147,37 @@ namespace Realm {
       //  pieces
       size_t gsize = 0;
       size_t galign = 1;
+      // fields with fixed offsets have to go exactly where they were asked
+      //  to, but the rest are packed in decreasing alignment (then size)
+      //  order - appending fields in declaration order instead leaves a
+      //  padding hole in front of every field that is more aligned than
+      //  the one before it
+      std::vector<const InstanceLayoutConstraints::FieldInfo *> packed_order;
+      packed_order.reserve(fg.size());
+      for(std::vector<InstanceLayoutConstraints::FieldInfo>::const_iterator it2 = fg.begin();
+	  it2 != fg.end();
+	  ++it2)
+	packed_order.push_back(&*it2);
+      std::stable_sort(packed_order.begin(), packed_order.end(),
+		       [](const InstanceLayoutConstraints::FieldInfo *a,
+			  const InstanceLayoutConstraints::FieldInfo *b) {
+			 // fixed-offset fields first, keeping their order
+			 if(a->fixed_offset != b->fixed_offset)
+			   return a->fixed_offset;
+			 if(a->fixed_offset)
+			   return false;
+			 if(a->alignment != b->alignment)
+			   return (a->alignment > b->alignment);
+			 return (a->size > b->size);
+		       });
       // we can't set field offsets in a single pass because we don't know
       //  the whole group's alignment until we look at every field
       std::map<FieldID, size_t> field_offsets;
       std::map<FieldID, int> field_sizes;
-      for(std::vector<InstanceLayoutConstraints::FieldInfo>::const_iterator it2 = fg.begin();
-	  it2 != fg.end();
-	  ++it2) {
+      for(std::vector<const InstanceLayoutConstraints::FieldInfo *>::const_iterator it3 = packed_order.begin();
+	  it3 != packed_order.end();
+	  ++it3) {
+	const InstanceLayoutConstraints::FieldInfo *it2 = *it3;
 	size_t offset;
 	if(it2->fixed_offset) {
 	  offset = it2->offset;
@@ -232,6 +256,7 @@ namespace Realm {
 	  
 	  pl.pieces.push_back(piece);
 	}
+	pl.rebuild_index();
 	pl_starts[pl_key] = pl_start;
 	pl_sizes[pl_key] = layout->bytes_used - pl_start;
       }
@@ -423,6 +448,18 @@ namespace Realm {
   template <int N, typename T>
   inline const InstanceLayoutPiece<N,T> *InstancePieceList<N,T>::find_piece(Point<N,T> p) const
   {
+    if(!slab_starts.empty()) {
+      // a point below the first slab is outside every piece
+      if(p[0] < slab_starts[0])
+	return 0;
+      size_t slab = (std::upper_bound(slab_starts.begin(), slab_starts.end(),
+				      p[0]) -
+		     slab_starts.begin()) - 1;
+      for(unsigned idx = slab_offsets[slab]; idx < slab_offsets[slab + 1]; idx++)
+	if(pieces[slab_pieces[idx]]->bounds.contains(p))
+	  return pieces[slab_pieces[idx]];
+      return 0;
+    }
     for(typename std::vector<InstanceLayoutPiece<N,T> *>::const_iterator it = pieces.begin();
 	it != pieces.end();
 	++it)
@@ -431,6 +468,64 @@ namespace Realm {
     return 0;
   }
 
+  template <int N, typename T>
+  inline void InstancePieceList<N,T>::rebuild_index(void)
+  {
+    slab_starts.clear();
+    slab_offsets.clear();
+    slab_pieces.clear();
+    // short lists are cheaper to scan directly
+    if(pieces.size() < 4)
+      return;
+
+    // every distinct piece lo[0] (and hi[0]+1) starts a new slab
+    std::vector<T> starts;
+    starts.reserve(pieces.size() * 2);
+    for(size_t i = 0; i < pieces.size(); i++) {
+      const Rect<N,T>& b = pieces[i]->bounds;
+      if(b.empty()) continue;
+      starts.push_back(b.lo[0]);
+      // guard against wraparound for a piece that extends to the coordinate
+      //  type's maximum value - its slab just has no upper neighbor
+      if(b.hi[0] < std::numeric_limits<T>::max())
+	starts.push_back(b.hi[0] + 1);
+    }
+    if(starts.empty())
+      return;
+    std::sort(starts.begin(), starts.end());
+    starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+    slab_starts.swap(starts);
+
+    // classic CSR construction - count pieces per slab, prefix-sum, fill
+    size_t num_slabs = slab_starts.size();
+    slab_offsets.assign(num_slabs + 1, 0);
+    std::vector<std::pair<size_t, size_t> > ranges(pieces.size());
+    for(size_t i = 0; i < pieces.size(); i++) {
+      const Rect<N,T>& b = pieces[i]->bounds;
+      if(b.empty()) {
+	ranges[i] = std::make_pair(size_t(1), size_t(0));
+	continue;
+      }
+      // lo[0] is itself a slab start, so these searches always succeed
+      size_t first = (std::upper_bound(slab_starts.begin(), slab_starts.end(),
+				       b.lo[0]) -
+		      slab_starts.begin()) - 1;
+      size_t last = (std::upper_bound(slab_starts.begin(), slab_starts.end(),
+				      b.hi[0]) -
+		     slab_starts.begin()) - 1;
+      ranges[i] = std::make_pair(first, last);
+      for(size_t s = first; s <= last; s++)
+	slab_offsets[s + 1]++;
+    }
+    for(size_t s = 0; s < num_slabs; s++)
+      slab_offsets[s + 1] += slab_offsets[s];
+    slab_pieces.resize(slab_offsets[num_slabs]);
+    std::vector<unsigned> cursor(slab_offsets.begin(), slab_offsets.end() - 1);
+    for(size_t i = 0; i < pieces.size(); i++)
+      for(size_t s = ranges[i].first; s <= ranges[i].second; s++)
+	slab_pieces[cursor[s]++] = i;
+  }
+
   template <int N, typename T>
   inline void InstancePieceList<N,T>::relocate(size_t base_offset)
   {
@@ -476,6 +571,7 @@ namespace Realm {
 	return false;
       pieces[i] = ilp;
     }
+    rebuild_index();
     return true;
   }
 
@@ -538,6 +634,7 @@ namespace Realm {
       copy->piece_lists[i].pieces.resize(piece_lists[i].pieces.size());
       for(size_t j = 0; j < piece_lists[i].pieces.size(); j++)
 	copy->piece_lists[i].pieces[j] = piece_lists[i].pieces[j]->clone();
+      copy->piece_lists[i].rebuild_index();
     }
     return copy;
   }
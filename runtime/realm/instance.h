@@ -315,6 +315,17 @@ namespace Realm {
 
     void destroy(Event wait_on = Event::NO_EVENT) const;
 
+    /**
+     * Destroy a batch of instances that share a common precondition.
+     * Destructions are grouped by memory so that each memory can reclaim
+     * the whole batch in one allocator pass, which is cheaper than
+     * destroying many short-lived instances one at a time.
+     * \param instances The instances to destroy.
+     * \param wait_on The event to wait on before destroying the instances.
+     */
+    static void destroy_instances(const std::vector<RegionInstance> &instances,
+                                  Event wait_on = Event::NO_EVENT);
+
     AddressSpace address_space(void) const;
 
     /**
@@ -350,6 +361,12 @@ namespace Realm {
     //  (which must be deleted by the caller) that corresponds to this instance
     //  but may return a null pointer for instances that do not support
     //  re-registration
+    // note that this is also the supported way for a client to share one
+    //  read-only payload between several instances (e.g. byte-identical
+    //  lookup tables): create the data once, then register additional views
+    //  with read_only=true - realm itself never deduplicates instances by
+    //  content, since every normal instance must remain independently
+    //  writable through its accessors
     //
 
     ///@{
@@ -512,6 +529,46 @@ namespace Realm {
     realm_file_mode_t mode;
   };
 
+  /**
+   * \class ExternalMmapResource
+   * Describes a file (or a range of one) that should be memory-mapped into
+   * the process and exposed as an external instance. Unlike a file instance,
+   * which is serviced by explicit read/write calls through the file channels,
+   * a memory-mapped instance is directly load/store accessible - pages are
+   * faulted in lazily on first access and the initial mapping is hinted to
+   * the OS for prefetching.
+   */
+  class REALM_PUBLIC_API ExternalMmapResource : public ExternalInstanceResource {
+  public:
+    ExternalMmapResource(const std::string& _filename, realm_file_mode_t _mode,
+			 size_t _offset = 0);
+
+    virtual bool satisfies(const InstanceLayoutGeneric &layout) const;
+
+    // returns the suggested memory in which this resource should be created
+    Memory suggested_memory() const;
+
+    virtual ExternalInstanceResource *clone(void) const;
+
+    template <typename S>
+    bool serialize(S& serializer) const;
+
+    template <typename S>
+    static ExternalInstanceResource *deserialize_new(S& deserializer);
+
+  protected:
+    ExternalMmapResource();
+
+    static Serialization::PolymorphicSerdezSubclass<ExternalInstanceResource, ExternalMmapResource> serdez_subclass;
+
+    virtual void print(std::ostream& os) const;
+
+  public:
+    std::string filename;
+    size_t offset;
+    realm_file_mode_t mode;
+  };
+
 }; // namespace Realm
 #endif // ifndef REALM_INSTANCE_H
 
@@ -332,6 +332,33 @@ namespace Realm {
   }
 
 
-}; // namespace Realm  
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class ExternalMmapResource
+
+  template <typename S>
+  bool ExternalMmapResource::serialize(S& s) const
+  {
+    return ((s << filename) &&
+	    (s << mode) &&
+	    (s << offset));
+  }
+
+  template <typename S>
+  /*static*/ ExternalInstanceResource *ExternalMmapResource::deserialize_new(S& s)
+  {
+    ExternalMmapResource *res = new ExternalMmapResource;
+    if((s >> res->filename) &&
+       (s >> res->mode) &&
+       (s >> res->offset)) {
+      return res;
+    } else {
+      delete res;
+      return 0;
+    }
+  }
+
+
+}; // namespace Realm
 
 #endif // ifndef REALM_INSTANCE_INL
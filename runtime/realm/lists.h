@@ -145,6 +145,14 @@ namespace Realm {
     T *pop_front(void);
     T *pop_front(PT min_priority);
 
+    // removes and returns the first element accepted by 'pred', looking
+    //  only at the frontmost priority tier (and only if that tier's
+    //  priority is >= min_priority) and scanning at most 'max_scan'
+    //  elements - returns null (changing nothing) if no scanned element
+    //  matches
+    template <typename PRED>
+    T *pop_front_if(PT min_priority, PRED& pred, size_t max_scan);
+
     // calls callback for each element in list
     template <typename CALLABLE>
     void foreach(CALLABLE& cb);
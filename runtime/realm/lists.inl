@@ -579,6 +579,67 @@ namespace Realm {
     return popped;
   }
 
+  template <typename T, typename PT, REALM_PMTA_DECL(T,IntrusivePriorityListLink<T>,LINK), REALM_PMTA_DECL(T,PT,PRI), typename LT>
+  template <typename PRED>
+  T *IntrusivePriorityList<T, PT, LINK, PRI, LT>::pop_front_if(PT min_priority, PRED& pred, size_t max_scan)
+  {
+    lock.lock();
+#ifdef DEBUG_REALM_LISTS
+    size_t exp_size = size();
+#endif
+    T *popped = 0;
+    if(head && (REALM_PMTA_DEREF(head,PRI) >= min_priority) && (max_scan > 0)) {
+      if(pred(head)) {
+	// front matches - this is just pop_front
+	popped = head;
+	if(REALM_PMTA_DEREF(popped,LINK).next_within_pri != 0) {
+	  // others in tier - next one becomes head
+	  head = REALM_PMTA_DEREF(popped,LINK).next_within_pri;
+	  REALM_PMTA_DEREF(head,LINK).lastlink_within_pri = REALM_PMTA_DEREF(popped,LINK).lastlink_within_pri;
+	  REALM_PMTA_DEREF(head,LINK).next_lower_pri = REALM_PMTA_DEREF(popped,LINK).next_lower_pri;
+	} else {
+	  // was only one in tier - point head at next priority tier
+	  head = REALM_PMTA_DEREF(popped,LINK).next_lower_pri;
+	}
+      } else {
+	// scan the rest of the front tier only - taking a later element of
+	//  the same priority never violates priority order
+	T *prev = head;
+	size_t scanned = 1;
+	while((scanned < max_scan) &&
+	      (REALM_PMTA_DEREF(prev,LINK).next_within_pri != 0)) {
+	  T *cur = REALM_PMTA_DEREF(prev,LINK).next_within_pri;
+	  if(pred(cur)) {
+	    popped = cur;
+	    REALM_PMTA_DEREF(prev,LINK).next_within_pri = REALM_PMTA_DEREF(cur,LINK).next_within_pri;
+	    // if we took the tier's tail, the tail link (kept in the tier's
+	    //  head element) has to be backed up to 'prev'
+	    if(REALM_PMTA_DEREF(cur,LINK).next_within_pri == 0)
+	      REALM_PMTA_DEREF(head,LINK).lastlink_within_pri = &(REALM_PMTA_DEREF(prev,LINK).next_within_pri);
+	    break;
+	  }
+	  prev = cur;
+	  scanned++;
+	}
+      }
+    }
+#ifdef DEBUG_REALM_LISTS
+    if(popped) {
+      exp_size--;
+      assert(REALM_PMTA_DEREF(popped,LINK).current_list == this);
+      REALM_PMTA_DEREF(popped,LINK).current_list = 0;
+      // clean up now-unused pointers to make debugging easier
+      REALM_PMTA_DEREF(popped,LINK).next_within_pri = 0;
+      REALM_PMTA_DEREF(popped,LINK).lastlink_within_pri = 0;
+      REALM_PMTA_DEREF(popped,LINK).next_lower_pri = 0;
+    }
+    size_t act_size = size();
+    assert(exp_size == act_size);
+#endif
+    lock.unlock();
+    return popped;
+  }
+
   // calls callback for each element in list
   template <typename T, typename PT, REALM_PMTA_DECL(T,IntrusivePriorityListLink<T>,LINK), REALM_PMTA_DECL(T,PT,PRI), typename LT>
   template <typename CALLABLE>
@@ -18,18 +18,23 @@
 #include "realm/logging.h"
 
 #include "realm/network.h"
+#include "realm/activemsg.h"
 
 #include "realm/cmdline.h"
 #include "realm/timers.h"
+#include "realm/atomics.h"
+#include "realm/mutex.h"
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <assert.h>
 #include <errno.h>
 
 #include <set>
 #include <map>
+#include <thread>
 
 #ifdef REALM_ON_WINDOWS
 #include <windows.h>
@@ -138,6 +143,503 @@ namespace Realm {
     Mutex mutex;
   };
 
+  // variant of LoggerFileStream that takes the stream mutex and the file
+  //  i/o off the logging thread's critical path - the base class still
+  //  formats the message (including the timestamp and thread id) on the
+  //  caller, but the finished line goes into a per-thread ring buffer
+  //  instead of straight to the file:
+  //   a) in deferred mode a background drainer thread moves ring contents
+  //      to the file, so enabling noisy diagnostic categories costs the
+  //      logging threads little more than a memcpy
+  //   b) in flight-recorder mode there is no drainer - each ring just
+  //      keeps the most recent messages (overwriting the oldest), and the
+  //      whole history is dumped when an error is logged or at shutdown
+  class DeferredLogStream : public LoggerFileStream {
+  public:
+    DeferredLogStream(FILE *_f, bool _close_file, bool _include_timestamp,
+                      size_t _ring_size, bool _flight_recorder);
+    virtual ~DeferredLogStream(void);
+
+    virtual void log_msg(Logger::LoggingLevel level, const char *name,
+                         const char *msgdata, size_t msglen);
+    virtual void flush();
+
+  protected:
+    // each logging thread lazily gets its own ring - a ring has a single
+    //  producer (the owning thread) and a single consumer (the drainer),
+    //  so the fast path needs no locks at all
+    struct ThreadRing {
+      ThreadRing(size_t _capacity);
+      ~ThreadRing(void);
+
+      bool try_append(const char *data, size_t len);
+      void overwrite_append(const char *data, size_t len);
+      void copy_in(size_t pos, const void *src, size_t len);
+      void copy_out(size_t pos, void *dst, size_t len) const;
+
+      char *buffer;
+      size_t capacity;  // always a power of two
+      // positions increase monotonically - (wr_pos - rd_pos) is the
+      //  number of bytes currently in the ring
+      atomic<size_t> wr_pos, rd_pos;
+      // high-water mark of what's already been dumped in flight-recorder
+      //  mode - only touched while holding the drainer mutex
+      size_t dumped_pos;
+    };
+
+    virtual void write(const char *buffer, size_t len);
+
+    ThreadRing *get_thread_ring(void);
+    void drain_ring(ThreadRing *ring);
+    void dump_ring(ThreadRing *ring);
+    void drainer_loop(void);
+
+    static thread_local ThreadRing *my_ring;
+
+    size_t ring_size;
+    bool flight_recorder;
+    KernelMutex drainer_mutex;  // protects 'rings' and the drainer handshake
+    KernelCondVar drainer_condvar;
+    std::vector<ThreadRing *> rings;
+    bool shutdown_requested;
+    std::thread drainer;
+  };
+
+  // at most one DeferredLogStream is ever created (by LoggerConfig), so a
+  //  single thread-local ring pointer suffices
+  /*static*/ thread_local DeferredLogStream::ThreadRing *DeferredLogStream::my_ring = 0;
+
+  DeferredLogStream::ThreadRing::ThreadRing(size_t _capacity)
+    : capacity(_capacity)
+    , wr_pos(0)
+    , rd_pos(0)
+    , dumped_pos(0)
+  {
+    buffer = static_cast<char *>(malloc(capacity));
+    assert(buffer != 0);
+  }
+
+  DeferredLogStream::ThreadRing::~ThreadRing(void)
+  {
+    free(buffer);
+  }
+
+  void DeferredLogStream::ThreadRing::copy_in(size_t pos, const void *src,
+                                              size_t len)
+  {
+    size_t idx = pos & (capacity - 1);
+    size_t before_wrap = capacity - idx;
+    if(len <= before_wrap) {
+      memcpy(buffer + idx, src, len);
+    } else {
+      memcpy(buffer + idx, src, before_wrap);
+      memcpy(buffer, static_cast<const char *>(src) + before_wrap,
+             len - before_wrap);
+    }
+  }
+
+  void DeferredLogStream::ThreadRing::copy_out(size_t pos, void *dst,
+                                               size_t len) const
+  {
+    size_t idx = pos & (capacity - 1);
+    size_t before_wrap = capacity - idx;
+    if(len <= before_wrap) {
+      memcpy(dst, buffer + idx, len);
+    } else {
+      memcpy(dst, buffer + idx, before_wrap);
+      memcpy(static_cast<char *>(dst) + before_wrap, buffer,
+             len - before_wrap);
+    }
+  }
+
+  bool DeferredLogStream::ThreadRing::try_append(const char *data, size_t len)
+  {
+    // a record is a 32-bit length followed by the message bytes
+    size_t needed = sizeof(uint32_t) + len;
+    size_t wp = wr_pos.load();
+    size_t used = wp - rd_pos.load_acquire();
+    if((capacity - used) < needed)
+      return false;
+    uint32_t reclen = len;
+    copy_in(wp, &reclen, sizeof(reclen));
+    copy_in(wp + sizeof(reclen), data, len);
+    wr_pos.store_release(wp + needed);
+    return true;
+  }
+
+  void DeferredLogStream::ThreadRing::overwrite_append(const char *data,
+                                                       size_t len)
+  {
+    // flight-recorder mode only - there is no concurrent consumer, so the
+    //  producer owns both ends of the ring and can discard the oldest
+    //  records to make room
+    size_t needed = sizeof(uint32_t) + len;
+    assert(needed <= capacity);
+    size_t wp = wr_pos.load();
+    size_t rp = rd_pos.load();
+    while((capacity - (wp - rp)) < needed) {
+      uint32_t reclen;
+      copy_out(rp, &reclen, sizeof(reclen));
+      rp += sizeof(reclen) + reclen;
+    }
+    rd_pos.store(rp);
+    uint32_t reclen = len;
+    copy_in(wp, &reclen, sizeof(reclen));
+    copy_in(wp + sizeof(reclen), data, len);
+    wr_pos.store_release(wp + needed);
+  }
+
+  DeferredLogStream::DeferredLogStream(FILE *_f, bool _close_file,
+                                       bool _include_timestamp,
+                                       size_t _ring_size,
+                                       bool _flight_recorder)
+    : LoggerFileStream(_f, _close_file, _include_timestamp)
+    , ring_size(256)
+    , flight_recorder(_flight_recorder)
+    , drainer_condvar(drainer_mutex)
+    , shutdown_requested(false)
+  {
+    // round the requested ring size up to a power of two so that ring
+    //  positions convert to buffer indices with a simple mask
+    while(ring_size < _ring_size)
+      ring_size <<= 1;
+
+    // flight-recorder mode keeps messages in memory until somebody asks
+    //  for them - only deferred mode needs a drainer thread
+    if(!flight_recorder)
+      drainer = std::thread(&DeferredLogStream::drainer_loop, this);
+  }
+
+  DeferredLogStream::~DeferredLogStream(void)
+  {
+    if(!flight_recorder) {
+      {
+        AutoLock<KernelMutex> al(drainer_mutex);
+        shutdown_requested = true;
+        drainer_condvar.signal();
+      }
+      drainer.join();
+    }
+
+    // push anything still sitting in the rings out before the file closes
+    flush();
+
+    // this runs at static-destruction time, when no well-behaved thread is
+    //  still logging, so it's safe to free the rings
+    for(std::vector<ThreadRing *>::iterator it = rings.begin();
+        it != rings.end();
+        it++)
+      delete *it;
+    rings.clear();
+  }
+
+  DeferredLogStream::ThreadRing *DeferredLogStream::get_thread_ring(void)
+  {
+    ThreadRing *ring = my_ring;
+    if(!ring) {
+      ring = new ThreadRing(ring_size);
+      my_ring = ring;
+      AutoLock<KernelMutex> al(drainer_mutex);
+      rings.push_back(ring);
+    }
+    return ring;
+  }
+
+  void DeferredLogStream::write(const char *buffer, size_t len)
+  {
+    // a message that wouldn't fit even in an empty ring is written
+    //  synchronously (the oversized-error path in log_msg can get here)
+    if((len + sizeof(uint32_t)) > ring_size) {
+      LoggerFileStream::write(buffer, len);
+      return;
+    }
+
+    ThreadRing *ring = get_thread_ring();
+
+    if(flight_recorder) {
+      ring->overwrite_append(buffer, len);
+      return;
+    }
+
+    if(ring->try_append(buffer, len)) {
+      // only poke the drainer once the ring is at least half full - it
+      //  wakes up periodically on its own for anything quieter
+      size_t used = ring->wr_pos.load() - ring->rd_pos.load_acquire();
+      if(used >= (ring->capacity >> 1)) {
+        AutoLock<KernelMutex> al(drainer_mutex);
+        drainer_condvar.signal();
+      }
+      return;
+    }
+
+    // the ring is full and the drainer is behind - rather than drop the
+    //  message, pay for a synchronous write (this can put the line ahead
+    //  of earlier ones still in the ring, but the timestamps let a reader
+    //  re-sort, and it only happens when logging outruns the disk)
+    LoggerFileStream::write(buffer, len);
+  }
+
+  void DeferredLogStream::drain_ring(ThreadRing *ring)
+  {
+    // single consumer - callers serialize on the drainer mutex
+    size_t rp = ring->rd_pos.load();
+    size_t wp = ring->wr_pos.load_acquire();
+    while(rp < wp) {
+      uint32_t reclen;
+      ring->copy_out(rp, &reclen, sizeof(reclen));
+      char scratch[4096];
+      char *msg = scratch;
+      if(reclen > sizeof(scratch))
+	msg = static_cast<char *>(malloc(reclen));
+      ring->copy_out(rp + sizeof(reclen), msg, reclen);
+      LoggerFileStream::write(msg, reclen);
+      if(msg != scratch)
+	free(msg);
+      rp += sizeof(reclen) + reclen;
+      // free the space record by record so a busy producer isn't starved
+      ring->rd_pos.store_release(rp);
+    }
+  }
+
+  void DeferredLogStream::dump_ring(ThreadRing *ring)
+  {
+    // best-effort, read-only snapshot - the owning thread may still be
+    //  appending (and overwriting), so a record at the boundary can come
+    //  out garbled, but nothing here disturbs the producer's framing
+    size_t rp = ring->rd_pos.load();
+    if(ring->dumped_pos > rp)
+      rp = ring->dumped_pos;
+    size_t wp = ring->wr_pos.load_acquire();
+    while(rp < wp) {
+      uint32_t reclen;
+      ring->copy_out(rp, &reclen, sizeof(reclen));
+      char scratch[4096];
+      char *msg = scratch;
+      if(reclen > sizeof(scratch))
+	msg = static_cast<char *>(malloc(reclen));
+      ring->copy_out(rp + sizeof(reclen), msg, reclen);
+      LoggerFileStream::write(msg, reclen);
+      if(msg != scratch)
+	free(msg);
+      rp += sizeof(reclen) + reclen;
+    }
+    // remember what we've emitted so a later dump only adds new history
+    ring->dumped_pos = wp;
+  }
+
+  void DeferredLogStream::drainer_loop(void)
+  {
+    // the mutex is held across the drain itself - that serializes us with
+    //  flush() and with ring registration, while producers' fast path
+    //  never touches it
+    AutoLock<KernelMutex> al(drainer_mutex);
+    while(!shutdown_requested) {
+      for(std::vector<ThreadRing *>::iterator it = rings.begin();
+          it != rings.end();
+          it++)
+        drain_ring(*it);
+      drainer_condvar.timedwait(10000000 /* 10 ms */);
+    }
+    // one final sweep to catch messages logged while we were waking up
+    for(std::vector<ThreadRing *>::iterator it = rings.begin();
+        it != rings.end();
+        it++)
+      drain_ring(*it);
+  }
+
+  void DeferredLogStream::log_msg(Logger::LoggingLevel level, const char *name,
+                                  const char *msgdata, size_t msglen)
+  {
+    // the base class formats the prefix on the calling thread (so the
+    //  timestamp and thread id are right) and hands the finished line to
+    //  our write() override
+    LoggerFileStream::log_msg(level, name, msgdata, msglen);
+
+    // an error is exactly when the buffered history matters - push it all
+    //  out (in flight-recorder mode this is the failure dump)
+    if(level >= Logger::LEVEL_ERROR)
+      flush();
+  }
+
+  void DeferredLogStream::flush()
+  {
+    {
+      AutoLock<KernelMutex> al(drainer_mutex);
+      for(std::vector<ThreadRing *>::iterator it = rings.begin();
+          it != rings.end();
+          it++)
+        if(flight_recorder)
+          dump_ring(*it);
+        else
+          drain_ring(*it);
+    }
+    LoggerFileStream::flush();
+  }
+
+  // when log shipping (-logship) is in use, every rank sends its formatted
+  //  log lines to an aggregator rank that writes one collated file, instead
+  //  of the filesystem having to cope with one file per rank - the base
+  //  class still formats each line on the logging thread (the standard
+  //  '[node - thread]' prefix makes every record self-identifying in the
+  //  merged file), but write() batches finished lines and ships each batch
+  //  over the active message layer - lines logged before the network is up
+  //  are held back and go out with the first batch, and lines logged after
+  //  the network is torn down fall back to stderr so nothing is lost
+  class RemoteLogStream : public LoggerFileStream {
+  public:
+    // the aggregator passes the collated file, all other ranks pass NULL
+    RemoteLogStream(FILE *_f, bool _include_timestamp, size_t _batch_size);
+
+    virtual void flush();
+
+    // these bracket the window in which batches may use the network
+    void start_shipping();
+    void stop_shipping();
+
+    // called on the aggregator for each arriving batch of lines
+    void append_batch(const void *data, size_t datalen);
+
+  protected:
+    virtual void write(const char *buffer, size_t len);
+    void ship_batch(std::vector<char>& batch);
+
+    size_t batch_size;
+    bool shipping_active, drained;
+    std::vector<char> pending;
+    Mutex ship_mutex;
+  };
+
+  // a batch of formatted log lines on its way to the aggregator rank
+  struct LogShipMessage {
+    NodeID origin;
+
+    static void handle_message(NodeID sender, const LogShipMessage &args,
+                               const void *data, size_t datalen);
+  };
+
+  namespace {
+    // which rank collates the shipped log (and writes its own lines
+    //  directly to the file)
+    const NodeID LOG_AGGREGATOR_NODE = 0;
+
+    RemoteLogStream *remote_log_stream = 0;
+  };
+
+  RemoteLogStream::RemoteLogStream(FILE *_f, bool _include_timestamp,
+                                   size_t _batch_size)
+    : LoggerFileStream(_f, (_f != 0) /*close_file*/, _include_timestamp)
+    , batch_size(_batch_size)
+    , shipping_active(false)
+    , drained(false)
+  {}
+
+  void RemoteLogStream::write(const char *buffer, size_t len)
+  {
+    // the aggregator writes straight to the collated file
+    if(f != 0) {
+      LoggerFileStream::write(buffer, len);
+      return;
+    }
+    std::vector<char> batch;
+    {
+      AutoLock<> al(ship_mutex);
+      if(!drained) {
+        pending.insert(pending.end(), buffer, buffer + len);
+        if(!shipping_active || (pending.size() < batch_size))
+          return;
+        batch.swap(pending);
+      }
+    }
+    if(!batch.empty()) {
+      ship_batch(batch);
+      return;
+    }
+    // network already torn down - fall back to stderr
+    fwrite(buffer, 1, len, stderr);
+  }
+
+  void RemoteLogStream::flush()
+  {
+    if(f != 0) {
+      LoggerFileStream::flush();
+      return;
+    }
+    std::vector<char> batch;
+    {
+      AutoLock<> al(ship_mutex);
+      if(shipping_active && !pending.empty())
+        batch.swap(pending);
+    }
+    if(!batch.empty())
+      ship_batch(batch);
+  }
+
+  void RemoteLogStream::start_shipping()
+  {
+    if(f != 0)
+      return;
+    std::vector<char> batch;
+    {
+      AutoLock<> al(ship_mutex);
+      shipping_active = true;
+      // release anything that was logged before the network came up
+      if(!pending.empty())
+        batch.swap(pending);
+    }
+    if(!batch.empty())
+      ship_batch(batch);
+  }
+
+  void RemoteLogStream::stop_shipping()
+  {
+    if(f != 0) {
+      LoggerFileStream::flush();
+      return;
+    }
+    std::vector<char> batch;
+    {
+      AutoLock<> al(ship_mutex);
+      shipping_active = false;
+      drained = true;
+      if(!pending.empty())
+        batch.swap(pending);
+    }
+    if(!batch.empty())
+      ship_batch(batch);
+  }
+
+  void RemoteLogStream::ship_batch(std::vector<char>& batch)
+  {
+    // batches bigger than a single message are fragmented transparently
+    ActiveMessageAuto<LogShipMessage> amsg(LOG_AGGREGATOR_NODE,
+        ActiveMessage<WrappedWithFragInfo<LogShipMessage> >::
+          recommended_max_payload(LOG_AGGREGATOR_NODE,
+                                  false /*!with_congestion*/));
+    amsg->origin = Network::my_node_id;
+    amsg.add_payload(batch.data(), batch.size());
+    amsg.commit();
+  }
+
+  void RemoteLogStream::append_batch(const void *data, size_t datalen)
+  {
+#ifdef DEBUG_REALM
+    assert(f != 0);
+#endif
+    // batches hold whole lines, so block-granularity interleaving of
+    //  different ranks' output is fine - each line names its rank
+    LoggerFileStream::write(static_cast<const char *>(data), datalen);
+  }
+
+  /*static*/ void LogShipMessage::handle_message(NodeID sender,
+                                                 const LogShipMessage &args,
+                                                 const void *data, size_t datalen)
+  {
+    if(remote_log_stream)
+      remote_log_stream->append_batch(data, datalen);
+  }
+
+  AutoMessageRegistrar<LogShipMessage> log_ship_message_registrar;
+
   class LoggerConfig {
   protected:
     LoggerConfig(void);
@@ -148,6 +650,10 @@ namespace Realm {
 
     static void flush_all_streams(void);
 
+    // bracket the window in which a shipping stream may use the network
+    static void start_log_shipping(void);
+    static void stop_log_shipping(void);
+
     void read_command_line(std::vector<std::string>& cmdline);
     void set_default_output(LoggerOutputStream *s);
     void set_logger_output(const std::string& name, LoggerOutputStream *s);
@@ -161,9 +667,19 @@ namespace Realm {
   protected:
     bool parse_level_argument(const std::string& s);
 
+    LoggerFileStream *create_log_stream(FILE *f, bool close_file);
+
     bool cmdline_read;
     Logger::LoggingLevel default_level, stderr_level;
     bool include_timestamp;
+    // 0 = synchronous writes, 1 = deferred (background drainer thread),
+    //  2 = flight recorder (in-memory only until an error or shutdown)
+    int defer_mode;
+    size_t ring_size;  // per-thread ring size (bytes) for modes 1 and 2
+    // when non-empty, all ranks' output is collated into this one file,
+    //  written by the aggregator rank
+    std::string ship_file;
+    size_t ship_batch_size;  // bytes of lines per shipped batch
     std::map<std::string, Logger::LoggingLevel> category_levels;
     std::string cats_enabled;
     std::set<Logger *> pending_configs;
@@ -176,6 +692,9 @@ namespace Realm {
     , default_level(Logger::LEVEL_PRINT)
     , stderr_level(Logger::LEVEL_ERROR)
     , include_timestamp(true)
+    , defer_mode(0)
+    , ring_size(1 << 20)
+    , ship_batch_size(64 << 10)
     , stream(0)
     , stderr_stream(0)
     , default_output(0)
@@ -199,6 +718,18 @@ namespace Realm {
       cfg->stream->flush();
   }
 
+  /*static*/ void LoggerConfig::start_log_shipping(void)
+  {
+    if(remote_log_stream)
+      remote_log_stream->start_shipping();
+  }
+
+  /*static*/ void LoggerConfig::stop_log_shipping(void)
+  {
+    if(remote_log_stream)
+      remote_log_stream->stop_shipping();
+  }
+
   template <>
   int convert_integer_cmdline_argument<Logger::LoggingLevel>(const std::string &s,
                                                              Logger::LoggingLevel &target)
@@ -312,6 +843,10 @@ namespace Realm {
                   .add_option_method("-level", this, &LoggerConfig::parse_level_argument)
                   .add_option_int("-errlevel", stderr_level)
                   .add_option_int("-logtime", include_timestamp)
+                  .add_option_int("-logdefer", defer_mode)
+                  .add_option_int("-logring", ring_size)
+                  .add_option_string("-logship", ship_file)
+                  .add_option_int("-logshipbatch", ship_batch_size)
                   .parse_command_line(cmdline);
 
     if(!ok) {
@@ -319,15 +854,42 @@ namespace Realm {
       exit(1);
     }
 
+    if((defer_mode < 0) || (defer_mode > 2)) {
+      fprintf(stderr, "ERROR: -logdefer must be 0 (sync), 1 (deferred), or 2 (flight recorder)\n");
+      exit(1);
+    }
+
     // TODO: can't currently change streams (they are cached in loggers)
     if(stream)
       return;
 
     // lots of choices for log output
-    if(Config::logname == "stdout") {
-      stream = new LoggerFileStream(stdout, false, include_timestamp);
+    if(!ship_file.empty()) {
+      // collated log shipping - the aggregator rank opens the one output
+      //  file and every other rank ships its lines there, overriding any
+      //  -logfile setting
+      FILE *f = 0;
+      if(Network::my_node_id == LOG_AGGREGATOR_NODE) {
+        f = fopen(ship_file.c_str(), "w");
+        if(!f) {
+          fprintf(stderr, "could not open log file '%s': %s\n",
+                  ship_file.c_str(), strerror(errno));
+          exit(1);
+        }
+        setbuf(f, 0); // disable output buffering
+      }
+      remote_log_stream = new RemoteLogStream(f, include_timestamp,
+                                              ship_batch_size);
+      stream = remote_log_stream;
+
+      // critical-enough messages also go to the local stderr so they are
+      //  visible even if the run dies before the batch ships
+      if(stderr_level < Logger::LEVEL_NONE)
+        stderr_stream = new LoggerFileStream(stderr, false, include_timestamp);
+    } else if(Config::logname == "stdout") {
+      stream = create_log_stream(stdout, false);
     } else if(Config::logname == "stderr") {
-      stream = new LoggerFileStream(stderr, false, include_timestamp);
+      stream = create_log_stream(stderr, false);
     } else {
       // we're going to open a file, but key off a + for appending and
       //  look for a % for node number insertion
@@ -371,7 +933,7 @@ namespace Realm {
       }
       // TODO: consider buffering in some cases?
       setbuf(f, 0); // disable output buffering
-      stream = new LoggerFileStream(f, true, include_timestamp);
+      stream = create_log_stream(f, true);
 
       // when logging to a file, also sent critical-enough messages to stderr
       if(stderr_level < Logger::LEVEL_NONE)
@@ -390,6 +952,15 @@ namespace Realm {
     }
   }
 
+  LoggerFileStream *LoggerConfig::create_log_stream(FILE *f, bool close_file)
+  {
+    if(defer_mode != 0)
+      return new DeferredLogStream(f, close_file, include_timestamp,
+                                   ring_size, (defer_mode == 2));
+
+    return new LoggerFileStream(f, close_file, include_timestamp);
+  }
+
   void LoggerConfig::set_default_output(LoggerOutputStream *s)
   {
     // must be called before command line is parsed
@@ -551,6 +1122,16 @@ namespace Realm {
     LoggerConfig::get_config()->set_logger_output(name, s);
   }
 
+  /*static*/ void Logger::start_log_shipping(void)
+  {
+    LoggerConfig::start_log_shipping();
+  }
+
+  /*static*/ void Logger::stop_log_shipping(void)
+  {
+    LoggerConfig::stop_log_shipping();
+  }
+
   void Logger::log_msg(LoggingLevel level, const char *msgdata, size_t msglen)
   {
     // if we're not configured yet, delay the message
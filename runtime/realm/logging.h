@@ -67,6 +67,12 @@ namespace Realm {
     static void configure_from_cmdline(std::vector<std::string>& cmdline);
     static void set_default_output(LoggerOutputStream *s);
     static void set_logger_output(const std::string& name, LoggerOutputStream *s);
+
+    // when log shipping (-logship) is configured, the runtime calls these
+    //  to bracket the window in which log batches may use the network -
+    //  they are harmless no-ops otherwise
+    static void start_log_shipping(void);
+    static void stop_log_shipping(void);
     
     const std::string& get_name(void) const;
     LoggingLevel get_level(void) const;
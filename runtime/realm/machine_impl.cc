@@ -599,7 +599,9 @@ namespace Realm {
                            << " (bw = " << pma.bandwidth << ", latency = " << pma.latency
                            << ")";
 
-          add_proc_mem_affinity(pma, true /*lock held*/);
+          // defer query cache invalidation until the whole announcement
+          //  has been parsed
+          add_proc_mem_affinity(pma, true /*lock held*/, false /*!invalidate*/);
           // proc_mem_affinities.push_back(pma);
         }
         break;
@@ -647,6 +649,10 @@ namespace Realm {
     }
 
     assert(ok && (fbd.bytes_left() == 0));
+
+    // invalidate the query caches once for the whole announcement rather
+    //  than once per affinity entry
+    invalidate_query_caches();
   }
 
   void MachineImpl::get_all_memories(std::set<Memory> &mset) const
@@ -1076,7 +1082,8 @@ namespace Realm {
     }
 
   void MachineImpl::add_proc_mem_affinity(const Machine::ProcessorMemoryAffinity& pma,
-					  bool lock_held /*= false*/)
+					  bool lock_held /*= false*/,
+					  bool invalidate_caches /*= true*/)
   {
     if(!lock_held) mutex.lock();
 
@@ -1100,7 +1107,8 @@ namespace Realm {
       ptr->add_memory(pma.m);
       ptr->add_proc_mem_affinity(pma);
     }
-    invalidate_query_caches();
+    if(invalidate_caches)
+      invalidate_query_caches();
     if(!lock_held) mutex.unlock();
   }
 
@@ -1167,6 +1175,12 @@ namespace Realm {
             nodeinfos[dst_idx] = dst_nodeInfo;
           }
           for(MemoryImpl *dst_mem : runtime_impl->nodes[dst_idx].memories) {
+            // local-local pairs come up again with the roles reversed when
+            //  the destination is visited as a source, so only handle each
+            //  unordered pair once
+            if((dst_idx == Network::my_node_id) &&
+               (dst_mem->me.id < src_mem->me.id))
+              continue;
             Machine::MemoryMemoryAffinity affinity;
             dst_nodeInfo->add_memory(dst_mem->me);
             Realm::MachineMemInfo* dst_memInfo = dst_nodeInfo->mems[dst_mem->me];
@@ -1175,7 +1189,9 @@ namespace Realm {
               src_memInfo->add_mem_mem_affinity(affinity);
               dst_memInfo->add_mem_mem_affinity(affinity);
             }
-            if(get_memcpy_affinity(runtime_impl, affinity, dst_mem->me, src_mem->me)) {
+            // for a memory paired with itself the reverse path is the same
+            if((src_mem != dst_mem) &&
+               get_memcpy_affinity(runtime_impl, affinity, dst_mem->me, src_mem->me)) {
               src_memInfo->add_mem_mem_affinity(affinity);
               dst_memInfo->add_mem_mem_affinity(affinity);
             }
@@ -1223,6 +1239,7 @@ namespace Realm {
   void cleanup_query_caches()
   {
     MemoryQueryImpl::_mem_cache.clear();
+    MemoryQueryImpl::_mem_cache_affinity.clear();
     ProcessorQueryImpl::_proc_cache.clear();
     ProcessorQueryImpl::_proc_cache_affinity.clear();
   }
@@ -1400,6 +1417,7 @@ namespace Realm {
   {
     impl = ((MemoryQueryImpl *)impl)->writeable_reference();
     ((MemoryQueryImpl *)impl)->add_predicate(new MemoryHasMemAffinityPredicate(m, min_bandwidth, max_latency));
+    ((MemoryQueryImpl *)impl)->reset_cached_proc();
     return *this;
   }
 
@@ -1409,6 +1427,7 @@ namespace Realm {
   {
     impl = ((MemoryQueryImpl *)impl)->writeable_reference();
     ((MemoryQueryImpl *)impl)->add_predicate(new MemoryBestMemAffinityPredicate(m, bandwidth_weight, latency_weight));
+    ((MemoryQueryImpl *)impl)->reset_cached_proc();
     return *this;
   }
 
@@ -1417,7 +1436,13 @@ namespace Realm {
 							      unsigned max_latency /*= 0*/)
   {
     impl = ((MemoryQueryImpl *)impl)->writeable_reference();
+    // we have a cached version of the map, record it
     ((MemoryQueryImpl *)impl)->add_predicate(new MemoryHasProcAffinityPredicate(p, min_bandwidth, max_latency));
+    // query type can use one of the cached maps
+    if (!min_bandwidth && !max_latency)
+      ((MemoryQueryImpl*)impl)->set_cached_proc(p);
+    else
+      ((MemoryQueryImpl*)impl)->reset_cached_proc();
     return *this;
   }
 
@@ -1427,6 +1452,7 @@ namespace Realm {
   {
     impl = ((MemoryQueryImpl *)impl)->writeable_reference();
     ((MemoryQueryImpl *)impl)->add_predicate(new MemoryBestProcAffinityPredicate(p, bandwidth_weight, latency_weight));
+    ((MemoryQueryImpl *)impl)->reset_cached_proc();
     return *this;
   }
 
@@ -2461,6 +2487,7 @@ namespace Realm {
   bool MemoryQueryImpl::global_valid_cache=true;
 
   std::map<Memory::Kind, std::vector<Memory> > MemoryQueryImpl::_mem_cache;
+  std::map<Memory::Kind, std::map<Processor, std::vector<Memory> > > MemoryQueryImpl::_mem_cache_affinity;
 
   MemoryQueryImpl::MemoryQueryImpl(const Machine &_machine)
     : MemoryQueryImpl(static_cast<const MachineImpl *>(_machine.impl))
@@ -2472,6 +2499,8 @@ namespace Realm {
     , is_restricted_node(false)
     , is_restricted_kind(false)
     , restricted_min_capacity(0)
+    , cached_proc(Processor::NO_PROC)
+    , is_cached_proc(false)
     , shared_cached_list(false)
     , valid_cache(false)
     , cur_cached_list(NULL)
@@ -2487,6 +2516,8 @@ namespace Realm {
     , is_restricted_kind(copy_from.is_restricted_kind)
     , restricted_kind(copy_from.restricted_kind)
     , restricted_min_capacity(copy_from.restricted_min_capacity)
+    , cached_proc(copy_from.cached_proc)
+    , is_cached_proc(copy_from.is_cached_proc)
     , shared_cached_list(copy_from.shared_cached_list)
     , valid_cache(copy_from.valid_cache)
     , cur_cached_list(copy_from.cur_cached_list)
@@ -2601,45 +2632,77 @@ namespace Realm {
     }
     bool found = false;
     // shared cache, not mutated query
-    if (is_restricted_kind && (!is_restricted_node) && (!predicates.size()) &&
+    if (is_restricted_kind && (!is_restricted_node) &&
+        (!predicates.size() || is_cached_proc) &&
         (restricted_min_capacity == 0)) {
       // if the caches are invalid and not in the middle of a query, reset
       if (!global_valid_cache) {
         _mem_cache.clear();
+        _mem_cache_affinity.clear();
         global_valid_cache = true;
       }
-      // if cache is not valid for this query
-      std::map<Memory::Kind, std::vector<Memory> >::const_iterator it;
-      it = _mem_cache.find(restricted_kind);
-      if (it != _mem_cache.end()) {
-        found=true;
+      if (!is_cached_proc) {
+        // if cache is not valid for this query
+        std::map<Memory::Kind, std::vector<Memory> >::const_iterator it;
+        it = _mem_cache.find(restricted_kind);
+        if (it != _mem_cache.end()) {
+          found=true;
+        }
+        // if not found - dynamically create the cache
+        // mem_cache may also be cleared/reset when dealing with resilience/elasticity
+        if (!found) {
+          std::map<NodeID, MachineNodeInfo *>::const_iterator it;
+          it = machine->nodeinfos.begin();
+          // iterate over all the nodes
+          while(it != machine->nodeinfos.end()) {
+            std::map<Memory::Kind, std::map<Memory, MachineMemInfo *> >::const_iterator it2 = it->second->mem_by_kind.find(restricted_kind);
+            // find all the memories by memory kind
+            const std::map<Memory, MachineMemInfo *> *plist;
+            // if the list is not empty
+            if(it2 != it->second->mem_by_kind.end())
+              plist = &(it2->second);
+            else
+              plist = 0;
+            if (plist) {
+              found=true;
+              for (std::map<Memory, MachineMemInfo* >::const_iterator it3 =  plist->begin(); it3 != plist->end(); ++it3)
+                (_mem_cache)[restricted_kind].push_back(it3->first);
+            }
+            it++;
+          }
+        }
       }
-      // if not found - dynamically create the cache
-      // mem_cache may also be cleared/reset when dealing with resilience/elasticity
-      if (!found) {
-        std::map<NodeID, MachineNodeInfo *>::const_iterator it;
-        it = machine->nodeinfos.begin();
-        // iterate over all the nodes
-        while(it != machine->nodeinfos.end()) {
-          std::map<Memory::Kind, std::map<Memory, MachineMemInfo *> >::const_iterator it2 = it->second->mem_by_kind.find(restricted_kind);
-          // find all the memories by memory kind
-          const std::map<Memory, MachineMemInfo *> *plist;
-          // if the list is not empty
-          if(it2 != it->second->mem_by_kind.end())
-            plist = &(it2->second);
-          else
-            plist = 0;
-          if (plist) {
-            found=true;
-            for (std::map<Memory, MachineMemInfo* >::const_iterator it3 =  plist->begin(); it3 != plist->end(); ++it3)
-              (_mem_cache)[restricted_kind].push_back(it3->first);
+      // proc-mem affinity
+      else {
+        std::map<Memory::Kind, std::map<Processor, std::vector<Memory> > >::const_iterator it2;
+        it2 = _mem_cache_affinity.find(restricted_kind);
+        if (it2 != _mem_cache_affinity.end()) {
+          std::map<Processor, std::vector<Memory> >::const_iterator it3 = it2->second.find(cached_proc);
+          if (it3 != it2->second.end()) {
+            found = true;
+          }
+        }
+        // if not found - dynamically create the cache
+        if (!found) {
+          std::vector<Machine::ProcessorMemoryAffinity> proc_mem_affinities;
+          machine->get_proc_mem_affinity(proc_mem_affinities);
+          for (unsigned idx = 0; idx < proc_mem_affinities.size(); ++idx) {
+            Machine::ProcessorMemoryAffinity& affinity = proc_mem_affinities[idx];
+            Memory::Kind m_kind = MemoryImpl::get_memory_kind(
+                machine->get_runtime_impl(), affinity.m);
+            _mem_cache_affinity[m_kind][affinity.p].push_back(affinity.m);
+            if(m_kind == restricted_kind)
+              found = true;
           }
-          it++;
         }
       }
     }
-    if (found)
-      return &((_mem_cache)[restricted_kind]);
+    if (found) {
+      if (!is_cached_proc)
+        return &((_mem_cache)[restricted_kind]);
+      else
+        return &(((_mem_cache_affinity)[restricted_kind])[cached_proc]);
+    }
     return NULL;
   }
 
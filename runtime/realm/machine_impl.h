@@ -133,7 +133,8 @@ namespace Realm {
                                     bool remote);
 
       void add_proc_mem_affinity(const Machine::ProcessorMemoryAffinity& pma,
-				 bool lock_held = false);
+				 bool lock_held = false,
+				 bool invalidate_caches = true);
 
       void add_subscription(Machine::MachineUpdateSubscriber *subscriber);
       void remove_subscription(Machine::MachineUpdateSubscriber *subscriber);
@@ -339,6 +340,7 @@ namespace Realm {
       static unsigned int init, cache_invalid_count;
       static bool global_valid_cache;
       static std::map<Memory::Kind, std::vector<Memory> > _mem_cache;
+      static std::map<Memory::Kind, std::map<Processor, std::vector<Memory> > > _mem_cache_affinity;
 
     protected:
       // these things are refcounted and copied-on-write
@@ -360,6 +362,10 @@ namespace Realm {
       Memory next_match(Memory after) const;
       size_t count_matches(void) const;
       Memory random_match(void) const;
+
+      void set_cached_proc(Processor p) { cached_proc = p;
+	if (predicates.size() == 1) is_cached_proc = true; else is_cached_proc=false;};
+      void reset_cached_proc() { cached_proc = Processor::NO_PROC; is_cached_proc = false;};
       Memory cache_next(Memory after);
       bool cached_query(Memory p, Memory &pval);
       bool cached_query(Memory &pval, QueryType q) const;
@@ -374,7 +380,8 @@ namespace Realm {
       bool is_restricted_kind;
       Memory::Kind restricted_kind;
       size_t restricted_min_capacity;
-      bool   shared_cached_list, valid_cache;
+      Processor cached_proc;
+      bool   is_cached_proc, shared_cached_list, valid_cache;
       std::vector<Memory>* cur_cached_list;
       unsigned int invalid_count, cur_index;
       std::vector<MemoryQueryPredicate *> predicates;     
@@ -26,6 +26,15 @@
 #include "realm/activemsg.h"
 #include "realm/transfer/transfer.h"
 
+#ifndef REALM_ON_WINDOWS
+// for memory-mapped external instances
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
 namespace Realm {
 
   Logger log_malloc("malloc");
@@ -37,6 +46,14 @@ namespace Realm {
     // if true, Realm memories attempt to satisfy instance allocation requests
     //  on the basis of deferred instance destructions
     bool deferred_instance_allocation = true;
+
+    // if true, system memories Realm allocates itself get huge page
+    //  backing where the platform supports it - see mem_impl.h
+    bool use_hugepage_memory = false;
+
+    // if true, Realm-allocated system memories are faulted in at
+    //  allocation time rather than on first touch
+    bool prefault_memory = false;
   };
 
 
@@ -198,6 +215,15 @@ namespace Realm {
       }
     }
 
+    void MemoryImpl::release_multiple_storage_deferrable(
+        const std::vector<RegionInstanceImpl *> &insts, Event precondition)
+    {
+      // no batching in the default implementation
+      for(std::vector<RegionInstanceImpl *>::const_iterator it = insts.begin();
+          it != insts.end(); ++it)
+        release_storage_deferrable(*it, precondition);
+    }
+
     MemoryImpl::AllocationResult
     MemoryImpl::reuse_storage_deferrable(RegionInstanceImpl *old_inst,
                                          std::vector<RegionInstanceImpl *> &new_insts,
@@ -932,6 +958,62 @@ namespace Realm {
       }
     }
 
+    void LocalManagedMemory::release_multiple_storage_deferrable(
+        const std::vector<RegionInstanceImpl *> &insts, Event precondition)
+    {
+      // all allocation requests are handled by the memory's owning node for
+      //  now - local caching might be possible though
+      NodeID target = ID(me).memory_owner_node();
+      assert(target == Network::my_node_id);
+
+      bool poisoned = false;
+      bool triggered = precondition.has_triggered_faultaware(poisoned);
+
+      // a poisoned precondition silently cancels the deletions - up to
+      //  requestor to realize this has occurred since the deletions do
+      //  not have their own completion events
+      if(triggered && poisoned)
+	return;
+
+      // instances that can't take the simple batched path below are handled
+      //  one at a time by the non-batched logic
+      std::vector<RegionInstanceImpl *> one_at_a_time;
+      std::vector<RegionInstanceImpl *> released;
+      released.reserve(insts.size());
+      {
+        AutoLock<> al(allocator_mutex);
+
+        for(std::vector<RegionInstanceImpl *>::const_iterator it = insts.begin();
+            it != insts.end(); ++it) {
+          RegionInstanceImpl *inst = *it;
+          // external instances need (un)registration work and anything with
+          //  pending allocations in front of it has to obey the ordered
+          //  pending-ops protocol - a destruction that hasn't triggered yet
+          //  also needs its own deferral bookkeeping
+          if(!triggered || (inst->metadata.ext_resource != 0) ||
+             !pending_allocs.empty()) {
+            one_at_a_time.push_back(inst);
+            continue;
+          }
+
+          // with no pending ops, a triggered destruction applies directly to
+          //  the current heap state
+          if(inst->metadata.inst_offset != RegionInstanceImpl::INSTOFFSET_FAILED)
+            current_allocator.deallocate(inst->me);
+          released.push_back(inst);
+        }
+      }
+
+      // acks go out after the allocator pass, outside the mutex
+      for(std::vector<RegionInstanceImpl *>::const_iterator it = released.begin();
+          it != released.end(); ++it)
+        (*it)->notify_deallocation();
+
+      for(std::vector<RegionInstanceImpl *>::const_iterator it =
+            one_at_a_time.begin(); it != one_at_a_time.end(); ++it)
+        release_storage_deferrable(*it, precondition);
+    }
+
     MemoryImpl::AllocationResult LocalManagedMemory::reuse_storage_deferrable(
         RegionInstanceImpl *old_inst, std::vector<RegionInstanceImpl *> &new_insts,
         Event precondition)
@@ -1831,6 +1913,7 @@ namespace Realm {
     , numa_node(_numa_node)
     , base(nullptr)
     , base_orig(nullptr)
+    , base_map_bytes(0)
     , prealloced(false)
   {
     if(prealloc_base) {
@@ -1856,19 +1939,57 @@ namespace Realm {
 #endif
       {
         // allocate our own space
-        // enforce alignment on the whole memory range
-        // TODO: replace with numasysif and memalign
-        base_orig = static_cast<char *>(malloc(_size + ALIGNMENT - 1));
-        if(!base_orig) {
-          log_malloc.fatal() << "insufficient system memory: " << size
-                              << " bytes needed (from -ll:csize)";
-          abort();
+#if defined(REALM_ON_LINUX) && defined(MAP_HUGETLB)
+        if(Config::use_hugepage_memory) {
+          // round up to a 2MB boundary so either backing can use whole
+          //  huge pages
+          static const size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+          const size_t map_bytes =
+            ((_size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+          int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+          if(Config::prefault_memory)
+            flags |= MAP_POPULATE;
+          // try explicit hugetlb pages first - this fails unless the
+          //  system has enough of them reserved
+          void *m = mmap(nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                         flags | MAP_HUGETLB, -1, 0);
+          if(m == MAP_FAILED) {
+            // fall back to a normal anonymous mapping and ask for
+            //  transparent huge pages - advisory, so failure is fine
+            m = mmap(nullptr, map_bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+#ifdef MADV_HUGEPAGE
+            if(m != MAP_FAILED)
+              (void)madvise(m, map_bytes, MADV_HUGEPAGE);
+#endif
+          } else
+            log_malloc.info() << "hugetlb backing for " << me << ": "
+                              << map_bytes << " bytes";
+          if(m != MAP_FAILED) {
+            // mmap results are page aligned, which covers ALIGNMENT
+            base = base_orig = static_cast<char *>(m);
+            base_map_bytes = map_bytes;
+          } else
+            log_malloc.warning() << "huge page mmap failed for " << me << ": "
+                                 << strerror(errno)
+                                 << " - falling back to malloc";
         }
-        size_t ofs = reinterpret_cast<size_t>(base_orig) % ALIGNMENT;
-        if(ofs > 0) {
-          base = base_orig + (ALIGNMENT - ofs);
-        } else {
-          base = base_orig;
+        if(base == nullptr)
+#endif
+        {
+          // enforce alignment on the whole memory range
+          // TODO: replace with numasysif and memalign
+          base_orig = static_cast<char *>(malloc(_size + ALIGNMENT - 1));
+          if(!base_orig) {
+            log_malloc.fatal() << "insufficient system memory: " << size
+                               << " bytes needed (from -ll:csize)";
+            abort();
+          }
+          size_t ofs = reinterpret_cast<size_t>(base_orig) % ALIGNMENT;
+          if(ofs > 0) {
+            base = base_orig + (ALIGNMENT - ofs);
+          } else {
+            base = base_orig;
+          }
         }
       }
       prealloced = false;
@@ -1888,11 +2009,20 @@ namespace Realm {
 
   LocalCPUMemory::~LocalCPUMemory(void)
   {
-    if(!prealloced && (base_orig != nullptr))
+    if(!prealloced && (base_orig != nullptr)) {
+#ifndef REALM_ON_WINDOWS
+      if(base_map_bytes > 0) {
+        if(munmap(base_orig, base_map_bytes) < 0)
+          log_malloc.warning() << "unable to munmap memory for " << me << ": "
+                               << strerror(errno);
+        return;
+      }
+#endif
       free(base_orig);
+    }
   }
 
-  // LocalCPUMemory supports ExternalMemoryResource
+  // LocalCPUMemory supports ExternalMemoryResource and ExternalMmapResource
   bool LocalCPUMemory::attempt_register_external_resource(RegionInstanceImpl *inst,
                                                           size_t& inst_offset)
   {
@@ -1907,13 +2037,66 @@ namespace Realm {
       return true;
     }
 
+#ifndef REALM_ON_WINDOWS
+    ExternalMmapResource *mres = dynamic_cast<ExternalMmapResource *>(inst->metadata.ext_resource);
+    if(mres != 0) {
+      // we cannot create or grow files here - only map existing contents
+      if(mres->mode == REALM_FILE_CREATE) {
+        log_malloc.warning() << "mmap attach does not support REALM_FILE_CREATE: file=" << mres->filename;
+        return false;
+      }
+      int oflags = ((mres->mode == REALM_FILE_READ_ONLY) ? O_RDONLY : O_RDWR);
+      int fd = open(mres->filename.c_str(), oflags);
+      if(fd < 0) {
+        log_malloc.warning() << "unable to open file for mmap attach: file=" << mres->filename << " error=" << strerror(errno);
+        return false;
+      }
+      // the requested offset need not be page aligned, so map from the
+      //  containing page boundary and skew the instance into the mapping
+      const size_t page_size = sysconf(_SC_PAGESIZE);
+      const size_t page_skew = mres->offset % page_size;
+      const size_t map_bytes = inst->metadata.layout->bytes_used + page_skew;
+      int prot = PROT_READ;
+      if(mres->mode != REALM_FILE_READ_ONLY)
+        prot |= PROT_WRITE;
+      void *map_base = mmap(0, map_bytes, prot, MAP_SHARED, fd,
+                            mres->offset - page_skew);
+      close(fd); // the mapping holds its own reference on the file
+      if(map_base == MAP_FAILED) {
+        log_malloc.warning() << "unable to mmap file for attach: file=" << mres->filename << " bytes=" << map_bytes << " error=" << strerror(errno);
+        return false;
+      }
+      // faults pull pages in lazily, but hint the kernel to start reading
+      //  ahead - this is advisory, so failure is fine
+      (void)madvise(map_base, map_bytes, MADV_WILLNEED);
+      void *mem_base = get_direct_ptr(0, 0);
+      inst_offset = (reinterpret_cast<uintptr_t>(map_base) + page_skew) -
+                    reinterpret_cast<uintptr_t>(mem_base);
+      return true;
+    }
+#endif
+
     // not a kind we recognize
     return false;
   }
 
   void LocalCPUMemory::unregister_external_resource(RegionInstanceImpl *inst)
   {
-    // nothing actually to clean up
+#ifndef REALM_ON_WINDOWS
+    ExternalMmapResource *mres = dynamic_cast<ExternalMmapResource *>(inst->metadata.ext_resource);
+    if(mres != 0) {
+      // recompute the mapping bounds the same way the attach did
+      const size_t page_size = sysconf(_SC_PAGESIZE);
+      const size_t page_skew = mres->offset % page_size;
+      const size_t map_bytes = inst->metadata.layout->bytes_used + page_skew;
+      char *mem_base = static_cast<char *>(get_direct_ptr(0, 0));
+      char *map_base = (mem_base + inst->metadata.inst_offset) - page_skew;
+      if(munmap(map_base, map_bytes) < 0)
+        log_malloc.warning() << "unable to munmap attached file: file=" << mres->filename << " error=" << strerror(errno);
+      return;
+    }
+#endif
+    // nothing actually to clean up for other kinds
   }
 
   // for re-registration purposes, generate an ExternalInstanceResource *
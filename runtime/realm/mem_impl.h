@@ -38,6 +38,17 @@ namespace Realm {
     // if true, Realm memories attempt to satisfy instance allocation requests
     //  on the basis of deferred instance destructions
     extern bool deferred_instance_allocation;
+
+    // if true, system memories Realm allocates itself are mmap'd with huge
+    //  page backing (Linux only): explicit hugetlb pages when the system has
+    //  them reserved, falling back to transparent huge pages via madvise -
+    //  reduces TLB pressure for large heaps
+    extern bool use_hugepage_memory;
+
+    // if true, those mappings are faulted in at allocation time
+    //  (MAP_POPULATE) instead of taking first-touch faults during the
+    //  first use of each page
+    extern bool prefault_memory;
   };
 
   class RegionInstanceImpl;
@@ -110,6 +121,13 @@ namespace Realm {
     virtual void release_storage_deferrable(RegionInstanceImpl *inst,
 					    Event precondition);
 
+    // releases storage for a batch of instances sharing one precondition -
+    //  the default implementation just releases each instance in turn, but
+    //  memories that manage their own heap state can apply the whole batch
+    //  in a single allocator pass
+    virtual void release_multiple_storage_deferrable(
+        const std::vector<RegionInstanceImpl *> &insts, Event precondition);
+
     // reuse storage associated with an instance
     virtual AllocationResult
     reuse_storage_deferrable(RegionInstanceImpl *old_inst,
@@ -305,6 +323,9 @@ namespace Realm {
       virtual void release_storage_deferrable(RegionInstanceImpl *inst,
 					      Event precondition);
 
+      virtual void release_multiple_storage_deferrable(
+          const std::vector<RegionInstanceImpl *> &insts, Event precondition);
+
       virtual AllocationResult
       reuse_storage_deferrable(RegionInstanceImpl *old_inst,
                                std::vector<RegionInstanceImpl *> &new_insts,
@@ -410,6 +431,7 @@ namespace Realm {
       const int numa_node;
     public: //protected:
       char *base, *base_orig;
+      size_t base_map_bytes; // nonzero when base_orig is an mmap'd region
       bool prealloced;
       NetworkSegment local_segment;
     };
@@ -201,6 +201,11 @@ namespace Realm {
       return ThreadLocal::my_doorbell;
   }
 
+  void Doorbell::set_sleep_timeout(long long timeout_in_ns)
+  {
+    sleep_timeout = timeout_in_ns;
+  }
+
   uint32_t Doorbell::wait_slow()
   {
     DoorbellImpl *dbi = static_cast<DoorbellImpl *>(this);
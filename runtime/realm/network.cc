@@ -134,13 +134,227 @@ namespace Realm {
   }
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class LoopbackActiveMessageImpl
+  //
+
+  // covers messages a node sends to itself - the registered handler is
+  //  called directly from commit() with the header and payload passed by
+  //  pointer, so nothing is ever serialized
+
+  namespace {
+
+    struct CompletionList {
+      size_t bytes;
+
+      static const size_t TOTAL_CAPACITY = 256;
+      typedef char Storage_unaligned[TOTAL_CAPACITY];
+      REALM_ALIGNED_TYPE_CONST(Storage_aligned, Storage_unaligned,
+			       CompletionCallbackBase::ALIGNMENT);
+      Storage_aligned storage;
+    };
+
+  };
+
+  class LoopbackActiveMessageImpl : public ActiveMessageImpl {
+  public:
+    LoopbackActiveMessageImpl(unsigned short _msgid,
+			      size_t _header_size,
+			      size_t _max_payload_size,
+			      const void *_src_payload_addr,
+			      size_t _src_payload_lines,
+			      size_t _src_payload_line_stride,
+			      void *_dest_payload_addr,
+			      bool _deliver);
+
+    virtual ~LoopbackActiveMessageImpl();
+
+    // reserves space for a local/remote completion - caller will
+    //  placement-new the completion at the provided address
+    virtual void *add_local_completion(size_t size);
+    virtual void *add_remote_completion(size_t size);
+
+    virtual void commit(size_t act_payload_size);
+    virtual void cancel();
+
+  protected:
+    static const size_t INLINE_HEADER_SIZE = 128;
+
+    const void *src_payload_addr;
+    size_t src_payload_lines;
+    size_t src_payload_line_stride;
+    void *dest_payload_addr;
+    bool deliver;
+    bool payload_needs_free;
+    CompletionList *local_comp, *remote_comp;
+
+    unsigned short msgid;
+    uint64_t msg_header[INLINE_HEADER_SIZE / sizeof(uint64_t)];
+  };
+
+  LoopbackActiveMessageImpl::LoopbackActiveMessageImpl(unsigned short _msgid,
+						       size_t _header_size,
+						       size_t _max_payload_size,
+						       const void *_src_payload_addr,
+						       size_t _src_payload_lines,
+						       size_t _src_payload_line_stride,
+						       void *_dest_payload_addr,
+						       bool _deliver)
+    : src_payload_addr(_src_payload_addr)
+    , src_payload_lines(_src_payload_lines)
+    , src_payload_line_stride(_src_payload_line_stride)
+    , dest_payload_addr(_dest_payload_addr)
+    , deliver(_deliver)
+    , payload_needs_free(false)
+    , local_comp(0)
+    , remote_comp(0)
+    , msgid(_msgid)
+  {
+    assert(_header_size <= INLINE_HEADER_SIZE);
+    header_base = msg_header;
+
+    if(_max_payload_size && (src_payload_addr == 0)) {
+      if(dest_payload_addr != 0) {
+	// on a single node an "rdma" target is just a local pointer, so let
+	//  the caller compose the payload directly in the destination
+	payload_base = dest_payload_addr;
+      } else {
+	payload_base = malloc(_max_payload_size);
+	assert(payload_base != 0);
+	payload_needs_free = true;
+      }
+    } else
+      payload_base = 0;
+    payload_size = _max_payload_size;
+  }
+
+  LoopbackActiveMessageImpl::~LoopbackActiveMessageImpl()
+  {
+  }
+
+  void *LoopbackActiveMessageImpl::add_local_completion(size_t size)
+  {
+    if(local_comp == 0) {
+      local_comp = new CompletionList;
+      local_comp->bytes = 0;
+    }
+    size_t ofs = local_comp->bytes;
+    local_comp->bytes += size;
+    assert(local_comp->bytes <= CompletionList::TOTAL_CAPACITY);
+    return (local_comp->storage + ofs);
+  }
+
+  void *LoopbackActiveMessageImpl::add_remote_completion(size_t size)
+  {
+    if(remote_comp == 0) {
+      remote_comp = new CompletionList;
+      remote_comp->bytes = 0;
+    }
+    size_t ofs = remote_comp->bytes;
+    remote_comp->bytes += size;
+    assert(remote_comp->bytes <= CompletionList::TOTAL_CAPACITY);
+    return (remote_comp->storage + ofs);
+  }
+
+  void LoopbackActiveMessageImpl::commit(size_t act_payload_size)
+  {
+    // figure out what the handler should see as the payload
+    const void *payload = payload_base;
+    if(src_payload_addr != 0) {
+      if(dest_payload_addr != 0) {
+	// a put to ourselves is just a (maybe line-by-line) copy
+	size_t bytes_per_line = ((src_payload_lines > 1) ?
+				   (act_payload_size / src_payload_lines) :
+				   act_payload_size);
+	for(size_t i = 0; i < std::max<size_t>(src_payload_lines, 1); i++)
+	  memcpy(static_cast<char *>(dest_payload_addr) + (i * bytes_per_line),
+		 (static_cast<const char *>(src_payload_addr) +
+		  (i * src_payload_line_stride)),
+		 bytes_per_line);
+	payload = dest_payload_addr;
+      } else if(src_payload_lines > 1) {
+	// handlers expect a contiguous payload, so gather the lines
+	size_t bytes_per_line = act_payload_size / src_payload_lines;
+	char *buffer = static_cast<char *>(malloc(act_payload_size));
+	assert(buffer != 0);
+	for(size_t i = 0; i < src_payload_lines; i++)
+	  memcpy(buffer + (i * bytes_per_line),
+		 (static_cast<const char *>(src_payload_addr) +
+		  (i * src_payload_line_stride)),
+		 bytes_per_line);
+	payload_base = buffer;
+	payload_needs_free = true;
+	payload = buffer;
+      } else {
+	// hand the caller's buffer to the handler as is
+	payload = src_payload_addr;
+      }
+    }
+
+    if(deliver) {
+      ActiveMessageHandlerTable::HandlerEntry *handler =
+	activemsg_handler_table.lookup_message_handler(msgid);
+      assert(handler != 0);
+
+      // call the handler right here rather than going through the incoming
+      //  message manager
+      bool was_in_handler = ThreadLocal::in_message_handler;
+      ThreadLocal::in_message_handler = true;
+      if(handler->handler != 0)
+	(handler->handler)(Network::my_node_id, header_base,
+			   payload, act_payload_size, TimeLimit());
+      else
+	(handler->handler_notimeout)(Network::my_node_id, header_base,
+				     payload, act_payload_size);
+      ThreadLocal::in_message_handler = was_in_handler;
+    }
+
+    if(payload_needs_free)
+      free(payload_base);
+
+    // delivery was synchronous, so all completions can be fired now
+    if(local_comp != 0) {
+      CompletionCallbackBase::invoke_all(local_comp->storage,
+					 local_comp->bytes);
+      CompletionCallbackBase::destroy_all(local_comp->storage,
+					  local_comp->bytes);
+      delete local_comp;
+    }
+    if(remote_comp != 0) {
+      CompletionCallbackBase::invoke_all(remote_comp->storage,
+					 remote_comp->bytes);
+      CompletionCallbackBase::destroy_all(remote_comp->storage,
+					  remote_comp->bytes);
+      delete remote_comp;
+    }
+  }
+
+  void LoopbackActiveMessageImpl::cancel()
+  {
+    if(payload_needs_free)
+      free(payload_base);
+    // a cancelled message never completes, so just destroy any callbacks
+    if(local_comp != 0) {
+      CompletionCallbackBase::destroy_all(local_comp->storage,
+					  local_comp->bytes);
+      delete local_comp;
+    }
+    if(remote_comp != 0) {
+      CompletionCallbackBase::destroy_all(remote_comp->storage,
+					  remote_comp->bytes);
+      delete remote_comp;
+    }
+  }
+
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class LoopbackNetworkModule
   //
 
   // used when there are no other networks
-  
+
   class LoopbackNetworkModule : public NetworkModule {
   protected:
     LoopbackNetworkModule();
@@ -370,8 +584,15 @@ namespace Realm {
 								       void *storage_base,
 								       size_t storage_size)
   {
-    // should never be called
-    abort();
+    assert(target == Network::my_node_id);
+    assert(storage_size >= sizeof(LoopbackActiveMessageImpl));
+    return new(storage_base) LoopbackActiveMessageImpl(msgid, header_size,
+						       max_payload_size,
+						       src_payload_addr,
+						       src_payload_lines,
+						       src_payload_line_stride,
+						       0 /*no dest addr*/,
+						       true /*deliver*/);
   }
 
   ActiveMessageImpl *LoopbackNetworkModule::create_active_message_impl(
@@ -380,16 +601,34 @@ namespace Realm {
       size_t src_payload_line_stride, const RemoteAddress &dest_payload_addr,
       void *storage_base, size_t storage_size)
   {
-    // should never be called
-    abort();
+    assert(target == Network::my_node_id);
+    assert(storage_size >= sizeof(LoopbackActiveMessageImpl));
+    // both addresses refer to our own address space
+    const void *src_ptr =
+      (reinterpret_cast<const char *>(src_payload_addr.segment->base) +
+       src_payload_addr.offset);
+    void *dest_ptr = reinterpret_cast<void *>(dest_payload_addr.ptr);
+    return new(storage_base) LoopbackActiveMessageImpl(msgid, header_size,
+						       max_payload_size,
+						       src_ptr,
+						       src_payload_lines,
+						       src_payload_line_stride,
+						       dest_ptr,
+						       true /*deliver*/);
   }
 
   ActiveMessageImpl *LoopbackNetworkModule::create_active_message_impl(
       NodeID target, unsigned short msgid, size_t header_size, size_t max_payload_size,
       const RemoteAddress &dest_payload_addr, void *storage_base, size_t storage_size)
   {
-    // should never be called
-    abort();
+    assert(target == Network::my_node_id);
+    assert(storage_size >= sizeof(LoopbackActiveMessageImpl));
+    void *dest_ptr = reinterpret_cast<void *>(dest_payload_addr.ptr);
+    return new(storage_base) LoopbackActiveMessageImpl(msgid, header_size,
+						       max_payload_size,
+						       0, 0, 0,
+						       dest_ptr,
+						       true /*deliver*/);
   }
 
   ActiveMessageImpl *LoopbackNetworkModule::create_active_message_impl(const NodeSet& targets,
@@ -402,26 +641,33 @@ namespace Realm {
 								       void *storage_base,
 								       size_t storage_size)
   {
-    // should never be called
-    abort();
+    // the only node we can multicast to is ourselves
+    assert((targets.size() == 0) ||
+	   ((targets.size() == 1) && targets.contains(Network::my_node_id)));
+    assert(storage_size >= sizeof(LoopbackActiveMessageImpl));
+    return new(storage_base) LoopbackActiveMessageImpl(msgid, header_size,
+						       max_payload_size,
+						       src_payload_addr,
+						       src_payload_lines,
+						       src_payload_line_stride,
+						       0 /*no dest addr*/,
+						       (targets.size() > 0));
   }
   
   size_t LoopbackNetworkModule::recommended_max_payload(NodeID target,
 							bool with_congestion,
 							size_t header_size)
   {
-    // should never be called
-    abort();
-    return 0;
+    // no serialization or buffering happens, so allow large messages
+    return (4 << 20);
   }
 
   size_t LoopbackNetworkModule::recommended_max_payload(const NodeSet& targets,
 							bool with_congestion,
 							size_t header_size)
   {
-    // should never be called
-    abort();
-    return 0;
+    // no serialization or buffering happens, so allow large messages
+    return (4 << 20);
   }
 
   size_t LoopbackNetworkModule::recommended_max_payload(NodeID target,
@@ -429,9 +675,8 @@ namespace Realm {
 							bool with_congestion,
 							size_t header_size)
   {
-    // should never be called
-    abort();
-    return 0;
+    // no serialization or buffering happens, so allow large messages
+    return (4 << 20);
   }
   
   size_t LoopbackNetworkModule::recommended_max_payload(NodeID target,
@@ -440,9 +685,8 @@ namespace Realm {
 							bool with_congestion,
 							size_t header_size)
   {
-    // should never be called
-    abort();
-    return 0;
+    // no serialization or buffering happens, so allow large messages
+    return (4 << 20);
   }
 
   size_t LoopbackNetworkModule::recommended_max_payload(const NodeSet& targets,
@@ -451,9 +695,8 @@ namespace Realm {
 							bool with_congestion,
 							size_t header_size)
   {
-    // should never be called
-    abort();
-    return 0;
+    // no serialization or buffering happens, so allow large messages
+    return (4 << 20);
   }
 
   size_t LoopbackNetworkModule::recommended_max_payload(
@@ -461,9 +704,8 @@ namespace Realm {
       size_t lines, size_t line_stride, const RemoteAddress &dest_payload_addr,
       bool with_congestion, size_t header_size)
   {
-    // should never be called
-    abort();
-    return 0;
+    // no serialization or buffering happens, so allow large messages
+    return (4 << 20);
   }
   
 
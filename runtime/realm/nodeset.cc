@@ -541,6 +541,34 @@ namespace Realm {
     }
   }
 
+  NodeID NodeSetBitmask::last_contiguous(NodeID start) const
+  {
+#ifdef DEBUG_REALM
+    assert((start >= 0) && (start <= max_node_id));
+    assert(is_set(start));
+#endif
+    size_t elmt_idx = start / BITS_PER_ELEM;
+    size_t elmt_ofs = start % BITS_PER_ELEM;
+    // look for the first clear bit at or after 'start' - the run ends
+    //  just before it (shift after inverting so bits shifted in at the
+    //  top read as still-set and don't end the run at the element edge)
+    bitmask_elem_t v = (~bits[elmt_idx]) >> elmt_ofs;
+    if(v != 0) {
+      NodeID last = start + ctz(v) - 1;
+      return (last > max_node_id) ? max_node_id : last;
+    }
+    // run covers the rest of this element - continue with whole elements
+    //  (bits above max_node_id are always clear, so this terminates)
+    while(++elmt_idx < bitset_elements) {
+      v = ~bits[elmt_idx];
+      if(v != 0) {
+	NodeID last = (elmt_idx * BITS_PER_ELEM) + ctz(v) - 1;
+	return (last > max_node_id) ? max_node_id : last;
+      }
+    }
+    return max_node_id;
+  }
+
   void NodeSetBitmask::l2_set(int elmt_idx)
   {
     size_t l2_idx = bitset_elements + (elmt_idx / BITS_PER_ELEM);
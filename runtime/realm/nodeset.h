@@ -67,6 +67,31 @@ namespace Realm {
     short iter_pos; // needed for non-bitmask encodings
   };
 
+  // iterates over dense ranges of node ids rather than individual nodes,
+  //  allowing fan-out loops to batch their work per range - ranges are
+  //  maximal for the range and bitmask encodings, but distinct values are
+  //  stored unsorted and are yielded as singleton ranges
+  class REALM_INTERNAL_API_EXTERNAL_LINKAGE NodeSetRangeIterator {
+  public:
+    NodeSetRangeIterator();
+    NodeSetRangeIterator(const NodeSet& _nodeset);
+
+    bool operator==(const NodeSetRangeIterator& compare_to) const;
+    bool operator!=(const NodeSetRangeIterator& compare_to) const;
+
+    // current range is [range_lo, range_hi] (inclusive)
+    NodeID range_lo() const;
+    NodeID range_hi() const;
+
+    NodeSetRangeIterator& operator++(/*prefix*/);
+    NodeSetRangeIterator operator++(int /*postfix*/);
+
+  protected:
+    const NodeSet *nodeset;
+    NodeID cur_lo, cur_hi;
+    short iter_pos; // needed for non-bitmask encodings
+  };
+
   class REALM_INTERNAL_API_EXTERNAL_LINKAGE NodeSetBitmask {
   protected:
     NodeSetBitmask();
@@ -92,6 +117,9 @@ namespace Realm {
 
     NodeID first_set() const;
     NodeID next_set(NodeID after) const;
+    // returns the last node id of the dense run starting at 'start'
+    //  (which must be set)
+    NodeID last_contiguous(NodeID start) const;
 
     void copy(const NodeSetBitmask *copy_from);
 
@@ -142,8 +170,14 @@ namespace Realm {
     const_iterator begin() const;
     const_iterator end() const;
 
+    typedef NodeSetRangeIterator const_range_iterator;
+
+    const_range_iterator ranges_begin() const;
+    const_range_iterator ranges_end() const;
+
   protected:
     friend class NodeSetIterator;
+    friend class NodeSetRangeIterator;
 
     unsigned count;
 
@@ -363,6 +363,16 @@ namespace Realm {
     return NodeSetIterator();
   }
 
+  inline NodeSet::const_range_iterator NodeSet::ranges_begin() const
+  {
+    return NodeSetRangeIterator(*this);
+  }
+
+  inline NodeSet::const_range_iterator NodeSet::ranges_end() const
+  {
+    return NodeSetRangeIterator();
+  }
+
 
   ////////////////////////////////////////////////////////////////////////
   //
@@ -487,4 +497,135 @@ namespace Realm {
   }
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class NodeSetRangeIterator
+
+  inline NodeSetRangeIterator::NodeSetRangeIterator()
+    : nodeset(0)
+    , cur_lo(-1)
+    , cur_hi(-1)
+  {}
+
+  inline NodeSetRangeIterator::NodeSetRangeIterator(const NodeSet& _nodeset)
+    : nodeset(&_nodeset)
+  {
+    if(nodeset->count > 0) {
+      switch(nodeset->enc_format) {
+      case NodeSet::ENC_VALS:
+	{
+	  // values are unsorted, so each is its own (singleton) range
+	  cur_lo = cur_hi = nodeset->data.values[0];
+	  iter_pos = 0;
+	  break;
+	}
+      case NodeSet::ENC_RANGES:
+	{
+	  cur_lo = nodeset->data.ranges[0].lo;
+	  cur_hi = nodeset->data.ranges[0].hi;
+	  iter_pos = 0;
+	  break;
+	}
+      case NodeSet::ENC_BITMASK:
+	{
+	  cur_lo = nodeset->data.bitmask->first_set();
+	  cur_hi = nodeset->data.bitmask->last_contiguous(cur_lo);
+	  break;
+	}
+      }
+    } else {
+      cur_lo = -1;
+      cur_hi = -1;
+    }
+  }
+
+  inline bool NodeSetRangeIterator::operator==(const NodeSetRangeIterator& compare_to) const
+  {
+    if(cur_lo == -1) {
+      // only cur_lo must match for a finished iterator
+      return(compare_to.cur_lo == -1);
+    } else {
+      // otherwise both node set and current range must match
+      return((nodeset == compare_to.nodeset) &&
+	     (cur_lo == compare_to.cur_lo));
+    }
+  }
+
+  inline bool NodeSetRangeIterator::operator!=(const NodeSetRangeIterator& compare_to) const
+  {
+    if(cur_lo == -1) {
+      // only cur_lo must match for a finished iterator
+      return(compare_to.cur_lo != -1);
+    } else {
+      // otherwise both node set and current range must match
+      return((nodeset != compare_to.nodeset) ||
+	     (cur_lo != compare_to.cur_lo));
+    }
+  }
+
+  inline NodeID NodeSetRangeIterator::range_lo() const
+  {
+#ifdef DEBUG_REALM_NODESET
+    assert(nodeset->reference_set.count(cur_lo) > 0);
+#endif
+    return cur_lo;
+  }
+
+  inline NodeID NodeSetRangeIterator::range_hi() const
+  {
+#ifdef DEBUG_REALM_NODESET
+    assert(nodeset->reference_set.count(cur_hi) > 0);
+#endif
+    return cur_hi;
+  }
+
+  inline NodeSetRangeIterator& NodeSetRangeIterator::operator++(/*prefix*/)
+  {
+    if(cur_lo != -1) {
+      switch(nodeset->enc_format) {
+      case NodeSet::ENC_VALS:
+	{
+	  iter_pos++;
+	  if(iter_pos < short(nodeset->count)) {
+	    cur_lo = cur_hi = nodeset->data.values[iter_pos];
+	  } else {
+	    cur_lo = -1;
+	    cur_hi = -1;
+	  }
+	  break;
+	}
+      case NodeSet::ENC_RANGES:
+	{
+	  iter_pos++;
+	  if(iter_pos < nodeset->range_count) {
+	    cur_lo = nodeset->data.ranges[iter_pos].lo;
+	    cur_hi = nodeset->data.ranges[iter_pos].hi;
+	  } else {
+	    cur_lo = -1;
+	    cur_hi = -1;
+	  }
+	  break;
+	}
+      case NodeSet::ENC_BITMASK:
+	{
+	  cur_lo = nodeset->data.bitmask->next_set(cur_hi);
+	  if(cur_lo != -1)
+	    cur_hi = nodeset->data.bitmask->last_contiguous(cur_lo);
+	  else
+	    cur_hi = -1;
+	  break;
+	}
+      }
+    }
+    return *this;
+  }
+
+  inline NodeSetRangeIterator NodeSetRangeIterator::operator++(int /*postfix*/)
+  {
+    NodeSetRangeIterator orig = *this;
+    ++(*this);
+    return orig;
+  }
+
+
 };
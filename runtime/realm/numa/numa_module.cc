@@ -16,6 +16,7 @@
 #include "realm/numa/numa_module.h"
 
 #include "realm/numa/numasysif.h"
+#include "realm/transfer/ib_memory.h"
 #include "realm/logging.h"
 #include "realm/cmdline.h"
 #include "realm/proc_impl.h"
@@ -94,6 +95,7 @@ namespace Realm {
     {
       config_map.insert({"numamem", &cfg_numa_mem_size});
       config_map.insert({"numa_nocpumem", &cfg_numa_nocpu_mem_size});
+      config_map.insert({"numa_ibmem", &cfg_numa_ib_mem_size});
       config_map.insert({"numacpus", &cfg_num_numa_cpus});
       config_map.insert({"pin_memory", &cfg_pin_memory});
 
@@ -124,6 +126,7 @@ namespace Realm {
 
       cp.add_option_int_units("-ll:nsize", cfg_numa_mem_size, 'm')
         .add_option_int_units("-ll:ncsize", cfg_numa_nocpu_mem_size, 'm')
+        .add_option_int_units("-ll:nibsize", cfg_numa_ib_mem_size, 'm')
         .add_option_int("-ll:ncpu", cfg_num_numa_cpus)
         .add_option_bool("-numa:pin", cfg_pin_memory);
 
@@ -174,6 +177,7 @@ namespace Realm {
       // if neither NUMA memory nor cpus was requested, there's no point
       if((m->config->cfg_numa_mem_size == 0) &&
 	 (m->config->cfg_numa_nocpu_mem_size <= 0) &&
+         (m->config->cfg_numa_ib_mem_size == 0) &&
 	 (m->config->cfg_num_numa_cpus == 0)) {
 	log_numa.debug() << "no NUMA memory or cpus requested";
 	delete m;
@@ -223,6 +227,26 @@ namespace Realm {
 	  log_numa.warning() << "insufficient memory in NUMA node " << mi.node_id << " (" << mem_size << " > " << mi.bytes_available << " bytes) - skipping allocation";
 	}
       }
+      // intermediate buffer pools get sized separately so staging for
+      // copies can stay on the socket whose memory they touch
+      if(m->config->cfg_numa_ib_mem_size > 0) {
+        for(std::map<int, NumaNodeMemInfo>::const_iterator it = meminfo.begin();
+            it != meminfo.end(); ++it) {
+          const NumaNodeMemInfo &mi = it->second;
+          size_t ib_size = m->config->cfg_numa_ib_mem_size;
+          std::map<int, size_t>::const_iterator finder =
+              m->numa_mem_sizes.find(mi.node_id);
+          size_t already = (finder != m->numa_mem_sizes.end()) ? finder->second : 0;
+          if(mi.bytes_available >= (already + ib_size)) {
+            m->numa_ib_bases[mi.node_id] = 0;
+            m->numa_ib_sizes[mi.node_id] = ib_size;
+          } else {
+            log_numa.warning() << "insufficient memory in NUMA node " << mi.node_id
+                               << " for intermediate buffers (" << ib_size
+                               << " bytes) - skipping allocation";
+          }
+        }
+      }
       for(std::map<int, NumaNodeCpuInfo>::const_iterator it = cpuinfo.begin();
 	  it != cpuinfo.end();
 	  ++it) {
@@ -261,6 +285,18 @@ namespace Realm {
 	}
 	it->second = base;
       }
+      for(std::map<int, void *>::iterator it = numa_ib_bases.begin();
+          it != numa_ib_bases.end(); ++it) {
+        size_t ib_size = numa_ib_sizes[it->first];
+        assert(ib_size > 0);
+        void *base = numasysif_alloc_mem(it->first, ib_size,
+                                         config->cfg_pin_memory);
+        if(!base) {
+          log_numa.fatal() << "allocation of " << ib_size << " intermediate buffer bytes in NUMA node " << it->first << " failed!";
+          assert(false);
+        }
+        it->second = base;
+      }
     }
 
     // create any memories provided by this module (default == do nothing)
@@ -286,6 +322,25 @@ namespace Realm {
 	runtime->add_memory(numamem);
 	memories[mem_node] = numamem;
       }
+
+      // the per-domain intermediate buffer pools are visible to the dma
+      // system's path search just like any other ib memory - the channel
+      // cost estimates decide when a socket-local staging buffer wins
+      for(std::map<int, void *>::iterator it = numa_ib_bases.begin();
+          it != numa_ib_bases.end(); ++it) {
+        int mem_node = it->first;
+        void *base_ptr = it->second;
+        size_t ib_size = numa_ib_sizes[it->first];
+        assert(ib_size > 0);
+
+        Memory m = runtime->next_local_ib_memory_id();
+        IBMemory *ibmem = new IBMemory(m, ib_size,
+                                       MemoryImpl::MKIND_SYSMEM,
+                                       Memory::SOCKET_MEM,
+                                       base_ptr, 0 /*not registered*/);
+        runtime->add_ib_memory(ibmem);
+        ib_memories[mem_node] = ibmem;
+      }
     }
 
     // create any processors provided by the module (default == do nothing)
@@ -383,6 +438,14 @@ namespace Realm {
 	if(!ok)
 	  log_numa.error() << "failed to free memory in NUMA node " << it->first << ": ptr=" << it->second;
       }
+      for(std::map<int, void *>::iterator it = numa_ib_bases.begin();
+          it != numa_ib_bases.end(); ++it) {
+        size_t ib_size = numa_ib_sizes[it->first];
+        assert(ib_size > 0);
+        bool ok = numasysif_free_mem(it->first, it->second, ib_size);
+        if(!ok)
+          log_numa.error() << "failed to free intermediate buffer memory in NUMA node " << it->first << ": ptr=" << it->second;
+      }
     }
 
   }; // namespace Numa
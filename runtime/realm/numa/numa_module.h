@@ -21,6 +21,7 @@
 namespace Realm {
 
   class MemoryImpl;
+  class IBMemory;
 
   namespace Numa {
 
@@ -37,6 +38,7 @@ namespace Realm {
     protected:
       size_t cfg_numa_mem_size = 0;
       ssize_t cfg_numa_nocpu_mem_size = -1;
+      size_t cfg_numa_ib_mem_size = 0;
       int cfg_num_numa_cpus = 0;
       bool cfg_pin_memory = false;
       size_t cfg_stack_size = 2 << 20;
@@ -86,8 +88,13 @@ namespace Realm {
       // "global" variables live here too
       std::map<int, void *> numa_mem_bases;
       std::map<int, size_t> numa_mem_sizes;
+      // per-domain intermediate buffer pools so dma staging for copies
+      // that touch a socket's memory can stay on that socket
+      std::map<int, void *> numa_ib_bases;
+      std::map<int, size_t> numa_ib_sizes;
       std::map<int, int> numa_cpu_counts;
       std::map<int, MemoryImpl *> memories;
+      std::map<int, IBMemory *> ib_memories;
     };
 
   }; // namespace Numa
@@ -27,6 +27,7 @@ namespace Realm {
 #ifndef REALM_OPENMP_SYSTEM_RUNTIME
   class ThreadPool;
 #endif
+  class BackgroundWorkManager;
 
   // this is nearly identical to a LocalCPUProcessor, but it asks for its thread(s)
   //  to run on the specified numa domain
@@ -35,7 +36,8 @@ namespace Realm {
   public:
     LocalOpenMPProcessor(RuntimeImpl *runtime_impl, Processor _me, int _numa_node,
                          int _num_threads, bool _fake_cpukind, CoreReservationSet &crs,
-                         size_t _stack_size, bool _force_kthreads);
+                         size_t _stack_size, bool _force_kthreads,
+                         BackgroundWorkManager *_bgwork, long long _bgwork_timeslice);
     virtual ~LocalOpenMPProcessor(void);
 
     virtual void shutdown(void);
@@ -51,7 +51,9 @@ namespace Realm {
   LocalOpenMPProcessor::LocalOpenMPProcessor(RuntimeImpl *runtime_impl, Processor _me,
                                              int _numa_node, int _num_threads,
                                              bool _fake_cpukind, CoreReservationSet &crs,
-                                             size_t _stack_size, bool _force_kthreads)
+                                             size_t _stack_size, bool _force_kthreads,
+                                             BackgroundWorkManager *_bgwork,
+                                             long long _bgwork_timeslice)
     : LocalTaskProcessor(runtime_impl, _me,
                          (_fake_cpukind ? Processor::LOC_PROC : Processor::OMP_PROC))
     , numa_node(_numa_node)
@@ -82,13 +84,18 @@ namespace Realm {
 #ifdef REALM_USE_USER_THREADS
       if(!_force_kthreads) {
 	UserThreadTaskScheduler *sched = new UserThreadTaskScheduler(me, *core_rsrv);
-	// no config settings we want to tweak yet
+	if(_bgwork_timeslice > 0)
+	  sched->configure_bgworker(_bgwork, _bgwork_timeslice, numa_node);
+
 	set_scheduler(sched);
       } else
 #endif
       {
 	KernelThreadTaskScheduler *sched = new KernelThreadTaskScheduler(me, *core_rsrv);
 	sched->cfg_max_idle_workers = 3; // keep a few idle threads around
+	if(_bgwork_timeslice > 0)
+	  sched->configure_bgworker(_bgwork, _bgwork_timeslice, numa_node);
+
 	set_scheduler(sched);
       }
       sched->add_task_context(&ctxmgr);
@@ -98,7 +105,8 @@ namespace Realm {
     pool = new ThreadPool(me,
                           num_threads - 1,
 			  stringbuilder() << "OMP" << numa_node << " proc " << _me,
-			  numa_node, _stack_size, crs);
+			  numa_node, _stack_size, crs,
+			  _bgwork, _bgwork_timeslice);
 
     // eagerly spin up worker threads
     pool->start_worker_threads();
@@ -206,6 +214,7 @@ namespace Realm {
       config_map.insert({"othr", &cfg_num_threads_per_cpu});
       config_map.insert({"onuma", &cfg_use_numa});
       config_map.insert({"ostack", &cfg_stack_size});
+      config_map.insert({"omp_bgwork", &cfg_bgwork_timeslice});
     }
 
     void OpenMPModuleConfig::configure_from_cmdline(std::vector<std::string>& cmdline)
@@ -217,7 +226,8 @@ namespace Realm {
         .add_option_int("-ll:othr", cfg_num_threads_per_cpu)
         .add_option_int("-ll:onuma", cfg_use_numa)
         .add_option_int_units("-ll:ostack", cfg_stack_size, 'm')
-        .add_option_bool("-ll:okindhack", cfg_fake_cpukind);
+        .add_option_bool("-ll:okindhack", cfg_fake_cpukind)
+        .add_option_int("-ll:omp_bgwork", cfg_bgwork_timeslice);
 
       bool ok = cp.parse_command_line(cmdline);
       if(!ok) {
@@ -334,7 +344,8 @@ namespace Realm {
         ProcessorImpl *pi = new LocalOpenMPProcessor(
             runtime, p, cpu_node, config->cfg_num_threads_per_cpu,
             config->cfg_fake_cpukind, runtime->core_reservation_set(),
-            config->cfg_stack_size, Config::force_kernel_threads);
+            config->cfg_stack_size, Config::force_kernel_threads,
+            &runtime->bgwork, config->cfg_bgwork_timeslice);
         runtime->add_processor(pi);
 
         // FIXME: once the stuff in runtime_impl.cc is removed, remove
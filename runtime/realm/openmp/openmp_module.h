@@ -36,6 +36,7 @@ namespace Realm {
       bool cfg_use_numa = true;
       bool cfg_fake_cpukind = false;
       size_t cfg_stack_size = 2 << 20;
+      long long cfg_bgwork_timeslice = 0;
     };
 
     // our interface to the rest of the runtime
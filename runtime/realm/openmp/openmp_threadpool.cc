@@ -17,6 +17,7 @@
 #include <thread>
 #include "realm/openmp/openmp_threadpool.h"
 
+#include "realm/bgwork.h"
 #include "realm/logging.h"
 #include "realm/proc_impl.h"
 
@@ -285,10 +286,15 @@ namespace Realm {
                          int _num_workers,
 			 const std::string& _name_prefix,
 			 int _numa_node, size_t _stack_size,
-			 CoreReservationSet& crs)
+			 CoreReservationSet& crs,
+			 BackgroundWorkManager *_bgwork /*= 0*/,
+			 long long _bgwork_timeslice /*= 0*/)
     : proc(_proc)
     , num_workers(_num_workers)
     , workers_running(false)
+    , numa_node(_numa_node)
+    , bgwork(_bgwork)
+    , bgwork_timeslice(_bgwork_timeslice)
   {
     // create per-worker core reservations
     CoreReservationParameters params;
@@ -312,6 +318,7 @@ namespace Realm {
       WorkerInfo& wi = worker_infos[i];
       wi.status.store(i ? WorkerInfo::WORKER_NOT_RUNNING :
 		          WorkerInfo::WORKER_MASTER);
+      wi.interrupt_flag.store(false);
       wi.pool = this;
       wi.thread_id = 0;
       wi.num_threads = 1;
@@ -377,10 +384,36 @@ namespace Realm {
     ThreadLocal::threadpool_workerinfo = wi;
     log_pool.debug() << "worker: " << Thread::self() << " " << (void *)(ThreadLocal::threadpool_workerinfo);
 
+    // if we're configured to lend idle workers to the background work
+    //  manager, set up our view of it here
+    BackgroundWorkManager::Worker bgworker;
+    bool lend_to_bgwork = ((bgwork != 0) && (bgwork_timeslice > 0));
+    if(lend_to_bgwork) {
+      bgworker.set_manager(bgwork);
+      bgworker.set_max_timeslice(bgwork_timeslice * 1000);
+      bgworker.set_numa_domain(numa_node);
+    }
+
     bool worker_shutdown = false;
     while(!worker_shutdown) {
       switch(wi->status.load_acquire()) {
       case WorkerInfo::WORKER_IDLE:
+	{
+	  if(lend_to_bgwork) {
+	    // clear the interrupt flag before re-checking our status so
+	    //  that a claim can't sneak in unnoticed - a claim that lands
+	    //  after the check interrupts the call below (or, at worst,
+	    //  waits out one timeslice)
+	    wi->interrupt_flag.store(false);
+	    if(wi->status.load_acquire() != WorkerInfo::WORKER_IDLE)
+	      break;
+	    if(!bgworker.do_work(bgwork_timeslice, &wi->interrupt_flag))
+	      std::this_thread::yield();
+	  } else
+	    std::this_thread::yield();
+          break;
+        }
+
       case WorkerInfo::WORKER_CLAIMED:
 	{
           std::this_thread::yield();
@@ -467,6 +500,8 @@ namespace Realm {
       int expval = WorkerInfo::WORKER_IDLE;
       if(worker_infos[i].status.compare_exchange(expval,
 						 WorkerInfo::WORKER_CLAIMED)) {
+	// pull the worker out of any lent-out background work promptly
+	worker_infos[i].interrupt_flag.store(true);
 	worker_ids.insert(i);
 	remaining -= 1;
 	if(remaining == 0)
@@ -23,6 +23,8 @@
 
 namespace Realm {
 
+  class BackgroundWorkManager;
+
   class LoopSchedule {
   public:
     // sets the number of workers and initializes the barrier for usage
@@ -67,11 +69,16 @@ namespace Realm {
 
   class ThreadPool {
   public:
+    // if '_bgwork' is non-null and '_bgwork_timeslice' is positive, idle
+    //  workers are lent to the background work manager until they are
+    //  claimed for the next work item
     ThreadPool(Processor _proc,
                int _num_workers,
 	       const std::string& _name_prefix,
 	       int _numa_node, size_t _stack_size,
-	       CoreReservationSet& crs);
+	       CoreReservationSet& crs,
+	       BackgroundWorkManager *_bgwork = 0,
+	       long long _bgwork_timeslice = 0);
     ~ThreadPool(void);
 
     // associates the calling thread as the master of the threadpool
@@ -107,6 +114,7 @@ namespace Realm {
 	WORKER_SHUTDOWN,
       };
       atomic<int> /*Status*/ status; // int allows CAS primitives
+      atomic<bool> interrupt_flag;  // used to stop lent-out idle workers
       ThreadPool *pool;
       int thread_id;  // in current team
       int num_threads; // in current team
@@ -143,6 +151,9 @@ namespace Realm {
     Processor proc;
     int num_workers;
     bool workers_running;
+    int numa_node;
+    BackgroundWorkManager *bgwork;
+    long long bgwork_timeslice;
     std::vector<CoreReservation *> core_rsrvs;
     std::vector<Thread *> worker_threads;
     std::vector<WorkerInfo> worker_infos;
@@ -15,8 +15,11 @@
 
 #include "prealm.h"
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <zlib.h>
 // Need this to know which version of Legion Prof we're using
@@ -32,10 +35,10 @@ static constexpr unsigned LEGION_PROF_VERSION =
 #endif
     ;
 // pr_fopen expects filename to be a std::string
-#define pr_fopen(filename, mode) gzopen(filename.c_str(), mode)
-#define pr_fwrite(f, data, num_bytes) gzwrite(f, data, num_bytes)
-#define pr_fflush(f, mode) gzflush(f, mode)
-#define pr_fclose(f) gzclose(f)
+#define pr_fopen(f, filename, mode) (f).open(filename, mode)
+#define pr_fwrite(f, data, num_bytes) (f).write(data, num_bytes)
+#define pr_fflush(f, mode) (f).flush(mode)
+#define pr_fclose(f) (f).close()
 
 namespace PRealm {
 
@@ -122,6 +125,114 @@ protected:
   bool held;
 };
 
+// Serialized records are staged through a bounded double buffer on their
+// way to the logfile: the recording threads (which already hold the
+// profiler lock while serializing) only append raw bytes to the active
+// buffer, while a background thread compresses and writes out the filled
+// one. That keeps gzip deflation and file I/O off the application's
+// critical path and caps the capture memory at two buffers regardless of
+// how long the run is. The bytes that reach the file are identical to
+// what the old direct gzwrite calls produced, so existing readers of the
+// format are unaffected.
+class CaptureRing {
+public:
+  static constexpr size_t BUFFER_CAPACITY = 16 << 20; // 16MB per buffer
+public:
+  CaptureRing(void)
+      : file(nullptr), active(0), pending(0), active_bytes(0), pending_bytes(0),
+        shutdown_flusher(false) {}
+  CaptureRing(const CaptureRing &rhs) = delete;
+  CaptureRing &operator=(const CaptureRing &rhs) = delete;
+
+  bool open(const std::string &filename, const char *mode) {
+    file = gzopen(filename.c_str(), mode);
+    if (file == nullptr)
+      return false;
+    buffers[0].resize(BUFFER_CAPACITY);
+    buffers[1].resize(BUFFER_CAPACITY);
+    flusher = std::thread([this]() { this->flush_loop(); });
+    return true;
+  }
+
+  void write(const void *data, size_t bytes) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if ((active_bytes + bytes) > buffers[active].size())
+      rotate(lock);
+    // records are small compared to the buffers, but grow the active
+    // buffer in the pathological case where one does not fit
+    if (buffers[active].size() < bytes)
+      buffers[active].resize(bytes);
+    memcpy(&buffers[active][active_bytes], data, bytes);
+    active_bytes += bytes;
+  }
+
+  void flush(int mode) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (active_bytes > 0)
+      rotate(lock);
+    // wait for the background thread to drain before flushing zlib state
+    while (pending_bytes > 0)
+      buffer_idle.wait(lock);
+    gzflush(file, mode);
+  }
+
+  void close(void) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (active_bytes > 0)
+        rotate(lock);
+      shutdown_flusher = true;
+      buffer_ready.notify_one();
+    }
+    flusher.join();
+    gzclose(file);
+    file = nullptr;
+  }
+
+private:
+  // hand the active buffer to the flusher; the caller holds the lock
+  void rotate(std::unique_lock<std::mutex> &lock) {
+    while (pending_bytes > 0)
+      buffer_idle.wait(lock);
+    pending = active;
+    pending_bytes = active_bytes;
+    active ^= 1;
+    active_bytes = 0;
+    buffer_ready.notify_one();
+  }
+
+  void flush_loop(void) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      while ((pending_bytes == 0) && !shutdown_flusher)
+        buffer_ready.wait(lock);
+      if (pending_bytes > 0) {
+        const unsigned index = pending;
+        const size_t bytes = pending_bytes;
+        // drop the lock while compressing so recording threads can keep
+        // appending to the other buffer
+        lock.unlock();
+        gzwrite(file, buffers[index].data(), bytes);
+        lock.lock();
+        pending_bytes = 0;
+        buffer_idle.notify_all();
+      } else // shutdown and nothing pending
+        break;
+    }
+  }
+
+private:
+  gzFile file;
+  std::vector<char> buffers[2];
+  unsigned active, pending;
+  size_t active_bytes, pending_bytes;
+  bool shutdown_flusher;
+  std::thread flusher;
+  std::mutex mutex;
+  std::condition_variable buffer_ready; // a filled buffer awaits the flusher
+  std::condition_variable buffer_idle;  // the flusher drained its buffer
+};
+
 class Profiler {
 public:
   struct WrapperArgs {
@@ -248,7 +359,7 @@ private:
   std::atomic<unsigned> total_outstanding_requests;
 #endif
 private:
-  gzFile f;
+  mutable CaptureRing f;
   Processor local_proc;
   Processor implicit_proc;
   std::string file_name;
@@ -1478,8 +1589,7 @@ void Profiler::initialize(void) {
   }
 
   // Create the logfile
-  f = pr_fopen(file_name, "wb");
-  if (!f) {
+  if (!pr_fopen(f, file_name, "wb")) {
     log_pr.error() << "PRealm is unable to open file " << file_name
                    << " for writing";
     exit(1);
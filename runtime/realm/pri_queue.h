@@ -18,6 +18,7 @@
 #ifndef REALM_PRI_QUEUE_H
 #define REALM_PRI_QUEUE_H
 
+#include <algorithm>
 #include <deque>
 #include <map>
 
@@ -52,6 +53,13 @@ namespace Realm {
     //  2) "unget" adds it to the front of the list (i.e. LIFO order)
     void put(T item, priority_t priority, bool add_to_back = true);
 
+    // changes the priority of an item that is already in the queue, moving
+    //  it to the back of the list at its new priority - returns false if the
+    //  item is not present (e.g. a getter already claimed it) - note that
+    //  this is a linear search of the queue, so it is intended for occasional
+    //  repricing (e.g. priority inheritance), not the common path
+    bool set_priority(T item, priority_t new_priority);
+
     // getting an item is always from the front of the list and can be filtered to
     //  ignore things that aren't above a specified priority
     // the priority of the retrieved item (if any) is returned in *item_priority
@@ -90,11 +90,81 @@ namespace Realm {
     lock.unlock();
   }
 
+  // changes the priority of an item that is already in the queue, moving
+  //  it to the back of the list at its new priority - returns false if the
+  //  item is not present (e.g. a getter already claimed it)
+  template <typename T, typename LT>
+  inline bool PriorityQueue<T, LT>::set_priority(T item, priority_t new_priority)
+  {
+    // clamp the priority to the "finite" range, same as put()
+    if(new_priority > PRI_MAX_FINITE)
+      new_priority = PRI_MAX_FINITE;
+    else if(new_priority < PRI_MIN_FINITE)
+      new_priority = PRI_MIN_FINITE;
+
+    // body is protected by lock
+    lock.lock();
+
+    // find the item - a linear scan over all the priority levels
+    bool found = false;
+    for(typename std::map<priority_t, std::deque<T> >::iterator it = queue.begin();
+	it != queue.end();
+	++it) {
+      typename std::deque<T>::iterator it2 = std::find(it->second.begin(),
+						       it->second.end(),
+						       item);
+      if(it2 == it->second.end())
+	continue;
+
+      // already at the right priority?  nothing to move then
+      if(-(it->first) == new_priority) {
+	lock.unlock();
+	return true;
+      }
+
+      // pull the item out of its current list, cleaning up if it was the
+      //  last one at that priority
+      it->second.erase(it2);
+      if(it->second.empty())
+	queue.erase(it);
+      highest_priority = (queue.empty() ?
+			    PRI_NEG_INF :
+			    -(queue.begin()->first));
+      found = true;
+      break;
+    }
+
+    if(!found) {
+      lock.unlock();
+      return false;
+    }
+
+    // reinsertion mirrors put() - if the item is now the highest priority,
+    //  offer it to subscribers, who may consume it directly
+    if(new_priority > highest_priority) {
+      priority_t orig_highest = highest_priority;
+      highest_priority = new_priority;
+      if(perform_notifications(item, new_priority)) {
+	// item was taken, so restore the priority of what's left and exit
+	highest_priority = orig_highest;
+	lock.unlock();
+	if(entries_in_queue)
+	  (*entries_in_queue) -= 1;
+	return true;
+      }
+    }
+
+    queue[-new_priority].push_back(item); // remember negation...
+
+    lock.unlock();
+    return true;
+  }
+
   // getting an item is always from the front of the list and can be filtered to
   //  ignore things that aren't above a specified priority
   // the priority of the retrieved item (if any) is returned in *item_priority
   template <typename T, typename LT>
-  inline T PriorityQueue<T, LT>::get(priority_t *item_priority, 
+  inline T PriorityQueue<T, LT>::get(priority_t *item_priority,
 				     priority_t higher_than /*= PRI_NEG_INF*/)
   {
     // body is protected by lock
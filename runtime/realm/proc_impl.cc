@@ -498,6 +498,9 @@ namespace Realm {
       
       impl = free_local_events.alloc_entry();
       assert(impl != nullptr);
+      // top up the free list in the background before it runs dry
+      if(free_local_events.needs_prefill())
+        get_runtime()->event_prefiller.request_prefill(&free_local_events);
       // Remember the processor that allocated it
       impl->owning_processor = this;
       return impl;
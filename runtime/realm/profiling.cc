@@ -184,8 +184,12 @@ namespace Realm {
     if(pr.response_task_id == Processor::TASK_ID_PROCESSOR_NOP)
       return;
     
-    // for each request, find the intersection of the measurements it wants and the ones we have
-    std::set<ProfilingMeasurementID> ids;
+    // for each request, find the intersection of the measurements it wants
+    //  and the ones we have - both are sorted by ID, so the intersection
+    //  comes out in ID order, which the response format relies on for its
+    //  binary search
+    std::vector<std::pair<int, const ByteArray *> > found;
+    found.reserve(pr.requested_measurements.size());
 
     // at the very least, we need a count of measurements and the offset of the user data
     size_t bytes_needed = 2 * sizeof(int) + pr.user_data.size();
@@ -195,8 +199,8 @@ namespace Realm {
 	it2++) {
       std::map<ProfilingMeasurementID, ByteArray>::const_iterator it3 = measurements.find(*it2);
       if(it3 == measurements.end()) continue;
-      
-      ids.insert(*it2);
+
+      found.push_back(std::make_pair((int)(*it2), &(it3->second)));
       size_t msize = it3->second.size();
       // we'll pad each measurement to an 8 byte boundary
       size_t msize_padded = (msize + 7) & ~7ULL;
@@ -205,31 +209,35 @@ namespace Realm {
       bytes_needed += msize_padded;     // to store actual data
     }
 
-    int count = ids.size();
+    int count = found.size();
     // not everybody wants an empty report
     if((count == 0) && !pr.report_if_empty)
       return;
 
-    char *payload = (char *)malloc(bytes_needed);
+    // responses are usually small, so build them in place on the stack and
+    //  only take a heap allocation for the occasional large one - the spawn
+    //  below copies the args, so the buffer need only live until it returns
+    char stack_payload[512];
+    char *payload = ((bytes_needed <= sizeof(stack_payload)) ?
+                       stack_payload :
+                       (char *)malloc(bytes_needed));
     assert(payload != 0);
 
     int *header = (int *)payload;  // first bunch of stuff is a big int array
     char *data = payload + (2 + 2 * count) * sizeof(int);
 
     *header++ = count;
-    for(std::set<ProfilingMeasurementID>::const_iterator it2 = ids.begin();
-	it2 != ids.end();
+    for(std::vector<std::pair<int, const ByteArray *> >::const_iterator it2 =
+          found.begin();
+	it2 != found.end();
 	it2++) {
-      *header = (int)(*it2);
+      *header = it2->first;
       *(header + count) = data - payload; // offset of data start
       header++;
 
-      std::map<ProfilingMeasurementID, ByteArray>::const_iterator it3 = measurements.find(*it2);
-      assert(it3 != measurements.end());
-
-      size_t size = it3->second.size();
+      size_t size = it2->second->size();
       if(size > 0) {
-	memcpy(data, it3->second.base(), size);
+	memcpy(data, it2->second->base(), size);
 
 	size_t msize_padded = (size + 7) & ~7ULL;
 	data += msize_padded;
@@ -247,8 +255,9 @@ namespace Realm {
     
     pr.response_proc.spawn(pr.response_task_id, payload, bytes_needed,
 			   Event::NO_EVENT, pr.priority);
-      
-    free(payload);
+
+    if(payload != stack_payload)
+      free(payload);
   }
 
   void ProfilingMeasurementCollection::send_responses(const ProfilingRequestSet& prs)
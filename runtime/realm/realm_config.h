@@ -46,6 +46,24 @@
 #ifdef REALM_ON_LINUX
 //define REALM_USE_KERNEL_AIO
 #define REALM_USE_LIBAIO
+// if the io_uring headers are available, compile in an io_uring backend as
+//  well - it is preferred at runtime when the running kernel supports it,
+//  falling back to one of the options above otherwise
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define REALM_USE_IO_URING
+#endif
+#endif
+// if the perf_event headers are available, compile in a backend that feeds
+//  the hardware performance counter profiling measurements directly from
+//  the kernel's perf_event interface - no external library is needed, but
+//  only a subset of the PAPI-visible events can be counted, so PAPI is
+//  preferred when it is enabled
+#if !defined(REALM_USE_PAPI) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#define REALM_USE_PERF_EVENT
+#endif
+#endif
 #endif
 #if defined(REALM_ON_MACOS) || defined(REALM_ON_FREEBSD)
 #define REALM_USE_LIBAIO
@@ -111,6 +129,11 @@ namespace Realm {
     //  specified limit
     extern int event_loop_detection_limit;
 
+    // if positive, trigger updates for events with more remote subscribers
+    //  than this radix are propagated along a spanning tree of the
+    //  subscriber nodes instead of point-to-point from the owner
+    extern int event_broadcast_radix;
+
     // if true, worker threads that might have used user-level thread switching
     //  fall back to kernel threading
     extern bool force_kernel_threads;
@@ -156,6 +156,19 @@ namespace Realm {
                              size_t count, const void *userdata)
       {
         const REDOP *redop = static_cast<const REDOP *>(userdata);
+        // fast path for densely-packed exclusive reductions: iterating over
+        //  typed arrays with unit stride lets the compiler vectorize the
+        //  (inlined) apply across elements, which the generic byte-strided
+        //  loop below defeats
+        if(EXCL && (lhs_stride == sizeof(typename REDOP::LHS)) &&
+           (rhs_stride == sizeof(typename REDOP::RHS))) {
+          typename REDOP::LHS *lhs = static_cast<typename REDOP::LHS *>(lhs_ptr);
+          const typename REDOP::RHS *rhs =
+              static_cast<const typename REDOP::RHS *>(rhs_ptr);
+          for(size_t i = 0; i < count; i++)
+            redop->template apply<EXCL>(lhs[i], rhs[i]);
+          return;
+        }
         for(size_t i = 0; i < count; i++) {
           redop->template apply<EXCL>(*static_cast<typename REDOP::LHS *>(lhs_ptr),
                                       *static_cast<const typename REDOP::RHS *>(rhs_ptr));
@@ -170,6 +183,16 @@ namespace Realm {
                             size_t count, const void *userdata)
       {
         const REDOP *redop = static_cast<const REDOP *>(userdata);
+        // same dense fast path as cpu_apply_wrapper above
+        if(EXCL && (rhs1_stride == sizeof(typename REDOP::RHS)) &&
+           (rhs2_stride == sizeof(typename REDOP::RHS))) {
+          typename REDOP::RHS *rhs1 = static_cast<typename REDOP::RHS *>(rhs1_ptr);
+          const typename REDOP::RHS *rhs2 =
+              static_cast<const typename REDOP::RHS *>(rhs2_ptr);
+          for(size_t i = 0; i < count; i++)
+            redop->template fold<EXCL>(rhs1[i], rhs2[i]);
+          return;
+        }
         for(size_t i = 0; i < count; i++) {
           redop->template fold<EXCL>(*static_cast<typename REDOP::RHS *>(rhs1_ptr),
                                      *static_cast<const typename REDOP::RHS *>(rhs2_ptr));
@@ -53,6 +53,17 @@ namespace Realm {
       // releases a held reservation - release can be deferred until an event triggers
       void release(Event wait_on = Event::NO_EVENT) const;
 
+      // acquires a sequence of reservations in the order given - the i'th
+      //  acquisition is not attempted until the (i-1)'th has been granted, so
+      //  callers that agree on an ordering (e.g. sorted by ID) avoid deadlock
+      // the returned event triggers once all the reservations are held - if
+      //  every acquisition is granted immediately, no event is created at all
+      //  and Event::NO_EVENT is returned
+      static Event acquire_ordered(const std::vector<Reservation>& rsrvs,
+				   const std::vector<unsigned>& modes,
+				   const std::vector<bool>& exclusive,
+				   Event wait_on = Event::NO_EVENT);
+
       // Create a new reservation, destroy an existing reservation 
       static Reservation create_reservation();
 
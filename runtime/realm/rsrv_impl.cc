@@ -69,6 +69,75 @@ namespace Realm {
       Event after_lock;
     };
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class DeferredOrderedLockRequest
+  //
+
+    // handles the continuation of a Reservation::acquire_ordered call - each
+    //  time we're woken up (by the precondition or by the grant of an
+    //  intermediate reservation) we acquire as many of the remaining
+    //  reservations as we can before having to re-arm ourselves
+    class DeferredOrderedLockRequest : public EventWaiter {
+    public:
+      DeferredOrderedLockRequest(const std::vector<Reservation>& _locks,
+				 const std::vector<unsigned>& _modes,
+				 const std::vector<bool>& _exclusive,
+				 size_t _next, Event _after_lock)
+	: locks(_locks), modes(_modes), exclusive(_exclusive)
+	, next(_next), after_lock(_after_lock) {}
+
+      virtual ~DeferredOrderedLockRequest(void) { }
+
+      virtual void event_triggered(bool poisoned, TimeLimit work_until)
+      {
+	// if input event is poisoned, do not attempt to take any of the locks -
+	//  simply poison the output event too
+	if(poisoned) {
+	  log_poison.info() << "poisoned deferred ordered lock skipped - after=" << after_lock;
+	  GenEventImpl::trigger(after_lock, true /*poisoned*/, work_until);
+	  delete this;
+	  return;
+	}
+	while(next < locks.size()) {
+	  ReservationImpl *impl = get_runtime()->get_lock_impl(locks[next]);
+	  if(next == (locks.size() - 1)) {
+	    // the last acquisition triggers (or enqueues) 'after_lock' itself
+	    impl->acquire(modes[next], exclusive[next],
+			  ReservationImpl::ACQUIRE_BLOCKING, after_lock);
+	    break;
+	  }
+	  Event e = impl->acquire(modes[next], exclusive[next],
+				  ReservationImpl::ACQUIRE_BLOCKING);
+	  next++;
+	  if(e.exists()) {
+	    // blocked - wait for the grant and then resume where we left off
+	    EventImpl::add_waiter(e, this);
+	    return;
+	  }
+	}
+	// not attached to anything, so delete ourselves when we're done
+	delete this;
+      }
+
+      virtual void print(std::ostream& os) const
+      {
+	os << "deferred ordered lock: next=" << ((next < locks.size()) ? locks[next] : Reservation::NO_RESERVATION) << " after=" << after_lock;
+      }
+
+      virtual Event get_finish_event(void) const
+      {
+	return Event::NO_EVENT;
+      }
+
+    protected:
+      std::vector<Reservation> locks;
+      std::vector<unsigned> modes;
+      std::vector<bool> exclusive;
+      size_t next;
+      Event after_lock;
+    };
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class DeferredUnlockRequest
@@ -235,6 +304,59 @@ namespace Realm {
       }
     }
 
+    // acquires a sequence of reservations in the order given
+    /*static*/ Event Reservation::acquire_ordered(const std::vector<Reservation>& rsrvs,
+						  const std::vector<unsigned>& modes,
+						  const std::vector<bool>& exclusive,
+						  Event wait_on /* = Event::NO_EVENT */)
+    {
+      assert((rsrvs.size() == modes.size()) && (rsrvs.size() == exclusive.size()));
+      if(rsrvs.empty())
+	return wait_on;
+
+      // early out - if the event has obviously triggered (or is NO_EVENT)
+      //  don't build up continuation
+      bool poisoned = false;
+      if(wait_on.has_triggered_faultaware(poisoned)) {
+	if(poisoned) {
+	  log_reservation.info() << "reservation acquire_ordered: poisoned=" << wait_on;
+	  return wait_on;
+	}
+	// acquire as many as we can right now - in the common (uncontended)
+	//  case we get them all without creating any events
+	size_t idx = 0;
+	while(idx < rsrvs.size()) {
+	  ReservationImpl *impl = get_runtime()->get_lock_impl(rsrvs[idx]);
+	  Event e = impl->acquire(modes[idx], exclusive[idx],
+				  ReservationImpl::ACQUIRE_BLOCKING);
+	  idx++;
+	  if(e.exists()) {
+	    // blocked - if that was the last one, its grant event is our
+	    //  finish event, otherwise defer the rest on the grant
+	    if(idx == rsrvs.size()) {
+	      log_reservation.info() << "reservation acquire_ordered: count=" << rsrvs.size() << " finish=" << e;
+	      return e;
+	    }
+	    Event after_lock = GenEventImpl::create_genevent()->current_event();
+	    log_reservation.info() << "reservation acquire_ordered: count=" << rsrvs.size()
+				   << " blocked=" << rsrvs[idx - 1] << " finish=" << after_lock;
+	    EventImpl::add_waiter(e, new DeferredOrderedLockRequest(rsrvs, modes, exclusive,
+								    idx, after_lock));
+	    return after_lock;
+	  }
+	}
+	log_reservation.info() << "reservation acquire_ordered: count=" << rsrvs.size() << " finish=" << Event::NO_EVENT;
+	return Event::NO_EVENT;
+      } else {
+	Event after_lock = GenEventImpl::create_genevent()->current_event();
+	log_reservation.info() << "reservation acquire_ordered: count=" << rsrvs.size()
+			       << " finish=" << after_lock << " wait_on=" << wait_on;
+	EventImpl::add_waiter(wait_on, new DeferredOrderedLockRequest(rsrvs, modes, exclusive,
+								      0, after_lock));
+	return after_lock;
+      }
+    }
+
     // Create a new lock, destroy an existing lock
     /*static*/ Reservation Reservation::create_reservation()
     {
@@ -875,6 +875,9 @@ namespace Realm {
     // The default of path_cache_size is 0, when it is set to non-zero, the caching is enabled.
     cp.add_option_int("-ll:path_cache_size", Config::path_cache_lru_size);
 
+    // as above, address program caching is enabled by setting a non-zero size
+    cp.add_option_int("-ll:addrprog_cache_size", Config::address_program_cache_size);
+
     bool cmdline_ok = cp.parse_command_line(cmdline);
 
     if(!cmdline_ok) {
@@ -1039,6 +1042,54 @@ namespace Realm {
   }
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class EventFreeListPrefiller
+  //
+
+  EventFreeListPrefiller::EventFreeListPrefiller()
+    : BackgroundWorkItem("event free list prefiller")
+  {}
+
+  void EventFreeListPrefiller::request_prefill(
+      LocalEventTableAllocator::FreeList *free_list)
+  {
+    bool activate = false;
+    {
+      AutoLock<> al(mutex);
+      // ignore requests for lists that are already waiting to be filled
+      for(LocalEventTableAllocator::FreeList *pending : pending_lists)
+        if(pending == free_list)
+          return;
+      activate = pending_lists.empty();
+      pending_lists.push_back(free_list);
+    }
+    if(activate)
+      make_active();
+  }
+
+  bool EventFreeListPrefiller::do_work(TimeLimit work_until)
+  {
+    while(true) {
+      LocalEventTableAllocator::FreeList *free_list;
+      {
+        AutoLock<> al(mutex);
+        if(pending_lists.empty())
+          return false;
+        free_list = pending_lists.back();
+        pending_lists.pop_back();
+      }
+      // the list may have been topped up by frees since it was enqueued
+      if(free_list->needs_prefill())
+        free_list->prefill_next_window();
+      if(work_until.is_expired()) {
+        AutoLock<> al(mutex);
+        return !pending_lists.empty();
+      }
+    }
+  }
+
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class RuntimeImpl
@@ -1065,6 +1116,7 @@ namespace Realm {
     , shutdown_in_progress(false)
     , core_reservations(0)
     , message_manager(0)
+    , message_coalescer(0)
     , sampling_profiler(true /*system default*/)
     , num_local_memories(0)
     , num_local_ib_memories(0)
@@ -1742,12 +1794,22 @@ namespace Realm {
       {
         CommandLineParser cp;
         cp.add_option_int("-realm:eventloopcheck", Config::event_loop_detection_limit);
+        cp.add_option_int("-ll:event_radix", Config::event_broadcast_radix);
         cp.add_option_bool("-ll:force_kthreads", Config::force_kernel_threads);
         cp.add_option_bool("-ll:frsrv_fallback", Config::use_fast_reservation_fallback);
         cp.add_option_int("-ll:machine_query_cache", Config::use_machine_query_cache);
         cp.add_option_int("-ll:defalloc", Config::deferred_instance_allocation);
         cp.add_option_int("-ll:amprofile", Config::profile_activemsg_handlers);
         cp.add_option_int("-ll:aminline", Config::max_inline_message_time);
+        cp.add_option_int("-ll:amcoalesce", Config::am_coalescing_budget);
+        cp.add_option_int("-ll:amcoalesce_bytes", Config::am_coalescing_max_bytes);
+        cp.add_option_bool("-ll:lockfree_taskqueue",
+                           Config::use_lockfree_task_queues);
+        cp.add_option_bool("-ll:nonblocking_leaves", Config::nonblocking_leaf_tasks);
+        cp.add_option_int("-ll:spin", Config::worker_spin_timeout);
+        cp.add_option_int("-ll:lookahead", Config::task_variant_lookahead);
+        cp.add_option_bool("-ll:hugepages", Config::use_hugepage_memory);
+        cp.add_option_bool("-ll:prefault", Config::prefault_memory);
         bool cmdline_ok = cp.parse_command_line(cmdline);
         if(!cmdline_ok) {
           fprintf(stderr, "ERROR: failure parsing command line options for Config\n");
@@ -1828,6 +1890,7 @@ namespace Realm {
 #endif
 
       event_triggerer.add_to_manager(&bgwork);
+      event_prefiller.add_to_manager(&bgwork);
 
       // initialize barrier timestamp
       BarrierImpl::barrier_adjustment_timestamp.store((((Barrier::timestamp_t)(Network::my_node_id)) << BarrierImpl::BARRIER_TIMESTAMP_NODEID_SHIFT) + 1);
@@ -1915,6 +1978,10 @@ namespace Realm {
       else
 	assert(config->active_msg_handler_threads > 0);
 
+      // small outbound messages can optionally be coalesced per target
+      message_coalescer = new ActiveMessageCoalescer(Network::max_node_id + 1);
+      message_coalescer->add_to_manager(&bgwork);
+
         // Coordinate a job identifer across all the nodes in order to use it for
         // generating names in the system namespace (like files or sockets).  This needs
         // to come before the modules make their memories, but after the network is
@@ -1967,6 +2034,10 @@ namespace Realm {
       Network::barrier();
     }
 
+    // the network is up now, so collated log shipping (if configured)
+    //  can start sending batches to the aggregator
+    Logger::start_log_shipping();
+
 #ifdef DEADLOCK_TRACE
       next_thread = 0;
       signaled_threads = 0;
@@ -2792,6 +2863,10 @@ namespace Realm {
           (*it)->shutdown();
       }
 
+      // push out any still-buffered log batches while the network is
+      //  still usable - later messages fall back to local stderr
+      Logger::stop_log_shipping();
+
       // threads that cause inter-node communication have to stop first
       PartitioningOpQueue::stop_worker_threads();
 
@@ -2817,10 +2892,13 @@ namespace Realm {
 
 #ifdef DEBUG_REALM
       event_triggerer.shutdown_work_item();
+      event_prefiller.shutdown_work_item();
 #endif
       bgwork.stop_dedicated_workers();
 
       // tear down the active message manager
+      delete message_coalescer;
+      message_coalescer = 0;
       message_manager->shutdown();
       delete message_manager;
 
@@ -2874,6 +2952,7 @@ namespace Realm {
         Network::single_network = 0;
 
         delete[] nodes;
+        cleanup_thread_event_free_lists();
         delete local_event_free_list;
         delete local_barrier_free_list;
         delete local_reservation_free_list;
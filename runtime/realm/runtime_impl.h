@@ -77,6 +77,26 @@ namespace Realm {
   typedef DynamicTableAllocator<CompQueueImpl, 10, 4> CompQueueTableAllocator;
   typedef DynamicTableAllocator<SubgraphImpl, 10, 4> SubgraphTableAllocator;
 
+  // constructing a fresh window of event table entries is expensive (a leaf
+  //  holds tens of thousands of GenEventImpls), so this widget lets the
+  //  event allocation paths hand that work to a background worker shortly
+  //  before their free lists run dry instead of stalling an allocation on it
+  class EventFreeListPrefiller : public BackgroundWorkItem {
+  public:
+    EventFreeListPrefiller();
+
+    // notes that 'free_list' is running low on entries and should have its
+    //  next window constructed by a background worker - duplicate requests
+    //  for a list that is already queued are ignored
+    void request_prefill(LocalEventTableAllocator::FreeList *free_list);
+
+    virtual bool do_work(TimeLimit work_until);
+
+  protected:
+    Mutex mutex;
+    std::vector<LocalEventTableAllocator::FreeList *> pending_lists;
+  };
+
   // for each of the ID-based runtime objects, we're going to have an
   //  implementation class and a table to look them up in
   struct Node {
@@ -373,7 +393,9 @@ namespace Realm {
       CoreReservationSet *core_reservations;
       BackgroundWorkManager bgwork;
       IncomingMessageManager *message_manager;
+      ActiveMessageCoalescer *message_coalescer;
       EventTriggerNotifier event_triggerer;
+      EventFreeListPrefiller event_prefiller;
 
       OperationTable optable;
 
@@ -29,6 +29,28 @@ namespace Realm {
   Logger log_task("task");
   Logger log_sched("sched");
 
+  namespace Config {
+    // if true, task queues route ready tasks with small non-negative
+    //  priorities through bounded lock-free rings (one per priority band),
+    //  avoiding the queue mutex on the enqueue/dequeue fast paths
+    bool use_lockfree_task_queues = false;
+
+    // if true, application tasks are declared to be non-blocking leaves
+    //  and run with the scheduler lock engaged, eliding the suspend/resume
+    //  stack-switching machinery - a task that blocks anyway falls back to
+    //  spinning until it is marked ready again
+    bool nonblocking_leaf_tasks = false;
+
+    // how long (in ns) an idle scheduler worker spins on its doorbell
+    //  before going to sleep in the kernel - see tasks.h
+    long long worker_spin_timeout = -2;
+
+    // how many entries of a ready queue's front priority tier a worker
+    //  may scan for another task with the same function id as the one it
+    //  just ran - see tasks.h
+    int task_variant_lookahead = 0;
+  };
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class Task
@@ -438,6 +460,72 @@ namespace Realm {
   }
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class TaskQueue::LockFreeBand
+  //
+
+  TaskQueue::LockFreeBand::LockFreeBand(void)
+    : push_pos(0), pop_pos(0)
+  {
+    for(size_t i = 0; i < RING_SIZE; i++) {
+      slots[i].sequence.store(i);
+      slots[i].task = nullptr;
+    }
+  }
+
+  bool TaskQueue::LockFreeBand::try_push(Task *task)
+  {
+    uint64_t pos = push_pos.load();
+    while(true) {
+      Slot& slot = slots[pos & (RING_SIZE - 1)];
+      uint64_t seq = slot.sequence.load_acquire();
+      intptr_t diff = intptr_t(seq) - intptr_t(pos);
+      if(diff == 0) {
+        // slot is free - try to claim it
+        if(push_pos.compare_exchange_weak(pos, pos + 1)) {
+          slot.task = task;
+          slot.sequence.store_release(pos + 1);
+          return true;
+        }
+        // 'pos' was reloaded by the failed compare exchange - just retry
+      } else if(diff < 0) {
+        // ring is currently full
+        return false;
+      } else {
+        // somebody else claimed the slot before us - reload and retry
+        pos = push_pos.load();
+      }
+    }
+  }
+
+  Task *TaskQueue::LockFreeBand::try_pop(void)
+  {
+    uint64_t pos = pop_pos.load();
+    while(true) {
+      Slot& slot = slots[pos & (RING_SIZE - 1)];
+      uint64_t seq = slot.sequence.load_acquire();
+      intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+      if(diff == 0) {
+        // slot holds a task - try to claim it
+        if(pop_pos.compare_exchange_weak(pos, pos + 1)) {
+          Task *task = slot.task;
+          slot.task = nullptr;
+          // mark the slot free for the pusher that comes around next lap
+          slot.sequence.store_release(pos + RING_SIZE);
+          return task;
+        }
+        // 'pos' was reloaded by the failed compare exchange - just retry
+      } else if(diff < 0) {
+        // ring is currently empty
+        return nullptr;
+      } else {
+        // somebody else claimed the slot before us - reload and retry
+        pos = pop_pos.load();
+      }
+    }
+  }
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class TaskQueue
@@ -481,10 +569,19 @@ namespace Realm {
     task_count_gauge = 0;
   }
 
+  namespace {
+    // predicate for same-variant lookahead in get_best_task below
+    struct FuncIDMatches {
+      Processor::TaskFuncID func_id;
+      bool operator()(const Task *task) const { return task->func_id == func_id; }
+    };
+  };
+
   // gets highest priority task available from any task queue
   /*static*/ Task *
   TaskQueue::get_best_task(const std::vector<TaskQueue *> &queues,
-                           int &task_priority) {
+                           int &task_priority,
+                           Processor::TaskFuncID preferred_func /*= 0*/) {
     // remember where a task has come from in case we want to put it back
     Task *task = nullptr;
     TaskQueue *task_source = nullptr;
@@ -507,11 +604,52 @@ namespace Realm {
         continue;
       }
 
+      // lock-free fast path: each band holds tasks of exactly one priority,
+      //  so only look at bands that would beat what we're already holding
+      if (Config::use_lockfree_task_queues) {
+        int band_floor = (task_priority >= 0) ? (task_priority + 1) : 0;
+        for (int band = NUM_PRIORITY_BANDS - 1; band >= band_floor; band--) {
+          Task *band_task = task_queue->bands[band].try_pop();
+          if (band_task == nullptr)
+            continue;
+          task_queue->task_count.fetch_sub(1);
+          if (task_queue->task_count_gauge)
+            *(task_queue->task_count_gauge) -= 1;
+
+          // if we got something better, put back the old thing (if any)
+          if (task != nullptr) {
+            assert(task->priority < band_task->priority);
+            task_source->enqueue_ready_task(task, true /*front*/);
+          }
+
+          task = band_task;
+          task_source = task_queue;
+          task_priority = task->priority;
+          break;
+        }
+
+        // the mutex-guarded list may still have something better (e.g. an
+        //  out-of-band priority), so fall through and check it too
+        if (task_queue->task_count.load() == 0) {
+          continue;
+        }
+      }
+
       {
         // Got our ticket, lets try to pop off
         AutoLock<FIFOMutex> al(task_queue->mutex);
+        // If we've been given a variant preference, look a bounded distance
+        //  into the front priority tier for a matching task first - this
+        //  reorders only within a priority level, so it can't starve
+        //  higher-priority work
+        if((preferred_func != 0) && (Config::task_variant_lookahead > 0)) {
+          FuncIDMatches pred{preferred_func};
+          new_task = task_queue->ready_task_list.pop_front_if(
+              task_priority + 1, pred, Config::task_variant_lookahead);
+        }
         // Pop off a higher priority task, if there is one
-        new_task = task_queue->ready_task_list.pop_front(task_priority + 1);
+        if(new_task == nullptr)
+          new_task = task_queue->ready_task_list.pop_front(task_priority + 1);
         if (new_task != nullptr) {
           // Update the top priority and the task count
           Task *next = task_queue->ready_task_list.front();
@@ -554,6 +692,29 @@ namespace Realm {
     }
   }
   void TaskQueue::enqueue_ready_task(Task *task, bool front /* = false */) {
+    // lock-free fast path: tasks with small non-negative priorities go into
+    //  the matching band ring, unless we've been asked to re-push at the
+    //  front (the mutex-guarded list preserves exact ordering for that case)
+    //  or the ring is full
+    if(Config::use_lockfree_task_queues && !front &&
+       (task->priority >= 0) &&
+       (task->priority < priority_t(NUM_PRIORITY_BANDS)) &&
+       bands[task->priority].try_push(task)) {
+      priority_t notify_priority = task->priority;
+      top_priority.fetch_max(notify_priority);
+      task_count.fetch_add(1);
+
+      if(task_count_gauge)
+        *task_count_gauge += 1;
+
+      // we can't cheaply tell whether equal-priority work was already
+      //  visible, so always notify - the cost is a possible redundant wakeup
+      for(size_t i = 0; i < callbacks.size(); i++)
+        if(notify_priority >= callback_priorities[i])
+          callbacks[i]->item_available(notify_priority);
+      return;
+    }
+
     priority_t notify_priority = PRI_NEG_INF;
 
     {
@@ -717,6 +878,9 @@ namespace Realm {
     }
 
     Doorbell *db = Doorbell::get_thread_doorbell();
+    // apply any configured spin/sleep policy for idle workers
+    if(Config::worker_spin_timeout >= Doorbell::DOORBELL_SLEEP_NEVER)
+      db->set_sleep_timeout(Config::worker_spin_timeout);
     db->prepare();
     if(db_list.add_doorbell(db)) {
       db->wait();
@@ -1036,6 +1200,13 @@ namespace Realm {
       assert(it != worker_priorities.end());
       old_priority = it->second;
       it->second = new_priority;
+
+      // if the thread is suspended in the resumable queue, move it to its
+      //  new priority there as well - otherwise a boost (e.g. on behalf of
+      //  a higher-priority waiter it is blocking) would not take effect
+      //  until after the thread had already been rescheduled at its old
+      //  priority
+      resumable_workers.set_priority(thread, new_priority);
     }
 
     log_sched.debug() << "thread priority change: thread=" << (void *)thread << " old=" << old_priority << " new=" << new_priority;
@@ -1059,6 +1230,11 @@ namespace Realm {
 
       // we're a new, and initially unassigned, worker - counters have already been updated
 
+      // function id of the last task this worker ran - used (if lookahead
+      //  is enabled) to prefer another task of the same variant for
+      //  i-cache locality
+      Processor::TaskFuncID last_func_id = 0;
+
       while(true) {
 	// remember the work counter value before we start so that we don't iterate
 	//   unnecessarily
@@ -1123,7 +1299,8 @@ namespace Realm {
 
 	// try to get a new task then
 	int task_priority = resumable_priority;
-	Task *task = TaskQueue::get_best_task(task_queues, task_priority);
+	Task *task = TaskQueue::get_best_task(task_queues, task_priority,
+					      last_func_id);
 
 	// did we find work to do?
 	if(task) {
@@ -1157,12 +1334,27 @@ namespace Realm {
 	    task->add_reference();
 	  }
 
+	  // tasks declared as non-blocking leaves run with the scheduler
+	  //  lock engaged, the same way internal tasks do - the worker will
+	  //  not switch stacks while it holds the lock, and a task that
+	  //  blocks anyway spins in thread_blocking until it is ready again
+	  const bool nonblocking_leaf = Config::nonblocking_leaf_tasks;
+	  if(nonblocking_leaf)
+	    ThreadLocal::scheduler_lock++;
+
+	  // remember the variant before executing - the task may be deleted
+	  //  once it finishes
+	  last_func_id = task->func_id;
+
 #ifndef NDEBUG
 	  bool ok =
 #endif
 	    execute_task(task);
 	  assert(ok);  // no fault recovery yet
 
+	  if(nonblocking_leaf)
+	    ThreadLocal::scheduler_lock--;
+
 	  if(!context_managers.empty()) {
 	    // destroy contexts in reverse order
 	    for(size_t i = context_managers.size(); i > 0; i--)
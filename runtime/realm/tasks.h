@@ -33,6 +33,33 @@
 
 namespace Realm {
 
+    namespace Config {
+      // if true, task queues route ready tasks with small non-negative
+      //  priorities through bounded lock-free rings (one per priority band),
+      //  avoiding the queue mutex on the enqueue/dequeue fast paths
+      extern bool use_lockfree_task_queues;
+
+      // if true, application tasks are declared to be non-blocking leaves
+      //  and run with the scheduler lock engaged, eliding the suspend/resume
+      //  stack-switching machinery - a task that blocks anyway falls back to
+      //  spinning until it is marked ready again
+      extern bool nonblocking_leaf_tasks;
+
+      // how long (in ns) an idle scheduler worker spins on its doorbell
+      //  before going to sleep in the kernel - 0 sleeps immediately
+      //  (power-friendly), -1 never sleeps (latency-friendly), and the
+      //  default of -2 leaves the doorbell's built-in 10us window
+      extern long long worker_spin_timeout;
+
+      // if nonzero, a worker that just ran a task looks ahead up to this
+      //  many entries within the front priority tier of each ready queue
+      //  for another task of the same function id, improving i-cache
+      //  locality when many variants share a processor - reorders only
+      //  within a priority level, and only on the mutex-guarded queue
+      //  path (the lock-free rings are strictly FIFO)
+      extern int task_variant_lookahead;
+    };
+
     class ProcessorImpl;
   
     // information for a task launch
@@ -162,14 +189,48 @@ namespace Realm {
       void set_gauge(ProfilingGauges::AbsoluteRangeGauge<int> *new_gauge);
 
       void free_gauge();
-      // gets highest priority task available from any task queue in list
+      // gets highest priority task available from any task queue in list -
+      //  if 'preferred_func' is nonzero and Config::task_variant_lookahead
+      //  is set, a task with that function id may be taken ahead of its
+      //  equal-priority peers
       static Task *get_best_task(const std::vector<TaskQueue *> &queues,
-                                 int &task_priority);
+                                 int &task_priority,
+                                 Processor::TaskFuncID preferred_func = 0);
 
       void enqueue_task(Task *task);
       void enqueue_tasks(Task::TaskList &tasks, size_t num_tasks);
       bool empty() const { return task_count.load() == 0; }
+
+      // number of priorities eligible for the lock-free fast path - a task
+      //  with priority p in [0,NUM_PRIORITY_BANDS) goes into band p, so
+      //  ordering within a band is exact (the ring is FIFO) and ordering
+      //  across bands is handled by scanning bands from highest to lowest
+      static const unsigned NUM_PRIORITY_BANDS = 4;
+
       private:
+      // bounded lock-free MPMC ring holding tasks of a single priority -
+      //  uses the standard sequence-number scheme: each slot's sequence
+      //  value tells pushers and poppers whether the slot is theirs yet
+      class LockFreeBand {
+      public:
+        LockFreeBand(void);
+
+        // returns false if the ring is currently full
+        bool try_push(Task *task);
+        // returns null if the ring is currently empty
+        Task *try_pop(void);
+
+      protected:
+        static const size_t RING_SIZE = 1024; // must be a power of 2
+        struct Slot {
+          atomic<uint64_t> sequence;
+          Task *task;
+        };
+        Slot slots[RING_SIZE];
+        atomic<uint64_t> push_pos, pop_pos;
+      };
+      LockFreeBand bands[NUM_PRIORITY_BANDS];
+
       void enqueue_ready_task(Task *task, bool front = false);
     };
 
@@ -118,6 +118,12 @@ inline void makecontext_wrap(ucontext_t *u, void (*fn)(), int args, ...) { makec
 #endif
 #endif
 
+#ifdef REALM_USE_PERF_EVENT
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
 #include <algorithm>
 
 #ifndef CHECK_LIBC
@@ -155,6 +161,13 @@ namespace Realm {
   };
 #endif
 
+#ifdef REALM_USE_PERF_EVENT
+  Logger log_perfctr("perfctr");
+  namespace PerfEvent {
+    bool perf_available = false;
+  };
+#endif
+
   namespace ThreadLocal {
     /*extern*/ thread_local Thread *current_thread = 0;
   };
@@ -1933,6 +1946,299 @@ namespace Realm {
 #endif
 
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class PerfEventCounters
+
+
+#ifdef REALM_USE_PERF_EVENT
+  // cache events are encoded as (cache_id) | (op_id << 8) | (result_id << 16)
+  static inline unsigned long long cache_event_config(unsigned cache_id,
+						      unsigned op_id,
+						      unsigned result_id)
+  {
+    return (cache_id | (op_id << 8) | (result_id << 16));
+  }
+
+  PerfEventCounters::PerfEventCounters(void)
+    : group_fd(-1)
+  {}
+
+  PerfEventCounters::~PerfEventCounters(void)
+  {
+    for(std::vector<int>::const_iterator it = event_fds.begin();
+	it != event_fds.end();
+	++it)
+      close(*it);
+  }
+
+  /*static*/ PerfEventCounters *PerfEventCounters::setup_counters(const ProfilingMeasurementCollection& pmc)
+  {
+    // if the initial probe failed, don't try to use perf_event at all
+    if(!PerfEvent::perf_available)
+      return 0;
+
+    // build the list of generic (type, config) pairs that cover the
+    //  requested measurements - anything the kernel or hardware can't
+    //  count is reported as -1 by record()
+    std::vector<std::pair<unsigned, unsigned long long> > desired_events;
+
+    if(pmc.wants_measurement<ProfilingMeasurements::IPCPerfCounters>()) {
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_INSTRUCTIONS));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_CPU_CYCLES));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_BRANCH_INSTRUCTIONS));
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::L1ICachePerfCounters>()) {
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_L1I,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_ACCESS)));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_L1I,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_MISS)));
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::L1DCachePerfCounters>()) {
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_L1D,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_ACCESS)));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_L1D,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_MISS)));
+    }
+    // no generic L2 events - the last-level cache events are the closest
+    //  thing to the L3 measurement
+    if(pmc.wants_measurement<ProfilingMeasurements::L3CachePerfCounters>()) {
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_CACHE_REFERENCES));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_CACHE_MISSES));
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::TLBPerfCounters>()) {
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_ITLB,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_MISS)));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_DTLB,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_MISS)));
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::BranchPredictionPerfCounters>()) {
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_BRANCH_INSTRUCTIONS));
+      desired_events.push_back(std::make_pair((unsigned)PERF_TYPE_HARDWARE,
+					      (unsigned long long)PERF_COUNT_HW_BRANCH_MISSES));
+    }
+
+    // exit early if none present
+    if(desired_events.empty()) return 0;
+
+    PerfEventCounters *ctrs = new PerfEventCounters;
+
+    for(std::vector<std::pair<unsigned, unsigned long long> >::const_iterator it = desired_events.begin();
+	it != desired_events.end();
+	++it) {
+      // event might already have been added?
+      unsigned long long key = (((unsigned long long)it->first << 32) | it->second);
+      if(ctrs->event_indexes.count(key) > 0)
+	continue;
+
+      ctrs->add_counter(it->first, it->second);
+    }
+
+    // if nothing could be counted, don't keep the object around
+    if(ctrs->event_fds.empty()) {
+      delete ctrs;
+      return 0;
+    }
+
+    return ctrs;
+  }
+
+  bool PerfEventCounters::add_counter(unsigned type, unsigned long long config)
+  {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    // the group leader starts disabled and the rest follow it via the
+    //  PERF_IOC_FLAG_GROUP ioctls below
+    attr.disabled = ((group_fd == -1) ? 1 : 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    int fd = syscall(__NR_perf_event_open, &attr,
+		     0 /*this thread*/, -1 /*any cpu*/, group_fd, 0);
+    if(fd < 0) {
+      // an event the hardware (or kernel) can't provide is tolerable -
+      //  record() will report -1 for it
+      log_perfctr.debug() << "event " << type << "/"
+			  << std::showbase << std::hex << config << std::dec
+			  << " not available (" << strerror(errno) << ") - skipping";
+      return false;
+    }
+
+    if(group_fd == -1)
+      group_fd = fd;
+    event_fds.push_back(fd);
+    event_indexes[((unsigned long long)type << 32) | config] = event_counts.size();
+    event_counts.push_back(0);
+    return true;
+  }
+
+  void PerfEventCounters::cleanup(void)
+  {
+    // TODO: try to reuse these things?
+    delete this;
+  }
+
+  void PerfEventCounters::start(void)
+  {
+    int ret = ioctl(group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    assert(ret == 0);
+    ret = ioctl(group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    assert(ret == 0);
+  }
+
+  void PerfEventCounters::stop(void)
+  {
+    int ret = ioctl(group_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    assert(ret == 0);
+    // accumulate into our own totals - the kernel counters are reset on
+    //  the next start()
+    for(size_t i = 0; i < event_fds.size(); i++) {
+      unsigned long long val = 0;
+      ssize_t amt = read(event_fds[i], &val, sizeof(val));
+      if(amt == (ssize_t)sizeof(val))
+	event_counts[i] += val;
+    }
+  }
+
+  void PerfEventCounters::resume(void)
+  {
+    // same as start for now
+    start();
+  }
+
+  void PerfEventCounters::suspend(void)
+  {
+    // same as stop for now
+    stop();
+  }
+
+  // little helper to get a counter if present, or -1 if not
+  static inline long long get_perf_counter_val(unsigned type, unsigned long long config,
+					       const std::map<unsigned long long, size_t>& event_indexes,
+					       const std::vector<long long>& event_counts,
+					       int& found_count)
+  {
+    std::map<unsigned long long, size_t>::const_iterator it =
+      event_indexes.find(((unsigned long long)type << 32) | config);
+    if(it != event_indexes.end()) {
+      found_count++;
+      return event_counts[it->second];
+    } else
+      return -1;
+  }
+
+  void PerfEventCounters::record(ProfilingMeasurementCollection& pmc)
+  {
+    if(pmc.wants_measurement<ProfilingMeasurements::IPCPerfCounters>()) {
+      ProfilingMeasurements::IPCPerfCounters ctrs;
+      int found_count = 0;
+      ctrs.total_insts  = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,
+					       event_indexes, event_counts, found_count);
+      ctrs.total_cycles = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,
+					       event_indexes, event_counts, found_count);
+      // no generic events for instruction type breakdowns
+      ctrs.fp_insts = -1;
+      ctrs.ld_insts = -1;
+      ctrs.st_insts = -1;
+      ctrs.br_insts = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+					   event_indexes, event_counts, found_count);
+      if(found_count > 0)
+	pmc.add_measurement(ctrs);
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::L1ICachePerfCounters>()) {
+      ProfilingMeasurements::L1ICachePerfCounters ctrs;
+      int found_count = 0;
+      ctrs.accesses = get_perf_counter_val(PERF_TYPE_HW_CACHE,
+					   cache_event_config(PERF_COUNT_HW_CACHE_L1I,
+							      PERF_COUNT_HW_CACHE_OP_READ,
+							      PERF_COUNT_HW_CACHE_RESULT_ACCESS),
+					   event_indexes, event_counts, found_count);
+      ctrs.misses   = get_perf_counter_val(PERF_TYPE_HW_CACHE,
+					   cache_event_config(PERF_COUNT_HW_CACHE_L1I,
+							      PERF_COUNT_HW_CACHE_OP_READ,
+							      PERF_COUNT_HW_CACHE_RESULT_MISS),
+					   event_indexes, event_counts, found_count);
+      if(found_count > 0)
+	pmc.add_measurement(ctrs);
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::L1DCachePerfCounters>()) {
+      ProfilingMeasurements::L1DCachePerfCounters ctrs;
+      int found_count = 0;
+      ctrs.accesses = get_perf_counter_val(PERF_TYPE_HW_CACHE,
+					   cache_event_config(PERF_COUNT_HW_CACHE_L1D,
+							      PERF_COUNT_HW_CACHE_OP_READ,
+							      PERF_COUNT_HW_CACHE_RESULT_ACCESS),
+					   event_indexes, event_counts, found_count);
+      ctrs.misses   = get_perf_counter_val(PERF_TYPE_HW_CACHE,
+					   cache_event_config(PERF_COUNT_HW_CACHE_L1D,
+							      PERF_COUNT_HW_CACHE_OP_READ,
+							      PERF_COUNT_HW_CACHE_RESULT_MISS),
+					   event_indexes, event_counts, found_count);
+      if(found_count > 0)
+	pmc.add_measurement(ctrs);
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::L3CachePerfCounters>()) {
+      ProfilingMeasurements::L3CachePerfCounters ctrs;
+      int found_count = 0;
+      ctrs.accesses = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES,
+					   event_indexes, event_counts, found_count);
+      ctrs.misses   = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,
+					   event_indexes, event_counts, found_count);
+      if(found_count > 0)
+	pmc.add_measurement(ctrs);
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::TLBPerfCounters>()) {
+      ProfilingMeasurements::TLBPerfCounters ctrs;
+      int found_count = 0;
+      ctrs.inst_misses = get_perf_counter_val(PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_ITLB,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_MISS),
+					      event_indexes, event_counts, found_count);
+      ctrs.data_misses = get_perf_counter_val(PERF_TYPE_HW_CACHE,
+					      cache_event_config(PERF_COUNT_HW_CACHE_DTLB,
+								 PERF_COUNT_HW_CACHE_OP_READ,
+								 PERF_COUNT_HW_CACHE_RESULT_MISS),
+					      event_indexes, event_counts, found_count);
+      if(found_count > 0)
+	pmc.add_measurement(ctrs);
+    }
+    if(pmc.wants_measurement<ProfilingMeasurements::BranchPredictionPerfCounters>()) {
+      ProfilingMeasurements::BranchPredictionPerfCounters ctrs;
+      int found_count = 0;
+      ctrs.total_branches = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+						 event_indexes, event_counts, found_count);
+      ctrs.taken_branches = -1;  // no generic event
+      ctrs.mispredictions = get_perf_counter_val(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,
+						 event_indexes, event_counts, found_count);
+      if(found_count > 0)
+	pmc.add_measurement(ctrs);
+    }
+  }
+#endif
+
+
   ////////////////////////////////////////////////////////////////////////
   //
   // initialize/cleanup
@@ -1968,6 +2274,31 @@ namespace Realm {
       }
 #endif
 
+#ifdef REALM_USE_PERF_EVENT
+      {
+	// probe whether the running kernel lets us count events on our own
+	//  thread - if not (e.g. perf_event_paranoid, seccomp), disable the
+	//  backend up front instead of failing on every task
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	int fd = syscall(__NR_perf_event_open, &attr,
+			 0 /*this thread*/, -1 /*any cpu*/, -1, 0);
+	if(fd >= 0) {
+	  close(fd);
+	  PerfEvent::perf_available = true;
+	  log_perfctr.debug() << "perf_event counters available";
+	} else {
+	  log_perfctr.info() << "perf_event counters not available: " << strerror(errno);
+	}
+      }
+#endif
+
       KernelThread::detect_static_tls_size();
 
       return true;
@@ -80,6 +80,9 @@ namespace Realm {
 #ifdef REALM_USE_PAPI
   class PAPICounters;
 #endif
+#ifdef REALM_USE_PERF_EVENT
+  class PerfEventCounters;
+#endif
 
   //template <class CONDTYPE> class ThreadWaker;
 
@@ -228,6 +231,9 @@ namespace Realm {
 
 #ifdef REALM_USE_PAPI
     PAPICounters *papi_counters;
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    PerfEventCounters *perf_counters;
 #endif
   };
 
@@ -406,6 +412,38 @@ namespace Realm {
   };
 #endif
 
+#ifdef REALM_USE_PERF_EVENT
+  // reads hardware performance counters via Linux's perf_event interface -
+  //  no external library is needed, but only the generic (architecture
+  //  independent) events are available
+  class PerfEventCounters {
+  protected:
+    PerfEventCounters(void);
+    ~PerfEventCounters(void);
+
+  public:
+    static PerfEventCounters *setup_counters(const ProfilingMeasurementCollection& pmc);
+    void cleanup(void);
+
+    void start(void);
+    void suspend(void);
+    void resume(void);
+    void stop(void);
+    void record(ProfilingMeasurementCollection& pmc);
+
+  protected:
+    // counters are opened as a single group so the kernel schedules (and we
+    //  enable/disable) all of them together
+    bool add_counter(unsigned type, unsigned long long config);
+
+    int group_fd;
+    std::vector<int> event_fds;
+    // keyed by ((type << 32) | config), value is index into event_counts
+    std::map<unsigned long long, size_t> event_indexes;
+    std::vector<long long> event_counts;
+  };
+#endif
+
   // move this somewhere else
 
   class DummyLock {
@@ -54,6 +54,12 @@ namespace Realm {
     , current_op(0)
     , exception_handler_count(0)
     , signal_count(0)
+#ifdef REALM_USE_PAPI
+    , papi_counters(0)
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    , perf_counters(0)
+#endif
   {
   }
 
@@ -199,6 +205,9 @@ namespace Realm {
 #ifdef REALM_USE_PAPI
     if(thread->papi_counters) thread->papi_counters->suspend();
 #endif
+#ifdef REALM_USE_PERF_EVENT
+    if(thread->perf_counters) thread->perf_counters->suspend();
+#endif
 
     // we're interacting with the scheduler, so check for signals first
     if(thread->signal_count.load() > 0)
@@ -230,6 +239,9 @@ namespace Realm {
     // finally, resume any performance counters
 #ifdef REALM_USE_PAPI
     if(thread->papi_counters) thread->papi_counters->resume();
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    if(thread->perf_counters) thread->perf_counters->resume();
 #endif
   }
 
@@ -259,6 +271,9 @@ namespace Realm {
   {
 #ifdef REALM_USE_PAPI
     papi_counters = PAPICounters::setup_counters(pmc);
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    perf_counters = PerfEventCounters::setup_counters(pmc);
 #endif
   }
 
@@ -266,6 +281,9 @@ namespace Realm {
   {
 #ifdef REALM_USE_PAPI
     if(papi_counters) papi_counters->start();
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    if(perf_counters) perf_counters->start();
 #endif
   }
 
@@ -273,6 +291,9 @@ namespace Realm {
   {
 #ifdef REALM_USE_PAPI
     if(papi_counters) papi_counters->stop();
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    if(perf_counters) perf_counters->stop();
 #endif
   }
 
@@ -284,6 +305,13 @@ namespace Realm {
       papi_counters->cleanup();
       papi_counters = 0; // cleanup call might delete, or save it for later
     }
+#endif
+#ifdef REALM_USE_PERF_EVENT
+    if(perf_counters) {
+      perf_counters->record(pmc);
+      perf_counters->cleanup();
+      perf_counters = 0; // cleanup call might delete, or save it for later
+    }
 #endif
   }
 
@@ -2327,6 +2327,46 @@ namespace Realm {
                 out_alc.advance(out_dim-1,
                                 elems * ((out_dim == 1) ? out_elem_size : 1));
 
+                // fused scatter/gather fast path: a fine-grained indirection
+                //  (e.g. per-particle scatter-add) produces a long run of
+                //  single-element entries - apply them in a tight loop rather
+                //  than redoing the address analysis for each one
+                if((elems == 1) && (in_dim == 1) && (out_dim == 1)) {
+                  while(elems < elems_left) {
+                    if((in_alc.get_dim() != 1) ||
+                       (in_alc.remaining(0) != in_elem_size) ||
+                       (out_alc.get_dim() != 1) ||
+                       (out_alc.remaining(0) != out_elem_size))
+                      break;
+                    void *optr = reinterpret_cast<void *>(out_base +
+                                                          out_alc.get_offset());
+                    const void *iptr = reinterpret_cast<const void *>(in_base +
+                                                          in_alc.get_offset());
+                    if(redop_info.is_fold) {
+                      if(redop_info.is_exclusive)
+                        (redop->cpu_fold_excl_fn)(optr, out_elem_size,
+                                                  iptr, in_elem_size,
+                                                  1, redop->userdata);
+                      else
+                        (redop->cpu_fold_nonexcl_fn)(optr, out_elem_size,
+                                                     iptr, in_elem_size,
+                                                     1, redop->userdata);
+                    } else {
+                      if(redop_info.is_exclusive)
+                        (redop->cpu_apply_excl_fn)(optr, out_elem_size,
+                                                   iptr, in_elem_size,
+                                                   1, redop->userdata);
+                      else
+                        (redop->cpu_apply_nonexcl_fn)(optr, out_elem_size,
+                                                      iptr, in_elem_size,
+                                                      1, redop->userdata);
+                    }
+                    in_alc.advance(0, in_elem_size);
+                    out_alc.advance(0, out_elem_size);
+                    elems++;
+                  }
+                }
+
 #ifdef DEBUG_REALM
 		assert(elems <= elems_left);
 #endif
@@ -4129,6 +4169,11 @@ namespace Realm {
               bw, latency, frag_overhead, XFER_MEM_CPY)
         .set_max_dim(3)
         .allow_redops();
+      // mapped shared-peer memories can also supply the source operands
+      add_path(remote_shared_mems, local_cpu_mems,
+              bw, latency, frag_overhead, XFER_MEM_CPY)
+        .set_max_dim(3)
+        .allow_redops();
     }
 
     xdq.add_to_manager(bgwork);
@@ -187,6 +187,30 @@ namespace Realm {
 	  break;
 	}
 
+	// yield mid-transfer if a strictly higher priority transfer is now
+	//  waiting on the queue - requeue this xd at the front of its own
+	//  priority tier so it resumes once the more urgent work is done
+	//  (ordered mode must process transfers in queue order, so no
+	//  preemption there)
+	if(!ordered_mode && !xd->transfer_completed.load_acquire()) {
+	  bool preempted = false;
+	  {
+	    AutoLock<> al(mutex);
+	    if(!ready_xds.empty(xd->priority + 1)) {
+	      ready_xds.push_front(xd);
+	      preempted = true;
+	    }
+	  }
+	  if(preempted) {
+	    log_new_dma.info() << "xd preempted: xd=" << xd
+			       << " id=" << std::hex << xd->guid << std::dec;
+	    // whoever enqueued the higher priority xd (or popped it and saw
+	    //  more work behind it) already requested a worker's attention,
+	    //  so no need to re-mark ourselves active here
+	    return false;
+	  }
+	}
+
 	// stop mid-transfer if we've run out of time
 	if(work_until.is_expired()) {
 	  //log_new_dma.print() << "time limit elapsed";
@@ -72,6 +72,65 @@ namespace Realm {
     }
   }
 
+  // layout-conversion copies (e.g. AOS<->SOA transforms) arrive here as huge
+  //  numbers of single-element "lines" - the per-line std::copy in the kernels
+  //  above pays loop setup for every element, so we treat those cases as
+  //  strided element gather/scatter loops instead (unrolled so the loads and
+  //  stores overlap and the compiler's vectorizer can turn them into
+  //  shuffle/pack sequences when the strides cooperate)
+  template <typename T>
+  static void memcpy_2d_elems(uintptr_t dst_base, uintptr_t dst_lstride,
+                              uintptr_t src_base, uintptr_t src_lstride, size_t lines)
+  {
+    size_t i = 0;
+    for(; i + 4 <= lines; i += 4) {
+      T e0 = *reinterpret_cast<const T *>(src_base);
+      T e1 = *reinterpret_cast<const T *>(src_base + src_lstride);
+      T e2 = *reinterpret_cast<const T *>(src_base + 2 * src_lstride);
+      T e3 = *reinterpret_cast<const T *>(src_base + 3 * src_lstride);
+      *reinterpret_cast<T *>(dst_base) = e0;
+      *reinterpret_cast<T *>(dst_base + dst_lstride) = e1;
+      *reinterpret_cast<T *>(dst_base + 2 * dst_lstride) = e2;
+      *reinterpret_cast<T *>(dst_base + 3 * dst_lstride) = e3;
+      // manual strength reduction
+      src_base += 4 * src_lstride;
+      dst_base += 4 * dst_lstride;
+    }
+    for(; i < lines; i++) {
+      *reinterpret_cast<T *>(dst_base) = *reinterpret_cast<const T *>(src_base);
+      src_base += src_lstride;
+      dst_base += dst_lstride;
+    }
+  }
+
+  // a small-element 3d copy is really a strided 2d transpose over the
+  //  (line,plane) space - walk it in square-ish tiles so that whichever side
+  //  is non-contiguous still touches a bounded cache footprint per tile
+  //  (a 32x32 tile of 32B elements is 32KB on each side - within L1/L2 reach)
+  static const size_t TRANSPOSE_TILE_LINES = 32;
+  static const size_t TRANSPOSE_TILE_PLANES = 32;
+
+  template <typename T>
+  static void memcpy_3d_elems(uintptr_t dst_base, uintptr_t dst_lstride,
+                              uintptr_t dst_pstride, uintptr_t src_base,
+                              uintptr_t src_lstride, uintptr_t src_pstride, size_t lines,
+                              size_t planes)
+  {
+    for(size_t jj = 0; jj < planes; jj += TRANSPOSE_TILE_PLANES) {
+      const size_t jmax = std::min(planes - jj, TRANSPOSE_TILE_PLANES);
+      for(size_t ii = 0; ii < lines; ii += TRANSPOSE_TILE_LINES) {
+        const size_t imax = std::min(lines - ii, TRANSPOSE_TILE_LINES);
+        uintptr_t src_tile = src_base + (jj * src_pstride) + (ii * src_lstride);
+        uintptr_t dst_tile = dst_base + (jj * dst_pstride) + (ii * dst_lstride);
+        for(size_t j = 0; j < jmax; j++) {
+          memcpy_2d_elems<T>(dst_tile, dst_lstride, src_tile, src_lstride, imax);
+          src_tile += src_pstride;
+          dst_tile += dst_pstride;
+        }
+      }
+    }
+  }
+
   template <typename T>
   static void memset_1d_typed(uintptr_t dst_base, size_t bytes, T val)
   {
@@ -122,6 +181,13 @@ namespace Realm {
   REALM_ALIGNED_TYPE_CONST(aligned_16b_t, dummy_16b_t, 16);
   REALM_ALIGNED_TYPE_CONST(aligned_32b_t, dummy_32b_t, 32);
 
+  // the memcpy_*d entry points below are the dispatch layer that maps each
+  //  (shape, alignment) class onto a pre-instantiated typed kernel: dense
+  //  lines go through the std::copy kernels, small-element strided copies
+  //  through the gather/scatter and tiled-transpose kernels above. combined
+  //  with the dimension collapsing the address-list walkers do before
+  //  calling in, this covers the recurring layout pairs with specialized
+  //  code without generating kernels at runtime
   void memcpy_1d(uintptr_t dst_base, uintptr_t src_base, size_t bytes)
   {
     // by subtracting 1 from bases, strides, and lengths, we get LSBs set
@@ -160,6 +226,36 @@ namespace Realm {
                    << " bytes=" << bytes << " lines=" << lines
                    << " align=" << (alignment & 31);
 #endif
+    // single-element lines are the signature of a layout conversion
+    //  (e.g. AOS<->SOA) - use the strided element kernels for those
+    if(bytes <= 32) {
+      if((bytes == 32) && ((alignment & 31) == 31)) {
+        memcpy_2d_elems<aligned_32b_t>(dst_base, dst_lstride, src_base, src_lstride,
+                                       lines);
+        return;
+      }
+      if((bytes == 16) && ((alignment & 15) == 15)) {
+        memcpy_2d_elems<aligned_16b_t>(dst_base, dst_lstride, src_base, src_lstride,
+                                       lines);
+        return;
+      }
+      if((bytes == 8) && ((alignment & 7) == 7)) {
+        memcpy_2d_elems<uint64_t>(dst_base, dst_lstride, src_base, src_lstride, lines);
+        return;
+      }
+      if((bytes == 4) && ((alignment & 3) == 3)) {
+        memcpy_2d_elems<uint32_t>(dst_base, dst_lstride, src_base, src_lstride, lines);
+        return;
+      }
+      if((bytes == 2) && ((alignment & 1) == 1)) {
+        memcpy_2d_elems<uint16_t>(dst_base, dst_lstride, src_base, src_lstride, lines);
+        return;
+      }
+      if(bytes == 1) {
+        memcpy_2d_elems<uint8_t>(dst_base, dst_lstride, src_base, src_lstride, lines);
+        return;
+      }
+    }
     // TODO: consider jump table approach?
     if((alignment & 31) == 31)
       memcpy_2d_typed<aligned_32b_t>(dst_base, dst_lstride, src_base, src_lstride, bytes,
@@ -207,6 +303,40 @@ namespace Realm {
       std::swap(src_pstride, src_lstride);
       std::swap(planes, lines);
     }
+    // single-element lines mean this is a strided transpose over the
+    //  (line,plane) space - use the cache-blocked element kernels
+    if(bytes <= 32) {
+      if((bytes == 32) && ((alignment & 31) == 31)) {
+        memcpy_3d_elems<aligned_32b_t>(dst_base, dst_lstride, dst_pstride, src_base,
+                                       src_lstride, src_pstride, lines, planes);
+        return;
+      }
+      if((bytes == 16) && ((alignment & 15) == 15)) {
+        memcpy_3d_elems<aligned_16b_t>(dst_base, dst_lstride, dst_pstride, src_base,
+                                       src_lstride, src_pstride, lines, planes);
+        return;
+      }
+      if((bytes == 8) && ((alignment & 7) == 7)) {
+        memcpy_3d_elems<uint64_t>(dst_base, dst_lstride, dst_pstride, src_base,
+                                  src_lstride, src_pstride, lines, planes);
+        return;
+      }
+      if((bytes == 4) && ((alignment & 3) == 3)) {
+        memcpy_3d_elems<uint32_t>(dst_base, dst_lstride, dst_pstride, src_base,
+                                  src_lstride, src_pstride, lines, planes);
+        return;
+      }
+      if((bytes == 2) && ((alignment & 1) == 1)) {
+        memcpy_3d_elems<uint16_t>(dst_base, dst_lstride, dst_pstride, src_base,
+                                  src_lstride, src_pstride, lines, planes);
+        return;
+      }
+      if(bytes == 1) {
+        memcpy_3d_elems<uint8_t>(dst_base, dst_lstride, dst_pstride, src_base,
+                                 src_lstride, src_pstride, lines, planes);
+        return;
+      }
+    }
     // TODO: consider jump table approach?
     if((alignment & 31) == 31)
       memcpy_3d_typed<aligned_32b_t>(dst_base, dst_lstride, dst_pstride, src_base,
@@ -259,9 +389,18 @@ namespace Realm {
       memset_1d_typed<uint8_t>(dst_base, bytes,
                                *reinterpret_cast<const uint8_t *>(fill_data));
     else {
-      // fallback based on memcpy
-      memcpy_2d(dst_base, fill_size, reinterpret_cast<uintptr_t>(fill_data), 0, fill_size,
-                bytes / fill_size);
+      // fallback: write the pattern once and then double it with
+      //  successively larger self-copies so nearly all of the bytes move
+      //  as large, bandwidth-friendly memcpys instead of one tiny copy
+      //  per element
+      size_t filled = std::min(fill_size, bytes);
+      memcpy(reinterpret_cast<void *>(dst_base), fill_data, filled);
+      while(filled < bytes) {
+        size_t chunk = std::min(filled, bytes - filled);
+        memcpy(reinterpret_cast<void *>(dst_base + filled),
+               reinterpret_cast<const void *>(dst_base), chunk);
+        filled += chunk;
+      }
     }
   }
 
@@ -297,9 +436,13 @@ namespace Realm {
       memset_2d_typed<uint8_t>(dst_base, dst_lstride, bytes, lines,
                                *reinterpret_cast<const uint8_t *>(fill_data));
     else {
-      // fallback based on memcpy
-      memcpy_3d(dst_base, fill_size, dst_lstride, reinterpret_cast<uintptr_t>(fill_data),
-                0, 0, fill_size, bytes / fill_size, lines);
+      // fallback: build the first line with the doubling strategy in
+      //  memset_1d and then replicate it to the other lines with one
+      //  large memcpy each
+      memset_1d(dst_base, bytes, fill_data, fill_size);
+      for(size_t l = 1; l < lines; l++)
+        memcpy(reinterpret_cast<void *>(dst_base + (l * dst_lstride)),
+               reinterpret_cast<const void *>(dst_base), bytes);
     }
   }
 
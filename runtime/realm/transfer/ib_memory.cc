@@ -48,6 +48,10 @@ namespace Realm {
                      MemoryKind _kind, Memory::Kind _lowlevel_kind,
                      void *prealloc_base, NetworkSegment *_segment)
     : MemoryImpl(_me, _size, _kind, _lowlevel_kind, _segment)
+    , free_list_bytes(0)
+    , usage(stringbuilder() << "realm/mem " << _me << "/usage")
+    , peak_usage(stringbuilder() << "realm/mem " << _me << "/peak_usage")
+    , peak_footprint(stringbuilder() << "realm/mem " << _me << "/peak_footprint")
     , base(static_cast<char *>(prealloc_base))
     , ibreq_head(0)
     , ibreq_tail(&ibreq_head)
@@ -57,6 +61,12 @@ namespace Realm {
 
   IBMemory::~IBMemory()
   {
+#ifdef REALM_PROFILE_MEMORY_USAGE
+    printf("IB Memory " IDFMT " usage: peak=%zd (%.1f MB) footprint=%zd (%.1f MB)\n",
+	   me.id,
+	   (size_t)peak_usage, peak_usage / 1048576.0,
+	   (size_t)peak_footprint, peak_footprint / 1048576.0);
+#endif
   }
 
   // old-style allocation used by IB memories
@@ -92,6 +102,34 @@ namespace Realm {
     //  the end of their allocations
     size += 0;
 
+    // check the free list for this size first - a hit means we can reuse
+    //  a block without touching the best-fit map at all
+    if(free_list_bytes > 0) {
+      std::map<size_t, std::vector<off_t> >::iterator it = free_lists.find(size);
+      if((it != free_lists.end()) && !it->second.empty()) {
+        off_t retval = it->second.back();
+        it->second.pop_back();
+        free_list_bytes -= size;
+        log_malloc.info("alloc pooled block: mem=" IDFMT " size=%zd ofs=%zd", me.id, size, (ssize_t)retval);
+        usage += size;
+        if(usage > peak_usage) peak_usage = usage;
+        // a pooled block was allocated before, so the footprint can't grow
+        return retval;
+      }
+    }
+
+    off_t offset = do_alloc_bestfit(size);
+    if((offset == -1) && (free_list_bytes > 0)) {
+      // under memory pressure give all the pooled blocks back to the
+      //  best-fit map so they can coalesce and try again
+      do_flush_free_lists();
+      offset = do_alloc_bestfit(size);
+    }
+    return offset;
+  }
+
+  off_t IBMemory::do_alloc_bestfit(size_t size)
+  {
     // try to minimize footprint by allocating at the highest address possible
     if(!free_blocks.empty()) {
       std::map<off_t, off_t>::iterator it = free_blocks.end();
@@ -103,12 +141,10 @@ namespace Realm {
           off_t retval = it->first;
           free_blocks.erase(it);
           log_malloc.info("alloc full block: mem=" IDFMT " size=%zd ofs=%zd", me.id, size, (ssize_t)retval);
-#if 0
           usage += size;
           if(usage > peak_usage) peak_usage = usage;
           size_t footprint = this->size - retval;
           if(footprint > peak_footprint) peak_footprint = footprint;
-#endif
           return retval;
         }
 
@@ -118,12 +154,10 @@ namespace Realm {
           off_t retval = it->first + leftover;
           it->second = leftover;
           log_malloc.info("alloc partial block: mem=" IDFMT " size=%zd ofs=%zd", me.id, size, (ssize_t)retval);
-#if 0
           usage += size;
           if(usage > peak_usage) peak_usage = usage;
           size_t footprint = this->size - retval;
           if(footprint > peak_footprint) peak_footprint = footprint;
-#endif
           return retval;
         }
       } while(it != free_blocks.begin());
@@ -305,11 +339,31 @@ namespace Realm {
       }
     }
 
-#if 0
     usage -= size;
     // only made things smaller, so can't impact the peak usage
-#endif
 
+    // stash the block on the free list for its size - since every
+    //  non-pooled allocation goes through do_alloc_bestfit with the same
+    //  padded size, a later do_alloc of this size can take it unchanged
+    free_lists[size].push_back(offset);
+    free_list_bytes += size;
+  }
+
+  void IBMemory::do_flush_free_lists()
+  {
+    for(std::map<size_t, std::vector<off_t> >::iterator it = free_lists.begin();
+        it != free_lists.end();
+        ++it)
+      for(std::vector<off_t>::iterator it2 = it->second.begin();
+          it2 != it->second.end();
+          ++it2)
+        do_free_bestfit(*it2, it->first);
+    free_lists.clear();
+    free_list_bytes = 0;
+  }
+
+  void IBMemory::do_free_bestfit(off_t offset, size_t size)
+  {
     if(free_blocks.size() > 0) {
       // find the first existing block that comes _after_ us
       std::map<off_t, off_t>::iterator after = free_blocks.lower_bound(offset);
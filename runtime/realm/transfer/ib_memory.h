@@ -67,11 +67,23 @@ namespace Realm {
     // these must be called with the mutex held
     off_t do_alloc(size_t size);
     void do_free(off_t offset, size_t size);
+    off_t do_alloc_bestfit(size_t size);
+    void do_free_bestfit(off_t offset, size_t size);
+    void do_flush_free_lists();
     PendingIBRequests *satisfy_pending_reqs();
     void forward_satisfied_reqs(PendingIBRequests *reqs);
 
     Mutex mutex; // protection for resizing vectors
     std::map<off_t, off_t> free_blocks;
+    // per-size free lists that cache recently freed blocks - dma paths
+    //  tend to recycle the same ib sizes over and over, so this keeps the
+    //  steady state as an O(1) push/pop instead of churning the best-fit
+    //  map with splits and merges on every transfer - blocks are flushed
+    //  back to the best-fit map (with coalescing) whenever a best-fit
+    //  allocation cannot be satisfied
+    std::map<size_t, std::vector<off_t> > free_lists;
+    size_t free_list_bytes;
+    ProfilingGauges::AbsoluteGauge<size_t> usage, peak_usage, peak_footprint;
     char *base;
     PendingIBRequests *ibreq_head;
     PendingIBRequests **ibreq_tail;
@@ -81,6 +81,11 @@ namespace Realm {
       // file instead of crashing again because we can't open the file
       fd = open((const char *)_file.c_str(), O_CREAT | O_RDWR, 00666);
       assert(fd != -1);
+#ifdef POSIX_FADV_SEQUENTIAL
+      // disk instances are accessed via the dma system in large mostly
+      //  sequential chunks, so ask for aggressive readahead where available
+      posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
       // resize the file to what we want
       int ret =	ftruncate(fd, _size);
 #ifdef NDEBUG
@@ -297,6 +302,13 @@ namespace Realm {
             abort();
           }
 
+#ifdef POSIX_FADV_SEQUENTIAL
+          // attached file instances are typically streamed through in large
+          //  sequential chunks (e.g. checkpoint save/restore), so ask for
+          //  aggressive readahead where available
+          posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
           OpenFileInfo *info = new OpenFileInfo;
           info->fd = fd;
           info->offset = res->offset;
@@ -35,6 +35,12 @@
 #ifdef REALM_USE_LIBAIO
 #include <aio.h>
 #endif
+#ifdef REALM_USE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#endif
 
 #include <queue>
 #include <algorithm>
@@ -176,6 +182,237 @@ namespace Realm {
     }
 #endif
 
+#ifdef REALM_USE_IO_URING
+    inline int io_uring_setup(unsigned entries, struct io_uring_params *p)
+    {
+      return syscall(__NR_io_uring_setup, entries, p);
+    }
+
+    inline int io_uring_enter(int ring_fd, unsigned to_submit,
+			      unsigned min_complete, unsigned flags)
+    {
+      return syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete,
+		     flags, (sigset_t *)0, 0);
+    }
+
+    // a thin wrapper around a Linux io_uring instance - submissions are
+    //  serialized by the caller (under AsyncFileIOContext's mutex or by
+    //  the background worker), as is completion reaping
+    class IOUringContext {
+    public:
+      // returns null if the running kernel does not support io_uring
+      static IOUringContext *create(unsigned entries);
+      ~IOUringContext(void);
+
+      void submit(uint8_t opcode, int fd, const struct iovec *iov,
+		  off_t file_offset, void *user_data);
+
+      // marks the AIOOperation associated with each available completion
+      //  as completed
+      void reap_completions(void);
+
+    protected:
+      IOUringContext(int _ring_fd, const struct io_uring_params& params);
+
+      int ring_fd;
+      struct io_uring_sqe *sqes;
+      struct io_uring_cqe *cqes;
+      unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+      unsigned *cq_head, *cq_tail, *cq_mask;
+      void *sq_ring_base, *cq_ring_base;
+      size_t sq_ring_size, cq_ring_size, sqes_size;
+    };
+
+    /*static*/ IOUringContext *IOUringContext::create(unsigned entries)
+    {
+      struct io_uring_params params;
+      memset(&params, 0, sizeof(params));
+      int ring_fd = io_uring_setup(entries, &params);
+      if(ring_fd < 0) {
+	// ENOSYS just means the kernel predates io_uring - fall back quietly
+	if(errno != ENOSYS)
+	  log_aio.warning() << "io_uring_setup failed: " << strerror(errno);
+	return 0;
+      }
+      return new IOUringContext(ring_fd, params);
+    }
+
+    IOUringContext::IOUringContext(int _ring_fd,
+				   const struct io_uring_params& params)
+      : ring_fd(_ring_fd)
+    {
+      sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      cq_ring_size = (params.cq_off.cqes +
+		      params.cq_entries * sizeof(struct io_uring_cqe));
+      bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+      if((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+	// sq and cq rings share one mapping on newer kernels
+	single_mmap = true;
+	if(cq_ring_size > sq_ring_size)
+	  sq_ring_size = cq_ring_size;
+	cq_ring_size = sq_ring_size;
+      }
+#endif
+      sq_ring_base = mmap(0, sq_ring_size, PROT_READ | PROT_WRITE,
+			  MAP_SHARED | MAP_POPULATE, ring_fd,
+			  IORING_OFF_SQ_RING);
+      assert(sq_ring_base != MAP_FAILED);
+      if(single_mmap) {
+	cq_ring_base = sq_ring_base;
+      } else {
+	cq_ring_base = mmap(0, cq_ring_size, PROT_READ | PROT_WRITE,
+			    MAP_SHARED | MAP_POPULATE, ring_fd,
+			    IORING_OFF_CQ_RING);
+	assert(cq_ring_base != MAP_FAILED);
+      }
+      sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+      sqes = (struct io_uring_sqe *)mmap(0, sqes_size, PROT_READ | PROT_WRITE,
+					 MAP_SHARED | MAP_POPULATE, ring_fd,
+					 IORING_OFF_SQES);
+      assert(sqes != MAP_FAILED);
+
+      sq_head = (unsigned *)((char *)sq_ring_base + params.sq_off.head);
+      sq_tail = (unsigned *)((char *)sq_ring_base + params.sq_off.tail);
+      sq_mask = (unsigned *)((char *)sq_ring_base + params.sq_off.ring_mask);
+      sq_array = (unsigned *)((char *)sq_ring_base + params.sq_off.array);
+      cq_head = (unsigned *)((char *)cq_ring_base + params.cq_off.head);
+      cq_tail = (unsigned *)((char *)cq_ring_base + params.cq_off.tail);
+      cq_mask = (unsigned *)((char *)cq_ring_base + params.cq_off.ring_mask);
+      cqes = (struct io_uring_cqe *)((char *)cq_ring_base + params.cq_off.cqes);
+    }
+
+    IOUringContext::~IOUringContext(void)
+    {
+      munmap(sqes, sqes_size);
+      if(cq_ring_base != sq_ring_base)
+	munmap(cq_ring_base, cq_ring_size);
+      munmap(sq_ring_base, sq_ring_size);
+      close(ring_fd);
+    }
+
+    void IOUringContext::submit(uint8_t opcode, int fd,
+				const struct iovec *iov,
+				off_t file_offset, void *user_data)
+    {
+      // the caller bounds in-flight operations by the queue depth, so
+      //  there is always room for another sqe
+      unsigned tail = __atomic_load_n(sq_tail, __ATOMIC_RELAXED);
+      unsigned index = tail & *sq_mask;
+      struct io_uring_sqe *sqe = &sqes[index];
+      memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = opcode;
+      sqe->fd = fd;
+      sqe->addr = (uint64_t)(uintptr_t)iov;
+      sqe->len = 1;
+      sqe->off = file_offset;
+      sqe->user_data = (uint64_t)(uintptr_t)user_data;
+      sq_array[index] = index;
+      __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+#ifndef NDEBUG
+      int ret =
+#endif
+	io_uring_enter(ring_fd, 1, 0, 0);
+      assert(ret == 1);
+    }
+
+    void IOUringContext::reap_completions(void)
+    {
+      unsigned head = __atomic_load_n(cq_head, __ATOMIC_RELAXED);
+      unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+      if(head == tail) return;
+      while(head != tail) {
+	struct io_uring_cqe *cqe = &cqes[head & *cq_mask];
+	AsyncFileIOContext::AIOOperation *op =
+	  (AsyncFileIOContext::AIOOperation *)(uintptr_t)(cqe->user_data);
+	log_aio.debug("io_uring completion: op=%p res=%d",
+		      static_cast<void *>(op), cqe->res);
+	assert(cqe->res >= 0);
+	op->completed = true;
+	head++;
+      }
+      __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    class URingWrite : public AsyncFileIOContext::AIOOperation {
+    public:
+      URingWrite(IOUringContext *_ring,
+		 int _fd, size_t _offset, size_t bytes,
+		 const void *buffer, Request* request = NULL);
+      virtual void launch(void);
+      virtual bool check_completion(void);
+
+    public:
+      IOUringContext *ring;
+      int fd;
+      off_t offset;
+      struct iovec iov;
+    };
+
+    URingWrite::URingWrite(IOUringContext *_ring,
+			   int _fd, size_t _offset, size_t bytes,
+			   const void *buffer, Request* request)
+    {
+      completed = false;
+      ring = _ring;
+      fd = _fd;
+      offset = _offset;
+      iov.iov_base = const_cast<void *>(buffer);
+      iov.iov_len = bytes;
+      req = request;
+    }
+
+    void URingWrite::launch(void)
+    {
+      log_aio.debug("uring write issued: op=%p", static_cast<void *>(this));
+      ring->submit(IORING_OP_WRITEV, fd, &iov, offset, this);
+    }
+
+    bool URingWrite::check_completion(void)
+    {
+      return completed;
+    }
+
+    class URingRead : public AsyncFileIOContext::AIOOperation {
+    public:
+      URingRead(IOUringContext *_ring,
+		int _fd, size_t _offset, size_t bytes,
+		void *buffer, Request* request = NULL);
+      virtual void launch(void);
+      virtual bool check_completion(void);
+
+    public:
+      IOUringContext *ring;
+      int fd;
+      off_t offset;
+      struct iovec iov;
+    };
+
+    URingRead::URingRead(IOUringContext *_ring,
+			 int _fd, size_t _offset, size_t bytes,
+			 void *buffer, Request* request)
+    {
+      completed = false;
+      ring = _ring;
+      fd = _fd;
+      offset = _offset;
+      iov.iov_base = buffer;
+      iov.iov_len = bytes;
+      req = request;
+    }
+
+    void URingRead::launch(void)
+    {
+      log_aio.debug("uring read issued: op=%p", static_cast<void *>(this));
+      ring->submit(IORING_OP_READV, fd, &iov, offset, this);
+    }
+
+    bool URingRead::check_completion(void)
+    {
+      return completed;
+    }
+#endif
+
 #ifdef REALM_USE_LIBAIO
     class PosixAIOWrite : public AsyncFileIOContext::AIOOperation {
     public:
@@ -407,6 +644,9 @@ namespace Realm {
 #endif
 	io_setup(max_depth, &aio_ctx);
       assert(ret == 0);
+#endif
+#ifdef REALM_USE_IO_URING
+      uring_ctx = IOUringContext::create(max_depth);
 #endif
     }
 
@@ -420,6 +660,9 @@ namespace Realm {
 #endif
 	io_destroy(aio_ctx);
       assert(ret == 0);
+#endif
+#ifdef REALM_USE_IO_URING
+      delete uring_ctx;
 #endif
     }
 
@@ -427,15 +670,19 @@ namespace Realm {
 					   size_t bytes, const void *buffer,
                                            Request* req)
     {
+      AsyncFileIOContext::AIOOperation *op = 0;
+#ifdef REALM_USE_IO_URING
+      if(uring_ctx != 0)
+	op = new URingWrite(uring_ctx, fd, offset, bytes, buffer, req);
+#endif
 #ifdef REALM_USE_KERNEL_AIO
-      KernelAIOWrite *op = new KernelAIOWrite(aio_ctx,
-					      fd, offset, bytes, buffer, req);
+      if(op == 0)
+	op = new KernelAIOWrite(aio_ctx, fd, offset, bytes, buffer, req);
 #elif defined(REALM_USE_LIBAIO)
-      PosixAIOWrite *op = new PosixAIOWrite(fd, offset, bytes, buffer, req);
-#else
-      AsyncFileIOContext::AIOOperation* op = 0;
-      assert(0);
+      if(op == 0)
+	op = new PosixAIOWrite(fd, offset, bytes, buffer, req);
 #endif
+      assert(op != 0);
       bool was_empty;
       {
 	AutoLock<> al(mutex);
@@ -455,15 +702,19 @@ namespace Realm {
 					  size_t bytes, void *buffer,
                                           Request* req)
     {
+      AsyncFileIOContext::AIOOperation *op = 0;
+#ifdef REALM_USE_IO_URING
+      if(uring_ctx != 0)
+	op = new URingRead(uring_ctx, fd, offset, bytes, buffer, req);
+#endif
 #ifdef REALM_USE_KERNEL_AIO
-      KernelAIORead *op = new KernelAIORead(aio_ctx,
-					    fd, offset, bytes, buffer, req);
+      if(op == 0)
+	op = new KernelAIORead(aio_ctx, fd, offset, bytes, buffer, req);
 #elif defined(REALM_USE_LIBAIO)
-      PosixAIORead *op = new PosixAIORead(fd, offset, bytes, buffer, req);
-#else
-      AsyncFileIOContext::AIOOperation* op = 0;
-      assert(0);
+      if(op == 0)
+	op = new PosixAIORead(fd, offset, bytes, buffer, req);
 #endif
+      assert(op != 0);
       bool was_empty;
       {
 	AutoLock<> al(mutex);
@@ -514,6 +765,10 @@ namespace Realm {
       AutoLock<> al(mutex);
 
       // first, reap as many events as we can - oldest first
+#ifdef REALM_USE_IO_URING
+      if(uring_ctx != 0)
+	uring_ctx->reap_completions();
+#endif
 #ifdef REALM_USE_KERNEL_AIO
       while(true) {
 	struct io_event events[8];
@@ -560,9 +815,13 @@ namespace Realm {
     bool AsyncFileIOContext::do_work(TimeLimit work_until)
     {
       // first, reap as many events as we can - oldest first
+#ifdef REALM_USE_IO_URING
+      if(uring_ctx != 0)
+	uring_ctx->reap_completions();
+#endif
 #ifdef REALM_USE_KERNEL_AIO
       assert(!launched_operations.empty());
-      while {
+      do {
 	struct io_event events[8];
 	struct timespec ts;
 	ts.tv_sec = 0;
@@ -32,6 +32,8 @@ namespace Realm {
     namespace Config {
       // the size of the LRU of the cache
       extern size_t path_cache_lru_size;
+      // the size of the compiled address program cache
+      extern size_t address_program_cache_size;
     };
 
     extern void init_dma_handler(void);
@@ -125,6 +127,10 @@ namespace Realm {
                            const std::vector<size_t> *dst_frags, MemPathInfo &info,
                            bool skip_final_memcpy = false);
 
+#ifdef REALM_USE_IO_URING
+    class IOUringContext;  // defined in lowlevel_dma.cc
+#endif
+
     class AsyncFileIOContext : public BackgroundWorkItem {
     public:
       AsyncFileIOContext(int _max_depth);
@@ -158,6 +164,10 @@ namespace Realm {
       Mutex mutex;
 #ifdef REALM_USE_KERNEL_AIO
       aio_context_t aio_ctx;
+#endif
+#ifdef REALM_USE_IO_URING
+      // null if the running kernel does not support io_uring
+      IOUringContext *uring_ctx;
 #endif
     };
 
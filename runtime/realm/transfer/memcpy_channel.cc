@@ -36,6 +36,10 @@ namespace Realm {
   extern Logger log_xd;
   extern Logger log_xd_ref;
 
+  // address list entries at or below this size are handled by the fused
+  //  gather/scatter fast path rather than the full dimension analysis
+  static const size_t MAX_FUSED_ENTRY_BYTES = 256;
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class MemcpyXferDes
@@ -216,6 +220,28 @@ namespace Realm {
                   memcpy_1d(out_base + out_offset, in_base + in_offset, bytes);
                   in_alc.advance(0, bytes);
                   out_alc.advance(0, bytes);
+                  // fused gather/scatter fast path: a fine-grained indirection
+                  //  (e.g. per-particle points) produces a long run of tiny 1D
+                  //  entries - peel off whole entries in a tight loop rather
+                  //  than redoing the full dimension analysis for each one
+                  if(bytes <= MAX_FUSED_ENTRY_BYTES) {
+                    while(bytes < bytes_left) {
+                      if((in_alc.get_dim() != 1) || (out_alc.get_dim() != 1))
+                        break;
+                      size_t ibytes = in_alc.remaining(0);
+                      size_t obytes = out_alc.remaining(0);
+                      size_t cbytes =
+                          std::min(std::min(ibytes, obytes), bytes_left - bytes);
+                      if(cbytes > MAX_FUSED_ENTRY_BYTES) {
+                        break; // larger pieces may benefit from 2D/3D analysis
+                      }
+                      memcpy_1d(out_base + out_alc.get_offset(),
+                                in_base + in_alc.get_offset(), cbytes);
+                      in_alc.advance(0, cbytes);
+                      out_alc.advance(0, cbytes);
+                      bytes += cbytes;
+                    }
+                  }
                 } else {
                   // grow to a 2D copy
                   int id;
@@ -431,6 +457,15 @@ namespace Realm {
       add_path(local_cpu_mems, remote_shared_mems, bw, latency, frag_overhead,
                XFER_MEM_CPY)
           .set_max_dim(3);
+      // shared-peer memories are mapped into our address space, so they can
+      //  be copy sources as well - without this, reads from a same-node peer
+      //  rank fall back to the network module
+      add_path(remote_shared_mems, local_cpu_mems, bw, latency, frag_overhead,
+               XFER_MEM_CPY)
+          .set_max_dim(3);
+      add_path(remote_shared_mems, remote_shared_mems, bw, latency, frag_overhead,
+               XFER_MEM_CPY)
+          .set_max_dim(3);
     }
 
     xdq.add_to_manager(_bgwork);
@@ -40,6 +40,8 @@ namespace Realm {
   namespace Config {
     // the size of the cache
     size_t path_cache_lru_size = 0;
+    // the number of compiled address programs to keep (0 = no caching)
+    size_t address_program_cache_size = 0;
     size_t ib_size_bytes = 65536;
   }; // namespace Config
 
@@ -59,6 +61,120 @@ namespace Realm {
     return local_addrsplit_channel;
   }
 
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class CompiledAddressProgram
+  //
+
+  // a compiled address program is the complete sequence of address list
+  //  entries produced by one walk of an (instance layout, index space)
+  //  pair - transfers that repeat the same pattern (e.g. a stencil
+  //  exchange issuing an identical sparse gather every timestep) replay
+  //  the recorded entries and skip piece lookup and subrectangle
+  //  computation entirely
+  class CompiledAddressProgram {
+  public:
+    CompiledAddressProgram(const std::string &_key)
+      : key(_key)
+      , refcount(1)
+    {}
+
+    void add_reference() { refcount.fetch_add(1); }
+
+    void remove_reference()
+    {
+      if(refcount.fetch_sub(1) == 1) {
+        delete this;
+      }
+    }
+
+    // each entry is 2*dim words in 'words', in exactly the format that
+    //  AddressList::begin_nd_entry hands out
+    struct Entry {
+      int dim;
+      size_t bytes;
+      size_t first_word;
+    };
+
+    const std::string key;
+    std::vector<Entry> entries;
+    std::vector<size_t> words;
+
+  protected:
+    // deletion happens via remove_reference only
+    ~CompiledAddressProgram() {}
+
+    atomic<int> refcount;
+  };
+
+  ////////////////////////////////////////////////////////////////////////
+  //
+  // class AddressProgramCache
+  //
+
+  // a node-wide LRU of compiled address programs, keyed by the bytes of
+  //  the key string built in get_address_program_key - disabled unless
+  //  -ll:addrprog_cache_size is set
+  class AddressProgramCache {
+  public:
+    static AddressProgramCache &get_cache()
+    {
+      static AddressProgramCache cache;
+      return cache;
+    }
+
+    // very long walks are not worth memoizing - the cost of the walk is
+    //  amortized by the transfer itself at that point
+    static const size_t MAX_PROGRAM_WORDS = 65536;
+
+    // returns a referenced program, or null on a miss
+    CompiledAddressProgram *lookup(const std::string &key)
+    {
+      AutoLock<> al(mutex);
+      std::map<std::string, LRUOrder::iterator>::iterator it = programs.find(key);
+      if(it == programs.end()) {
+        return 0;
+      }
+      // move to the front of the lru order
+      lru_order.splice(lru_order.begin(), lru_order, it->second);
+      CompiledAddressProgram *prog = *(it->second);
+      prog->add_reference();
+      return prog;
+    }
+
+    // takes over the caller's reference to 'prog'
+    void install(CompiledAddressProgram *prog)
+    {
+      CompiledAddressProgram *discard = 0;
+      {
+        AutoLock<> al(mutex);
+        if(programs.count(prog->key) > 0) {
+          // somebody else compiled the same program first - keep theirs
+          discard = prog;
+        } else {
+          lru_order.push_front(prog);
+          programs[prog->key] = lru_order.begin();
+          if(lru_order.size() > Config::address_program_cache_size) {
+            discard = lru_order.back();
+            programs.erase(discard->key);
+            lru_order.pop_back();
+          }
+        }
+      }
+      if(discard) {
+        discard->remove_reference();
+      }
+    }
+
+  protected:
+    typedef std::list<CompiledAddressProgram *> LRUOrder;
+
+    Mutex mutex;
+    // front of the list is the most recently used program
+    LRUOrder lru_order;
+    std::map<std::string, LRUOrder::iterator> programs;
+  };
+
   ////////////////////////////////////////////////////////////////////////
   //
   // class TransferIterator
@@ -100,6 +216,10 @@ namespace Realm {
     , is_done(false)
     , inst_impl(_inst_impl)
     , tentative_valid(false)
+    , replay_program(0)
+    , record_program(0)
+    , replay_pos(0)
+    , program_checked(false)
   {
 
     if(_dim_order) {
@@ -119,8 +239,22 @@ namespace Realm {
     , is_done(false)
     , inst_impl(0)
     , tentative_valid(false)
+    , replay_program(0)
+    , record_program(0)
+    , replay_pos(0)
+    , program_checked(false)
   {}
 
+  template <int N, typename T>
+  TransferIteratorBase<N, T>::~TransferIteratorBase(void)
+  {
+    finish_address_program(false /*!complete*/);
+    if(replay_program) {
+      replay_program->remove_reference();
+      replay_program = 0;
+    }
+  }
+
   template <int N, typename T>
   Event TransferIteratorBase<N, T>::request_metadata(void)
   {
@@ -136,6 +270,13 @@ namespace Realm {
     have_rect = false;
     is_done = false;
     tentative_valid = false;
+    // a partially recorded program is invalid now, but a replay (if we
+    //  have one) just starts over
+    finish_address_program(false /*!complete*/);
+    replay_pos = 0;
+    if(!replay_program) {
+      program_checked = false;
+    }
   }
 
   template <int N, typename T>
@@ -200,6 +341,11 @@ namespace Realm {
   size_t TransferIteratorBase<N, T>::step(size_t max_bytes, AddressInfo &info,
                                           unsigned flags, bool tentative /*= false*/)
   {
+    // mixing step() with get_addresses() memoization would record (or
+    //  replay) an incomplete program - disable it for this iterator
+    program_checked = true;
+    finish_address_program(false /*!complete*/);
+
     // check to see if we're done - if not, we'll have a valid rectangle
     if(done() || !have_rect) {
       return 0;
@@ -353,6 +499,10 @@ namespace Realm {
                                                  AddressInfoCustom &info,
                                                  bool tentative /*= false*/)
   {
+    // as in step(), memoization and custom stepping don't mix
+    program_checked = true;
+    finish_address_program(false /*!complete*/);
+
     // check to see if we're done - if not, we'll have a valid rectangle
     if(done() || !have_rect) {
       return 0;
@@ -501,6 +651,68 @@ namespace Realm {
     return inst_impl->metadata.inst_offset;
   }
 
+  template <int N, typename T>
+  bool TransferIteratorBase<N, T>::get_address_program_key(std::string &key) const
+  {
+    // no memoization by default
+    return false;
+  }
+
+  template <int N, typename T>
+  bool TransferIteratorBase<N, T>::replay_addresses(AddressList &addrlist)
+  {
+    while(replay_pos < replay_program->entries.size()) {
+      const CompiledAddressProgram::Entry &e = replay_program->entries[replay_pos];
+      size_t *addr_data = addrlist.begin_nd_entry(e.dim);
+      if(!addr_data) {
+        return true; // out of space for now
+      }
+      memcpy(addr_data, &replay_program->words[e.first_word],
+             e.dim * 2 * sizeof(size_t));
+      addrlist.commit_nd_entry(e.dim, e.bytes);
+      replay_pos++;
+    }
+    // the program covered the entire walk, so we're done without ever
+    //  having touched the layout pieces
+    have_rect = false;
+    is_done = true;
+    return true;
+  }
+
+  template <int N, typename T>
+  void TransferIteratorBase<N, T>::record_address_entry(int act_dim, size_t bytes,
+                                                        const size_t *addr_data)
+  {
+    size_t num_words = act_dim * 2;
+    if((record_program->words.size() + num_words) >
+       AddressProgramCache::MAX_PROGRAM_WORDS) {
+      // too long to be worth memoizing - abandon the recording
+      finish_address_program(false /*!complete*/);
+      return;
+    }
+    CompiledAddressProgram::Entry e;
+    e.dim = act_dim;
+    e.bytes = bytes;
+    e.first_word = record_program->words.size();
+    record_program->entries.push_back(e);
+    record_program->words.insert(record_program->words.end(), addr_data,
+                                 addr_data + num_words);
+  }
+
+  template <int N, typename T>
+  void TransferIteratorBase<N, T>::finish_address_program(bool complete)
+  {
+    if(!record_program) {
+      return;
+    }
+    if(complete) {
+      AddressProgramCache::get_cache().install(record_program);
+    } else {
+      record_program->remove_reference();
+    }
+    record_program = 0;
+  }
+
   template <int N, typename T>
   bool
   TransferIteratorBase<N, T>::get_addresses(AddressList &addrlist,
@@ -511,6 +723,23 @@ namespace Realm {
 #endif
     nonaffine = 0;
 
+    // on the first call, see if a previous walk of the same pattern left
+    //  a compiled address program for us to replay (and start recording
+    //  one if not)
+    if(!program_checked) {
+      program_checked = true;
+      std::string key;
+      if((Config::address_program_cache_size > 0) && get_address_program_key(key)) {
+        replay_program = AddressProgramCache::get_cache().lookup(key);
+        if(!replay_program) {
+          record_program = new CompiledAddressProgram(key);
+        }
+      }
+    }
+    if(replay_program) {
+      return replay_addresses(addrlist);
+    }
+
     const InstanceLayout<N, T> *inst_layout =
         checked_cast<const InstanceLayout<N, T> *>(inst_impl->metadata.layout);
 
@@ -549,6 +778,8 @@ namespace Realm {
           // can't handle this piece here - let the caller know what the
           //  non-affine piece is and maybe it can handle it
           nonaffine = layout_piece;
+          // a program we record here would be incomplete
+          finish_address_program(false /*!complete*/);
           return true;
         }
         field_rel_offset = it->second.rel_offset + cur_field_offset;
@@ -634,6 +865,9 @@ namespace Realm {
         //  record
         addr_data[0] = (bytes << 4) + cur_dim;
         addrlist.commit_nd_entry(cur_dim, total_bytes);
+        if(record_program) {
+          record_address_entry(cur_dim, total_bytes, addr_data);
+        }
         log_dma.debug() << "Finalize addr data dim=" << cur_dim << " total_bytes"
                         << total_bytes;
       } else {
@@ -641,6 +875,10 @@ namespace Realm {
       }
     }
 
+    // the walk is complete, so any program we recorded along the way can
+    //  be installed for future transfers of the same pattern
+    finish_address_program(true /*complete*/);
+
     return true; // we have no more addresses to produce
   }
 
@@ -789,6 +1027,43 @@ namespace Realm {
     return true;
   }
 
+  template <int N, typename T>
+  bool
+  TransferIteratorIndexSpace<N, T>::get_address_program_key(std::string &key) const
+  {
+    // only sparse spaces are worth memoizing - a dense walk produces just
+    //  a handful of entries to begin with
+    if(iter_init_deferred || !is.is_valid() || !is.sparsity.exists()) {
+      return false;
+    }
+
+    // the walk is fully determined by the instance's layout, the fields
+    //  requested, the traversal order, and the index space
+    std::vector<size_t> raw;
+    raw.reserve(6 + 3 * N + 3 * fields.size());
+    raw.push_back(this->inst_impl->me.id);
+    raw.push_back(reinterpret_cast<size_t>(this->inst_impl->metadata.layout));
+    raw.push_back(this->inst_impl->metadata.inst_offset);
+    raw.push_back(N);
+    raw.push_back(sizeof(T));
+    for(int i = 0; i < N; i++) {
+      raw.push_back(this->dim_order[i]);
+    }
+    for(size_t i = 0; i < fields.size(); i++) {
+      raw.push_back(fields[i]);
+      raw.push_back(fld_offsets[i]);
+      raw.push_back(fld_sizes[i]);
+    }
+    raw.push_back(is.sparsity.id);
+    for(int i = 0; i < N; i++) {
+      raw.push_back(size_t(is.bounds.lo[i]));
+      raw.push_back(size_t(is.bounds.hi[i]));
+    }
+    key.assign(reinterpret_cast<const char *>(raw.data()),
+               raw.size() * sizeof(size_t));
+    return true;
+  }
+
   template <int N, typename T>
   /*static*/ Serialization::PolymorphicSerdezSubclass<TransferIterator,
                                                       TransferIteratorIndexSpace<N, T>>
@@ -4586,6 +4861,12 @@ namespace Realm {
     }
   }
 
+  // field-parallel split heuristics: never split a copy node into more
+  //  pieces than this many xfer descriptors...
+  static constexpr size_t FIELD_SPLIT_MAX_PIECES = 4;
+  // ...and only split while every piece still moves at least this much data
+  static constexpr size_t FIELD_SPLIT_MIN_BYTES = 4 << 20;
+
   void TransferOperation::create_xds()
   {
     // make sure we haven't been cancelled
@@ -4597,16 +4878,88 @@ namespace Realm {
 
     const TransferGraph &tg = desc.graph;
 
+    // field-parallel decomposition: a simple instance-to-instance copy node
+    //  covering many fields is walked as one long field loop by a single
+    //  xfer descriptor, leaving the other channel workers (and any extra
+    //  copy engines) idle. Split such nodes into several descriptors over
+    //  disjoint field subsets so they can progress in parallel. This is
+    //  only attempted for single-input/single-output nodes with no ibs,
+    //  indirections, serdez or reduction, since those either couple the
+    //  fields together or reshape the graph.
+    std::vector<TransferGraph::XDTemplate> xd_nodes(tg.xd_nodes);
+    std::vector<bool> release_factory(xd_nodes.size(), true);
+    if(tg.ib_edges.empty()) {
+      const size_t volume = desc.domain->volume();
+      const size_t num_nodes = xd_nodes.size();
+      for(size_t i = 0; i < num_nodes; i++) {
+        const TransferGraph::XDTemplate base = xd_nodes[i];
+        if((base.redop.id != 0) || (base.gather_control_input >= 0) ||
+           (base.scatter_control_input >= 0) || (base.inputs.size() != 1) ||
+           (base.outputs.size() != 1) ||
+           (base.inputs[0].iotype != TransferGraph::XDTemplate::IO_INST) ||
+           (base.outputs[0].iotype != TransferGraph::XDTemplate::IO_INST)) {
+          continue;
+        }
+        const unsigned fld_count = base.inputs[0].inst.fld_count;
+        if((fld_count < 2) || (base.outputs[0].inst.fld_count != fld_count)) {
+          continue;
+        }
+        size_t total_field_bytes = 0;
+        bool splittable = true;
+        for(unsigned k = 0; k < fld_count; k++) {
+          const TransferDesc::FieldInfo &sf =
+              desc.src_fields[base.inputs[0].inst.fld_start + k];
+          const TransferDesc::FieldInfo &df =
+              desc.dst_fields[base.outputs[0].inst.fld_start + k];
+          if((sf.serdez_id != 0) || (df.serdez_id != 0)) {
+            splittable = false;
+            break;
+          }
+          total_field_bytes += sf.size;
+        }
+        if(!splittable) {
+          continue;
+        }
+        size_t pieces = std::min(size_t(fld_count), FIELD_SPLIT_MAX_PIECES);
+        pieces = std::min(pieces, (volume * total_field_bytes) / FIELD_SPLIT_MIN_BYTES);
+        if(pieces < 2) {
+          continue;
+        }
+        log_new_dma.info() << "field-parallel split: plan=" << (void *)&desc
+                           << " node=" << i << " fields=" << fld_count
+                           << " pieces=" << pieces;
+        unsigned offset = 0;
+        for(size_t p = 0; p < pieces; p++) {
+          const unsigned this_count = (fld_count - offset) / (pieces - p);
+          TransferGraph::XDTemplate piece = base;
+          piece.inputs[0].inst.fld_start = base.inputs[0].inst.fld_start + offset;
+          piece.inputs[0].inst.fld_count = this_count;
+          piece.outputs[0].inst.fld_start = base.outputs[0].inst.fld_start + offset;
+          piece.outputs[0].inst.fld_count = this_count;
+          if(p == 0) {
+            xd_nodes[i] = piece;
+            // the pieces share the original factory, which must only be
+            //  released once all of them have been created
+            release_factory[i] = false;
+          } else {
+            xd_nodes.push_back(piece);
+            release_factory.push_back(p == (pieces - 1));
+          }
+          offset += this_count;
+        }
+      }
+    }
+
     // we're going to need pre/next xdguids, so precreate all of them
-    xd_ids.resize(tg.xd_nodes.size(), XferDes::XFERDES_NO_GUID);
+    xd_ids.resize(xd_nodes.size(), XferDes::XFERDES_NO_GUID);
     typedef std::pair<XferDesID, int> IBEdge;
     const IBEdge dfl_edge(XferDes::XFERDES_NO_GUID, 0);
     std::vector<IBEdge> ib_pre_ids(tg.ib_edges.size(), dfl_edge);
     std::vector<IBEdge> ib_next_ids(tg.ib_edges.size(), dfl_edge);
 
     XferDesQueue *xdq = XferDesQueue::get_singleton();
-    for(size_t i = 0; i < tg.xd_nodes.size(); i++) {
-      const TransferGraph::XDTemplate &xdn = tg.xd_nodes[i];
+    for(size_t i = 0; i < xd_nodes.size(); i++) {
+      const TransferGraph::XDTemplate &xdn = xd_nodes[i];
 
       XferDesID new_xdid = xdq->get_guid(xdn.target_node);
 
@@ -4630,9 +4983,9 @@ namespace Realm {
                        << std::dec;
 
     // now actually create xfer descriptors for each template node in our DAG
-    xd_trackers.resize(tg.xd_nodes.size(), 0);
-    for(size_t i = 0; i < tg.xd_nodes.size(); i++) {
-      const TransferGraph::XDTemplate &xdn = tg.xd_nodes[i];
+    xd_trackers.resize(xd_nodes.size(), 0);
+    for(size_t i = 0; i < xd_nodes.size(); i++) {
+      const TransferGraph::XDTemplate &xdn = xd_nodes[i];
 
       NodeID xd_target_node = xdn.target_node;
       XferDesID xd_guid = xd_ids[i];
@@ -4897,7 +5250,7 @@ namespace Realm {
       xd_factory->create_xfer_des(reinterpret_cast<uintptr_t>(this), Network::my_node_id,
                                   xd_target_node, xd_guid, inputs_info, outputs_info,
                                   priority, xdn.redop, fill_data, fill_size, fill_total);
-      if(xd_factory->needs_release()) {
+      if(release_factory[i] && xd_factory->needs_release()) {
         delete xd_factory;
       }
     }
@@ -35,6 +35,7 @@ namespace Realm {
 
   class XferDes;
   class AddressList;
+  class CompiledAddressProgram;
 
   class TransferIterator {
   public:
@@ -126,6 +127,8 @@ namespace Realm {
   public:
     TransferIteratorBase(RegionInstanceImpl *_inst_impl, const int _dim_order[N]);
 
+    virtual ~TransferIteratorBase(void);
+
     virtual Event request_metadata(void);
 
     virtual void reset(void);
@@ -147,6 +150,15 @@ namespace Realm {
     virtual bool get_next_rect(Rect<N, T> &r, FieldID &fid, size_t &offset,
                                size_t &fsize) = 0;
 
+    // subclasses whose walk is a pure function of the instance layout and
+    //  index space can supply a cache key here to memoize the address
+    //  entries they produce - see AddressProgramCache in transfer.cc
+    virtual bool get_address_program_key(std::string &key) const;
+
+    bool replay_addresses(AddressList &addrlist);
+    void record_address_entry(int act_dim, size_t bytes, const size_t *addr_data);
+    void finish_address_program(bool complete);
+
     bool have_rect, is_done;
     Rect<N, T> cur_rect;
     FieldID cur_field_id;
@@ -159,6 +171,11 @@ namespace Realm {
     size_t inst_offset;
     bool tentative_valid;
     int dim_order[N];
+
+    // memoization state for get_addresses - at most one of these is set
+    CompiledAddressProgram *replay_program, *record_program;
+    size_t replay_pos;
+    bool program_checked;
   };
 
   ////////////////////////////////////////////////////////////////////////
@@ -206,6 +223,8 @@ namespace Realm {
     virtual bool get_next_rect(Rect<N, T> &r, FieldID &fid, size_t &offset,
                                size_t &fsize);
 
+    virtual bool get_address_program_key(std::string &key) const;
+
     IndexSpace<N, T> is;
     SparsityMapImpl<N, T> *sparsity_impl{nullptr};
     IndexSpaceIterator<N, T> iter;
@@ -189,7 +189,7 @@ err:
   bool UCPWorker::am_send_fast_path(ucp_ep_h ep, unsigned am_id,
       const void *header, size_t header_size,
       const void *payload, size_t payload_size,
-      ucs_memory_type_t memtype)
+      ucs_memory_type_t memtype, ucp_mem_h memh)
   {
     ucp_request_param_t param;
     ucs_status_ptr_t status_ptr;
@@ -203,6 +203,11 @@ err:
     param.memory_type  = memtype;
     param.flags        = UCP_AM_SEND_FLAG_COPY_HEADER;
 
+    if (memh != nullptr) {
+      param.op_attr_mask |= UCP_OP_ATTR_FIELD_MEMH;
+      param.memh          = memh;
+    }
+
     scount.fetch_add_acqrel(1);
     status_ptr = UCP_FNPTR(ucp_am_send_nbx)(ep, am_id,
         header, header_size, payload, payload_size, &param);
@@ -229,6 +234,11 @@ err:
     param.memory_type  = req->memtype,
     param.flags        = req->flags;
 
+    if (req->memh != nullptr) {
+      param.op_attr_mask |= UCP_OP_ATTR_FIELD_MEMH;
+      param.memh          = req->memh;
+    }
+
     scount.fetch_add_acqrel(1);
 
     switch (req->op_type) {
@@ -408,8 +418,11 @@ err:
     CHKERR_JUMP(UCP_FNPTR(ucp_mem_query)(mem_h, &attr) != UCS_OK,
         "pbuf_chunk_alloc mem_query failed", log_ucp, err);
 
-    assert(worker->pbuf_mp_mem_hs.count(attr.address) == 0);
-    worker->pbuf_mp_mem_hs[attr.address] = mem_h;
+    {
+      uintptr_t base = reinterpret_cast<uintptr_t>(attr.address);
+      assert(worker->pbuf_mp_mem_hs.count(base) == 0);
+      worker->pbuf_mp_mem_hs[base] = PbufChunkReg{attr.length, mem_h};
+    }
     return attr.address;
 
 err:
@@ -419,16 +432,29 @@ err:
   void UCPWorker::pbuf_chunk_release(void *chunk, void *arg)
   {
     UCPWorker *worker = static_cast<UCPWorker*>(arg);
-    auto iter         = worker->pbuf_mp_mem_hs.find(chunk);
+    auto iter         = worker->pbuf_mp_mem_hs.find(
+                            reinterpret_cast<uintptr_t>(chunk));
     assert(iter != worker->pbuf_mp_mem_hs.end());
 
-    if (worker->context->mem_unmap(iter->second)) {
+    if (worker->context->mem_unmap(iter->second.mem_h)) {
       worker->pbuf_mp_mem_hs.erase(iter);
     } else {
       log_ucp.error() << "pbuf_chunk_release failed for chunk " << chunk;
     }
   }
 
+  ucp_mem_h UCPWorker::find_pbuf_memh(const void *buf, size_t size)
+  {
+    uintptr_t addr = reinterpret_cast<uintptr_t>(buf);
+    AutoLock<SpinLock> al(pbuf_mp_spinlock);
+    // find the first chunk at or below 'addr'
+    auto iter = pbuf_mp_mem_hs.upper_bound(addr);
+    if (iter == pbuf_mp_mem_hs.begin()) return nullptr;
+    --iter;
+    if (addr + size > iter->first + iter->second.bytes) return nullptr;
+    return iter->second.mem_h;
+  }
+
   bool UCPWorker::ep_add(int target, ucp_address_t *addr, int remote_dev_index)
   {
     ucp_ep_h ep;
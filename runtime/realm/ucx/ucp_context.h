@@ -28,6 +28,7 @@
 #endif
 
 #include <ucp/api/ucp.h>
+#include <map>
 #include <unordered_map>
 #include <queue>
 
@@ -56,6 +57,9 @@ namespace UCP {
       void                      *payload;
       size_t                    payload_size;
       ucs_memory_type_t         memtype;
+      // registered-memory handle covering 'payload' (null if unknown) -
+      // lets UCX skip its own registration lookup on the zero-copy path
+      ucp_mem_h                 memh;
       ucp_send_nbx_callback_t   cb;
 
       union {
@@ -106,8 +110,12 @@ namespace UCP {
     bool am_send_fast_path(ucp_ep_h ep, unsigned am_id,
         const void *header, size_t header_size,
         const void *payload, size_t payload_size,
-        ucs_memory_type_t memtype);
+        ucs_memory_type_t memtype, ucp_mem_h memh);
     bool submit_req(Request *req);
+    // look up the registration handle of the pbuf chunk containing
+    //  [buf, buf+size) - returns null if the buffer is not from a
+    //  registered chunk (e.g. it was malloc'ed)
+    ucp_mem_h find_pbuf_memh(const void *buf, size_t size);
     size_t num_eps() const;
 
   private:
@@ -141,7 +149,13 @@ namespace UCP {
     std::queue<void*> am_rdesc_q;
     SpinLock am_rdesc_q_spinlock;
     SpinLock mmp_spinlock;
-    std::unordered_map<void*, ucp_mem_h> pbuf_mp_mem_hs;
+    struct PbufChunkReg {
+      size_t     bytes;
+      ucp_mem_h  mem_h;
+    };
+    // ordered by chunk base address so containing-range lookups can use
+    //  upper_bound - guarded by pbuf_mp_spinlock
+    std::map<uintptr_t, PbufChunkReg> pbuf_mp_mem_hs;
     std::unordered_map<int, std::unordered_map<int, ucp_ep_h>> eps;
     size_t max_am_header;
     atomic<uint64_t> scount{0};
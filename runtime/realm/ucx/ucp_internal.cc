@@ -1374,6 +1374,29 @@ err:
     segment->add_rdma_info(module, &rdma_info, sizeof(rdma_info));
   }
 
+  void UCPInternal::mem_reg_cache_add(const UCPContext *context,
+      const void *base, size_t bytes, ucp_mem_h mem_h)
+  {
+    if (bytes == 0) return;
+    mem_reg_cache[context][reinterpret_cast<uintptr_t>(base)] =
+        MemRegion{bytes, mem_h};
+  }
+
+  ucp_mem_h UCPInternal::mem_reg_cache_lookup(const UCPContext *context,
+      const void *buf, size_t bytes) const
+  {
+    MemRegMap::const_iterator cit = mem_reg_cache.find(context);
+    if (cit == mem_reg_cache.end()) return nullptr;
+
+    uintptr_t addr = reinterpret_cast<uintptr_t>(buf);
+    // find the first region at or below 'addr'
+    auto rit = cit->second.upper_bound(addr);
+    if (rit == cit->second.begin()) return nullptr;
+    --rit;
+    if (addr + bytes > rit->first + rit->second.bytes) return nullptr;
+    return rit->second.mem_h;
+  }
+
   void UCPInternal::attach(std::vector<NetworkSegment *>& segments)
   {
     size_t total_alloc_size = 0;
@@ -1490,6 +1513,7 @@ err:
           continue;
         }
         attach_mem_hs[context].push_back(mem_h);
+        mem_reg_cache_add(context, segment->base, segment->bytes, mem_h);
 
         if(!add_rdma_info(segment, context, mem_h)) {
           log_ucp.info() << "failed to add rdma info for pre-allocated segment "
@@ -1504,6 +1528,7 @@ err:
     status = UCP_FNPTR(ucp_mem_query)(alloc_mem_h, &mem_attr);
     assert(status == UCS_OK);
     alloc_base = reinterpret_cast<uintptr_t>(mem_attr.address);
+    mem_reg_cache_add(context, mem_attr.address, total_alloc_size, alloc_mem_h);
     offset     = 0;
     for (NetworkSegment *segment : segments) {
       if(segment->bytes == 0 || segment->base)
@@ -1564,6 +1589,8 @@ err:
         mem_hs.pop_back();
       }
     }
+    // all cached registrations are now stale
+    mem_reg_cache.clear();
     log_ucp.info() << "unmapped attached segments";
   }
 
@@ -2151,11 +2178,27 @@ err:
     UCPMessageImpl::am_local_failure_handler(req, internal);
   }
 
+  ucp_mem_h UCPMessageImpl::payload_memh(size_t act_payload_size) const
+  {
+    if (act_payload_size == 0) return nullptr;
+    switch (payload_base_type) {
+      case PAYLOAD_BASE_INTERNAL:
+        return worker->find_pbuf_memh(payload_base, act_payload_size);
+      case PAYLOAD_BASE_EXTERNAL:
+        return internal->mem_reg_cache_lookup(worker->get_context(),
+            payload_base, act_payload_size);
+      default:
+        // inline payloads live in unregistered request storage
+        return nullptr;
+    }
+  }
+
   bool UCPMessageImpl::send_fast_path(ucp_ep_h ep, size_t act_payload_size)
   {
     bool ok = worker->am_send_fast_path(ep, AM_ID,
         &ucp_msg_hdr, sizeof(ucp_msg_hdr) + header_size,
-        payload_base, act_payload_size, memtype);
+        payload_base, act_payload_size, memtype,
+        payload_memh(act_payload_size));
 
     if (ok) {
       internal->notify_msg_sent(1);
@@ -2229,6 +2272,7 @@ err:
     req->ucp.payload               = payload_base;
     req->ucp.payload_size          = act_payload_size;
     req->ucp.memtype               = memtype;
+    req->ucp.memh                  = payload_memh(act_payload_size);
     req->ucp.flags                 = 0;
 
     if (is_multicast) {
@@ -2295,6 +2339,7 @@ err:
     req->ucp.payload_size = 0;
     // we're sending header only; memtype will be host
     req->ucp.memtype = UCS_MEMORY_TYPE_HOST;
+    req->ucp.memh    = nullptr;
     CHKERR_JUMP(!UCPMessageImpl::send_request(req, AM_ID_RDMA),
         "failed to send am request in put flush callback", log_ucp, err);
 
@@ -2327,6 +2372,7 @@ err:
     req_put->ucp.payload         = req->ucp.payload;
     req_put->ucp.payload_size    = req->ucp.payload_size;
     req_put->ucp.memtype         = req->ucp.memtype;
+    req_put->ucp.memh            = req->ucp.memh;
     req_put->ucp.flags           = 0;
     req_put->ucp.args            = req_put;
     req_put->ucp.cb              = &UCPMessageImpl::am_put_comp_handler;
@@ -37,6 +37,7 @@
 #include "realm/ucx/ucc_comm.h"
 #include <ucp/api/ucp.h>
 
+#include <map>
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -245,8 +246,26 @@ namespace UCP {
         const ucp_am_recv_param_t *param);
 
     bool compute_shared_ranks();
+
+    // registration cache for attached segments: a send whose source payload
+    //  falls entirely inside a registered range passes the memory handle
+    //  to UCX directly, giving a zero-copy send without a per-send
+    //  registration lookup
+    // populated only during attach (single-threaded), read-only afterwards,
+    //  so no lock is needed
+    struct MemRegion {
+      size_t    bytes;
+      ucp_mem_h mem_h;
+    };
+    void mem_reg_cache_add(const UCPContext *context, const void *base,
+        size_t bytes, ucp_mem_h mem_h);
+    ucp_mem_h mem_reg_cache_lookup(const UCPContext *context,
+        const void *buf, size_t bytes) const;
+
     using WorkersMap = std::unordered_map<const UCPContext*, Workers>;
     using AttachMap  = std::unordered_map<const UCPContext*, std::vector<ucp_mem_h>>;
+    using MemRegMap  = std::unordered_map<const UCPContext*,
+                                          std::map<uintptr_t, MemRegion>>;
 
 #ifdef REALM_UCX_DYNAMIC_LOAD
     void                                    *libucp{nullptr};
@@ -266,6 +285,7 @@ namespace UCP {
     std::list<UCPPoller>                    pollers;
     std::list<AmHandlersArgs>               am_handlers_args;
     AttachMap                               attach_mem_hs;
+    MemRegMap                               mem_reg_cache;
     atomic<uint64_t>                        total_msg_sent;
     atomic<uint64_t>                        total_msg_received;
     atomic<uint64_t>                        total_rcomp_sent;
@@ -313,6 +333,7 @@ namespace UCP {
     bool send_slow_path(ucp_ep_h ep, size_t act_payload_size,
         uint32_t flags);
     Request *make_request(size_t act_payload_size);
+    ucp_mem_h payload_memh(size_t act_payload_size) const;
     static void cleanup_request(Request *req, UCPInternal *internal);
     static bool send_request(Request *req, unsigned am_id);
     static void am_local_failure_handler(Request *req, UCPInternal *internal);
@@ -0,0 +1,211 @@
+/* Copyright 2024 Stanford University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Micro-benchmark comparing point-wise accessor operations against the
+// aligned_ptr accessor method for a simple 1-D stencil sweep. With
+// bounds checks disabled both variants should be auto-vectorized by the
+// compiler; the aligned_ptr variant additionally promises alignment and
+// no aliasing so it should never be slower than the hand-extracted
+// raw-pointer loops that applications used to write by hand.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "legion.h"
+
+using namespace Legion;
+
+Logger log_bench("accessor_vectorization");
+
+enum TaskIDs
+{
+  TID_MAIN = 100,
+  TID_INIT = 101,
+  TID_STENCIL_POINTS = 102,
+  TID_STENCIL_ALIGNED = 103,
+};
+
+enum FIDs
+{
+  FID_IN = 100,
+  FID_OUT = 101,
+};
+
+struct BenchArgs
+{
+  size_t num_elements;
+  unsigned num_iterations;
+};
+
+void init_task(const Task *task,
+               const std::vector<PhysicalRegion> &regions,
+               Context ctx, Runtime *runtime)
+{
+  const FieldAccessor<LEGION_WRITE_DISCARD,double,1,coord_t,
+    Realm::AffineAccessor<double,1,coord_t> > acc_in(regions[0], FID_IN);
+  const FieldAccessor<LEGION_WRITE_DISCARD,double,1,coord_t,
+    Realm::AffineAccessor<double,1,coord_t> > acc_out(regions[0], FID_OUT);
+  const Rect<1> bounds = runtime->get_index_space_domain(ctx,
+      task->regions[0].region.get_index_space());
+  for (PointInRectIterator<1> pir(bounds); pir(); pir++)
+  {
+    acc_in[*pir] = drand48();
+    acc_out[*pir] = 0.0;
+  }
+}
+
+double stencil_points_task(const Task *task,
+                           const std::vector<PhysicalRegion> &regions,
+                           Context ctx, Runtime *runtime)
+{
+  const BenchArgs *args = (const BenchArgs*)task->args;
+  const FieldAccessor<LEGION_READ_ONLY,double,1,coord_t,
+    Realm::AffineAccessor<double,1,coord_t> > acc_in(regions[0], FID_IN);
+  const FieldAccessor<LEGION_READ_WRITE,double,1,coord_t,
+    Realm::AffineAccessor<double,1,coord_t> > acc_out(regions[0], FID_OUT);
+  const Rect<1> bounds = runtime->get_index_space_domain(ctx,
+      task->regions[0].region.get_index_space());
+  const long long start = Realm::Clock::current_time_in_nanoseconds();
+  for (unsigned iter = 0; iter < args->num_iterations; iter++)
+  {
+    for (coord_t i = bounds.lo[0] + 1; i < bounds.hi[0]; i++)
+      acc_out[i] = 0.25 * acc_in[i-1] + 0.5 * acc_in[i] + 0.25 * acc_in[i+1];
+  }
+  const long long stop = Realm::Clock::current_time_in_nanoseconds();
+  return 1e-9 * (stop - start);
+}
+
+double stencil_aligned_task(const Task *task,
+                            const std::vector<PhysicalRegion> &regions,
+                            Context ctx, Runtime *runtime)
+{
+  const BenchArgs *args = (const BenchArgs*)task->args;
+  const FieldAccessor<LEGION_READ_ONLY,double,1,coord_t,
+    Realm::AffineAccessor<double,1,coord_t> > acc_in(regions[0], FID_IN);
+  const FieldAccessor<LEGION_READ_WRITE,double,1,coord_t,
+    Realm::AffineAccessor<double,1,coord_t> > acc_out(regions[0], FID_OUT);
+  const Rect<1> bounds = runtime->get_index_space_domain(ctx,
+      task->regions[0].region.get_index_space());
+  const size_t volume = bounds.volume();
+  const double *LEGION_RESTRICT in =
+    acc_in.aligned_ptr<alignof(double)>(bounds);
+  double *LEGION_RESTRICT out = acc_out.aligned_ptr<alignof(double)>(bounds);
+  const long long start = Realm::Clock::current_time_in_nanoseconds();
+  for (unsigned iter = 0; iter < args->num_iterations; iter++)
+  {
+    for (size_t i = 1; i < (volume - 1); i++)
+      out[i] = 0.25 * in[i-1] + 0.5 * in[i] + 0.25 * in[i+1];
+  }
+  const long long stop = Realm::Clock::current_time_in_nanoseconds();
+  return 1e-9 * (stop - start);
+}
+
+void main_task(const Task *task,
+               const std::vector<PhysicalRegion> &regions,
+               Context ctx, Runtime *runtime)
+{
+  BenchArgs args;
+  args.num_elements = 1 << 24;
+  args.num_iterations = 32;
+  {
+    const InputArgs &command_args = Runtime::get_input_args();
+    for (int i = 1; i < command_args.argc; i++)
+    {
+      if (strcmp(command_args.argv[i], "-n") == 0)
+        args.num_elements = atoll(command_args.argv[++i]);
+      else if (strcmp(command_args.argv[i], "-i") == 0)
+        args.num_iterations = atoi(command_args.argv[++i]);
+    }
+  }
+  IndexSpace is = runtime->create_index_space(ctx,
+      Rect<1>(0, args.num_elements - 1));
+  FieldSpace fs = runtime->create_field_space(ctx);
+  {
+    FieldAllocator allocator = runtime->create_field_allocator(ctx, fs);
+    allocator.allocate_field(sizeof(double), FID_IN);
+    allocator.allocate_field(sizeof(double), FID_OUT);
+  }
+  LogicalRegion lr = runtime->create_logical_region(ctx, is, fs);
+  {
+    TaskLauncher init(TID_INIT, UntypedBuffer());
+    init.add_region_requirement(
+        RegionRequirement(lr, LEGION_WRITE_DISCARD, LEGION_EXCLUSIVE, lr));
+    init.add_field(0, FID_IN);
+    init.add_field(0, FID_OUT);
+    runtime->execute_task(ctx, init).wait();
+  }
+  Future points_time, aligned_time;
+  {
+    TaskLauncher stencil(TID_STENCIL_POINTS,
+        UntypedBuffer(&args, sizeof(args)));
+    stencil.add_region_requirement(
+        RegionRequirement(lr, LEGION_READ_WRITE, LEGION_EXCLUSIVE, lr));
+    stencil.add_field(0, FID_IN);
+    stencil.add_field(0, FID_OUT);
+    points_time = runtime->execute_task(ctx, stencil);
+  }
+  {
+    TaskLauncher stencil(TID_STENCIL_ALIGNED,
+        UntypedBuffer(&args, sizeof(args)));
+    stencil.add_region_requirement(
+        RegionRequirement(lr, LEGION_READ_WRITE, LEGION_EXCLUSIVE, lr));
+    stencil.add_field(0, FID_IN);
+    stencil.add_field(0, FID_OUT);
+    aligned_time = runtime->execute_task(ctx, stencil);
+  }
+  const double points = points_time.get_result<double>();
+  const double aligned = aligned_time.get_result<double>();
+  const double updates = double(args.num_elements) * args.num_iterations;
+  log_bench.print("point-wise accessors: %.3f s (%.2f Gupdates/s)",
+                  points, 1e-9 * updates / points);
+  log_bench.print("aligned_ptr accessors: %.3f s (%.2f Gupdates/s)",
+                  aligned, 1e-9 * updates / aligned);
+  log_bench.print("speedup: %.2fx", points / aligned);
+  runtime->destroy_logical_region(ctx, lr);
+  runtime->destroy_field_space(ctx, fs);
+  runtime->destroy_index_space(ctx, is);
+}
+
+int main(int argc, char **argv)
+{
+  Runtime::set_top_level_task_id(TID_MAIN);
+  {
+    TaskVariantRegistrar registrar(TID_MAIN, "main");
+    registrar.add_constraint(ProcessorConstraint(Processor::LOC_PROC));
+    Runtime::preregister_task_variant<main_task>(registrar, "main");
+  }
+  {
+    TaskVariantRegistrar registrar(TID_INIT, "init");
+    registrar.add_constraint(ProcessorConstraint(Processor::LOC_PROC));
+    registrar.set_leaf();
+    Runtime::preregister_task_variant<init_task>(registrar, "init");
+  }
+  {
+    TaskVariantRegistrar registrar(TID_STENCIL_POINTS, "stencil_points");
+    registrar.add_constraint(ProcessorConstraint(Processor::LOC_PROC));
+    registrar.set_leaf();
+    Runtime::preregister_task_variant<double,stencil_points_task>(registrar,
+        "stencil_points");
+  }
+  {
+    TaskVariantRegistrar registrar(TID_STENCIL_ALIGNED, "stencil_aligned");
+    registrar.add_constraint(ProcessorConstraint(Processor::LOC_PROC));
+    registrar.set_leaf();
+    Runtime::preregister_task_variant<double,stencil_aligned_task>(registrar,
+        "stencil_aligned");
+  }
+  return Runtime::start(argc, argv);
+}
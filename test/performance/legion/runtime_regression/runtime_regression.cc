@@ -0,0 +1,238 @@
+/* Copyright 2024 Stanford University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runtime regression harness: exercises the runtime-internal paths whose
+// performance we want to track across commits (dynamic analysis for index
+// launches, dependent partitioning, and physical trace capture/replay) and
+// emits the results as machine-readable baselines on stdout.  Each metric
+// is printed on its own line of the form
+//   RUNTIME_REGRESSION {"metric": <name>, "value": <value>, "unit": <unit>}
+// followed by a single RUNTIME_REGRESSION_BASELINE line carrying all of the
+// metrics as one JSON object, which is what perf.py's regex measurements
+// and bisection scripts should key off of.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include "legion.h"
+
+using namespace Legion;
+
+enum TaskIDs
+{
+  TID_TOP_LEVEL = 1,
+  TID_LEAF = 2,
+};
+
+enum FieldIDs
+{
+  FID_DATA = 1,
+};
+
+static std::map<std::string,double> baseline;
+
+static void report_metric(const char *metric, double value, const char *unit)
+{
+  printf("RUNTIME_REGRESSION {\"metric\": \"%s\", \"value\": %.3f, "
+         "\"unit\": \"%s\"}\n", metric, value, unit);
+  baseline[metric] = value;
+}
+
+static void report_baseline(void)
+{
+  printf("RUNTIME_REGRESSION_BASELINE {");
+  bool first = true;
+  for (std::map<std::string,double>::const_iterator it =
+        baseline.begin(); it != baseline.end(); it++)
+  {
+    printf("%s\"%s\": %.3f", first ? "" : ", ", it->first.c_str(),
+           it->second);
+    first = false;
+  }
+  printf("}\n");
+}
+
+static double current_time_in_seconds(void)
+{
+  return 1e-9 * Realm::Clock::current_time_in_nanoseconds();
+}
+
+void leaf_task(const Task *task,
+               const std::vector<PhysicalRegion> &regions,
+               Context ctx, Runtime *runtime)
+{
+  // Intentionally empty: we are measuring the runtime, not the tasks
+}
+
+void top_level_task(const Task *task,
+                    const std::vector<PhysicalRegion> &regions,
+                    Context ctx, Runtime *runtime)
+{
+  // How many index launches to issue in the launch storm
+  int num_launches = 256;
+  // How many points in each index launch
+  int num_points = 1024;
+  // How many partitions to make in the deppart stress phase
+  int num_partition_iterations = 32;
+  // How many times to replay the trace after capturing it
+  int num_trace_iterations = 32;
+  {
+    const InputArgs &command_args = Runtime::get_input_args();
+    for (int i = 1; i < command_args.argc; i++)
+    {
+      if (strcmp(command_args.argv[i], "-launches") == 0)
+        num_launches = atoi(command_args.argv[++i]);
+      else if (strcmp(command_args.argv[i], "-points") == 0)
+        num_points = atoi(command_args.argv[++i]);
+      else if (strcmp(command_args.argv[i], "-piters") == 0)
+        num_partition_iterations = atoi(command_args.argv[++i]);
+      else if (strcmp(command_args.argv[i], "-titers") == 0)
+        num_trace_iterations = atoi(command_args.argv[++i]);
+    }
+  }
+
+  const Rect<1> launch_bounds(0, num_points - 1);
+  const IndexSpace launch_space = runtime->create_index_space(ctx,
+      Domain(launch_bounds));
+
+  // Phase 1: index launch storm
+  // Measures the per-launch cost of the dynamic dependence analysis and
+  // slicing paths with no region requirements involved
+  {
+    // Warm up the mapper and any runtime caches first
+    IndexTaskLauncher launcher(TID_LEAF, launch_space,
+                               UntypedBuffer(), ArgumentMap());
+    runtime->execute_index_space(ctx, launcher).wait_all_results();
+    const double start = current_time_in_seconds();
+    for (int i = 0; i < num_launches; i++)
+    {
+      IndexTaskLauncher storm(TID_LEAF, launch_space,
+                              UntypedBuffer(), ArgumentMap());
+      runtime->execute_index_space(ctx, storm);
+    }
+    runtime->issue_execution_fence(ctx).wait();
+    const double elapsed = current_time_in_seconds() - start;
+    report_metric("index_launch_rate", num_launches / elapsed,
+                  "launches_per_second");
+    report_metric("index_launch_time", 1e6 * elapsed / num_launches,
+                  "microseconds_per_launch");
+  }
+
+  // Phase 2: dependent partitioning stress
+  // The Legion-level analogue of the realm deppart stress test: repeatedly
+  // compute and tear down equal partitions so we track the cost of the
+  // partitioning operation pipeline
+  const Rect<1> elem_bounds(0, (64 * num_points) - 1);
+  const IndexSpace elem_space = runtime->create_index_space(ctx,
+      Domain(elem_bounds));
+  {
+    const double start = current_time_in_seconds();
+    for (int i = 0; i < num_partition_iterations; i++)
+    {
+      IndexPartition ip = runtime->create_equal_partition(ctx, elem_space,
+                                                          launch_space);
+      // Force the subspaces to actually be instantiated
+      for (int p = 0; p < num_points; p++)
+        runtime->get_index_subspace(ctx, ip, DomainPoint(Point<1>(p)));
+      runtime->destroy_index_partition(ctx, ip);
+    }
+    runtime->issue_execution_fence(ctx).wait();
+    const double elapsed = current_time_in_seconds() - start;
+    report_metric("equal_partition_time",
+                  1e3 * elapsed / num_partition_iterations,
+                  "milliseconds_per_partition");
+  }
+
+  // Phase 3: trace capture and replay loop
+  // Launches the same traced index task repeatedly so we can separate the
+  // one-time capture cost from the steady-state replay cost per launch
+  {
+    const FieldSpace fs = runtime->create_field_space(ctx);
+    {
+      FieldAllocator allocator = runtime->create_field_allocator(ctx, fs);
+      allocator.allocate_field(sizeof(double), FID_DATA);
+    }
+    const LogicalRegion lr =
+      runtime->create_logical_region(ctx, elem_space, fs);
+    const IndexPartition ip = runtime->create_equal_partition(ctx, elem_space,
+                                                              launch_space);
+    const LogicalPartition lp = runtime->get_logical_partition(ctx, lr, ip);
+    runtime->fill_field<double>(ctx, lr, lr, FID_DATA, 0.0);
+
+    const TraceID tid = runtime->generate_dynamic_trace_id();
+    IndexTaskLauncher launcher(TID_LEAF, launch_space,
+                               UntypedBuffer(), ArgumentMap());
+    launcher.add_region_requirement(
+        RegionRequirement(lp, 0/*projection*/, LEGION_READ_WRITE,
+                          LEGION_EXCLUSIVE, lr));
+    launcher.add_field(0, FID_DATA);
+
+    // First iteration captures the trace
+    double start = current_time_in_seconds();
+    runtime->begin_trace(ctx, tid);
+    runtime->execute_index_space(ctx, launcher);
+    runtime->end_trace(ctx, tid);
+    runtime->issue_execution_fence(ctx).wait();
+    const double capture_time = current_time_in_seconds() - start;
+    report_metric("trace_capture_time", 1e3 * capture_time,
+                  "milliseconds");
+
+    // The remaining iterations replay it
+    start = current_time_in_seconds();
+    for (int i = 0; i < num_trace_iterations; i++)
+    {
+      runtime->begin_trace(ctx, tid);
+      runtime->execute_index_space(ctx, launcher);
+      runtime->end_trace(ctx, tid);
+    }
+    runtime->issue_execution_fence(ctx).wait();
+    const double elapsed = current_time_in_seconds() - start;
+    report_metric("trace_replay_time",
+                  1e6 * elapsed / num_trace_iterations,
+                  "microseconds_per_replay");
+    report_metric("trace_replay_rate",
+                  (double(num_trace_iterations) * num_points) / elapsed,
+                  "tasks_per_second");
+
+    runtime->destroy_logical_region(ctx, lr);
+    runtime->destroy_field_space(ctx, fs);
+    runtime->destroy_index_partition(ctx, ip);
+  }
+
+  runtime->destroy_index_space(ctx, elem_space);
+  runtime->destroy_index_space(ctx, launch_space);
+  report_baseline();
+}
+
+int main(int argc, char **argv)
+{
+  Runtime::set_top_level_task_id(TID_TOP_LEVEL);
+  {
+    TaskVariantRegistrar registrar(TID_TOP_LEVEL, "top_level");
+    registrar.add_constraint(ProcessorConstraint(Processor::LOC_PROC));
+    registrar.set_replicable();
+    Runtime::preregister_task_variant<top_level_task>(registrar, "top_level");
+  }
+  {
+    TaskVariantRegistrar registrar(TID_LEAF, "leaf");
+    registrar.add_constraint(ProcessorConstraint(Processor::LOC_PROC));
+    registrar.set_leaf();
+    Runtime::preregister_task_variant<leaf_task>(registrar, "leaf");
+  }
+  return Runtime::start(argc, argv);
+}
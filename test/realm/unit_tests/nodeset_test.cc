@@ -444,6 +444,21 @@ TEST_P(NodeSetCopyAndIteratorTest, IterateNode)
   }
 }
 
+TEST_P(NodeSetCopyAndIteratorTest, IterateRanges)
+{
+  std::set<NodeID> seen;
+  for(NodeSetRangeIterator it = nodeset.ranges_begin(); it != nodeset.ranges_end();
+      it++) {
+    EXPECT_LE(it.range_lo(), it.range_hi());
+    for(NodeID node = it.range_lo(); node <= it.range_hi(); node++) {
+      EXPECT_TRUE(verification_nodes.count(node) > 0);
+      // each node must be yielded exactly once across all ranges
+      EXPECT_TRUE(seen.insert(node).second);
+    }
+  }
+  EXPECT_EQ(seen.size(), verification_nodes.size());
+}
+
 INSTANTIATE_TEST_SUITE_P(NodeSetCopyAndIterator, NodeSetCopyAndIteratorTest,
                          ::testing::Values(
                              NodeSetCopyAndIteratorTestParam{
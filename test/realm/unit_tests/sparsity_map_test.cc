@@ -97,30 +97,34 @@ public:
   }
 
   void send_contribute(SparsityMap<N, T> me, size_t piece_count, size_t total_count,
-                       bool disjoint, const void *data, size_t datalen) override
+                       bool disjoint, const void *data, size_t datalen,
+                       bool compressed) override
   {
     send_contribute(NodeID(ID(me).sparsity_creator_node()), me, piece_count, total_count,
-                    disjoint, data, datalen);
+                    disjoint, data, datalen, compressed);
   }
 
   void send_contribute(NodeID target, SparsityMap<N, T> me, size_t piece_count,
                        size_t total_count, bool disjoint, const void *data,
-                       size_t datalen) override
+                       size_t datalen, bool compressed) override
   {
     sent_contributions++;
     sent_piece_count += piece_count;
     sent_bytes += datalen;
+    sent_compressed += (compressed ? 1 : 0);
   }
 
   size_t recommend_max_payload(NodeID owner, bool with_congestion) override
   {
-    return sizeof(Rect<N, T>);
+    return max_payload;
   }
 
   int sent_requests = 0;
   int sent_contributions = 0;
   size_t sent_piece_count = 0;
   size_t sent_bytes = 0;
+  int sent_compressed = 0;
+  size_t max_payload = sizeof(Rect<N, T>);
 };
 
 template <int N, typename T>
@@ -205,6 +209,32 @@ TEST(SparsityMapImplTest, ContributeDenseRectListRemote)
   ASSERT_EQ(sparsity_comm->sent_bytes, num_rects * sizeof(T) * N * 2);
 }
 
+TEST(SparsityMapImplTest, ContributeDenseRectListRemoteCompressed)
+{
+  using T = long long;
+  constexpr int N = 2;
+  constexpr int num_rects = 4, gap = 3;
+  NodeSet subscribers;
+  MockSparsityMapCommunicator<N, T> *sparsity_comm =
+      new MockSparsityMapCommunicator<N, T>();
+  // let all the rects fit in one piece so the deltas can be encoded
+  sparsity_comm->max_payload = num_rects * sizeof(Rect<N, T>);
+  std::vector<Rect<N, T>> rect_list = create_rects<N, T>(num_rects, gap);
+  SparsityMap<N, T> handle = (ID::make_sparsity(1, 1, 0)).convert<SparsityMap<N, T>>();
+  std::unique_ptr<SparsityMapImpl<N, T>> impl =
+      std::make_unique<SparsityMapImpl<N, T>>(handle, subscribers, sparsity_comm);
+
+  impl->contribute_dense_rect_list(rect_list,
+                                   /*disjoint=*/false);
+
+  // 64-bit coordinates with small deltas should go out compressed - one
+  //  full-precision rect plus 32-bit deltas for each of the others
+  ASSERT_EQ(sparsity_comm->sent_contributions, 1);
+  ASSERT_EQ(sparsity_comm->sent_compressed, 1);
+  ASSERT_EQ(sparsity_comm->sent_bytes,
+            sizeof(Rect<N, T>) + ((num_rects - 1) * N * 2 * sizeof(int32_t)));
+}
+
 TEST(SparsityMapImplTest, RemoteDataReply)
 {
   using T = int;
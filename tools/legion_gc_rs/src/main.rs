@@ -0,0 +1,79 @@
+use std::ffi::OsString;
+use std::io;
+
+use clap::Parser;
+
+use rayon::prelude::*;
+
+use legion_gc::parse;
+use legion_gc::state::State;
+
+#[derive(Debug, Parser)]
+#[command(name = "legion_gc", about = "Legion GC analysis and verification")]
+struct Cli {
+    #[arg(short = 'l', long, help = "check for leaks")]
+    leaks: bool,
+
+    #[arg(short = 'c', long, help = "check for cycles")]
+    cycles: bool,
+
+    #[arg(
+        short = 'a',
+        long = "assert",
+        help = "exit with a nonzero status if any errors were found"
+    )]
+    assert_on_error: bool,
+
+    #[arg(short = 'v', long, help = "verbose output")]
+    verbose: bool,
+
+    #[arg(required = true, help = "input log filenames")]
+    filenames: Vec<OsString>,
+}
+
+fn main() -> io::Result<()> {
+    let cli = Cli::parse();
+
+    // parse the shards in parallel, then fold the records into a single
+    // graph in file order (the analysis in state.rs explains why the
+    // result matches a sequential parse)
+    let shards: Vec<(&OsString, io::Result<(Vec<parse::Record>, u64)>)> = cli
+        .filenames
+        .par_iter()
+        .map(|name| (name, parse::parse_file(name)))
+        .collect();
+
+    let mut state = State::default();
+    let mut has_matches = false;
+    for (name, result) in shards {
+        let (records, unmatched) = result?;
+        println!("Read log file {}: matched {} lines", name.to_string_lossy(), records.len());
+        if unmatched > 0 {
+            println!("  Skipped {} unmatched lines", unmatched);
+        }
+        if !records.is_empty() {
+            has_matches = true;
+        }
+        for record in records {
+            state.apply(record);
+        }
+    }
+    if !has_matches {
+        println!("No matches found! Exiting...");
+        return Ok(());
+    }
+
+    state.post_parse();
+
+    let mut errors = false;
+    if cli.cycles {
+        errors |= state.check_for_cycles();
+    }
+    if cli.leaks {
+        errors |= state.check_for_leaks(cli.verbose);
+    }
+    if errors && cli.assert_on_error {
+        std::process::exit(1);
+    }
+    Ok(())
+}
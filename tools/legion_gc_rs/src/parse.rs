@@ -0,0 +1,343 @@
+use std::fs::File;
+use std::io::{self, BufRead, BufReader};
+use std::path::Path;
+
+use crate::state::RefKind;
+
+/// One matched `legion_gc` log line, reduced to the integer payload the
+/// analysis needs. Shards are parsed into these records in parallel and
+/// then applied to a single `State` in file order.
+#[derive(Debug)]
+pub enum Record {
+    AddBaseRef {
+        kind: RefKind,
+        did: u64,
+        node: u64,
+        src: u32,
+        cnt: u64,
+    },
+    AddNestedRef {
+        kind: RefKind,
+        did: u64,
+        node: u64,
+        src: u64,
+        cnt: u64,
+    },
+    RemoveBaseRef {
+        kind: RefKind,
+        did: u64,
+        node: u64,
+        src: u32,
+        cnt: u64,
+    },
+    RemoveNestedRef {
+        kind: RefKind,
+        did: u64,
+        node: u64,
+        src: u64,
+        cnt: u64,
+    },
+    InstanceManager {
+        did: u64,
+        node: u64,
+        iid: u64,
+    },
+    VirtualManager {
+        did: u64,
+        node: u64,
+    },
+    MaterializedView {
+        did: u64,
+        node: u64,
+        inst: u64,
+    },
+    FillView {
+        did: u64,
+        node: u64,
+    },
+    PhiView {
+        did: u64,
+        node: u64,
+    },
+    ReductionView {
+        did: u64,
+        node: u64,
+        inst: u64,
+    },
+    ReplicatedView {
+        did: u64,
+        node: u64,
+    },
+    AllreduceView {
+        did: u64,
+        node: u64,
+    },
+    EquivalenceSet {
+        did: u64,
+        node: u64,
+    },
+    Future {
+        did: u64,
+        node: u64,
+    },
+    FutureMap {
+        did: u64,
+        node: u64,
+    },
+    Constraints {
+        did: u64,
+        node: u64,
+    },
+    IndexSpace {
+        did: u64,
+        node: u64,
+        handle: u64,
+    },
+    IndexPartition {
+        did: u64,
+        node: u64,
+        handle: u64,
+    },
+    IndexExpression {
+        did: u64,
+        node: u64,
+        handle: u64,
+    },
+    FieldSpace {
+        did: u64,
+        node: u64,
+        handle: u64,
+    },
+    Region {
+        did: u64,
+        node: u64,
+        index_space: u64,
+        field_space: u64,
+        tree_id: u64,
+    },
+    Partition {
+        did: u64,
+        node: u64,
+        index_partition: u64,
+        field_space: u64,
+        tree_id: u64,
+    },
+    InnerContext {
+        did: u64,
+        node: u64,
+    },
+    LeafContext {
+        did: u64,
+        node: u64,
+    },
+    ShardManager {
+        did: u64,
+        node: u64,
+    },
+    SourceKind {
+        kind: u32,
+        name: String,
+    },
+    Deletion {
+        did: u64,
+        node: u64,
+    },
+}
+
+// Parse exactly N whitespace-separated decimal integers (and nothing more).
+fn ints<const N: usize>(s: &str) -> Option<[u64; N]> {
+    let mut out = [0u64; N];
+    let mut it = s.split_ascii_whitespace();
+    for v in out.iter_mut() {
+        *v = it.next()?.parse().ok()?;
+    }
+    if it.next().is_some() {
+        return None;
+    }
+    Some(out)
+}
+
+fn ref_record(s: &str) -> Option<(RefKind, u64, u64, u64, u64)> {
+    let [kind, did, node, src, cnt] = ints::<5>(s)?;
+    Some((RefKind::from_u64(kind)?, did, node, src, cnt))
+}
+
+/// Parse a single log line, returning `None` for lines that belong to
+/// other loggers or that this tool does not understand. The message
+/// formats mirror the regular expressions in `tools/legion_gc.py`; each
+/// line is `[node - tid] {level}{legion_gc}: GC <message>`.
+pub fn parse_line(line: &str) -> Option<Record> {
+    let rest = line.split("{legion_gc}: ").nth(1)?;
+    let rest = rest.trim_end().strip_prefix("GC ")?;
+    // reference count updates dominate the logs, so try them first
+    if let Some(s) = rest.strip_prefix("Add Base Ref ") {
+        let (kind, did, node, src, cnt) = ref_record(s)?;
+        return Some(Record::AddBaseRef {
+            kind,
+            did,
+            node,
+            src: src as u32,
+            cnt,
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Add Nested Ref ") {
+        let (kind, did, node, src, cnt) = ref_record(s)?;
+        return Some(Record::AddNestedRef {
+            kind,
+            did,
+            node,
+            src,
+            cnt,
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Remove Base Ref ") {
+        let (kind, did, node, src, cnt) = ref_record(s)?;
+        return Some(Record::RemoveBaseRef {
+            kind,
+            did,
+            node,
+            src: src as u32,
+            cnt,
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Remove Nested Ref ") {
+        let (kind, did, node, src, cnt) = ref_record(s)?;
+        return Some(Record::RemoveNestedRef {
+            kind,
+            did,
+            node,
+            src,
+            cnt,
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Instance Manager ") {
+        // instance and memory ids are logged in hex
+        let mut it = s.split_ascii_whitespace();
+        let did = it.next()?.parse().ok()?;
+        let node = it.next()?.parse().ok()?;
+        let iid = u64::from_str_radix(it.next()?, 16).ok()?;
+        let _mem = u64::from_str_radix(it.next()?, 16).ok()?;
+        return Some(Record::InstanceManager { did, node, iid });
+    }
+    if let Some(s) = rest.strip_prefix("Virtual Manager ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::VirtualManager { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Materialized View ") {
+        let [did, node, inst] = ints::<3>(s)?;
+        return Some(Record::MaterializedView { did, node, inst });
+    }
+    if let Some(s) = rest.strip_prefix("Fill View ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::FillView { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Phi View ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::PhiView { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Reduction View ") {
+        let [did, node, inst] = ints::<3>(s)?;
+        return Some(Record::ReductionView { did, node, inst });
+    }
+    if let Some(s) = rest.strip_prefix("Replicated View ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::ReplicatedView { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Allreduce View ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::AllreduceView { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Equivalence Set ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::EquivalenceSet { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Future Map ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::FutureMap { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Future ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::Future { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Constraints ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::Constraints { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Index Space ") {
+        let [did, node, handle] = ints::<3>(s)?;
+        return Some(Record::IndexSpace { did, node, handle });
+    }
+    if let Some(s) = rest.strip_prefix("Index Partition ") {
+        let [did, node, handle] = ints::<3>(s)?;
+        return Some(Record::IndexPartition { did, node, handle });
+    }
+    if let Some(s) = rest.strip_prefix("Index Expr ") {
+        let [did, node, handle] = ints::<3>(s)?;
+        return Some(Record::IndexExpression { did, node, handle });
+    }
+    if let Some(s) = rest.strip_prefix("Field Space ") {
+        let [did, node, handle] = ints::<3>(s)?;
+        return Some(Record::FieldSpace { did, node, handle });
+    }
+    if let Some(s) = rest.strip_prefix("Region ") {
+        let [did, node, index_space, field_space, tree_id] = ints::<5>(s)?;
+        return Some(Record::Region {
+            did,
+            node,
+            index_space,
+            field_space,
+            tree_id,
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Partition ") {
+        let [did, node, index_partition, field_space, tree_id] = ints::<5>(s)?;
+        return Some(Record::Partition {
+            did,
+            node,
+            index_partition,
+            field_space,
+            tree_id,
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Inner Context ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::InnerContext { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Leaf Context ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::LeafContext { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Shard Manager ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::ShardManager { did, node });
+    }
+    if let Some(s) = rest.strip_prefix("Source Kind ") {
+        // the name is free text and may contain spaces
+        let (kind, name) = s.split_once(' ')?;
+        return Some(Record::SourceKind {
+            kind: kind.parse().ok()?,
+            name: name.to_owned(),
+        });
+    }
+    if let Some(s) = rest.strip_prefix("Deletion ") {
+        let [did, node] = ints::<2>(s)?;
+        return Some(Record::Deletion { did, node });
+    }
+    None
+}
+
+/// Parse one log shard, returning the matched records and the number of
+/// lines that did not match any known pattern.
+pub fn parse_file<P: AsRef<Path>>(path: P) -> io::Result<(Vec<Record>, u64)> {
+    let mut records = Vec::new();
+    let mut unmatched = 0;
+    let reader = BufReader::new(File::open(path)?);
+    for line in reader.lines() {
+        let line = line?;
+        match parse_line(&line) {
+            Some(record) => records.push(record),
+            None => unmatched += 1,
+        }
+    }
+    Ok((records, unmatched))
+}
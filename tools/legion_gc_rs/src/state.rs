@@ -0,0 +1,627 @@
+use std::collections::{BTreeMap, HashMap};
+
+use rayon::prelude::*;
+
+use crate::parse::Record;
+
+/// Objects are interned by (did, node) into a flat table; all graph
+/// edges are stored as these indices rather than pointers so the whole
+/// reference graph stays in a handful of dense allocations.
+pub type ObjIdx = u32;
+
+/// The four reference kinds tracked by the runtime's distributed
+/// collectables; values match LEGION_GC_REF_KIND et al. in the logs.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum RefKind {
+    Gc = 0,
+    Valid = 1,
+    Resource = 2,
+    Remote = 3,
+}
+
+pub const NUM_REF_KINDS: usize = 4;
+
+impl RefKind {
+    pub const ALL: [RefKind; NUM_REF_KINDS] =
+        [RefKind::Gc, RefKind::Valid, RefKind::Resource, RefKind::Remote];
+
+    pub fn from_u64(kind: u64) -> Option<RefKind> {
+        match kind {
+            0 => Some(RefKind::Gc),
+            1 => Some(RefKind::Valid),
+            2 => Some(RefKind::Resource),
+            3 => Some(RefKind::Remote),
+            _ => None,
+        }
+    }
+
+    pub fn name(self) -> &'static str {
+        match self {
+            RefKind::Gc => "GC",
+            RefKind::Valid => "Valid",
+            RefKind::Resource => "Resource",
+            RefKind::Remote => "Remote",
+        }
+    }
+}
+
+// reporting order used by the Python tool: GC, Valid, Remote, Resource
+const REPORT_ORDER: [RefKind; NUM_REF_KINDS] =
+    [RefKind::Gc, RefKind::Valid, RefKind::Remote, RefKind::Resource];
+
+/// Net count plus add/remove totals for one reference source.
+#[derive(Debug, Default, Clone, Copy)]
+pub struct Counts {
+    pub refs: i64,
+    pub adds: i64,
+    pub rems: i64,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ViewKind {
+    Materialized,
+    Fill,
+    Phi,
+    Reduction,
+    Replicated,
+    Allreduce,
+}
+
+impl ViewKind {
+    fn name(self) -> &'static str {
+        match self {
+            ViewKind::Materialized => "Materialized",
+            ViewKind::Fill => "Fill",
+            ViewKind::Phi => "Phi",
+            ViewKind::Reduction => "Reduction",
+            ViewKind::Replicated => "Replicated",
+            ViewKind::Allreduce => "Allreduce",
+        }
+    }
+}
+
+/// What kind of distributed collectable an object turned out to be.
+/// Objects referenced before their registration line is seen start out
+/// `Unknown` and are upgraded in place.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ObjKind {
+    Unknown,
+    Manager { iid: u64, virtual_inst: bool },
+    View { kind: ViewKind },
+    Future,
+    FutureMap,
+    EquivalenceSet,
+    Constraints,
+    IndexSpace { handle: u64 },
+    IndexPartition { handle: u64 },
+    IndexExpression { handle: u64 },
+    FieldSpace { handle: u64 },
+    Region { index_space: u64, field_space: u64, tree_id: u64 },
+    Partition { index_partition: u64, field_space: u64, tree_id: u64 },
+    InnerContext,
+    LeafContext,
+    ShardManager,
+}
+
+// order in which categories appear in the leak summary
+const NUM_CATEGORIES: usize = 16;
+const CATEGORY_NAMES: [&str; NUM_CATEGORIES] = [
+    "Futures",
+    "Future Maps",
+    "Constraints",
+    "Managers",
+    "Views",
+    "Equivalence Sets",
+    "Index Spaces",
+    "Index Partitions",
+    "Index Expressions",
+    "Field Spaces",
+    "Regions",
+    "Partitions",
+    "Inner Contexts",
+    "Leaf Contexts",
+    "Shard Managers",
+    "Unknown Objects",
+];
+
+impl ObjKind {
+    fn category(self) -> usize {
+        match self {
+            ObjKind::Future => 0,
+            ObjKind::FutureMap => 1,
+            ObjKind::Constraints => 2,
+            ObjKind::Manager { .. } => 3,
+            ObjKind::View { .. } => 4,
+            ObjKind::EquivalenceSet => 5,
+            ObjKind::IndexSpace { .. } => 6,
+            ObjKind::IndexPartition { .. } => 7,
+            ObjKind::IndexExpression { .. } => 8,
+            ObjKind::FieldSpace { .. } => 9,
+            ObjKind::Region { .. } => 10,
+            ObjKind::Partition { .. } => 11,
+            ObjKind::InnerContext => 12,
+            ObjKind::LeafContext => 13,
+            ObjKind::ShardManager => 14,
+            ObjKind::Unknown => 15,
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct Object {
+    pub did: u64,
+    pub node: u64,
+    pub kind: ObjKind,
+    pub deleted: bool,
+    // base references keyed by source kind id, nested references keyed
+    // by the referring object's index - BTreeMaps keep report output
+    // deterministic and the per-object fan-in is small
+    pub base: [BTreeMap<u32, Counts>; NUM_REF_KINDS],
+    pub nested: [BTreeMap<ObjIdx, Counts>; NUM_REF_KINDS],
+}
+
+impl Object {
+    fn new(did: u64, node: u64) -> Object {
+        Object {
+            did,
+            node,
+            kind: ObjKind::Unknown,
+            deleted: false,
+            base: Default::default(),
+            nested: Default::default(),
+        }
+    }
+
+    pub fn describe(&self) -> String {
+        let tail = format!("{} (Node={})", self.did, self.node);
+        match self.kind {
+            ObjKind::Unknown => format!("Unknown Object {}", tail),
+            ObjKind::Manager { iid, virtual_inst } => {
+                if virtual_inst {
+                    format!("Manager {} Virtual Instance", tail)
+                } else {
+                    format!("Manager {} Individual Instance {:#x}", tail, iid)
+                }
+            }
+            ObjKind::View { kind } => format!("{} View {}", kind.name(), tail),
+            ObjKind::Future => format!("Future {}", tail),
+            ObjKind::FutureMap => format!("Future Map {}", tail),
+            ObjKind::EquivalenceSet => format!("Equivalence Set {}", tail),
+            ObjKind::Constraints => format!("Layout Constraints {}", tail),
+            ObjKind::IndexSpace { handle } => format!("Index Space {} Handle {}", tail, handle),
+            ObjKind::IndexPartition { handle } => {
+                format!("Index Partition {} Handle {}", tail, handle)
+            }
+            ObjKind::IndexExpression { handle } => {
+                format!("Index Expression {} ExprID {}", tail, handle)
+            }
+            ObjKind::FieldSpace { handle } => format!("Field Space {} Handle {}", tail, handle),
+            ObjKind::Region { index_space, field_space, tree_id } => {
+                format!("Region {} ({},{},{})", tail, index_space, field_space, tree_id)
+            }
+            ObjKind::Partition { index_partition, field_space, tree_id } => {
+                format!("Partition {} ({},{},{})", tail, index_partition, field_space, tree_id)
+            }
+            ObjKind::InnerContext => format!("Inner Context {}", tail),
+            ObjKind::LeafContext => format!("Leaf Context {}", tail),
+            ObjKind::ShardManager => format!("Shard Manager {}", tail),
+        }
+    }
+}
+
+#[derive(Debug, Default)]
+pub struct State {
+    pub objects: Vec<Object>,
+    index: HashMap<(u64, u64), ObjIdx>,
+    pub src_names: HashMap<u32, String>,
+}
+
+impl State {
+    fn intern(&mut self, did: u64, node: u64) -> ObjIdx {
+        if let Some(&idx) = self.index.get(&(did, node)) {
+            return idx;
+        }
+        let idx = self.objects.len() as ObjIdx;
+        self.objects.push(Object::new(did, node));
+        self.index.insert((did, node), idx);
+        idx
+    }
+
+    fn set_kind(&mut self, did: u64, node: u64, kind: ObjKind) -> ObjIdx {
+        let idx = self.intern(did, node);
+        let obj = &mut self.objects[idx as usize];
+        if obj.kind == ObjKind::Unknown {
+            obj.kind = kind;
+        }
+        idx
+    }
+
+    /// Fold one shard's records into the graph. Reference count updates
+    /// commute and registrations are idempotent, so applying the shards
+    /// in file order matches the sequential Python tool exactly.
+    pub fn apply(&mut self, record: Record) {
+        match record {
+            Record::AddBaseRef { kind, did, node, src, cnt } => {
+                let idx = self.intern(did, node);
+                let c = self.objects[idx as usize].base[kind as usize]
+                    .entry(src)
+                    .or_default();
+                c.refs += cnt as i64;
+                c.adds += cnt as i64;
+            }
+            Record::AddNestedRef { kind, did, node, src, cnt } => {
+                // nested sources are dids of objects on the same node
+                let src_idx = self.intern(src, node);
+                let idx = self.intern(did, node);
+                let c = self.objects[idx as usize].nested[kind as usize]
+                    .entry(src_idx)
+                    .or_default();
+                c.refs += cnt as i64;
+                c.adds += cnt as i64;
+            }
+            Record::RemoveBaseRef { kind, did, node, src, cnt } => {
+                let idx = self.intern(did, node);
+                let c = self.objects[idx as usize].base[kind as usize]
+                    .entry(src)
+                    .or_default();
+                c.refs -= cnt as i64;
+                c.rems += cnt as i64;
+            }
+            Record::RemoveNestedRef { kind, did, node, src, cnt } => {
+                let src_idx = self.intern(src, node);
+                let idx = self.intern(did, node);
+                let c = self.objects[idx as usize].nested[kind as usize]
+                    .entry(src_idx)
+                    .or_default();
+                c.refs -= cnt as i64;
+                c.rems += cnt as i64;
+            }
+            Record::InstanceManager { did, node, iid } => {
+                self.set_kind(did, node, ObjKind::Manager { iid, virtual_inst: false });
+            }
+            Record::VirtualManager { did, node } => {
+                self.set_kind(did, node, ObjKind::Manager { iid: 0, virtual_inst: true });
+            }
+            Record::MaterializedView { did, node, inst } => {
+                // the instance field names the manager's did
+                self.set_kind(inst, node, ObjKind::Manager { iid: 0, virtual_inst: false });
+                self.set_kind(did, node, ObjKind::View { kind: ViewKind::Materialized });
+            }
+            Record::FillView { did, node } => {
+                self.set_kind(did, node, ObjKind::View { kind: ViewKind::Fill });
+            }
+            Record::PhiView { did, node } => {
+                self.set_kind(did, node, ObjKind::View { kind: ViewKind::Phi });
+            }
+            Record::ReductionView { did, node, inst } => {
+                self.set_kind(inst, node, ObjKind::Manager { iid: 0, virtual_inst: false });
+                self.set_kind(did, node, ObjKind::View { kind: ViewKind::Reduction });
+            }
+            Record::ReplicatedView { did, node } => {
+                self.set_kind(did, node, ObjKind::View { kind: ViewKind::Replicated });
+            }
+            Record::AllreduceView { did, node } => {
+                self.set_kind(did, node, ObjKind::View { kind: ViewKind::Allreduce });
+            }
+            Record::EquivalenceSet { did, node } => {
+                self.set_kind(did, node, ObjKind::EquivalenceSet);
+            }
+            Record::Future { did, node } => {
+                self.set_kind(did, node, ObjKind::Future);
+            }
+            Record::FutureMap { did, node } => {
+                self.set_kind(did, node, ObjKind::FutureMap);
+            }
+            Record::Constraints { did, node } => {
+                self.set_kind(did, node, ObjKind::Constraints);
+            }
+            Record::IndexSpace { did, node, handle } => {
+                self.set_kind(did, node, ObjKind::IndexSpace { handle });
+            }
+            Record::IndexPartition { did, node, handle } => {
+                self.set_kind(did, node, ObjKind::IndexPartition { handle });
+            }
+            Record::IndexExpression { did, node, handle } => {
+                self.set_kind(did, node, ObjKind::IndexExpression { handle });
+            }
+            Record::FieldSpace { did, node, handle } => {
+                self.set_kind(did, node, ObjKind::FieldSpace { handle });
+            }
+            Record::Region { did, node, index_space, field_space, tree_id } => {
+                self.set_kind(did, node, ObjKind::Region { index_space, field_space, tree_id });
+            }
+            Record::Partition { did, node, index_partition, field_space, tree_id } => {
+                self.set_kind(
+                    did,
+                    node,
+                    ObjKind::Partition { index_partition, field_space, tree_id },
+                );
+            }
+            Record::InnerContext { did, node } => {
+                self.set_kind(did, node, ObjKind::InnerContext);
+            }
+            Record::LeafContext { did, node } => {
+                self.set_kind(did, node, ObjKind::LeafContext);
+            }
+            Record::ShardManager { did, node } => {
+                self.set_kind(did, node, ObjKind::ShardManager);
+            }
+            Record::SourceKind { kind, name } => {
+                self.src_names.entry(kind).or_insert(name);
+            }
+            Record::Deletion { did, node } => {
+                let idx = self.intern(did, node);
+                self.objects[idx as usize].deleted = true;
+            }
+        }
+    }
+
+    /// Warn about objects that were referenced but never registered
+    /// (did 0 is the virtual instance and is expected to be unknown).
+    pub fn post_parse(&self) {
+        let unknowns: Vec<&Object> = self
+            .objects
+            .iter()
+            .filter(|obj| obj.kind == ObjKind::Unknown && obj.did != 0)
+            .collect();
+        if !unknowns.is_empty() {
+            println!("WARNING: Found {} unknown objects!", unknowns.len());
+            for obj in unknowns {
+                println!("  Unknown DID {:#x} on node {}", obj.did, obj.node);
+            }
+        }
+    }
+
+    fn src_name(&self, src: u32) -> String {
+        match self.src_names.get(&src) {
+            Some(name) => name.clone(),
+            None => format!("Source Kind {}", src),
+        }
+    }
+
+    fn report_references(
+        &self,
+        idx: ObjIdx,
+        kind: RefKind,
+        depth: usize,
+        verbose: bool,
+        stack: &mut Vec<ObjIdx>,
+    ) {
+        let obj = &self.objects[idx as usize];
+        let pad = "  ".repeat(depth);
+        for (&src, c) in &obj.base[kind as usize] {
+            if c.refs == 0 {
+                if verbose {
+                    println!(
+                        "{}Empty (Refs=0): Base {} {} (Adds={},Rems={})",
+                        pad,
+                        kind.name(),
+                        self.src_name(src),
+                        c.adds,
+                        c.rems
+                    );
+                }
+            } else if verbose {
+                println!(
+                    "{}NON-EMPTY (Refs={}): Base {} {} (Adds={},Rems={})",
+                    pad,
+                    c.refs,
+                    kind.name(),
+                    self.src_name(src),
+                    c.adds,
+                    c.rems
+                );
+            } else {
+                println!("{}Base {} {} (Refs={})", pad, kind.name(), self.src_name(src), c.refs);
+            }
+        }
+        for (&src, c) in &obj.nested[kind as usize] {
+            let desc = self.objects[src as usize].describe();
+            if c.refs == 0 {
+                if verbose {
+                    println!(
+                        "{}Empty (Refs=0): Nested {} {} (Adds={},Rems={})",
+                        pad,
+                        kind.name(),
+                        desc,
+                        c.adds,
+                        c.rems
+                    );
+                }
+                continue;
+            }
+            if verbose {
+                println!(
+                    "{}NON-EMPTY (Refs={}): Nested {} {} (Adds={},Rems={})",
+                    pad,
+                    c.refs,
+                    kind.name(),
+                    desc,
+                    c.adds,
+                    c.rems
+                );
+            } else {
+                println!("{}Nested {} {} (Refs={})", pad, kind.name(), desc, c.refs);
+            }
+            // unlike the Python tool, guard the recursion so a cyclic
+            // leak does not hang the report
+            if stack.contains(&src) {
+                println!("{}  ... (already shown above)", pad);
+                continue;
+            }
+            stack.push(src);
+            self.report_references(src, kind, depth + 2, verbose, stack);
+            stack.pop();
+        }
+    }
+
+    fn report_all_references(&self, idx: ObjIdx, verbose: bool) {
+        let mut stack = vec![idx];
+        for kind in REPORT_ORDER {
+            self.report_references(idx, kind, 1, verbose, &mut stack);
+        }
+    }
+
+    /// Check that every registered collectable was deleted, reporting
+    /// the outstanding references of any that leaked. Returns true if
+    /// anything (other than user-pinned instances) leaked.
+    pub fn check_for_leaks(&self, verbose: bool) -> bool {
+        // instances the user pinned with a never-gc reference are
+        // reported separately rather than as errors
+        let never_gc_src: Option<u32> = self
+            .src_names
+            .iter()
+            .find(|(_, name)| name.as_str() == "Never GC Reference")
+            .map(|(&kind, _)| kind);
+        let mut order: Vec<ObjIdx> = (0..self.objects.len() as ObjIdx).collect();
+        order.sort_by_key(|&idx| {
+            let obj = &self.objects[idx as usize];
+            (obj.kind.category(), obj.node, obj.did)
+        });
+        let mut leaked = [0u64; NUM_CATEGORIES];
+        let mut pinned_managers = 0u64;
+        for idx in order {
+            let obj = &self.objects[idx as usize];
+            if obj.kind == ObjKind::Unknown {
+                continue; // already warned about in post_parse
+            }
+            if obj.deleted {
+                if verbose {
+                    println!("----------------------------------------------------------------");
+                    println!("{} was properly deleted", obj.describe());
+                    self.report_all_references(idx, verbose);
+                    println!("----------------------------------------------------------------");
+                } else {
+                    println!("{} was properly deleted", obj.describe());
+                }
+                continue;
+            }
+            if let ObjKind::Manager { .. } = obj.kind {
+                let is_pinned = match never_gc_src {
+                    Some(src) => obj.base[RefKind::Valid as usize].contains_key(&src),
+                    None => false,
+                };
+                if is_pinned {
+                    if verbose {
+                        println!(
+                            "----------------------------------------------------------------"
+                        );
+                        println!(
+                            "INFO: {} was not deleted because it was pinned by the user",
+                            obj.describe()
+                        );
+                        self.report_all_references(idx, verbose);
+                        println!(
+                            "----------------------------------------------------------------"
+                        );
+                    } else {
+                        println!(
+                            "INFO: {} was not deleted because it was pinned by the user",
+                            obj.describe()
+                        );
+                    }
+                    pinned_managers += 1;
+                    continue;
+                }
+            }
+            println!("----------------------------------------------------------------");
+            println!("ERROR: {} was not properly deleted", obj.describe());
+            self.report_all_references(idx, verbose);
+            println!("----------------------------------------------------------------");
+            leaked[obj.kind.category()] += 1;
+        }
+        println!("LEAK SUMMARY");
+        let mut any_leaked = false;
+        for (category, name) in CATEGORY_NAMES.iter().enumerate() {
+            if category == ObjKind::Unknown.category() {
+                continue;
+            }
+            if leaked[category] > 0 {
+                println!("  LEAKED {}: {}", name.to_uppercase(), leaked[category]);
+                any_leaked = true;
+            } else {
+                println!("  Leaked {}: {}", name, leaked[category]);
+            }
+        }
+        if pinned_managers > 0 {
+            println!("  PINNED MANAGERS: {}", pinned_managers);
+        } else {
+            println!("  Pinned Managers: {}", pinned_managers);
+        }
+        any_leaked
+    }
+
+    // Iterative three-color search for a cycle among the nonzero nested
+    // references of one kind; visits each edge at most once.
+    fn find_cycle(&self, kind: RefKind) -> Option<Vec<ObjIdx>> {
+        struct Frame {
+            idx: ObjIdx,
+            children: Vec<ObjIdx>,
+            pos: usize,
+        }
+        let frame = |idx: ObjIdx| Frame {
+            idx,
+            children: self.objects[idx as usize].nested[kind as usize]
+                .iter()
+                .filter(|(_, c)| c.refs != 0)
+                .map(|(&src, _)| src)
+                .collect(),
+            pos: 0,
+        };
+        const WHITE: u8 = 0;
+        const GRAY: u8 = 1;
+        const BLACK: u8 = 2;
+        let mut color = vec![WHITE; self.objects.len()];
+        for root in 0..self.objects.len() as ObjIdx {
+            if color[root as usize] != WHITE {
+                continue;
+            }
+            color[root as usize] = GRAY;
+            let mut stack = vec![frame(root)];
+            while let Some(top) = stack.last_mut() {
+                if top.pos < top.children.len() {
+                    let child = top.children[top.pos];
+                    top.pos += 1;
+                    match color[child as usize] {
+                        WHITE => {
+                            color[child as usize] = GRAY;
+                            stack.push(frame(child));
+                        }
+                        GRAY => {
+                            // a gray child is on the stack - the cycle
+                            // runs from its frame to the top
+                            let start = stack.iter().position(|f| f.idx == child).unwrap();
+                            return Some(stack[start..].iter().map(|f| f.idx).collect());
+                        }
+                        _ => {} // black - already fully explored
+                    }
+                } else {
+                    color[top.idx as usize] = BLACK;
+                    stack.pop();
+                }
+            }
+        }
+        None
+    }
+
+    /// Check each reference kind's graph for cycles; the four kinds'
+    /// graphs are independent and are searched in parallel. Returns
+    /// true if any cycle was found.
+    pub fn check_for_cycles(&self) -> bool {
+        let cycles: Vec<(RefKind, Vec<ObjIdx>)> = RefKind::ALL
+            .par_iter()
+            .filter_map(|&kind| self.find_cycle(kind).map(|cycle| (kind, cycle)))
+            .collect();
+        if cycles.is_empty() {
+            println!("NO CYCLES");
+            return false;
+        }
+        for (kind, cycle) in cycles {
+            println!("CYCLE DETECTED in {} references!", kind.name());
+            for idx in cycle {
+                println!("  {}", self.objects[idx as usize].describe());
+            }
+        }
+        true
+    }
+}
@@ -1,7 +1,9 @@
 use std::cmp::{Reverse, max, min};
 use std::collections::BTreeMap;
 
-use crate::state::{Proc, ProcEntry, ProcEntryKind, State, Timestamp};
+use petgraph::graph::NodeIndex;
+
+use crate::state::{EventEntry, EventEntryKind, Proc, ProcEntry, ProcEntryKind, State, Timestamp};
 
 #[derive(Debug, Copy, Clone)]
 struct ProcEntryStats {
@@ -223,6 +225,147 @@ fn print_statistics(
     }
 }
 
+// Attribute a segment of the critical path to a subsystem based on what
+// produced the event that ended the segment. Task events are refined by
+// looking up their creator on the processor timelines so that application
+// tasks, runtime meta-tasks, and mapper calls are reported separately.
+fn critical_path_category(state: &State, entry: &EventEntry) -> &'static str {
+    match entry.kind {
+        EventEntryKind::TaskEvent => {
+            if let Some(creator) = entry.creator {
+                if let Some(proc_id) = state.prof_uid_proc.get(&creator) {
+                    if let Some(proc_entry) = state
+                        .procs
+                        .get(proc_id)
+                        .and_then(|proc| proc.find_entry(creator))
+                    {
+                        return match proc_entry.kind {
+                            ProcEntryKind::Task(..) | ProcEntryKind::GPUKernel(..) => {
+                                "Task Execution"
+                            }
+                            ProcEntryKind::MetaTask(_) => "Runtime Meta-Tasks",
+                            ProcEntryKind::MapperCall(..) => "Mapper Calls",
+                            ProcEntryKind::RuntimeCall(_) => "Runtime Calls",
+                            ProcEntryKind::ApplicationCall(_) => "Application Calls",
+                            ProcEntryKind::ProfTask => "Profiler Responses",
+                        };
+                    }
+                }
+            }
+            "Task Execution"
+        }
+        EventEntryKind::FillEvent | EventEntryKind::CopyEvent => "DMA Transfers",
+        EventEntryKind::DepPartEvent => "Dependent Partitioning",
+        EventEntryKind::InstanceReady
+        | EventEntryKind::InstanceRedistrict
+        | EventEntryKind::InstanceDeletion => "Instance Allocation",
+        EventEntryKind::MergeEvent
+        | EventEntryKind::TriggerEvent
+        | EventEntryKind::PoisonEvent
+        | EventEntryKind::ArriveBarrier
+        | EventEntryKind::ReservationAcquire
+        | EventEntryKind::CompletionQueueEvent => "Event Propagation",
+        EventEntryKind::ExternalHandshake | EventEntryKind::ExternalEvent(_) => {
+            "External (Realm Modules)"
+        }
+        EventEntryKind::UnknownEvent => "Unknown",
+    }
+}
+
+// Walk the critical path backwards from the last event to trigger and
+// report how its latency decomposes by subsystem. Requires the Realm event
+// graph data (and hence compute_critical_paths to have run already).
+fn analyze_critical_path(state: &State) {
+    println!();
+    println!("  -------------------------");
+    println!("  Critical Path Summary");
+    println!("  -------------------------");
+    println!();
+    if !state.has_critical_path_data() {
+        println!("      (no event graph data in these logs)");
+        return;
+    }
+    // The critical path ends at the last event to trigger
+    let mut terminal: Option<(NodeIndex<usize>, Timestamp)> = None;
+    for index in state.event_graph.node_indices() {
+        let entry = state.event_graph.node_weight(index).unwrap();
+        if let Some(trigger_time) = entry.trigger_time {
+            if terminal.map_or(true, |(_, best)| best < trigger_time) {
+                terminal = Some((index, trigger_time));
+            }
+        }
+    }
+    let Some((mut vertex, path_stop)) = terminal else {
+        println!("      (no triggered events in these logs)");
+        return;
+    };
+    let mut totals = BTreeMap::<&'static str, (Timestamp, u64)>::new();
+    let mut path_start = path_stop;
+    // The walk is bounded by the node count to be safe against any cycles
+    // that bugs in the logs might have introduced
+    let mut remaining_steps = state.event_graph.node_count();
+    while remaining_steps > 0 {
+        remaining_steps -= 1;
+        let entry = state.event_graph.node_weight(vertex).unwrap();
+        let Some(trigger_time) = entry.trigger_time else {
+            break;
+        };
+        let Some(critical) = entry.critical else {
+            break;
+        };
+        if critical == vertex {
+            // Start of the chain - charge everything from the creation of
+            // this event (if known) to its category
+            if let Some(creation_time) = entry.creation_time {
+                if creation_time < trigger_time {
+                    let (total, segments) = totals
+                        .entry(critical_path_category(state, entry))
+                        .or_insert((Timestamp::ZERO, 0));
+                    *total += trigger_time - creation_time;
+                    *segments += 1;
+                    path_start = creation_time;
+                } else {
+                    path_start = trigger_time;
+                }
+            } else {
+                path_start = trigger_time;
+            }
+            break;
+        }
+        let critical_entry = state.event_graph.node_weight(critical).unwrap();
+        let Some(critical_time) = critical_entry.trigger_time else {
+            break;
+        };
+        if critical_time < trigger_time {
+            let (total, segments) = totals
+                .entry(critical_path_category(state, entry))
+                .or_insert((Timestamp::ZERO, 0));
+            *total += trigger_time - critical_time;
+            *segments += 1;
+        }
+        path_start = critical_time;
+        vertex = critical;
+    }
+    let path_time = path_stop - path_start;
+    println!("      Critical path length: {:.3} us", path_time.to_us());
+    let mut ordering = BTreeMap::<Reverse<Timestamp>, Vec<&'static str>>::new();
+    for (category, (total, _)) in &totals {
+        ordering.entry(Reverse(*total)).or_default().push(category);
+    }
+    for categories in ordering.values() {
+        for category in categories {
+            let (total, segments) = totals.get(*category).unwrap();
+            println!(
+                "          {}: {:.3} us ({:.2}%) over {} segment(s)",
+                category,
+                total.to_us(),
+                100.0 * total.to_us() / path_time.to_us(),
+                segments
+            );
+        }
+    }
+}
+
 pub fn analyze_statistics(state: &State) {
     let mut task_stats = BTreeMap::new();
     let mut runtime_stats = BTreeMap::new();
@@ -233,4 +376,5 @@ pub fn analyze_statistics(state: &State) {
     print_statistics(state, &task_stats, "Task Statistics");
     print_statistics(state, &runtime_stats, "Runtime Statistics");
     print_statistics(state, &mapper_stats, "Mapper Statistics");
+    analyze_critical_path(state);
 }
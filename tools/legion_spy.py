@@ -12394,6 +12394,8 @@ config_pat               = re.compile(
     prefix+"Legion Spy Logging")
 detailed_config_pat      = re.compile(
     prefix+"Legion Spy Detailed Logging")
+sampling_config_pat      = re.compile(
+    prefix+"Legion Spy Sampling (?P<rate>[0-9]+)")
 # Patterns for the shape of the machine
 proc_kind_pat            = re.compile(
     prefix+"Processor Kind (?P<kind>[0-9]+) (?P<name>.+)")
@@ -13656,6 +13658,10 @@ def parse_legion_spy_line(line, state):
     if m is not None:
         state.set_config(True)
         return True
+    m = sampling_config_pat.match(line)
+    if m is not None:
+        state.set_sampling_rate(int(m.group('rate')))
+        return True
     m = replay_op_pat.match(line)
     if m is not None:
         op = state.get_operation(int(m.group('uid')))
@@ -13701,12 +13707,14 @@ class State(object):
                  'slice_slice', 'point_slice', 'point_point', 'futures', 'next_generation', 
                  'next_realm_num', 'next_indirections_num', 'detailed_graphs',  
                  'assert_on_error', 'assert_on_warning', 'bad_graph_on_error', 
-                 'eq_graph_on_error', 'config', 'detailed_logging', 'replicants', 'eq_sets']
+                 'eq_graph_on_error', 'config', 'detailed_logging', 'sampling_rate',
+                 'replicants', 'eq_sets']
     def __init__(self, temp_dir, verbose, details, assert_on_error, 
                  assert_on_warning, bad_graph_on_error, eq_graph_on_error):
         self.temp_dir = temp_dir
         self.config = False
         self.detailed_logging = True
+        self.sampling_rate = 1
         self.verbose = verbose
         self.detailed_graphs = details
         self.assert_on_error = assert_on_error
@@ -13764,6 +13772,9 @@ class State(object):
         self.config = True
         self.detailed_logging = detailed
 
+    def set_sampling_rate(self, rate):
+        self.sampling_rate = rate
+
     def get_next_traversal_generation(self):
         result = self.next_generation
         self.next_generation += 1
@@ -13800,6 +13811,14 @@ class State(object):
         return matches
 
     def post_parse(self, simplify_graphs, need_physical):
+        if self.sampling_rate > 1:
+            print('NOTE: These logs were captured with -lg:spy_sample '+
+                  str(self.sampling_rate)+' so only one in every '+
+                  str(self.sampling_rate)+' points of each index space '+
+                  'launch was recorded. The subgraphs of the recorded '+
+                  'points are exact, but index launches will appear to '+
+                  'have fewer points than the application ran and any '+
+                  'verification analyses are unsound on sampled logs.')
         for space in itervalues(self.index_spaces):
             if space.parent is None:
                 space.update_depth(-1)
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 Stanford University, NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Converter from the binary Legion Spy event graph files produced with
+# -lg:spy_binary back into the text logging format that legion_spy.py
+# consumes. The record kinds and their fields must be kept in sync with
+# SpyBinaryLogger in runtime/legion/legion_spy.h. Typical usage:
+#
+#   ./legion_spy_bin2log.py spy_binary_*.bin >> spy_log.log
+#
+# The converted lines can be appended to the normal text log files from
+# the same run before handing everything to legion_spy.py.
+
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+
+import argparse
+import struct
+import sys
+
+MAGIC = b'lgspybin'
+SUPPORTED_VERSION = 1
+HEADER = struct.Struct('<II')
+TAG = struct.Struct('<B')
+
+# Field formats: 'x' = unsigned printed in hex (realm ids via IDFMT),
+# 'u' = unsigned printed in decimal, 'd' = signed printed in decimal.
+# Order matches the RecordKind enum in legion_spy.h.
+RECORD_KINDS = [
+    ('Event Event', 'xx'),
+    ('Reservation', 'xxx'),
+    ('Ap User Event', 'xu'),
+    ('Rt User Event', 'xu'),
+    ('Pred Event', 'x'),
+    ('Ap User Event Trigger', 'x'),
+    ('Rt User Event Trigger', 'x'),
+    ('Pred Event Trigger', 'x'),
+    ('Operation Events', 'uxx'),
+    ('Copy Events', 'udddxxd'),
+    ('Copy Field', 'xdxdxd'),
+    ('Indirect Events', 'uddxx'),
+    ('Indirect Field', 'xdxddxdd'),
+    ('Indirect Instance', 'uuxd'),
+    ('Indirect Group', 'uuxu'),
+    ('Fill Events', 'udddxxud'),
+    ('Fill Field', 'xdx'),
+    ('Deppart Events', 'udxxd'),
+    ('Replay Operation', 'u'),
+]
+
+def render_field(value, fmt):
+    if fmt == 'x':
+        return '%x' % (value & 0xFFFFFFFFFFFFFFFF)
+    if fmt == 'u':
+        return '%d' % (value & 0xFFFFFFFFFFFFFFFF)
+    return '%d' % value
+
+def convert_file(file_name, out):
+    with open(file_name, 'rb') as f:
+        magic = f.read(len(MAGIC))
+        if magic != MAGIC:
+            print('ERROR: %s is not a Legion Spy binary log file' %
+                  file_name, file=sys.stderr)
+            return False
+        version, node = HEADER.unpack(f.read(HEADER.size))
+        if version != SUPPORTED_VERSION:
+            print('ERROR: %s has unsupported version %d (expected %d)' %
+                  (file_name, version, SUPPORTED_VERSION), file=sys.stderr)
+            return False
+        # Reconstruct the logger prefix that legion_spy.py expects, the
+        # thread id carries no information so it is always zero here
+        prefix = '[%d - 0] {spy}{legion_spy}: ' % node
+        while True:
+            tag = f.read(TAG.size)
+            if len(tag) == 0:
+                break
+            kind, = TAG.unpack(tag)
+            if kind >= len(RECORD_KINDS):
+                print('WARNING: unknown record kind %d in %s, '
+                      'stopping early' % (kind, file_name), file=sys.stderr)
+                return False
+            name, formats = RECORD_KINDS[kind]
+            fields = struct.Struct('<%dq' % len(formats))
+            data = f.read(fields.size)
+            if len(data) < fields.size:
+                # The job probably crashed in the middle of a record
+                print('WARNING: truncated record at end of %s' % file_name,
+                      file=sys.stderr)
+                return False
+            values = fields.unpack(data)
+            out.write(prefix + name + ' ' + ' '.join(
+                render_field(v, f) for v, f in zip(values, formats)) + '\n')
+    return True
+
+def main():
+    parser = argparse.ArgumentParser(description=
+        'Convert binary Legion Spy event graph files back to text')
+    parser.add_argument('-o', '--output', default=None,
+        help='output file to write (default is standard output)')
+    parser.add_argument('file_names', nargs='+',
+        help='binary log files produced with -lg:spy_binary')
+    args = parser.parse_args()
+    out = open(args.output, 'w') if args.output is not None else sys.stdout
+    success = True
+    try:
+        for file_name in args.file_names:
+            if not convert_file(file_name, out):
+                success = False
+    finally:
+        if out is not sys.stdout:
+            out.close()
+    sys.exit(0 if success else 1)
+
+if __name__ == '__main__':
+    main()
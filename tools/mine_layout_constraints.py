@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 Stanford University, NVIDIA Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Mine accessor usage logged by '-lg:mine_layouts -level layout_mining=2'
+# and emit a layout override file for '-lg:layout_overrides'. Each line of
+# the override file names a (task id, region requirement index) pair whose
+# registration-time layout constraints the runtime should drop, letting
+# the mapper choose layouts based on what the profiled run actually did.
+
+import argparse
+import re
+import sys
+from collections import defaultdict
+
+ACCESSOR_RE = re.compile(
+    r"\{layout_mining\}: accessor task=(?P<task>\S+) "
+    r"task_id=(?P<task_id>\d+) uid=(?P<uid>\d+) region=(?P<region>\d+) "
+    r"fid=(?P<fid>\d+) size=(?P<size>\d+) mode=(?P<mode>\d+) "
+    r"memory=(?P<memory>\S+)")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Mine layout override candidates from accessor logs")
+    parser.add_argument("files", nargs="+", type=argparse.FileType("r"),
+                        help="log files from a run with -lg:mine_layouts")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="override file to write (default stdout)")
+    parser.add_argument("-m", "--min-memories", type=int, default=2,
+                        help="only relax requirements whose accessors were "
+                        "seen in at least this many distinct memories "
+                        "(default 2)")
+    args = parser.parse_args()
+
+    # (task_id, region) -> set of fids, set of memories, task name
+    fields = defaultdict(set)
+    memories = defaultdict(set)
+    names = {}
+    for f in args.files:
+        for line in f:
+            m = ACCESSOR_RE.search(line)
+            if m is None:
+                continue
+            key = (int(m.group("task_id")), int(m.group("region")))
+            names[key] = m.group("task")
+            fields[key].add(int(m.group("fid")))
+            memories[key].add(m.group("memory"))
+
+    if not fields:
+        print("No layout mining records found; was the run configured "
+              "with -lg:mine_layouts and -level layout_mining=2?",
+              file=sys.stderr)
+        return 1
+
+    out = args.output
+    out.write("# Layout constraint overrides mined by "
+              "mine_layout_constraints.py\n")
+    out.write("# Pass this file to the runtime with -lg:layout_overrides\n")
+    out.write("# Format: <task_id> <region_requirement_index>\n")
+    for key in sorted(fields):
+        task_id, region = key
+        # Requirements accessed from several memory kinds are the ones
+        # where a registration-time layout constraint is most likely to
+        # be forcing copies; single-memory requirements are left alone.
+        if len(memories[key]) < args.min_memories:
+            continue
+        out.write("# task %s: region %d touched fields %s in %d memories\n" %
+                  (names[key], region,
+                   sorted(fields[key]), len(memories[key])))
+        out.write("%d %d\n" % (task_id, region))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())